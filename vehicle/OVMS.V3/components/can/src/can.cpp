@@ -45,6 +45,7 @@ static const char *TAG = "can";
 #include <ctype.h>
 #include <string.h>
 #include <iomanip>
+#include "esp_timer.h"
 #include "ovms_config.h"
 #include "ovms_command.h"
 #include "metrics_standard.h"
@@ -522,6 +523,28 @@ bool canfilter::IsFiltered(const CAN_frame_t* p_frame)
   return false;
   }
 
+/**
+ * IsFilteredRange: check if frames of the buses in busmask (bit n = bus n+1)
+ *  with IDs in the range may pass the filter (i.e. to skip a log block)
+ */
+bool canfilter::IsFilteredRange(uint8_t busmask, uint32_t id_from, uint32_t id_to)
+  {
+  if (m_filters.size() == 0) return true;
+
+  for (CAN_filter_t* filter : m_filters)
+    {
+    if (filter->bus)
+      {
+      int busnumber = filter->bus - '1';
+      if (busnumber < 0 || busnumber > 7 || !(busmask & (1 << busnumber))) continue;
+      }
+    if ((id_to >= filter->id_from) && (id_from <= filter->id_to))
+      return true;
+    }
+
+  return false;
+  }
+
 bool canfilter::IsFiltered(canbus* bus)
   {
   if (m_filters.size() == 0) return true;
@@ -554,6 +577,205 @@ std::string canfilter::Info()
   return buf.str();
   }
 
+////////////////////////////////////////////////////////////////////////
+// CAN listener subscriptions
+// Per listener, 11 bit IDs are indexed by a table per bus mapping the ID
+// to the first matching subscription, extended IDs are looked up by
+// binary search over the range subscriptions plus a scan of the masks.
+////////////////////////////////////////////////////////////////////////
+
+canlistener::canlistener(QueueHandle_t queue, bool txfeedback, const char* name)
+  {
+  m_queue = queue;
+  m_txfeedback = txfeedback;
+  m_name = name;
+  for (int k=0; k<CAN_MAXBUSES; k++) m_stdindex[k] = NULL;
+  ClearCounters();
+  }
+
+canlistener::~canlistener()
+  {
+  Unsubscribe();
+  }
+
+void canlistener::ClearCounters()
+  {
+  m_frames_queued = 0;
+  m_frames_dropped = 0;
+  m_frames_overflow = 0;
+  for (CAN_subscription_t& sub : m_subs)
+    sub.frames = 0;
+  }
+
+bool canlistener::Matches(const CAN_subscription_t* sub, const CAN_frame_t* frame)
+  {
+  if (sub->bus && sub->bus != frame->origin)
+    return false;
+  if (sub->mask)
+    return ((frame->MsgID & sub->mask) == (sub->id_from & sub->mask));
+  else
+    return (frame->MsgID >= sub->id_from && frame->MsgID <= sub->id_to);
+  }
+
+bool canlistener::Subscribe(canbus* bus, uint32_t id_from, uint32_t id_to, uint32_t mask)
+  {
+  if (!mask && id_to < id_from)
+    return false;
+  for (const CAN_subscription_t& sub : m_subs)
+    {
+    if (sub.bus == bus && sub.id_from == id_from && sub.id_to == id_to && sub.mask == mask)
+      return true; // already subscribed
+    }
+  if (m_subs.size() >= CAN_MAXSUBSCRIPTIONS)
+    {
+    ESP_LOGE(TAG, "Listener %s: too many subscriptions", m_name ? m_name : "-");
+    return false;
+    }
+
+  CAN_subscription_t sub = { bus, id_from, mask ? id_from : id_to, mask, 0 };
+  m_subs.push_back(sub);
+  IndexStandard(m_subs.size()-1);
+  IndexExtended();
+  return true;
+  }
+
+void canlistener::Unsubscribe()
+  {
+  m_subs.clear();
+  for (int k=0; k<CAN_MAXBUSES; k++)
+    {
+    if (m_stdindex[k])
+      {
+      free(m_stdindex[k]);
+      m_stdindex[k] = NULL;
+      }
+    }
+  m_extranges.clear();
+  m_extmaxto.clear();
+  m_extmasks.clear();
+  }
+
+void canlistener::IndexStandard(uint8_t nr)
+  {
+  const CAN_subscription_t& sub = m_subs[nr];
+  uint32_t from, to;
+  if (sub.mask)
+    {
+    from = 0;
+    to = CAN_STDID_COUNT-1;
+    }
+  else
+    {
+    if (sub.id_from >= CAN_STDID_COUNT)
+      return;
+    from = sub.id_from;
+    to = LIMIT_MAX(sub.id_to, CAN_STDID_COUNT-1);
+    }
+
+  for (int k=0; k<CAN_MAXBUSES; k++)
+    {
+    if (sub.bus && sub.bus->m_busnumber != k)
+      continue;
+    if (!m_stdindex[k])
+      {
+      m_stdindex[k] = (uint8_t*) ExternalRamCalloc(CAN_STDID_COUNT, sizeof(uint8_t));
+      if (!m_stdindex[k])
+        {
+        ESP_LOGE(TAG, "Listener %s: out of memory", m_name ? m_name : "-");
+        return;
+        }
+      }
+    uint8_t* index = m_stdindex[k];
+    for (uint32_t id = from; id <= to; id++)
+      {
+      if (index[id] == 0 && (!sub.mask || (id & sub.mask) == (sub.id_from & sub.mask)))
+        index[id] = nr+1;
+      }
+    }
+  }
+
+void canlistener::IndexExtended()
+  {
+  m_extranges.clear();
+  m_extmasks.clear();
+  for (int nr=0; nr < m_subs.size(); nr++)
+    {
+    if (m_subs[nr].mask)
+      m_extmasks.push_back(nr);
+    else
+      m_extranges.push_back(nr);
+    }
+  std::stable_sort(m_extranges.begin(), m_extranges.end(),
+    [this](uint8_t a, uint8_t b) { return m_subs[a].id_from < m_subs[b].id_from; });
+  m_extmaxto.resize(m_extranges.size());
+  uint32_t maxto = 0;
+  for (int i=0; i < m_extranges.size(); i++)
+    {
+    maxto = std::max(maxto, m_subs[m_extranges[i]].id_to);
+    m_extmaxto[i] = maxto;
+    }
+  }
+
+CAN_subscription_t* canlistener::Match(const CAN_frame_t* frame)
+  {
+  if (frame->FIR.B.FF == CAN_frame_std && frame->MsgID < CAN_STDID_COUNT)
+    {
+    // 11 bit ID: direct index lookup
+    if (!frame->origin || frame->origin->m_busnumber < 0 || frame->origin->m_busnumber >= CAN_MAXBUSES)
+      return NULL;
+    uint8_t* index = m_stdindex[frame->origin->m_busnumber];
+    if (!index || !index[frame->MsgID])
+      return NULL;
+    return &m_subs[index[frame->MsgID]-1];
+    }
+
+  // 29 bit ID: find last range starting at or below the ID, then
+  //  check back while ranges may still cover the ID:
+  auto it = std::upper_bound(m_extranges.begin(), m_extranges.end(), frame->MsgID,
+    [this](uint32_t id, uint8_t nr) { return id < m_subs[nr].id_from; });
+  for (int i = (it - m_extranges.begin()) - 1; i >= 0 && m_extmaxto[i] >= frame->MsgID; i--)
+    {
+    CAN_subscription_t* sub = &m_subs[m_extranges[i]];
+    if (Matches(sub, frame))
+      return sub;
+    }
+  for (uint8_t nr : m_extmasks)
+    {
+    CAN_subscription_t* sub = &m_subs[nr];
+    if (Matches(sub, frame))
+      return sub;
+    }
+  return NULL;
+  }
+
+std::string canlistener::Info()
+  {
+  std::ostringstream buf;
+  for (const CAN_subscription_t& sub : m_subs)
+    {
+    buf << "  " << (sub.bus ? sub.bus->GetName() : "any") << ':'
+        << std::hex << std::setfill('0') << std::setw(3) << sub.id_from;
+    if (sub.mask)
+      buf << '/' << std::setw(3) << sub.mask;
+    else if (sub.id_to != sub.id_from)
+      buf << '-' << std::setw(3) << sub.id_to;
+    buf << std::dec << std::setfill(' ') << std::setw(0)
+        << " frames=" << sub.frames << "\n";
+    }
+  return buf.str();
+  }
+
+void can_subscriptions(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyCan.ListenerStatus(writer);
+  }
+
+void can_subscriptions_clear(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyCan.ClearListenerStatus();
+  writer->puts("Listener statistics cleared");
+  }
+
 ////////////////////////////////////////////////////////////////////////
 // CAN logging and tracing
 // These structures are involved in formatting, logging and tracing of
@@ -580,31 +802,54 @@ const char* GetCanLogTypeName(CAN_log_type_t type)
 
 void can::LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame)
   {
+  if (!bus || !frame) return;
   OvmsRecMutexLock lock(&m_loggermap_mutex);
-
-  for (canlog_map_t::iterator it=m_loggermap.begin(); it!=m_loggermap.end(); ++it)
-    {
-    it->second->LogFrame(bus, type, frame);
-    }
+  if (FilterLoggers(bus, frame) && MyCanLogRing.LogFrame(bus, type, frame))
+    NotifyLoggers();
   }
 
 void can::LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* status)
   {
+  if (!bus) return;
+  OvmsRecMutexLock lock(&m_loggermap_mutex);
+  if (FilterLoggers(bus, NULL) && MyCanLogRing.LogStatus(bus, type, status))
+    NotifyLoggers();
+  }
+
+void can::LogInfo(canbus* bus, CAN_log_type_t type, const char* text)
+  {
+  if (!text) return;
   OvmsRecMutexLock lock(&m_loggermap_mutex);
+  if (FilterLoggers(bus, NULL) && MyCanLogRing.LogInfo(bus, type, text))
+    NotifyLoggers();
+  }
 
+/**
+ * FilterLoggers: apply the logger filters before storing a log record,
+ *  so records no logger wants don't take ring space.
+ *  Returns true if any open logger accepts the record.
+ */
+bool can::FilterLoggers(canbus* bus, const CAN_frame_t* frame)
+  {
+  bool accept = false;
   for (canlog_map_t::iterator it=m_loggermap.begin(); it!=m_loggermap.end(); ++it)
     {
-    it->second->LogStatus(bus, type, status);
+    canlog* logger = it->second;
+    if (!logger->IsOpen())
+      continue;
+    if (logger->Accept(bus, frame))
+      accept = true;
+    else
+      logger->m_filtercount++;
     }
+  return accept;
   }
 
-void can::LogInfo(canbus* bus, CAN_log_type_t type, const char* text)
+void can::NotifyLoggers()
   {
-  OvmsRecMutexLock lock(&m_loggermap_mutex);
-
   for (canlog_map_t::iterator it=m_loggermap.begin(); it!=m_loggermap.end(); ++it)
     {
-    it->second->LogInfo(bus, type, text);
+    it->second->Notify();
     }
   }
 
@@ -764,6 +1009,7 @@ uint32_t can::AddPlayer(canplay* player, int filterc, const char* const* filterv
   OvmsMutexLock lock(&m_playermap_mutex);
   uint32_t id = m_player_id++;
   m_playermap[id] = player;
+  player->Start();
 
   return id;
   }
@@ -874,6 +1120,8 @@ can::can()
 
   m_logger_id = 1;
   m_player_id = 1;
+  m_notify_count = 0;
+  m_notify_time = 0;
 
   MyConfig.RegisterParam("can", "CAN Configuration", true, true);
 
@@ -908,6 +1156,8 @@ can::can()
     }
 
   cmd_can->RegisterCommand("list", "List CAN buses", can_list);
+  OvmsCommand* cmd_cansub = cmd_can->RegisterCommand("subscriptions", "Show CAN listener subscriptions & statistics", can_subscriptions);
+  cmd_cansub->RegisterCommand("clear", "Clear CAN listener statistics", can_subscriptions_clear);
 
   m_rxqueue = xQueueCreate(CONFIG_OVMS_HW_CAN_RX_QUEUE_SIZE,sizeof(CAN_queue_msg_t));
   xTaskCreatePinnedToCore(CAN_rxtask, "OVMS CanRx", 2*2048, (void*)this, 23, &m_rxtask, CORE(0));
@@ -946,25 +1196,133 @@ void can::IncomingFrame(CAN_frame_t* p_frame)
   NotifyListeners(p_frame, false);
   }
 
-void can::RegisterListener(QueueHandle_t queue, bool txfeedback)
+void can::RegisterListener(QueueHandle_t queue, bool txfeedback, const char* name)
   {
-  m_listeners[queue] = txfeedback;
+  OvmsMutexLock lock(&m_listeners_mutex);
+  auto it = m_listeners.find(queue);
+  if (it != m_listeners.end())
+    {
+    it->second->m_txfeedback = txfeedback;
+    if (name) it->second->m_name = name;
+    }
+  else
+    {
+    m_listeners[queue] = new canlistener(queue, txfeedback, name);
+    }
   }
 
 void can::DeregisterListener(QueueHandle_t queue)
   {
+  OvmsMutexLock lock(&m_listeners_mutex);
   auto it = m_listeners.find(queue);
   if (it != m_listeners.end())
+    {
+    delete it->second;
     m_listeners.erase(it);
+    }
+  }
+
+/**
+ * SubscribeListener: restrict a listener to the frames it handles
+ *  Once a listener has a subscription, only frames matching one of its
+ *  subscriptions will be queued to it. Subscriptions are additive,
+ *  duplicates are ignored.
+ *
+ *  @param queue      Listener queue (must be registered)
+ *  @param bus        Bus to subscribe or NULL for all buses
+ *  @param id_from    First ID of range
+ *  @param id_to      Last ID of range
+ *  @return           true = subscription active
+ */
+bool can::SubscribeListener(QueueHandle_t queue, canbus* bus, uint32_t id_from, uint32_t id_to)
+  {
+  OvmsMutexLock lock(&m_listeners_mutex);
+  auto it = m_listeners.find(queue);
+  if (it == m_listeners.end())
+    return false;
+  return it->second->Subscribe(bus, id_from, id_to);
+  }
+
+/**
+ * SubscribeListenerMask: like SubscribeListener, but matching the ID bits
+ *  set in mask: (MsgID & mask) == (id & mask)
+ */
+bool can::SubscribeListenerMask(QueueHandle_t queue, canbus* bus, uint32_t id, uint32_t mask)
+  {
+  if (mask == 0)
+    return false;
+  OvmsMutexLock lock(&m_listeners_mutex);
+  auto it = m_listeners.find(queue);
+  if (it == m_listeners.end())
+    return false;
+  return it->second->Subscribe(bus, id, id, mask);
+  }
+
+/**
+ * UnsubscribeListener: remove all subscriptions, listener will receive all frames
+ */
+void can::UnsubscribeListener(QueueHandle_t queue)
+  {
+  OvmsMutexLock lock(&m_listeners_mutex);
+  auto it = m_listeners.find(queue);
+  if (it != m_listeners.end())
+    it->second->Unsubscribe();
   }
 
 void can::NotifyListeners(const CAN_frame_t* frame, bool tx)
   {
+  int64_t started = esp_timer_get_time();
+  OvmsMutexLock lock(&m_listeners_mutex);
   for (CanListenerMap_t::iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
     {
-    if (!tx || (tx && it->second))
-      xQueueSend(it->first,frame,0);
+    canlistener* listener = it->second;
+    if (tx && !listener->m_txfeedback)
+      continue;
+    if (listener->IsSubscribed())
+      {
+      CAN_subscription_t* sub = listener->Match(frame);
+      if (!sub)
+        {
+        listener->m_frames_dropped++;
+        continue;
+        }
+      sub->frames++;
+      }
+    if (xQueueSend(listener->m_queue,frame,0) == pdTRUE)
+      listener->m_frames_queued++;
+    else
+      listener->m_frames_overflow++;
     }
+  m_notify_count++;
+  m_notify_time += esp_timer_get_time() - started;
+  }
+
+void can::ListenerStatus(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_listeners_mutex);
+  writer->printf("Dispatched: %u frames, %.1f us/frame\n", m_notify_count,
+    m_notify_count ? (float)m_notify_time / m_notify_count : 0.0f);
+  for (CanListenerMap_t::iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
+    {
+    canlistener* listener = it->second;
+    writer->printf("\n%s%s: queued=%u dropped=%u overflow=%u\n",
+      listener->m_name ? listener->m_name : "(unnamed)",
+      listener->m_txfeedback ? " [tx]" : "",
+      listener->m_frames_queued, listener->m_frames_dropped, listener->m_frames_overflow);
+    if (listener->IsSubscribed())
+      writer->puts(listener->Info().c_str());
+    else
+      writer->puts("  all frames");
+    }
+  }
+
+void can::ClearListenerStatus()
+  {
+  OvmsMutexLock lock(&m_listeners_mutex);
+  m_notify_count = 0;
+  m_notify_time = 0;
+  for (CanListenerMap_t::iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
+    it->second->ClearCounters();
   }
 
 void can::RegisterCallback(const char* caller, CanFrameCallback callback, bool txfeedback)
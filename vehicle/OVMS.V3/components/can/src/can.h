@@ -42,6 +42,7 @@
 #include <stdint.h>
 #include <functional>
 #include <list>
+#include <vector>
 #include "pcp.h"
 #include <esp_err.h>
 #include "ovms_events.h"
@@ -62,6 +63,7 @@
 #define CAN_MAXBUSES 5            // Limit of number of CAN buses supported
 
 class canbus; // Forward definition
+class OvmsWriter;
 
 // CAN mode
 typedef enum
@@ -226,6 +228,7 @@ class canfilter
   public:
     bool IsFiltered(const CAN_frame_t* p_frame);
     bool IsFiltered(canbus* bus);
+    bool IsFilteredRange(uint8_t busmask, uint32_t id_from, uint32_t id_to);
     std::string Info();
 
   protected:
@@ -343,7 +346,62 @@ class canbus : public pcp, public InternalRamAllocated
 // can - the CAN system controller
 ////////////////////////////////////////////////////////////////////////
 
-typedef std::map<QueueHandle_t, bool> CanListenerMap_t;
+////////////////////////////////////////////////////////////////////////
+// CAN listener subscriptions
+// Listeners (frame queues) can subscribe to the ID ranges or masks they
+// handle per bus. The CAN rx task then only queues frames matching a
+// subscription, other frames are dropped before the queue copy.
+// Listeners without subscriptions receive all frames.
+////////////////////////////////////////////////////////////////////////
+
+#define CAN_MAXSUBSCRIPTIONS 254  // Limit of subscriptions per listener
+#define CAN_STDID_COUNT      2048 // Size of 11 bit ID index
+
+typedef struct
+  {
+  canbus*   bus;                    // bus to match, NULL = any bus
+  uint32_t  id_from;                // range: first ID / mask: ID bits to match
+  uint32_t  id_to;                  // range: last ID / mask: unused
+  uint32_t  mask;                   // 0 = range, else: (MsgID & mask) == (id_from & mask)
+  uint32_t  frames;                 // frames matched
+  } CAN_subscription_t;
+
+class canlistener : public InternalRamAllocated
+  {
+  public:
+    canlistener(QueueHandle_t queue, bool txfeedback, const char* name);
+    ~canlistener();
+
+  public:
+    bool Subscribe(canbus* bus, uint32_t id_from, uint32_t id_to, uint32_t mask=0);
+    void Unsubscribe();
+    bool IsSubscribed() { return !m_subs.empty(); }
+    CAN_subscription_t* Match(const CAN_frame_t* frame);
+    void ClearCounters();
+    std::string Info();
+
+  protected:
+    void IndexStandard(uint8_t sub);
+    void IndexExtended();
+    static bool Matches(const CAN_subscription_t* sub, const CAN_frame_t* frame);
+
+  public:
+    QueueHandle_t m_queue;
+    bool m_txfeedback;
+    const char* m_name;
+    uint32_t m_frames_queued;       // frames queued to listener
+    uint32_t m_frames_dropped;      // frames not subscribed (no queue copy)
+    uint32_t m_frames_overflow;     // frames lost due to queue full
+
+  protected:
+    std::vector<CAN_subscription_t> m_subs;
+    uint8_t* m_stdindex[CAN_MAXBUSES];  // 11 bit ID → subscription number+1, NULL = bus not subscribed
+    std::vector<uint8_t> m_extranges;   // range subscriptions sorted by id_from
+    std::vector<uint32_t> m_extmaxto;   // running maximum of id_to over m_extranges
+    std::vector<uint8_t> m_extmasks;    // mask subscriptions
+  };
+
+typedef std::map<QueueHandle_t, canlistener*> CanListenerMap_t;
 
 
 class CanFrameCallbackEntry
@@ -377,9 +435,14 @@ class can : public InternalRamAllocated
     QueueHandle_t m_rxqueue;
 
   public:
-    void RegisterListener(QueueHandle_t queue, bool txfeedback=false);
+    void RegisterListener(QueueHandle_t queue, bool txfeedback=false, const char* name=NULL);
     void DeregisterListener(QueueHandle_t queue);
+    bool SubscribeListener(QueueHandle_t queue, canbus* bus, uint32_t id_from, uint32_t id_to);
+    bool SubscribeListenerMask(QueueHandle_t queue, canbus* bus, uint32_t id, uint32_t mask);
+    void UnsubscribeListener(QueueHandle_t queue);
     void NotifyListeners(const CAN_frame_t* frame, bool tx);
+    void ListenerStatus(OvmsWriter* writer);
+    void ClearListenerStatus();
 
   public:
     void RegisterCallback(const char* caller, CanFrameCallback callback, bool txfeedback=false);
@@ -404,6 +467,8 @@ class can : public InternalRamAllocated
     void LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame);
     void LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* status);
     void LogInfo(canbus* bus, CAN_log_type_t type, const char* text);
+    bool FilterLoggers(canbus* bus, const CAN_frame_t* frame);
+    void NotifyLoggers();
 
   public:
     canbus* GetBus(int busnumber);
@@ -423,6 +488,9 @@ class can : public InternalRamAllocated
   private:
     canbus* m_buslist[CAN_MAXBUSES];
     CanListenerMap_t m_listeners;
+    OvmsMutex m_listeners_mutex;
+    uint32_t m_notify_count;          // frames dispatched to listeners
+    uint64_t m_notify_time;           // time spent dispatching [us]
     CanFrameCallbackList_t m_rxcallbacks;
     CanFrameCallbackList_t m_txcallbacks;
     TaskHandle_t m_rxtask;            // Task to handle reception
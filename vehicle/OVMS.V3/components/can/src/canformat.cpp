@@ -79,6 +79,7 @@ canformat::canformat(const char* type, canformat_serve_mode_t mode)
   m_type = type;
   m_servemode = mode;
   m_servediscarding = false;
+  m_trailer = false;
   }
 
 canformat::~canformat()
@@ -100,6 +101,20 @@ std::string canformat::getheader(struct timeval *time)
   return std::string("");
   }
 
+std::string canformat::gettrailer()
+  {
+  return std::string("");
+  }
+
+/**
+ * IsStateful: true if get() results depend on previous messages (and
+ *  so cannot be shared between loggers)
+ */
+bool canformat::IsStateful()
+  {
+  return false;
+  }
+
 size_t canformat::put(CAN_log_message_t* message, uint8_t *buffer, size_t len, bool* hasmore, canlogconnection* clc)
   {
   return 0;
@@ -160,6 +175,15 @@ size_t canformat::Stuff(uint8_t *buffer, size_t len)
   return consumed;
   }
 
+/**
+ * Reset: discard buffered input, i.e. after a seek
+ */
+void canformat::Reset()
+  {
+  m_buf.EmptyAll();
+  m_servediscarding = false;
+  }
+
 canformat::canformat_serve_mode_t canformat::GetServeMode()
   {
   return m_servemode;
@@ -192,3 +216,12 @@ void canformat::SetServeDiscarding(bool discarding)
   {
   m_servediscarding = discarding;
   }
+
+/**
+ * SetTrailer: announce the output will be closed by gettrailer(), i.e. formats
+ *  may collect trailer data (only done by file loggers)
+ */
+void canformat::SetTrailer(bool trailer)
+  {
+  m_trailer = trailer;
+  }
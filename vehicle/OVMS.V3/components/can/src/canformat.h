@@ -56,6 +56,8 @@ class canformat
   public: // Conversion from OVMS CAN log messages to specific format
     virtual std::string get(CAN_log_message_t* message);
     virtual std::string getheader(struct timeval *time = NULL);
+    virtual std::string gettrailer();
+    virtual bool IsStateful();
 
   public: // Conversion from specific format to OVMS CAN log messages
     virtual size_t put(CAN_log_message_t* message, uint8_t *buffer, size_t len, bool* hasmore, canlogconnection* clc=NULL);
@@ -71,10 +73,13 @@ class canformat
     void SetServeDiscarding(bool discarding);
     virtual size_t Serve(uint8_t *buffer, size_t len, canlogconnection* clc=NULL);
     virtual size_t Stuff(uint8_t *buffer, size_t len);
+    virtual void Reset();
+    void SetTrailer(bool trailer);
 
   protected:
     canformat_serve_mode_t m_servemode;
     bool m_servediscarding;
+    bool m_trailer;             // output will be closed by gettrailer()
     OvmsBuffer m_buf;
   };
 
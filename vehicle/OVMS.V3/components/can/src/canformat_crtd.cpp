@@ -164,124 +164,126 @@ size_t canformat_crtd::put(CAN_log_message_t* message, uint8_t *buffer, size_t l
   if (IsServeDiscarding()) return len;  // Quick return if discarding
 
   size_t consumed = Stuff(buffer,len);  // Stuff m_buf with as much as possible
-  if (m_buf.HasLine()<0)
+  OvmsLineSpan line;
+  if (!m_buf.PeekLine(&line))
     {
     return consumed; // No line, so quick exit
     }
   else
     {
     *hasmore = true;  // Call us again to see if we have more frames to process
-    std::string line = m_buf.ReadLine();
-    const char *b = line.c_str();
-
-    // We look for something like
-    // 1524311386.811100 1R11 100 01 02 03
-    if (!isdigit(b[0])) return consumed;    // Discard invalid line
-    for (;((*b != 0)&&(*b != ' '));b++) {}
-    if (*b == 0) return consumed;           // Discard invalid line
-    b++;
-    char bus = '1';
-    if (isdigit(*b))
-      {
-      bus = *b;
-      b++;
-      }
-
-    if ((b[0]=='R')&&(b[1]=='1')&&(b[2]=='1'))
-      {
-      // R11 incoming CAN frame
-      message->type = CAN_LogFrame_RX;
-      message->frame.FIR.B.FF = CAN_frame_std;
-      }
-    else if ((b[0]=='R')&&(b[1]=='2')&&(b[2]=='9'))
-      {
-      // R29 incoming CAN frame
-      message->type = CAN_LogFrame_RX;
-      message->frame.FIR.B.FF = CAN_frame_ext;
-      }
-    else if ((b[0]=='T')&&(b[1]=='1')&&(b[2]=='1'))
-      {
-      // T11 outgoing CAN frame
-      message->type = CAN_LogFrame_TX;
-      message->frame.FIR.B.FF = CAN_frame_std;
-      }
-    else if ((b[0]=='T')&&(b[1]=='2')&&(b[2]=='9'))
-      {
-      // T29 outgoingCAN frame
-      message->type = CAN_LogFrame_TX;
-      message->frame.FIR.B.FF = CAN_frame_ext;
-      }
-    else if ((b[0]=='C')&&(b[1]=='B')&&(b[2]=='C'))
-      {
-      // A command to configure a CAN bus
-      CAN_mode_t mode = (b[4]=='A')?CAN_MODE_ACTIVE:CAN_MODE_LISTEN;
-      CAN_speed_t speed;
-      switch (atoi(b+6))
-        {
-        case 33333:   speed = CAN_SPEED_33KBPS; break;
-        case 50000:   speed = CAN_SPEED_50KBPS; break;
-        case 83333:   speed = CAN_SPEED_83KBPS; break;
-        case 100000:  speed = CAN_SPEED_100KBPS; break;
-        case 125000:  speed = CAN_SPEED_125KBPS; break;
-        case 250000:  speed = CAN_SPEED_250KBPS; break;
-        case 500000:  speed = CAN_SPEED_500KBPS; break;
-        case 1000000: speed = CAN_SPEED_1000KBPS; break;
-        default:
-          return consumed;
-        }
-      if (clc) clc->ControlBusConfigure(MyCan.GetBus(bus - '1'), mode, speed);
-      return consumed;
-      }
-    else if ((b[0]=='C')&&(b[1]=='D')&&(b[2]=='P'))
-      {
-      // A command to pause the transmission of messages
-      if (clc) clc->PauseTransmission();
-      return consumed;
-      }
-    else if ((b[0]=='C')&&(b[1]=='D')&&(b[2]=='R'))
-      {
-      // A command to resume the transmission of messages
-      if (clc) clc->ResumeTransmission();
-      return consumed;
-      }
-    else if ((b[0]=='C')&&(b[1]=='F')&&(b[2]=='C'))
-      {
-      // A command to clear all filters for this connection
-      if (clc) clc->ClearFilters();
-      return consumed;
-      }
-    else if ((b[0]=='C')&&(b[1]=='F')&&(b[2]=='A'))
-      {
-      // A command to add a filter for this connection
-      std::string filter(b+4);
-      if (clc) clc->AddFilter(filter);
-      return consumed;
-      }
-    else
-      return consumed;  // Discard invalid line
+    ParseLine(message, line, clc);
+    m_buf.ConsumeLine();
+    return consumed;
+    }
+  }
 
-    if (b[3] != ' ') return consumed; // Discard invalid line
-    b += 4;
+void canformat_crtd::ParseLine(CAN_log_message_t* message, OvmsLineSpan b, canlogconnection* clc)
+  {
+  // We look for something like
+  // 1524311386.811100 1R11 100 01 02 03
+  if (!isdigit(b.Peek())) return;       // Discard invalid line
+  if (!b.SkipToken()) return;           // Discard invalid line
+  b.Advance(1);
+  char bus = '1';
+  if (isdigit(b.Peek()))
+    {
+    bus = b.Peek();
+    b.Advance(1);
+    }
 
-    char *p;
-    errno = 0;
-    message->frame.MsgID = (uint32_t)strtol(b,&p,16);
-    if ((message->frame.MsgID == 0)&&(errno != 0)) return consumed; // Discard invalid line
-    b = p;
-    for (int k=0;k<8;k++)
+  if (b.StartsWith("R11"))
+    {
+    // R11 incoming CAN frame
+    message->type = CAN_LogFrame_RX;
+    message->frame.FIR.B.FF = CAN_frame_std;
+    }
+  else if (b.StartsWith("R29"))
+    {
+    // R29 incoming CAN frame
+    message->type = CAN_LogFrame_RX;
+    message->frame.FIR.B.FF = CAN_frame_ext;
+    }
+  else if (b.StartsWith("T11"))
+    {
+    // T11 outgoing CAN frame
+    message->type = CAN_LogFrame_TX;
+    message->frame.FIR.B.FF = CAN_frame_std;
+    }
+  else if (b.StartsWith("T29"))
+    {
+    // T29 outgoingCAN frame
+    message->type = CAN_LogFrame_TX;
+    message->frame.FIR.B.FF = CAN_frame_ext;
+    }
+  else if (b.StartsWith("CBC"))
+    {
+    // A command to configure a CAN bus
+    CAN_mode_t mode = (b.Peek(4)=='A')?CAN_MODE_ACTIVE:CAN_MODE_LISTEN;
+    CAN_speed_t speed;
+    uint32_t bps = 0;
+    b.Advance(6);
+    b.Dec(&bps);
+    switch (bps)
       {
-      if (*b==0) break;
-      b++;
-      errno = 0;
-      long d = strtol(b,&p,16);
-      if ((d==0)&&(errno != 0)) break;
-      message->frame.data.u8[k] = (uint8_t)d;
-      message->frame.FIR.B.DLC++;
-      b = p;
+      case 33333:   speed = CAN_SPEED_33KBPS; break;
+      case 50000:   speed = CAN_SPEED_50KBPS; break;
+      case 83333:   speed = CAN_SPEED_83KBPS; break;
+      case 100000:  speed = CAN_SPEED_100KBPS; break;
+      case 125000:  speed = CAN_SPEED_125KBPS; break;
+      case 250000:  speed = CAN_SPEED_250KBPS; break;
+      case 500000:  speed = CAN_SPEED_500KBPS; break;
+      case 1000000: speed = CAN_SPEED_1000KBPS; break;
+      default:
+        return;
       }
+    if (clc) clc->ControlBusConfigure(MyCan.GetBus(bus - '1'), mode, speed);
+    return;
+    }
+  else if (b.StartsWith("CDP"))
+    {
+    // A command to pause the transmission of messages
+    if (clc) clc->PauseTransmission();
+    return;
+    }
+  else if (b.StartsWith("CDR"))
+    {
+    // A command to resume the transmission of messages
+    if (clc) clc->ResumeTransmission();
+    return;
+    }
+  else if (b.StartsWith("CFC"))
+    {
+    // A command to clear all filters for this connection
+    if (clc) clc->ClearFilters();
+    return;
+    }
+  else if (b.StartsWith("CFA"))
+    {
+    // A command to add a filter for this connection
+    b.Advance(4);
+    std::string filter = b.ToString();
+    if (clc) clc->AddFilter(filter);
+    return;
+    }
+  else
+    return;  // Discard invalid line
 
-    message->origin = MyCan.GetBus(bus - '1');
+  if (b.Peek(3) != ' ') return; // Discard invalid line
+  b.Advance(4);
 
-    return consumed;
+  uint32_t id;
+  b.SkipSpace();
+  if (!b.Hex(&id)) return;      // Discard invalid line
+  message->frame.MsgID = id;
+  for (int k=0;k<8;k++)
+    {
+    uint32_t d;
+    b.SkipSpace();
+    if (!b.Hex(&d)) break;
+    message->frame.data.u8[k] = (uint8_t)d;
+    message->frame.FIR.B.DLC++;
     }
+
+  message->origin = MyCan.GetBus(bus - '1');
   }
@@ -41,6 +41,9 @@ class canformat_crtd : public canformat
     virtual std::string get(CAN_log_message_t* message);
     virtual std::string getheader(struct timeval *time);
     virtual size_t put(CAN_log_message_t* message, uint8_t *buffer, size_t len, bool* hasmore, canlogconnection* clc=NULL);
+
+  protected:
+    void ParseLine(CAN_log_message_t* message, OvmsLineSpan line, canlogconnection* clc);
   };
 
 #endif // __CANFORMAT_CRTD_H__
@@ -118,66 +118,69 @@ size_t canformat_gvret_ascii::put(CAN_log_message_t* message, uint8_t *buffer, s
   if (IsServeDiscarding()) return len;  // Quick return if discarding
 
   size_t consumed = Stuff(buffer,len);  // Stuff m_buf with as much as possible
-
-  if (m_buf.HasLine()<0)
+  OvmsLineSpan line;
+  if (!m_buf.PeekLine(&line))
     {
     return consumed; // No line, so quick exit
     }
   else
     {
-    std::string line = m_buf.ReadLine();
-    char *b = strdup(line.c_str());
-
-    // We look for something like
-    // 1000 - 100 S 0 4 01 02 03 04
-    // timestamp, message ID (hex), S or X, length, data bytes
-
-    message->type = CAN_LogFrame_RX;
-
-    uint32_t timestamp = strtol(b,&b,10);
-    message->timestamp.tv_sec = timestamp % 1000000;
-    message->timestamp.tv_usec = timestamp / 1000000;
-
-    b += 2; // Skip the '-'
-
-    message->frame.MsgID = strtol(b,&b,16);
-    if (b[1] == 'S')
-      {
-      message->frame.FIR.B.FF = CAN_frame_std;
-      }
-    else if (b[1] == 'X')
-      {
-      message->frame.FIR.B.FF = CAN_frame_ext;
-      }
-    else
-      {
-      // Bad frame type - discard
-      free(b);
-      return consumed;
-      }
-
-    b += 2; // Skip the frame type
-
-    uint32_t busnumber = strtol(b,&b,10);
-
-    message->frame.FIR.B.DLC = strtol(b,&b,10);
-    if (message->frame.FIR.B.DLC > 8)
-      {
-      // Bad frame length - discard
-      free(b);
-      return consumed;
-      }
-
-    for (size_t x=0;x<message->frame.FIR.B.DLC;x++)
-      {
-      message->frame.data.u8[x] = strtol(b,&b,16);
-      }
+    *hasmore = true;  // Call us again to see if we have more frames to process
+    ParseLine(message, line);
+    m_buf.ConsumeLine();
+    return consumed;
+    }
+  }
 
-    message->origin = MyCan.GetBus(busnumber-'0');
+void canformat_gvret_ascii::ParseLine(CAN_log_message_t* message, OvmsLineSpan b)
+  {
+  // We look for something like
+  // 1000 - 100 S 0 4 01 02 03 04
+  // timestamp, message ID (hex), S or X, bus, length, data bytes
+
+  uint32_t timestamp, id, busnumber, dlc;
+  if (!b.Dec(&timestamp)) return;       // Discard invalid line
+  b.SkipSpace();
+  if (!b.Skip('-')) return;             // Discard invalid line
+  b.SkipSpace();
+  if (!b.Hex(&id)) return;              // Discard invalid line
+  b.SkipSpace();
+  if (b.Skip('S'))
+    {
+    message->frame.FIR.B.FF = CAN_frame_std;
+    }
+  else if (b.Skip('X'))
+    {
+    message->frame.FIR.B.FF = CAN_frame_ext;
+    }
+  else
+    {
+    // Bad frame type - discard
+    return;
+    }
+  b.SkipSpace();
+  if (!b.Dec(&busnumber)) return;       // Discard invalid line
+  b.SkipSpace();
+  if (!b.Dec(&dlc) || dlc > 8)
+    {
+    // Bad frame length - discard
+    return;
+    }
 
-    free(b);
-    return consumed;
+  for (size_t x=0;x<dlc;x++)
+    {
+    uint32_t d;
+    b.SkipSpace();
+    if (!b.Hex(&d, 2)) return;          // Discard invalid line
+    message->frame.data.u8[x] = (uint8_t)d;
     }
+
+  message->type = CAN_LogFrame_RX;
+  message->timestamp.tv_sec = timestamp / 1000000;
+  message->timestamp.tv_usec = timestamp % 1000000;
+  message->frame.MsgID = id;
+  message->frame.FIR.B.DLC = dlc;
+  message->origin = MyCan.GetBus(busnumber);
   }
 
 ////////////////////////////////////////////////////////////////////////
@@ -179,6 +179,9 @@ class canformat_gvret_ascii : public canformat_gvret
     canformat_gvret_ascii(const char* type);
     virtual std::string get(CAN_log_message_t* message);
     virtual size_t put(CAN_log_message_t* message, uint8_t *buffer, size_t len, bool* hasmore, canlogconnection* clc=NULL);
+
+  protected:
+    void ParseLine(CAN_log_message_t* message, OvmsLineSpan line);
   };
 
 class canformat_gvret_binary : public canformat_gvret
@@ -98,66 +98,66 @@ size_t canformat_lawricel::put(CAN_log_message_t* message, uint8_t *buffer, size
   if (IsServeDiscarding()) return len;  // Quick return if discarding
 
   size_t consumed = Stuff(buffer,len);  // Stuff m_buf with as much as possible
-
-  if (m_buf.HasLine()<0)
+  OvmsLineSpan line;
+  if (!m_buf.PeekLine(&line))
     {
     return consumed; // No line, so quick exit
     }
   else
     {
     *hasmore = true;  // Call us again to see if we have more frames to process
-    std::string line = m_buf.ReadLine();
-    const char *b = line.c_str();
-    char hex[9];
-
-    // We look for something like
-    // t100401020304000a
-    if (*b == 't')
-      {
-      // Standard frame
-      memcpy(hex,b+1,3);
-      hex[3] = 0;
-      message->type = CAN_LogFrame_RX;
-      message->frame.FIR.B.FF = CAN_frame_std;
-      message->frame.MsgID = strtol(hex,NULL,16);
-      b += 4;
-      }
-    else if (*b == 'T')
-      {
-      // Extended frame
-      memcpy(hex,b+1,8);
-      hex[8] = 0;
-      message->type = CAN_LogFrame_RX;
-      message->frame.FIR.B.FF = CAN_frame_ext;
-      message->frame.MsgID = strtol(hex,NULL,16);
-      b += 9;
-      }
-    else
-      {
-      // Unknown format - discard
-      return consumed; // Discard invalid line
-      }
-
-    message->frame.FIR.B.DLC = *b - '0';
-    if (message->frame.FIR.B.DLC > 8)
-      {
-      // Invalid length - discard
-      return consumed; // Discard invalid line
-      }
-
-    b++;
-    for (size_t x=0;x<message->frame.FIR.B.DLC;x++)
-      {
-      hex[0] = b[0];
-      hex[1] = b[2];
-      hex[2] = 0;
-      b += 2;
-      message->frame.data.u8[x] = (uint8_t)strtol(hex,NULL,16);
-      }
-
-    gettimeofday(&message->timestamp,NULL);
-    message->origin = MyCan.GetBus(0);
-
+    ParseLine(message, line);
+    m_buf.ConsumeLine();
     return consumed;
     }
   }
+
+void canformat_lawricel::ParseLine(CAN_log_message_t* message, OvmsLineSpan b)
+  {
+  // We look for something like
+  // t100401020304000a
+  int iddigits;
+  if (b.Peek() == 't')
+    {
+    // Standard frame
+    iddigits = 3;
+    message->frame.FIR.B.FF = CAN_frame_std;
+    }
+  else if (b.Peek() == 'T')
+    {
+    // Extended frame
+    iddigits = 8;
+    message->frame.FIR.B.FF = CAN_frame_ext;
+    }
+  else
+    {
+    // Unknown format - discard
+    return;
+    }
+
+  uint32_t id;
+  b.Advance(1);
+  if (b.Length() < (size_t)iddigits+1 || !b.Hex(&id, iddigits))
+    return; // Discard invalid line
+  message->frame.MsgID = id;
+
+  uint8_t dlc = b.Peek() - '0';
+  if (dlc > 8 || b.Length() < 1 + 2*(size_t)dlc)
+    {
+    // Invalid length - discard
+    return;
+    }
+  message->frame.FIR.B.DLC = dlc;
+
+  b.Advance(1);
+  for (size_t x=0;x<dlc;x++)
+    {
+    uint32_t d;
+    if (!b.Hex(&d, 2)) return;          // Discard invalid line
+    message->frame.data.u8[x] = (uint8_t)d;
+    }
+
+  message->type = CAN_LogFrame_RX;
+  gettimeofday(&message->timestamp,NULL);
+  message->origin = MyCan.GetBus(0);
+  }
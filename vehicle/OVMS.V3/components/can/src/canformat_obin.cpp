@@ -0,0 +1,378 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Module:        CAN dump OVMS binary format
+;    Date:          18th January 2018
+;
+;    (C) 2018       Mark Webb-Johnson
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "canformat-obin";
+
+#include "canformat_obin.h"
+#include <errno.h>
+#include <endian.h>
+#include <sys/param.h>
+#include "pcp.h"
+
+class OvmsCanFormatOBINInit
+  {
+  public: OvmsCanFormatOBINInit();
+} MyOvmsCanFormatOBINInit  __attribute__ ((init_priority (4505)));
+
+OvmsCanFormatOBINInit::OvmsCanFormatOBINInit()
+  {
+  ESP_LOGI(TAG, "Registering CAN Format: OVMSBIN (4505)");
+
+  MyCanFormatFactory.RegisterCanFormat<canformat_obin>("ovmsbin");
+  }
+
+canformat_obin::canformat_obin(const char* type)
+  : canformat(type)
+  {
+  m_recno = 0;
+  memset(&m_block,0,sizeof(m_block));
+  m_inblock = false;
+  m_ixflags = 0;
+  memset(&m_rbase,0,sizeof(m_rbase));
+  m_rinblock = false;
+  }
+
+canformat_obin::~canformat_obin()
+  {
+  }
+
+bool canformat_obin::IsStateful()
+  {
+  return true;
+  }
+
+/**
+ * CloseBlock: add the current block to the index
+ *  - the index is only collected if a trailer will be written
+ */
+void canformat_obin::CloseBlock()
+  {
+  if (!m_trailer || !m_inblock || m_block.count == 0)
+    return;
+
+  if (m_index.size() >= CANFORMAT_OBIN_MAXINDEX)
+    {
+    m_ixflags |= CANFORMAT_OBIN_IX_INCOMPLETE;
+    return;
+    }
+
+  canformat_obin_idx_t ix;
+  ix.recno = htole32(m_block.recno);
+  ix.tv_sec = htole32(m_block.tv_sec);
+  ix.tv_usec = htole32(m_block.tv_usec);
+  ix.id_min = htole32(m_block.id_min);
+  ix.id_max = htole32(m_block.id_max);
+  ix.count = htole16(m_block.count);
+  ix.busmask = m_block.busmask;
+  ix.reserved = 0;
+  m_index.push_back(ix);
+  }
+
+/**
+ * StartBlock: close the current block and output the marker record
+ *  for a new block starting at time
+ */
+void canformat_obin::StartBlock(const struct timeval& time, std::string& result)
+  {
+  CloseBlock();
+
+  memset(&m_block,0,sizeof(m_block));
+  m_block.recno = m_recno;
+  m_block.tv_sec = time.tv_sec;
+  m_block.tv_usec = time.tv_usec;
+  m_inblock = true;
+
+  canformat_obin_rec_t rec;
+  memset(&rec,0,sizeof(rec));
+  rec.idflags = htole32(CANFORMAT_OBIN_FL_BLOCK);
+  rec.data.u32[0] = htole32(m_block.tv_sec);
+  rec.data.u32[1] = htole32(m_block.tv_usec);
+  result.append((const char*)&rec, sizeof(rec));
+  m_recno++;
+  }
+
+std::string canformat_obin::get(CAN_log_message_t* message)
+  {
+  uint32_t tsinfo;
+  switch (message->type)
+    {
+    case CAN_LogFrame_RX:
+      tsinfo = 0;
+      break;
+    case CAN_LogFrame_TX:
+      tsinfo = CANFORMAT_OBIN_TS_TX;
+      break;
+    default:
+      return std::string("");
+    }
+
+  std::string result;
+
+  int64_t delta = -1;
+  if (m_inblock && m_block.count < CANFORMAT_OBIN_BLOCKSIZE)
+    {
+    delta = ((int64_t)message->timestamp.tv_sec - m_block.tv_sec) * 1000000LL
+          + ((int64_t)message->timestamp.tv_usec - m_block.tv_usec);
+    }
+  if (delta < 0 || delta > CANFORMAT_OBIN_MAXDELTA)
+    {
+    StartBlock(message->timestamp, result);
+    delta = 0;
+    }
+
+  uint32_t bus = (message->frame.origin) ? message->frame.origin->m_busnumber : 0;
+  uint32_t dlc = MIN(message->frame.FIR.B.DLC, 8);
+  uint32_t idfl = message->frame.MsgID & CANFORMAT_OBIN_FL_MASK;
+  if (message->frame.FIR.B.FF == CAN_frame_ext) idfl |= CANFORMAT_OBIN_FL_EXT;
+  if (message->frame.FIR.B.RTR == CAN_RTR) idfl |= CANFORMAT_OBIN_FL_RTR;
+
+  canformat_obin_rec_t rec;
+  memset(&rec,0,sizeof(rec));
+  rec.tsinfo = htole32((uint32_t)delta | tsinfo
+    | (dlc << CANFORMAT_OBIN_TS_DLCSHIFT)
+    | ((bus & 7) << CANFORMAT_OBIN_TS_BUSSHIFT));
+  rec.idflags = htole32(idfl);
+  memcpy(rec.data.u8, message->frame.data.u8, dlc);
+  result.append((const char*)&rec, sizeof(rec));
+  m_recno++;
+
+  // Update block index entry:
+  if (m_block.count == 0)
+    {
+    m_block.id_min = m_block.id_max = message->frame.MsgID;
+    }
+  else
+    {
+    if (message->frame.MsgID < m_block.id_min) m_block.id_min = message->frame.MsgID;
+    if (message->frame.MsgID > m_block.id_max) m_block.id_max = message->frame.MsgID;
+    }
+  m_block.count++;
+  m_block.busmask |= (1 << (bus & 7));
+
+  return result;
+  }
+
+std::string canformat_obin::getheader(struct timeval *time)
+  {
+  canformat_obin_hdr_t h;
+  struct timeval t;
+
+  if (time == NULL)
+    {
+    gettimeofday(&t,NULL);
+    time = &t;
+    }
+
+  // A header starts a new file:
+  m_inblock = false;
+  m_index.clear();
+  m_ixflags = 0;
+  m_recno = 1;
+
+  memset(&h,0,sizeof(h));
+  h.magic = htole32(CANFORMAT_OBIN_MAGIC);
+  h.version = htole16(CANFORMAT_OBIN_VERSION);
+  h.recsize = htole16(sizeof(canformat_obin_rec_t));
+  h.tv_sec = htole32(time->tv_sec);
+  h.tv_usec = htole32(time->tv_usec);
+
+  return std::string((const char*)&h, sizeof(h));
+  }
+
+/**
+ * gettrailer: close the last block and output the block index,
+ *  ends the file (a new one needs to begin with getheader())
+ */
+std::string canformat_obin::gettrailer()
+  {
+  if (m_recno == 0)
+    return std::string("");
+
+  CloseBlock();
+  m_inblock = false;
+
+  std::string result;
+
+  canformat_obin_rec_t rec;
+  memset(&rec,0,sizeof(rec));
+  rec.tsinfo = htole32(m_index.size());
+  rec.idflags = htole32(CANFORMAT_OBIN_FL_INDEX);
+  result.reserve(sizeof(rec) + m_index.size()*sizeof(canformat_obin_idx_t) + sizeof(canformat_obin_trailer_t));
+  result.append((const char*)&rec, sizeof(rec));
+  if (m_index.size() > 0)
+    result.append((const char*)m_index.data(), m_index.size()*sizeof(canformat_obin_idx_t));
+
+  canformat_obin_trailer_t tr;
+  tr.magic = htole32(CANFORMAT_OBIN_INDEXMAGIC);
+  tr.entries = htole32(m_index.size());
+  tr.recno = htole32(m_recno);
+  tr.flags = htole32(m_ixflags);
+  result.append((const char*)&tr, sizeof(tr));
+
+  ESP_LOGD(TAG, "Index: %u records, %u blocks", m_recno, (unsigned)m_index.size());
+
+  m_recno = 0;
+  m_index.clear();
+  m_index.shrink_to_fit();
+  m_ixflags = 0;
+  return result;
+  }
+
+/**
+ * ReadIndex: load the block index of a file
+ *  Returns false if the file has no (valid) index.
+ *  Leaves the file position undefined.
+ */
+bool canformat_obin::ReadIndex(FILE* file, canformat_obin_index_t& index, canformat_obin_trailer_t& trailer)
+  {
+  index.clear();
+
+  if (fseek(file, -(long)sizeof(trailer), SEEK_END) != 0)
+    return false;
+  long end = ftell(file);
+  if (end < 0 || fread(&trailer, sizeof(trailer), 1, file) != 1)
+    return false;
+  trailer.magic = le32toh(trailer.magic);
+  trailer.entries = le32toh(trailer.entries);
+  trailer.recno = le32toh(trailer.recno);
+  trailer.flags = le32toh(trailer.flags);
+  if (trailer.magic != CANFORMAT_OBIN_INDEXMAGIC || trailer.entries > CANFORMAT_OBIN_MAXINDEX)
+    return false;
+
+  long pos = (long)(trailer.recno+1) * sizeof(canformat_obin_rec_t);
+  if (pos + (long)(trailer.entries * sizeof(canformat_obin_idx_t)) != end)
+    {
+    ESP_LOGW(TAG, "Index: size mismatch, ignoring index");
+    return false;
+    }
+
+  index.resize(trailer.entries);
+  if (trailer.entries > 0)
+    {
+    if (fseek(file, pos, SEEK_SET) != 0 ||
+        fread(index.data(), sizeof(canformat_obin_idx_t), trailer.entries, file) != trailer.entries)
+      {
+      index.clear();
+      return false;
+      }
+    }
+
+  uint32_t recno = 0;
+  for (canformat_obin_idx_t& ix : index)
+    {
+    ix.recno = le32toh(ix.recno);
+    ix.tv_sec = le32toh(ix.tv_sec);
+    ix.tv_usec = le32toh(ix.tv_usec);
+    ix.id_min = le32toh(ix.id_min);
+    ix.id_max = le32toh(ix.id_max);
+    ix.count = le16toh(ix.count);
+    if (ix.recno <= recno || ix.recno >= trailer.recno)
+      {
+      ESP_LOGW(TAG, "Index: invalid block record number, ignoring index");
+      index.clear();
+      return false;
+      }
+    recno = ix.recno;
+    }
+
+  return true;
+  }
+
+void canformat_obin::Reset()
+  {
+  canformat::Reset();
+  m_rinblock = false;
+  }
+
+size_t canformat_obin::put(CAN_log_message_t* message, uint8_t *buffer, size_t len, bool* hasmore, canlogconnection* clc)
+  {
+  canformat_obin_rec_t rec;
+
+  if (m_buf.FreeSpace()==0) SetServeDiscarding(true); // Buffer full, so discard from now on
+  if (IsServeDiscarding()) return len;  // Quick return if discarding
+
+  size_t consumed = Stuff(buffer,len);  // Stuff m_buf with as much as possible
+
+  if (m_buf.UsedSpace() < sizeof(rec)) return consumed; // Insufficient data so far
+
+  *hasmore = true;  // Call us again to see if we have more frames to process
+  m_buf.Pop(sizeof(rec), (uint8_t*)&rec);
+  uint32_t tsinfo = le32toh(rec.tsinfo);
+  uint32_t idf = le32toh(rec.idflags);
+
+  if (tsinfo == CANFORMAT_OBIN_MAGIC)
+    {
+    canformat_obin_hdr_t* h = (canformat_obin_hdr_t*)&rec;
+    if (le16toh(h->version) != CANFORMAT_OBIN_VERSION ||
+        le16toh(h->recsize) != sizeof(canformat_obin_rec_t))
+      {
+      ESP_LOGE(TAG,"ovmsbin version %u not supported: Discarding", le16toh(h->version));
+      SetServeDiscarding(true);
+      }
+    m_rinblock = false;
+    return consumed;
+    }
+
+  if (idf == CANFORMAT_OBIN_FL_INDEX)
+    {
+    // End of frame data, ignore the index
+    SetServeDiscarding(true);
+    *hasmore = false;
+    return consumed;
+    }
+
+  if (idf == CANFORMAT_OBIN_FL_BLOCK)
+    {
+    m_rbase.tv_sec = le32toh(rec.data.u32[0]);
+    m_rbase.tv_usec = le32toh(rec.data.u32[1]);
+    m_rinblock = true;
+    return consumed;
+    }
+
+  if (!m_rinblock)
+    {
+    // No time base yet (i.e. joined a stream): skip
+    return consumed;
+    }
+
+  uint32_t delta = tsinfo & CANFORMAT_OBIN_TS_MASK;
+  uint32_t dlc = (tsinfo >> CANFORMAT_OBIN_TS_DLCSHIFT) & 0x0f;
+  if (dlc > 8) dlc = 8;
+
+  message->type = (tsinfo & CANFORMAT_OBIN_TS_TX) ? CAN_LogFrame_TX : CAN_LogFrame_RX;
+  uint32_t usec = m_rbase.tv_usec + delta;
+  message->timestamp.tv_sec = m_rbase.tv_sec + usec / 1000000;
+  message->timestamp.tv_usec = usec % 1000000;
+  message->frame.origin = MyCan.GetBus((tsinfo >> CANFORMAT_OBIN_TS_BUSSHIFT) & 7);
+  message->frame.FIR.B.RTR = (idf & CANFORMAT_OBIN_FL_RTR) ? CAN_RTR : CAN_no_RTR;
+  message->frame.FIR.B.FF = (idf & CANFORMAT_OBIN_FL_EXT) ? CAN_frame_ext : CAN_frame_std;
+  message->frame.FIR.B.DLC = dlc;
+  message->frame.MsgID = idf & CANFORMAT_OBIN_FL_MASK;
+  memcpy(message->frame.data.u8, rec.data.u8, dlc);
+
+  return consumed;
+  }
@@ -0,0 +1,154 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Module:        CAN dump OVMS binary format
+;    Date:          18th January 2018
+;
+;    (C) 2018       Mark Webb-Johnson
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __CANFORMAT_OBIN_H__
+#define __CANFORMAT_OBIN_H__
+
+#include <stdio.h>
+#include <vector>
+#include "ovms.h"
+#include "canformat.h"
+
+/**
+ * canformat_obin: compact binary CAN capture ("ovmsbin")
+ *
+ * The file consists of fixed size 16 byte records (little endian):
+ *  - a file header (magic, version, record size, log start time)
+ *  - blocks of up to CANFORMAT_OBIN_BLOCKSIZE frames, each starting with a
+ *    block marker record holding the absolute block start time; frame records
+ *    carry the 24 bit microsecond delta to the block start, the DLC, bus & ID
+ *  - optionally (written by the VFS logger on close) an index marker record,
+ *    the block index (start time, bus mask & ID range per block) and a
+ *    trailer at the end of the file pointing to the index
+ *
+ * Blocks are closed after CANFORMAT_OBIN_BLOCKSIZE frames, on a delta time
+ * overflow (~16.7 seconds) or on a time step back. A file without index (i.e.
+ * log not closed properly) stays readable sequentially.
+ *
+ * The formatter is stateful (block time base & index), so get() results
+ * cannot be shared between loggers.
+ */
+
+#define CANFORMAT_OBIN_MAGIC        0x4e49424f    // "OBIN"
+#define CANFORMAT_OBIN_INDEXMAGIC   0x5849424f    // "OBIX"
+#define CANFORMAT_OBIN_VERSION      1
+#define CANFORMAT_OBIN_BLOCKSIZE    1024          // max frames per block
+#define CANFORMAT_OBIN_MAXINDEX     8192          // max blocks indexed
+#define CANFORMAT_OBIN_MAXDELTA     0x00ffffff    // max time delta in block [us]
+
+// Record tsinfo:
+#define CANFORMAT_OBIN_TS_MASK      0x00ffffff    // us since block start
+#define CANFORMAT_OBIN_TS_DLCSHIFT  24            // DLC (4 bits)
+#define CANFORMAT_OBIN_TS_BUSSHIFT  28            // bus number (3 bits)
+#define CANFORMAT_OBIN_TS_TX        0x80000000    // transmitted frame
+
+// Record idflags:
+#define CANFORMAT_OBIN_FL_MASK      0x1fffffff    // CAN ID
+#define CANFORMAT_OBIN_FL_RTR       0x20000000
+#define CANFORMAT_OBIN_FL_EXT       0x40000000
+#define CANFORMAT_OBIN_FL_BLOCK     0x80000000    // block marker record
+#define CANFORMAT_OBIN_FL_INDEX     0xc0000000    // index marker record
+
+// Index flags:
+#define CANFORMAT_OBIN_IX_INCOMPLETE 0x01         // blocks after the last entry not indexed
+
+typedef struct __attribute__ ((__packed__))
+  {
+  uint32_t magic;         // CANFORMAT_OBIN_MAGIC
+  uint16_t version;       // CANFORMAT_OBIN_VERSION
+  uint16_t recsize;       // sizeof(canformat_obin_rec_t)
+  uint32_t tv_sec;        // log start time
+  uint32_t tv_usec;
+  } canformat_obin_hdr_t;
+
+typedef struct __attribute__ ((__packed__))
+  {
+  uint32_t tsinfo;        // frame: time delta, DLC, bus & TX flag / index marker: entry count
+  uint32_t idflags;       // frame: ID & flags / marker: CANFORMAT_OBIN_FL_BLOCK|INDEX
+  union
+    {
+    uint8_t  u8[8];       // frame payload
+    uint32_t u32[2];      // block marker: start time tv_sec, tv_usec
+    } data;
+  } canformat_obin_rec_t;
+
+typedef struct __attribute__ ((__packed__))
+  {
+  uint32_t recno;         // record number of the block marker (header = 0)
+  uint32_t tv_sec;        // block start time
+  uint32_t tv_usec;
+  uint32_t id_min;        // frame ID range in block
+  uint32_t id_max;
+  uint16_t count;         // frames in block
+  uint8_t  busmask;       // bit n = frames of bus n+1 in block
+  uint8_t  reserved;
+  } canformat_obin_idx_t;
+
+typedef struct __attribute__ ((__packed__))
+  {
+  uint32_t magic;         // CANFORMAT_OBIN_INDEXMAGIC
+  uint32_t entries;       // number of index entries
+  uint32_t recno;         // record number of the index marker
+  uint32_t flags;         // CANFORMAT_OBIN_IX_*
+  } canformat_obin_trailer_t;
+
+typedef std::vector<canformat_obin_idx_t, ExtRamAllocator<canformat_obin_idx_t>> canformat_obin_index_t;
+
+class canformat_obin : public canformat
+  {
+  public:
+    canformat_obin(const char* type);
+    virtual ~canformat_obin();
+
+  public:
+    virtual std::string get(CAN_log_message_t* message);
+    virtual std::string getheader(struct timeval *time);
+    virtual std::string gettrailer();
+    virtual size_t put(CAN_log_message_t* message, uint8_t *buffer, size_t len, bool* hasmore, canlogconnection* clc=NULL);
+    virtual void Reset();
+    virtual bool IsStateful();
+
+  public:
+    static bool ReadIndex(FILE* file, canformat_obin_index_t& index, canformat_obin_trailer_t& trailer);
+
+  protected:
+    void CloseBlock();
+    void StartBlock(const struct timeval& time, std::string& result);
+
+  protected:
+    // Writer state:
+    uint32_t            m_recno;        // records written (incl. header)
+    canformat_obin_idx_t m_block;       // current block
+    bool                m_inblock;
+    canformat_obin_index_t m_index;
+    uint32_t            m_ixflags;
+
+    // Reader state:
+    struct timeval      m_rbase;        // current block start time
+    bool                m_rinblock;
+  };
+
+#endif // __CANFORMAT_OBIN_H__
@@ -40,8 +40,11 @@ static const char *TAG = "canlog";
 #include "ovms_command.h"
 #include "ovms_events.h"
 #include "ovms_peripherals.h"
+#include "ovms_malloc.h"
 #include "metrics_standard.h"
 
+canlogring MyCanLogRing __attribute__ ((init_priority (4550)));
+
 ////////////////////////////////////////////////////////////////////////
 // Command Processing
 ////////////////////////////////////////////////////////////////////////
@@ -115,6 +118,7 @@ void can_log_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
   else
     {
     // Show the status of all loggers
+    writer->printf("Buffer: %s\n", MyCanLogRing.GetStats().c_str());
     OvmsRecMutexLock lock(&MyCan.m_loggermap_mutex);
     for (can::canlog_map_t::iterator it=MyCan.m_loggermap.begin(); it!=MyCan.m_loggermap.end(); ++it)
       {
@@ -189,6 +193,405 @@ OvmsCanLogInit::OvmsCanLogInit()
   cmd_canlog->RegisterCommand("start", "CAN logging start framework");
   }
 
+////////////////////////////////////////////////////////////////////////
+// CAN Logger shared record buffer
+////////////////////////////////////////////////////////////////////////
+
+#define CANLOG_RECORD_ALIGN(n)    (((n) + 7) & ~7)
+#define CANLOG_RECORD_MSGLEN_FRAME  (offsetof(CAN_log_message_t, frame) + sizeof(CAN_frame_t))
+#define CANLOG_RECORD_MSGLEN_TEXT   (offsetof(CAN_log_message_t, text))
+
+canlogformatcache::canlogformatcache()
+  {
+  m_users = 0;
+  for (int i = 0; i < CANLOG_RING_FORMATCACHE; i++)
+    m_seq[i] = 0;
+  m_hits = 0;
+  m_misses = 0;
+  }
+
+canlogreader::canlogreader()
+  {
+  m_pos = 0;
+  m_seq = 0;
+  m_lost = 0;
+  m_waiting = false;
+  m_task = NULL;
+  m_cache = NULL;
+  }
+
+canlogring::canlogring(size_t size /*=0*/)
+  {
+  m_size_cfg = size;
+  m_size = 0;
+  m_buffer = NULL;
+  vPortCPUInitializeMutex(&m_spinlock);
+  m_head = 0;
+  m_reserve = 0;
+  m_tail = 0;
+  m_seq = 0;
+  m_pubseq = 0;
+  m_writers = 0;
+  m_dropcount = 0;
+  m_readers = 0;
+  }
+
+canlogring::~canlogring()
+  {
+  if (m_buffer)
+    free(m_buffer);
+  for (auto it = m_caches.begin(); it != m_caches.end(); ++it)
+    delete it->second;
+  }
+
+/**
+ * Attach: register a reader, allocates the buffer for the first reader.
+ *  The reader will receive all records published from now on.
+ *  Readers with equal cache keys (format & format options) share
+ *  formatting results.
+ *  Returns the number of readers attached.
+ */
+int canlogring::Attach(canlogreader* reader, std::string cachekey)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  if (m_readers == 0)
+    {
+    size_t want = m_size_cfg;
+    if (want == 0)
+      {
+      int queuesize = MyConfig.GetParamValueInt("can", "log.queuesize",100);
+      want = queuesize * CANLOG_RECORD_ALIGN(sizeof(canlogrecord_t) + CANLOG_RECORD_MSGLEN_FRAME);
+      }
+    size_t size = 1024;
+    while (size < want && size < 0x10000)
+      size <<= 1;
+    uint8_t* buffer = (uint8_t*) ExternalRamMalloc(size);
+    if (!buffer)
+      {
+      ESP_LOGE(TAG, "canlogring: can't allocate %u bytes", size);
+      }
+    else
+      {
+      portENTER_CRITICAL(&m_spinlock);
+      m_buffer = buffer;
+      m_size = size;
+      m_head = m_reserve = m_tail = 0;
+      portEXIT_CRITICAL(&m_spinlock);
+      }
+    }
+
+  portENTER_CRITICAL(&m_spinlock);
+  reader->m_pos = m_head;
+  reader->m_seq = m_pubseq;
+  portEXIT_CRITICAL(&m_spinlock);
+  reader->m_lost = 0;
+
+  canlogformatcache*& cache = m_caches[cachekey];
+  if (!cache)
+    cache = new canlogformatcache();
+  cache->m_users++;
+  reader->m_cache = cache;
+
+  return ++m_readers;
+  }
+
+/**
+ * Detach: unregister a reader, frees the buffer with the last reader
+ *  after the writers copying records into it are done.
+ */
+void canlogring::Detach(canlogreader* reader)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  if (reader->m_cache)
+    {
+    for (auto it = m_caches.begin(); it != m_caches.end(); ++it)
+      {
+      if (it->second == reader->m_cache && --it->second->m_users == 0)
+        {
+        delete it->second;
+        m_caches.erase(it);
+        break;
+        }
+      }
+    reader->m_cache = NULL;
+    }
+
+  if (m_readers > 0 && --m_readers == 0)
+    {
+    portENTER_CRITICAL(&m_spinlock);
+    uint8_t* buffer = m_buffer;
+    m_buffer = NULL;
+    int writers = m_writers;
+    portEXIT_CRITICAL(&m_spinlock);
+    while (writers > 0)
+      {
+      vTaskDelay(1);
+      portENTER_CRITICAL(&m_spinlock);
+      writers = m_writers;
+      portEXIT_CRITICAL(&m_spinlock);
+      }
+    if (buffer)
+      free(buffer);
+    }
+  }
+
+int canlogring::GetReaderCount()
+  {
+  return m_readers;
+  }
+
+/**
+ * Write: store a record
+ *  The record is reserved and the ring indexes are updated under the spinlock,
+ *  the data is copied outside of it. Records are published to the readers
+ *  in ring order, a record is published by the last of the writers of the
+ *  preceding records to complete.
+ */
+bool canlogring::Write(CAN_log_message_t* msg, size_t msglen, const char* text)
+  {
+  size_t textlen = text ? strlen(text) + 1 : 0;
+  gettimeofday(&msg->timestamp,NULL);
+
+  portENTER_CRITICAL(&m_spinlock);
+  if (!m_buffer)
+    {
+    m_dropcount++;
+    portEXIT_CRITICAL(&m_spinlock);
+    return false;
+    }
+
+  // Limit record size to a quarter of the buffer, truncating the text:
+  size_t maxtext = m_size/4 - sizeof(canlogrecord_t) - msglen;
+  if (textlen > maxtext)
+    textlen = maxtext;
+  uint32_t need = CANLOG_RECORD_ALIGN(sizeof(canlogrecord_t) + msglen + textlen);
+
+  uint32_t mask = m_size - 1;
+  uint32_t head = m_reserve;
+  uint32_t off = head & mask;
+  uint32_t pad = (m_size - off < need) ? m_size - off : 0;
+  uint32_t reserve = head + pad + need;
+
+  // Drop the records we're going to overwrite & announce the write region
+  // before touching it, so readers can detect concurrent overwrites.
+  // Records not yet published still get copied, these cannot be dropped:
+  uint32_t tail = m_tail;
+  while (reserve - tail > m_size)
+    {
+    if (tail == m_head)
+      {
+      m_dropcount++;
+      portEXIT_CRITICAL(&m_spinlock);
+      return false;
+      }
+    tail += ((canlogrecord_t*)(m_buffer + (tail & mask)))->size;
+    }
+  m_tail = tail;
+  m_reserve = reserve;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  canlogrecord_t* rec;
+  if (pad)
+    {
+    // Records don't wrap, fill the buffer end with a padding record:
+    rec = (canlogrecord_t*)(m_buffer + off);
+    rec->size = pad;
+    rec->msglen = 0;
+    rec->seq = 0;
+    off = 0;
+    }
+
+  rec = (canlogrecord_t*)(m_buffer + off);
+  rec->size = need;
+  rec->msglen = 0;
+  rec->seq = ++m_seq;
+  m_writers++;
+  portEXIT_CRITICAL(&m_spinlock);
+
+  uint8_t* data = (uint8_t*)(rec + 1);
+  memcpy(data, msg, msglen);
+  if (textlen)
+    {
+    memcpy(data + msglen, text, textlen - 1);
+    data[msglen + textlen - 1] = 0;
+    }
+
+  portENTER_CRITICAL(&m_spinlock);
+  rec->msglen = msglen;
+  m_writers--;
+  if (m_buffer)
+    {
+    // Publish all complete records following the last one published:
+    uint32_t pos = m_head;
+    uint32_t seq = m_pubseq;
+    while (pos != m_reserve)
+      {
+      rec = (canlogrecord_t*)(m_buffer + (pos & mask));
+      if (rec->seq != 0)
+        {
+        if (rec->msglen == 0)
+          break;
+        seq = rec->seq;
+        }
+      pos += rec->size;
+      }
+    m_pubseq = seq;
+    m_head.store(pos, std::memory_order_release);
+    }
+  portEXIT_CRITICAL(&m_spinlock);
+  return true;
+  }
+
+bool canlogring::LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame)
+  {
+  CAN_log_message_t msg;
+  msg.type = type;
+  memcpy(&msg.frame,frame,sizeof(CAN_frame_t));
+  msg.frame.origin = bus;
+  return Write(&msg, CANLOG_RECORD_MSGLEN_FRAME, NULL);
+  }
+
+bool canlogring::LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* status)
+  {
+  CAN_log_message_t msg;
+  msg.type = type;
+  msg.origin = bus;
+  memcpy(&msg.status,status,sizeof(CAN_status_t));
+  return Write(&msg, sizeof(CAN_log_message_t), NULL);
+  }
+
+bool canlogring::LogInfo(canbus* bus, CAN_log_type_t type, const char* text)
+  {
+  CAN_log_message_t msg;
+  msg.type = type;
+  msg.origin = bus;
+  return Write(&msg, CANLOG_RECORD_MSGLEN_TEXT, text);
+  }
+
+/**
+ * Read: fetch the next record for the reader
+ *  Info texts are copied to the reader, msg->text points to that copy
+ *  until the next Read() call.
+ *  Returns false if no record is available.
+ */
+bool canlogring::Read(canlogreader* reader, CAN_log_message_t* msg)
+  {
+  while (m_buffer)
+    {
+    uint32_t head = m_head.load(std::memory_order_acquire);
+    if (reader->m_pos == head)
+      return false;
+    if (m_reserve - reader->m_pos > m_size)
+      {
+      // overtaken by the writers, continue at the oldest record:
+      reader->m_pos = m_tail;
+      continue;
+      }
+
+    uint32_t off = reader->m_pos & (m_size - 1);
+    canlogrecord_t rec = *(canlogrecord_t*)(m_buffer + off);
+    bool valid = (rec.size >= sizeof(canlogrecord_t) && (rec.size & 7) == 0 &&
+                  rec.size <= m_size - off && rec.msglen <= sizeof(CAN_log_message_t) &&
+                  rec.msglen <= rec.size - sizeof(canlogrecord_t));
+    if (valid && rec.seq != 0)
+      {
+      const uint8_t* data = m_buffer + off + sizeof(canlogrecord_t);
+      memset(msg, 0, sizeof(CAN_log_message_t));
+      memcpy(msg, data, rec.msglen);
+      if (rec.msglen == CANLOG_RECORD_MSGLEN_TEXT)
+        {
+        const char* text = (const char*)(data + rec.msglen);
+        reader->m_text.assign(text, strnlen(text, rec.size - sizeof(canlogrecord_t) - rec.msglen));
+        }
+      }
+
+    // Check the record has not been overwritten while copying:
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!valid || m_reserve - reader->m_pos > m_size)
+      {
+      reader->m_pos = m_tail;
+      continue;
+      }
+
+    reader->m_pos += rec.size;
+    if (rec.seq == 0)
+      continue; // padding
+
+    if (rec.seq - reader->m_seq > 1)
+      reader->m_lost += rec.seq - reader->m_seq - 1;
+    reader->m_seq = rec.seq;
+    if (rec.msglen == CANLOG_RECORD_MSGLEN_TEXT)
+      msg->text = (char*) reader->m_text.c_str();
+    return true;
+    }
+  return false;
+  }
+
+bool canlogring::HasData(canlogreader* reader)
+  {
+  return (m_buffer && reader->m_pos != m_head.load(std::memory_order_acquire));
+  }
+
+uint32_t canlogring::Pending(canlogreader* reader)
+  {
+  return m_pubseq - reader->m_seq;
+  }
+
+/**
+ * Format: get the formatted log record, share results with other readers
+ *  using the same stateless format. Needs to be called directly after Read().
+ */
+void canlogring::Format(canlogreader* reader, canformat* formatter, CAN_log_message_t* msg, std::string& result)
+  {
+  canlogformatcache* cache = reader->m_cache;
+  if (!cache || cache->m_users < 2 || formatter->IsStateful())
+    {
+    result = formatter->get(msg);
+    return;
+    }
+
+  int slot = reader->m_seq % CANLOG_RING_FORMATCACHE;
+    {
+    OvmsMutexLock lock(&cache->m_mutex);
+    if (cache->m_seq[slot] == reader->m_seq)
+      {
+      result = cache->m_result[slot];
+      cache->m_hits++;
+      return;
+      }
+    }
+
+  result = formatter->get(msg);
+
+  OvmsMutexLock lock(&cache->m_mutex);
+  cache->m_seq[slot] = reader->m_seq;
+  cache->m_result[slot] = result;
+  cache->m_misses++;
+  }
+
+std::string canlogring::GetStats()
+  {
+  std::ostringstream buf;
+  OvmsMutexLock lock(&m_mutex);
+
+  buf << "Size:" << (m_buffer ? m_size : 0)
+    << " Used:" << (m_buffer ? MIN((uint32_t)m_size, m_head - m_tail) : 0)
+    << " Records:" << (uint32_t)m_seq
+    << " Readers:" << m_readers;
+  if (m_dropcount)
+    buf << " Dropped:" << m_dropcount;
+  for (auto it = m_caches.begin(); it != m_caches.end(); ++it)
+    {
+    canlogformatcache* cache = it->second;
+    if (cache->m_users > 1)
+      buf << " Shared " << it->first << ": hits:" << cache->m_hits << " misses:" << cache->m_misses;
+    }
+
+  return buf.str();
+  }
+
 ////////////////////////////////////////////////////////////////////////
 // CAN Logger Connection class
 ////////////////////////////////////////////////////////////////////////
@@ -255,6 +658,10 @@ void canlogconnection::OutputMsg(CAN_log_message_t& msg, std::string &result)
     }
   }
 
+void canlogconnection::Flush()
+  {
+  }
+
 void canlogconnection::TransmitCallback(uint8_t *buffer, size_t len)
   {
   ESP_LOGD(TAG,"TransmitCallback on %s (%d bytes)",m_peer.c_str(),len);
@@ -335,6 +742,13 @@ std::string canlogconnection::GetStats()
 // CAN Logger class
 ////////////////////////////////////////////////////////////////////////
 
+static void canlog_event_listener(std::string event, void* data)
+  {
+  // Log vehicle custom (x…) & framework events:
+  if (startsWith(event, 'x') || startsWith(event, "vehicle"))
+    MyCan.LogInfo(NULL, CAN_LogInfo_Event, event.c_str());
+  }
+
 canlog::canlog(const char* type, std::string format, canformat::canformat_serve_mode_t mode)
   {
   m_type = type;
@@ -349,48 +763,27 @@ canlog::canlog(const char* type, std::string format, canformat::canformat_serve_
   m_dropcount = 0;
   m_filtercount = 0;
 
-  using std::placeholders::_1;
-  using std::placeholders::_2;
-  MyEvents.RegisterEvent(IDTAG, "*", std::bind(&canlog::EventListener, this, _1, _2));
+  if (MyCanLogRing.Attach(&m_reader, m_format + "/" + m_formatter->GetServeModeName()) == 1)
+    MyEvents.RegisterEvent("canlog", "*", canlog_event_listener);
 
-  int queuesize = MyConfig.GetParamValueInt("can", "log.queuesize",100);
-  m_queue = xQueueCreate(queuesize, sizeof(CAN_log_message_t));
   xTaskCreatePinnedToCore(RxTask, "OVMS CanLog", 4096, (void*)this, 10, &m_task, CORE(1));
+  m_reader.m_task = m_task;
   }
 
 canlog::~canlog()
   {
-  MyEvents.DeregisterEvent(IDTAG);
-
   if (m_task)
     {
     TaskHandle_t t = m_task;
     m_task = NULL;
+    m_reader.m_task = NULL;
 
     vTaskDelete(t);
     }
 
-  if (m_queue)
-    {
-    QueueHandle_t q = m_queue;
-    m_queue = NULL;
-
-    CAN_log_message_t msg;
-    while (xQueueReceive(q, &msg, 0) == pdTRUE)
-      {
-      switch (msg.type)
-        {
-        case CAN_LogInfo_Comment:
-        case CAN_LogInfo_Config:
-        case CAN_LogInfo_Event:
-          free(msg.text);
-          break;
-        default:
-          break;
-        }
-      }
-    vQueueDelete(q);
-    }
+  MyCanLogRing.Detach(&m_reader);
+  if (MyCanLogRing.GetReaderCount() == 0)
+    MyEvents.DeregisterEvent("canlog");
 
   if (m_formatter)
     {
@@ -411,29 +804,71 @@ void canlog::RxTask(void *context)
   CAN_log_message_t msg;
   while (1)
     {
-    if (xQueueReceive(me->m_queue, &msg, (portTickType)portMAX_DELAY) == pdTRUE)
+    uint32_t lost = me->m_reader.m_lost;
+    if (MyCanLogRing.Read(&me->m_reader, &msg))
       {
-      switch (msg.type)
+      if (me->m_reader.m_lost != lost && me->m_isopen)
         {
-        case CAN_LogInfo_Comment:
-        case CAN_LogInfo_Config:
-        case CAN_LogInfo_Event:
-          me->OutputMsg(msg);
-          free(msg.text);
-          break;
-        default:
-          me->OutputMsg(msg);
-          break;
+        me->m_msgcount += me->m_reader.m_lost - lost;
+        me->m_dropcount += me->m_reader.m_lost - lost;
         }
+      me->ProcessMsg(msg);
+      }
+    else
+      {
+      me->Flush();
+      me->m_reader.m_waiting = true;
+      if (!MyCanLogRing.HasData(&me->m_reader))
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+      me->m_reader.m_waiting = false;
       }
     }
   }
 
-void canlog::EventListener(std::string event, void* data)
+/**
+ * Flush: called by the logger task when running idle, to let connections
+ *  write out batched output
+ */
+void canlog::Flush()
   {
-  // Log vehicle custom (x…) & framework events:
-  if (startsWith(event, 'x') || startsWith(event, "vehicle"))
-    LogInfo(NULL, CAN_LogInfo_Event, event.c_str());
+  OvmsRecMutexLock lock(&m_cmmutex);
+  for (conn_map_t::iterator it=m_connmap.begin(); it!=m_connmap.end(); ++it)
+    {
+    it->second->Flush();
+    }
+  }
+
+void canlog::Notify()
+  {
+  if (m_reader.m_waiting && m_reader.m_task)
+    xTaskNotifyGive(m_reader.m_task);
+  }
+
+void canlog::ProcessMsg(CAN_log_message_t& msg)
+  {
+  if (!IsOpen()) return;
+
+  // Records have been filtered by the writer against all loggers, drop the
+  // ones accepted for other loggers only (already counted as filtered):
+  bool accept;
+  switch (msg.type)
+    {
+    case CAN_LogFrame_RX:
+    case CAN_LogFrame_TX:
+    case CAN_LogFrame_TX_Queue:
+    case CAN_LogFrame_TX_Fail:
+      accept = Accept(msg.frame.origin, &msg.frame);
+      break;
+    default:
+      accept = Accept(msg.origin, NULL);
+      break;
+    }
+
+  if (accept)
+    {
+    m_msgcount++;
+    OutputMsg(msg);
+    }
   }
 
 const char* canlog::GetType()
@@ -460,10 +895,13 @@ void canlog::OutputMsg(CAN_log_message_t& msg)
     return;
     }
 
-  std::string result = m_formatter->get(&msg);
+  // Note: formatting is done under the connection lock, as stateful
+  //  formats also produce a trailer on Close()
+  OvmsRecMutexLock lock(&m_cmmutex);
+  std::string result;
+  MyCanLogRing.Format(&m_reader, m_formatter, &msg, result);
   if (result.length()>0)
     {
-    OvmsRecMutexLock lock(&m_cmmutex);
     for (conn_map_t::iterator it=m_connmap.begin(); it!=m_connmap.end(); ++it)
       {
       if (it->second->m_ispaused)
@@ -513,7 +951,7 @@ std::string canlog::GetStats()
   std::ostringstream buf;
 
   float droprate = (m_msgcount > 0) ? ((float) m_dropcount/m_msgcount*100) : 0;
-  uint32_t waiting = uxQueueMessagesWaiting(m_queue);
+  uint32_t waiting = MyCanLogRing.Pending(&m_reader);
 
   buf << "Messages:" << m_msgcount
     << " Dropped:" << m_dropcount
@@ -535,71 +973,25 @@ void canlog::SetFilter(canfilter* filter)
   m_filter = filter;
   }
 
-void canlog::ClearFilter()
+/**
+ * Accept: check a frame (or a status/info record of the bus, if frame is NULL)
+ *  passes the logger filter
+ */
+bool canlog::Accept(canbus* bus, const CAN_frame_t* frame)
   {
-  if (m_filter)
-    {
-    delete m_filter;
-    m_filter = NULL;
-    }
-  }
-
-void canlog::LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame)
-  {
-  if (!IsOpen() || !bus || !frame) return;
-
-  if (((m_filter == NULL)||(m_filter->IsFiltered(frame)))&&(m_queue))
-    {
-    CAN_log_message_t msg;
-    msg.type = type;
-    gettimeofday(&msg.timestamp,NULL);
-    memcpy(&msg.frame,frame,sizeof(CAN_frame_t));
-    msg.frame.origin = bus;
-    m_msgcount++;
-    if (xQueueSend(m_queue, &msg, 0) != pdTRUE) m_dropcount++;
-    }
-  else
-    {
-    m_filtercount++;
-    }
-  }
-
-void canlog::LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* status)
-  {
-  if (!IsOpen() || !bus) return;
-
-  if (((m_filter == NULL)||(m_filter->IsFiltered(bus)))&&(m_queue))
-    {
-    CAN_log_message_t msg;
-    msg.type = type;
-    gettimeofday(&msg.timestamp,NULL);
-    msg.origin = bus;
-    memcpy(&msg.status,status,sizeof(CAN_status_t));
-    m_msgcount++;
-    if (xQueueSend(m_queue, &msg, 0) != pdTRUE) m_dropcount++;
-    }
+  if (m_filter == NULL)
+    return true;
+  else if (frame)
+    return m_filter->IsFiltered(frame);
   else
-    {
-    m_filtercount++;
-    }
+    return m_filter->IsFiltered(bus);
   }
 
-void canlog::LogInfo(canbus* bus, CAN_log_type_t type, const char* text)
+void canlog::ClearFilter()
   {
-  if (!IsOpen() || !text) return;
-
-  if (((m_filter == NULL)||(m_filter->IsFiltered(bus)))&&(m_queue))
-    {
-    CAN_log_message_t msg;
-    msg.type = type;
-    gettimeofday(&msg.timestamp,NULL);
-    msg.origin = bus;
-    msg.text = strdup(text);
-    m_msgcount++;
-    if (xQueueSend(m_queue, &msg, 0) != pdTRUE) m_dropcount++;
-    }
-  else
+  if (m_filter)
     {
-    m_filtercount++;
+    delete m_filter;
+    m_filter = NULL;
     }
   }
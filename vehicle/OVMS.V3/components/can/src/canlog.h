@@ -28,6 +28,7 @@
 #define __CANLOG_H__
 
 #include "freertos/semphr.h"
+#include <atomic>
 #include "can.h"
 #include "canformat.h"
 #include <sdkconfig.h>
@@ -44,9 +45,10 @@
  *  to the type list & method Instantiate(). See canlog_trace & canlog_crtd
  *  for examples & reference.
  *
- * Log messages are sent to a canlog through a queue handled by a separate
- *  task for the logger, so logging doesn't affect CAN framework speed and
- *  a log can be written/streamed to a slow medium.
+ * Log messages are written once into the shared canlogring, every canlog
+ *  reads them through its own cursor in a separate task for the logger, so
+ *  logging doesn't affect CAN framework speed and a log can be written/streamed
+ *  to a slow medium. A slow logger only loses messages itself.
  *
  * Log entries can be frames, status or info messages (see CAN_LogEntry_t).
  * The timestamp of the original event is preserved.
@@ -57,6 +59,112 @@
  */
 
 class canlog;
+
+/**
+ * canlogring: the log record buffer shared by all loggers
+ *
+ * Records are stored once in raw form (CAN_log_message_t, frames without the
+ *  unused union tail, info texts inline) with variable length. Writers
+ *  reserve their records under a spinlock and copy the data outside of it,
+ *  records are published in ring order as soon as all preceding writes are
+ *  complete. Readers are lock free: each reader has its own cursor, copies
+ *  a record and then validates it has not been overwritten in the meantime.
+ *  A reader overtaken by the writers continues at the oldest record and
+ *  accounts the records lost.
+ *
+ * Formatting results are shared by all readers using the same format and
+ *  format options via a small cache indexed by record sequence number.
+ */
+
+#define CANLOG_RING_FORMATCACHE   32    // format cache slots (records)
+
+typedef struct
+  {
+  uint16_t size;                      // record size incl. header & text, 8 byte aligned
+  uint16_t msglen;                    // CAN_log_message_t bytes stored, 0 = being written
+  uint32_t seq;                       // record sequence number, 0 = padding
+  } canlogrecord_t;
+
+class canlogformatcache
+  {
+  public:
+    canlogformatcache();
+
+  public:
+    int                 m_users;
+    OvmsMutex           m_mutex;
+    uint32_t            m_seq[CANLOG_RING_FORMATCACHE];
+    std::string         m_result[CANLOG_RING_FORMATCACHE];
+    uint32_t            m_hits;
+    uint32_t            m_misses;
+  };
+
+class canlogreader
+  {
+  public:
+    canlogreader();
+
+  public:
+    uint32_t            m_pos;        // ring byte position of next record
+    uint32_t            m_seq;        // sequence number of last record read
+    uint32_t            m_lost;       // records lost by overflow
+    std::atomic_bool    m_waiting;    // task is waiting for notification
+    TaskHandle_t        m_task;
+    std::string         m_text;       // info text of last record read
+    canlogformatcache*  m_cache;
+  };
+
+class canlogring
+  {
+  public:
+    canlogring(size_t size=0);
+    ~canlogring();
+
+  public:
+    int Attach(canlogreader* reader, std::string cachekey);
+    void Detach(canlogreader* reader);
+    int GetReaderCount();
+
+  public:
+    // Writer API:
+    bool LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* frame);
+    bool LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* status);
+    bool LogInfo(canbus* bus, CAN_log_type_t type, const char* text);
+
+  public:
+    // Reader API:
+    bool Read(canlogreader* reader, CAN_log_message_t* msg);
+    bool HasData(canlogreader* reader);
+    uint32_t Pending(canlogreader* reader);
+    void Format(canlogreader* reader, canformat* formatter, CAN_log_message_t* msg, std::string& result);
+
+  public:
+    std::string GetStats();
+
+  protected:
+    bool Write(CAN_log_message_t* msg, size_t msglen, const char* text);
+
+  protected:
+    size_t              m_size_cfg;   // 0 = derive from config can log.queuesize
+    size_t              m_size;       // buffer size, power of 2
+    uint8_t*            m_buffer;
+    portMUX_TYPE        m_spinlock;
+    std::atomic<uint32_t> m_head;     // end of last record published
+    std::atomic<uint32_t> m_reserve;  // end of last record reserved
+    std::atomic<uint32_t> m_tail;     // start of oldest record
+    std::atomic<uint32_t> m_seq;      // last record sequence number reserved
+    std::atomic<uint32_t> m_pubseq;   // last record sequence number published
+    int                 m_writers;    // writers copying records
+    uint32_t            m_dropcount;  // records not stored (no buffer)
+
+  protected:
+    OvmsMutex           m_mutex;      // protects readers & format caches
+    int                 m_readers;
+    std::map<std::string, canlogformatcache*> m_caches;
+  };
+
+extern canlogring MyCanLogRing;
+
 class canlogconnection: public InternalRamAllocated
   {
   public:
@@ -65,6 +173,7 @@ class canlogconnection: public InternalRamAllocated
 
   public:
     virtual void OutputMsg(CAN_log_message_t& msg, std::string &result);
+    virtual void Flush();
 
   public:
     virtual void TransmitCallback(uint8_t *buffer, size_t len);
@@ -104,7 +213,8 @@ class canlog : public InternalRamAllocated
 
   public:
     static void RxTask(void* context);
-    void EventListener(std::string event, void* data);
+    void Notify();
+    void Flush();
 
   public:
     const char* GetType();
@@ -122,12 +232,10 @@ class canlog : public InternalRamAllocated
   public:
     virtual void SetFilter(canfilter* filter);
     virtual void ClearFilter();
+    bool Accept(canbus* bus, const CAN_frame_t* frame);
 
-  public:
-    // Logging API:
-    virtual void LogFrame(canbus* bus, CAN_log_type_t type, const CAN_frame_t* p_frame);
-    virtual void LogStatus(canbus* bus, CAN_log_type_t type, const CAN_status_t* status);
-    virtual void LogInfo(canbus* bus, CAN_log_type_t type, const char* text);
+  protected:
+    void ProcessMsg(CAN_log_message_t& msg);
 
   public:
     const char*         m_type;
@@ -147,7 +255,7 @@ class canlog : public InternalRamAllocated
 
   public:
     TaskHandle_t        m_task;
-    QueueHandle_t       m_queue;
+    canlogreader        m_reader;
     bool                m_isopen;
     uint32_t            m_msgcount;
     uint32_t            m_dropcount;
@@ -30,6 +30,7 @@ static const char *TAG = "canlog-vfs";
 #include "can.h"
 #include "canformat.h"
 #include "canlog_vfs.h"
+#include <sstream>
 #include "ovms_utils.h"
 #include "ovms_config.h"
 #include "ovms_peripherals.h"
@@ -92,12 +93,15 @@ canlog_vfs_conn::canlog_vfs_conn(canlog* logger, std::string format, canformat::
   : canlogconnection(logger, format, mode)
   {
   m_file = NULL;
+  m_batchtime = 0;
+  m_writecount = 0;
   }
 
 canlog_vfs_conn::~canlog_vfs_conn()
   {
   if (m_file)
     {
+    WriteBatch();
     fclose(m_file);
     m_file = NULL;
     }
@@ -114,7 +118,45 @@ void canlog_vfs_conn::OutputMsg(CAN_log_message_t& msg, std::string &result)
     }
 
   if (result.length()>0)
-    fwrite(result.c_str(),result.length(),1,m_file);
+    Write(result);
+  }
+
+void canlog_vfs_conn::Write(const std::string& data)
+  {
+  if (m_batch.empty())
+    {
+    m_batch.reserve(CANLOG_VFS_BATCHSIZE);
+    m_batchtime = xTaskGetTickCount();
+    }
+  m_batch.append(data);
+  if (m_batch.size() >= CANLOG_VFS_BATCHSIZE)
+    WriteBatch();
+  }
+
+void canlog_vfs_conn::WriteBatch()
+  {
+  if (m_batch.empty() || !m_file)
+    return;
+  if (fwrite(m_batch.data(), m_batch.size(), 1, m_file) != 1)
+    m_dropcount++;
+  m_writecount++;
+  m_batch.clear();
+  }
+
+void canlog_vfs_conn::Flush()
+  {
+  if (!m_batch.empty() &&
+      xTaskGetTickCount() - m_batchtime >= pdMS_TO_TICKS(CANLOG_VFS_FLUSHTIME))
+    {
+    WriteBatch();
+    }
+  }
+
+std::string canlog_vfs_conn::GetStats()
+  {
+  std::ostringstream buf;
+  buf << canlogconnection::GetStats() << " Writes:" << m_writecount;
+  return buf.str();
   }
 
 
@@ -179,9 +221,10 @@ bool canlog_vfs::Open()
 
   ESP_LOGI(TAG, "Now logging CAN messages to '%s'", m_path.c_str());
 
+  m_formatter->SetTrailer(true);
   std::string header = m_formatter->getheader();
   if (header.length()>0)
-    fwrite(header.c_str(),header.length(),1,clc->m_file);
+    clc->Write(header);
 
   m_connmap[NULL] = clc;
   m_isopen = true;
@@ -197,9 +240,13 @@ void canlog_vfs::Close()
       m_path.c_str(), GetStats().c_str());
 
     OvmsRecMutexLock lock(&m_cmmutex);
+    std::string trailer = m_formatter->gettrailer();
     for (conn_map_t::iterator it=m_connmap.begin(); it!=m_connmap.end(); ++it)
       {
-      delete it->second;
+      canlog_vfs_conn* clc = (canlog_vfs_conn*)it->second;
+      if (trailer.length()>0)
+        clc->Write(trailer);
+      delete clc;
       }
     m_connmap.clear();
 
@@ -30,7 +30,18 @@
 
 #include "canlog.h"
 
+#define CANLOG_VFS_BATCHSIZE    4096    // output batch size [bytes]
+#define CANLOG_VFS_FLUSHTIME    1000    // max batch age [ms]
 
+/**
+ * canlog_vfs_conn: file output
+ *
+ * Formatted records are collected into a batch buffer and written to the
+ * file when the buffer is full or on the logger becoming idle after the
+ * oldest batched record has reached CANLOG_VFS_FLUSHTIME. This reduces
+ * the number of (SD card) writes to a few per second independent of the
+ * frame rate.
+ */
 class canlog_vfs_conn: public canlogconnection
   {
   public:
@@ -39,9 +50,18 @@ class canlog_vfs_conn: public canlogconnection
 
   public:
     virtual void OutputMsg(CAN_log_message_t& msg, std::string &result);
+    virtual void Flush();
+    virtual std::string GetStats();
+
+  public:
+    void Write(const std::string& data);
+    void WriteBatch();
 
   public:
     FILE*               m_file;
+    std::string         m_batch;
+    uint32_t            m_batchtime;    // tick count of first batched record
+    uint32_t            m_writecount;
   };
 
 
@@ -35,12 +35,16 @@ static const char *TAG = "canplay";
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include "esp_timer.h"
 #include "ovms_config.h"
 #include "ovms_command.h"
 #include "ovms_events.h"
 #include "ovms_peripherals.h"
 #include "metrics_standard.h"
 
+// Frames played back to back at full speed before yielding to lower priority tasks:
+#define CANPLAY_BURST_FRAMES  50
+
 ////////////////////////////////////////////////////////////////////////
 // Command Processing
 ////////////////////////////////////////////////////////////////////////
@@ -137,7 +141,7 @@ void can_play_speed(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
     canplay* cl = MyCan.GetPlayer(atoi(argv[1]));
     if (cl)
       {
-      cl->SetSpeed(atoi(argv[0]));
+      cl->SetSpeed(atof(argv[0]));
       writer->printf("CAN playing active: %s\n  Statistics: %s\n", cl->GetInfo().c_str(), cl->GetStats().c_str());
       }
     else
@@ -153,13 +157,41 @@ void can_play_speed(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
     for (can::canplay_map_t::iterator it=MyCan.m_playermap.begin(); it!=MyCan.m_playermap.end(); ++it)
       {
       canplay* cl = it->second;
-      cl->SetSpeed(atoi(argv[0]));
+      cl->SetSpeed(atof(argv[0]));
       writer->printf("CAN player #%d: %s\n  Statistics: %s\n",
         it->first, cl->GetInfo().c_str(), cl->GetStats().c_str());
       }
     }
   }
 
+void can_play_seek(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (!MyCan.HasPlayer())
+    {
+    writer->puts("CAN playing inactive");
+    return;
+    }
+
+  double seconds = atof(argv[0]);
+  if (seconds < 0)
+    {
+    writer->puts("Error: position must not be negative");
+    return;
+    }
+
+  OvmsMutexLock lock(&MyCan.m_playermap_mutex);
+  for (can::canplay_map_t::iterator it=MyCan.m_playermap.begin(); it!=MyCan.m_playermap.end(); ++it)
+    {
+    if (argc > 1 && it->first != (uint32_t)atoi(argv[1]))
+      continue;
+    canplay* cl = it->second;
+    if (cl->SetPosition(seconds))
+      writer->printf("CAN player #%d: seeking to %.3f sec\n", it->first, seconds);
+    else
+      writer->printf("CAN player #%d: Error: seek failed or not supported\n", it->first);
+    }
+  }
+
 ////////////////////////////////////////////////////////////////////////
 // CAN Play System initialisation
 ////////////////////////////////////////////////////////////////////////
@@ -182,7 +214,12 @@ OvmsCanPlayInit::OvmsCanPlayInit()
 
   OvmsCommand* cmd_canplay = cmd_can->RegisterCommand("play", "CAN play framework");
   cmd_canplay->RegisterCommand("stop", "Stop playing", can_play_stop,"[<id>]",0,1);
-  cmd_canplay->RegisterCommand("speed", "Set playback speed", can_play_speed,"<speed> [<id>]",1,2);
+  cmd_canplay->RegisterCommand("speed", "Set playback speed", can_play_speed,
+    "<speed> [<id>]\n"
+    "<speed>: time scale factor, i.e. 0.5 = half speed, 0 = as fast as possible",1,2);
+  cmd_canplay->RegisterCommand("seek", "Continue playback at position", can_play_seek,
+    "<seconds> [<id>]\n"
+    "<seconds>: time offset from the log start",1,2);
   cmd_canplay->RegisterCommand("status", "Playing status", can_play_status,"[<id>]",0,1);
   cmd_canplay->RegisterCommand("list", "Playing list", can_play_list);
   cmd_canplay->RegisterCommand("start", "CAN play start framework");
@@ -200,18 +237,22 @@ canplay::canplay(const char* type, std::string format, canformat::canformat_serv
   m_formatter->SetServeMode(mode);
   m_filter = NULL;
   m_speed = 1;
+  m_task = NULL;
 
   m_msgcount = 0;
-  xTaskCreatePinnedToCore(PlayTask, "OVMS CanPlay", 4096, (void*)this, 10, &m_task, CORE(1));
+  m_filtercount = 0;
+  m_skipcount = 0;
+  m_finished = false;
+  m_hasstart = false;
+  m_logstart = 0;
+  m_position = 0;
+  m_seekpos = -1;
+  m_rebase = true;
   }
 
 canplay::~canplay()
   {
-  if (m_task)
-    {
-    vTaskDelete(m_task);
-    m_task = NULL;
-    }
+  Stop();
 
   if (m_formatter)
     {
@@ -226,20 +267,132 @@ canplay::~canplay()
     }
   }
 
-void canplay::PlayTask(void *context)
+/**
+ * Start: start the player task, to be called after Open()
+ */
+void canplay::Start()
   {
-//  canplay* me = (canplay*) context;
+  if (!m_task)
+    xTaskCreatePinnedToCore(PlayTask, "OVMS CanPlay", 4096, (void*)this, 10, &m_task, CORE(1));
+  }
 
-//  CAN_log_message_t msg;
-//  while (me->InputMsg(&msg))
-//    {
-//    vTaskDelay(pdMS_TO_TICKS(1000));
-//    }
+/**
+ * Stop: stop the player task, sub classes need to call this in their
+ *  destructor before releasing the input
+ */
+void canplay::Stop()
+  {
+  if (m_task)
+    {
+    // Make sure the task is not within input processing:
+    OvmsRecMutexLock lock(&m_mutex);
+    vTaskDelete(m_task);
+    m_task = NULL;
+    }
+  }
 
-//  me->Close();
-  while(1)
+void canplay::PlayTask(void *context)
+  {
+  canplay* me = (canplay*) context;
+  CAN_log_message_t msg;
+  int64_t playbase = 0;           // system time of timing base [us]
+  int64_t logbase = 0;            // log time of timing base [us]
+  int burst = 0;                  // frames played without delay
+
+  while (1)
     {
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    int64_t logtime;
+    float speed;
+
+    me->m_mutex.Lock();
+    if (me->m_finished || !me->IsOpen() || !me->m_formatter)
+      {
+      me->m_mutex.Unlock();
+      vTaskDelay(pdMS_TO_TICKS(1000));
+      continue;
+      }
+    memset(&msg,0,sizeof(msg));
+    if (!me->InputMsg(&msg))
+      {
+      me->m_finished = true;
+      me->m_mutex.Unlock();
+      ESP_LOGI(TAG, "Playback finished: %s", me->GetStats().c_str());
+      continue;
+      }
+    if (msg.type != CAN_LogFrame_RX || msg.frame.origin == NULL)
+      {
+      me->m_mutex.Unlock();
+      continue;
+      }
+
+    logtime = (int64_t)msg.timestamp.tv_sec * 1000000LL + msg.timestamp.tv_usec;
+    if (!me->m_hasstart)
+      {
+      me->m_logstart = logtime;
+      me->m_hasstart = true;
+      }
+    if (me->m_seekpos >= 0)
+      {
+      if (logtime - me->m_logstart < me->m_seekpos)
+        {
+        me->m_skipcount++;
+        me->m_mutex.Unlock();
+        continue;
+        }
+      me->m_seekpos = -1;
+      me->m_rebase = true;
+      }
+    if (me->m_filter && !me->m_filter->IsFiltered(&msg.frame))
+      {
+      me->m_filtercount++;
+      me->m_mutex.Unlock();
+      continue;
+      }
+    if (me->m_rebase)
+      {
+      me->m_rebase = false;
+      playbase = esp_timer_get_time();
+      logbase = logtime;
+      }
+    speed = me->m_speed;
+    me->m_mutex.Unlock();
+
+    // Wait for the frame's playback time, speed changes & seeks
+    //  take effect immediately:
+    if (speed > 0)
+      {
+      int64_t due = playbase + (int64_t)((logtime - logbase) / speed);
+      while (!me->m_rebase)
+        {
+        int64_t ticks = (due - esp_timer_get_time()) / (1000 * portTICK_PERIOD_MS);
+        if (ticks <= 0) break;
+        vTaskDelay(MIN(ticks, (int64_t)pdMS_TO_TICKS(100)));
+        burst = 0;
+        }
+      }
+    if (++burst >= CANPLAY_BURST_FRAMES)
+      {
+      // Full speed / catching up: let lower priority tasks run
+      burst = 0;
+      vTaskDelay(1);
+      }
+
+    OvmsRecMutexLock lock(&me->m_mutex);
+    if (me->m_seekpos >= 0)
+      continue;
+    me->m_position = logtime - me->m_logstart;
+    switch (me->m_formatter->GetServeMode())
+      {
+      case canformat::Simulate:
+        MyCan.IncomingFrame(&msg.frame);
+        break;
+      case canformat::Transmit:
+        msg.frame.origin->Write(&msg.frame, pdMS_TO_TICKS(500));
+        break;
+      default:
+        break;
+      }
+    me->m_msgcount++;
     }
   }
 
@@ -253,9 +406,27 @@ const char* canplay::GetFormat()
   return m_format.c_str();
   }
 
-void canplay::SetSpeed(uint32_t speed)
+void canplay::SetSpeed(float speed)
   {
+  if (speed < 0) speed = 0;
+  OvmsRecMutexLock lock(&m_mutex);
   m_speed = speed;
+  m_rebase = true;
+  }
+
+/**
+ * SetPosition: continue playback at the time offset from the log start
+ */
+bool canplay::SetPosition(double seconds)
+  {
+  OvmsRecMutexLock lock(&m_mutex);
+  int64_t offset = (int64_t)(seconds * 1000000);
+  if (!Seek(offset))
+    return false;
+  m_seekpos = offset;
+  m_finished = false;
+  m_rebase = true;
+  return true;
   }
 
 bool canplay::InputMsg(CAN_log_message_t* msg)
@@ -263,6 +434,11 @@ bool canplay::InputMsg(CAN_log_message_t* msg)
   return false;
   }
 
+bool canplay::Seek(int64_t offset)
+  {
+  return false;
+  }
+
 std::string canplay::GetInfo()
   {
   std::ostringstream buf;
@@ -291,13 +467,19 @@ std::string canplay::GetStats()
   {
   std::ostringstream buf;
 
-  buf << "total messages: " << m_msgcount;
+  buf << "total messages: " << m_msgcount
+    << " filtered: " << m_filtercount
+    << " skipped: " << m_skipcount
+    << " position: " << std::fixed << std::setprecision(3) << (double)m_position / 1000000 << "s";
+  if (m_finished)
+    buf << " (finished)";
 
   return buf.str();
   }
 
 void canplay::SetFilter(canfilter* filter)
   {
+  OvmsRecMutexLock lock(&m_mutex);
   if (m_filter)
     {
     delete m_filter;
@@ -307,6 +489,7 @@ void canplay::SetFilter(canfilter* filter)
 
 void canplay::ClearFilter()
   {
+  OvmsRecMutexLock lock(&m_mutex);
   if (m_filter)
     {
     delete m_filter;
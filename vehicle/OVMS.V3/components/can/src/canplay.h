@@ -33,6 +33,18 @@
 
 /**
  * canplay is the general interface and base implementation for all can players.
+ *
+ * The player task reads messages via InputMsg() and feeds received frames
+ *  into the CAN framework (simulate) or transmits them (transmit) at their
+ *  original timing, scaled by the speed factor (0 = as fast as possible).
+ *
+ * Players supporting random access implement Seek() to continue playback
+ *  at a time offset from the log start. Frames before the target time are
+ *  skipped by the player task, so a Seek() implementation only needs to
+ *  position the input at or before the target.
+ *
+ * Sub classes need to lock m_mutex for input access from other contexts
+ *  (Open/Close/Seek), the player task holds it while reading & injecting.
  */
 class canplay : public InternalRamAllocated
   {
@@ -42,12 +54,15 @@ class canplay : public InternalRamAllocated
 
   public:
     static void PlayTask(void* context);
+    void Start();
+    void Stop();
 
   public:
     const char* GetType();
     const char* GetFormat();
     virtual std::string GetStats();
-    void SetSpeed(uint32_t speed);
+    void SetSpeed(float speed);
+    bool SetPosition(double seconds);
 
   public:
     // Methods expected to be implemented by sub-classes
@@ -56,6 +71,7 @@ class canplay : public InternalRamAllocated
     virtual bool IsOpen() = 0;
     virtual std::string GetInfo();
     virtual bool InputMsg(CAN_log_message_t* msg);
+    virtual bool Seek(int64_t offset);
 
   public:
     virtual void SetFilter(canfilter* filter);
@@ -64,13 +80,22 @@ class canplay : public InternalRamAllocated
   public:
     const char*         m_type;
     std::string         m_format;
-    uint32_t            m_speed;
+    float               m_speed;
     canformat*          m_formatter;
     canfilter*          m_filter;
+    OvmsRecMutex        m_mutex;
 
   public:
     TaskHandle_t        m_task;
-    uint32_t            m_msgcount;
+    uint32_t            m_msgcount;       // frames played
+    uint32_t            m_filtercount;    // frames filtered
+    uint32_t            m_skipcount;      // frames skipped by seek
+    bool                m_finished;       // end of input reached
+    bool                m_hasstart;       // log start time known
+    int64_t             m_logstart;       // log start time [us]
+    int64_t             m_position;       // offset of last frame played [us]
+    int64_t             m_seekpos;        // seek target offset [us], -1 = none
+    volatile bool       m_rebase;         // restart timing on next frame
   };
 
 #endif // __CANPLAY_H__
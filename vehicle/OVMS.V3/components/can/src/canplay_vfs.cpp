@@ -30,6 +30,7 @@ static const char *TAG = "canplay-vfs";
 #include "can.h"
 #include "canformat.h"
 #include "canplay_vfs.h"
+#include <sys/param.h>
 #include "ovms_utils.h"
 #include "ovms_config.h"
 #include "ovms_peripherals.h"
@@ -91,6 +92,13 @@ canplay_vfs::canplay_vfs(std::string path, std::string format)
   {
   m_file = NULL;
   m_path = path;
+  m_bufpos = 0;
+  m_buflen = 0;
+  m_hasmore = false;
+  m_filepos = 0;
+  m_end = -1;
+  memset(&m_trailer,0,sizeof(m_trailer));
+  m_block = -1;
   using std::placeholders::_1;
   using std::placeholders::_2;
   MyEvents.RegisterEvent(IDTAG, "sd.mounted", std::bind(&canplay_vfs::MountListener, this, _1, _2));
@@ -99,6 +107,7 @@ canplay_vfs::canplay_vfs(std::string path, std::string format)
 
 canplay_vfs::~canplay_vfs()
   {
+  Stop();
   MyEvents.DeregisterEvent(IDTAG);
 
   if (m_file != NULL)
@@ -109,6 +118,8 @@ canplay_vfs::~canplay_vfs()
 
 bool canplay_vfs::Open()
   {
+  OvmsRecMutexLock lock(&m_mutex);
+
   if (m_file)
     {
     fclose(m_file);
@@ -136,6 +147,34 @@ bool canplay_vfs::Open()
     return false;
     }
 
+  m_index.clear();
+  if (m_format == "ovmsbin" &&
+      canformat_obin::ReadIndex(m_file, m_index, m_trailer) &&
+      m_index.size() > 0)
+    {
+    m_logstart = (int64_t)m_index[0].tv_sec * 1000000LL + m_index[0].tv_usec;
+    m_hasstart = true;
+    m_end = (long)m_index[0].recno * sizeof(canformat_obin_rec_t);
+    ESP_LOGI(TAG, "Using block index of '%s': %u blocks%s", m_path.c_str(), (unsigned)m_index.size(),
+      (m_trailer.flags & CANFORMAT_OBIN_IX_INCOMPLETE) ? " (incomplete)" : "");
+    }
+  else
+    {
+    m_index.clear();
+    m_end = -1;
+    }
+
+  fseek(m_file, 0, SEEK_SET);
+  m_filepos = 0;
+  m_block = -1;
+  m_bufpos = m_buflen = 0;
+  m_hasmore = false;
+  if (m_formatter)
+    m_formatter->Reset();
+  m_finished = false;
+  m_seekpos = -1;
+  m_rebase = true;
+
   ESP_LOGI(TAG, "Now playing CAN messages from '%s'", m_path.c_str());
 
   return true;
@@ -143,10 +182,13 @@ bool canplay_vfs::Open()
 
 void canplay_vfs::Close()
   {
+  OvmsRecMutexLock lock(&m_mutex);
+
   if (m_file)
     {
     fclose(m_file);
     m_file = NULL;
+    m_index.clear();
     ESP_LOGI(TAG, "Closed vfs playback '%s': %s",
       m_path.c_str(), GetStats().c_str());
     }
@@ -162,6 +204,8 @@ std::string canplay_vfs::GetInfo()
   std::string result = canplay::GetInfo();
   result.append(" Path:");
   result.append(m_path);
+  if (!m_index.empty())
+    result.append(" (indexed)");
   return result;
   }
 
@@ -173,10 +217,120 @@ void canplay_vfs::MountListener(std::string event, void* data)
     Open();
   }
 
+/**
+ * SetBlock: indexed playback: position the input at the start of the
+ *  given block, skipping blocks without frames passing the filter.
+ *  Returns false if there are no more blocks.
+ */
+bool canplay_vfs::SetBlock(int block)
+  {
+  int count = m_index.size();
+  bool incomplete = (m_trailer.flags & CANFORMAT_OBIN_IX_INCOMPLETE);
+
+  for (; block < count; block++)
+    {
+    const canformat_obin_idx_t& ix = m_index[block];
+    if (!m_filter || (incomplete && block == count-1) ||
+        m_filter->IsFilteredRange(ix.busmask, ix.id_min, ix.id_max))
+      break;
+    m_filtercount += ix.count;
+    }
+
+  m_block = block;
+  if (block >= count)
+    return false;
+
+  long pos = (long)m_index[block].recno * sizeof(canformat_obin_rec_t);
+  if (fseek(m_file, pos, SEEK_SET) != 0)
+    return false;
+  m_filepos = pos;
+  m_end = (long)((block+1 < count) ? m_index[block+1].recno : m_trailer.recno)
+    * sizeof(canformat_obin_rec_t);
+  return true;
+  }
+
+/**
+ * ReadInput: fill the input buffer from the file (current block)
+ *  Returns false on EOF.
+ */
+bool canplay_vfs::ReadInput()
+  {
+  size_t len = CANPLAY_VFS_BUFSIZE;
+  if (m_end >= 0)
+    {
+    while (m_filepos >= m_end)
+      {
+      if (!SetBlock(m_block+1))
+        return false;
+      }
+    len = MIN(len, (size_t)(m_end - m_filepos));
+    }
+
+  size_t n = fread(m_buf, 1, len, m_file);
+  if (n == 0)
+    return false;
+  m_filepos += n;
+  m_bufpos = 0;
+  m_buflen = n;
+  return true;
+  }
+
 bool canplay_vfs::InputMsg(CAN_log_message_t* msg)
   {
   if (m_file == NULL) return false;
   if (m_formatter == NULL) return false;
 
-  return false;
+  while (1)
+    {
+    if (m_buflen > 0 || m_hasmore)
+      {
+      bool hasmore = false;
+      size_t used = m_formatter->put(msg, m_buf+m_bufpos, m_buflen, &hasmore);
+      m_bufpos += used;
+      m_buflen -= used;
+      m_hasmore = hasmore;
+      if (msg->type != CAN_LogNone)
+        return true;
+      if (used > 0 || hasmore)
+        continue;
+      if (m_buflen > 0)
+        return false; // formatter cannot take more input
+      }
+    if (!ReadInput())
+      return false;
+    }
+  }
+
+bool canplay_vfs::Seek(int64_t offset)
+  {
+  OvmsRecMutexLock lock(&m_mutex);
+  if (m_file == NULL) return false;
+  if (m_formatter == NULL) return false;
+
+  if (m_index.empty())
+    {
+    // Sequential: restart at the beginning, the player skips up to the target
+    if (fseek(m_file, 0, SEEK_SET) != 0)
+      return false;
+    m_filepos = 0;
+    m_end = -1;
+    }
+  else
+    {
+    // Indexed: continue at the last block starting before the target
+    int64_t target = m_logstart + offset;
+    int block = 0;
+    for (int k = 1; k < (int)m_index.size(); k++)
+      {
+      if ((int64_t)m_index[k].tv_sec * 1000000LL + m_index[k].tv_usec > target)
+        break;
+      block = k;
+      }
+    SetBlock(block);  // false = no more blocks: playback ends
+    }
+
+  m_bufpos = m_buflen = 0;
+  m_hasmore = false;
+  m_formatter->Reset();
+  return true;
   }
@@ -29,7 +29,19 @@
 #define __CANPLAY_VFS_H__
 
 #include "canplay.h"
+#include "canformat_obin.h"
 
+#define CANPLAY_VFS_BUFSIZE     512
+
+/**
+ * canplay_vfs: play a CAN log file
+ *
+ * Files in a format with block index (ovmsbin) are read block wise: Seek()
+ * positions directly at the block containing the target time, and blocks
+ * without frames passing the player filter (by bus mask & ID range) are
+ * skipped without reading them. Other formats are read sequentially, Seek()
+ * restarts at the beginning.
+ */
 class canplay_vfs : public canplay
   {
   public:
@@ -44,6 +56,11 @@ class canplay_vfs : public canplay
 
   public:
     virtual bool InputMsg(CAN_log_message_t* msg);
+    virtual bool Seek(int64_t offset);
+
+  protected:
+    bool ReadInput();
+    bool SetBlock(int block);
 
   public:
     virtual void MountListener(std::string event, void* data);
@@ -51,6 +68,17 @@ class canplay_vfs : public canplay
   public:
     std::string         m_path;
     FILE*               m_file;
+
+  protected:
+    uint8_t             m_buf[CANPLAY_VFS_BUFSIZE];
+    size_t              m_bufpos;
+    size_t              m_buflen;
+    bool                m_hasmore;
+    long                m_filepos;      // file read position
+    long                m_end;          // end of current block, -1 = read to EOF
+    canformat_obin_index_t m_index;     // block index (if available)
+    canformat_obin_trailer_t m_trailer;
+    int                 m_block;        // current index block, -1 = file header
   };
 
 #endif // __CANPLAY_VFS_H__
@@ -142,7 +142,7 @@ CANopenWorker* CANopen::Start(canbus* bus)
     m_rxqueue = xQueueCreate(20, sizeof(CAN_frame_t));
     xTaskCreatePinnedToCore(CANopenRxTask, "OVMS COrx",
       CONFIG_OVMS_COMP_CANOPEN_RX_STACK, (void*)this, 15, &m_rxtask, CORE(0));
-    MyCan.RegisterListener(m_rxqueue);
+    MyCan.RegisterListener(m_rxqueue, false, "canopen");
     }
 
   // start worker:
@@ -377,6 +377,7 @@ const std::string CANopen::GetResultString(const CANopenResult_t result)
     case COR_ERR_Timeout:               name = "Timeout"; break;
     case COR_ERR_SDO_Access:            name = "SDO access failed"; break;
     case COR_ERR_SDO_SegMismatch:       name = "SDO segment mismatch"; break;
+    case COR_ERR_SDO_CRCError:          name = "SDO block CRC error"; break;
 
     case COR_ERR_DeviceOffline:         name = "Device offline"; break;
     case COR_ERR_UnknownDevice:         name = "Unknown device"; break;
@@ -27,6 +27,8 @@
 #define __CANOPEN_H__
 
 #include <forward_list>
+#include <deque>
+#include <bitset>
 
 #include "can.h"
 
@@ -40,6 +42,12 @@
 #define CANopen_GeneralError      0x08000000  // check for device specific error details
 #define CANopen_BusCollision      0xffffffff  // another master is active / non-CANopen frame received
 
+#define CANOPEN_SDO_BLOCK_MINSIZE 32          // try block transfers for SDO buffers from this size
+#define CANOPEN_SDO_BLOCK_SIZE    16          // max segments per block accepted on uploads
+#define CANOPEN_SDO_BLOCK_RETRIES 3           // max block repetitions without progress on downloads
+#define CANOPEN_LANE_RXQUEUE      (CANOPEN_SDO_BLOCK_SIZE+4)
+#define CANOPEN_BATCH_WINDOW      8           // max batch jobs in flight per client
+
 typedef enum __attribute__ ((__packed__))
   {
   COR_OK = 0,
@@ -57,6 +65,7 @@ typedef enum __attribute__ ((__packed__))
   COR_ERR_Timeout,
   COR_ERR_SDO_Access,
   COR_ERR_SDO_SegMismatch,
+  COR_ERR_SDO_CRCError,
   
   // General purpose application level:
   COR_ERR_DeviceOffline = 0x80,
@@ -205,6 +214,19 @@ typedef union __attribute__ ((__packed__))
     uint8_t     subindex;       // SDO register sub index
     uint32_t    data;           // abort reason / error code (little endian)
     } ctl;
+  struct __attribute__ ((__packed__))
+    {
+    uint8_t     control;        // block protocol request / response
+    uint8_t     ackseq;         // last segment received in sequence
+    uint8_t     blksize;        // segments for next block
+    uint8_t     unused[5];
+    } ack;
+  struct __attribute__ ((__packed__))
+    {
+    uint8_t     control;        // block protocol request / response
+    uint16_t    crc;            // CRC-16-CCITT of the data (little endian)
+    uint8_t     unused[5];
+    } end;
   } CANopenFrame_t;
 
 
@@ -214,11 +236,75 @@ typedef union __attribute__ ((__packed__))
  * CANopenClients create and submit Jobs to be processed to a CANopenWorker.
  * After finish/abort, the Worker sends the Job to the clients done queue.
  * 
+ * Jobs are executed by a set of worker lanes (tasks), so requests to different
+ * nodes can be processed in parallel. Only one job per response ID (i.e. node)
+ * is active at a time, jobs for a busy node are deferred and executed in
+ * submission order when the node becomes free.
+ * 
  * A CANopenWorker also monitors the bus for emergency and heartbeat
  * messages, and translates these into events and metrics updates.
  */
 
 typedef std::forward_list<CANopenAsyncClient*> CANopenClientList;
+typedef std::deque<CANopenJob> CANopenJobList;
+
+class CANopenWorker;
+
+class CANopenWorkerLane
+  {
+  public:
+    CANopenWorkerLane(CANopenWorker* worker, int id);
+    ~CANopenWorkerLane();
+  
+  public:
+    void JobTask();
+    void ProcessJob();
+    bool QueueResponse(CAN_frame_t* frame);
+  
+  protected:
+    CANopenResult_t ProcessSendNMTJob();
+    CANopenResult_t ProcessReceiveHBJob();
+    CANopenResult_t ProcessReadSDOJob();
+    CANopenResult_t ProcessWriteSDOJob();
+    CANopenResult_t ProcessReadSDOBlock();
+    CANopenResult_t ProcessWriteSDOBlock();
+  
+  private:
+    void SendSDORequest();
+    void SendSDOSegment(uint8_t seqno, const uint8_t* data, int len);
+    void AbortSDORequest(uint32_t reason);
+    bool ReceiveSDOResponse(TickType_t maxwait);
+    CANopenResult_t ExecuteSDORequest();
+
+  public:
+    CANopenWorker*        m_worker;
+    canbus*               m_bus;
+    int                   m_id;
+    
+    char                  m_taskname[16];   // "OVMS COcanX.n"
+    TaskHandle_t          m_jobtask;        // lane task
+    QueueHandle_t         m_rxqueue;        // response frames for the current job
+    
+    volatile uint16_t     m_rxid;           // response ID of current job, 0 = idle
+    CANopenJob            m_job;            // job currently processed
+    
+    // statistics:
+    uint32_t              m_jobcnt;
+    uint32_t              m_jobcnt_timeout;
+    uint32_t              m_jobcnt_error;
+    uint32_t              m_txcnt;          // frames sent
+    uint32_t              m_rxcnt;          // frames received
+    uint32_t              m_rxdrop;         // frames lost on rx queue overflow
+    uint32_t              m_sdo_rxbytes;    // SDO payload uploaded
+    uint32_t              m_sdo_txbytes;    // SDO payload downloaded
+    uint32_t              m_blkcnt;         // SDO block transfers done
+    uint32_t              m_blkfallback;    // SDO block transfers refused/ignored by server
+    uint64_t              m_busytime;       // µs spent processing jobs
+
+  private:
+    CANopenFrame_t        m_request;
+    CANopenFrame_t        m_response;
+  };
 
 class CANopenWorker
   {
@@ -227,7 +313,8 @@ class CANopenWorker
     ~CANopenWorker();
   
   public:
-    void JobTask();
+    bool FetchJob(CANopenWorkerLane* lane);
+    void ReleaseJob(CANopenWorkerLane* lane);
     void IncomingFrame(CAN_frame_t* frame);
     void Open(CANopenAsyncClient* client);
     void Close(CANopenAsyncClient* client);
@@ -239,38 +326,51 @@ class CANopenWorker
     CANopenResult_t SubmitJob(CANopenJob& job, TickType_t maxqueuewait=0);
   
   protected:
-    CANopenResult_t ProcessSendNMTJob();
-    CANopenResult_t ProcessReceiveHBJob();
-    CANopenResult_t ProcessReadSDOJob();
-    CANopenResult_t ProcessWriteSDOJob();
-  
-  private:
-    void SendSDORequest();
-    void AbortSDORequest(uint32_t reason);
-    CANopenResult_t ExecuteSDORequest();
+    bool IsBusy(uint16_t rxid);
 
   public:
     canbus*               m_bus;            // max one worker per bus
     int                   m_clientcnt;
     CANopenClientList     m_clients;
     
-    char                  m_taskname[12];   // "COwrk canX"
-    TaskHandle_t          m_jobtask;        // worker task
     QueueHandle_t         m_jobqueue;       // job rx queue
+    CANopenJobList        m_deferred;       // jobs waiting for their node
+    SemaphoreHandle_t     m_mutex;          // job dispatch lock
+    int                   m_lanecnt;
+    CANopenWorkerLane*    m_lane[CONFIG_OVMS_COMP_CANOPEN_WRK_LANES];
     
     uint32_t              m_nmt_rxcnt;
     uint32_t              m_emcy_rxcnt;
-    uint32_t              m_jobcnt;
-    uint32_t              m_jobcnt_timeout;
-    uint32_t              m_jobcnt_error;
-    
-    CANopenJob            m_job;            // job currently processed
     
     CANopenNodeMetricsMap m_nodemetrics;    // map: nodeid → node metrics
+    std::bitset<128>      m_noblock;        // nodes known to refuse/ignore SDO block transfers
+  };
 
-  private:
-    CANopenFrame_t        m_request;
-    CANopenFrame_t        m_response;
+
+/**
+ * CANopenSDOItem: single object transfer of a batch, see CANopenClient::ReadSDOBatch()
+ */
+struct CANopenSDOItem
+  {
+  uint8_t               nodeid;         // 0 = use batch nodeid
+  uint16_t              index;          // SDO register address
+  uint8_t               subindex;       // SDO subregister address
+  uint8_t*              buf;            // tx from / rx to, NULL = use value
+  size_t                bufsize;        // rx: buffer capacity, tx: see WriteSDO()
+  uint32_t              value;          // integer buffer (if buf is NULL)
+  
+  CANopenResult_t       result;         // COR_WAIT = not processed
+  uint32_t              error;          // CANopen general error code
+  size_t                xfersize;       // byte count sent / received
+  
+  void Init(uint16_t p_index, uint8_t p_subindex, uint32_t p_value=0, uint8_t p_nodeid=0)
+    {
+    memset(this, 0, sizeof(*this));
+    nodeid = p_nodeid;
+    index = p_index;
+    subindex = p_subindex;
+    value = p_value;
+    }
   };
 
 
@@ -342,6 +442,10 @@ class CANopenAsyncClient
  * The API methods will block until the job is done, job detail results
  *   are returned in the caller provided job.
  * 
+ * The batch API executes a list of SDO transfers, keeping up to
+ *   CANOPEN_BATCH_WINDOW jobs in flight, so the worker can process
+ *   them back to back and pipeline transfers to different nodes.
+ * 
  * See CANopen shell commands for usage examples.
  */
 class CANopenClient : public CANopenAsyncClient
@@ -366,6 +470,17 @@ class CANopenClient : public CANopenAsyncClient
     virtual CANopenResult_t WriteSDO(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
       int resp_timeout_ms=100, int max_tries=3);
   
+  public:
+    // Batch API:
+    virtual CANopenResult_t ReadSDOBatch(uint8_t nodeid, CANopenSDOItem* items, int count,
+      bool stop_on_error=false, int resp_timeout_ms=100, int max_tries=3);
+    virtual CANopenResult_t WriteSDOBatch(uint8_t nodeid, CANopenSDOItem* items, int count,
+      bool stop_on_error=true, int resp_timeout_ms=100, int max_tries=3);
+  
+  protected:
+    CANopenResult_t ExecuteBatch(CANopenJob_t type, uint8_t nodeid, CANopenSDOItem* items, int count,
+      bool stop_on_error, int resp_timeout_ms, int max_tries);
+  
   public:
     SemaphoreHandle_t m_mutex;              // thread mutex
   };
@@ -305,13 +305,13 @@ CANopenResult_t CANopenAsyncClient::WriteSDO(
  */
 
 CANopenClient::CANopenClient(CANopenWorker* worker)
-  : CANopenAsyncClient(worker, 1)
+  : CANopenAsyncClient(worker, CANOPEN_BATCH_WINDOW)
   {
   m_mutex = xSemaphoreCreateMutex();
   }
 
 CANopenClient::CANopenClient(canbus *bus)
-  : CANopenAsyncClient(bus, 1)
+  : CANopenAsyncClient(bus, CANOPEN_BATCH_WINDOW)
   {
   m_mutex = xSemaphoreCreateMutex();
   }
@@ -424,3 +424,129 @@ CANopenResult_t CANopenClient::WriteSDO(CANopenJob& job,
   return ExecuteJob(job);
   }
 
+
+/**
+ * [Batch API]
+ * ReadSDOBatch: read a list of SDO registers
+ *   - nodeid: default node for items with nodeid 0
+ *   - items with buf=NULL are read into item.value (up to 4 bytes)
+ *   - results are returned per item, see ReadSDO() for details
+ *   - stop_on_error: don't start further transfers after the first failure,
+ *     items not processed keep result COR_WAIT
+ *   - returns COR_OK if all transfers succeeded, else the result of the
+ *     first failed item in list order
+ * 
+ * Jobs to the same node are executed in list order, jobs to different
+ * nodes may be processed in parallel by the worker lanes.
+ */
+CANopenResult_t CANopenClient::ReadSDOBatch(
+    uint8_t nodeid, CANopenSDOItem* items, int count,
+    bool stop_on_error /*=false*/, int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  return ExecuteBatch(COJT_ReadSDO, nodeid, items, count, stop_on_error, resp_timeout_ms, max_tries);
+  }
+
+
+/**
+ * [Batch API]
+ * WriteSDOBatch: write a list of SDO registers
+ *   - nodeid: default node for items with nodeid 0
+ *   - items with buf=NULL send item.value, with bufsize 0 = unknown integer type
+ *   - results are returned per item, see WriteSDO() for details
+ *   - stop_on_error: don't start further transfers after the first failure,
+ *     items not processed keep result COR_WAIT
+ *   - returns COR_OK if all transfers succeeded, else the result of the
+ *     first failed item in list order
+ * 
+ * Jobs to the same node are executed in list order, jobs to different
+ * nodes may be processed in parallel by the worker lanes.
+ */
+CANopenResult_t CANopenClient::WriteSDOBatch(
+    uint8_t nodeid, CANopenSDOItem* items, int count,
+    bool stop_on_error /*=true*/, int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  return ExecuteBatch(COJT_WriteSDO, nodeid, items, count, stop_on_error, resp_timeout_ms, max_tries);
+  }
+
+
+/**
+ * ExecuteBatch: submit batch jobs, keeping up to CANOPEN_BATCH_WINDOW in flight
+ * 
+ * Job results are matched to the first pending item with the same node, object
+ * and buffer. As jobs for a node are executed in submission order, this also
+ * resolves items sharing a buffer.
+ */
+CANopenResult_t CANopenClient::ExecuteBatch(CANopenJob_t type,
+    uint8_t nodeid, CANopenSDOItem* items, int count,
+    bool stop_on_error, int resp_timeout_ms, int max_tries)
+  {
+  if (xSemaphoreTake(m_mutex, portMAX_DELAY) != pdTRUE)
+    return COR_ERR_QueueFull;
+  
+  CANopenJob job;
+  int sent = 0, pending = 0;
+  bool failed = false;
+  
+  for (int i = 0; i < count; i++)
+    items[i].result = COR_WAIT;
+  
+  while (pending > 0 || (sent < count && !(failed && stop_on_error)))
+    {
+    // fill window:
+    while (pending < CANOPEN_BATCH_WINDOW && sent < count && !(failed && stop_on_error))
+      {
+      CANopenSDOItem& item = items[sent++];
+      uint8_t* buf = item.buf ? item.buf : (uint8_t*)&item.value;
+      size_t bufsize = item.buf ? item.bufsize : ((type == COJT_ReadSDO) ? sizeof(item.value) : item.bufsize);
+      uint8_t itemnode = item.nodeid ? item.nodeid : nodeid;
+      
+      if (type == COJT_ReadSDO)
+        InitReadSDO(job, itemnode, item.index, item.subindex, buf, bufsize, resp_timeout_ms, max_tries);
+      else
+        InitWriteSDO(job, itemnode, item.index, item.subindex, buf, bufsize, resp_timeout_ms, max_tries);
+      
+      if (SubmitJob(job, pdMS_TO_TICKS(1000)) != COR_WAIT)
+        {
+        item.result = COR_ERR_QueueFull;
+        failed = true;
+        }
+      else
+        {
+        pending++;
+        }
+      }
+    
+    if (pending == 0)
+      break;
+    
+    // collect next result:
+    ReceiveDone(job, portMAX_DELAY);
+    pending--;
+    for (int i = 0; i < sent; i++)
+      {
+      CANopenSDOItem& item = items[i];
+      if (item.result == COR_WAIT
+        && (item.nodeid ? item.nodeid : nodeid) == job.sdo.nodeid
+        && item.index == job.sdo.index
+        && item.subindex == job.sdo.subindex
+        && (item.buf ? item.buf : (uint8_t*)&item.value) == job.sdo.buf)
+        {
+        item.result = job.result;
+        item.error = job.sdo.error;
+        item.xfersize = job.sdo.xfersize;
+        if (job.result != COR_OK)
+          failed = true;
+        break;
+        }
+      }
+    }
+  
+  xSemaphoreGive(m_mutex);
+  
+  for (int i = 0; i < count; i++)
+    {
+    if (items[i].result != COR_OK)
+      return items[i].result;
+    }
+  return COR_OK;
+  }
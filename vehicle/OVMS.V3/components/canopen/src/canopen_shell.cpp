@@ -24,6 +24,7 @@
  */
 
 #include <sys/param.h>
+#include <vector>
 
 // #include "ovms_log.h"
 // static const char *TAG = "canopen";
@@ -301,46 +302,54 @@ void CANopen::shell_writesdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd
 int CANopen::PrintNodeInfo(int capacity, OvmsWriter* writer, canbus* bus, int nodeid,
     int timeout_ms /*=50*/, bool brief /*=false*/, bool quiet /*=false*/)
   {
-  #define _readnum(idx, sub, var) (res = client.ReadSDO(job, nodeid, idx, sub, (uint8_t*)&var, sizeof(var), timeout_ms))
-  #define _readstr(idx, sub, var) (res = client.ReadSDO(job, nodeid, idx, sub, (uint8_t*)&var, sizeof(var)-1, timeout_ms), \
-    var[job.sdo.xfersize]=0, res)
-  
   CANopenClient client(bus);
-  CANopenJob job;
-  CANopenResult_t res;
+  CANopenSDOItem item[9];
   int written = 0;
   
-  uint32_t device_type = 0;
-  uint8_t error_register = 0;
-  uint32_t vendor_id = 0;
   char device_name[50];
   char hardware_version[50];
   char software_version[50];
-  uint32_t product_code = 0;
-  uint32_t revision_number = 0;
-  uint32_t serial_number = 0;
   
   // mandatory entries:
-  if (_readnum(0x1000, 0x00, device_type) != COR_OK)
+  item[0].Init(0x1000, 0x00);   // device type
+  item[1].Init(0x1001, 0x00);   // error register
+  item[2].Init(0x1018, 0x01);   // vendor id
+  
+  // optional entries:
+  item[3].Init(0x1008, 0x00);   // device name
+  item[3].buf = (uint8_t*)device_name;
+  item[3].bufsize = sizeof(device_name)-1;
+  item[4].Init(0x1009, 0x00);   // hardware version
+  item[4].buf = (uint8_t*)hardware_version;
+  item[4].bufsize = sizeof(hardware_version)-1;
+  item[5].Init(0x100a, 0x00);   // software version
+  item[5].buf = (uint8_t*)software_version;
+  item[5].bufsize = sizeof(software_version)-1;
+  item[6].Init(0x1018, 0x02);   // product code
+  item[7].Init(0x1018, 0x03);   // revision number
+  item[8].Init(0x1018, 0x04);   // serial number
+  
+  if (client.ReadSDOBatch(nodeid, item, 1, false, timeout_ms) != COR_OK)
     {
-    if (!quiet || res != COR_ERR_Timeout)
+    if (!quiet || item[0].result != COR_ERR_Timeout)
       {
       if (written < capacity) written += writer->printf(
         brief ? "#%d: %-.20s\n" : "Node #%d: %s\n"
-        , nodeid, CANopen::GetResultString(job).c_str());
+        , nodeid, CANopen::GetResultString(item[0].result, item[0].error).c_str());
       }
     return written;
     }
-  _readnum(0x1001, 0x00, error_register);
-  _readnum(0x1018, 0x01, vendor_id);
+  client.ReadSDOBatch(nodeid, item+1, 8, false, timeout_ms);
   
-  // optional entries:
-  _readstr(0x1008, 0x00, device_name);
-  _readstr(0x1009, 0x00, hardware_version);
-  _readstr(0x100a, 0x00, software_version);
-  _readnum(0x1018, 0x02, product_code);
-  _readnum(0x1018, 0x03, revision_number);
-  _readnum(0x1018, 0x04, serial_number);
+  device_name[item[3].xfersize] = 0;
+  hardware_version[item[4].xfersize] = 0;
+  software_version[item[5].xfersize] = 0;
+  uint32_t device_type = item[0].value;
+  uint8_t error_register = item[1].value;
+  uint32_t vendor_id = item[2].value;
+  uint32_t product_code = item[6].value;
+  uint32_t revision_number = item[7].value;
+  uint32_t serial_number = item[8].value;
   
   if (brief)
     {
@@ -369,9 +378,6 @@ int CANopen::PrintNodeInfo(int capacity, OvmsWriter* writer, canbus* bus, int no
     }
   
   return written;
-  
-  #undef _readnum
-  #undef _readstr
   }
 
 
@@ -452,9 +458,21 @@ void CANopen::shell_scan(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, in
   // execute:
   int capacity = verbosity;
   capacity -= writer->printf("Scan #%d-%d...\n", id_start, id_end);
+  
+  // probe all nodes by a batch, so the worker lanes can wait for
+  // the timeouts of absent nodes in parallel:
+  std::vector<CANopenSDOItem> probe(id_end - id_start + 1);
+  for (int nodeid=id_start; nodeid <= id_end; nodeid++)
+    probe[nodeid-id_start].Init(0x1000, 0x00, 0, nodeid);
+  {
+  CANopenClient client(bus);
+  client.ReadSDOBatch(0, probe.data(), probe.size(), false, timeout);
+  }
+  
   for (int nodeid=id_start; nodeid <= id_end; nodeid++)
     {
-    capacity -= PrintNodeInfo(capacity, writer, bus, nodeid, timeout, (verbosity<COMMAND_RESULT_NORMAL), true);
+    if (probe[nodeid-id_start].result != COR_ERR_Timeout)
+      capacity -= PrintNodeInfo(capacity, writer, bus, nodeid, timeout, (verbosity<COMMAND_RESULT_NORMAL), true);
     }
   writer->printf("Done.\n");
   }
@@ -26,9 +26,12 @@
 #include "ovms_log.h"
 static const char *TAG = "canopen";
 
+#include <sys/param.h>
+#include "esp_timer.h"
 #include "ovms_metrics.h"
 #include "metrics_standard.h"
 #include "ovms_events.h"
+#include "crypt_crc.h"
 #include "canopen.h"
 
 
@@ -55,14 +58,41 @@ static const char *TAG = "canopen";
 #define SDO_SegmentUnusedMask       0b00001110
 #define SDO_SegmentEnd              0b00000001
 
+// SDO block commands:
+
+#define SDO_BlockCommandMask        0b11100011
+#define SDO_BlockUploadInitMask     0b11100001
+#define SDO_BlockCRC                0b00000100
+#define SDO_BlockSizeIndicated      0b00000010
+#define SDO_BlockUnusedMask         0b00011100
+#define SDO_BlockSegmentLast        0b10000000
+#define SDO_BlockSeqnoMask          0b01111111
+
+#define SDO_BlockUploadInit         0b10100000
+#define SDO_BlockUploadEndResponse  0b10100001
+#define SDO_BlockUploadAck          0b10100010
+#define SDO_BlockUploadStart        0b10100011
+#define SDO_BlockUploadInitResponse 0b11000000
+#define SDO_BlockUploadEnd          0b11000001
+
+#define SDO_BlockDownloadInit         0b11000000
+#define SDO_BlockDownloadEnd          0b11000001
+#define SDO_BlockDownloadInitResponse 0b10100000
+#define SDO_BlockDownloadEndResponse  0b10100001
+#define SDO_BlockDownloadAck          0b10100010
+
 // SDO abort reasons:
 
 #define SDO_Abort_SegMismatch       0x05030000
 #define SDO_Abort_Timeout           0x05040000
+#define SDO_Abort_CommandInvalid    0x05040001
+#define SDO_Abort_BlockSize         0x05040002
+#define SDO_Abort_SeqNo             0x05040003
+#define SDO_Abort_CRCError          0x05040004
 #define SDO_Abort_OutOfMemory       0x05040005
 
 
-static void CANopenWorkerJobTask(void *pvParameters);
+static void CANopenWorkerLaneTask(void *pvParameters);
 
 
 /**
@@ -71,6 +101,8 @@ static void CANopenWorkerJobTask(void *pvParameters);
  * CANopenClients create and submit Jobs to be processed to a CANopenWorker.
  * After finish/abort, the Worker sends the Job to the clients done queue.
  * 
+ * Jobs are executed by the worker lanes, see FetchJob() for the dispatch rules.
+ * 
  * A CANopenWorker also monitors the bus for emergency and heartbeat
  * messages, and translates these into events and metrics updates.
  */
@@ -84,26 +116,20 @@ CANopenWorker::CANopenWorker(canbus* bus)
   m_nmt_rxcnt = 0;
   m_emcy_rxcnt = 0;
   
-  m_jobcnt = 0;
-  m_jobcnt_timeout = 0;
-  m_jobcnt_error = 0;
-  
   m_jobqueue = xQueueCreate(20, sizeof(CANopenJob));
-  snprintf(m_taskname, sizeof(m_taskname), "OVMS COwrk %s", bus->GetName());
-  xTaskCreatePinnedToCore(CANopenWorkerJobTask, m_taskname,
-    CONFIG_OVMS_COMP_CANOPEN_WRK_STACK, (void*)this, 15, &m_jobtask, CORE(0));
-  
-  memset(&m_job, 0, sizeof(m_job));
-  m_job.type = COJT_None;
+  m_mutex = xSemaphoreCreateMutex();
   
-  memset(&m_request, 0, sizeof(m_request));
-  memset(&m_response, 0, sizeof(m_response));
+  m_lanecnt = CONFIG_OVMS_COMP_CANOPEN_WRK_LANES;
+  for (int i=0; i < m_lanecnt; i++)
+    m_lane[i] = new CANopenWorkerLane(this, i);
   }
 
 CANopenWorker::~CANopenWorker()
   {
+  for (int i=0; i < m_lanecnt; i++)
+    delete m_lane[i];
   vQueueDelete(m_jobqueue);
-  vTaskDelete(m_jobtask);
+  vSemaphoreDelete(m_mutex);
   }
 
 
@@ -132,21 +158,63 @@ bool CANopenWorker::IsClient(CANopenAsyncClient* client)
 
 void CANopenWorker::StatusReport(int verbosity, OvmsWriter* writer)
   {
+  int busy = 0;
+  uint32_t jobcnt = 0, jobcnt_timeout = 0, jobcnt_error = 0;
+  uint32_t txcnt = 0, rxcnt = 0, rxdrop = 0;
+  uint32_t rxbytes = 0, txbytes = 0, blkcnt = 0, blkfallback = 0;
+  uint64_t busytime = 0;
+  
+  for (int i=0; i < m_lanecnt; i++)
+    {
+    CANopenWorkerLane* lane = m_lane[i];
+    if (lane->m_job.type != COJT_None)
+      busy++;
+    jobcnt += lane->m_jobcnt;
+    jobcnt_timeout += lane->m_jobcnt_timeout;
+    jobcnt_error += lane->m_jobcnt_error;
+    txcnt += lane->m_txcnt;
+    rxcnt += lane->m_rxcnt;
+    rxdrop += lane->m_rxdrop;
+    rxbytes += lane->m_sdo_rxbytes;
+    txbytes += lane->m_sdo_txbytes;
+    blkcnt += lane->m_blkcnt;
+    blkfallback += lane->m_blkfallback;
+    busytime += lane->m_busytime;
+    }
+  
+  uint32_t busy_ms = busytime / 1000;
+  uint32_t rate = busy_ms ? ((uint64_t)(rxbytes + txbytes) * 1000 / busy_ms) : 0;
+  
   writer->printf(
     "  %s:\n"
     "    Active clients: %d\n"
-    "    Jobs waiting  : %d\n"
-    "    Jobs processed: %d\n"
-    "    - timeouts    : %d\n"
-    "    - other errors: %d\n"
-    "    NMT received  : %d\n"
-    "    EMCY received : %d\n"
+    "    Job lanes     : %d (%d busy)\n"
+    "    Jobs waiting  : %d (%d deferred)\n"
+    "    Jobs processed: %u\n"
+    "    - timeouts    : %u\n"
+    "    - other errors: %u\n"
     , m_bus->GetName()
     , m_clientcnt
-    , (int)uxQueueMessagesWaiting(m_jobqueue)
-    , m_jobcnt
-    , m_jobcnt_timeout
-    , m_jobcnt_error
+    , m_lanecnt, busy
+    , (int)uxQueueMessagesWaiting(m_jobqueue), (int)m_deferred.size()
+    , jobcnt
+    , jobcnt_timeout
+    , jobcnt_error);
+  writer->printf(
+    "    SDO bytes read: %u\n"
+    "    SDO bytes sent: %u\n"
+    "    - block xfers : %u (%u refused)\n"
+    "    - throughput  : %u bytes/s (%u ms busy)\n"
+    "    Frames sent   : %u\n"
+    "    Frames recvd  : %u (%u dropped)\n"
+    "    NMT received  : %u\n"
+    "    EMCY received : %u\n"
+    , rxbytes
+    , txbytes
+    , blkcnt, blkfallback
+    , rate, busy_ms
+    , txcnt
+    , rxcnt, rxdrop
     , m_nmt_rxcnt
     , m_emcy_rxcnt);
   }
@@ -185,7 +253,7 @@ CANopenNodeMetrics *CANopenWorker::GetNodeMetrics(uint8_t nodeid)
 
 
 /**
- * SubmitJob: post a new job to the JobTask queue
+ * SubmitJob: post a new job to the job queue
  */
 CANopenResult_t CANopenWorker::SubmitJob(CANopenJob& job, TickType_t maxqueuewait /*=0*/)
   {
@@ -198,101 +266,109 @@ CANopenResult_t CANopenWorker::SubmitJob(CANopenJob& job, TickType_t maxqueuewai
 
 
 /**
- * JobTask: process CANopenJobs, send results back to clients
+ * IsBusy: check if a lane is processing a job for the response ID
+ *   - call with m_mutex held
  */
-
-static void CANopenWorkerJobTask(void *pvParameters)
+bool CANopenWorker::IsBusy(uint16_t rxid)
   {
-  CANopenWorker *me = (CANopenWorker*)pvParameters;
-  me->JobTask();
+  if (rxid == 0)
+    return false;
+  for (int i=0; i < m_lanecnt; i++)
+    {
+    if (m_lane[i]->m_rxid == rxid)
+      return true;
+    }
+  return false;
   }
 
-void CANopenWorker::JobTask()
+
+/**
+ * FetchJob: assign the next job to a lane
+ *   - returns false if no job could be assigned (retry)
+ * 
+ * Dispatch rules:
+ *   - only one job per response ID (node) is active at a time, so responses
+ *     can be routed to the lane unambiguously
+ *   - a job for a busy node is deferred, deferred jobs are taken first
+ *     in submission order as soon as their node is free, so jobs for a node
+ *     are always executed in submission order
+ *   - the lane finishing a job checks the deferred list before waiting for
+ *     new jobs, so deferred jobs cannot get stuck
+ */
+bool CANopenWorker::FetchJob(CANopenWorkerLane* lane)
   {
-  while(1)
+  CANopenJob job;
+  
+  // take first deferred job for a free node:
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
+  for (auto it = m_deferred.begin(); it != m_deferred.end(); it++)
     {
-    // get next job:
-    if (xQueueReceive(m_jobqueue, &m_job, (portTickType)portMAX_DELAY) == pdTRUE)
+    if (!IsBusy(it->rxid))
       {
-        // check client:
-        if (!IsClient(m_job.client))
-          {
-          ESP_LOGW(TAG, "Job dropped: Client vanished");
-          continue;
-          }
-        
-        // process job:
-        switch (m_job.type)
-          {
-          case COJT_None:
-            m_job.result = COR_OK;
-            break;
-          case COJT_SendNMT:
-            ESP_LOGV(TAG, "SendNMT: %s node=%d, command=%d", m_bus->GetName(), m_job.nmt.nodeid, m_job.nmt.command);
-            m_job.result = ProcessSendNMTJob();
-            ESP_LOGV(TAG, "SendNMT result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_ReceiveHB:
-            ESP_LOGV(TAG, "ReceiveHB: %s node=%d", m_bus->GetName(), m_job.hb.nodeid);
-            m_job.result = ProcessReceiveHBJob();
-            ESP_LOGV(TAG, "ReceiveHB result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_ReadSDO:
-            ESP_LOGV(TAG, "ReadSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
-            m_job.result = ProcessReadSDOJob();
-            ESP_LOGV(TAG, "ReadSDO result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_WriteSDO:
-            ESP_LOGV(TAG, "WriteSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
-            m_job.result = ProcessWriteSDOJob();
-            ESP_LOGV(TAG, "WriteSDO result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          default:
-            ESP_LOGW(TAG, "Unknown job type: %d", (int)m_job.type);
-            m_job.result = COR_ERR_UnknownJobType;
-          }
-        
-        // return job to client if still valid:
-        if (!IsClient(m_job.client))
-          {
-          ESP_LOGW(TAG, "Job result lost: Client vanished");
-          }
-        else
-          {
-          if (m_job.client->SubmitDoneCallback(m_job, 0) != COR_OK)
-            ESP_LOGW(TAG, "Job result lost: Client queue is full");
-          }
-        
-        // statistics:
-        m_jobcnt++;
-        if (m_job.result == COR_ERR_Timeout)
-          m_jobcnt_timeout++;
-        else if (m_job.result != COR_OK)
-          m_jobcnt_error++;
-        
-        m_job.type = COJT_None;
+      lane->m_job = *it;
+      lane->m_rxid = it->rxid;
+      m_deferred.erase(it);
+      xSemaphoreGive(m_mutex);
+      return true;
       }
     }
+  xSemaphoreGive(m_mutex);
+  
+  // wait for next new job:
+  if (xQueueReceive(m_jobqueue, &job, (portTickType)portMAX_DELAY) != pdTRUE)
+    return false;
+  
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
+  bool defer = IsBusy(job.rxid);
+  if (!defer && job.rxid)
+    {
+    for (auto& d : m_deferred)
+      {
+      if (d.rxid == job.rxid)
+        {
+        defer = true;
+        break;
+        }
+      }
+    }
+  if (defer)
+    {
+    m_deferred.push_back(job);
+    }
+  else
+    {
+    lane->m_job = job;
+    lane->m_rxid = job.rxid;
+    }
+  xSemaphoreGive(m_mutex);
+  return !defer;
+  }
+
+
+/**
+ * ReleaseJob: free the node of the lane's current job
+ */
+void CANopenWorker::ReleaseJob(CANopenWorkerLane* lane)
+  {
+  xSemaphoreTake(m_mutex, portMAX_DELAY);
+  lane->m_rxid = 0;
+  xSemaphoreGive(m_mutex);
   }
 
 
 /**
- * IncomingFrame: process EMCY and Heartbeat messages, forward job frames to job task
+ * IncomingFrame: process EMCY and Heartbeat messages, forward job frames to job lanes
  */
 void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
   {
-  // Message matching our current job?
-  if (m_job.type != COJT_None && p_frame->MsgID == m_job.rxid)
-    {
-    // copy payload into m_response:
-    int i;
-    for (i=0; i < p_frame->FIR.B.DLC; i++)
-      m_response.byte[i] = p_frame->data.u8[i];
-    for (; i < 8; i++)
-      m_response.byte[i] = 0;
-    
-    // signal job task:
-    xTaskNotifyGive(m_jobtask);
+  // Message matching a current job?
+  for (int i=0; i < m_lanecnt; i++)
+    {
+    if (m_lane[i]->m_rxid == p_frame->MsgID)
+      {
+      m_lane[i]->QueueResponse(p_frame);
+      break;
+      }
     }
   
   
@@ -349,6 +425,171 @@ void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
   } // IncomingFrame()
 
 
+/**
+ * A CANopenWorkerLane executes the jobs assigned by its worker, one at a time.
+ * 
+ * Response frames for the current job are queued by the worker, so bursts
+ * of block transfer segments are not lost while the lane is busy.
+ */
+
+CANopenWorkerLane::CANopenWorkerLane(CANopenWorker* worker, int id)
+  {
+  m_worker = worker;
+  m_bus = worker->m_bus;
+  m_id = id;
+  
+  m_rxid = 0;
+  
+  m_jobcnt = 0;
+  m_jobcnt_timeout = 0;
+  m_jobcnt_error = 0;
+  m_txcnt = 0;
+  m_rxcnt = 0;
+  m_rxdrop = 0;
+  m_sdo_rxbytes = 0;
+  m_sdo_txbytes = 0;
+  m_blkcnt = 0;
+  m_blkfallback = 0;
+  m_busytime = 0;
+  
+  memset(&m_job, 0, sizeof(m_job));
+  m_job.type = COJT_None;
+  
+  memset(&m_request, 0, sizeof(m_request));
+  memset(&m_response, 0, sizeof(m_response));
+  
+  m_rxqueue = xQueueCreate(CANOPEN_LANE_RXQUEUE, sizeof(CANopenFrame_t));
+  snprintf(m_taskname, sizeof(m_taskname), "OVMS CO%s.%d", m_bus->GetName(), id);
+  xTaskCreatePinnedToCore(CANopenWorkerLaneTask, m_taskname,
+    CONFIG_OVMS_COMP_CANOPEN_WRK_STACK, (void*)this, 15, &m_jobtask, CORE(0));
+  }
+
+CANopenWorkerLane::~CANopenWorkerLane()
+  {
+  vTaskDelete(m_jobtask);
+  vQueueDelete(m_rxqueue);
+  }
+
+
+/**
+ * QueueResponse: forward a frame to the job (called by the worker's IncomingFrame)
+ */
+bool CANopenWorkerLane::QueueResponse(CAN_frame_t* p_frame)
+  {
+  CANopenFrame_t frame;
+  int i;
+  for (i=0; i < p_frame->FIR.B.DLC && i < 8; i++)
+    frame.byte[i] = p_frame->data.u8[i];
+  for (; i < 8; i++)
+    frame.byte[i] = 0;
+  
+  if (xQueueSend(m_rxqueue, &frame, 0) != pdTRUE)
+    {
+    m_rxdrop++;
+    return false;
+    }
+  return true;
+  }
+
+
+/**
+ * JobTask: process CANopenJobs, send results back to clients
+ */
+
+static void CANopenWorkerLaneTask(void *pvParameters)
+  {
+  CANopenWorkerLane *me = (CANopenWorkerLane*)pvParameters;
+  me->JobTask();
+  }
+
+void CANopenWorkerLane::JobTask()
+  {
+  while(1)
+    {
+    // get next job:
+    if (!m_worker->FetchJob(this))
+      continue;
+    
+    // check client:
+    if (!m_worker->IsClient(m_job.client))
+      {
+      ESP_LOGW(TAG, "Job dropped: Client vanished");
+      m_worker->ReleaseJob(this);
+      m_job.type = COJT_None;
+      continue;
+      }
+    
+    // process job:
+    int64_t started = esp_timer_get_time();
+    ProcessJob();
+    m_busytime += esp_timer_get_time() - started;
+    m_worker->ReleaseJob(this);
+    
+    // return job to client if still valid:
+    if (!m_worker->IsClient(m_job.client))
+      {
+      ESP_LOGW(TAG, "Job result lost: Client vanished");
+      }
+    else
+      {
+      if (m_job.client->SubmitDoneCallback(m_job, 0) != COR_OK)
+        ESP_LOGW(TAG, "Job result lost: Client queue is full");
+      }
+    
+    // statistics:
+    m_jobcnt++;
+    if (m_job.result == COR_ERR_Timeout)
+      m_jobcnt_timeout++;
+    else if (m_job.result != COR_OK)
+      m_jobcnt_error++;
+    
+    m_job.type = COJT_None;
+    }
+  }
+
+
+/**
+ * ProcessJob: execute the current job
+ */
+void CANopenWorkerLane::ProcessJob()
+  {
+  // discard responses left over from the previous job:
+  xQueueReset(m_rxqueue);
+  
+  switch (m_job.type)
+    {
+    case COJT_None:
+      m_job.result = COR_OK;
+      break;
+    case COJT_SendNMT:
+      ESP_LOGV(TAG, "SendNMT: %s node=%d, command=%d", m_bus->GetName(), m_job.nmt.nodeid, m_job.nmt.command);
+      m_job.result = ProcessSendNMTJob();
+      ESP_LOGV(TAG, "SendNMT result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    case COJT_ReceiveHB:
+      ESP_LOGV(TAG, "ReceiveHB: %s node=%d", m_bus->GetName(), m_job.hb.nodeid);
+      m_job.result = ProcessReceiveHBJob();
+      ESP_LOGV(TAG, "ReceiveHB result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    case COJT_ReadSDO:
+      ESP_LOGV(TAG, "ReadSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+      m_job.result = ProcessReadSDOJob();
+      m_sdo_rxbytes += m_job.sdo.xfersize;
+      ESP_LOGV(TAG, "ReadSDO result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    case COJT_WriteSDO:
+      ESP_LOGV(TAG, "WriteSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+      m_job.result = ProcessWriteSDOJob();
+      m_sdo_txbytes += m_job.sdo.xfersize;
+      ESP_LOGV(TAG, "WriteSDO result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    default:
+      ESP_LOGW(TAG, "Unknown job type: %d", (int)m_job.type);
+      m_job.result = COR_ERR_UnknownJobType;
+    }
+  }
+
+
 /**
  * ProcessSendNMTJob: send NMT request and optionally wait for NMT state change
  *  a.k.a. heartbeat message.
@@ -359,7 +600,7 @@ void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
  *  even though the state has in fact changed -- there's no way to know
  *  if the node doesn't tell.
  */
-CANopenResult_t CANopenWorker::ProcessSendNMTJob()
+CANopenResult_t CANopenWorkerLane::ProcessSendNMTJob()
   {
   // check bus:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -387,13 +628,14 @@ CANopenResult_t CANopenWorker::ProcessSendNMTJob()
     // send request:
     m_job.trycnt++;
     txframe.Write();
+    m_txcnt++;
     
     // immediate return?
     if (m_job.rxid == 0)
       return COR_OK;
     
-    // wait for response signal from IncomingFrame():
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    // wait for response from IncomingFrame():
+    if (ReceiveSDOResponse(maxwait))
       {
       // expected response for command?
       if ( (m_job.nmt.command == CONC_Start      && m_response.hb.state >= 5)
@@ -421,7 +663,7 @@ CANopenResult_t CANopenWorker::ProcessSendNMTJob()
  * Use this to read the current state or synchronize to the heartbeat.
  * Note: heartbeats are optional in CANopen.
  */
-CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
+CANopenResult_t CANopenWorkerLane::ProcessReceiveHBJob()
   {
   // check parameters:
   if (m_job.hb.nodeid < 1 || m_job.hb.nodeid > 127)
@@ -433,8 +675,8 @@ CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
     {
     m_job.trycnt++;
     
-    // wait for receive signal from IncomingFrame():
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    // wait for frame from IncomingFrame():
+    if (ReceiveSDOResponse(maxwait))
       {
       // return state received:
       m_job.hb.state = (CANopenNMTState_t) m_response.hb.state;
@@ -456,7 +698,7 @@ CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
 /**
  * SendSDORequest: asynchronous tx of prepared CANopen SDO request
  */
-void CANopenWorker::SendSDORequest()
+void CANopenWorkerLane::SendSDORequest()
   {
   // init tx frame:
   CAN_frame_t txframe;
@@ -471,33 +713,46 @@ void CANopenWorker::SendSDORequest()
   
   // send:
   txframe.Write();
+  m_txcnt++;
   }
 
 
 /**
  * AbortSDORequest: send SDO abort command
  */
-void CANopenWorker::AbortSDORequest(uint32_t reason)
+void CANopenWorkerLane::AbortSDORequest(uint32_t reason)
   {
   // backup request:
-  uint8_t control = m_request.ctl.control;
-  uint32_t data = m_request.ctl.data;
+  CANopenFrame_t request = m_request;
   
   // send abort:
   m_request.ctl.control = SDO_Abort;
+  m_request.ctl.index = m_job.sdo.index;
+  m_request.ctl.subindex = m_job.sdo.subindex;
   m_request.ctl.data = reason;
   SendSDORequest();
   
   // restore request:
-  m_request.ctl.control = control;
-  m_request.ctl.data = data;
+  m_request = request;
+  }
+
+
+/**
+ * ReceiveSDOResponse: wait for the next response frame
+ */
+bool CANopenWorkerLane::ReceiveSDOResponse(TickType_t maxwait)
+  {
+  if (xQueueReceive(m_rxqueue, &m_response, maxwait) != pdTRUE)
+    return false;
+  m_rxcnt++;
+  return true;
   }
 
 
 /**
  * ExecuteSDORequest: send SDO request and wait for response
  */
-CANopenResult_t CANopenWorker::ExecuteSDORequest()
+CANopenResult_t CANopenWorkerLane::ExecuteSDORequest()
   {
   TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
   m_job.trycnt = 0;
@@ -506,10 +761,11 @@ CANopenResult_t CANopenWorker::ExecuteSDORequest()
     {
     // send request:
     m_job.trycnt++;
+    xQueueReset(m_rxqueue);
     SendSDORequest();
 
     // wait for reply:
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    if (ReceiveSDOResponse(maxwait))
       return COR_OK;
 
     // timeout:
@@ -530,12 +786,14 @@ CANopenResult_t CANopenWorker::ExecuteSDORequest()
  *   - remaining buffer space will be zeroed
  *   - on result COR_ERR_BufferTooSmall, the buffer has been filled up to m_job.sdo.bufsize
  *   - on abort, the CANopen error code will be written into m_job.sdo.error
+ *   - buffers from CANOPEN_SDO_BLOCK_MINSIZE bytes are read by block upload
+ *     if the server supports it
  * 
  * Note: result interpretation is up to caller (check device object dictionary for data types & sizes).
  *   As CANopen is little endian as ESP32, we don't need to check lengths on numerical results,
  *   i.e. anything from int8_t to uint32_t can simply be read into a uint32_t buffer.
  */
-CANopenResult_t CANopenWorker::ProcessReadSDOJob()
+CANopenResult_t CANopenWorkerLane::ProcessReadSDOJob()
   {
   // check for CAN write access:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -554,6 +812,14 @@ CANopenResult_t CANopenWorker::ProcessReadSDOJob()
   uint8_t *buf = m_job.sdo.buf;
   m_job.sdo.xfersize = 0;
   
+  // try block upload:
+  if (m_job.sdo.bufsize >= CANOPEN_SDO_BLOCK_MINSIZE && !m_worker->m_noblock[m_job.sdo.nodeid])
+    {
+    CANopenResult_t res = ProcessReadSDOBlock();
+    if (res != COR_WAIT)
+      return res;
+    }
+  
   // request upload:
   memset(&m_request, 0, sizeof(m_request));
   m_request.exp.index = m_job.sdo.index;
@@ -655,18 +921,212 @@ CANopenResult_t CANopenWorker::ProcessReadSDOJob()
   }
 
 
+/**
+ * ProcessReadSDOBlock: read bytes from SDO server by block upload (CiA 301)
+ *   - the server sends up to CANOPEN_SDO_BLOCK_SIZE segments per block,
+ *     lost segments are requested again by the block acknowledge
+ *   - data is verified by CRC if the server supports it
+ *   - returns COR_WAIT if the server refused or ignored the block upload,
+ *     the caller shall fall back to a standard upload then
+ */
+CANopenResult_t CANopenWorkerLane::ProcessReadSDOBlock()
+  {
+  TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
+  uint8_t *buf = m_job.sdo.buf;
+  size_t bufsize = m_job.sdo.bufsize;
+  size_t rxsize = 0;      // bytes received in sequence, including padding of the last segment
+  uint8_t seqno, ackseq, n;
+  bool server_crc, last;
+  
+  // initiate block upload:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.exp.index = m_job.sdo.index;
+  m_request.exp.subindex = m_job.sdo.subindex;
+  m_request.exp.control = SDO_BlockUploadInit | SDO_BlockCRC;
+  m_request.exp.data[0] = CANOPEN_SDO_BLOCK_SIZE;
+  m_request.exp.data[1] = 0; // no protocol switch
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    // no response: the node may ignore block commands, fall back & don't try again:
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: no response to block upload init, falling back",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+    m_worker->m_noblock[m_job.sdo.nodeid] = true;
+    m_blkfallback++;
+    return COR_WAIT;
+    }
+  
+  // check response:
+  if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort)
+    {
+    // block transfer not supported / not possible for this object:
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: block upload refused, CANopen error code 0x%08x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_response.ctl.data);
+    if (m_response.ctl.data == SDO_Abort_CommandInvalid)
+      m_worker->m_noblock[m_job.sdo.nodeid] = true;
+    m_blkfallback++;
+    return COR_WAIT;
+    }
+  if ((m_response.exp.control & SDO_BlockUploadInitMask) != SDO_BlockUploadInitResponse
+    || m_response.exp.index != m_request.exp.index
+    || m_response.exp.subindex != m_request.exp.subindex)
+    {
+    m_job.sdo.error = CANopen_BusCollision;
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: InitBlockUpload failed, CANopen error code 0x%08x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return COR_ERR_SDO_Access;
+    }
+  
+  server_crc = (m_response.exp.control & SDO_BlockCRC);
+  if (m_response.exp.control & SDO_BlockSizeIndicated)
+    m_job.sdo.contsize = m_response.ctl.data;
+  else
+    m_job.sdo.contsize = 0; // unknown size
+  
+  // start upload:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.ack.control = SDO_BlockUploadStart;
+  SendSDORequest();
+  
+  // receive blocks:
+  ackseq = 0;
+  last = false;
+  m_job.trycnt = 1;
+  do
+    {
+    if (!ReceiveSDOResponse(maxwait))
+      {
+      if (m_job.trycnt >= m_job.maxtries)
+        {
+        AbortSDORequest(SDO_Abort_Timeout);
+        m_job.sdo.error = SDO_Abort_Timeout;
+        m_job.sdo.xfersize = MIN(rxsize, bufsize);
+        return COR_ERR_Timeout;
+        }
+      // end of block lost, acknowledge segments received so far:
+      m_job.trycnt++;
+      m_request.ack.control = SDO_BlockUploadAck;
+      m_request.ack.ackseq = ackseq;
+      m_request.ack.blksize = CANOPEN_SDO_BLOCK_SIZE;
+      SendSDORequest();
+      ackseq = 0;
+      continue;
+      }
+    
+    if (m_response.seg.control == SDO_Abort)
+      {
+      m_job.sdo.error = m_response.ctl.data;
+      m_job.sdo.xfersize = MIN(rxsize, bufsize);
+      ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: block upload aborted, CANopen error code 0x%08x",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+      return COR_ERR_SDO_Access;
+      }
+    
+    seqno = m_response.seg.control & SDO_BlockSeqnoMask;
+    if (seqno == ackseq + 1)
+      {
+      // segment in sequence, copy data to buffer:
+      ackseq = seqno;
+      for (n = 0; n < 7; n++, rxsize++)
+        {
+        if (rxsize < bufsize)
+          buf[rxsize] = m_response.seg.data[n];
+        }
+      last = (m_response.seg.control & SDO_BlockSegmentLast);
+      if (!last && rxsize > bufsize)
+        {
+        ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: buffer too small, readlen=%d",
+          m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, bufsize);
+        AbortSDORequest(SDO_Abort_OutOfMemory);
+        m_job.sdo.error = SDO_Abort_OutOfMemory;
+        m_job.sdo.xfersize = bufsize;
+        return COR_ERR_BufferTooSmall;
+        }
+      }
+    // else: segment lost, skip to end of block → server repeats from ackseq+1
+    
+    if ((m_response.seg.control & SDO_BlockSegmentLast) || seqno >= CANOPEN_SDO_BLOCK_SIZE)
+      {
+      // end of block, acknowledge:
+      m_request.ack.control = SDO_BlockUploadAck;
+      m_request.ack.ackseq = ackseq;
+      m_request.ack.blksize = CANOPEN_SDO_BLOCK_SIZE;
+      SendSDORequest();
+      ackseq = 0;
+      m_job.trycnt = 1;
+      }
+    
+    } while (!last);
+  
+  // receive end of upload:
+  if (!ReceiveSDOResponse(maxwait))
+    {
+    AbortSDORequest(SDO_Abort_Timeout);
+    m_job.sdo.error = SDO_Abort_Timeout;
+    m_job.sdo.xfersize = MIN(rxsize, bufsize);
+    return COR_ERR_Timeout;
+    }
+  if ((m_response.end.control & SDO_BlockCommandMask) != SDO_BlockUploadEnd)
+    {
+    if (m_response.ctl.control == SDO_Abort)
+      m_job.sdo.error = m_response.ctl.data;
+    else
+      m_job.sdo.error = CANopen_BusCollision;
+    m_job.sdo.xfersize = MIN(rxsize, bufsize);
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: EndBlockUpload failed, CANopen error code 0x%08x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return COR_ERR_SDO_Access;
+    }
+  
+  n = (m_response.end.control & SDO_BlockUnusedMask) >> 2;
+  rxsize = (rxsize > n) ? rxsize - n : 0;
+  if (rxsize > bufsize)
+    {
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: buffer too small, readlen=%d",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, bufsize);
+    AbortSDORequest(SDO_Abort_OutOfMemory);
+    m_job.sdo.error = SDO_Abort_OutOfMemory;
+    m_job.sdo.xfersize = bufsize;
+    return COR_ERR_BufferTooSmall;
+    }
+  
+  // clear padding of last segment:
+  m_job.sdo.xfersize = rxsize;
+  memset(buf + rxsize, 0, MIN(bufsize - rxsize, (size_t)n));
+  
+  // verify data:
+  if (server_crc && crc16_ccitt(0, buf, rxsize) != m_response.end.crc)
+    {
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: block CRC mismatch, readlen=%d",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+    AbortSDORequest(SDO_Abort_CRCError);
+    m_job.sdo.error = SDO_Abort_CRCError;
+    return COR_ERR_SDO_CRCError;
+    }
+  
+  // confirm:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.ack.control = SDO_BlockUploadEndResponse;
+  SendSDORequest();
+  
+  m_blkcnt++;
+  return COR_OK;
+  }
+
+
 /**
  * ProcessWriteSDOJob: write bytes from buffer into SDO server
  *   - sends m_job.sdo.bufsize bytes from m_job.sdo.buf
  *   - … or 4 bytes from m_job.sdo.buf if bufsize is 0 (use for integer SDOs of unknown type)
  *   - returns data length sent in m_job.sdo.xfersize
  *   - on abort, the CANopen error code will be written into m_job.sdo.error
+ *   - buffers from CANOPEN_SDO_BLOCK_MINSIZE bytes are sent by block download
+ *     if the server supports it
  * 
  * Note: the caller needs to know data type & size of the SDO register (check device object dictionary).
  *   As CANopen servers normally are intelligent, anything from int8_t to uint32_t can simply be
  *   sent as a uint32_t with bufsize=0, the server will know how to convert it.
  */
-CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
+CANopenResult_t CANopenWorkerLane::ProcessWriteSDOJob()
   {
   // check for CAN write access:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -684,6 +1144,14 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
   uint8_t *buf = m_job.sdo.buf;
   m_job.sdo.xfersize = 0;
   
+  // try block download:
+  if (m_job.sdo.bufsize >= CANOPEN_SDO_BLOCK_MINSIZE && !m_worker->m_noblock[m_job.sdo.nodeid])
+    {
+    CANopenResult_t res = ProcessWriteSDOBlock();
+    if (res != COR_WAIT)
+      return res;
+    }
+  
   // request download:
   memset(&m_request, 0, sizeof(m_request));
   m_request.exp.index = m_job.sdo.index;
@@ -777,3 +1245,160 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
   }
 
 
+/**
+ * ProcessWriteSDOBlock: write bytes into SDO server by block download (CiA 301)
+ *   - sends blocks of the size requested by the server without waiting
+ *     for single segment responses
+ *   - segments not acknowledged by the server are repeated in the next block
+ *   - a missing acknowledge aborts the transfer, as do more than
+ *     CANOPEN_SDO_BLOCK_RETRIES blocks in a row without progress
+ *   - data is verified by CRC if the server supports it
+ *   - returns COR_WAIT if the server refused or ignored the block download,
+ *     the caller shall fall back to a standard download then
+ */
+CANopenResult_t CANopenWorkerLane::ProcessWriteSDOBlock()
+  {
+  TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
+  uint8_t *buf = m_job.sdo.buf;
+  size_t bufsize = m_job.sdo.bufsize;
+  size_t blkstart = 0, pos;
+  uint8_t blksize, seqno, ackseq, n;
+  int retries = 0;
+  bool server_crc;
+  
+  // initiate block download:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.exp.index = m_job.sdo.index;
+  m_request.exp.subindex = m_job.sdo.subindex;
+  m_request.exp.control = SDO_BlockDownloadInit | SDO_BlockCRC | SDO_BlockSizeIndicated;
+  m_request.ctl.data = bufsize;
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    // no response: the node may ignore block commands, fall back & don't try again:
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: no response to block download init, falling back",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+    m_worker->m_noblock[m_job.sdo.nodeid] = true;
+    m_blkfallback++;
+    return COR_WAIT;
+    }
+  
+  // check response:
+  if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort)
+    {
+    // block transfer not supported / not possible for this object:
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: block download refused, CANopen error code 0x%08x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_response.ctl.data);
+    if (m_response.ctl.data == SDO_Abort_CommandInvalid)
+      m_worker->m_noblock[m_job.sdo.nodeid] = true;
+    m_blkfallback++;
+    return COR_WAIT;
+    }
+  if ((m_response.exp.control & SDO_BlockCommandMask) != SDO_BlockDownloadInitResponse
+    || m_response.exp.index != m_request.exp.index
+    || m_response.exp.subindex != m_request.exp.subindex)
+    {
+    m_job.sdo.error = CANopen_BusCollision;
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: InitBlockDownload failed, CANopen error code 0x%08x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return COR_ERR_SDO_Access;
+    }
+  
+  server_crc = (m_response.exp.control & SDO_BlockCRC);
+  blksize = m_response.exp.data[0];
+  
+  // send blocks:
+  do
+    {
+    if (blksize < 1 || blksize > 127)
+      {
+      AbortSDORequest(SDO_Abort_BlockSize);
+      m_job.sdo.error = SDO_Abort_BlockSize;
+      return COR_ERR_SDO_Access;
+      }
+    
+    // send segments:
+    xQueueReset(m_rxqueue);
+    memset(&m_request, 0, sizeof(m_request));
+    for (seqno = 0, pos = blkstart; seqno < blksize && pos < bufsize; )
+      {
+      for (n = 0; n < 7 && pos < bufsize; n++, pos++)
+        m_request.seg.data[n] = buf[pos];
+      for (; n < 7; n++)
+        m_request.seg.data[n] = 0;
+      m_request.seg.control = ++seqno;
+      if (pos == bufsize)
+        m_request.seg.control |= SDO_BlockSegmentLast;
+      SendSDORequest();
+      }
+    
+    // wait for acknowledge:
+    if (!ReceiveSDOResponse(maxwait))
+      {
+      // the server may have advanced already, so we cannot repeat the block:
+      AbortSDORequest(SDO_Abort_Timeout);
+      m_job.sdo.error = SDO_Abort_Timeout;
+      return COR_ERR_Timeout;
+      }
+    
+    if ((m_response.ack.control & SDO_BlockCommandMask) != SDO_BlockDownloadAck)
+      {
+      if (m_response.ctl.control == SDO_Abort)
+        m_job.sdo.error = m_response.ctl.data;
+      else
+        m_job.sdo.error = CANopen_BusCollision;
+      ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: block download failed, CANopen error code 0x%08x",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+      return COR_ERR_SDO_Access;
+      }
+    
+    ackseq = m_response.ack.ackseq;
+    if (ackseq > seqno)
+      {
+      AbortSDORequest(SDO_Abort_SeqNo);
+      m_job.sdo.error = SDO_Abort_SeqNo;
+      return COR_ERR_SDO_SegMismatch;
+      }
+    if (ackseq == 0 && ++retries > CANOPEN_SDO_BLOCK_RETRIES)
+      {
+      // the server keeps rejecting the block:
+      AbortSDORequest(SDO_Abort_SeqNo);
+      m_job.sdo.error = SDO_Abort_SeqNo;
+      return COR_ERR_SDO_SegMismatch;
+      }
+    else if (ackseq > 0)
+      {
+      retries = 0;
+      }
+    
+    // continue after last segment received:
+    blkstart = MIN(blkstart + ackseq * 7, bufsize);
+    blksize = m_response.ack.blksize;
+    m_job.sdo.xfersize = blkstart;
+    
+    } while (blkstart < bufsize);
+  
+  // end download:
+  n = (7 - bufsize % 7) % 7;
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.end.control = SDO_BlockDownloadEnd | (n << 2);
+  if (server_crc)
+    m_request.end.crc = crc16_ccitt(0, buf, bufsize);
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    m_job.sdo.error = SDO_Abort_Timeout;
+    return COR_ERR_Timeout;
+    }
+  if ((m_response.ack.control & SDO_BlockCommandMask) != SDO_BlockDownloadEndResponse)
+    {
+    if (m_response.ctl.control == SDO_Abort)
+      m_job.sdo.error = m_response.ctl.data;
+    else
+      m_job.sdo.error = CANopen_BusCollision;
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: EndBlockDownload failed, CANopen error code 0x%08x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return (m_job.sdo.error == SDO_Abort_CRCError) ? COR_ERR_SDO_CRCError : COR_ERR_SDO_Access;
+    }
+  
+  m_blkcnt++;
+  return COR_OK;
+  }
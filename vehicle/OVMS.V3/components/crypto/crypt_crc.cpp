@@ -51,3 +51,26 @@ uint16_t crc16(const char *data, size_t length)
   return crc;
   }
 
+/**
+ * crc16_ccitt: CRC-16-CCITT (XMODEM), polynomial 0x1021, as used by
+ *  CANopen SDO block transfers. Pass 0 as the initial crc, or the result
+ *  of the previous call to continue a running checksum.
+ */
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, size_t length)
+  {
+  while (length>0)
+    {
+    crc ^= (uint16_t)*data++ << 8;
+    length--;
+
+    for (int k = 0; k < 8; ++k)
+      {
+      if (crc & 0x8000)
+        crc = (crc << 1) ^ 0x1021;
+      else
+        crc = (crc << 1);
+      }
+    }
+
+  return crc;
+  }
@@ -35,5 +35,6 @@
 #include <unistd.h>
 
 uint16_t crc16(const char *data, size_t length);
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, size_t length);
 
 #endif //#ifndef __CRYPT_CRC_H__
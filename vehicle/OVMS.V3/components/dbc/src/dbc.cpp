@@ -943,6 +943,10 @@ dbcMessage::dbcMessage()
   m_id = 0;
   m_size = 0;
   m_multiplexor = NULL;
+  m_plan_muxed = 0;
+  m_plan_mux = false;
+  m_plan_be = false;
+  m_plan_valid = false;
   }
 
 dbcMessage::dbcMessage(uint32_t id)
@@ -950,6 +954,10 @@ dbcMessage::dbcMessage(uint32_t id)
   m_size = 0;
   m_multiplexor = NULL;
   m_id = id;
+  m_plan_muxed = 0;
+  m_plan_mux = false;
+  m_plan_be = false;
+  m_plan_valid = false;
   }
 
 dbcMessage::~dbcMessage()
@@ -979,16 +987,20 @@ bool dbcMessage::HasComment(const std::string& comment)
 void dbcMessage::AddSignal(dbcSignal* signal)
   {
   m_signals.push_back(signal);
+  m_plan_valid = false;
   }
 
 void dbcMessage::RemoveSignal(dbcSignal* signal, bool free)
   {
   m_signals.remove(signal);
+  m_plan_valid = false;
   if (free) delete signal;
   }
 
 void dbcMessage::RemoveAllSignals(bool free)
   {
+  m_plan.clear();
+  m_plan_valid = false;
   for (dbcSignal* signal : m_signals)
     {
     if (free) delete signal;
@@ -1101,6 +1113,278 @@ void dbcMessage::SetMultiplexorSignal(dbcSignal* signal)
     }
   }
 
+/**
+ * Compile: build the decode plan for this message
+ *
+ * The plan holds one step per signal with the bit position resolved into a
+ * shift & mask on the 64 bit frame word (byte swapped for big endian signals)
+ * and the factor/offset scaling reduced to the arithmetic dbcSignal::Decode()
+ * would do for the signal's number types. Decoding a frame then needs no
+ * per bit loops and no dbcNumber type dispatching.
+ *
+ * Step order: multiplexor, plain signals, multiplexed signals sorted by
+ * switch value (so the active ones can be found by binary search).
+ *
+ * Signals not representable this way (bits outside the 8 byte frame or
+ * undefined factor/offset) fall back to dbcSignal::Decode().
+ */
+static bool dbc_plan_switch_less(const dbcDecodeStep_t& a, const dbcDecodeStep_t& b)
+  {
+  return a.switchvalue < b.switchvalue;
+  }
+
+void dbcMessage::Compile()
+  {
+  m_plan.clear();
+  m_plan.reserve(m_signals.size());
+  m_plan_muxed = 0;
+  m_plan_mux = false;
+  m_plan_be = false;
+
+  dbcDecodePlan_t muxed;
+  for (dbcSignal* signal : m_signals)
+    {
+    dbcDecodeStep_t step;
+    memset(&step, 0, sizeof(step));
+    step.signal = signal;
+
+    int start = signal->GetStartBit();
+    int size = signal->GetSignalSize();
+    int shift;
+    if (signal->GetByteOrder() == DBC_BYTEORDER_BIG_ENDIAN)
+      {
+      step.flags |= DBC_PLAN_BIGENDIAN;
+      shift = 56 - (start/8)*8 + (start%8) - (size-1);
+      }
+    else
+      {
+      shift = start;
+      }
+    if (size < 1 || size > 64 || shift < 0 || shift+size > 64)
+      {
+      step.flags |= DBC_PLAN_FALLBACK;
+      }
+    else
+      {
+      step.shift = shift;
+      step.mask = (size >= 64) ? UINT64_MAX : ((1ULL << size) - 1);
+      if (step.flags & DBC_PLAN_BIGENDIAN) m_plan_be = true;
+      }
+
+    // Reduce the factor/offset arithmetic of dbcSignal::Decode() by operand types.
+    // Note: dbcNumber::Set(double) normalizes integral values to integers, so
+    // floating point results need to be passed through Set().
+    if (signal->GetValueType() == DBC_VALUETYPE_SIGNED)
+      step.flags |= DBC_PLAN_SIGNED;
+    dbcNumber factor = signal->GetFactor();
+    dbcNumber offset = signal->GetOffset();
+    bool mul = !(factor == 1);
+    bool add = !(offset == 0);
+    dbcNumberType_t type = (step.flags & DBC_PLAN_SIGNED)
+      ? DBC_NUMBER_INTEGER_SIGNED : DBC_NUMBER_INTEGER_UNSIGNED;
+    step.ifactor = 1;
+    if ((mul && !factor.IsDefined()) || (add && !offset.IsDefined()))
+      {
+      step.flags |= DBC_PLAN_FALLBACK;
+      }
+    else if (mul && factor.IsDouble())
+      {
+      step.flags |= DBC_PLAN_MULDOUBLE;
+      step.dfactor = factor.GetDouble();
+      if (add && !offset.IsDouble())
+        {
+        step.flags |= DBC_PLAN_ADDINT;
+        step.type = offset.IsSignedInteger() ? DBC_NUMBER_INTEGER_SIGNED : DBC_NUMBER_INTEGER_UNSIGNED;
+        step.ioffset = offset.GetUnsignedInteger();
+        }
+      else
+        {
+        step.flags |= DBC_PLAN_DOUBLE;
+        step.doffset = add ? offset.GetDouble() : 0;
+        }
+      }
+    else
+      {
+      if (mul)
+        {
+        step.ifactor = factor.GetUnsignedInteger();
+        type = factor.IsSignedInteger() ? DBC_NUMBER_INTEGER_SIGNED : DBC_NUMBER_INTEGER_UNSIGNED;
+        }
+      if (type == DBC_NUMBER_INTEGER_SIGNED)
+        step.flags |= DBC_PLAN_MULSIGNED;
+      if (add && offset.IsDouble())
+        {
+        step.flags |= DBC_PLAN_DOUBLE;
+        step.doffset = offset.GetDouble();
+        }
+      else
+        {
+        if (add)
+          {
+          step.ioffset = offset.GetUnsignedInteger();
+          type = offset.IsSignedInteger() ? DBC_NUMBER_INTEGER_SIGNED : DBC_NUMBER_INTEGER_UNSIGNED;
+          }
+        step.type = type;
+        }
+      }
+
+    if (signal == m_multiplexor)
+      {
+      m_plan.insert(m_plan.begin(), step);
+      m_plan_mux = true;
+      }
+    else if (m_multiplexor && signal->IsMultiplexSwitch())
+      {
+      step.flags |= DBC_PLAN_MULTIPLEXED;
+      step.switchvalue = signal->GetMultiplexSwitchvalue();
+      muxed.push_back(step);
+      }
+    else
+      {
+      m_plan.push_back(step);
+      }
+    }
+
+  std::stable_sort(muxed.begin(), muxed.end(), dbc_plan_switch_less);
+  m_plan_muxed = m_plan.size();
+  m_plan.insert(m_plan.end(), muxed.begin(), muxed.end());
+  m_plan_valid = true;
+  }
+
+void dbcMessage::InvalidatePlan()
+  {
+  m_plan_valid = false;
+  }
+
+void dbcMessage::PlanMuxRange(uint32_t muxval, size_t* from, size_t* to)
+  {
+  dbcDecodeStep_t key;
+  key.switchvalue = muxval;
+  dbcDecodePlan_t::iterator begin = m_plan.begin() + m_plan_muxed;
+  dbcDecodePlan_t::iterator it = std::lower_bound(begin, m_plan.end(), key, dbc_plan_switch_less);
+  *from = it - m_plan.begin();
+  while (it != m_plan.end() && it->switchvalue == muxval)
+    ++it;
+  *to = it - m_plan.begin();
+  }
+
+static inline void dbc_plan_decode(const dbcDecodeStep_t& step, CAN_frame_t* frame,
+  uint64_t le, uint64_t be, dbcNumber& result)
+  {
+  if (step.flags & DBC_PLAN_FALLBACK)
+    {
+    result = step.signal->Decode(frame);
+    return;
+    }
+
+  uint32_t raw = (uint32_t)((((step.flags & DBC_PLAN_BIGENDIAN) ? be : le) >> step.shift) & step.mask);
+  if (step.flags & DBC_PLAN_MULDOUBLE)
+    {
+    double val = (step.flags & DBC_PLAN_SIGNED) ? (double)(int32_t)raw : (double)raw;
+    val *= step.dfactor;
+    if (step.flags & DBC_PLAN_ADDINT)
+      {
+      dbcNumber offset;
+      offset.Cast(step.ioffset, step.type);
+      result.Set(val);
+      result = (result + offset);
+      }
+    else
+      {
+      result.Set(val + step.doffset);
+      }
+    }
+  else if (step.flags & DBC_PLAN_DOUBLE)
+    {
+    uint32_t prod = raw * step.ifactor;
+    double val = (step.flags & DBC_PLAN_MULSIGNED) ? (double)(int32_t)prod : (double)prod;
+    result.Set(val + step.doffset);
+    }
+  else
+    {
+    result.Cast(raw * step.ifactor + step.ioffset, step.type);
+    }
+  }
+
+/**
+ * DecodeSignals: decode all signals active in a frame
+ *
+ * Results are identical to dbcSignal::Decode(). For multiplexed messages,
+ * the multiplexor and plain signals are always decoded, multiplexed signals
+ * only if their switch value matches the multiplexor value.
+ *
+ * Returns the number of results stored (max. maxresults).
+ */
+int dbcMessage::DecodeSignals(CAN_frame_t* frame, dbcDecodeResult_t* results, int maxresults)
+  {
+  if (!m_plan_valid) Compile();
+
+  uint64_t le = frame->data.u64;
+  uint64_t be = m_plan_be ? __builtin_bswap64(le) : 0;
+  int cnt = 0;
+
+  size_t plain = m_plan_muxed, from = m_plan_muxed, to = m_plan_muxed;
+  for (size_t i = 0; i < plain && cnt < maxresults; i++)
+    {
+    dbc_plan_decode(m_plan[i], frame, le, be, results[cnt].value);
+    results[cnt++].signal = m_plan[i].signal;
+    if (i == 0 && m_plan_mux)
+      PlanMuxRange((uint32_t)results[0].value.GetSignedInteger(), &from, &to);
+    }
+  for (size_t i = from; i < to && cnt < maxresults; i++)
+    {
+    dbc_plan_decode(m_plan[i], frame, le, be, results[cnt].value);
+    results[cnt++].signal = m_plan[i].signal;
+    }
+
+  return cnt;
+  }
+
+/**
+ * DecodeMetrics: decode the active signals having a metric assigned
+ *  and set the metric values
+ *
+ * Returns the number of metrics set.
+ */
+int dbcMessage::DecodeMetrics(CAN_frame_t* frame)
+  {
+  if (!m_plan_valid) Compile();
+
+  uint64_t le = frame->data.u64;
+  uint64_t be = m_plan_be ? __builtin_bswap64(le) : 0;
+  int cnt = 0;
+  dbcNumber value;
+  OvmsMetric* metric;
+
+  size_t plain = m_plan_muxed, from = m_plan_muxed, to = m_plan_muxed;
+  for (size_t i = 0; i < plain; i++)
+    {
+    const dbcDecodeStep_t& step = m_plan[i];
+    metric = step.signal->GetMetric();
+    bool mux = (i == 0 && m_plan_mux);
+    if (!metric && !mux) continue;
+    dbc_plan_decode(step, frame, le, be, value);
+    if (mux)
+      PlanMuxRange((uint32_t)value.GetSignedInteger(), &from, &to);
+    if (metric)
+      {
+      metric->SetValue(value);
+      cnt++;
+      }
+    }
+  for (size_t i = from; i < to; i++)
+    {
+    const dbcDecodeStep_t& step = m_plan[i];
+    metric = step.signal->GetMetric();
+    if (!metric) continue;
+    dbc_plan_decode(step, frame, le, be, value);
+    metric->SetValue(value);
+    cnt++;
+    }
+
+  return cnt;
+  }
+
 void dbcMessage::WriteFile(dbcOutputCallback callback, void* param)
   {
   std::ostringstream ss;
@@ -1217,6 +1501,14 @@ void dbcMessageTable::Count(int* messages, int* signals, int* bits, int* covered
     }
   }
 
+void dbcMessageTable::Compile()
+  {
+  for (dbcMessageEntry_t::iterator itt = m_entrymap.begin();
+       itt != m_entrymap.end();
+       itt++)
+    itt->second->Compile();
+  }
+
 void dbcMessageTable::EmptyContent()
   {
   dbcMessageEntry_t::iterator it=m_entrymap.begin();
@@ -1324,6 +1616,7 @@ bool dbcfile::LoadFile(const char* name, const char* path, FILE* fd)
     fseek(fd,0,SEEK_SET);
     }
 
+  if (result) m_messages.Compile();
   return result;
   }
 
@@ -1339,6 +1632,7 @@ bool dbcfile::LoadString(const char* name, const char* source, size_t length)
   bool result = (yyparse (this) == 0);
   yy_delete_buffer(buffer);
 
+  if (result) m_messages.Compile();
   return result;
   }
 
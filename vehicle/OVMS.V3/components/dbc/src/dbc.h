@@ -34,6 +34,7 @@
 #include <string>
 #include <map>
 #include <list>
+#include <vector>
 #include <functional>
 #include <iostream>
 #include "dbc_number.h"
@@ -331,6 +332,38 @@ class dbcSignal
     OvmsMetric* m_metric;
   };
 
+// Decode plan step flags:
+#define DBC_PLAN_SIGNED         0x01  // raw value is signed
+#define DBC_PLAN_BIGENDIAN      0x02  // extract from big endian frame word
+#define DBC_PLAN_FALLBACK       0x04  // not supported, use dbcSignal::Decode()
+#define DBC_PLAN_DOUBLE         0x08  // floating point offset
+#define DBC_PLAN_MULDOUBLE      0x10  // floating point factor
+#define DBC_PLAN_MULSIGNED      0x20  // integer factor product is signed
+#define DBC_PLAN_MULTIPLEXED    0x40  // only valid for the switch value
+#define DBC_PLAN_ADDINT         0x80  // integer offset on floating point product
+
+// Precompiled signal decoder (see dbcMessage::Compile()):
+struct dbcDecodeStep_t
+  {
+  dbcSignal* signal;
+  uint64_t mask;                      // value mask (after shift)
+  uint8_t shift;                      // value LSB position in frame word
+  uint8_t flags;                      // DBC_PLAN_*
+  dbcNumberType_t type;               // integer result type / DBC_PLAN_ADDINT: offset type
+  uint32_t switchvalue;               // multiplexed signal: mux value
+  uint32_t ifactor;                   // integer factor (32 bit two's complement)
+  uint32_t ioffset;                   // integer offset (32 bit two's complement)
+  double dfactor;                     // floating point factor
+  double doffset;                     // floating point offset
+  };
+typedef std::vector<dbcDecodeStep_t> dbcDecodePlan_t;
+
+struct dbcDecodeResult_t
+  {
+  dbcSignal* signal;
+  dbcNumber value;
+  };
+
 typedef std::list<dbcSignal*> dbcSignalList_t;
 class dbcMessage
   {
@@ -368,6 +401,15 @@ class dbcMessage
     dbcSignal* GetMultiplexorSignal();
     void SetMultiplexorSignal(dbcSignal* signal);
 
+  public:
+    void Compile();
+    void InvalidatePlan();
+    int DecodeSignals(CAN_frame_t* frame, dbcDecodeResult_t* results, int maxresults);
+    int DecodeMetrics(CAN_frame_t* frame);
+
+  protected:
+    void PlanMuxRange(uint32_t muxval, size_t* from, size_t* to);
+
   public:
     void WriteFile(dbcOutputCallback callback, void* param);
     void WriteFileComments(dbcOutputCallback callback, void* param);
@@ -383,6 +425,13 @@ class dbcMessage
     std::string m_name;
     int m_size;
     std::string m_transmitter_node;
+
+  protected:
+    dbcDecodePlan_t m_plan;           // multiplexor, plain signals, multiplexed signals by switch value
+    size_t m_plan_muxed;              // index of first multiplexed signal
+    bool m_plan_mux;                  // first step is the multiplexor
+    bool m_plan_be;                   // plan has big endian signals
+    bool m_plan_valid;
   };
 
 typedef std::map<uint32_t, dbcMessage*> dbcMessageEntry_t;
@@ -398,6 +447,7 @@ class dbcMessageTable
     dbcMessage* FindMessage(uint32_t id);
     dbcMessage* FindMessage(CAN_frame_format_t format, uint32_t id);
     void Count(int* messages, int* signals, int* bits, int* covered);
+    void Compile();
 
   public:
     void EmptyContent();
@@ -514,6 +514,7 @@ void dbc_signal_set_mux(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int
     signal->ClearMultiplexed();
     writer->printf("DBC: Cleared mux for signal %s on message %s\n",argv[1],argv[0]);
     }
+  msg->InvalidatePlan();
   }
 
 dbc::dbc()
@@ -34,6 +34,7 @@ static const char *TAG = "obd2ecu";
 
 #include <string.h>
 #include <dirent.h>
+#include "esp_timer.h"
 #include "obd2ecu.h"
 #include "ovms_script.h"
 #include "ovms_config.h"
@@ -48,6 +49,7 @@ obd2pid::obd2pid(int pid, pid_t type, OvmsMetric* metric)
   m_type = type;
   m_script = NULL;
   m_metric = metric;
+  ResetLatency();
   }
 
 obd2pid::~obd2pid()
@@ -76,7 +78,7 @@ const char* obd2pid::GetTypeString()
     case Unimplemented:  return "unimplemented";
     case Internal:       return "internal";
     case Metric:         return "metric";
-    case Script:         return "script";
+    case Script:         return m_expr.IsCompiled() ? "expression" : "script";
     default:             return "unknown";
     }
   }
@@ -115,6 +117,12 @@ void obd2pid::LoadScript(std::string path)
   m_script[fsz] = 0;
 
   fclose(f);
+
+  // Try to compile the script for native evaluation:
+  if (m_expr.Compile(m_script))
+    ESP_LOGI(TAG, "PID #%d (0x%02x): script compiled to native expression", m_pid, m_pid);
+  else
+    ESP_LOGI(TAG, "PID #%d (0x%02x): script needs Javascript (%s)", m_pid, m_pid, m_expr.GetError().c_str());
   }
 
 float obd2pid::Execute()
@@ -130,6 +138,8 @@ float obd2pid::Execute()
       else
         return 0.0;
     case Script:
+      if (m_expr.IsCompiled())
+        return m_expr.Evaluate();
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
       {
       return MyDuktape.DuktapeEvalFloatResult(m_script);
@@ -142,6 +152,28 @@ float obd2pid::Execute()
     }
   }
 
+void obd2pid::AddLatency(uint32_t us)
+  {
+  m_lat_count++;
+  m_lat_sum += us;
+  if (us > m_lat_max)
+    m_lat_max = us;
+  }
+
+void obd2pid::GetLatency(uint32_t& count, uint32_t& avg, uint32_t& max)
+  {
+  count = m_lat_count;
+  avg = m_lat_count ? m_lat_sum / m_lat_count : 0;
+  max = m_lat_max;
+  }
+
+void obd2pid::ResetLatency()
+  {
+  m_lat_count = 0;
+  m_lat_sum = 0;
+  m_lat_max = 0;
+  }
+
 
 static void OBD2ECU_task(void *pvParameters)
   {
@@ -172,7 +204,11 @@ obd2ecu::obd2ecu(const char* name, canbus* can)
 
   xTaskCreatePinnedToCore(OBD2ECU_task, "OVMS OBDII ECU", 6144, (void*)this, 5, &m_task, CORE(1));
 
-  MyCan.RegisterListener(m_rxqueue);
+  MyCan.RegisterListener(m_rxqueue, false, "obd2ecu");
+  MyCan.SubscribeListener(m_rxqueue, m_can, REQUEST_PID, REQUEST_PID);
+  MyCan.SubscribeListener(m_rxqueue, m_can, FLOWCONTROL_PID, FLOWCONTROL_PID);
+  MyCan.SubscribeListener(m_rxqueue, m_can, REQUEST_EXT_PID, REQUEST_EXT_PID);
+  MyCan.SubscribeListener(m_rxqueue, m_can, FLOWCONTROL_EXT_PID, FLOWCONTROL_EXT_PID);
   }
 
 obd2ecu::~obd2ecu()
@@ -248,7 +284,7 @@ void obd2ecu_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
     return;
     }
 
-  writer->printf("%-7s %14s %12s %s\n","  PID","Type","Value","   Metric");
+  writer->printf("%-7s %14s %12s %8s %8s %8s %s\n","  PID","Type","Value","Requests","Avg us","Max us","   Metric");
 
   for (PidMap::iterator it=MyPeripherals->m_obd2ecu->m_pidmap.begin(); it!=MyPeripherals->m_obd2ecu->m_pidmap.end(); ++it)
     {
@@ -260,10 +296,13 @@ void obd2ecu_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
       else
         ms = "";
 
-      writer->printf("%-3d (0x%02x) %14s %12f %s\n",
+      uint32_t count, avg, max;
+      it->second->GetLatency(count, avg, max);
+      writer->printf("%-3d (0x%02x) %14s %12f %8u %8u %8u %s\n",
         it->first, it->first,
         it->second->GetTypeString(),
         it->second->Execute(),
+        count, avg, max,
         ms);
       }
     }
@@ -485,6 +524,7 @@ void obd2ecu::IncomingFrame(CAN_frame_t* p_frame)
   uint8_t mapped_pid;
   float metric;
   char rtn_string[21];
+  int64_t started = esp_timer_get_time();
 
   uint8_t *p_d = p_frame->data.u8;  /* Incoming frame data from HUD / Dongle */
   uint8_t *r_d = r_frame.data.u8;  /* Response frame data being sent back to HUD / Dongle */
@@ -633,6 +673,11 @@ void obd2ecu::IncomingFrame(CAN_frame_t* p_frame)
           m_can->Write(&r_frame);
 
 	}
+      {
+      auto it = m_pidmap.find(mapped_pid);
+      if (it != m_pidmap.end())
+        it->second->AddLatency((uint32_t)(esp_timer_get_time() - started));
+      }
       break;
 
     case 9:
@@ -37,6 +37,7 @@
 #include "pcp.h"
 #include "can.h"
 #include "ovms_metrics.h"
+#include "obd2expr.h"
 
 class obd2pid
   {
@@ -61,7 +62,11 @@ class obd2pid
     void SetType(pid_t type);
     void SetMetric(OvmsMetric* metric);
     void LoadScript(std::string path);
+    bool IsCompiled() { return m_expr.IsCompiled(); }
     float Execute();
+    void AddLatency(uint32_t us);
+    void GetLatency(uint32_t& count, uint32_t& avg, uint32_t& max);
+    void ResetLatency();
 
   public:
     float InternalPid();
@@ -70,7 +75,13 @@ class obd2pid
     int m_pid;
     pid_t m_type;
     char* m_script;
+    obd2expr m_expr;          // native version of m_script, if compilable
     OvmsMetric* m_metric;
+
+    // Response latency statistics:
+    uint32_t m_lat_count;
+    uint64_t m_lat_sum;       // us
+    uint32_t m_lat_max;       // us
   };
 
 typedef std::map<int, obd2pid*> PidMap;
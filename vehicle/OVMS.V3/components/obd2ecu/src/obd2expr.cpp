@@ -0,0 +1,389 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "obd2ecu";
+
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <cmath>
+#include "obd2expr.h"
+
+#define OBD2EXPR_MAXDEPTH 16
+
+obd2expr::obd2expr()
+  {
+  m_maxdepth = 0;
+  m_generation = 0;
+  m_src = m_pos = NULL;
+  m_depth = 0;
+  }
+
+obd2expr::~obd2expr()
+  {
+  }
+
+/**
+ * Compile: translate script source into a postfix program
+ *  - returns false if the script uses anything beyond the supported subset,
+ *    see GetError() for the reason
+ */
+bool obd2expr::Compile(const char* source)
+  {
+  m_code.clear();
+  m_metrics.clear();
+  m_error.clear();
+  m_maxdepth = 0;
+  m_depth = 0;
+  m_generation = MyMetrics.m_generation;
+  m_src = m_pos = source;
+
+  if (!ParseExpr())
+    {
+    m_code.clear();
+    return false;
+    }
+  SkipSpace();
+  Accept(";");
+  SkipSpace();
+  if (*m_pos)
+    {
+    Fail("unexpected input");
+    m_code.clear();
+    return false;
+    }
+  if (m_maxdepth > OBD2EXPR_MAXDEPTH)
+    {
+    Fail("expression too complex");
+    m_code.clear();
+    return false;
+    }
+
+  ESP_LOGD(TAG, "Compiled expression: %d instructions, stack depth %d", (int)m_code.size(), m_maxdepth);
+  return true;
+  }
+
+bool obd2expr::Fail(const char* error)
+  {
+  if (m_error.empty())
+    {
+    m_error = error;
+    m_error.append(" at offset ");
+    m_error.append(std::to_string(m_pos - m_src));
+    }
+  return false;
+  }
+
+void obd2expr::Emit(opcode_t op, int argc)
+  {
+  instr_t in;
+  in.op = op;
+  in.argc = argc;
+  m_code.push_back(in);
+  switch (op)
+    {
+    case OpConst:
+    case OpMetric:
+      m_depth++;
+      break;
+    case OpAdd:
+    case OpSub:
+    case OpMul:
+    case OpDiv:
+      m_depth--;
+      break;
+    case OpMin:
+    case OpMax:
+      m_depth -= argc - 1;
+      break;
+    default:
+      break;
+    }
+  if (m_depth > m_maxdepth)
+    m_maxdepth = m_depth;
+  }
+
+void obd2expr::SkipSpace()
+  {
+  while (*m_pos)
+    {
+    if (isspace((unsigned char)*m_pos))
+      m_pos++;
+    else if (m_pos[0] == '/' && m_pos[1] == '/')
+      {
+      while (*m_pos && *m_pos != '\n') m_pos++;
+      }
+    else if (m_pos[0] == '/' && m_pos[1] == '*')
+      {
+      const char* end = strstr(m_pos+2, "*/");
+      m_pos = end ? end+2 : m_pos + strlen(m_pos);
+      }
+    else
+      break;
+    }
+  }
+
+bool obd2expr::Accept(const char* token)
+  {
+  SkipSpace();
+  size_t len = strlen(token);
+  if (strncmp(m_pos, token, len) != 0)
+    return false;
+  // don't split identifiers:
+  if (isalpha((unsigned char)token[len-1]) && (isalnum((unsigned char)m_pos[len]) || m_pos[len] == '_'))
+    return false;
+  m_pos += len;
+  return true;
+  }
+
+// expr := term { ("+" | "-") term }
+bool obd2expr::ParseExpr()
+  {
+  if (!ParseTerm()) return false;
+  while (true)
+    {
+    if (Accept("+"))
+      {
+      if (!ParseTerm()) return false;
+      Emit(OpAdd);
+      }
+    else if (Accept("-"))
+      {
+      if (!ParseTerm()) return false;
+      Emit(OpSub);
+      }
+    else
+      return true;
+    }
+  }
+
+// term := unary { ("*" | "/") unary }
+bool obd2expr::ParseTerm()
+  {
+  if (!ParseUnary()) return false;
+  while (true)
+    {
+    // Note: "//" and "/*" are comments, handled by SkipSpace()
+    SkipSpace();
+    if (Accept("*"))
+      {
+      if (!ParseUnary()) return false;
+      Emit(OpMul);
+      }
+    else if (Accept("/"))
+      {
+      if (!ParseUnary()) return false;
+      Emit(OpDiv);
+      }
+    else
+      return true;
+    }
+  }
+
+// unary := [ "-" | "+" ] unary | primary
+bool obd2expr::ParseUnary()
+  {
+  if (Accept("-"))
+    {
+    if (!ParseUnary()) return false;
+    Emit(OpNeg);
+    return true;
+    }
+  if (Accept("+"))
+    return ParseUnary();
+  return ParsePrimary();
+  }
+
+// primary := number | "(" expr ")" | metric | function "(" args ")"
+bool obd2expr::ParsePrimary()
+  {
+  SkipSpace();
+
+  if (isdigit((unsigned char)*m_pos) || (*m_pos == '.' && isdigit((unsigned char)m_pos[1])))
+    {
+    char* end;
+    float value = strtof(m_pos, &end);
+    m_pos = end;
+    Emit(OpConst);
+    m_code.back().value = value;
+    return true;
+    }
+
+  if (Accept("("))
+    {
+    if (!ParseExpr()) return false;
+    if (!Accept(")")) return Fail("')' expected");
+    return true;
+    }
+
+  if (Accept("OvmsMetrics.AsFloat"))
+    {
+    std::string name;
+    if (!Accept("(") || !ParseString(name) || !Accept(")"))
+      return Fail("metric name expected");
+    OvmsMetric* metric = MyMetrics.Find(name.c_str());
+    if (!metric)
+      return Fail("unknown metric");
+    int index;
+    for (index = 0; index < (int)m_metrics.size(); index++)
+      {
+      if (m_metrics[index].name == name)
+        break;
+      }
+    if (index == (int)m_metrics.size())
+      m_metrics.push_back({ name, metric });
+    Emit(OpMetric);
+    m_code.back().metric = index;
+    return true;
+    }
+
+  opcode_t op;
+  if (Accept("Math.min"))
+    op = OpMin;
+  else if (Accept("Math.max"))
+    op = OpMax;
+  else
+    return Fail("unsupported syntax");
+
+  int argc = ParseArgs();
+  if (argc < 0)
+    return false;
+  if (argc > 1)
+    Emit(op, argc);
+  return true;
+  }
+
+// args := "(" expr { "," expr } ")"
+int obd2expr::ParseArgs()
+  {
+  if (!Accept("("))
+    {
+    Fail("'(' expected");
+    return -1;
+    }
+  int argc = 0;
+  do
+    {
+    if (!ParseExpr()) return -1;
+    argc++;
+    } while (Accept(","));
+  if (!Accept(")"))
+    {
+    Fail("')' expected");
+    return -1;
+    }
+  return argc;
+  }
+
+bool obd2expr::ParseString(std::string& str)
+  {
+  SkipSpace();
+  char quote = *m_pos;
+  if (quote != '"' && quote != '\'')
+    return false;
+  const char* end = strchr(m_pos+1, quote);
+  if (!end)
+    return false;
+  str.assign(m_pos+1, end - m_pos - 1);
+  m_pos = end+1;
+  return true;
+  }
+
+/**
+ * Resolve: look up the metric pointers again after a metrics list change
+ */
+void obd2expr::Resolve()
+  {
+  m_generation = MyMetrics.m_generation;
+  for (metricref_t& ref : m_metrics)
+    ref.metric = MyMetrics.Find(ref.name.c_str());
+  }
+
+/**
+ * Evaluate: run the compiled program
+ */
+float obd2expr::Evaluate()
+  {
+  float stack[OBD2EXPR_MAXDEPTH];
+  int sp = 0;
+
+  if (m_code.empty())
+    return 0;
+  if (m_generation != MyMetrics.m_generation)
+    Resolve();
+
+  for (const instr_t& in : m_code)
+    {
+    switch (in.op)
+      {
+      case OpConst:
+        stack[sp++] = in.value;
+        break;
+      case OpMetric:
+        {
+        OvmsMetric* metric = m_metrics[in.metric].metric;
+        stack[sp++] = metric ? metric->AsFloat() : NAN;
+        }
+        break;
+      case OpAdd:
+        sp--; stack[sp-1] += stack[sp];
+        break;
+      case OpSub:
+        sp--; stack[sp-1] -= stack[sp];
+        break;
+      case OpMul:
+        sp--; stack[sp-1] *= stack[sp];
+        break;
+      case OpDiv:
+        sp--; stack[sp-1] /= stack[sp];
+        break;
+      case OpNeg:
+        stack[sp-1] = -stack[sp-1];
+        break;
+      case OpMin:
+        for (int i = 1; i < in.argc; i++)
+          {
+          sp--;
+          if (stack[sp] < stack[sp-1] || std::isnan(stack[sp])) stack[sp-1] = stack[sp];
+          }
+        break;
+      case OpMax:
+        for (int i = 1; i < in.argc; i++)
+          {
+          sp--;
+          if (stack[sp] > stack[sp-1] || std::isnan(stack[sp])) stack[sp-1] = stack[sp];
+          }
+        break;
+      }
+    }
+
+  return stack[0];
+  }
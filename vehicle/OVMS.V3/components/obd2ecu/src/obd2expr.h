@@ -0,0 +1,132 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OBD2EXPR_H__
+#define __OBD2EXPR_H__
+
+#include <string>
+#include <vector>
+#include "ovms_metrics.h"
+
+/**
+ * obd2expr: native evaluator for simple OBD2ECU PID scripts
+ *
+ * PID scripts usually just combine a few metrics arithmetically. Evaluating
+ * them by Duktape means passing each request to the script task, which adds
+ * latency HUDs polling at 10-20 Hz may not tolerate. Scripts using only the
+ * subset below are compiled once into a postfix program and evaluated in the
+ * OBD2ECU task, all other scripts are run by Duktape as before. Metrics are
+ * referenced by name, the pointers are resolved again after any metrics list
+ * change (e.g. by a vehicle module change), a metric no longer registered
+ * yields NaN.
+ *
+ * Supported syntax (a Javascript subset, so scripts stay valid for Duktape):
+ *   - numbers: 12, 0.5, 1e3
+ *   - metrics: OvmsMetrics.AsFloat("v.b.soc") (OvmsMetrics.Value() is left to
+ *     Duktape, as it yields strings, booleans or arrays depending on the type)
+ *   - operators: + - * / (binary), - (unary), parentheses
+ *   - functions: Math.min(a,b,…), Math.max(a,b,…)
+ *   - an optional trailing ';', line & block comments
+ *
+ * Evaluation is done in single precision floats (Duktape: double) on the
+ * metric AsFloat() values. Division by zero yields ±Infinity or NaN, and
+ * Math.min/max return NaN if any argument is NaN, as in Javascript.
+ */
+
+class obd2expr
+  {
+  public:
+    obd2expr();
+    ~obd2expr();
+
+  public:
+    bool Compile(const char* source);
+    bool IsCompiled() { return !m_code.empty(); }
+    const std::string& GetError() { return m_error; }
+    float Evaluate();
+
+  protected:
+    typedef enum
+      {
+      OpConst = 0,      // push value
+      OpMetric,         // push m_metrics[metric] AsFloat()
+      OpAdd,
+      OpSub,
+      OpMul,
+      OpDiv,
+      OpNeg,
+      OpMin,            // argc operands
+      OpMax,            // argc operands
+      } opcode_t;
+
+    typedef struct
+      {
+      opcode_t op;
+      union
+        {
+        float value;
+        int metric;     // index into m_metrics
+        int argc;
+        };
+      } instr_t;
+
+    typedef struct
+      {
+      std::string name;
+      OvmsMetric* metric;         // NULL = not registered
+      } metricref_t;
+
+  protected:
+    void SkipSpace();
+    bool Accept(const char* token);
+    bool ParseExpr();
+    bool ParseTerm();
+    bool ParseUnary();
+    bool ParsePrimary();
+    bool ParseString(std::string& str);
+    int ParseArgs();
+    bool Fail(const char* error);
+    void Emit(opcode_t op, int argc=0);
+    void Resolve();
+
+  protected:
+    std::vector<instr_t> m_code;
+    std::vector<metricref_t> m_metrics;
+    uint32_t m_generation;        // MyMetrics.m_generation m_metrics were resolved at
+    int m_maxdepth;
+    std::string m_error;
+
+    // Compiler state:
+    const char* m_src;
+    const char* m_pos;
+    int m_depth;
+  };
+
+#endif //#ifndef __OBD2EXPR_H__
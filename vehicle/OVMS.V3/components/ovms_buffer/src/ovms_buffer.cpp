@@ -35,6 +35,7 @@ static const char *TAG = "buffer";
 #include "ovms_command.h"
 #include <string.h>		// Needed for memset by LWIP's sys/socket.h
 #include <sys/socket.h>
+#include <algorithm>
 
 OvmsBuffer::OvmsBuffer(size_t size, void* userdata)
   {
@@ -43,6 +44,8 @@ OvmsBuffer::OvmsBuffer(size_t size, void* userdata)
   m_tail = 0;
   m_size = size;
   m_used = 0;
+  m_scanned = 0;
+  m_linelen = -1;
   m_userdata = userdata;
   }
 
@@ -71,6 +74,8 @@ void OvmsBuffer::EmptyAll()
   m_head = 0;
   m_tail = 0;
   m_used = 0;
+  m_scanned = 0;
+  m_linelen = -1;
   }
 
 bool OvmsBuffer::Push(uint8_t byte)
@@ -88,12 +93,17 @@ bool OvmsBuffer::Push(uint8_t *byte, size_t count)
   {
   if ((m_size-m_used)<count) return false;
 
+  // Copy in up to two blocks (wrap around):
   m_used += count;
-  for (size_t k=0;k<count;k++)
+  while (count > 0)
     {
-    // ESP_LOGI(TAG, "Push() %02x at %d",byte[k],m_head);
-    m_buffer[m_head++] = byte[k];
+    size_t n = m_size - m_head;
+    if (n > count) n = count;
+    memcpy(m_buffer+m_head, byte, n);
+    m_head += n;
     if (m_head >= m_size) m_head=0;
+    byte += n;
+    count -= n;
     }
 
   return true;
@@ -103,6 +113,8 @@ uint8_t OvmsBuffer::Pop()
   {
   if (m_used==0) return 0;
 
+  m_scanned = 0;
+  m_linelen = -1;
   m_used--;
   uint8_t result = m_buffer[m_tail++];
   if (m_tail >= m_size) m_tail=0;
@@ -114,10 +126,17 @@ size_t OvmsBuffer::Pop(size_t count, uint8_t *dest)
   {
   size_t done = 0;
 
+  m_scanned = 0;
+  m_linelen = -1;
   while ((m_used>0)&&(done < count))
     {
-    m_used--;
-    dest[done++] = m_buffer[m_tail++];
+    size_t n = m_size - m_tail;
+    if (n > m_used) n = m_used;
+    if (n > count-done) n = count-done;
+    memcpy(dest+done, m_buffer+m_tail, n);
+    done += n;
+    m_used -= n;
+    m_tail += n;
     if (m_tail >= m_size) m_tail=0;
     }
 
@@ -138,7 +157,12 @@ size_t OvmsBuffer::Peek(size_t count, uint8_t *dest)
   size_t tail = m_tail;
   while ((done<m_used)&&(done<count))
     {
-    dest[done++] = m_buffer[tail++];
+    size_t n = m_size - tail;
+    if (n > m_used-done) n = m_used-done;
+    if (n > count-done) n = count-done;
+    memcpy(dest+done, m_buffer+tail, n);
+    done += n;
+    tail += n;
     if (tail >= m_size) tail=0;
     }
 
@@ -189,6 +213,65 @@ std::string OvmsBuffer::ReadLine()
   return std::string((char*)result,hl);
   }
 
+/**
+ * PeekLine: zero-copy access to the next complete line
+ *  - line: set to the line content (without CR/LF terminator)
+ *  Returns false if there is no complete line in the buffer.
+ *  The line data is contiguous and followed by its terminator, it stays
+ *  valid until ConsumeLine() or any other buffer modification.
+ *  Scanning continues where a previous unsuccessful call stopped, and the
+ *  buffer content only gets moved if a line wraps around the buffer end.
+ */
+bool OvmsBuffer::PeekLine(OvmsLineSpan* line)
+  {
+  if (m_linelen < 0)
+    {
+    size_t pos = m_tail + m_scanned;
+    if (pos >= m_size) pos -= m_size;
+    for (; m_scanned < m_used; m_scanned++)
+      {
+      if ((m_buffer[pos]=='\r')||(m_buffer[pos]=='\n'))
+        break;
+      if (++pos >= m_size) pos = 0;
+      }
+    if (m_scanned == m_used)
+      return false;
+    m_linelen = m_scanned;
+    }
+
+  if ((size_t)(m_tail + m_linelen) >= m_size)
+    {
+    // Line wraps: rotate the buffer content to start at offset 0
+    std::rotate(m_buffer, m_buffer + m_tail, m_buffer + m_size);
+    m_tail = 0;
+    m_head = (m_used < m_size) ? m_used : 0;
+    }
+
+  *line = OvmsLineSpan((const char*)m_buffer + m_tail, m_linelen);
+  return true;
+  }
+
+/**
+ * ConsumeLine: remove the line found by PeekLine() including its terminator
+ */
+void OvmsBuffer::ConsumeLine()
+  {
+  if (m_linelen < 0) return;
+
+  m_used -= m_linelen;
+  m_tail += m_linelen;
+  if (m_tail >= m_size) m_tail -= m_size;
+  m_scanned = 0;
+  m_linelen = -1;
+
+  if (Peek() == '\r') Pop();
+  if (Peek() == '\n') Pop();
+
+  // Restart at the buffer begin when empty to keep lines contiguous:
+  if (m_used == 0)
+    m_head = m_tail = 0;
+  }
+
 int OvmsBuffer::PollSocket(int sock, long timeoutms)
   {
   fd_set fds;
@@ -33,6 +33,76 @@
 
 #include <string>
 #include <stdint.h>
+#include <string.h>
+
+/**
+ * OvmsLineSpan: zero-copy view & tokenizer of a text line
+ *  The span references the line data, it does not own it. Token readers
+ *  advance the span start and return false if the expected token is missing.
+ */
+class OvmsLineSpan
+  {
+  public:
+    OvmsLineSpan() : m_pos(NULL), m_end(NULL) {}
+    OvmsLineSpan(const char* data, size_t length) : m_pos(data), m_end(data+length) {}
+
+  public:
+    const char* Data() const        { return m_pos; }
+    size_t Length() const           { return m_end - m_pos; }
+    bool Empty() const              { return m_pos >= m_end; }
+    char Peek(size_t offset=0) const { return (m_pos+offset < m_end) ? m_pos[offset] : 0; }
+    void Advance(size_t count)      { m_pos = (m_pos+count < m_end) ? m_pos+count : m_end; }
+    std::string ToString() const    { return std::string(m_pos, Length()); }
+
+    bool StartsWith(const char* prefix) const
+      {
+      size_t len = strlen(prefix);
+      return (Length() >= len && memcmp(m_pos, prefix, len) == 0);
+      }
+    bool Skip(char c)
+      {
+      if (m_pos < m_end && *m_pos == c) { m_pos++; return true; }
+      return false;
+      }
+    void SkipSpace()
+      {
+      while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\t')) m_pos++;
+      }
+    bool SkipToken()
+      {
+      // Skip up to the next space (or end), returns false if no space found
+      while (m_pos < m_end && *m_pos != ' ') m_pos++;
+      return (m_pos < m_end);
+      }
+    bool Hex(uint32_t* value, int maxdigits=8)
+      {
+      uint32_t v = 0;
+      int n;
+      for (n = 0; n < maxdigits && m_pos < m_end; n++, m_pos++)
+        {
+        char c = *m_pos;
+        if (c >= '0' && c <= '9')       v = (v << 4) | (c - '0');
+        else if (c >= 'a' && c <= 'f')  v = (v << 4) | (c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')  v = (v << 4) | (c - 'A' + 10);
+        else break;
+        }
+      *value = v;
+      return (n > 0);
+      }
+    bool Dec(uint32_t* value)
+      {
+      uint32_t v = 0;
+      const char* start = m_pos;
+      for (; m_pos < m_end && *m_pos >= '0' && *m_pos <= '9'; m_pos++)
+        v = v * 10 + (*m_pos - '0');
+      *value = v;
+      return (m_pos > start);
+      }
+
+  protected:
+    const char* m_pos;
+    const char* m_end;
+  };
 
 class OvmsBuffer
   {
@@ -58,6 +128,8 @@ class OvmsBuffer
   public:
     int HasLine();
     std::string ReadLine();
+    bool PeekLine(OvmsLineSpan* line);
+    void ConsumeLine();
 
   public:
     int PollSocket(int sock, long timeoutms);
@@ -71,6 +143,8 @@ class OvmsBuffer
     int m_tail;
     size_t m_size;
     size_t m_used;
+    size_t m_scanned;         // bytes from tail known to contain no line end
+    int m_linelen;            // length of line found by PeekLine(), -1 = none
   };
 
 #endif //#ifndef __OVMS_BUFFER_H__
@@ -115,7 +115,7 @@ static inline uint8_t gsm_fcs_add(uint8_t fcs, uint8_t c)
   return gsm_fcs8[fcs ^ c];
   }
 
-static inline uint8_t gsm_fcs_add_block(uint8_t fcs, uint8_t *c, size_t len)
+static inline uint8_t gsm_fcs_add_block(uint8_t fcs, const uint8_t *c, size_t len)
   {
   while (len--) fcs = gsm_fcs8[fcs ^ *c++];
   return fcs;
@@ -127,13 +127,21 @@ GsmMuxChannel::GsmMuxChannel(GsmMux* mux, int channel, size_t buffersize)
   m_state = ChanClosed;
   m_mux = mux;
   m_channel = channel;
+  m_stream = false;
+  m_flowoff = false;
+  m_rxframes = 0;
+  m_rxbytes = 0;
+  m_txframes = 0;
+  m_txbytes = 0;
+  m_rxdropped = 0;
+  m_flowoffcount = 0;
   }
 
 GsmMuxChannel::~GsmMuxChannel()
   {
   }
 
-void GsmMuxChannel::ProcessFrame(uint8_t* frame, size_t length, size_t iframepos)
+void GsmMuxChannel::ProcessFrame(const uint8_t* frame, size_t length, size_t iframepos)
   {
   // Note the <length> provided excludes the start byte, stop byte, and checksum
   // The <frame> pointer itself points to the byte after the start byte
@@ -157,9 +165,9 @@ void GsmMuxChannel::ProcessFrame(uint8_t* frame, size_t length, size_t iframepos
     case ChanOpen:
       if (frame[1] == (GSM_UIH + GSM_PF))
         {
-        for (size_t k=iframepos;k<length;k++)
-          m_buffer.Push(frame[k]);
-        m_mux->m_modem->IncomingMuxData(this);
+        m_rxframes++;
+        m_rxbytes += length-iframepos;
+        Deliver(frame+iframepos, length-iframepos);
         }
       break;
     case ChanClosing:
@@ -169,20 +177,75 @@ void GsmMuxChannel::ProcessFrame(uint8_t* frame, size_t length, size_t iframepos
     }
   }
 
+/**
+ * Deliver: pass a payload span to the modem
+ *  - the span is only valid during the call
+ *  - the span is offered directly if there is no backlog, so the order is kept
+ */
+void GsmMuxChannel::Deliver(const uint8_t* data, size_t length)
+  {
+  size_t done = 0;
+  if (m_buffer.UsedSpace() == 0)
+    {
+    int res = m_mux->m_modem->IncomingMuxSpan(this, data, length);
+    m_stream = (res >= 0);
+    if (res > 0) done = res;
+    }
+  if (done < length)
+    {
+    if (!m_buffer.Push((uint8_t*)data+done, length-done))
+      {
+      ESP_LOGW(TAG, "Channel #%d: buffer full, %d bytes dropped", m_channel, length-done);
+      m_rxdropped += length-done;
+      }
+    m_mux->m_modem->IncomingMuxData(this);
+    }
+  CheckFlow();
+  }
+
+/**
+ * Drain: retry processing a backlog, i.e. if the consumer was busy
+ */
+void GsmMuxChannel::Drain()
+  {
+  if (m_buffer.UsedSpace() > 0)
+    m_mux->m_modem->IncomingMuxData(this);
+  CheckFlow();
+  }
+
+void GsmMuxChannel::CheckFlow()
+  {
+  size_t used = m_buffer.UsedSpace();
+  if (!m_flowoff && m_stream && used > m_buffer.Size()*3/4)
+    {
+    ESP_LOGD(TAG, "Channel #%d: backlog %d bytes, flow off", m_channel, used);
+    m_flowoff = true;
+    m_flowoffcount++;
+    m_mux->FlowControl(m_channel, true);
+    }
+  else if (m_flowoff && (!m_stream || used < m_buffer.Size()/4))
+    {
+    ESP_LOGD(TAG, "Channel #%d: backlog %d bytes, flow on", m_channel, used);
+    m_flowoff = false;
+    m_mux->FlowControl(m_channel, false);
+    }
+  }
+
 GsmMux::GsmMux(modem* m, int channelcount, size_t maxframesize)
   {
   m_channelcount = channelcount;
   m_state = DlciClosed;
   m_modem = m;
-  m_frame = new uint8_t[maxframesize];
   m_framesize = maxframesize;
-  m_framepos = 0;
-  m_frameipos = 0;
-  m_framelen = 0;
-  m_framemorelen = false;
+  m_rxsize = 2*maxframesize;
+  m_rxbuf = new uint8_t[m_rxsize];
+  m_rxstart = 0;
+  m_rxend = 0;
   m_openchannels = 0;
   m_framingerrors = 0;
+  m_fcserrors = 0;
   m_lastgoodrxframe = 0;
+  m_starttime = 0;
   m_rxframecount = 0;
   m_txframecount = 0;
   }
@@ -190,14 +253,16 @@ GsmMux::GsmMux(modem* m, int channelcount, size_t maxframesize)
 GsmMux::~GsmMux()
   {
   Shutdown();
-  delete [] m_frame;
+  delete [] m_rxbuf;
   }
 
 void GsmMux::Startup()
   {
   ESP_LOGI(TAG, "Start MUX");
   m_framingerrors = 0;
+  m_fcserrors = 0;
   m_lastgoodrxframe = 0;
+  m_starttime = monotonictime;
   m_rxframecount = 0;
   m_txframecount = 0;
   m_channels.insert(m_channels.end(),new GsmMuxChannel(this,0,8));
@@ -223,13 +288,13 @@ void GsmMux::Shutdown()
     m_channels.clear();
     }
   m_state = DlciClosed;
-  m_framepos = 0;
-  m_frameipos = 0;
-  m_framelen = 0;
-  m_framemorelen = false;
+  m_rxstart = 0;
+  m_rxend = 0;
   m_openchannels = 0;
   m_framingerrors = 0;
+  m_fcserrors = 0;
   m_lastgoodrxframe = 0;
+  m_starttime = 0;
   m_rxframecount = 0;
   m_txframecount = 0;
   }
@@ -272,112 +337,151 @@ uint32_t GsmMux::GoodFrameAge()
   return (m_lastgoodrxframe > 0) ? (monotonictime-m_lastgoodrxframe) : 0;
   }
 
+/**
+ * Process: fetch received bytes into the rx window & demultiplex them
+ *  The window holds two max size frames, so a partial frame can always be
+ *  completed after moving it to the window start.
+ */
 void GsmMux::Process(OvmsBuffer* buf)
   {
   while (buf->UsedSpace()>0)
     {
-    if (m_framepos == m_framesize)
+    if (m_rxsize - m_rxend < m_framesize && m_rxstart > 0)
       {
-      // Overflow frame
-      ESP_LOGW(TAG, "Frame overflow (%d bytes)",m_framesize);
-      MyCommandApp.HexDump(TAG, "Frame head", (const char*)m_frame, 8*16);
-      m_framepos = 0;
-      m_framelen = 0;
-      m_framemorelen = false;
-      m_framingerrors++;
+      // Move partial frame to the window start:
+      m_rxend -= m_rxstart;
+      memmove(m_rxbuf, m_rxbuf+m_rxstart, m_rxend);
+      m_rxstart = 0;
+      }
+    m_rxend += buf->Pop(m_rxsize - m_rxend, m_rxbuf + m_rxend);
+    Demux();
+    }
+  }
+
+/**
+ * Drain: retry processing the channel backlogs
+ */
+void GsmMux::Drain()
+  {
+  for (GsmMuxChannel* chan : m_channels)
+    {
+    if (chan) chan->Drain();
+    }
+  }
+
+/**
+ * Demux: decode & dispatch all complete frames in the rx window
+ *  Frames are passed to the channels in place, the closing flag is kept
+ *  as it may be shared with the next frame.
+ */
+void GsmMux::Demux()
+  {
+  while (m_rxstart < m_rxend)
+    {
+    uint8_t* frame = m_rxbuf + m_rxstart;
+    size_t avail = m_rxend - m_rxstart;
+
+    if (frame[0] != GSM0_SOF)
+      {
+      // Skip to start of frame
+      uint8_t* sof = (uint8_t*)memchr(frame, GSM0_SOF, avail);
+      m_rxstart = sof ? (sof - m_rxbuf) : m_rxend;
       continue;
       }
-    uint8_t b = buf->Pop();
-    if ((m_framepos == 0)&&(b != GSM0_SOF))
+    if (avail < 2) return;
+    if (frame[1] == GSM0_SOF)
       {
-      continue; // Skip to start of frame
+      // We found end of previous frame, so just skip it
+      m_rxstart++;
+      continue;
       }
-    if ((m_framepos == 1)&&(b == GSM0_SOF)) continue; // We found end of previous frame, so just skip it
-    // ESP_LOGI(TAG, "Got %02x at %d (length sofar = %d)",b,m_framepos,m_framelen);
-    m_frame[m_framepos++] = b;
-    if (m_framepos == 4)
+
+    // Decode length field:
+    if (avail < 4) return;
+    size_t ipos, framelen;
+    if (frame[3] & GSM_EA)
       {
-      // First byte of length field
-      m_framemorelen = !(b & GSM_EA);
-      m_framelen = (b>>1);
-      if (!m_framemorelen)
-        {
-        m_framelen += (m_framepos+2);
-        m_frameipos = m_framepos;
-        }
-      else
-        {
-        m_framelen += (m_framepos+3);
-        m_frameipos = m_framepos+1;
-        }
-      // ESP_LOGI(TAG, "Frame length (first byte) = %d",m_framelen);
+      ipos = 4;
+      framelen = (frame[3]>>1) + ipos + 2;
       }
-    if ((m_framepos == 5)&&(m_framemorelen))
+    else
       {
-      // Second byte of length field
-      m_framelen += (b<<7);
-      m_framemorelen = false;
-      // ESP_LOGI(TAG, "Frame length (second byte) = %d",m_framelen);
+      if (avail < 5) return;
+      ipos = 5;
+      framelen = (frame[3]>>1) + (frame[4]<<7) + ipos + 2;
       }
-    if (m_framepos == m_framelen)
+    if (framelen > m_framesize)
       {
-      if (b == GSM0_SOF)
-        {
-        // We have a complete frame...
-        ProcessFrame();
-        }
-      else
-        {
-        // Frame error:
-        int channel = m_frame[1] >> 2;
-        ESP_LOGW(TAG, "Frame error: EOF mismatch (CHAN=%d, ADDR=%02x, CTRL=%02x, FCS=%02x, LEN=%d)",
-          channel, m_frame[1], m_frame[2], m_frame[m_framelen-2], m_framelen);
-        MyCommandApp.HexDump(TAG, "Frame dump", (const char*)m_frame, m_framelen);
-        // find next frame:
-        m_framepos = 0;
-        m_framelen = 0;
-        m_framemorelen = false;
-        m_framingerrors++;
-        }
+      ESP_LOGW(TAG, "Frame overflow (%d bytes)",framelen);
+      MyCommandApp.HexDump(TAG, "Frame head", (const char*)frame, (avail < 8*16) ? avail : 8*16);
+      m_framingerrors++;
+      m_rxstart++;
+      continue;
       }
+    if (avail < framelen) return;
+
+    if (frame[framelen-1] == GSM0_SOF)
+      {
+      // We have a complete frame...
+      ProcessFrame(frame, framelen, ipos);
+      }
+    else
+      {
+      // Frame error:
+      int channel = frame[1] >> 2;
+      ESP_LOGW(TAG, "Frame error: EOF mismatch (CHAN=%d, ADDR=%02x, CTRL=%02x, FCS=%02x, LEN=%d)",
+        channel, frame[1], frame[2], frame[framelen-2], framelen);
+      MyCommandApp.HexDump(TAG, "Frame dump", (const char*)frame, framelen);
+      m_framingerrors++;
+      }
+    // Find next frame:
+    m_rxstart += framelen-1;
     }
   }
 
-void GsmMux::ProcessFrame()
+void GsmMux::ProcessFrame(const uint8_t* frame, size_t framelen, size_t ipos)
   {
-  int channel = m_frame[1] >>2;
+  int channel = frame[1] >>2;
 
   ESP_LOGV(TAG, "ProcessFrame(CHAN=%d, ADDR=%02x, CTRL=%02x, FCS=%02x, LEN=%d)",
-    channel, m_frame[1], m_frame[2], m_frame[m_framelen-2], m_framelen);
+    channel, frame[1], frame[2], frame[framelen-2], framelen);
 
-  uint8_t fcs = 0xFF - gsm_fcs_add_block(FCS_INIT, m_frame+1, m_frameipos-1);
-  if (fcs != m_frame[m_framelen-2])
+  uint8_t fcs = 0xFF - gsm_fcs_add_block(FCS_INIT, frame+1, ipos-1);
+  if (fcs != frame[framelen-2])
     {
-    ESP_LOGW(TAG, "FCS mismatch (%02x != %02x)",fcs,m_frame[m_framelen-2]);
-    m_framepos = 0;
-    m_frameipos = 0;
-    m_framelen = 0;
+    ESP_LOGW(TAG, "FCS mismatch (%02x != %02x)",fcs,frame[framelen-2]);
     m_framingerrors++;
-    m_framemorelen = false;
+    m_fcserrors++;
     return;
     }
 
-  GsmMuxChannel* chan = m_channels[channel];
+  GsmMuxChannel* chan = ((size_t)channel < m_channels.size()) ? m_channels[channel] : NULL;
   if (chan)
     {
     m_lastgoodrxframe = monotonictime;
     m_rxframecount++;
-    chan->ProcessFrame(m_frame+1,m_framelen-3,m_frameipos-1);
+    chan->ProcessFrame(frame+1,framelen-3,ipos-1);
     }
   else
     {
     ESP_LOGW(TAG, "Incoming message for unrecognised channel #%d",channel);
     }
+  }
 
-  m_framepos = 0;
-  m_frameipos = 0;
-  m_framelen = 0;
-  m_framemorelen = false;
+/**
+ * FlowControl: ask the modem to stop/resume sending on a channel
+ *  (MSC command on the control channel, FC bit set = stop)
+ */
+void GsmMux::FlowControl(int channel, bool stop)
+  {
+  uint8_t msc[] =
+    {
+    (uint8_t)((GSM_CMD_MSC<<1)|GSM_CR|GSM_EA),  // Type: MSC command
+    (2<<1)+GSM_EA,                              // Length: 2
+    (uint8_t)((channel<<2)+GSM_CR+GSM_EA),      // DLCI
+    (uint8_t)(((GSM_MDM_RTC+GSM_MDM_RTR+GSM_MDM_DV+(stop ? GSM_MDM_FC : 0))<<1)+GSM_EA)
+    };
+  tx(0, msc, sizeof(msc));
   }
 
 void GsmMux::txfcs(uint8_t* data, size_t size, size_t ipos)
@@ -420,6 +524,12 @@ size_t GsmMux::tx(int channel, uint8_t* data, ssize_t size)
   txfcs(buf,ipos+size+2,ipos);
   delete [] buf;
 
+  if ((size_t)channel < m_channels.size() && m_channels[channel])
+    {
+    m_channels[channel]->m_txframes++;
+    m_channels[channel]->m_txbytes += size;
+    }
+
   return size;
   }
 
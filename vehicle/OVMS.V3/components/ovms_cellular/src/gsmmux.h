@@ -39,6 +39,17 @@
 class modem; // Forward declared
 class GsmMux; // Forward declared
 
+/**
+ * GsmMuxChannel: one DLCI of the multiplexer
+ *
+ * Received UIH payloads are delivered as spans (pointing into the mux rx
+ * window) to modem::IncomingMuxSpan() first. Bytes not consumed there (line
+ * oriented channels, or a stream consumer that can't take more data) are
+ * appended to the channel buffer and processed by modem::IncomingMuxData().
+ * While the backlog of a stream channel exceeds 3/4 of the buffer, the modem
+ * is asked to stop sending on the channel (MSC flow control), until the
+ * backlog drops below 1/4.
+ */
 class GsmMuxChannel : public InternalRamAllocated
   {
   public:
@@ -55,13 +66,28 @@ class GsmMuxChannel : public InternalRamAllocated
       };
 
   public:
-    void ProcessFrame(uint8_t* frame, size_t length, size_t iframepos);
+    void ProcessFrame(const uint8_t* frame, size_t length, size_t iframepos);
+    void Deliver(const uint8_t* data, size_t length);
+    void Drain();
+
+  protected:
+    void CheckFlow();
 
   public:
     GsmMuxChannelState m_state;
     GsmMux* m_mux;
     int m_channel;
     OvmsBuffer m_buffer;
+    bool m_stream;                  // Consumer takes spans (not line oriented)
+    bool m_flowoff;                 // MSC flow control asserted
+
+  public:
+    uint32_t m_rxframes;
+    uint32_t m_rxbytes;
+    uint32_t m_txframes;
+    uint32_t m_txbytes;
+    uint32_t m_rxdropped;           // Bytes lost due to a full channel buffer
+    uint32_t m_flowoffcount;
   };
 
 class GsmMux : public InternalRamAllocated
@@ -76,7 +102,8 @@ class GsmMux : public InternalRamAllocated
     void StartChannel(int channel);
     void StopChannel(int channel);
     void Process(OvmsBuffer* buf);
-    void ProcessFrame();
+    void Drain();
+    void FlowControl(int channel, bool stop);
     size_t tx(int channel, uint8_t* data, ssize_t size);
     size_t tx(int channel, const char* data, ssize_t size = -1);
     bool IsChannelOpen(int channel);
@@ -84,6 +111,8 @@ class GsmMux : public InternalRamAllocated
     uint32_t GoodFrameAge();
 
   protected:
+    void Demux();
+    void ProcessFrame(const uint8_t* frame, size_t framelen, size_t ipos);
     void txfcs(uint8_t* data, size_t size, size_t ipos = 4);
 
   public:
@@ -100,18 +129,19 @@ class GsmMux : public InternalRamAllocated
     int m_channelcount;
     int m_openchannels;
     uint32_t m_framingerrors;
+    uint32_t m_fcserrors;
     uint32_t m_lastgoodrxframe;
+    uint32_t m_starttime;
     uint32_t m_rxframecount;
     uint32_t m_txframecount;
 
   public:
     modem* m_modem;
-    uint8_t* m_frame;
-    size_t m_framesize;
-    size_t m_framepos;
-    size_t m_frameipos;
-    size_t m_framelen;
-    bool m_framemorelen;
+    size_t m_framesize;             // Max frame size
+    uint8_t* m_rxbuf;               // RX window, frames are decoded in place
+    size_t m_rxsize;                // RX window size (2 * max frame size)
+    size_t m_rxstart;               // Start of undecoded data
+    size_t m_rxend;                 // End of received data
     std::vector<GsmMuxChannel*> m_channels;
   };
 
@@ -182,10 +182,11 @@ GsmPPPOS::~GsmPPPOS()
     }
   }
 
-void GsmPPPOS::IncomingData(uint8_t *data, size_t len)
+bool GsmPPPOS::IncomingData(const uint8_t *data, size_t len)
   {
   MyCommandApp.HexDump(TAG, "rx", (const char*)data, len);
-  pppos_input_tcpip(m_ppp, (u8_t*)data, (int)len);
+  // Fails if the TCP/IP stack is out of buffers, the caller keeps the data:
+  return (pppos_input_tcpip(m_ppp, (u8_t*)data, (int)len) == ERR_OK);
   }
 
 void GsmPPPOS::Initialise(GsmMux* mux, int channel)
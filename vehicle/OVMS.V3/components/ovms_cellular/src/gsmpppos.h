@@ -52,7 +52,7 @@ class GsmPPPOS : public InternalRamAllocated
     ~GsmPPPOS();
 
   public:
-    void IncomingData(uint8_t *data, size_t len);
+    bool IncomingData(const uint8_t *data, size_t len);
     void Initialise(GsmMux* mux, int channel);
     void Startup();
     void Shutdown(bool hard=false);
@@ -438,9 +438,21 @@ void modem::SupportSummary(OvmsWriter* writer, bool debug /*=FALSE*/)
       {
       writer->printf("    Open Channels: %d\n", m_mux->m_openchannels);
       writer->printf("    Framing Errors: %d\n", m_mux->m_framingerrors);
+      writer->printf("    FCS Errors: %d\n", m_mux->m_fcserrors);
       writer->printf("    RX frames: %d\n", m_mux->m_rxframecount);
       writer->printf("    TX frames: %d\n", m_mux->m_txframecount);
       writer->printf("    Last RX frame: %d sec(s) ago\n", m_mux->GoodFrameAge());
+      uint32_t uptime = (m_mux->m_starttime > 0 && monotonictime > m_mux->m_starttime)
+        ? monotonictime - m_mux->m_starttime : 1;
+      writer->puts("    Channel  RX frames  RX bytes  RX B/s  TX frames  TX bytes  Dropped  Backlog  FlowOff");
+      for (GsmMuxChannel* chan : m_mux->m_channels)
+        {
+        if (!chan) continue;
+        writer->printf("    #%-6d  %9u  %8u  %6u  %9u  %8u  %7u  %7u  %6u%s\n",
+          chan->m_channel, chan->m_rxframes, chan->m_rxbytes, chan->m_rxbytes / uptime,
+          chan->m_txframes, chan->m_txbytes, chan->m_rxdropped, chan->m_buffer.UsedSpace(),
+          chan->m_flowoffcount, chan->m_flowoff ? "*" : "");
+        }
       }
     }
   else
@@ -768,6 +780,9 @@ modem::modem_state1_t modem::State1Activity()
 
 modem::modem_state1_t modem::State1Ticker1()
   {
+  if (m_mux != NULL)
+    { m_mux->Drain(); }
+
   if ((m_mux != NULL)&&(m_mux->GoodFrameAge() > 180)&&(m_state1 != Development))
     {
     // Mux is up, but we haven't had a good MUX frame in 3 minutes.
@@ -1408,6 +1423,28 @@ void modem::EventListener(std::string event, void* data)
     }
   }
 
+/**
+ * IncomingMuxSpan: zero-copy delivery of a frame payload
+ *  Returns the number of bytes consumed by a stream consumer (the rest is
+ *  kept as a backlog), or -1 for line oriented channels. Unconsumed data is
+ *  appended to the channel buffer and processed by IncomingMuxData().
+ */
+int modem::IncomingMuxSpan(GsmMuxChannel* channel, const uint8_t* data, size_t length)
+  {
+  if (channel->m_channel == m_mux_channel_CTRL)
+    {
+    return length;
+    }
+  else if (channel->m_channel == m_mux_channel_DATA)
+    {
+    if ((m_state1 == NetMode)&&(m_ppp != NULL))
+      {
+      return m_ppp->IncomingData(data, length) ? length : 0;
+      }
+    }
+  return -1;
+  }
+
 void modem::IncomingMuxData(GsmMuxChannel* channel)
   {
   // The MUX has indicated there is data on the specified channel
@@ -1437,11 +1474,12 @@ void modem::IncomingMuxData(GsmMuxChannel* channel)
     {
     if (m_state1 == NetMode)
       {
-      uint8_t buf[32];
+      uint8_t buf[128];
       size_t n;
-      while ((m_ppp != NULL)&&(n = channel->m_buffer.Pop(sizeof(buf),buf)) > 0)
+      while ((m_ppp != NULL)&&(n = channel->m_buffer.Peek(sizeof(buf),buf)) > 0)
         {
-        m_ppp->IncomingData(buf,n);
+        if (!m_ppp->IncomingData(buf,n)) break; // Retry on next frame / ticker
+        channel->m_buffer.Pop(n,buf);
         }
       }
     else
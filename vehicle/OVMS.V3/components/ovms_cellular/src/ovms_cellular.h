@@ -195,6 +195,7 @@ class modem : public pcp, public InternalRamAllocated
     void Task();
     void Ticker(std::string event, void* data);
     void EventListener(std::string event, void* data);
+    int IncomingMuxSpan(GsmMuxChannel* channel, const uint8_t* data, size_t length);
     void IncomingMuxData(GsmMuxChannel* channel);
     void SendSetState1(modem_state1_t newstate);
     bool IsStarted();
@@ -40,6 +40,7 @@ static const char *TAG = "location";
 #include "vehicle.h"
 #include "metrics_standard.h"
 #include <math.h>
+#include <algorithm>
 
 const char *LOCATIONS_PARAM = "locations";
 #define LOCATION_DEFRADIUS 100
@@ -47,6 +48,12 @@ const char *LOCATIONS_PARAM = "locations";
 #define LOCATION_R 6371
 #define LOCATION_TO_RAD (3.1415926536 / 180)
 
+// Spatial index grid:
+#define LOCATION_GRID_CELL      0.01      // cell size in degrees (~1.1 km latitude)
+#define LOCATION_GRID_COLS      36001     // cells per row (360 / LOCATION_GRID_CELL + 1)
+#define LOCATION_GRID_MAXCELLS  256       // locations covering more cells go to the wide list
+#define LOCATION_BOUNDS_MARGIN  0.0001    // degrees, covers float rounding (~11 m)
+
 // Calculate haversine distance in meters
 double OvmsLocationDistance(double th1, double ph1, double th2, double ph2)
   {
@@ -132,22 +139,71 @@ ActionList::iterator ActionList::erase(iterator pos)
 OvmsLocation::OvmsLocation(const std::string& name)
   {
   m_name = name;
+  m_latitude = 0;
+  m_longitude = 0;
+  m_radius = LOCATION_DEFRADIUS;
   m_inlocation = false;
+  m_lat_min = -90;
+  m_lat_max = 90;
+  m_lon_min = -180;
+  m_lon_max = 180;
+  m_indexed = false;
+  m_cell_row0 = m_cell_row1 = -1;
+  m_cell_col0 = m_cell_col1 = -1;
+  m_checkpass = 0;
   }
 
 OvmsLocation::~OvmsLocation()
   {
   }
 
-bool OvmsLocation::IsInLocation(float latitude, float longitude)
+/**
+ * UpdateBounds: calculate the bounding box of the location radius
+ *  (needs to be called after changing the position or radius)
+ */
+void OvmsLocation::UpdateBounds()
   {
-  // This should check if we are in the location
-  double dist = OvmsLocationDistance((double)latitude,(double)longitude,(double)m_latitude,(double)m_longitude);
-  std::string event;
+  double r = (double)m_radius / (LOCATION_R * 1000.0);  // angular radius [rad]
+  double lat = m_latitude * LOCATION_TO_RAD;
+  double dlat = r / LOCATION_TO_RAD + LOCATION_BOUNDS_MARGIN;
+  m_lat_min = m_latitude - dlat;
+  m_lat_max = m_latitude + dlat;
+  if (m_lat_min <= -90 || m_lat_max >= 90 || cos(lat) <= sin(r))
+    {
+    // Circle includes a pole: all longitudes
+    if (m_lat_min < -90) m_lat_min = -90;
+    if (m_lat_max > 90) m_lat_max = 90;
+    m_lon_min = -180;
+    m_lon_max = 180;
+    }
+  else
+    {
+    double dlon = asin(sin(r) / cos(lat)) / LOCATION_TO_RAD + LOCATION_BOUNDS_MARGIN;
+    m_lon_min = m_longitude - dlon;
+    m_lon_max = m_longitude + dlon;
+    }
+  }
 
+/**
+ * Contains: check if a position is within the location radius
+ */
+bool OvmsLocation::Contains(float latitude, float longitude)
+  {
+  if (latitude < m_lat_min || latitude > m_lat_max)
+    return false;
+  if ((longitude < m_lon_min || longitude > m_lon_max) &&
+      (longitude - 360 < m_lon_min) && (longitude + 360 > m_lon_max))
+    return false;
+  double dist = OvmsLocationDistance((double)latitude,(double)longitude,(double)m_latitude,(double)m_longitude);
   // ESP_LOGI(TAG, "Location %s is %0.1fm distant",m_name.c_str(),dist);
+  return (fabs(dist) <= m_radius);
+  }
 
-  if (fabs(dist) <= m_radius)
+bool OvmsLocation::IsInLocation(float latitude, float longitude)
+  {
+  std::string event;
+
+  if (Contains(latitude, longitude))
     {
     // We are in the location
     if (!m_inlocation)
@@ -451,8 +507,12 @@ void location_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int ar
       MyLocations.m_park_latitude,
       MyLocations.m_park_longitude);
   n = MyLocations.m_locations.size();
-  writer->printf("There %s %d location%s defined\n",
+  writer->printf("There %s %d location%s defined",
     n == 1 ? "is" : "are", n, n == 1 ? "" : "s");
+  if (n > 0)
+    writer->printf(" (index: %d grid cells, %d wide)",
+      (int)MyLocations.m_index.GetCellCount(), (int)MyLocations.m_index.GetWide().size());
+  writer->puts("");
 
   bool found = false;
   for (LocationMap::iterator it=MyLocations.m_locations.begin(); it!=MyLocations.m_locations.end(); ++it)
@@ -596,6 +656,105 @@ void location_all(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
   location_action(verbosity, writer, act, params);
   }
 
+OvmsLocationIndex::OvmsLocationIndex()
+  {
+  }
+
+static inline int LocationGridRow(float latitude)
+  {
+  return (int)floor((latitude + 90.0) / LOCATION_GRID_CELL);
+  }
+
+static inline int LocationGridCol(float longitude)
+  {
+  return (int)floor((longitude + 180.0) / LOCATION_GRID_CELL);
+  }
+
+/**
+ * Add: (re-)calculate the location bounds and register it in the grid
+ */
+void OvmsLocationIndex::Add(OvmsLocation* loc)
+  {
+  if (loc->m_indexed)
+    Remove(loc);
+  loc->UpdateBounds();
+  loc->m_indexed = true;
+
+  int row0 = LocationGridRow(loc->m_lat_min), row1 = LocationGridRow(loc->m_lat_max);
+  int col0 = LocationGridCol(loc->m_lon_min), col1 = LocationGridCol(loc->m_lon_max);
+  if (loc->m_lon_min < -180 || loc->m_lon_max >= 180 ||
+      (row1-row0+1) * (col1-col0+1) > LOCATION_GRID_MAXCELLS)
+    {
+    loc->m_cell_row0 = loc->m_cell_row1 = -1;
+    loc->m_cell_col0 = loc->m_cell_col1 = -1;
+    m_wide.push_back(loc);
+    return;
+    }
+
+  loc->m_cell_row0 = row0;
+  loc->m_cell_row1 = row1;
+  loc->m_cell_col0 = col0;
+  loc->m_cell_col1 = col1;
+  for (int row = row0; row <= row1; row++)
+    {
+    for (int col = col0; col <= col1; col++)
+      m_grid[row * LOCATION_GRID_COLS + col].push_back(loc);
+    }
+  }
+
+/**
+ * Remove: unregister the location, using the cells it has been added to
+ */
+void OvmsLocationIndex::Remove(OvmsLocation* loc)
+  {
+  if (!loc->m_indexed)
+    return;
+  loc->m_indexed = false;
+
+  if (loc->m_cell_row0 < 0)
+    {
+    m_wide.erase(std::remove(m_wide.begin(), m_wide.end(), loc), m_wide.end());
+    return;
+    }
+
+  for (int row = loc->m_cell_row0; row <= loc->m_cell_row1; row++)
+    {
+    for (int col = loc->m_cell_col0; col <= loc->m_cell_col1; col++)
+      {
+      auto it = m_grid.find(row * LOCATION_GRID_COLS + col);
+      if (it == m_grid.end())
+        continue;
+      LocationList& list = it->second;
+      list.erase(std::remove(list.begin(), list.end(), loc), list.end());
+      if (list.empty())
+        m_grid.erase(it);
+      }
+    }
+  }
+
+void OvmsLocationIndex::Clear()
+  {
+  for (auto& cell : m_grid)
+    {
+    for (OvmsLocation* loc : cell.second)
+      loc->m_indexed = false;
+    }
+  for (OvmsLocation* loc : m_wide)
+    loc->m_indexed = false;
+  m_grid.clear();
+  m_wide.clear();
+  }
+
+/**
+ * FindCell: get the grid locations possibly containing a position
+ *  (NULL if none; the wide list needs to be checked additionally)
+ */
+const LocationList* OvmsLocationIndex::FindCell(float latitude, float longitude) const
+  {
+  auto it = m_grid.find(LocationGridRow(latitude) * LOCATION_GRID_COLS + LocationGridCol(longitude));
+  return (it == m_grid.end()) ? NULL : &it->second;
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
 static duk_ret_t DukOvmsLocationStatus(duk_context *ctx)
@@ -630,6 +789,7 @@ OvmsLocations::OvmsLocations()
   m_park_distance = 0;
   m_park_invalid = true;
   m_last_alarm = 0;
+  m_checkpass = 0;
 
   // Register our commands
   OvmsCommand* cmd_location = MyCommandApp.RegisterCommand("location","LOCATION framework", location_status, "", 0, 0, false);
@@ -792,20 +952,25 @@ void OvmsLocations::ReloadMap()
       {
       // Create it
       loc = new OvmsLocation(name);
-      m_locations[name] = loc;
+      k = m_locations.insert(std::make_pair(name, loc)).first;
       }
     else
+      {
       loc = k->second;
+      // Skip unchanged locations:
+      if (loc->m_value == value) continue;
+      }
     // Parse the parameters
     if (!loc->Parse(value))
       {
       ESP_LOGE(TAG, "Location %s is invalid: %s", name.c_str(), value.c_str());
-      delete loc;
-      m_locations.erase(name);
+      RemoveLocation(k);
       }
     else
       {
       // ESP_LOGI(TAG, "Location %s is at %f,%f (%d)", name.c_str(), loc->m_latitude, loc->m_longitude, loc->m_radius);
+      loc->m_value = value;
+      m_index.Add(loc);
       }
     }
 
@@ -817,8 +982,7 @@ void OvmsLocations::ReloadMap()
       {
       // Location no longer exists
       // ESP_LOGI(TAG, "Location %s is removed",it->first.c_str());
-      delete it->second;
-      it = m_locations.erase(it);
+      it = RemoveLocation(it);
       }
     else
       {
@@ -829,14 +993,44 @@ void OvmsLocations::ReloadMap()
   if (m_gpsgood) UpdateLocations();
   }
 
+LocationMap::iterator OvmsLocations::RemoveLocation(LocationMap::iterator it)
+  {
+  OvmsLocation* loc = it->second;
+  m_index.Remove(loc);
+  m_inside.erase(std::remove(m_inside.begin(), m_inside.end(), loc), m_inside.end());
+  delete loc;
+  return m_locations.erase(it);
+  }
+
 void OvmsLocations::UpdateLocations()
   {
   if ((m_latitude == 0) && (m_longitude == 0)) return;
 
-  for (LocationMap::iterator it=m_locations.begin(); it!=m_locations.end(); ++it)
+  // Only the locations we're in (for leaving) and the candidates from the
+  // spatial index (for entering) need to be checked. Each location is
+  // checked once per pass.
+  uint32_t pass = ++m_checkpass;
+  LocationList inside;
+  auto check = [&](OvmsLocation* loc)
     {
-    it->second->IsInLocation(m_latitude,m_longitude);
+    if (loc->m_checkpass == pass) return;
+    loc->m_checkpass = pass;
+    if (loc->IsInLocation(m_latitude,m_longitude))
+      inside.push_back(loc);
+    };
+
+  for (OvmsLocation* loc : m_inside)
+    check(loc);
+  const LocationList* cell = m_index.FindCell(m_latitude, m_longitude);
+  if (cell)
+    {
+    for (OvmsLocation* loc : *cell)
+      check(loc);
     }
+  for (OvmsLocation* loc : m_index.GetWide())
+    check(loc);
+
+  m_inside.swap(inside);
   }
 
 void OvmsLocations::CheckTheft()
@@ -31,10 +31,14 @@
 #ifndef __LOCATION_H__
 #define __LOCATION_H__
 
+#include <vector>
+#include <unordered_map>
 #include "ovms_metrics.h"
 #include "ovms_utils.h"
 #include "ovms_command.h"
 
+double OvmsLocationDistance(double th1, double ph1, double th2, double ph2);
+
 enum LocationAction {
   INVALID = 0,
   HOMELINK,
@@ -71,6 +75,8 @@ class OvmsLocation
 
   public:
     bool IsInLocation(float latitude, float longitude);
+    bool Contains(float latitude, float longitude);
+    void UpdateBounds();
     bool Parse(const std::string& value);
     void Store(std::string& buf);
     void Render(std::string& buf);
@@ -83,9 +89,47 @@ class OvmsLocation
     int m_radius;
     bool m_inlocation;
     ActionList m_actions;
+
+  public:
+    // Bounding box of the radius (degrees), for cheap pre-rejection:
+    float m_lat_min, m_lat_max;
+    float m_lon_min, m_lon_max;
+    // Grid index state, managed by OvmsLocationIndex:
+    bool m_indexed;
+    int m_cell_row0, m_cell_row1;         // row0 < 0 = not in grid (wide list)
+    int m_cell_col0, m_cell_col1;
+    uint32_t m_checkpass;                 // last UpdateLocations() pass
   };
 
 typedef NameMap<OvmsLocation*> LocationMap;
+typedef std::vector<OvmsLocation*> LocationList;
+
+/**
+ * OvmsLocationIndex: fixed grid spatial index over the locations
+ *
+ * The grid divides the world into cells of LOCATION_GRID_CELL degrees. Each
+ * location is registered in all cells its bounding box overlaps, so a position
+ * lookup only needs to check the locations of a single cell. Locations with
+ * very large radius or crossing the date line are kept in a separate list
+ * checked on every lookup.
+ */
+class OvmsLocationIndex
+  {
+  public:
+    OvmsLocationIndex();
+
+  public:
+    void Add(OvmsLocation* loc);
+    void Remove(OvmsLocation* loc);
+    void Clear();
+    const LocationList* FindCell(float latitude, float longitude) const;
+    const LocationList& GetWide() const { return m_wide; }
+    size_t GetCellCount() const { return m_grid.size(); }
+
+  protected:
+    std::unordered_map<uint32_t, LocationList> m_grid;
+    LocationList m_wide;
+  };
 
 class OvmsLocations
   {
@@ -106,9 +150,13 @@ class OvmsLocations
     bool m_park_invalid;
     uint32_t m_last_alarm;
     LocationMap m_locations;
+    OvmsLocationIndex m_index;
+    LocationList m_inside;                // locations we're currently in
+    uint32_t m_checkpass;
 
   public:
     void ReloadMap();
+    LocationMap::iterator RemoveLocation(LocationMap::iterator it);
     void UpdateLocations();
     void UpdateParkPosition();
     void CheckTheft();
@@ -38,6 +38,7 @@ static const char *TAG = "script";
 #include <stdio.h>
 #include <dirent.h>
 #include <esp_task_wdt.h>
+#include <esp_timer.h>
 #include "ovms_malloc.h"
 #include "ovms_module.h"
 #include "ovms_script.h"
@@ -137,6 +138,12 @@ static void script_ovms(int verbosity, OvmsWriter* writer,
     }
   }
 
+static void script_reindex(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyScripts.BuildEventIndex();
+  MyScripts.EventIndexStatus(writer);
+  }
+
 static void script_run(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   FILE *sf = NULL;
@@ -170,30 +177,50 @@ static void script_run(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int
   script_ovms(verbosity, writer, path.c_str(), sf, writer->IsSecure());
   }
 
-void OvmsScripts::AllScripts(std::string path)
+// Event script base directories, in execution order:
+static const char* const script_event_dirs[] =
+  {
+#ifdef CONFIG_OVMS_DEV_SDCARDSCRIPTS
+  "/sd/events",
+#endif // #ifdef CONFIG_OVMS_DEV_SDCARDSCRIPTS
+  "/store/events",
+  };
+#define SCRIPT_EVENT_DIRS (sizeof(script_event_dirs) / sizeof(script_event_dirs[0]))
+
+/**
+ * script_readdir: read directory, add entry paths to files (sorted by name)
+ *  Returns false if the directory does not exist.
+ */
+static bool script_readdir(const std::string& path, std::set<std::string>& files)
   {
   DIR *dir;
   struct dirent *dp;
-  FILE *sf;
-  std::set<std::string> files;
 
-  // read dir, sort scripts by name:
-  if ((dir = opendir (path.c_str())) != NULL)
+  if ((dir = opendir (path.c_str())) == NULL)
+    return false;
+  while ((dp = readdir (dir)) != NULL)
     {
-    while ((dp = readdir (dir)) != NULL)
-      {
-      std::string fpath = path;
-      fpath.append("/");
-      fpath.append(dp->d_name);
-      files.insert(fpath);
-      }
-    closedir(dir);
+    std::string fpath = path;
+    fpath.append("/");
+    fpath.append(dp->d_name);
+    files.insert(fpath);
     }
+  closedir(dir);
+  return true;
+  }
+
+void OvmsScripts::AllScripts(std::string path)
+  {
+  std::set<std::string> files;
+  script_readdir(path, files);
+  RunScripts(std::vector<std::string>(files.begin(), files.end()));
+  }
 
-  // execute scripts:
-  for (auto it = files.begin(); it != files.end(); it++)
+void OvmsScripts::RunScripts(const std::vector<std::string>& files)
+  {
+  FILE *sf;
+  for (const std::string& fpath : files)
     {
-    std::string fpath = *it;
     sf = fopen(fpath.c_str(), "r");
     if (sf)
       {
@@ -204,37 +231,131 @@ void OvmsScripts::AllScripts(std::string path)
     }
   }
 
+/**
+ * EventScript: run the scripts registered for an event
+ *  Script directories are looked up in the event script index, so events without
+ *  scripts don't cause any file I/O.
+ */
 void OvmsScripts::EventScript(std::string event, void* data)
   {
-  std::string path;
-
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   MyDuktape.EventScript(event, data);
 #endif // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
-#ifdef CONFIG_OVMS_DEV_SDCARDSCRIPTS
-  // run event scripts on external storage:
-  path=std::string("/sd/events/");
-  path.append(event);
-  AllScripts(path);
-#endif // #ifdef CONFIG_OVMS_DEV_SDCARDSCRIPTS
+  std::vector<std::string> scripts;
+    {
+    OvmsRecMutexLock lock(&m_event_index_mutex);
+    if (!m_event_index_valid)
+      BuildEventIndex();
+    auto it = m_event_index.find(event);
+    if (it == m_event_index.end())
+      return;
+    scripts = it->second;
+    }
+  RunScripts(scripts);
+  }
+
+/**
+ * BuildEventIndex: scan the event script directories
+ *  Called on the first event after an invalidation. Also measures the cost of
+ *  a (failing) event directory lookup, i.e. the I/O each event needs without the index.
+ */
+void OvmsScripts::BuildEventIndex()
+  {
+  OvmsRecMutexLock lock(&m_event_index_mutex);
+  m_event_index.clear();
+  m_event_index_dirs = 0;
+  m_event_index_valid = true;
+
+  int64_t probe_time = 0;
+  int probes = 0;
+  for (size_t i = 0; i < SCRIPT_EVENT_DIRS; i++)
+    {
+    std::string base = script_event_dirs[i];
+    std::set<std::string> events, none;
+    int64_t started = esp_timer_get_time();
+    script_readdir(base + "/-", none);
+    probe_time += esp_timer_get_time() - started;
+    probes++;
+    if (!script_readdir(base, events))
+      continue;
+    m_event_index_dirs++;
+
+    for (const std::string& evpath : events)
+      {
+      std::string event = evpath.substr(base.size()+1);
+      std::set<std::string> files;
+      if (event == "." || event == ".." || !script_readdir(evpath, files) || files.empty())
+        continue;
+      std::vector<std::string>& scripts = m_event_index[event];
+      scripts.insert(scripts.end(), files.begin(), files.end());
+      }
+    }
+  m_event_probe_us = probes ? probe_time / probes : 0;
+
+  ESP_LOGD(TAG, "BuildEventIndex: %d events with scripts, directory lookup takes %u us",
+    m_event_index.size(), m_event_probe_us);
+  }
+
+void OvmsScripts::InvalidateEventIndex()
+  {
+  OvmsRecMutexLock lock(&m_event_index_mutex);
+  m_event_index_valid = false;
+  }
+
+void OvmsScripts::EventListener(std::string event, void* data)
+  {
+  if (event == "system.vfs.file.changed")
+    {
+    const char* path = (const char*)data;
+    for (size_t i = 0; path && i < SCRIPT_EVENT_DIRS; i++)
+      {
+      if (strncmp(path, script_event_dirs[i], strlen(script_event_dirs[i])) == 0)
+        InvalidateEventIndex();
+      }
+    }
+  else
+    {
+    // config.mounted, sd.mounted, sd.unmounted
+    InvalidateEventIndex();
+    }
+  }
 
-  // run event scripts on internal storage:
-  path=std::string("/store/events/");
-  path.append(event);
-  AllScripts(path);
+void OvmsScripts::EventIndexStatus(OvmsWriter* writer)
+  {
+  OvmsRecMutexLock lock(&m_event_index_mutex);
+  if (!m_event_index_valid)
+    {
+    writer->puts("Event script index: not built");
+    return;
+    }
+  int scripts = 0;
+  for (auto& kv : m_event_index)
+    scripts += kv.second.size();
+  writer->printf("Event script index: %d of %d directories, %d events with %d scripts, lookup %u us\n",
+    m_event_index_dirs, SCRIPT_EVENT_DIRS, m_event_index.size(), scripts, m_event_probe_us);
+  if (scripts)
+    {
+    for (auto& kv : m_event_index)
+      writer->printf("  %s: %d script(s)\n", kv.first.c_str(), kv.second.size());
+    }
   }
 
 OvmsScripts::OvmsScripts()
   {
   ESP_LOGI(TAG, "Initialising SCRIPTS (1600)");
 
+  m_event_index_valid = false;
+  m_event_index_dirs = 0;
+  m_event_probe_us = 0;
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_NONE
   ESP_LOGI(TAG, "No javascript engines enabled (command scripting only)");
 #endif //#ifdef CONFIG_OVMS_SC_JAVASCRIPT_NONE
 
   OvmsCommand* cmd_script = MyCommandApp.RegisterCommand("script","SCRIPT framework");
   cmd_script->RegisterCommand("run","Run a script",script_run,"<path>",1,1);
+  cmd_script->RegisterCommand("reindex","Rebuild the event script index",script_reindex);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   cmd_script->RegisterCommand("reload","Reload javascript framework",script_reload);
   cmd_script->RegisterCommand("eval","Eval some javascript code",script_eval,"<code>",1,1);
@@ -242,6 +363,16 @@ OvmsScripts::OvmsScripts()
   cmd_script->RegisterCommand("meminfo","Show heap memory status",script_meminfo);
 #endif // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   MyCommandApp.RegisterCommand(".","Run a script",script_run,"<path>",1,1);
+
+  #undef bind  // Kludgy, but works
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEvent(TAG, "system.vfs.file.changed", std::bind(&OvmsScripts::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&OvmsScripts::EventListener, this, _1, _2));
+#ifdef CONFIG_OVMS_DEV_SDCARDSCRIPTS
+  MyEvents.RegisterEvent(TAG, "sd.mounted", std::bind(&OvmsScripts::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "sd.unmounted", std::bind(&OvmsScripts::EventListener, this, _1, _2));
+#endif // #ifdef CONFIG_OVMS_DEV_SDCARDSCRIPTS
   }
 
 OvmsScripts::~OvmsScripts()
@@ -31,8 +31,11 @@
 #ifndef __SCRIPT_H__
 #define __SCRIPT_H__
 
+#include <map>
+#include <vector>
 #include "ovms_command.h"
 #include "ovms_utils.h"
+#include "ovms_mutex.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -51,6 +54,23 @@ class OvmsScripts
   public:
     void EventScript(std::string event, void* data);
     void AllScripts(std::string path);
+    void RunScripts(const std::vector<std::string>& files);
+
+  public:
+    void EventListener(std::string event, void* data);
+    void InvalidateEventIndex();
+    void BuildEventIndex();
+    void EventIndexStatus(OvmsWriter* writer);
+
+  protected:
+    // Event script index: event name → script paths (sorted, /sd before /store),
+    //  only events having scripts are included
+    typedef std::map<std::string, std::vector<std::string>> EventScriptIndex;
+    OvmsRecMutex      m_event_index_mutex;
+    EventScriptIndex  m_event_index;
+    bool              m_event_index_valid;
+    int               m_event_index_dirs;         // event script base dirs indexed
+    uint32_t          m_event_probe_us;           // avg time of a directory lookup [us]
   };
 
 extern OvmsScripts MyScripts;
@@ -172,6 +172,15 @@ static duk_ret_t DukOvmsMemInfo(duk_context *ctx)
     dc.Push(heapinfo.total_blocks);               dc.PutProp(obj_idx, "sysTotalBlocks");
   #endif
 
+  // Script task queue & event forwarding info:
+  dc.Push(CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_QUEUE_SIZE);
+                                                  dc.PutProp(obj_idx, "queueSize");
+  dc.Push(MyDuktape.GetQueueWaiting());           dc.PutProp(obj_idx, "queueWaiting");
+  dc.Push(MyDuktape.m_queue_maxwaiting);          dc.PutProp(obj_idx, "queueMaxWaiting");
+  dc.Push(MyDuktape.m_evt_forwarded);             dc.PutProp(obj_idx, "eventsForwarded");
+  dc.Push(MyDuktape.m_evt_filtered);              dc.PutProp(obj_idx, "eventsFiltered");
+  dc.Push(MyDuktape.m_evt_dropped);               dc.PutProp(obj_idx, "eventsDropped");
+
   return 1;
   }
 
@@ -926,6 +926,11 @@ OvmsDuktape::OvmsDuktape()
   m_dukctx = NULL;
   m_duktaskid = NULL;
   m_duktaskqueue = NULL;
+  m_evt_forwarded = 0;
+  m_evt_filtered = 0;
+  m_evt_dropped = 0;
+  m_queue_maxwaiting = 0;
+  m_pubsub_hooked = false;
 
   // Register standard modules...
   extern const char mod_pubsub_js_start[]     asm("_binary_pubsub_js_start");
@@ -1002,27 +1007,39 @@ void OvmsDuktape::EventScript(std::string event, void* data)
   {
   if (!m_dukctx) return;
 
-  // dispatch event to PubSub component:
-  duktape_queue_t dmsg;
-  memset(&dmsg, 0, sizeof(dmsg));
-  dmsg.type = DUKTAPE_event;
-  dmsg.body.dt_event.name = strdup(event.c_str());
-  dmsg.body.dt_event.data = NULL; // data unused, may also be invalid in async script execution
-  if (!DuktapeDispatch(&dmsg, 0))
+  if (m_pubsub_hooked && !PubSubHasSubscribers(event))
     {
-    ESP_LOGE(TAG, "EventScript: event '%s' lost (queue overflow)", event.c_str());
-    free((void*)dmsg.body.dt_event.name);
+    // no script is interested in this event:
+    m_evt_filtered++;
     }
   else
-   {
-   // event processing delayed?
-   int qwait = uxQueueMessagesWaiting(m_duktaskqueue);
-   if (qwait > 10)
-     {
-     ESP_LOGW(TAG, "EventScript: event '%s' delayed, queued at position %d/%d", event.c_str(),
-       qwait, CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_QUEUE_SIZE);
-     }
-   }
+    {
+    // dispatch event to PubSub component:
+    duktape_queue_t dmsg;
+    memset(&dmsg, 0, sizeof(dmsg));
+    dmsg.type = DUKTAPE_event;
+    dmsg.body.dt_event.name = strdup(event.c_str());
+    dmsg.body.dt_event.data = NULL; // data unused, may also be invalid in async script execution
+    if (!DuktapeDispatch(&dmsg, 0))
+      {
+      m_evt_dropped++;
+      ESP_LOGE(TAG, "EventScript: event '%s' lost (queue overflow)", event.c_str());
+      free((void*)dmsg.body.dt_event.name);
+      }
+    else
+      {
+      m_evt_forwarded++;
+      // event processing delayed?
+      int qwait = uxQueueMessagesWaiting(m_duktaskqueue);
+      if (qwait > m_queue_maxwaiting)
+        m_queue_maxwaiting = qwait;
+      if (qwait > 10)
+        {
+        ESP_LOGW(TAG, "EventScript: event '%s' delayed, queued at position %d/%d", event.c_str(),
+          qwait, CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_QUEUE_SIZE);
+        }
+      }
+    }
 
   if (event == "ticker.60")
     {
@@ -1031,6 +1048,115 @@ void OvmsDuktape::EventScript(std::string event, void* data)
     }
   }
 
+/**
+ * PubSub subscription tracking:
+ *  The PubSub methods changing subscriptions are wrapped by a native function
+ *  calling the original method and then updating the list of topics having
+ *  subscribers. EventScript() only forwards events matching one of these
+ *  topics on any hierarchy level, all other events would be discarded by
+ *  PubSub.publish() anyway.
+ */
+static duk_ret_t DukOvmsPubSubHook(duk_context *ctx)
+  {
+  duk_idx_t nargs = duk_get_top(ctx);
+  duk_push_current_function(ctx);
+  duk_get_prop_string(ctx, -1, "\xff" "origMethod");
+  duk_push_this(ctx);
+  for (duk_idx_t i = 0; i < nargs; i++)
+    duk_dup(ctx, i);
+  duk_call_method(ctx, nargs);
+  MyDuktape.PubSubUpdate();
+  return 1;
+  }
+
+void OvmsDuktape::PubSubHook()
+  {
+  static const char* const methods[] = { "subscribe", "unsubscribe", "clearSubscriptions", "clearAllSubscriptions" };
+  duk_context* ctx = m_dukctx;
+
+  m_pubsub_hooked = false;
+  duk_get_global_string(ctx, "PubSub");
+  if (duk_is_object(ctx, -1))
+    {
+    bool complete = true;
+    for (const char* name : methods)
+      {
+      duk_get_prop_string(ctx, -1, name);
+      if (!duk_is_function(ctx, -1))
+        complete = false;
+      duk_pop(ctx);
+      }
+    if (complete)
+      {
+      for (const char* name : methods)
+        {
+        duk_push_c_function(ctx, DukOvmsPubSubHook, DUK_VARARGS);
+        duk_get_prop_string(ctx, -2, name);
+        duk_put_prop_string(ctx, -2, "\xff" "origMethod");
+        duk_put_prop_string(ctx, -2, name);
+        }
+      m_pubsub_hooked = true;
+      }
+    }
+  duk_pop(ctx);
+
+  if (m_pubsub_hooked)
+    PubSubUpdate();
+  else
+    ESP_LOGW(TAG, "Duktape: PubSub module not found, forwarding all events");
+  }
+
+void OvmsDuktape::PubSubUpdate()
+  {
+  duk_context* ctx = m_dukctx;
+  std::vector<std::string> topics;
+
+  duk_get_global_string(ctx, "PubSub");
+  if (duk_is_object(ctx, -1))
+    {
+    duk_get_prop_string(ctx, -1, "data");
+    duk_dup(ctx, -2);
+    if (duk_pcall_method(ctx, 0) == 0 && duk_is_object(ctx, -1))
+      {
+      // Collect topics having at least one subscriber:
+      duk_enum(ctx, -1, DUK_ENUM_OWN_PROPERTIES_ONLY);
+      while (duk_next(ctx, -1, 1))
+        {
+        bool used = false;
+        if (duk_is_object(ctx, -1))
+          {
+          duk_enum(ctx, -1, DUK_ENUM_OWN_PROPERTIES_ONLY);
+          used = duk_next(ctx, -1, 0);
+          if (used) duk_pop(ctx);
+          duk_pop(ctx);
+          }
+        if (used)
+          topics.push_back(duk_get_string(ctx, -2));
+        duk_pop_2(ctx);
+        }
+      duk_pop(ctx);
+      }
+    duk_pop(ctx);
+    }
+  duk_pop(ctx);
+
+  ESP_LOGD(TAG, "Duktape: PubSub has subscribers for %d topics", (int)topics.size());
+  OvmsMutexLock lock(&m_pubsub_mutex);
+  m_pubsub_topics.swap(topics);
+  }
+
+bool OvmsDuktape::PubSubHasSubscribers(const std::string& topic)
+  {
+  OvmsMutexLock lock(&m_pubsub_mutex);
+  for (const std::string& sub : m_pubsub_topics)
+    {
+    size_t len = sub.size();
+    if (topic.compare(0, len, sub) == 0 && (topic.size() == len || topic[len] == '.'))
+      return true;
+    }
+  return false;
+  }
+
 bool OvmsDuktape::DuktapeDispatch(duktape_queue_t* msg, TickType_t queuewait /*=portMAX_DELAY*/)
   {
   msg->waitcompletion = NULL;
@@ -1357,6 +1483,9 @@ void OvmsDuktape::DukTapeInit()
       }
     }
 
+  // Track PubSub subscriptions for event forwarding:
+  PubSubHook();
+
   #ifdef CONFIG_OVMS_COMP_PLUGINS
   // Plugins
   MyPluginStore.LoadEnabledModules(EL_MODULE);
@@ -1400,6 +1529,7 @@ void OvmsDuktape::DukTapeTask()
         case DUKTAPE_reload:
           {
           // Reload DUKTAPE engine
+          m_pubsub_hooked = false;
           NotifyDuktapeModuleUnloadAll();
           if (m_dukctx != NULL)
             {
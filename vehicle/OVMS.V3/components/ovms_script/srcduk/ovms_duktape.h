@@ -33,6 +33,7 @@
 
 #include "ovms_command.h"
 #include "ovms_utils.h"
+#include "ovms_mutex.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -40,6 +41,8 @@
 
 #include "duktape.h"
 #include <list>
+#include <vector>
+#include <string>
 #include <utility>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -316,6 +319,24 @@ class OvmsDuktape
     duk_context* DukTapeContext() { return m_dukctx; }
     void EventScript(std::string event, void* data);
 
+  public:
+    void PubSubHook();
+    void PubSubUpdate();
+    bool PubSubHasSubscribers(const std::string& topic);
+    int GetQueueWaiting() { return m_duktaskqueue ? uxQueueMessagesWaiting(m_duktaskqueue) : 0; }
+
+  public:
+    // Event forwarding statistics:
+    uint32_t m_evt_forwarded;
+    uint32_t m_evt_filtered;              // no PubSub subscriber
+    uint32_t m_evt_dropped;               // queue overflow
+    int m_queue_maxwaiting;               // highest queue depth seen on event dispatch
+
+  protected:
+    bool m_pubsub_hooked;                 // PubSub subscription tracking active
+    OvmsMutex m_pubsub_mutex;
+    std::vector<std::string> m_pubsub_topics;  // topics having subscribers
+
   protected:
     duk_context* m_dukctx;
     TaskHandle_t m_duktaskid;
@@ -31,6 +31,8 @@
 #include "ovms_log.h"
 static const char *TAG = "ovms-server-v2";
 
+#include <algorithm>
+#include <set>
 #include "ovms.h"
 #include "buffered_shell.h"
 #include "ovms_peripherals.h"
@@ -154,7 +156,6 @@ static struct
   };
 
 OvmsServerV2 *MyOvmsServerV2 = NULL;
-size_t MyOvmsServerV2Modifier = 0;
 size_t MyOvmsServerV2Reader = 0;
 
 bool OvmsServerV2ReaderCallback(OvmsNotifyType* type, OvmsNotifyEntry* entry)
@@ -301,6 +302,14 @@ void OvmsServerV2::ProcessServerMsg()
       // Generate, and store, the digest for future use
       std::string modpass = MyConfig.GetParamValue("password","module");
       hmac_md5((uint8_t*) token, OVMS_PROTOCOL_V2_TOKENSIZE, (uint8_t*)modpass.c_str(), modpass.length(), m_pdigest);
+
+      // Prime the paranoid mode cipher, every message starts from this state
+      RC4_setup(&m_crypto_p1, &m_crypto_p2, m_pdigest, OVMS_MD5_SIZE);
+      for (int k=0;k<1024;k++)
+        {
+        uint8_t zero = 0;
+        RC4_crypt(&m_crypto_p1, &m_crypto_p2, &zero, 1);
+        }
       }
 
     m_pending_notify_info = true;
@@ -345,15 +354,9 @@ void OvmsServerV2::ProcessServerMsg()
     uint8_t *d = new uint8_t[line.length()-6];
     len = base64decode(line.c_str()+7,d+1);
 
-    RC4_CTX1* pm_crypto1 = new RC4_CTX1;
-    RC4_CTX2* pm_crypto2 = new RC4_CTX2;
-    RC4_setup(pm_crypto1, pm_crypto2, m_pdigest, OVMS_MD5_SIZE);
-    for (int k=0;k<1024;k++)
-      {
-      uint8_t zero = 0;
-      RC4_crypt(pm_crypto1, pm_crypto2, &zero, 1);
-      }
-    RC4_crypt(pm_crypto1, pm_crypto2, d, len);
+    RC4_CTX1 pm_crypto1 = m_crypto_p1;
+    RC4_CTX2 pm_crypto2 = m_crypto_p2;
+    RC4_crypt(&pm_crypto1, &pm_crypto2, d, len);
 
     line.erase(5);
     line = std::string("MP-0 ");
@@ -361,9 +364,7 @@ void OvmsServerV2::ProcessServerMsg()
     line.append((char*)d);
     len = line.length();
 
-    delete pm_crypto1;
-    delete pm_crypto2;
-    delete d;
+    delete [] d;
     ESP_LOGI(TAG, "Decoded Paranoid Msg: %s",line.c_str());
     }
 
@@ -722,59 +723,58 @@ void OvmsServerV2::ProcessCommand(const char* payload)
   }
 
 bool OvmsServerV2::Transmit(const std::string& message)
+  {
+  return Transmit(message.data(), message.length());
+  }
+
+bool OvmsServerV2::Transmit(const char* message, size_t length)
   {
   OvmsMutexLock mg(&m_mgconn_mutex);
   if (!m_mgconn)
     return false;
 
-  int len = message.length();
-  char* s = new char[(len*2)+4];
-  memcpy(s,message.c_str(),len);
-  ESP_LOGI(TAG, "Send %s",message.c_str());
+  ESP_LOGI(TAG, "Send %.*s", (int)length, message);
 
   if ((m_ptoken_ready)&&
-      (s[5] != 'E')&&
-      (s[5] != 'A')&&
-      (s[5] != 'a')&&
-      (s[5] != 'g')&&
-      (s[5] != 'P'))
+      (length >= 6)&&
+      (message[5] != 'E')&&
+      (message[5] != 'A')&&
+      (message[5] != 'a')&&
+      (message[5] != 'g')&&
+      (message[5] != 'P'))
     {
     // We must convert the message to a paranoid one...
     // The message is of the form MP-0 X...
     // Where X is the code and ... is the (optional) data
-    char code[2]; code[0] = s[5]; code[1] = 0;
-    uint8_t* d = new uint8_t[len-6];
-    memcpy(d,s+6,len-6);
+    size_t datalen = length-6;
+    m_txcoded.assign(message+6, datalen);
 
     // Paranoid encrypt the message part of the transaction
-    RC4_CTX1* pm_crypto1 = new RC4_CTX1;
-    RC4_CTX2* pm_crypto2 = new RC4_CTX2;
-    RC4_setup(pm_crypto1, pm_crypto2, m_pdigest, OVMS_MD5_SIZE);
-    for (int k=0;k<1024;k++)
-      {
-      uint8_t zero = 0;
-      RC4_crypt(pm_crypto1, pm_crypto2, &zero, 1);
-      }
-    RC4_crypt(pm_crypto1, pm_crypto2, d, len-6);
-
-    strcpy(s,"MP-0 EM");
-    strcat(s,code);
-    base64encode(d, len-6, (uint8_t*)s+8);
-    // The messdage is now in paranoid mode...
-    delete d;
-    delete pm_crypto1;
-    delete pm_crypto2;
+    RC4_CTX1 pm_crypto1 = m_crypto_p1;
+    RC4_CTX2 pm_crypto2 = m_crypto_p2;
+    RC4_crypt(&pm_crypto1, &pm_crypto2, (uint8_t*)&m_txcoded[0], datalen);
+
+    m_txplain.assign("MP-0 EM");
+    m_txplain.push_back(message[5]);
+    m_txplain.resize(8 + 4*((datalen+2)/3) + 1);
+    base64encode((uint8_t*)m_txcoded.data(), datalen, (uint8_t*)&m_txplain[8]);
+    m_txplain.resize(m_txplain.size() - 1);
+    // The message is now in paranoid mode...
+    }
+  else
+    {
+    m_txplain.assign(message, length);
     }
 
-  RC4_crypt(&m_crypto_tx1, &m_crypto_tx2, (uint8_t*)s, len);
-
-  char* buf = new char[(len*2)+4];
-  base64encode((uint8_t*)s, len, (uint8_t*)buf);
-  strcat(buf,"\r\n");
-  mg_send(m_mgconn, buf, strlen(buf));
+  size_t len = m_txplain.size();
+  RC4_crypt(&m_crypto_tx1, &m_crypto_tx2, (uint8_t*)&m_txplain[0], len);
 
-  delete [] buf;
-  delete [] s;
+  size_t enclen = 4*((len+2)/3);
+  m_txcoded.resize(enclen + 1);
+  base64encode((uint8_t*)m_txplain.data(), len, (uint8_t*)&m_txcoded[0]);
+  m_txcoded.resize(enclen);
+  m_txcoded.append("\r\n");
+  mg_send(m_mgconn, m_txcoded.data(), m_txcoded.size());
   return true;
   }
 
@@ -954,47 +954,635 @@ void OvmsServerV2::SendLogin(struct mg_connection *nc)
   m_connretry = 60; // Give the server 60 seconds to respond
   }
 
-void OvmsServerV2::TransmitMsgStat(bool always)
+uint8_t Doors1()
   {
-  m_now_stat = false;
+  car_doors1_t car_doors1;
+  car_doors1.flags = 0;
+  car_doors1.bits.FrontLeftDoor = StandardMetrics.ms_v_door_fl->AsBool();
+  car_doors1.bits.FrontRightDoor = StandardMetrics.ms_v_door_fr->AsBool();
+  car_doors1.bits.ChargePort = StandardMetrics.ms_v_door_chargeport->AsBool();
+  car_doors1.bits.PilotSignal = StandardMetrics.ms_v_charge_pilot->AsBool();
+  car_doors1.bits.Charging = StandardMetrics.ms_v_charge_inprogress->AsBool();
+  car_doors1.bits.HandBrake = StandardMetrics.ms_v_env_handbrake->AsBool();
+  car_doors1.bits.CarON = StandardMetrics.ms_v_env_on->AsBool();
+
+  return car_doors1.flags;
+  }
+
+uint8_t Doors2()
+  {
+  car_doors2_t car_doors2;
+  car_doors2.flags = 0;
+  car_doors2.bits.CarLocked = StandardMetrics.ms_v_env_locked->AsBool();
+  car_doors2.bits.ValetMode = StandardMetrics.ms_v_env_valet->AsBool();
+  car_doors2.bits.Headlights = StandardMetrics.ms_v_env_headlights->AsBool();
+  car_doors2.bits.Bonnet = StandardMetrics.ms_v_door_hood->AsBool();
+  car_doors2.bits.Trunk = StandardMetrics.ms_v_door_trunk->AsBool();
+
+  return car_doors2.flags;
+  }
+
+uint8_t Doors3()
+  {
+  car_doors3_t car_doors3;
+  car_doors3.flags = 0;
+  car_doors3.bits.CarAwake = StandardMetrics.ms_v_env_awake->AsBool();
+  car_doors3.bits.CoolingPump = StandardMetrics.ms_v_env_cooling->AsBool();
+  car_doors3.bits.CtrlLoggedIn = StandardMetrics.ms_v_env_ctrl_login->AsBool();
+  car_doors3.bits.CtrlCfgMode = StandardMetrics.ms_v_env_ctrl_config->AsBool();
+
+  return car_doors3.flags;
+  }
+
+uint8_t Doors4()
+  {
+  car_doors4_t car_doors4;
+  car_doors4.flags = 0;
+  car_doors4.bits.AlarmSounds = StandardMetrics.ms_v_env_alarm->AsBool();
+
+  return car_doors4.flags;
+  }
+
+uint8_t Doors5()
+  {
+  car_doors5_t car_doors5;
+  car_doors5.flags = 0;
+  car_doors5.bits.RearLeftDoor = StandardMetrics.ms_v_door_rl->AsBool();
+  car_doors5.bits.RearRightDoor = StandardMetrics.ms_v_door_rr->AsBool();
+  car_doors5.bits.Frunk = false; // should this be hood or something else?
+  car_doors5.bits.Charging12V = StandardMetrics.ms_v_env_charging12v->AsBool();
+  car_doors5.bits.Aux12V = StandardMetrics.ms_v_env_aux12v->AsBool();
+  car_doors5.bits.HVAC = StandardMetrics.ms_v_env_hvac->AsBool();
+
+  return car_doors5.flags;
+  }
+
+/**
+ * Field formatting helpers, producing the same text as the former
+ * std::ostringstream builders (std::fixed + setprecision = "%.*f",
+ * stream default = "%g")
+ */
+
+static void v2_int(extram::string& out, int value)
+  {
+  char buf[16];
+  out.append(buf, snprintf(buf, sizeof(buf), "%d", value));
+  }
+
+static void v2_fixed(extram::string& out, float value, int precision)
+  {
+  char buf[48];   // FLT_MAX has 39 integral digits
+  out.append(buf, snprintf(buf, sizeof(buf), "%.*f", precision, value));
+  }
+
+static void v2_float(extram::string& out, float value)
+  {
+  char buf[24];
+  out.append(buf, snprintf(buf, sizeof(buf), "%g", value));
+  }
+
+static void v2_str(extram::string& out, const std::string& value)
+  {
+  out.append(value.data(), value.length());
+  }
+
+static void v2_vector(extram::string& out, uint32_t size, const std::string& values)
+  {
+  v2_int(out, size);
+  if (size) out.append(",");
+  v2_str(out, values);
+  }
+
+static void v2_defstale(extram::string& out, OvmsMetric* metric)
+  {
+  v2_int(out, metric->IsDefined() ? (metric->IsStale() ? 0 : 1) : -1);
+  }
+
+static void v2_stale(extram::string& out, bool stale)
+  {
+  out.append(stale ? "0" : "1");
+  }
+
+static int v2_mins_charge()
+  {
+  int mins_range = StandardMetrics.ms_v_charge_duration_range->AsInt();
+  int mins_soc = StandardMetrics.ms_v_charge_duration_soc->AsInt();
+  return ((mins_range >= 0) && (mins_range < mins_soc)) ? mins_range : mins_soc;
+  }
+
+static metric_unit_t v2_units_speed(metric_unit_t units_distance)
+  {
+  return (units_distance == Kilometers) ? Kph : Mph;
+  }
+
+#define V2_FIELD(sep, metrics, always, code) \
+  { sep, metrics, always, [](extram::string& out, metric_unit_t units) { code; } }
+#define V2_COUNT(fields) (sizeof(fields) / sizeof(fields[0]))
+
+/**
+ * Message field tables
+ *  - constant fields are part of the separator text
+ *  - "always" fields read state not covered by metric changes (staleness,
+ *    config, vehicle layout) and are rendered on every transmission
+ */
+
+static const OvmsServerV2Field v2_fields_stat[] =
+  {
+  V2_FIELD("",      MS_V_BAT_SOC,                     false, v2_str(out, StandardMetrics.ms_v_bat_soc->AsString("0", Other, 1))),
+  V2_FIELD(",",     NULL,                             false, out.append((units == Kilometers) ? "K" : "M")),
+  V2_FIELD(",",     MS_V_CHARGE_VOLTAGE,              false, v2_int(out, StandardMetrics.ms_v_charge_voltage->AsInt())),
+  V2_FIELD(",",     MS_V_CHARGE_CURRENT,              false, v2_fixed(out, StandardMetrics.ms_v_charge_current->AsFloat(), 2)),
+  V2_FIELD(",",     MS_V_CHARGE_STATE,                false, v2_str(out, StandardMetrics.ms_v_charge_state->AsString("stopped"))),
+  V2_FIELD(",",     MS_V_CHARGE_MODE,                 false, v2_str(out, StandardMetrics.ms_v_charge_mode->AsString("standard"))),
+  V2_FIELD(",",     MS_V_BAT_RANGE_IDEAL,             false, v2_int(out, StandardMetrics.ms_v_bat_range_ideal->AsInt(0, units))),
+  V2_FIELD(",",     MS_V_BAT_RANGE_EST,               false, v2_int(out, StandardMetrics.ms_v_bat_range_est->AsInt(0, units))),
+  V2_FIELD(",",     MS_V_CHARGE_CLIMIT,               false, v2_int(out, StandardMetrics.ms_v_charge_climit->AsInt())),
+  V2_FIELD(",",     MS_V_CHARGE_TIME,                 false, v2_int(out, StandardMetrics.ms_v_charge_time->AsInt(0, Seconds))),
+  V2_FIELD(",0,",   MS_V_CHARGE_KWH,                  false, v2_int(out, (int)(StandardMetrics.ms_v_charge_kwh->AsFloat() * 10))),
+  V2_FIELD(",",     MS_V_CHARGE_SUBSTATE,             false, v2_int(out, chargesubstate_key(StandardMetrics.ms_v_charge_substate->AsString("")))),
+  V2_FIELD(",",     MS_V_CHARGE_STATE,                false, v2_int(out, chargestate_key(StandardMetrics.ms_v_charge_state->AsString("stopped")))),
+  V2_FIELD(",",     MS_V_CHARGE_MODE,                 false, v2_int(out, chargemode_key(StandardMetrics.ms_v_charge_mode->AsString("standard")))),
+  V2_FIELD(",",     MS_V_CHARGE_TIMERMODE,            false, v2_int(out, StandardMetrics.ms_v_charge_timermode->AsBool())),
+  V2_FIELD(",",     MS_V_CHARGE_TIMERSTART,           false, v2_int(out, StandardMetrics.ms_v_charge_timerstart->AsInt())),
+  V2_FIELD(",0,",   MS_V_BAT_CAC,                     false, v2_fixed(out, StandardMetrics.ms_v_bat_cac->AsFloat(), 2)),
+  V2_FIELD(",",     MS_V_CHARGE_DURATION_FULL,        false, v2_int(out, StandardMetrics.ms_v_charge_duration_full->AsInt())),
+  V2_FIELD(",",     MS_V_CHARGE_DURATION_RANGE "," MS_V_CHARGE_DURATION_SOC,
+                                                      false, v2_int(out, v2_mins_charge())),
+  V2_FIELD(",",     MS_V_CHARGE_LIMIT_RANGE,          false, v2_int(out, (int) StandardMetrics.ms_v_charge_limit_range->AsFloat(0, units))),
+  V2_FIELD(",",     MS_V_CHARGE_LIMIT_SOC,            false, v2_int(out, StandardMetrics.ms_v_charge_limit_soc->AsInt())),
+  V2_FIELD(",",     MS_V_ENV_COOLING,                 false, v2_int(out, StandardMetrics.ms_v_env_cooling->AsBool() ? 0 : -1)),
+  V2_FIELD(",0,0,0,", MS_V_CHARGE_DURATION_RANGE,     false, v2_int(out, StandardMetrics.ms_v_charge_duration_range->AsInt())),
+  V2_FIELD(",",     MS_V_CHARGE_DURATION_SOC,         false, v2_int(out, StandardMetrics.ms_v_charge_duration_soc->AsInt())),
+  V2_FIELD(",",     MS_V_BAT_RANGE_FULL,              false, v2_int(out, StandardMetrics.ms_v_bat_range_full->AsInt(0, units))),
+  V2_FIELD(",0,",   MS_V_CHARGE_INPROGRESS "," MS_V_BAT_POWER,
+                                                      false, v2_fixed(out, StandardMetrics.ms_v_charge_inprogress->AsBool()
+                                                               ? -StandardMetrics.ms_v_bat_power->AsFloat() : 0, 2)),
+  V2_FIELD(",",     MS_V_BAT_VOLTAGE,                 false, v2_fixed(out, StandardMetrics.ms_v_bat_voltage->AsFloat(), 2)),
+  V2_FIELD(",",     MS_V_BAT_SOH,                     false, v2_int(out, StandardMetrics.ms_v_bat_soh->AsInt())),
+  V2_FIELD(",",     MS_V_CHARGE_POWER,                false, v2_fixed(out, StandardMetrics.ms_v_charge_power->AsFloat(), 2)),
+  V2_FIELD(",",     MS_V_CHARGE_EFFICIENCY,           false, v2_fixed(out, StandardMetrics.ms_v_charge_efficiency->AsFloat(), 2)),
+  V2_FIELD(",",     MS_V_BAT_CURRENT,                 false, v2_fixed(out, StandardMetrics.ms_v_bat_current->AsFloat(), 2)),
+  V2_FIELD(",",     MS_V_BAT_RANGE_SPEED,             false, v2_fixed(out, StandardMetrics.ms_v_bat_range_speed->AsFloat(0,
+                                                               (units == Miles) ? Mph : Kph), 1)),
+  };
+
+static const OvmsServerV2Field v2_fields_gen[] =
+  {
+  V2_FIELD("",      MS_V_GEN_INPROGRESS,              false, v2_int(out, StandardMetrics.ms_v_gen_inprogress->AsBool())),
+  V2_FIELD(";",     MS_V_GEN_PILOT,                   false, v2_int(out, StandardMetrics.ms_v_gen_pilot->AsBool())),
+  V2_FIELD(",",     MS_V_GEN_VOLTAGE,                 false, v2_int(out, StandardMetrics.ms_v_gen_voltage->AsInt())),
+  V2_FIELD(",",     MS_V_GEN_CURRENT,                 false, v2_fixed(out, StandardMetrics.ms_v_gen_current->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_POWER,                   false, v2_fixed(out, StandardMetrics.ms_v_gen_power->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_EFFICIENCY,              false, v2_fixed(out, StandardMetrics.ms_v_gen_efficiency->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_TYPE,                    false, v2_str(out, StandardMetrics.ms_v_gen_type->AsString(""))),
+  V2_FIELD(",",     MS_V_GEN_STATE,                   false, v2_str(out, StandardMetrics.ms_v_gen_state->AsString("stopped"))),
+  V2_FIELD(",",     MS_V_GEN_SUBSTATE,                false, v2_str(out, StandardMetrics.ms_v_gen_substate->AsString(""))),
+  V2_FIELD(",",     MS_V_GEN_MODE,                    false, v2_str(out, StandardMetrics.ms_v_gen_mode->AsString("standard"))),
+  V2_FIELD(",",     MS_V_GEN_CLIMIT,                  false, v2_fixed(out, StandardMetrics.ms_v_gen_climit->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_LIMIT_RANGE,             false, v2_fixed(out, StandardMetrics.ms_v_gen_limit_range->AsFloat(0, units), 1)),
+  V2_FIELD(",",     MS_V_GEN_LIMIT_SOC,               false, v2_int(out, StandardMetrics.ms_v_gen_limit_soc->AsInt())),
+  V2_FIELD(",",     MS_V_GEN_KWH,                     false, v2_fixed(out, StandardMetrics.ms_v_gen_kwh->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_KWH_GRID,                false, v2_fixed(out, StandardMetrics.ms_v_gen_kwh_grid->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_KWH_GRID_TOTAL,          false, v2_fixed(out, StandardMetrics.ms_v_gen_kwh_grid_total->AsFloat(), 1)),
+  V2_FIELD(",",     MS_V_GEN_TIME,                    false, v2_int(out, StandardMetrics.ms_v_gen_time->AsInt(0, Seconds))),
+  V2_FIELD(",",     MS_V_GEN_TIMERMODE,               false, v2_int(out, StandardMetrics.ms_v_gen_timermode->AsBool())),
+  V2_FIELD(",",     MS_V_GEN_TIMERSTART,              false, v2_int(out, StandardMetrics.ms_v_gen_timerstart->AsInt())),
+  V2_FIELD(",",     MS_V_GEN_DURATION_EMPTY,          false, v2_int(out, StandardMetrics.ms_v_gen_duration_empty->AsInt())),
+  V2_FIELD(",",     MS_V_GEN_DURATION_RANGE,          false, v2_int(out, StandardMetrics.ms_v_gen_duration_range->AsInt())),
+  V2_FIELD(",",     MS_V_GEN_DURATION_SOC,            false, v2_int(out, StandardMetrics.ms_v_gen_duration_soc->AsInt())),
+  V2_FIELD(";",     MS_V_GEN_TEMP,                    false, v2_fixed(out, StandardMetrics.ms_v_gen_temp->AsFloat(), 1)),
+  };
+
+static const OvmsServerV2Field v2_fields_gps[] =
+  {
+  V2_FIELD("",      MS_V_POS_LATITUDE,                false, v2_str(out, StandardMetrics.ms_v_pos_latitude->AsString("0", Other, 6))),
+  V2_FIELD(",",     MS_V_POS_LONGITUDE,               false, v2_str(out, StandardMetrics.ms_v_pos_longitude->AsString("0", Other, 6))),
+  V2_FIELD(",",     MS_V_POS_DIRECTION,               false, v2_str(out, StandardMetrics.ms_v_pos_direction->AsString("0"))),
+  V2_FIELD(",",     MS_V_POS_ALTITUDE,                false, v2_str(out, StandardMetrics.ms_v_pos_altitude->AsString("0"))),
+  V2_FIELD(",",     MS_V_POS_GPSLOCK,                 false, v2_int(out, StandardMetrics.ms_v_pos_gpslock->AsBool(false))),
+  V2_FIELD(",",     MS_V_POS_GPSTIME,                 true,  v2_stale(out, StandardMetrics.ms_v_pos_gpstime->IsStale())),
+  V2_FIELD(",",     MS_V_POS_SPEED,                   false, v2_str(out, StandardMetrics.ms_v_pos_speed->AsString("0", v2_units_speed(units), 1))),
+  V2_FIELD(",",     MS_V_POS_TRIP,                    false, v2_int(out, int(StandardMetrics.ms_v_pos_trip->AsFloat(0, units)*10))),
+  V2_FIELD(",",     MS_V_ENV_DRIVEMODE,               false, char drivemode[10];
+                                                             out.append(drivemode, snprintf(drivemode, sizeof(drivemode), "%x",
+                                                               StandardMetrics.ms_v_env_drivemode->AsInt()))),
+  V2_FIELD(",",     MS_V_BAT_POWER,                   false, v2_str(out, StandardMetrics.ms_v_bat_power->AsString("0", Other, 3))),
+  V2_FIELD(",",     MS_V_BAT_ENERGY_USED,             false, v2_str(out, StandardMetrics.ms_v_bat_energy_used->AsString("0", Other, 3))),
+  V2_FIELD(",",     MS_V_BAT_ENERGY_RECD,             false, v2_str(out, StandardMetrics.ms_v_bat_energy_recd->AsString("0", Other, 3))),
+  V2_FIELD(",",     MS_V_INV_POWER,                   false, v2_float(out, StandardMetrics.ms_v_inv_power->AsFloat())),
+  V2_FIELD(",",     MS_V_INV_EFFICIENCY,              false, v2_float(out, StandardMetrics.ms_v_inv_efficiency->AsFloat())),
+  V2_FIELD(",",     MS_V_POS_GPSMODE,                 false, v2_str(out, StandardMetrics.ms_v_pos_gpsmode->AsString())),
+  V2_FIELD(",",     MS_V_POS_SATCOUNT,                false, v2_int(out, StandardMetrics.ms_v_pos_satcount->AsInt())),
+  V2_FIELD(",",     MS_V_POS_GPSHDOP,                 false, v2_str(out, StandardMetrics.ms_v_pos_gpshdop->AsString("0", Native, 1))),
+  V2_FIELD(",",     MS_V_POS_GPSSPEED,                false, v2_str(out, StandardMetrics.ms_v_pos_gpsspeed->AsString("0", v2_units_speed(units), 1))),
+  V2_FIELD(",",     MS_V_POS_GPSSQ,                   false, v2_int(out, StandardMetrics.ms_v_pos_gpssq->AsInt())),
+  };
+
+static void v2_tpms_layout(extram::string& out)
+  {
+  std::vector<std::string> wheels;
+  if (MyVehicleFactory.m_currentvehicle)
+    wheels = MyVehicleFactory.m_currentvehicle->GetTpmsLayout();
+  v2_int(out, wheels.size());
+  for (auto& wheel : wheels)
+    {
+    out.append(",");
+    v2_str(out, wheel);
+    }
+  }
+
+static const OvmsServerV2Field v2_fields_tpms[] =
+  {
+  V2_FIELD("",      NULL,                             true,  v2_tpms_layout(out)),
+  V2_FIELD(",",     MS_V_TPMS_PRESSURE,               false, v2_vector(out, StandardMetrics.ms_v_tpms_pressure->GetSize(),
+                                                               StandardMetrics.ms_v_tpms_pressure->AsString("", kPa, 1))),
+  V2_FIELD(",",     MS_V_TPMS_PRESSURE,               true,  v2_defstale(out, StandardMetrics.ms_v_tpms_pressure)),
+  V2_FIELD(",",     MS_V_TPMS_TEMP,                   false, v2_vector(out, StandardMetrics.ms_v_tpms_temp->GetSize(),
+                                                               StandardMetrics.ms_v_tpms_temp->AsString("", Celcius, 1))),
+  V2_FIELD(",",     MS_V_TPMS_TEMP,                   true,  v2_defstale(out, StandardMetrics.ms_v_tpms_temp)),
+  V2_FIELD(",",     MS_V_TPMS_HEALTH,                 false, v2_vector(out, StandardMetrics.ms_v_tpms_health->GetSize(),
+                                                               StandardMetrics.ms_v_tpms_health->AsString("", Percentage, 1))),
+  V2_FIELD(",",     MS_V_TPMS_HEALTH,                 true,  v2_defstale(out, StandardMetrics.ms_v_tpms_health)),
+  V2_FIELD(",",     MS_V_TPMS_ALERT,                  false, v2_vector(out, StandardMetrics.ms_v_tpms_alert->GetSize(),
+                                                               StandardMetrics.ms_v_tpms_alert->AsString(""))),
+  V2_FIELD(",",     MS_V_TPMS_ALERT,                  true,  v2_defstale(out, StandardMetrics.ms_v_tpms_alert)),
+  };
+
+static void v2_tpms_legacy_defstale(extram::string& out)
+  {
+  bool stale =
+    StandardMetrics.ms_v_tpms_pressure->IsStale() ||
+    StandardMetrics.ms_v_tpms_temp->IsStale() ||
+    StandardMetrics.ms_v_tpms_health->IsStale() ||
+    StandardMetrics.ms_v_tpms_alert->IsStale();
+
+  bool defined =
+    StandardMetrics.ms_v_tpms_pressure->IsDefined() ||
+    StandardMetrics.ms_v_tpms_temp->IsDefined() ||
+    StandardMetrics.ms_v_tpms_health->IsDefined() ||
+    StandardMetrics.ms_v_tpms_alert->IsDefined();
+
+  v2_int(out, !defined ? -1 : (stale ? 0 : 1));
+  }
+
+// Legacy "W" message (fixed four tyres, only pressures & temperatures):
+static const OvmsServerV2Field v2_fields_tpms_legacy[] =
+  {
+  V2_FIELD("",      MS_V_TPMS_PRESSURE,               false, v2_str(out, StandardMetrics.ms_v_tpms_pressure->ElemAsString(MS_V_TPMS_IDX_FR, "0", PSI))),
+  V2_FIELD(",",     MS_V_TPMS_TEMP,                   false, v2_str(out, StandardMetrics.ms_v_tpms_temp->ElemAsString(MS_V_TPMS_IDX_FR, "0"))),
+  V2_FIELD(",",     MS_V_TPMS_PRESSURE,               false, v2_str(out, StandardMetrics.ms_v_tpms_pressure->ElemAsString(MS_V_TPMS_IDX_RR, "0", PSI))),
+  V2_FIELD(",",     MS_V_TPMS_TEMP,                   false, v2_str(out, StandardMetrics.ms_v_tpms_temp->ElemAsString(MS_V_TPMS_IDX_RR, "0"))),
+  V2_FIELD(",",     MS_V_TPMS_PRESSURE,               false, v2_str(out, StandardMetrics.ms_v_tpms_pressure->ElemAsString(MS_V_TPMS_IDX_FL, "0", PSI))),
+  V2_FIELD(",",     MS_V_TPMS_TEMP,                   false, v2_str(out, StandardMetrics.ms_v_tpms_temp->ElemAsString(MS_V_TPMS_IDX_FL, "0"))),
+  V2_FIELD(",",     MS_V_TPMS_PRESSURE,               false, v2_str(out, StandardMetrics.ms_v_tpms_pressure->ElemAsString(MS_V_TPMS_IDX_RL, "0", PSI))),
+  V2_FIELD(",",     MS_V_TPMS_TEMP,                   false, v2_str(out, StandardMetrics.ms_v_tpms_temp->ElemAsString(MS_V_TPMS_IDX_RL, "0"))),
+  V2_FIELD(",",     NULL,                             true,  v2_tpms_legacy_defstale(out)),
+  };
 
-  bool modified =
-    StandardMetrics.ms_v_bat_soc->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_voltage->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_current->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_state->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_substate->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_mode->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_range_ideal->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_range_est->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_climit->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_kwh->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_timermode->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_timerstart->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_cac->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_duration_full->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_duration_range->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_duration_soc->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_inprogress->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_limit_range->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_limit_soc->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_cooling->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_range_full->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_power->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_voltage->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_soh->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_power->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_efficiency->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_current->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_range_speed->IsModifiedAndClear(MyOvmsServerV2Modifier);
+static const OvmsServerV2Field v2_fields_firmware[] =
+  {
+  V2_FIELD("",      MS_M_VERSION,                     false, v2_str(out, mp_encode(StandardMetrics.ms_m_version->AsString("")))),
+  V2_FIELD(",",     MS_V_VIN,                         false, v2_str(out, mp_encode(StandardMetrics.ms_v_vin->AsString("")))),
+  V2_FIELD(",",     MS_N_SQ,                          false, v2_str(out, StandardMetrics.ms_m_net_sq->AsString("0", sq))),
+  V2_FIELD(",",     NULL,                             true,  v2_str(out, MyConfig.GetParamValue("vehicle", "canwrite", "0"))),
+  V2_FIELD(",",     MS_V_TYPE,                        false, v2_str(out, StandardMetrics.ms_v_type->AsString(""))),
+  V2_FIELD(",",     MS_N_PROVIDER,                    false, v2_str(out, mp_encode(StandardMetrics.ms_m_net_provider->AsString("")))),
+  V2_FIELD(",",     MS_V_ENV_SERV_RANGE,              false, v2_str(out, StandardMetrics.ms_v_env_service_range->AsString("-1", Kilometers, 0))),
+  V2_FIELD(",",     MS_V_ENV_SERV_TIME,               false, v2_str(out, StandardMetrics.ms_v_env_service_time->AsString("-1", Seconds, 0))),
+  V2_FIELD(",",     MS_M_HARDWARE,                    false, v2_str(out, mp_encode(StandardMetrics.ms_m_hardware->AsString("")))),
+  };
+
+// v2 has one "stale" flag for all temperatures, we say they're stale only if
+// all are stale, IE one valid temperature makes them all valid
+static bool v2_stale_temps()
+  {
+  return
+    StandardMetrics.ms_v_inv_temp->IsStale() &&
+    StandardMetrics.ms_v_mot_temp->IsStale() &&
+    StandardMetrics.ms_v_bat_temp->IsStale() &&
+    StandardMetrics.ms_v_charge_temp->IsStale() &&
+    StandardMetrics.ms_v_env_temp->IsStale() &&
+    StandardMetrics.ms_v_env_cabintemp->IsStale();
+  }
+
+static const OvmsServerV2Field v2_fields_environment[] =
+  {
+  V2_FIELD("",      MS_V_DOOR_FL "," MS_V_DOOR_FR "," MS_V_DOOR_CHARGEPORT "," MS_V_CHARGE_PILOT ","
+                    MS_V_CHARGE_INPROGRESS "," MS_V_ENV_HANDBRAKE "," MS_V_ENV_ON,
+                                                      false, v2_int(out, Doors1())),
+  V2_FIELD(",",     MS_V_ENV_LOCKED "," MS_V_ENV_VALET "," MS_V_ENV_HEADLIGHTS "," MS_V_DOOR_HOOD "," MS_V_DOOR_TRUNK,
+                                                      false, v2_int(out, Doors2())),
+  V2_FIELD(",",     MS_V_ENV_LOCKED,                  false, out.append(StandardMetrics.ms_v_env_locked->AsBool() ? "4" : "5")),
+  V2_FIELD(",",     MS_V_INV_TEMP,                    false, v2_str(out, StandardMetrics.ms_v_inv_temp->AsString("0"))),
+  V2_FIELD(",",     MS_V_MOT_TEMP,                    false, v2_str(out, StandardMetrics.ms_v_mot_temp->AsString("0"))),
+  V2_FIELD(",",     MS_V_BAT_TEMP,                    false, v2_str(out, StandardMetrics.ms_v_bat_temp->AsString("0"))),
+  V2_FIELD(",",     MS_V_POS_TRIP,                    false, v2_int(out, int(StandardMetrics.ms_v_pos_trip->AsFloat(0, units)*10))),
+  V2_FIELD(",",     MS_V_POS_ODOMETER,                false, v2_int(out, int(StandardMetrics.ms_v_pos_odometer->AsFloat(0, units)*10))),
+  V2_FIELD(",",     MS_V_POS_SPEED,                   false, v2_str(out, StandardMetrics.ms_v_pos_speed->AsString("0"))),
+  V2_FIELD(",",     MS_V_ENV_PARKTIME,                false, v2_str(out, StandardMetrics.ms_v_env_parktime->AsString("0"))),
+  V2_FIELD(",",     MS_V_ENV_TEMP,                    false, v2_str(out, StandardMetrics.ms_v_env_temp->AsString("0"))),
+  V2_FIELD(",",     MS_V_ENV_AWAKE "," MS_V_ENV_COOLING "," MS_V_ENV_CTRL_LOGIN "," MS_V_ENV_CTRL_CONFIG,
+                                                      false, v2_int(out, Doors3())),
+  V2_FIELD(",",     NULL,                             true,  v2_stale(out, v2_stale_temps())),
+  V2_FIELD(",",     NULL,                             true,  v2_stale(out, StandardMetrics.ms_v_env_temp->IsStale())),
+  V2_FIELD(",",     MS_V_BAT_12V_VOLTAGE,             false, v2_str(out, StandardMetrics.ms_v_bat_12v_voltage->AsString("0"))),
+  V2_FIELD(",",     MS_V_ENV_ALARM,                   false, v2_int(out, Doors4())),
+  V2_FIELD(",",     MS_V_BAT_12V_VOLTAGE_REF,         false, v2_str(out, StandardMetrics.ms_v_bat_12v_voltage_ref->AsString("0"))),
+  V2_FIELD(",",     MS_V_DOOR_RL "," MS_V_DOOR_RR "," MS_V_ENV_CHARGING12V "," MS_V_ENV_AUX12V "," MS_V_ENV_HVAC,
+                                                      false, v2_int(out, Doors5())),
+  V2_FIELD(",",     MS_V_CHARGE_TEMP,                 false, v2_str(out, StandardMetrics.ms_v_charge_temp->AsString("0"))),
+  V2_FIELD(",",     MS_V_BAT_12V_CURRENT,             false, v2_str(out, StandardMetrics.ms_v_bat_12v_current->AsString("0"))),
+  V2_FIELD(",",     MS_V_ENV_CABINTEMP,               false, v2_str(out, StandardMetrics.ms_v_env_cabintemp->AsString("0"))),
+  };
+
+/**
+ * Message definitions, indexed by OVMS_V2_MSG_*
+ *  - modified: metrics causing a transmission on the next opportunity
+ *  - urgent: metrics causing an immediate transmission if peers are connected
+ */
+static const OvmsServerV2MsgDef v2_msgdefs[OVMS_V2_MSG_COUNT] =
+  {
+    { "MP-0 S",
+      MS_V_BAT_SOC "," MS_V_CHARGE_VOLTAGE "," MS_V_CHARGE_CURRENT "," MS_V_CHARGE_STATE ","
+      MS_V_CHARGE_SUBSTATE "," MS_V_CHARGE_MODE "," MS_V_BAT_RANGE_IDEAL "," MS_V_BAT_RANGE_EST ","
+      MS_V_CHARGE_CLIMIT "," MS_V_CHARGE_KWH "," MS_V_CHARGE_TIMERMODE "," MS_V_CHARGE_TIMERSTART ","
+      MS_V_BAT_CAC "," MS_V_CHARGE_DURATION_FULL "," MS_V_CHARGE_DURATION_RANGE "," MS_V_CHARGE_DURATION_SOC ","
+      MS_V_CHARGE_INPROGRESS "," MS_V_CHARGE_LIMIT_RANGE "," MS_V_CHARGE_LIMIT_SOC "," MS_V_ENV_COOLING ","
+      MS_V_BAT_RANGE_FULL "," MS_V_BAT_POWER "," MS_V_BAT_VOLTAGE "," MS_V_BAT_SOH ","
+      MS_V_CHARGE_POWER "," MS_V_CHARGE_EFFICIENCY "," MS_V_BAT_CURRENT "," MS_V_BAT_RANGE_SPEED,
+      MS_V_CHARGE_CLIMIT "," MS_V_CHARGE_LIMIT_RANGE "," MS_V_CHARGE_LIMIT_SOC "," MS_V_CHARGE_STATE ","
+      MS_V_CHARGE_SUBSTATE "," MS_V_CHARGE_MODE "," MS_V_CHARGE_INPROGRESS "," MS_V_ENV_COOLING ","
+      MS_V_BAT_CAC "," MS_V_BAT_SOH,
+      v2_fields_stat, V2_COUNT(v2_fields_stat) },
+    { "MP-0 G",
+      MS_V_GEN_INPROGRESS "," MS_V_GEN_PILOT "," MS_V_GEN_VOLTAGE "," MS_V_GEN_CURRENT ","
+      MS_V_GEN_POWER "," MS_V_GEN_EFFICIENCY "," MS_V_GEN_TYPE "," MS_V_GEN_STATE ","
+      MS_V_GEN_SUBSTATE "," MS_V_GEN_MODE "," MS_V_GEN_CLIMIT "," MS_V_GEN_LIMIT_RANGE ","
+      MS_V_GEN_LIMIT_SOC "," MS_V_GEN_KWH "," MS_V_GEN_KWH_GRID "," MS_V_GEN_KWH_GRID_TOTAL ","
+      MS_V_GEN_TIME "," MS_V_GEN_TIMERMODE "," MS_V_GEN_TIMERSTART "," MS_V_GEN_DURATION_EMPTY ","
+      MS_V_GEN_DURATION_RANGE "," MS_V_GEN_DURATION_SOC "," MS_V_GEN_TEMP,
+      MS_V_GEN_CLIMIT "," MS_V_GEN_LIMIT_RANGE "," MS_V_GEN_LIMIT_SOC "," MS_V_GEN_STATE ","
+      MS_V_GEN_SUBSTATE "," MS_V_GEN_MODE "," MS_V_GEN_INPROGRESS,
+      v2_fields_gen, V2_COUNT(v2_fields_gen) },
+    { "MP-0 L",
+      MS_V_POS_LATITUDE "," MS_V_POS_LONGITUDE "," MS_V_POS_DIRECTION "," MS_V_POS_ALTITUDE ","
+      MS_V_POS_GPSLOCK "," MS_V_POS_GPSSQ "," MS_V_POS_GPSMODE "," MS_V_POS_GPSHDOP ","
+      MS_V_POS_SATCOUNT "," MS_V_POS_GPSSPEED "," MS_V_POS_SPEED "," MS_V_ENV_DRIVEMODE ","
+      MS_V_BAT_POWER "," MS_V_BAT_ENERGY_USED "," MS_V_BAT_ENERGY_RECD "," MS_V_INV_POWER ","
+      MS_V_INV_EFFICIENCY,
+      MS_V_ENV_DRIVEMODE "," MS_V_POS_GPSLOCK "," MS_V_POS_GPSMODE,
+      v2_fields_gps, V2_COUNT(v2_fields_gps) },
+    { "MP-0 Y",
+      MS_V_TPMS_PRESSURE "," MS_V_TPMS_TEMP "," MS_V_TPMS_HEALTH "," MS_V_TPMS_ALERT,
+      MS_V_TPMS_ALERT,
+      v2_fields_tpms, V2_COUNT(v2_fields_tpms) },
+    { "MP-0 W",
+      NULL,
+      NULL,
+      v2_fields_tpms_legacy, V2_COUNT(v2_fields_tpms_legacy) },
+    { "MP-0 F",
+      MS_M_VERSION "," MS_V_VIN "," MS_V_TYPE "," MS_N_PROVIDER ","
+      MS_V_ENV_SERV_RANGE "," MS_V_ENV_SERV_TIME "," MS_M_HARDWARE,
+      MS_V_VIN "," MS_V_TYPE "," MS_N_PROVIDER "," MS_M_HARDWARE,
+      v2_fields_firmware, V2_COUNT(v2_fields_firmware) },
+    { "MP-0 D",
+      MS_V_DOOR_FL "," MS_V_DOOR_FR "," MS_V_DOOR_CHARGEPORT "," MS_V_CHARGE_PILOT ","
+      MS_V_CHARGE_INPROGRESS "," MS_V_ENV_HANDBRAKE "," MS_V_ENV_ON ","
+      MS_V_ENV_LOCKED "," MS_V_ENV_VALET "," MS_V_ENV_HEADLIGHTS "," MS_V_DOOR_HOOD "," MS_V_DOOR_TRUNK ","
+      MS_V_ENV_AWAKE "," MS_V_ENV_COOLING "," MS_V_ENV_CTRL_LOGIN "," MS_V_ENV_CTRL_CONFIG ","
+      MS_V_ENV_ALARM "," MS_V_INV_TEMP "," MS_V_MOT_TEMP "," MS_V_BAT_TEMP "," MS_V_ENV_TEMP ","
+      MS_V_BAT_12V_VOLTAGE "," MS_V_DOOR_RL "," MS_V_DOOR_RR "," MS_V_ENV_CHARGING12V ","
+      MS_V_ENV_AUX12V "," MS_V_ENV_HVAC "," MS_V_CHARGE_TEMP "," MS_V_ENV_CABINTEMP,
+      MS_V_DOOR_FL "," MS_V_DOOR_FR "," MS_V_DOOR_CHARGEPORT "," MS_V_CHARGE_PILOT ","
+      MS_V_CHARGE_INPROGRESS "," MS_V_ENV_HANDBRAKE "," MS_V_ENV_ON "," MS_V_ENV_LOCKED ","
+      MS_V_ENV_VALET "," MS_V_DOOR_HOOD "," MS_V_DOOR_TRUNK "," MS_V_ENV_AWAKE ","
+      MS_V_ENV_COOLING "," MS_V_ENV_ALARM "," MS_V_DOOR_RL "," MS_V_DOOR_RR ","
+      MS_V_ENV_CHARGING12V "," MS_V_ENV_AUX12V "," MS_V_ENV_HVAC,
+      v2_fields_environment, V2_COUNT(v2_fields_environment) },
+  };
+
+OvmsServerV2Msg::OvmsServerV2Msg()
+  {
+  m_def = NULL;
+  m_now = NULL;
+  m_modified = false;
+  m_dirty = 0;
+  m_always = 0;
+  }
+
+void OvmsServerV2Msg::Init(const OvmsServerV2MsgDef* def, bool* now)
+  {
+  m_def = def;
+  m_now = now;
+  m_modified = false;
+  m_dirty = UINT64_MAX;
+  m_always = 0;
+  for (int i = 0; i < def->count; i++)
+    {
+    if (def->fields[i].always)
+      m_always |= (1ULL << i);
+    }
+  m_fields.assign(def->count, extram::string());
+  m_text.clear();
+  }
+
+/**
+ * Render: update the message text
+ *  - only fields marked dirty (by a metric change) or flagged "always" are
+ *    formatted, the text is only reassembled if a field text changed
+ */
+const extram::string& OvmsServerV2Msg::Render(metric_unit_t units_distance)
+  {
+  uint64_t render = m_dirty | m_always;
+  bool changed = m_text.empty();
+  m_dirty = 0;
+
+  for (int i = 0; render != 0 && i < m_def->count; i++, render >>= 1)
+    {
+    if ((render & 1) == 0) continue;
+    m_scratch.clear();
+    m_def->fields[i].format(m_scratch, units_distance);
+    if (m_scratch != m_fields[i])
+      {
+      m_fields[i].swap(m_scratch);
+      changed = true;
+      }
+    }
+
+  if (changed)
+    {
+    m_text.assign(m_def->prefix);
+    for (int i = 0; i < m_def->count; i++)
+      {
+      m_text.append(m_def->fields[i].sep);
+      m_text.append(m_fields[i]);
+      }
+    }
+
+  return m_text;
+  }
+
+/**
+ * LinkMetrics: register the message links of a metric name list
+ */
+void OvmsServerV2::LinkMetrics(std::vector<OvmsServerV2Link>& links, int msg, int kind, const char* metrics)
+  {
+  if (!metrics) return;
+  const char* name = metrics;
+  while (*name)
+    {
+    const char* end = strchr(name, ',');
+    std::string metricname = end ? std::string(name, end-name) : std::string(name);
+    OvmsMetric* metric = MyMetrics.Find(metricname.c_str());
+    if (metric && metric->m_slot != METRICS_SLOT_NONE)
+      {
+      OvmsServerV2Link link = { metric->m_slot, (uint8_t)msg, (uint8_t)kind };
+      links.push_back(link);
+      }
+    else
+      {
+      ESP_LOGE(TAG, "%s: unknown metric '%s'", v2_msgdefs[msg].prefix, metricname.c_str());
+      }
+    if (!end) break;
+    name = end + 1;
+    }
+  }
+
+/**
+ * LinkMessages: build the metric links of all messages, sorted by slot
+ */
+void OvmsServerV2::LinkMessages(std::vector<OvmsServerV2Link>& links)
+  {
+  for (int msg = 0; msg < OVMS_V2_MSG_COUNT; msg++)
+    {
+    const OvmsServerV2MsgDef& def = v2_msgdefs[msg];
+    if (def.count > OVMS_V2_MSG_MAXFIELDS)
+      ESP_LOGE(TAG, "%s: too many fields (%d)", def.prefix, def.count);
+    LinkMetrics(links, msg, OVMS_V2_LINK_MODIFIED, def.modified);
+    LinkMetrics(links, msg, OVMS_V2_LINK_URGENT, def.urgent);
+    for (int field = 0; field < def.count && field < OVMS_V2_MSG_MAXFIELDS; field++)
+      LinkMetrics(links, msg, field, def.fields[field].metrics);
+    }
+  std::stable_sort(links.begin(), links.end(),
+    [](const OvmsServerV2Link& a, const OvmsServerV2Link& b) { return a.slot < b.slot; });
+  }
+
+/**
+ * ApplyLinks: translate a metric change into message states
+ */
+void OvmsServerV2::ApplyLinks(const std::vector<OvmsServerV2Link>& links, OvmsServerV2Msg* msgs,
+                              OvmsMetric* metric, bool peers)
+  {
+  OvmsServerV2Link key = { metric->m_slot, 0, 0 };
+  auto it = std::lower_bound(links.begin(), links.end(), key,
+    [](const OvmsServerV2Link& a, const OvmsServerV2Link& b) { return a.slot < b.slot; });
+  for (; it != links.end() && it->slot == metric->m_slot; ++it)
+    {
+    OvmsServerV2Msg& msg = msgs[it->msg];
+    if (it->kind == OVMS_V2_LINK_MODIFIED)
+      msg.m_modified = true;
+    else if (it->kind == OVMS_V2_LINK_URGENT)
+      { if (peers) *msg.m_now = true; }
+    else
+      msg.m_dirty |= (1ULL << it->kind);
+    }
+  }
+
+/**
+ * CollectModified: apply all metric changes since the last collection
+ */
+void OvmsServerV2::CollectModified()
+  {
+  bool peers = (StandardMetrics.ms_s_v2_peers->AsInt() != 0);
+  OvmsMetric* metric;
+  while ((metric = m_dirty->Next()) != NULL)
+    ApplyLinks(m_links, m_msg, metric, peers);
+  }
+
+/**
+ * TransmitMsg: send a status message if modified (or always)
+ *  Returns true if the message has been sent.
+ */
+bool OvmsServerV2::TransmitMsg(int msg, bool always)
+  {
+  OvmsServerV2Msg& m = m_msg[msg];
+  *m.m_now = false;
+
+  bool modified = m.m_modified;
+  m.m_modified = false;
 
   // Quick exit if nothing modified
-  if ((!always)&&(!modified)) return;
+  if ((!always)&&(!modified)) return false;
+
+  const extram::string& text = m.Render(m_units_distance);
+  return Transmit(text.data(), text.length());
+  }
 
+void OvmsServerV2::TransmitMsgStat(bool always)
+  {
+  TransmitMsg(OVMS_V2_MSG_STAT, always);
+  }
+
+void OvmsServerV2::TransmitMsgGen(bool always)
+  {
+  TransmitMsg(OVMS_V2_MSG_GEN, always);
+  }
+
+void OvmsServerV2::TransmitMsgGPS(bool always)
+  {
+  TransmitMsg(OVMS_V2_MSG_GPS, always);
+  }
+
+void OvmsServerV2::TransmitMsgTPMS(bool always)
+  {
+  // Transmit new "Y" message, followed by the legacy "W" message:
+  if (TransmitMsg(OVMS_V2_MSG_TPMS, always))
+    TransmitMsg(OVMS_V2_MSG_TPMS_LEGACY, true);
+  }
+
+void OvmsServerV2::TransmitMsgFirmware(bool always)
+  {
+  // As the signal quality is the only fast changing metric here, and will normally
+  // change continuously +/- 2 even while parking, we check this for an actual value
+  // difference > 2 to the last transmission, so we don't need to retransmit the
+  // -now- comparably huge static info contained here on every signal level change.
+  // TODO: move dynamic network status infos into another message (needs App updates)
+  static int last_m_net_sq = 0;
+  int curr_m_net_sq = StandardMetrics.ms_m_net_sq->AsInt(0, sq);
+
+  if (TransmitMsg(OVMS_V2_MSG_FIRMWARE, always || (std::abs(curr_m_net_sq - last_m_net_sq) > 2)))
+    last_m_net_sq = curr_m_net_sq;
+  }
+
+void OvmsServerV2::TransmitMsgEnvironment(bool always)
+  {
+  TransmitMsg(OVMS_V2_MSG_ENVIRONMENT, always);
+  }
+
+void OvmsServerV2::TransmitMsgCapabilities(bool always)
+  {
+  m_now_capabilities = false;
+  }
+
+void OvmsServerV2::TransmitMsgGroup(bool always)
+  {
+  m_now_group = false;
+  }
+
+#ifdef CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+
+/**
+ * Reference builders: the former std::ostringstream message builders, kept
+ * verbatim as the specification for the field tables. Only used by
+ * VerifyMessages(), see "test v2render".
+ */
+
+static extram::string v2ref_stat(metric_unit_t units_distance)
+  {
   int mins_range = StandardMetrics.ms_v_charge_duration_range->AsInt();
   int mins_soc = StandardMetrics.ms_v_charge_duration_soc->AsInt();
   bool charging = StandardMetrics.ms_v_charge_inprogress->AsBool();
-  metric_unit_t units_speed = (m_units_distance == Miles) ? Mph : Kph;
+  metric_unit_t units_speed = (units_distance == Miles) ? Mph : Kph;
 
   extram::ostringstream buffer;
   buffer
@@ -1003,7 +1591,7 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << "MP-0 S"
     << StandardMetrics.ms_v_bat_soc->AsString("0", Other, 1)
     << ","
-    << ((m_units_distance == Kilometers) ? "K" : "M")
+    << ((units_distance == Kilometers) ? "K" : "M")
     << ","
     << StandardMetrics.ms_v_charge_voltage->AsInt()
     << ","
@@ -1013,9 +1601,9 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << ","
     << StandardMetrics.ms_v_charge_mode->AsString("standard")
     << ","
-    << StandardMetrics.ms_v_bat_range_ideal->AsInt(0, m_units_distance)
+    << StandardMetrics.ms_v_bat_range_ideal->AsInt(0, units_distance)
     << ","
-    << StandardMetrics.ms_v_bat_range_est->AsInt(0, m_units_distance)
+    << StandardMetrics.ms_v_bat_range_est->AsInt(0, units_distance)
     << ","
     << StandardMetrics.ms_v_charge_climit->AsInt()
     << ","
@@ -1043,7 +1631,7 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << ","
     << (((mins_range >= 0) && (mins_range < mins_soc)) ? mins_range : mins_soc)
     << ","
-    << (int) StandardMetrics.ms_v_charge_limit_range->AsFloat(0, m_units_distance)
+    << (int) StandardMetrics.ms_v_charge_limit_range->AsFloat(0, units_distance)
     << ","
     << StandardMetrics.ms_v_charge_limit_soc->AsInt()
     << ","
@@ -1059,7 +1647,7 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << ","
     << mins_soc
     << ","
-    << StandardMetrics.ms_v_bat_range_full->AsInt(0, m_units_distance)
+    << StandardMetrics.ms_v_bat_range_full->AsInt(0, units_distance)
     << ","
     << "0"  // car_chargetype
     << ","
@@ -1078,44 +1666,11 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << std::setprecision(1)
     << StandardMetrics.ms_v_bat_range_speed->AsFloat(0, units_speed)
     ;
-
-  Transmit(buffer.str().c_str());
+  return buffer.str();
   }
 
-void OvmsServerV2::TransmitMsgGen(bool always)
+static extram::string v2ref_gen(metric_unit_t units_distance)
   {
-  m_now_gen = false;
-
-  bool modified =
-    StandardMetrics.ms_v_gen_inprogress->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_pilot->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_voltage->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_current->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_power->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_efficiency->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_type->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_state->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_substate->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_mode->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_climit->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_limit_range->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_limit_soc->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_kwh->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_limit_range->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_limit_soc->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_kwh_grid->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_kwh_grid_total->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_time->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_timermode->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_timerstart->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_duration_empty->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_duration_range->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_duration_soc->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_gen_temp->IsModifiedAndClear(MyOvmsServerV2Modifier);
-
-  // Quick exit if nothing modified
-  if ((!always)&&(!modified)) return;
-
   extram::ostringstream buffer;
   buffer
     << std::fixed
@@ -1143,7 +1698,7 @@ void OvmsServerV2::TransmitMsgGen(bool always)
     << ","
     << StandardMetrics.ms_v_gen_climit->AsFloat()
     << ","
-    << StandardMetrics.ms_v_gen_limit_range->AsFloat(0, m_units_distance)
+    << StandardMetrics.ms_v_gen_limit_range->AsFloat(0, units_distance)
     << ","
     << StandardMetrics.ms_v_gen_limit_soc->AsInt()
     << ","
@@ -1167,44 +1722,18 @@ void OvmsServerV2::TransmitMsgGen(bool always)
     << ";"
     << StandardMetrics.ms_v_gen_temp->AsFloat()
     ;
-
-  Transmit(buffer.str().c_str());
+  return buffer.str();
   }
 
-
-void OvmsServerV2::TransmitMsgGPS(bool always)
+static extram::string v2ref_gps(metric_unit_t units_distance)
   {
-  m_now_gps = false;
-
-  bool modified =
-    StandardMetrics.ms_v_pos_latitude->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_longitude->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_direction->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_altitude->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_gpslock->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_gpssq->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_gpsmode->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_gpshdop->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_satcount->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_gpsspeed->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_pos_speed->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_drivemode->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_power->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_energy_used->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_energy_recd->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_inv_power->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_inv_efficiency->IsModifiedAndClear(MyOvmsServerV2Modifier);
-
-  // Quick exit if nothing modified
-  if ((!always)&&(!modified)) return;
-
   bool stale =
     StandardMetrics.ms_v_pos_gpstime->IsStale();
 
   char drivemode[10];
   sprintf(drivemode, "%x", StandardMetrics.ms_v_env_drivemode->AsInt());
 
-  metric_unit_t units_speed = (m_units_distance == Kilometers) ? Kph : Mph;
+  metric_unit_t units_speed = (units_distance == Kilometers) ? Kph : Mph;
 
   extram::ostringstream buffer;
   buffer
@@ -1221,7 +1750,7 @@ void OvmsServerV2::TransmitMsgGPS(bool always)
     << ((stale)?",0,":",1,")
     << StandardMetrics.ms_v_pos_speed->AsString("0", units_speed, 1)
     << ","
-    << int(StandardMetrics.ms_v_pos_trip->AsFloat(0, m_units_distance)*10)
+    << int(StandardMetrics.ms_v_pos_trip->AsFloat(0, units_distance)*10)
     << ","
     << drivemode
     << ","
@@ -1245,27 +1774,11 @@ void OvmsServerV2::TransmitMsgGPS(bool always)
     << ","
     << StandardMetrics.ms_v_pos_gpssq->AsInt()
     ;
-
-  Transmit(buffer.str().c_str());
+  return buffer.str();
   }
 
-void OvmsServerV2::TransmitMsgTPMS(bool always)
+static extram::string v2ref_tpms(metric_unit_t units_distance)
   {
-  m_now_tpms = false;
-
-  bool modified =
-    StandardMetrics.ms_v_tpms_pressure->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_tpms_temp->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_tpms_health->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_tpms_alert->IsModifiedAndClear(MyOvmsServerV2Modifier);
-
-  // Quick exit if nothing modified
-  if ((!always)&&(!modified)) return;
-
-  extram::ostringstream buffer;
-
-  // Transmit new "Y" message:
-
   int defstale_pressure =
     StandardMetrics.ms_v_tpms_pressure->IsDefined()
     ? (StandardMetrics.ms_v_tpms_pressure->IsStale() ? 0 : 1)
@@ -1287,6 +1800,7 @@ void OvmsServerV2::TransmitMsgTPMS(bool always)
   if (MyVehicleFactory.m_currentvehicle)
     wheels = MyVehicleFactory.m_currentvehicle->GetTpmsLayout();
 
+  extram::ostringstream buffer;
   buffer
     << "MP-0 Y"
     << wheels.size();
@@ -1316,10 +1830,11 @@ void OvmsServerV2::TransmitMsgTPMS(bool always)
     << StandardMetrics.ms_v_tpms_alert->AsString("")
     << "," << defstale_alert
     ;
-  Transmit(buffer.str().c_str());
-
-  // Transmit legacy "W" message (fixed four tyres, only pressures & temperatures):
+  return buffer.str();
+  }
 
+static extram::string v2ref_tpms_legacy(metric_unit_t units_distance)
+  {
   bool stale =
     StandardMetrics.ms_v_tpms_pressure->IsStale() ||
     StandardMetrics.ms_v_tpms_temp->IsStale() ||
@@ -1340,8 +1855,7 @@ void OvmsServerV2::TransmitMsgTPMS(bool always)
   else
     { defstale = 1; }
 
-  buffer.str("");
-  buffer.clear();
+  extram::ostringstream buffer;
   buffer
     << "MP-0 W"
     << StandardMetrics.ms_v_tpms_pressure->ElemAsString(MS_V_TPMS_IDX_FR, "0", PSI)
@@ -1362,36 +1876,11 @@ void OvmsServerV2::TransmitMsgTPMS(bool always)
     << ","
     << defstale
     ;
-  Transmit(buffer.str().c_str());
+  return buffer.str();
   }
 
-void OvmsServerV2::TransmitMsgFirmware(bool always)
+static extram::string v2ref_firmware(metric_unit_t units_distance)
   {
-  // As the signal quality is the only fast changing metric here, and will normally
-  // change continuously +/- 2 even while parking, we check this for an actual value
-  // difference > 2 to the last transmission, so we don't need to retransmit the
-  // -now- comparably huge static info contained here on every signal level change.
-  // TODO: move dynamic network status infos into another message (needs App updates)
-  static int last_m_net_sq = 0;
-  int curr_m_net_sq = StandardMetrics.ms_m_net_sq->AsInt(0, sq);
-
-  m_now_firmware = false;
-
-  bool modified =
-    StandardMetrics.ms_m_version->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_vin->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    (std::abs(curr_m_net_sq - last_m_net_sq) > 2) |
-    StandardMetrics.ms_v_type->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_m_net_provider->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_service_range->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_service_time->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_m_hardware->IsModifiedAndClear(MyOvmsServerV2Modifier);
-
-  // Quick exit if nothing modified
-  if ((!always)&&(!modified)) return;
-
-  last_m_net_sq = curr_m_net_sq;
-
   extram::ostringstream buffer;
   buffer
     << "MP-0 F"
@@ -1413,117 +1902,11 @@ void OvmsServerV2::TransmitMsgFirmware(bool always)
     << ","
     << mp_encode(StandardMetrics.ms_m_hardware->AsString(""))
     ;
-
-  Transmit(buffer.str().c_str());
-  }
-
-uint8_t Doors1()
-  {
-  car_doors1_t car_doors1;
-  car_doors1.bits.FrontLeftDoor = StandardMetrics.ms_v_door_fl->AsBool();
-  car_doors1.bits.FrontRightDoor = StandardMetrics.ms_v_door_fr->AsBool();
-  car_doors1.bits.ChargePort = StandardMetrics.ms_v_door_chargeport->AsBool();
-  car_doors1.bits.PilotSignal = StandardMetrics.ms_v_charge_pilot->AsBool();
-  car_doors1.bits.Charging = StandardMetrics.ms_v_charge_inprogress->AsBool();
-  car_doors1.bits.HandBrake = StandardMetrics.ms_v_env_handbrake->AsBool();
-  car_doors1.bits.CarON = StandardMetrics.ms_v_env_on->AsBool();
-
-  return car_doors1.flags;
-  }
-
-uint8_t Doors2()
-  {
-  car_doors2_t car_doors2;
-  car_doors2.bits.CarLocked = StandardMetrics.ms_v_env_locked->AsBool();
-  car_doors2.bits.ValetMode = StandardMetrics.ms_v_env_valet->AsBool();
-  car_doors2.bits.Headlights = StandardMetrics.ms_v_env_headlights->AsBool();
-  car_doors2.bits.Bonnet = StandardMetrics.ms_v_door_hood->AsBool();
-  car_doors2.bits.Trunk = StandardMetrics.ms_v_door_trunk->AsBool();
-
-  return car_doors2.flags;
-  }
-
-uint8_t Doors3()
-  {
-  car_doors3_t car_doors3;
-  car_doors3.bits.CarAwake = StandardMetrics.ms_v_env_awake->AsBool();
-  car_doors3.bits.CoolingPump = StandardMetrics.ms_v_env_cooling->AsBool();
-  car_doors3.bits.CtrlLoggedIn = StandardMetrics.ms_v_env_ctrl_login->AsBool();
-  car_doors3.bits.CtrlCfgMode = StandardMetrics.ms_v_env_ctrl_config->AsBool();
-
-  return car_doors3.flags;
-  }
-
-uint8_t Doors4()
-  {
-  car_doors4_t car_doors4;
-  car_doors4.bits.AlarmSounds = StandardMetrics.ms_v_env_alarm->AsBool();
-
-  return car_doors4.flags;
-  }
-
-uint8_t Doors5()
-  {
-  car_doors5_t car_doors5;
-  car_doors5.bits.RearLeftDoor = StandardMetrics.ms_v_door_rl->AsBool();
-  car_doors5.bits.RearRightDoor = StandardMetrics.ms_v_door_rr->AsBool();
-  car_doors5.bits.Frunk = false; // should this be hood or something else?
-  car_doors5.bits.Charging12V = StandardMetrics.ms_v_env_charging12v->AsBool();
-  car_doors5.bits.Aux12V = StandardMetrics.ms_v_env_aux12v->AsBool();
-  car_doors5.bits.HVAC = StandardMetrics.ms_v_env_hvac->AsBool();
-
-  return car_doors5.flags;
+  return buffer.str();
   }
 
-void OvmsServerV2::TransmitMsgEnvironment(bool always)
+static extram::string v2ref_environment(metric_unit_t units_distance)
   {
-  m_now_environment = false;
-
-  bool modified =
-    // doors 1
-    StandardMetrics.ms_v_door_fl->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_door_fr->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_door_chargeport->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_pilot->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_charge_inprogress->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_handbrake->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_on->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-
-    // doors 2
-    StandardMetrics.ms_v_env_locked->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_valet->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_headlights->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_door_hood->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_door_trunk->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-
-    // doors 3
-    StandardMetrics.ms_v_env_awake->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_cooling->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_ctrl_login->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_ctrl_config->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-
-    // doors 4
-    StandardMetrics.ms_v_env_alarm->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-
-    StandardMetrics.ms_v_inv_temp->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_mot_temp->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_temp->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_temp->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_bat_12v_voltage->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-
-    // doors 5
-    StandardMetrics.ms_v_door_rl->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_door_rr->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_charging12v->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_aux12v->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_hvac->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-
-    StandardMetrics.ms_v_charge_temp->IsModifiedAndClear(MyOvmsServerV2Modifier) |
-    StandardMetrics.ms_v_env_cabintemp->IsModifiedAndClear(MyOvmsServerV2Modifier);
-
-  // Quick exit if nothing modified
-  if ((!always)&&(!modified)) return;
-
   // v2 has one "stale" flag for all temperatures, we say they're stale only if
   // all are stale, IE one valid temperature makes them all valid
   bool stale_temps =
@@ -1549,9 +1932,9 @@ void OvmsServerV2::TransmitMsgEnvironment(bool always)
     << ","
     << StandardMetrics.ms_v_bat_temp->AsString("0")
     << ","
-    << int(StandardMetrics.ms_v_pos_trip->AsFloat(0, m_units_distance)*10)
+    << int(StandardMetrics.ms_v_pos_trip->AsFloat(0, units_distance)*10)
     << ","
-    << int(StandardMetrics.ms_v_pos_odometer->AsFloat(0, m_units_distance)*10)
+    << int(StandardMetrics.ms_v_pos_odometer->AsFloat(0, units_distance)*10)
     << ","
     << StandardMetrics.ms_v_pos_speed->AsString("0")
     << ","
@@ -1579,20 +1962,189 @@ void OvmsServerV2::TransmitMsgEnvironment(bool always)
     << ","
     << StandardMetrics.ms_v_env_cabintemp->AsString("0")
     ;
+  return buffer.str();
+  }
+
+typedef extram::string (*OvmsServerV2RefBuilder)(metric_unit_t units_distance);
 
-  Transmit(buffer.str().c_str());
+/**
+ * Reference trigger lists: the former IsModifiedAndClear() lists ("modified")
+ * and MetricModified() checks ("urgent") per message
+ */
+static void v2ref_triggers(std::vector<OvmsMetric*> (&modified)[OVMS_V2_MSG_COUNT],
+                           std::vector<OvmsMetric*> (&urgent)[OVMS_V2_MSG_COUNT])
+  {
+  MetricsStandard& m = StandardMetrics;
+  modified[OVMS_V2_MSG_STAT] = {
+    m.ms_v_bat_soc, m.ms_v_charge_voltage, m.ms_v_charge_current, m.ms_v_charge_state,
+    m.ms_v_charge_substate, m.ms_v_charge_mode, m.ms_v_bat_range_ideal, m.ms_v_bat_range_est,
+    m.ms_v_charge_climit, m.ms_v_charge_kwh, m.ms_v_charge_timermode, m.ms_v_charge_timerstart,
+    m.ms_v_bat_cac, m.ms_v_charge_duration_full, m.ms_v_charge_duration_range, m.ms_v_charge_duration_soc,
+    m.ms_v_charge_inprogress, m.ms_v_charge_limit_range, m.ms_v_charge_limit_soc, m.ms_v_env_cooling,
+    m.ms_v_bat_range_full, m.ms_v_bat_power, m.ms_v_bat_voltage, m.ms_v_bat_soh,
+    m.ms_v_charge_power, m.ms_v_charge_efficiency, m.ms_v_bat_current, m.ms_v_bat_range_speed };
+  urgent[OVMS_V2_MSG_STAT] = {
+    m.ms_v_charge_climit, m.ms_v_charge_limit_range, m.ms_v_charge_limit_soc, m.ms_v_charge_state,
+    m.ms_v_charge_substate, m.ms_v_charge_mode, m.ms_v_charge_inprogress, m.ms_v_env_cooling,
+    m.ms_v_bat_cac, m.ms_v_bat_soh };
+  modified[OVMS_V2_MSG_GEN] = {
+    m.ms_v_gen_inprogress, m.ms_v_gen_pilot, m.ms_v_gen_voltage, m.ms_v_gen_current,
+    m.ms_v_gen_power, m.ms_v_gen_efficiency, m.ms_v_gen_type, m.ms_v_gen_state,
+    m.ms_v_gen_substate, m.ms_v_gen_mode, m.ms_v_gen_climit, m.ms_v_gen_limit_range,
+    m.ms_v_gen_limit_soc, m.ms_v_gen_kwh, m.ms_v_gen_kwh_grid, m.ms_v_gen_kwh_grid_total,
+    m.ms_v_gen_time, m.ms_v_gen_timermode, m.ms_v_gen_timerstart, m.ms_v_gen_duration_empty,
+    m.ms_v_gen_duration_range, m.ms_v_gen_duration_soc, m.ms_v_gen_temp };
+  urgent[OVMS_V2_MSG_GEN] = {
+    m.ms_v_gen_climit, m.ms_v_gen_limit_range, m.ms_v_gen_limit_soc, m.ms_v_gen_state,
+    m.ms_v_gen_substate, m.ms_v_gen_mode, m.ms_v_gen_inprogress };
+  modified[OVMS_V2_MSG_GPS] = {
+    m.ms_v_pos_latitude, m.ms_v_pos_longitude, m.ms_v_pos_direction, m.ms_v_pos_altitude,
+    m.ms_v_pos_gpslock, m.ms_v_pos_gpssq, m.ms_v_pos_gpsmode, m.ms_v_pos_gpshdop,
+    m.ms_v_pos_satcount, m.ms_v_pos_gpsspeed, m.ms_v_pos_speed, m.ms_v_env_drivemode,
+    m.ms_v_bat_power, m.ms_v_bat_energy_used, m.ms_v_bat_energy_recd, m.ms_v_inv_power,
+    m.ms_v_inv_efficiency };
+  urgent[OVMS_V2_MSG_GPS] = {
+    m.ms_v_env_drivemode, m.ms_v_pos_gpslock, m.ms_v_pos_gpsmode };
+  modified[OVMS_V2_MSG_TPMS] = {
+    m.ms_v_tpms_pressure, m.ms_v_tpms_temp, m.ms_v_tpms_health, m.ms_v_tpms_alert };
+  urgent[OVMS_V2_MSG_TPMS] = {
+    m.ms_v_tpms_alert };
+  modified[OVMS_V2_MSG_FIRMWARE] = {
+    m.ms_m_version, m.ms_v_vin, m.ms_v_type, m.ms_m_net_provider,
+    m.ms_v_env_service_range, m.ms_v_env_service_time, m.ms_m_hardware };
+  urgent[OVMS_V2_MSG_FIRMWARE] = {
+    m.ms_v_vin, m.ms_v_type, m.ms_m_net_provider, m.ms_m_hardware };
+  modified[OVMS_V2_MSG_ENVIRONMENT] = {
+    m.ms_v_door_fl, m.ms_v_door_fr, m.ms_v_door_chargeport, m.ms_v_charge_pilot,
+    m.ms_v_charge_inprogress, m.ms_v_env_handbrake, m.ms_v_env_on,
+    m.ms_v_env_locked, m.ms_v_env_valet, m.ms_v_env_headlights, m.ms_v_door_hood, m.ms_v_door_trunk,
+    m.ms_v_env_awake, m.ms_v_env_cooling, m.ms_v_env_ctrl_login, m.ms_v_env_ctrl_config,
+    m.ms_v_env_alarm, m.ms_v_inv_temp, m.ms_v_mot_temp, m.ms_v_bat_temp, m.ms_v_env_temp,
+    m.ms_v_bat_12v_voltage, m.ms_v_door_rl, m.ms_v_door_rr, m.ms_v_env_charging12v,
+    m.ms_v_env_aux12v, m.ms_v_env_hvac, m.ms_v_charge_temp, m.ms_v_env_cabintemp };
+  urgent[OVMS_V2_MSG_ENVIRONMENT] = {
+    m.ms_v_door_fl, m.ms_v_door_fr, m.ms_v_door_chargeport, m.ms_v_charge_pilot,
+    m.ms_v_charge_inprogress, m.ms_v_env_handbrake, m.ms_v_env_on, m.ms_v_env_locked,
+    m.ms_v_env_valet, m.ms_v_door_hood, m.ms_v_door_trunk, m.ms_v_env_awake,
+    m.ms_v_env_cooling, m.ms_v_env_alarm, m.ms_v_door_rl, m.ms_v_door_rr,
+    m.ms_v_env_charging12v, m.ms_v_env_aux12v, m.ms_v_env_hvac };
   }
 
-void OvmsServerV2::TransmitMsgCapabilities(bool always)
+static bool v2ref_triggered(const std::vector<OvmsMetric*>& list, const std::set<OvmsMetric*>& changed)
   {
-  m_now_capabilities = false;
+  for (OvmsMetric* metric : list)
+    {
+    if (changed.count(metric)) return true;
+    }
+  return false;
   }
 
-void OvmsServerV2::TransmitMsgGroup(bool always)
+/**
+ * VerifyMessages: check the incremental status message rendering
+ *  Runs a private pipeline (dirty set, links, messages) once per second and
+ *  compares per message:
+ *   - incremental vs. full rendering (= field metric lists complete)
+ *   - full rendering vs. reference builder (= field formatters)
+ *   - modified & urgent states vs. reference trigger lists
+ *  Metrics updated while a round is checked may cause a single spurious
+ *  text mismatch, repeated mismatches indicate an error.
+ *  Returns the number of mismatches.
+ */
+int OvmsServerV2::VerifyMessages(OvmsWriter* writer, int seconds)
   {
-  m_now_group = false;
+  static const OvmsServerV2RefBuilder refbuilder[OVMS_V2_MSG_COUNT] =
+    {
+    v2ref_stat, v2ref_gen, v2ref_gps, v2ref_tpms, v2ref_tpms_legacy, v2ref_firmware, v2ref_environment
+    };
+  static const char* const checkname[4] = { "incremental", "reference", "modified", "urgent" };
+
+  metric_unit_t units_distance = Kilometers;
+  if (MyConfig.GetParamValue("vehicle", "units.distance").compare("M") == 0)
+    units_distance = Miles;
+
+  std::vector<OvmsMetric*> ref_modified[OVMS_V2_MSG_COUNT], ref_urgent[OVMS_V2_MSG_COUNT];
+  v2ref_triggers(ref_modified, ref_urgent);
+
+  std::vector<OvmsServerV2Link> links;
+  LinkMessages(links);
+  OvmsServerV2Msg msgs[OVMS_V2_MSG_COUNT];
+  bool now[OVMS_V2_MSG_COUNT];
+  for (int msg = 0; msg < OVMS_V2_MSG_COUNT; msg++)
+    msgs[msg].Init(&v2_msgdefs[msg], &now[msg]);
+
+  OvmsMetricDirtySet* dirty = MyMetrics.AcquireDirtySet();
+  int errors[OVMS_V2_MSG_COUNT][4] = {};
+  int total = 0;
+
+  for (int round = 0; round <= seconds; round++)
+    {
+    if (round > 0)
+      vTaskDelay(1000 / portTICK_PERIOD_MS);
+
+    // Collect changes, the initial round only renders all fields:
+    std::set<OvmsMetric*> changed;
+    OvmsMetric* metric;
+    for (int msg = 0; msg < OVMS_V2_MSG_COUNT; msg++)
+      {
+      msgs[msg].m_modified = false;
+      now[msg] = false;
+      }
+    while ((metric = dirty->Next()) != NULL)
+      {
+      changed.insert(metric);
+      ApplyLinks(links, msgs, metric, true);
+      }
+
+    for (int msg = 0; msg < OVMS_V2_MSG_COUNT; msg++)
+      {
+      OvmsServerV2Msg& m = msgs[msg];
+      const extram::string& text = m.Render(units_distance);
+      OvmsServerV2Msg full;
+      bool fullnow;
+      full.Init(&v2_msgdefs[msg], &fullnow);
+      const extram::string& fulltext = full.Render(units_distance);
+      extram::string reftext = refbuilder[msg](units_distance);
+
+      bool fail[4] =
+        {
+        text != fulltext,
+        fulltext != reftext,
+        round > 0 && m.m_modified != v2ref_triggered(ref_modified[msg], changed),
+        round > 0 && now[msg] != v2ref_triggered(ref_urgent[msg], changed),
+        };
+      for (int check = 0; check < 4; check++)
+        {
+        if (!fail[check]) continue;
+        if (errors[msg][check]++ == 0)
+          {
+          writer->printf("%s: %s mismatch in round %d:\n", m.m_def->prefix, checkname[check], round);
+          if (check == 0)
+            writer->printf("  incremental: %s\n  full:        %s\n", text.c_str(), fulltext.c_str());
+          else if (check == 1)
+            writer->printf("  full:        %s\n  reference:   %s\n", fulltext.c_str(), reftext.c_str());
+          else
+            writer->printf("  %s=%d, reference=%d\n", checkname[check],
+              (check == 2) ? m.m_modified : now[msg], (check == 2) ? !m.m_modified : !now[msg]);
+          }
+        total++;
+        }
+      }
+    }
+
+  MyMetrics.ReleaseDirtySet(dirty);
+
+  writer->printf("Message      incremental  reference  modified  urgent\n");
+  for (int msg = 0; msg < OVMS_V2_MSG_COUNT; msg++)
+    {
+    writer->printf("%-12s %11d  %9d  %8d  %6d\n", v2_msgdefs[msg].prefix,
+      errors[msg][0], errors[msg][1], errors[msg][2], errors[msg][3]);
+    }
+  writer->printf("%d rounds checked, %d mismatches\n", seconds+1, total);
+  return total;
   }
 
+#endif // CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+
 void OvmsServerV2::TransmitNotifyInfo()
   {
   m_pending_notify_info = false;
@@ -1756,83 +2308,6 @@ void OvmsServerV2::HandleNotifyDataAck(uint32_t ack)
     }
   }
 
-void OvmsServerV2::MetricModified(OvmsMetric* metric)
-  {
-  // A metric has been changed: if peers are connected,
-  //  check for important changes that should be transmitted ASAP:
-
-  if (StandardMetrics.ms_s_v2_peers->AsInt() == 0)
-    return;
-
-  if ((metric == StandardMetrics.ms_v_vin)||
-      (metric == StandardMetrics.ms_v_type)||
-      (metric == StandardMetrics.ms_m_net_provider)||
-      (metric == StandardMetrics.ms_m_hardware))
-    {
-    m_now_firmware = true;
-    }
-
-  if ((metric == StandardMetrics.ms_v_charge_climit)||
-      (metric == StandardMetrics.ms_v_charge_limit_range)||
-      (metric == StandardMetrics.ms_v_charge_limit_soc)||
-      (metric == StandardMetrics.ms_v_charge_state)||
-      (metric == StandardMetrics.ms_v_charge_substate)||
-      (metric == StandardMetrics.ms_v_charge_mode)||
-      (metric == StandardMetrics.ms_v_charge_inprogress)||
-      (metric == StandardMetrics.ms_v_env_cooling)||
-      (metric == StandardMetrics.ms_v_bat_cac)||
-      (metric == StandardMetrics.ms_v_bat_soh))
-    {
-    m_now_stat = true;
-    }
-
-  if ((metric == StandardMetrics.ms_v_door_fl)||
-      (metric == StandardMetrics.ms_v_door_fr)||
-      (metric == StandardMetrics.ms_v_door_chargeport)||
-      (metric == StandardMetrics.ms_v_charge_pilot)||
-      (metric == StandardMetrics.ms_v_charge_inprogress)||
-      (metric == StandardMetrics.ms_v_env_handbrake)||
-      (metric == StandardMetrics.ms_v_env_on)||
-      (metric == StandardMetrics.ms_v_env_locked)||
-      (metric == StandardMetrics.ms_v_env_valet)||
-      (metric == StandardMetrics.ms_v_door_hood)||
-      (metric == StandardMetrics.ms_v_door_trunk)||
-      (metric == StandardMetrics.ms_v_env_awake)||
-      (metric == StandardMetrics.ms_v_env_cooling)||
-      (metric == StandardMetrics.ms_v_env_alarm)||
-      (metric == StandardMetrics.ms_v_door_rl)||
-      (metric == StandardMetrics.ms_v_door_rr)||
-      (metric == StandardMetrics.ms_v_env_charging12v)||
-      (metric == StandardMetrics.ms_v_env_aux12v)||
-      (metric == StandardMetrics.ms_v_env_hvac))
-    {
-    m_now_environment = true;
-    }
-
-  if ((metric == StandardMetrics.ms_v_env_drivemode)||
-      (metric == StandardMetrics.ms_v_pos_gpslock)||
-      (metric == StandardMetrics.ms_v_pos_gpsmode))
-    {
-    m_now_gps = true;
-    }
-
-  if ((metric == StandardMetrics.ms_v_tpms_alert))
-    {
-    m_now_tpms = true;
-    }
-    
-  if ((metric == StandardMetrics.ms_v_gen_climit)||
-      (metric == StandardMetrics.ms_v_gen_limit_range)||
-      (metric == StandardMetrics.ms_v_gen_limit_soc)||
-      (metric == StandardMetrics.ms_v_gen_state)||
-      (metric == StandardMetrics.ms_v_gen_substate)||
-      (metric == StandardMetrics.ms_v_gen_mode)||
-      (metric == StandardMetrics.ms_v_gen_inprogress))
-    {
-    m_now_gen = true;
-    }
-  }
-
 bool OvmsServerV2::NotificationFilter(OvmsNotifyType* type, const char* subtype)
   {
   if (strcmp(type->m_name, "info") == 0 ||
@@ -2001,6 +2476,8 @@ void OvmsServerV2::Ticker1(std::string event, void* data)
       return;
       }
 
+    CollectModified();
+
     // Periodic transmission of metrics
     bool caron = StandardMetrics.ms_v_env_on->AsBool();
     int now = StandardMetrics.ms_m_monotonic->AsInt();
@@ -2072,12 +2549,6 @@ void OvmsServerV2::RequestUpdate(bool txall)
 OvmsServerV2::OvmsServerV2(const char* name)
   : OvmsServer(name)
   {
-  if (MyOvmsServerV2Modifier == 0)
-    {
-    MyOvmsServerV2Modifier = MyMetrics.RegisterModifier();
-    ESP_LOGI(TAG, "OVMS Server V2 registered metric modifier is #%d",MyOvmsServerV2Modifier);
-    }
-
   m_buffer = new OvmsBuffer(1024);
   SetStatus("Server has been started", false, WaitNetwork);
   m_now_stat = false;
@@ -2109,12 +2580,22 @@ OvmsServerV2::OvmsServerV2(const char* name)
   else
     m_units_distance = Kilometers;
 
+  // init status messages:
+  m_msg[OVMS_V2_MSG_STAT].Init(&v2_msgdefs[OVMS_V2_MSG_STAT], &m_now_stat);
+  m_msg[OVMS_V2_MSG_GEN].Init(&v2_msgdefs[OVMS_V2_MSG_GEN], &m_now_gen);
+  m_msg[OVMS_V2_MSG_GPS].Init(&v2_msgdefs[OVMS_V2_MSG_GPS], &m_now_gps);
+  m_msg[OVMS_V2_MSG_TPMS].Init(&v2_msgdefs[OVMS_V2_MSG_TPMS], &m_now_tpms);
+  m_msg[OVMS_V2_MSG_TPMS_LEGACY].Init(&v2_msgdefs[OVMS_V2_MSG_TPMS_LEGACY], &m_now_tpms);
+  m_msg[OVMS_V2_MSG_FIRMWARE].Init(&v2_msgdefs[OVMS_V2_MSG_FIRMWARE], &m_now_firmware);
+  m_msg[OVMS_V2_MSG_ENVIRONMENT].Init(&v2_msgdefs[OVMS_V2_MSG_ENVIRONMENT], &m_now_environment);
+  LinkMessages(m_links);
+  m_dirty = MyMetrics.AcquireDirtySet();
+
   ESP_LOGI(TAG, "OVMS Server v2 running");
 
   #undef bind  // Kludgy, but works
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyMetrics.RegisterListener(TAG, "*", std::bind(&OvmsServerV2::MetricModified, this, _1));
 
   if (MyOvmsServerV2Reader == 0)
     {
@@ -2150,10 +2631,10 @@ OvmsServerV2::OvmsServerV2(const char* name)
 
 OvmsServerV2::~OvmsServerV2()
   {
-  MyMetrics.DeregisterListener(TAG);
   MyEvents.DeregisterEvent(TAG);
   MyNotify.ClearReader(MyOvmsServerV2Reader);
   Disconnect();
+  MyMetrics.ReleaseDirtySet(m_dirty);
   if (m_buffer)
     {
     delete m_buffer;
@@ -35,7 +35,9 @@
 #include <sstream>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 #include <sys/time.h>
+#include "ovms.h"
 #include "ovms_server.h"
 #include "ovms_netmanager.h"
 #include "ovms_buffer.h"
@@ -47,6 +49,73 @@
 
 #define OVMS_PROTOCOL_V2_TOKENSIZE 22
 
+/**
+ * Status messages are built incrementally from static field tables (see
+ * ovms_server_v2.cpp): each field names the metrics it is rendered from,
+ * a metric change only re-renders the fields depending on it, and the
+ * message text is only reassembled if a field text actually changed.
+ */
+
+#define OVMS_V2_MSG_STAT          0     // "S"
+#define OVMS_V2_MSG_GEN           1     // "G"
+#define OVMS_V2_MSG_GPS           2     // "L"
+#define OVMS_V2_MSG_TPMS          3     // "Y"
+#define OVMS_V2_MSG_TPMS_LEGACY   4     // "W", sent along with "Y"
+#define OVMS_V2_MSG_FIRMWARE      5     // "F"
+#define OVMS_V2_MSG_ENVIRONMENT   6     // "D"
+#define OVMS_V2_MSG_COUNT         7
+
+#define OVMS_V2_MSG_MAXFIELDS     64    // field dirty flags are kept in a uint64_t
+
+typedef void (*OvmsServerV2Formatter)(extram::string& out, metric_unit_t units_distance);
+
+typedef struct
+  {
+  const char*             sep;        // Text preceding the field
+  const char*             metrics;    // Metrics read by the formatter (comma separated), NULL = none
+  bool                    always;     // Field reads volatile state (staleness, config), render on every send
+  OvmsServerV2Formatter   format;     // Appends the field text to out
+  } OvmsServerV2Field;
+
+typedef struct
+  {
+  const char*               prefix;   // Message code, i.e. "MP-0 S"
+  const char*               modified; // Metrics triggering a transmission, NULL = none
+  const char*               urgent;   // Metrics triggering an immediate transmission if peers are connected
+  const OvmsServerV2Field*  fields;
+  int                       count;
+  } OvmsServerV2MsgDef;
+
+class OvmsServerV2Msg
+  {
+  public:
+    OvmsServerV2Msg();
+
+  public:
+    void Init(const OvmsServerV2MsgDef* def, bool* now);
+    const extram::string& Render(metric_unit_t units_distance);
+
+  public:
+    const OvmsServerV2MsgDef*   m_def;
+    bool*                       m_now;        // Server flag for immediate transmission
+    bool                        m_modified;   // Trigger metric modified since last transmission
+    uint64_t                    m_dirty;      // Fields to re-render
+    uint64_t                    m_always;     // Fields to render on every transmission
+    std::vector<extram::string> m_fields;     // Field texts of the last rendering
+    extram::string              m_text;       // Message text of the last rendering
+    extram::string              m_scratch;
+  };
+
+#define OVMS_V2_LINK_MODIFIED     0xfe  // Link kinds besides field numbers
+#define OVMS_V2_LINK_URGENT       0xff
+
+typedef struct
+  {
+  uint16_t  slot;                     // Metric dirty set slot
+  uint8_t   msg;                      // OVMS_V2_MSG_*
+  uint8_t   kind;                     // Field number or OVMS_V2_LINK_*
+  } OvmsServerV2Link;
+
 class OvmsServerV2 : public OvmsServer
   {
   public:
@@ -65,8 +134,20 @@ class OvmsServerV2 : public OvmsServer
     void ProcessServerMsg();
     void ProcessCommand(const char* payload);
     bool Transmit(const std::string& message);
+    bool Transmit(const char* message, size_t length);
+
+#ifdef CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+  public:
+    static int VerifyMessages(OvmsWriter* writer, int seconds);
+#endif // CONFIG_OVMS_DEV_SERVER_V2_VERIFY
 
   protected:
+    static void LinkMetrics(std::vector<OvmsServerV2Link>& links, int msg, int kind, const char* metrics);
+    static void LinkMessages(std::vector<OvmsServerV2Link>& links);
+    static void ApplyLinks(const std::vector<OvmsServerV2Link>& links, OvmsServerV2Msg* msgs,
+                           OvmsMetric* metric, bool peers);
+    void CollectModified();
+    bool TransmitMsg(int msg, bool always);
     void TransmitMsgStat(bool always = false);
     void TransmitMsgGen(bool always = false);
     void TransmitMsgGPS(bool always = false);
@@ -84,7 +165,6 @@ class OvmsServerV2 : public OvmsServer
     void HandleNotifyDataAck(uint32_t ack);
 
   public:
-    void MetricModified(OvmsMetric* metric);
     bool NotificationFilter(OvmsNotifyType* type, const char* subtype);
     bool IncomingNotification(OvmsNotifyType* type, OvmsNotifyEntry* entry);
     void EventListener(std::string event, void* data);
@@ -133,9 +213,13 @@ class OvmsServerV2 : public OvmsServer
     RC4_CTX2 m_crypto_rx2;
     RC4_CTX1 m_crypto_tx1;
     RC4_CTX2 m_crypto_tx2;
+    extram::string m_txplain;           // Transmit() buffers, reused
+    extram::string m_txcoded;
 
     bool m_paranoid;
     uint8_t m_pdigest[OVMS_MD5_SIZE];
+    RC4_CTX1 m_crypto_p1;               // Paranoid mode cipher, primed (copied per message)
+    RC4_CTX2 m_crypto_p2;
     std::string m_ptoken;
     bool m_ptoken_ready;
 
@@ -148,6 +232,10 @@ class OvmsServerV2 : public OvmsServer
     bool m_now_capabilities;
     bool m_now_group;
 
+    OvmsServerV2Msg m_msg[OVMS_V2_MSG_COUNT];
+    OvmsMetricDirtySet* m_dirty;        // Metrics modified since last collection
+    std::vector<OvmsServerV2Link> m_links;  // Metric → message links, sorted by slot
+
     int m_streaming;
     int m_updatetime_idle;
     int m_updatetime_connected;
@@ -33,6 +33,7 @@ static const char *TAG = "ovms-server-v3";
 
 #include <string.h>
 #include <stdint.h>
+#include <algorithm>
 #include "ovms_server_v3.h"
 #include "buffered_shell.h"
 #include "ovms_command.h"
@@ -41,9 +42,29 @@ static const char *TAG = "ovms-server-v3";
 #include "ovms_tls.h"
 
 OvmsServerV3 *MyOvmsServerV3 = NULL;
-size_t MyOvmsServerV3Modifier = 0;
 size_t MyOvmsServerV3Reader = 0;
 
+#define SERVER_V3_DEFAULT_PRIO_HIGH   "v.e.on,v.e.awake,v.c.state,v.c.charging,v.b.soc,v.b.range.,v.p.latitude,v.p.longitude,v.p.speed"
+#define SERVER_V3_DEFAULT_PRIO_LOW    "v.b.c.,v.t."
+#define SERVER_V3_TOPICPOOL_MAX       16384
+
+static OvmsServerV3PrefixList SplitPrefixList(const std::string& list)
+  {
+  OvmsServerV3PrefixList prefixes;
+  size_t start = 0;
+  while (start < list.length())
+    {
+    size_t end = list.find(',', start);
+    if (end == std::string::npos) end = list.length();
+    size_t first = list.find_first_not_of(" ", start);
+    size_t last = list.find_last_not_of(" ", end-1);
+    if (first < end && last != std::string::npos && last >= first)
+      prefixes.push_back(list.substr(first, last-first+1));
+    start = end + 1;
+    }
+  return prefixes;
+  }
+
 bool OvmsServerV3ReaderCallback(OvmsNotifyType* type, OvmsNotifyEntry* entry)
   {
   if (MyOvmsServerV3)
@@ -181,11 +202,7 @@ static void OvmsServerV3MongooseCallback(struct mg_connection *nc, int ev, void
 OvmsServerV3::OvmsServerV3(const char* name)
   : OvmsServer(name)
   {
-  if (MyOvmsServerV3Modifier == 0)
-    {
-    MyOvmsServerV3Modifier = MyMetrics.RegisterModifier();
-    ESP_LOGI(TAG, "OVMS Server V3 registered metric modifier is #%d",MyOvmsServerV3Modifier);
-    }
+  m_dirty = MyMetrics.AcquireDirtySet();
 
   SetStatus("Server has been started", false, WaitNetwork);
   m_connretry = 0;
@@ -202,6 +219,17 @@ OvmsServerV3::OvmsServerV3(const char* name)
   m_updatetime_on = m_updatetime_idle;
   m_updatetime_charging = m_updatetime_idle;
   m_updatetime_sendall = 0;
+  m_metrics_maxrate = 0;
+  m_txall = false;
+  m_txdeferred = false;
+  m_stat_metrics = 0;
+  m_stat_bytes = 0;
+  m_stat_batches = 0;
+  m_stat_deferred = 0;
+  m_stat_minute_metrics = 0;
+  m_stat_minute_bytes = 0;
+  m_stat_rate_metrics = 0;
+  m_stat_rate_bytes = 0;
   m_notify_info_pending = false;
   m_notify_error_pending = false;
   m_notify_alert_pending = false;
@@ -215,7 +243,6 @@ OvmsServerV3::OvmsServerV3(const char* name)
   #undef bind  // Kludgy, but works
   using std::placeholders::_1;
   using std::placeholders::_2;
-  MyMetrics.RegisterListener(TAG, "*", std::bind(&OvmsServerV3::MetricModified, this, _1));
 
   if (MyOvmsServerV3Reader == 0)
     {
@@ -251,66 +278,184 @@ OvmsServerV3::OvmsServerV3(const char* name)
 
 OvmsServerV3::~OvmsServerV3()
   {
-  MyMetrics.DeregisterListener(TAG);
   MyEvents.DeregisterEvent(TAG);
   MyNotify.ClearReader(MyOvmsServerV3Reader);
   Disconnect();
+  MyMetrics.ReleaseDirtySet(m_dirty);
   MyEvents.SignalEvent("server.v3.stopped", NULL);
   }
 
 void OvmsServerV3::TransmitAllMetrics()
   {
-  OvmsMutexLock mg(&m_mgconn_mutex);
   if (!m_mgconn)
     return;
 
-  OvmsMetric* metric = MyMetrics.m_first;
-  while (metric != NULL)
+  m_dirty->MarkAll();
+  m_txall = true;
+  TransmitModifiedMetrics();
+  }
+
+/**
+ * TransmitModifiedMetrics: publish the metrics modified since the last call
+ *  Changes are coalesced by the dirty set, so each metric is sent once per call
+ *  with its current value. Metrics are sent by priority class, up to the rate
+ *  limit (metrics.maxrate) per second. Metrics exceeding the limit stay marked
+ *  and are sent on the next Ticker1 call. All frames are encoded into one buffer
+ *  and passed to the connection in one write.
+ */
+void OvmsServerV3::TransmitModifiedMetrics()
+  {
+  if (!m_mgconn)
+    return;
+
+  // Collect modified metrics by priority class:
+  OvmsMetric* metric;
+  while ((metric = m_dirty->Next()) != NULL)
     {
-    metric->ClearModified(MyOvmsServerV3Modifier);
-    if (!metric->AsString().empty())
+    const OvmsServerV3Topic* topic = GetTopic(metric);
+    m_txqueue[topic ? topic->prio : SERVER_V3_PRIO_NORMAL].push_back(metric);
+    }
+
+  // Encode up to the rate limit, defer the rest:
+  int count = 0, deferred = 0;
+  m_txbuf.clear();
+  for (int prio = 0; prio < SERVER_V3_PRIO_COUNT; prio++)
+    {
+    for (OvmsMetric* metric : m_txqueue[prio])
       {
-      TransmitMetric(metric);
+      if (m_metrics_maxrate > 0 && count >= m_metrics_maxrate)
+        {
+        m_dirty->Mark(metric->m_slot);
+        deferred++;
+        }
+      else if (EncodeMetric(metric, m_txall))
+        {
+        count++;
+        }
       }
-    metric = metric->m_next;
+    m_txqueue[prio].clear();
     }
-  }
+  m_txdeferred = (deferred > 0);
+  if (!m_txdeferred)
+    m_txall = false;
+
+  if (m_txbuf.empty())
+    return;
 
-void OvmsServerV3::TransmitModifiedMetrics()
-  {
   OvmsMutexLock mg(&m_mgconn_mutex);
   if (!m_mgconn)
     return;
+  mg_send(m_mgconn, m_txbuf.data(), m_txbuf.size());
+
+  m_stat_metrics += count;
+  m_stat_bytes += m_txbuf.size();
+  m_stat_batches++;
+  m_stat_deferred += deferred;
+  ESP_LOGD(TAG, "Tx %d metrics, %u bytes, %d deferred", count, (unsigned)m_txbuf.size(), deferred);
 
-  OvmsMetric* metric = MyMetrics.m_first;
-  while (metric != NULL)
+  // Don't hold on to the buffer after a full update:
+  if (m_txbuf.capacity() > 4096 && !m_txdeferred)
+    extram::string().swap(m_txbuf);
+  }
+
+/**
+ * GetTopic: get the topic cache entry of a metric
+ *  The MQTT topic suffix of a metric is its name with '.' replaced by '/'. It's
+ *  computed once per metric registration, along with the priority class.
+ *  Returns NULL for metrics without a dirty set slot.
+ */
+const OvmsServerV3Topic* OvmsServerV3::GetTopic(OvmsMetric* metric)
+  {
+  if (metric->m_slot == METRICS_SLOT_NONE)
+    return NULL;
+  if (metric->m_slot >= m_topics.size())
+    m_topics.resize(metric->m_slot + 1, OvmsServerV3Topic());
+
+  OvmsServerV3Topic& topic = m_topics[metric->m_slot];
+  if (topic.id == metric->m_id)
+    return &topic;
+
+  // Slots are reused by new metric registrations, the pool space of the
+  //  previous topic is lost then, so rebuild the cache if the pool gets big:
+  if (topic.id != 0 && m_topicpool.size() > SERVER_V3_TOPICPOOL_MAX)
     {
-    if (metric->IsModifiedAndClear(MyOvmsServerV3Modifier))
+    ClearTopics();
+    return GetTopic(metric);
+    }
+
+  topic.id = metric->m_id;
+  topic.prio = SERVER_V3_PRIO_NORMAL;
+  for (int prio = 0; prio < SERVER_V3_PRIO_COUNT; prio++)
+    {
+    for (const std::string& prefix : m_metrics_prio[prio])
       {
-      TransmitMetric(metric);
+      if (strncmp(metric->m_name, prefix.c_str(), prefix.length()) == 0)
+        {
+        topic.prio = prio;
+        break;
+        }
       }
-    metric = metric->m_next;
+    if (topic.prio != SERVER_V3_PRIO_NORMAL)
+      break;
     }
+
+  topic.pos = m_topicpool.size();
+  topic.len = strlen(metric->m_name);
+  m_topicpool.append(metric->m_name, topic.len);
+  std::replace(m_topicpool.begin() + topic.pos, m_topicpool.end(), '.', '/');
+  return &topic;
   }
 
-void OvmsServerV3::TransmitMetric(OvmsMetric* metric)
+void OvmsServerV3::ClearTopics()
   {
-  std::string topic(m_topic_prefix);
-  topic.append("metric/");
-  topic.append(metric->m_name);
+  OvmsServerV3TopicCache().swap(m_topics);
+  extram::string().swap(m_topicpool);
+  }
+
+/**
+ * EncodeMetric: append an MQTT PUBLISH frame (QoS 0, retained) for the metric
+ *  to the transmit buffer
+ *  - skipempty: skip metrics without value
+ *  Returns false if the metric has been skipped.
+ */
+bool OvmsServerV3::EncodeMetric(OvmsMetric* metric, bool skipempty)
+  {
+  std::string val = metric->AsString();
+  if (skipempty && val.empty())
+    return false;
 
-  // Replace '.' inside the metric name by '/' for MQTT like namespacing.
-  for(size_t i = m_topic_prefix.length(); i < topic.length(); i++)
+  const OvmsServerV3Topic* topic = GetTopic(metric);
+  std::string name;
+  if (!topic)
     {
-      if(topic[i] == '.')
-        topic[i] = '/';
+    name = metric->m_name;
+    std::replace(name.begin(), name.end(), '.', '/');
     }
+  size_t topiclen = m_metric_prefix.length() + (topic ? topic->len : name.length());
 
-  std::string val = metric->AsString();
+  // Fixed header: PUBLISH, QoS 0, retain; remaining length (variable length encoding):
+  size_t remlen = 2 + topiclen + val.length();
+  m_txbuf.push_back(0x31);
+  do
+    {
+    uint8_t b = remlen & 0x7f;
+    remlen >>= 7;
+    if (remlen) b |= 0x80;
+    m_txbuf.push_back(b);
+    } while (remlen);
+
+  // Variable header: topic; payload: value
+  m_txbuf.push_back(topiclen >> 8);
+  m_txbuf.push_back(topiclen & 0xff);
+  m_txbuf.append(m_metric_prefix.data(), m_metric_prefix.length());
+  if (topic)
+    m_txbuf.append(m_topicpool, topic->pos, topic->len);
+  else
+    m_txbuf.append(name.data(), name.length());
+  m_txbuf.append(val.data(), val.length());
 
-  mg_mqtt_publish(m_mgconn, topic.c_str(), m_msgid++,
-    MG_MQTT_QOS(0) | MG_MQTT_RETAIN, val.c_str(), val.length());
-  ESP_LOGI(TAG,"Tx metric %s=%s",topic.c_str(),val.c_str());
+  ESP_LOGV(TAG, "Tx metric %s%s=%s", m_metric_prefix.c_str(), metric->m_name, val.c_str());
+  return true;
   }
 
 int OvmsServerV3::TransmitNotificationInfo(OvmsNotifyEntry* entry)
@@ -640,6 +785,10 @@ void OvmsServerV3::Connect()
       }
     }
 
+  m_metric_prefix = m_topic_prefix;
+  m_metric_prefix.append("metric/");
+  ClearTopics();
+
   m_will_topic = std::string(m_topic_prefix);
   m_will_topic.append("metric/s/v3/connected");
 
@@ -744,20 +893,6 @@ void OvmsServerV3::SetStatus(const char* status, bool fault /*=false*/, State ne
     }
   }
 
-void OvmsServerV3::MetricModified(OvmsMetric* metric)
-  {
-  if (!StandardMetrics.ms_s_v3_connected->AsBool()) return;
-
-  if (m_streaming)
-    {
-    OvmsMutexLock mg(&m_mgconn_mutex);
-    if (!m_mgconn)
-      return;
-    metric->ClearModified(MyOvmsServerV3Modifier);
-    TransmitMetric(metric);
-    }
-  }
-
 bool OvmsServerV3::NotificationFilter(OvmsNotifyType* type, const char* subtype)
   {
   if (strcmp(type->m_name, "info") == 0 ||
@@ -824,6 +959,17 @@ void OvmsServerV3::ConfigChanged(OvmsConfigParam* param)
   m_updatetime_on = MyConfig.GetParamValueInt("server.v3", "updatetime.on", m_updatetime_idle);
   m_updatetime_charging = MyConfig.GetParamValueInt("server.v3", "updatetime.charging", m_updatetime_idle);
   m_updatetime_sendall = MyConfig.GetParamValueInt("server.v3", "updatetime.sendall", 0);
+  m_metrics_maxrate = MyConfig.GetParamValueInt("server.v3", "metrics.maxrate", 0);
+
+  // Priority classes (metric name prefix lists), reclassify on change:
+  if (!param || param->GetName() == "server.v3")
+    {
+    m_metrics_prio[SERVER_V3_PRIO_HIGH] = SplitPrefixList(
+      MyConfig.GetParamValue("server.v3", "metrics.priority.high", SERVER_V3_DEFAULT_PRIO_HIGH));
+    m_metrics_prio[SERVER_V3_PRIO_LOW] = SplitPrefixList(
+      MyConfig.GetParamValue("server.v3", "metrics.priority.low", SERVER_V3_DEFAULT_PRIO_LOW));
+    ClearTopics();
+    }
   }
 
 void OvmsServerV3::NetUp(std::string event, void* data)
@@ -932,9 +1078,10 @@ void OvmsServerV3::Ticker1(std::string event, void* data)
       TransmitModifiedMetrics();
       m_lasttx = m_lasttx_stream = now;
       }
-    else if (m_streaming && caron && m_peers && now > m_lasttx_stream+m_streaming)
+    else if (m_txdeferred || (m_streaming && now >= m_lasttx_stream+m_streaming))
       {
-      // TODO: transmit streaming metrics
+      // Stream modified metrics, continue rate limited update:
+      TransmitModifiedMetrics();
       m_lasttx_stream = now;
       }
     }
@@ -955,6 +1102,11 @@ void OvmsServerV3::RequestUpdate(bool txall)
 void OvmsServerV3::Ticker60(std::string event, void* data)
   {
   CountClients();
+
+  m_stat_rate_metrics = (float)(m_stat_metrics - m_stat_minute_metrics) / 60;
+  m_stat_rate_bytes = (float)(m_stat_bytes - m_stat_minute_bytes) / 60;
+  m_stat_minute_metrics = m_stat_metrics;
+  m_stat_minute_bytes = m_stat_bytes;
   }
 
 void OvmsServerV3::SetPowerMode(PowerMode powermode)
@@ -1028,6 +1180,13 @@ void ovmsv3_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc
         break;
       }
     writer->printf("       %s\n",MyOvmsServerV3->m_status.c_str());
+    writer->printf("Metrics: %u published in %u batches, %u bytes, %u deferred\n",
+      MyOvmsServerV3->m_stat_metrics, MyOvmsServerV3->m_stat_batches,
+      MyOvmsServerV3->m_stat_bytes, MyOvmsServerV3->m_stat_deferred);
+    writer->printf("         %.1f metrics/s, %.1f bytes/s (last minute)\n",
+      MyOvmsServerV3->m_stat_rate_metrics, MyOvmsServerV3->m_stat_rate_bytes);
+    if (MyOvmsServerV3->m_metrics_maxrate > 0)
+      writer->printf("         rate limit %d metrics/s\n", MyOvmsServerV3->m_metrics_maxrate);
     }
   }
 
@@ -1071,6 +1230,9 @@ OvmsServerV3Init::OvmsServerV3Init()
   //   'server': The server name/ip
   //   'user': The server username
   //   'port': The port to connect to (default: 1883)
+  //   'metrics.maxrate': Max metric publishes per second (default: 0 = unlimited)
+  //   'metrics.priority.high': Metric name prefixes sent first (comma separated)
+  //   'metrics.priority.low': Metric name prefixes sent last (comma separated)
   // Also note:
   //  Parameter "vehicle", instance "id", is the vehicle ID
   //  Parameter "password", instance "server.v3", is the server password
@@ -33,6 +33,8 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include "ovms.h"
 #include "ovms_server.h"
 #include "ovms_netmanager.h"
 #include "ovms_metrics.h"
@@ -44,6 +46,24 @@ typedef std::map<std::string, uint32_t> OvmsServerV3ClientMap;
 
 #define MQTT_CONN_NTOPICS 2
 
+// Metric publishing priority classes, see "server.v3" "metrics.priority.*":
+#define SERVER_V3_PRIO_HIGH       0
+#define SERVER_V3_PRIO_NORMAL     1
+#define SERVER_V3_PRIO_LOW        2
+#define SERVER_V3_PRIO_COUNT      3
+
+// Topic cache entry, indexed by the metric dirty set slot:
+typedef struct
+  {
+  uint32_t  id;                       // metric registration serial, 0 = unused
+  uint16_t  prio;                     // priority class
+  uint32_t  pos;                      // topic suffix offset in the topic pool…
+  uint32_t  len;                      // … and length
+  } OvmsServerV3Topic;
+
+typedef std::vector<OvmsServerV3Topic, ExtRamAllocator<OvmsServerV3Topic>> OvmsServerV3TopicCache;
+typedef std::vector<std::string> OvmsServerV3PrefixList;
+
 class OvmsServerV3 : public OvmsServer
   {
   public:
@@ -51,7 +71,6 @@ class OvmsServerV3 : public OvmsServer
     ~OvmsServerV3();
 
   public:
-    void MetricModified(OvmsMetric* metric);
     bool NotificationFilter(OvmsNotifyType* type, const char* subtype);
     bool IncomingNotification(OvmsNotifyType* type, OvmsNotifyEntry* entry);
     void EventListener(std::string event, void* data);
@@ -95,6 +114,7 @@ class OvmsServerV3 : public OvmsServer
     OvmsMutex m_mgconn_mutex;
     int m_connretry;
     bool m_sendall;
+    OvmsMetricDirtySet* m_dirty;        // metrics modified since last transmission
     int m_msgid;
     int m_lasttx;
     int m_lasttx_stream;
@@ -107,6 +127,27 @@ class OvmsServerV3 : public OvmsServer
     int m_updatetime_on;
     int m_updatetime_charging;
     int m_updatetime_sendall;
+    int m_metrics_maxrate;              // max metric publishes per second, 0 = unlimited
+    OvmsServerV3PrefixList m_metrics_prio[SERVER_V3_PRIO_COUNT];
+
+    // Metric publishing:
+    std::string m_metric_prefix;        // m_topic_prefix + "metric/"
+    OvmsServerV3TopicCache m_topics;    // topic cache, indexed by metric slot
+    extram::string m_topicpool;         // topic suffixes ('.' replaced by '/')
+    std::vector<OvmsMetric*> m_txqueue[SERVER_V3_PRIO_COUNT];
+    extram::string m_txbuf;             // batch of encoded MQTT PUBLISH frames
+    bool m_txall;                       // sending all metrics, skip undefined
+    bool m_txdeferred;                  // rate limit hit, continue next second
+
+    // Metric publishing statistics:
+    uint32_t m_stat_metrics;
+    uint32_t m_stat_bytes;
+    uint32_t m_stat_batches;
+    uint32_t m_stat_deferred;
+    uint32_t m_stat_minute_metrics;
+    uint32_t m_stat_minute_bytes;
+    float m_stat_rate_metrics;          // per second, over the last minute
+    float m_stat_rate_bytes;
 
     bool m_notify_info_pending;
     bool m_notify_error_pending;
@@ -140,7 +181,9 @@ class OvmsServerV3 : public OvmsServer
     void CountClients();
 
   private:
-    void TransmitMetric(OvmsMetric* metric);
+    const OvmsServerV3Topic* GetTopic(OvmsMetric* metric);
+    void ClearTopics();
+    bool EncodeMetric(OvmsMetric* metric, bool skipempty);
   };
 
 class OvmsServerV3Init
@@ -828,7 +828,9 @@ $.fn.loadcmd = function(command, filter, timeout) {
 
 var monitorTimer, last_monotonic = 0;
 var ws, ws_inhibit = 0;
+var ws_binmetrics = true; // request binary metrics updates
 var metrics = {};
+var metrics_byid = [];
 var shellhist = [""], shellhpos = 0;
 var loghist = [];
 const loghist_maxsize = 100;
@@ -839,13 +841,28 @@ function initSocketConnection(){
   } else {
     ws = new WebSocket('ws://' + location.host + '/msg');
   }
+  ws.binaryType = "arraybuffer";
   ws.onopen = function(ev) {
     console.log("WebSocket OPENED", ev);
+    if (ws_binmetrics && window.TextDecoder)
+      ws.send("metrics binary");
     $(".receiver").subscribe();
   };
   ws.onerror = function(ev) { console.log("WebSocket ERROR", ev); };
   ws.onclose = function(ev) { console.log("WebSocket CLOSED", ev); };
   ws.onmessage = function(ev) {
+    if (ev.data instanceof ArrayBuffer) {
+      var update;
+      try {
+        update = decodeMetricsBinary(ev.data);
+      } catch (e) {
+        console.error("WebSocket binary msg: " + e);
+        return;
+      }
+      $.extend(metrics, update);
+      $(".receiver").trigger("msg:metrics", update);
+      return;
+    }
     var msg;
     try {
       msg = JSON.parse(ev.data);
@@ -883,6 +900,77 @@ function initSocketConnection(){
   };
 }
 
+/**
+ * decodeMetricsBinary: decode binary metrics frame (see ovms_websockethandler.cpp)
+ */
+function decodeMetricsBinary(buf){
+  var dv = new DataView(buf), pos = 2, update = {};
+  var utf8 = new TextDecoder();
+  if (dv.getUint8(0) != 0x4D)
+    throw "invalid frame";
+  if (dv.getUint8(1) & 1)
+    metrics_byid = [];
+  var varint = function() {
+    var val = 0, mul = 1, b;
+    do {
+      b = dv.getUint8(pos++);
+      val += (b & 0x7f) * mul;
+      mul *= 128;
+    } while (b & 0x80);
+    return val;
+  };
+  var text = function(len) {
+    var str = utf8.decode(new Uint8Array(buf, pos, len));
+    pos += len;
+    return str;
+  };
+  var float = function(p) {
+    // reduce to float precision as in the JSON representation:
+    return Number(dv.getFloat32(p, true).toPrecision(6));
+  };
+  while (pos < dv.byteLength) {
+    var id = varint(), type = dv.getUint8(pos++), name, val;
+    if (type & 0x80) {
+      name = text(varint());
+      metrics_byid[id] = name;
+      type &= 0x7f;
+    } else {
+      name = metrics_byid[id];
+    }
+    switch (type) {
+      case 0: // JSON
+        val = JSON.parse(text(varint()));
+        break;
+      case 1: // bool
+        val = (dv.getUint8(pos) != 0);
+        pos += 1;
+        break;
+      case 2: // int
+        val = dv.getInt32(pos, true);
+        pos += 4;
+        break;
+      case 3: // float
+        val = float(pos);
+        pos += 4;
+        break;
+      case 4: // int vector slice
+      case 5: // uint vector slice
+      case 6: // float vector slice
+        var size = varint(), ofs = varint(), cnt = varint();
+        val = (metrics[name] instanceof Array) ? metrics[name].slice(0, size) : [];
+        val.length = size;
+        for (var i = ofs; i < ofs + cnt; i++, pos += 4)
+          val[i] = (type == 4) ? dv.getInt32(pos, true) : (type == 5) ? dv.getUint32(pos, true) : float(pos);
+        break;
+      default:
+        throw "unknown value type " + type;
+    }
+    if (name)
+      update[name] = val;
+  }
+  return update;
+}
+
 function monitorInit(force){
   $(".monitor").each(function(){
     var cmd = $(this).data("updcmd");
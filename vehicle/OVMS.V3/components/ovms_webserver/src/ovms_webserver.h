@@ -356,6 +356,9 @@ class HttpStringSender : public MgHandler
  *
  * On creation it will do a full update of all metrics.
  * Later on, it receives TX jobs through the queue.
+ *
+ * Clients may switch metrics updates to the binary protocol by sending
+ *  "metrics binary" (see ovms_websockethandler.cpp for the frame format).
  */
 
 enum WebSocketTxJobType
@@ -392,7 +395,7 @@ struct WebSocketTxTodo
 class WebSocketHandler : public MgHandler, public OvmsWriter
 {
   public:
-    WebSocketHandler(mg_connection* nc, size_t slot, size_t modifier, size_t reader);
+    WebSocketHandler(mg_connection* nc, size_t slot, OvmsMetricDirtySet* dirty, size_t reader);
     ~WebSocketHandler();
 
   public:
@@ -404,6 +407,10 @@ class WebSocketHandler : public MgHandler, public OvmsWriter
     void InitTx();
     void ContinueTx();
     void ProcessTxJob();
+    OvmsMetric* NextTxMetric();
+    int SendMetricsJSON();
+    int SendMetricsBinary();
+    bool EncodeMetricBinary(std::string& msg, OvmsMetric* m);
     int HandleEvent(int ev, void* p);
     void HandleIncomingMsg(std::string msg);
 
@@ -418,7 +425,7 @@ class WebSocketHandler : public MgHandler, public OvmsWriter
 
   public:
     size_t                    m_slot = 0;
-    size_t                    m_modifier = 0;         // "our" metrics modifier
+    OvmsMetricDirtySet*       m_dirty = NULL;         // "our" modified metrics
     size_t                    m_reader = 0;           // "our" notification reader id
     QueueHandle_t             m_jobqueue = NULL;
     uint32_t                  m_jobqueue_overflow_status = 0;
@@ -429,12 +436,24 @@ class WebSocketHandler : public MgHandler, public OvmsWriter
     int                       m_sent = 0;
     int                       m_ack = 0;
     std::set<std::string>     m_subscriptions;
+
+  public:
+    OvmsMetric*               m_cursor = NULL;        // metrics job resume position…
+    int                       m_cursor_pos = 0;       // … as list index…
+    uint32_t                  m_cursor_gen = 0;       // … valid for metrics list generation
+    bool                      m_cursor_end = false;   // metrics job: all metrics fetched
+    bool                      m_binary = false;       // binary metrics protocol active
+    bool                      m_binary_req = false;   // binary metrics protocol requested by client
+    bool                      m_binary_reset = false; // next binary frame resets the client ID table
+    std::vector<uint32_t>     m_binary_ids;           // metric IDs defined to the client by slot (0 = none)
+    std::map<uint16_t, extram::string> m_binary_vectors;  // vector values last sent by slot
+    std::string               m_binary_value;         // encoding buffer
 };
 
 struct WebSocketSlot
 {
   WebSocketHandler*   handler;
-  size_t              modifier;
+  OvmsMetricDirtySet* dirty;
   size_t              reader;
 };
 
@@ -35,6 +35,7 @@ static const char *TAG = "websocket";
 
 #include <string.h>
 #include <stdio.h>
+#include <algorithm>
 #include "ovms_webserver.h"
 #include "ovms_config.h"
 #include "ovms_metrics.h"
@@ -55,15 +56,37 @@ static const char *TAG = "websocket";
  * parallel execution. TX init is done either by the mongoose EventHandler
  * on connect/poll or by the UpdateTicker. The EventHandler triggers immediate
  * successive sends, the UpdateTicker sends collected intermediate updates.
+ * 
+ * Binary metrics protocol:
+ * 
+ * Clients can request binary metrics updates by sending "metrics binary"
+ * (and switch back by "metrics json"), the switch applies from the next
+ * metrics job on. Metric names are then only sent once per connection along
+ * with the first value; later updates only carry the metric ID (the 32 bit
+ * registration serial, unique per metric instance). Vector values are sent
+ * as slices covering the changed elements.
+ * 
+ * Frame:   'M' <flags:u8> <record>...
+ *          flags bit 0 = reset: client shall clear its ID table
+ * Record:  <id:varint> <type:u8> [<namelen:varint> <name>] <value>
+ *          type bit 7 = name included (ID definition)
+ *          type bits 0-6 = metric_bintype_t
+ * Value:   JSON:     <len:varint> <text>
+ *          Bool:     <u8>
+ *          Int:      <int32>
+ *          Float:    <float32>
+ *          Vec*:     <size:varint> <offset:varint> <count:varint> <elements:count*4>
+ * 
+ * Numbers are little endian, varints are unsigned LEB128.
  */
 
-WebSocketHandler::WebSocketHandler(mg_connection* nc, size_t slot, size_t modifier, size_t reader)
+WebSocketHandler::WebSocketHandler(mg_connection* nc, size_t slot, OvmsMetricDirtySet* dirty, size_t reader)
   : MgHandler(nc)
 {
-  ESP_LOGV(TAG, "WebSocketHandler[%p] init: handler=%p modifier=%d", nc, this, modifier);
+  ESP_LOGV(TAG, "WebSocketHandler[%p] init: handler=%p slot=%d", nc, this, slot);
   
   m_slot = slot;
-  m_modifier = modifier;
+  m_dirty = dirty;
   m_reader = reader;
   m_jobqueue = xQueueCreate(50, sizeof(WebSocketTxJob));
   m_jobqueue_overflow_status = 0;
@@ -72,6 +95,9 @@ WebSocketHandler::WebSocketHandler(mg_connection* nc, size_t slot, size_t modifi
   m_jobqueue_overflow_dropcntref = 0;
   m_job.type = WSTX_None;
   m_sent = m_ack = 0;
+  m_cursor = NULL;
+  m_cursor_pos = 0;
+  m_cursor_end = false;
   
   // Register as logging console:
   SetMonitoring(true);
@@ -116,41 +142,47 @@ void WebSocketHandler::ProcessTxJob()
     case WSTX_MetricsAll:
     case WSTX_MetricsUpdate:
     {
-      // Note: this loops over the metrics by index, keeping the checked count
-      //  in m_sent. It will not detect new metrics added between polls if they are
-      //  inserted before m_sent, so new metrics may not be sent until first changed.
-      //  The Metrics set normally is static, so this should be no problem.
+      // Note: MetricsUpdate only visits the metrics changed since the last update
+      //  by our dirty set. MetricsAll walks the metrics list by a resume cursor,
+      //  keeping the checked count in m_cursor_pos. If metrics have been added or
+      //  removed since the last chunk, the cursor is re-positioned by the count.
+      //  That will not detect new metrics inserted before the cursor, so these may
+      //  not be sent until first changed. The Metrics set normally is static, so
+      //  this should be no problem.
       
-      // find start:
-      int i;
-      OvmsMetric* m;
-      for (i=0, m=MyMetrics.m_first; i < m_sent && m != NULL; m=m->m_next, i++);
-      
-      // build msg:
-      std::string msg;
-      msg.reserve(2*XFER_CHUNK_SIZE+128);
-      msg = "{\"metrics\":{";
-      for (i=0; m && msg.size() < XFER_CHUNK_SIZE; m=m->m_next) {
-        if (m->IsModifiedAndClear(m_modifier) || m_job.type == WSTX_MetricsAll) {
-          if (i) msg += ',';
-          msg += '\"';
-          msg += m->m_name;
-          msg += "\":";
-          msg += m->AsJSON();
-          i++;
+      if (m_cursor_pos == 0 && !m_cursor_end) {
+        // job start:
+        if (m_binary_req != m_binary) {
+          m_binary = m_binary_req;
+          m_binary_ids.clear();
+          m_binary_vectors.clear();
+          m_binary_reset = m_binary;
         }
+        if (m_job.type == WSTX_MetricsAll) {
+          m_dirty->Clear();
+          m_cursor = MyMetrics.m_first;
+          m_cursor_gen = MyMetrics.m_generation;
+        }
+      }
+      else if (m_job.type == WSTX_MetricsAll && m_cursor_gen != MyMetrics.m_generation) {
+        // metrics list changed, find cursor by count:
+        int i;
+        OvmsMetric* m;
+        for (i=0, m=MyMetrics.m_first; i < m_cursor_pos && m != NULL; m=m->m_next, i++);
+        m_cursor = m;
+        m_cursor_gen = MyMetrics.m_generation;
       }
       
-      // send msg:
-      if (i) {
-        msg += "}}";
-        ESP_EARLY_LOGV(TAG, "WebSocket msg: %s", msg.c_str());
-        mg_send_websocket_frame(m_nc, WEBSOCKET_OP_TEXT, msg.data(), msg.size());
-        m_sent += i;
+      // send next chunk:
+      if (!m_cursor_end) {
+        if (m_binary)
+          m_sent += SendMetricsBinary();
+        else
+          m_sent += SendMetricsJSON();
       }
       
       // done?
-      if (!m && m_ack == m_sent) {
+      if (m_cursor_end && m_ack == m_sent) {
         if (m_sent)
           ESP_EARLY_LOGV(TAG, "WebSocketHandler[%p]: ProcessTxJob type=%d done, sent=%d metrics", m_nc, m_job.type, m_sent);
         ClearTxJob(m_job);
@@ -248,6 +280,176 @@ void WebSocketHandler::ProcessTxJob()
 }
 
 
+/**
+ * NextTxMetric: get next metric to send for the current metrics job
+ *  MetricsAll: next metric from m_cursor, MetricsUpdate: next modified metric.
+ *  Sets m_cursor_end and returns NULL when done.
+ */
+OvmsMetric* WebSocketHandler::NextTxMetric()
+{
+  OvmsMetric* m;
+  if (m_job.type == WSTX_MetricsAll) {
+    m = m_cursor;
+    if (m) m_cursor = m->m_next;
+  } else {
+    m = m_dirty->Next();
+  }
+  if (m)
+    m_cursor_pos++;
+  else
+    m_cursor_end = true;
+  return m;
+}
+
+/**
+ * SendMetricsJSON: send next chunk of metrics as JSON text
+ *  Returns the number of metrics sent.
+ */
+int WebSocketHandler::SendMetricsJSON()
+{
+  OvmsMetric* m;
+  int i;
+  
+  // build msg:
+  std::string msg;
+  msg.reserve(2*XFER_CHUNK_SIZE+128);
+  msg = "{\"metrics\":{";
+  for (i=0; msg.size() < XFER_CHUNK_SIZE && (m = NextTxMetric()) != NULL; i++) {
+    if (i) msg += ',';
+    msg += '\"';
+    msg += m->m_name;
+    msg += "\":";
+    msg += m->AsJSON();
+  }
+  
+  // send msg:
+  if (i) {
+    msg += "}}";
+    ESP_EARLY_LOGV(TAG, "WebSocket msg: %s", msg.c_str());
+    mg_send_websocket_frame(m_nc, WEBSOCKET_OP_TEXT, msg.data(), msg.size());
+  }
+  
+  return i;
+}
+
+static void ws_put_varint(std::string& buf, uint32_t val)
+{
+  while (val >= 0x80) {
+    buf += (char)(0x80 | (val & 0x7f));
+    val >>= 7;
+  }
+  buf += (char)val;
+}
+
+/**
+ * SendMetricsBinary: send next chunk of metrics as a binary frame
+ *  Returns the number of metrics sent.
+ */
+int WebSocketHandler::SendMetricsBinary()
+{
+  OvmsMetric* m;
+  int i = 0;
+  
+  // build msg:
+  std::string msg;
+  msg.reserve(2*XFER_CHUNK_SIZE+128);
+  msg += 'M';
+  msg += (char)(m_binary_reset ? 1 : 0);
+  while (msg.size() < XFER_CHUNK_SIZE && (m = NextTxMetric()) != NULL) {
+    if (EncodeMetricBinary(msg, m))
+      i++;
+  }
+  
+  // send msg:
+  if (i) {
+    ESP_EARLY_LOGV(TAG, "WebSocket binary msg: %d metrics, %d bytes", i, msg.size());
+    mg_send_websocket_frame(m_nc, WEBSOCKET_OP_BINARY, msg.data(), msg.size());
+    m_binary_reset = false;
+  }
+  
+  return i;
+}
+
+/**
+ * EncodeMetricBinary: add binary metric record to msg
+ *  Returns false if the record has been skipped (unchanged vector).
+ */
+bool WebSocketHandler::EncodeMetricBinary(std::string& msg, OvmsMetric* m)
+{
+  // Client state is tracked by metric slot, metrics without a slot are
+  //  defined on every update:
+  uint32_t id = m->m_id;
+  uint16_t slot = m->m_slot;
+  bool tracked = (slot != METRICS_SLOT_NONE);
+  bool define = (!tracked || slot >= m_binary_ids.size() || m_binary_ids[slot] != id);
+  
+  std::string& value = m_binary_value;
+  value.clear();
+  metric_bintype_t type = m->EncodeBinary(value);
+  
+  // vectors: determine changed slice
+  size_t size = 0, offset = 0, count = 0;
+  if (type == MetricBinVecInt || type == MetricBinVecUInt || type == MetricBinVecFloat) {
+    size = value.size() / 4;
+    if (!define) {
+      extram::string& last = m_binary_vectors[slot];
+      size_t lastsize = last.size() / 4;
+      size_t end = std::min(size, lastsize);
+      while (offset < end && memcmp(&value[offset*4], &last[offset*4], 4) == 0)
+        offset++;
+      if (size == lastsize) {
+        if (offset == size)
+          return false;
+        while (end > offset && memcmp(&value[(end-1)*4], &last[(end-1)*4], 4) == 0)
+          end--;
+      } else {
+        end = size;
+      }
+      count = end - offset;
+    } else {
+      count = size;
+    }
+    if (tracked)
+      m_binary_vectors[slot].assign(value.data(), value.size());
+  }
+  
+  // add record:
+  ws_put_varint(msg, id);
+  if (define) {
+    msg += (char)(type | 0x80);
+    size_t len = strlen(m->m_name);
+    ws_put_varint(msg, len);
+    msg.append(m->m_name, len);
+    if (tracked) {
+      if (slot >= m_binary_ids.size())
+        m_binary_ids.resize(slot+1, 0);
+      m_binary_ids[slot] = id;
+    }
+  } else {
+    msg += (char)type;
+  }
+  switch (type) {
+    case MetricBinVecInt:
+    case MetricBinVecUInt:
+    case MetricBinVecFloat:
+      ws_put_varint(msg, size);
+      ws_put_varint(msg, offset);
+      ws_put_varint(msg, count);
+      msg.append(value, offset*4, count*4);
+      break;
+    case MetricBinJSON:
+      ws_put_varint(msg, value.size());
+      msg.append(value);
+      break;
+    default:
+      msg.append(value);
+      break;
+  }
+  
+  return true;
+}
+
+
 void WebSocketTxJob::clear(size_t client)
 {
   auto& slot = MyWebServer.m_client_slots[client];
@@ -301,6 +503,9 @@ bool WebSocketHandler::GetNextTxJob()
   if (xQueueReceive(m_jobqueue, &m_job, 0) == pdTRUE) {
     // init new job state:
     m_sent = m_ack = 0;
+    m_cursor = NULL;
+    m_cursor_pos = 0;
+    m_cursor_end = false;
     return true;
   } else {
     return false;
@@ -401,6 +606,16 @@ void WebSocketHandler::HandleIncomingMsg(std::string msg)
       if (!arg.empty()) Unsubscribe(arg);
     }
   }
+  else if (cmd == "metrics") {
+    input >> arg;
+    bool binary = (arg == "binary");
+    if (binary != m_binary_req) {
+      // switch protocol on next metrics job; the client keeps the values it
+      //  already has, binary metrics get defined on their first update:
+      ESP_LOGD(TAG, "WebSocketHandler[%p]: metrics protocol %s", m_nc, binary ? "binary" : "json");
+      m_binary_req = binary;
+    }
+  }
   else {
     ESP_LOGW(TAG, "WebSocketHandler[%p]: unhandled message: '%s'", m_nc, msg.c_str());
   }
@@ -423,7 +638,7 @@ void WebSocketHandler::Log(LogBuffers* message)
 
 /**
  * WebSocketHandler slot registry:
- *  WebSocketSlots keep metrics modifiers once allocated (limited ressource)
+ *  WebSocketSlots keep metrics dirty sets & notification readers once allocated
  */
 
 WebSocketHandler* OvmsWebServer::CreateWebSocketHandler(mg_connection* nc)
@@ -443,11 +658,11 @@ WebSocketHandler* OvmsWebServer::CreateWebSocketHandler(mg_connection* nc)
     // create new client slot:
     WebSocketSlot slot;
     slot.handler = NULL;
-    slot.modifier = MyMetrics.RegisterModifier();
+    slot.dirty = MyMetrics.AcquireDirtySet();
     slot.reader = MyNotify.RegisterReader("ovmsweb", COMMAND_RESULT_VERBOSE,
                                           std::bind(&OvmsWebServer::IncomingNotification, i, _1, _2), true,
                                           std::bind(&OvmsWebServer::NotificationFilter, i, _1, _2));
-    ESP_LOGD(TAG, "new WebSocket slot %d, registered modifier is %d, reader %d", i, slot.modifier, slot.reader);
+    ESP_LOGD(TAG, "new WebSocket slot %d, reader %d", i, slot.reader);
     m_client_slots.push_back(slot);
   } else {
     // reuse slot:
@@ -457,7 +672,7 @@ WebSocketHandler* OvmsWebServer::CreateWebSocketHandler(mg_connection* nc)
   }
   
   // create handler:
-  WebSocketHandler* handler = new WebSocketHandler(nc, i, m_client_slots[i].modifier, m_client_slots[i].reader);
+  WebSocketHandler* handler = new WebSocketHandler(nc, i, m_client_slots[i].dirty, m_client_slots[i].reader);
   m_client_slots[i].handler = handler;
   
   // start ticker:
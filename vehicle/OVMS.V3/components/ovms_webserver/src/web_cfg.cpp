@@ -4180,6 +4180,8 @@ void OvmsWebServer::HandleFile(PageEntry_t& p, PageContext_t& c)
       if (save_file(path, content) != 0) {
         error += "; Error writing to path: ";
         error += strerror(errno);
+      } else {
+        MyEvents.SignalEvent("system.vfs.file.changed", (void*)path.c_str(), path.size()+1);
       }
     }
   }
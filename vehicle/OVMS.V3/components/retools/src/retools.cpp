@@ -32,6 +32,7 @@
 static const char *TAG = "re";
 
 #include <string.h>
+#include <algorithm>
 #include "retools.h"
 #include "dbc_app.h"
 #include "ovms.h"
@@ -138,40 +139,142 @@ void re::Task()
     }
   }
 
+re_record_table::re_record_table()
+  {
+  m_count = 0;
+  m_hash = NULL;
+  m_hashbits = 0;
+  }
+
+re_record_table::~re_record_table()
+  {
+  for (re_record_t* chunk : m_chunks)
+    free(chunk);
+  if (m_hash)
+    free(m_hash);
+  }
+
+re_record_t* re_record_table::Find(re_key_t key)
+  {
+  if (!m_hash)
+    return NULL;
+  uint32_t mask = (1 << m_hashbits) - 1;
+  for (uint32_t slot = Hash(key); m_hash[slot]; slot = (slot + 1) & mask)
+    {
+    re_record_t* r = (*this)[m_hash[slot] - 1];
+    if (r->key == key)
+      return r;
+    }
+  return NULL;
+  }
+
+/**
+ * Add: allocate a new (zeroed) record for a key not yet in the table
+ *  - returns NULL if out of memory, including when the hash table cannot
+ *    grow, so the probe loops always find a free slot
+ */
+re_record_t* re_record_table::Add(re_key_t key)
+  {
+  // Keep the load factor below 75%:
+  if (!m_hash)
+    {
+    if (!Rehash(__builtin_ctz(RE_HASH_INITSIZE)))
+      return NULL;
+    }
+  else if ((m_count + 1) * 4 > (3U << m_hashbits))
+    {
+    if (!Rehash(m_hashbits + 1))
+      return NULL;
+    }
+
+  if (m_count == m_chunks.size() * RE_RECORD_CHUNK)
+    {
+    re_record_t* chunk = (re_record_t*) ExternalRamMalloc(RE_RECORD_CHUNK * sizeof(re_record_t));
+    if (!chunk)
+      return NULL;
+    m_chunks.push_back(chunk);
+    }
+
+  re_record_t* r = (*this)[m_count];
+  memset(r, 0, sizeof(re_record_t));
+  r->key = key;
+
+  uint32_t mask = (1 << m_hashbits) - 1;
+  uint32_t slot = Hash(key);
+  while (m_hash[slot])
+    slot = (slot + 1) & mask;
+  m_hash[slot] = ++m_count;
+  return r;
+  }
+
+/**
+ * Rehash: resize the hash table to 2^bits slots
+ *  - returns false if out of memory, the old table is kept
+ */
+bool re_record_table::Rehash(int bits)
+  {
+  uint32_t* hash = (uint32_t*) ExternalRamMalloc(sizeof(uint32_t) << bits);
+  if (!hash)
+    {
+    ESP_LOGE(TAG, "Record table: out of memory for %u slots", 1U << bits);
+    return false;
+    }
+  memset(hash, 0, sizeof(uint32_t) << bits);
+  if (m_hash)
+    free(m_hash);
+  m_hash = hash;
+  m_hashbits = bits;
+
+  uint32_t mask = (1 << m_hashbits) - 1;
+  for (uint32_t i = 0; i < m_count; i++)
+    {
+    uint32_t slot = Hash((*this)[i]->key);
+    while (m_hash[slot])
+      slot = (slot + 1) & mask;
+    m_hash[slot] = i + 1;
+    }
+  return true;
+  }
+
+void re_record_table::Clear()
+  {
+  m_count = 0;
+  if (m_hash)
+    memset(m_hash, 0, sizeof(uint32_t) << m_hashbits);
+  }
+
 void re::DoAnalyse(CAN_frame_t* frame)
   {
   char vbuf[256];
 
   OvmsRecMutexLock lock(&m_mutex);
-  std::string key = GetKey(frame);
-  auto k = m_rmap.find(key);
-  re_record_t* r;
+  re_key_t key = GetKey(frame);
+  re_record_t* r = m_rmap.Find(key);
   if (m_rmap.size() == 0) m_started = monotonictime;
-  if (k == m_rmap.end())
+  if (r == NULL)
     {
-    r = k->second;
-    r = new re_record_t;
-    memset(r,0,sizeof(re_record_t));
+    r = m_rmap.Add(key);
+    if (r == NULL)
+      return;
     r->attr.b.Changed = 1; // Mark the whole ID as changed
     r->attr.dc = 0xff;
-    switch (MyRE->m_mode)
+    switch (m_mode)
       {
       case Analyse:
         break;
       case Discover:
         r->attr.b.Discovered = 1;
         r->attr.dd = 0xff;
+        r->last.origin = frame->origin;
         HighlightDump(vbuf, (const char*)frame->data.u8, frame->FIR.B.DLC, r->attr.dc, r->attr.dd);
         ESP_LOGV(TAG, "Discovered new %s%s%s %s",
-          re_green[0][0], key.c_str(), re_green[0][1], vbuf);
+          re_green[0][0], GetKeyName(r).c_str(), re_green[0][1], vbuf);
         break;
       }
-    m_rmap[key] = r;
     }
   else
     {
-    r = k->second;
-    switch (MyRE->m_mode)
+    switch (m_mode)
       {
       case Analyse:
         for (int k=0;k<r->last.FIR.B.DLC;k++)
@@ -197,7 +300,7 @@ void re::DoAnalyse(CAN_frame_t* frame)
         if (found)
           {
           HighlightDump(vbuf, (const char*)frame->data.u8, frame->FIR.B.DLC, r->attr.dc, r->attr.dd);
-          ESP_LOGV(TAG, "Discovered change %s %s", k->first.c_str(), vbuf);
+          ESP_LOGV(TAG, "Discovered change %s %s", GetKeyName(r).c_str(), vbuf);
           }
         break;
         }
@@ -207,21 +310,13 @@ void re::DoAnalyse(CAN_frame_t* frame)
   r->rxcount++;
   }
 
-std::string re::GetKey(CAN_frame_t* frame)
+re_key_t re::GetKey(CAN_frame_t* frame)
   {
-  std::string key;
+  re_key_t key = frame->MsgID & 0x1fffffff;
+  if (frame->FIR.B.FF != CAN_frame_std)
+    key |= RE_KEY_EXT;
   if (frame->origin != NULL)
-    key = std::string(frame->origin->GetName());
-  else
-    key = std::string("can?");
-  key.append("/");
-
-  char id[9];
-  if (frame->FIR.B.FF == CAN_frame_std)
-    sprintf(id,"%03x",frame->MsgID);
-  else
-    sprintf(id,"%08x",frame->MsgID);
-  key.append(id);
+    key |= (re_key_t)((frame->origin->m_busnumber + 1) & 0x0f) << 30;
 
   if (((m_obdii_std_min>0) &&
        (frame->FIR.B.FF == CAN_frame_std) &&
@@ -239,25 +334,14 @@ std::string re::GetKey(CAN_frame_t* frame)
       // Probably just a continuation frame. Ignore it.
       return key;
       }
-    uint8_t mode = frame->data.u8[1];
-    char req[16];
-    if (mode > 0x4a)
-      {
-      sprintf(req,":O2Pm%d:%d",mode-0x40,((int)frame->data.u8[2]<<8)+frame->data.u8[3]);
-      }
-    else if (mode > 0x40)
-      {
-      sprintf(req,":O2Pm%d:%d",mode-0x40,(int)frame->data.u8[2]);
-      }
-    else if (mode > 0x0a)
-      {
-      sprintf(req,":O2Qm%d:%d",mode,((int)frame->data.u8[2]<<8)+frame->data.u8[3]);
-      }
+    uint32_t mode = frame->data.u8[1];
+    uint32_t pid;
+    if (mode > 0x4a || (mode > 0x0a && mode <= 0x40))
+      pid = ((uint32_t)frame->data.u8[2]<<8) + frame->data.u8[3];
     else
-      {
-      sprintf(req,":O2Qm%d:%d",mode,(int)frame->data.u8[2]);
-      }
-    key.append(req);
+      pid = frame->data.u8[2];
+    key |= (re_key_t)RE_KEY_OBDII << 34;
+    key |= (re_key_t)((mode << 16) | pid) << 36;
     return key;
     }
 
@@ -274,9 +358,8 @@ std::string re::GetKey(CAN_frame_t* frame)
         dbcSignal* s = m->GetMultiplexorSignal();
         dbcNumber muxn = s->Decode(frame);
         uint32_t mux = muxn.GetUnsignedInteger();
-        char b[8];
-        sprintf(b,":%04x",mux);
-        key.append(b);
+        key |= (re_key_t)RE_KEY_MUX << 34;
+        key |= (re_key_t)(mux & 0x0fffffff) << 36;
         }
       }
     }
@@ -284,7 +367,75 @@ std::string re::GetKey(CAN_frame_t* frame)
   return key;
   }
 
-re::re(const char* name, canfilter* filter)
+/**
+ * GetKeyName: format the record key for display
+ */
+std::string re::GetKeyName(re_record_t* r)
+  {
+  std::string key;
+  if (RE_KEY_BUS(r->key) != 0 && r->last.origin != NULL)
+    key = std::string(r->last.origin->GetName());
+  else
+    key = std::string("can?");
+  key.append("/");
+
+  char buf[24];
+  uint32_t id = r->key & 0x1fffffff;
+  if (r->key & RE_KEY_EXT)
+    sprintf(buf,"%08x",id);
+  else
+    sprintf(buf,"%03x",id);
+  key.append(buf);
+
+  uint32_t data = RE_KEY_DATA(r->key);
+  switch (RE_KEY_TYPE(r->key))
+    {
+    case RE_KEY_OBDII:
+      {
+      uint32_t mode = data >> 16, pid = data & 0xffff;
+      if (mode > 0x40)
+        sprintf(buf,":O2Pm%u:%u",mode-0x40,pid);
+      else
+        sprintf(buf,":O2Qm%u:%u",mode,pid);
+      key.append(buf);
+      break;
+      }
+    case RE_KEY_MUX:
+      sprintf(buf,":%04x",data);
+      key.append(buf);
+      break;
+    default:
+      break;
+    }
+
+  return key;
+  }
+
+/**
+ * GetRecords: get the records matching a key name filter, sorted by key name
+ *  - caller must hold m_mutex while using the list
+ */
+void re::GetRecords(re_record_list_t& list, const char* filter /*=NULL*/)
+  {
+  list.reserve(m_rmap.size());
+  for (uint32_t i = 0; i < m_rmap.size(); i++)
+    {
+    re_record_t* r = m_rmap[i];
+    std::string name = GetKeyName(r);
+    if (!filter || strstr(name.c_str(), filter))
+      list.push_back(std::make_pair(name, r));
+    }
+  std::sort(list.begin(), list.end(),
+    [](const re_record_list_t::value_type& a, const re_record_list_t::value_type& b)
+      { return a.first < b.first; });
+  }
+
+/**
+ * re: create RE tools instance
+ *  - listen: false = don't attach to the CAN framework (frames are fed by
+ *    calling DoAnalyse() directly, used for benchmarking)
+ */
+re::re(const char* name, canfilter* filter, bool listen)
   : pcp(name)
   {
   m_filter = filter;
@@ -295,19 +446,27 @@ re::re(const char* name, canfilter* filter)
   m_started = monotonictime;
   m_finished = monotonictime;
   m_mode = Analyse;
-  m_rxqueue = xQueueCreate(20,sizeof(CAN_frame_t));
-  xTaskCreatePinnedToCore(RE_task, "OVMS RE", 4096, (void*)this, 5, &m_task, CORE(1));
-  MyCan.RegisterListener(m_rxqueue, true);
+  m_rxqueue = NULL;
+  m_task = NULL;
+  if (listen)
+    {
+    m_rxqueue = xQueueCreate(20,sizeof(CAN_frame_t));
+    xTaskCreatePinnedToCore(RE_task, "OVMS RE", 4096, (void*)this, 5, &m_task, CORE(1));
+    MyCan.RegisterListener(m_rxqueue, true, "re");
+    }
   }
 
 re::~re()
   {
   OvmsRecMutexLock lock(&m_mutex);
-  MyCan.DeregisterListener(m_rxqueue);
+  if (m_rxqueue)
+    {
+    MyCan.DeregisterListener(m_rxqueue);
+    vQueueDelete(m_rxqueue);
+    vTaskDelete(m_task);
+    }
 
   Clear();
-  vQueueDelete(m_rxqueue);
-  vTaskDelete(m_task);
   if (m_filter)
     {
     delete m_filter;
@@ -335,11 +494,7 @@ void re::SetPowerMode(PowerMode powermode)
 
 void re::Clear()
   {
-  for (re_record_map_t::iterator it=m_rmap.begin(); it!=m_rmap.end(); ++it)
-    {
-    delete it->second;
-    }
-  m_rmap.clear();
+  m_rmap.Clear();
   m_started = monotonictime;
   m_finished = monotonictime;
   }
@@ -411,7 +566,9 @@ void re_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, cons
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
   writer->printf("%-20.20s %10s %6s %s\n","key","records","ms","last");
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  re_record_list_t list;
+  MyRE->GetRecords(list);
+  for (re_record_list_t::iterator it=list.begin(); it!=list.end(); ++it)
     {
     if ((argc==0)||(strstr(it->first.c_str(),argv[0])))
       {
@@ -440,7 +597,9 @@ void re_stream_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
   writer->printf("[");
   int cnt = 0;
   char *ascii = NULL;
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  re_record_list_t list;
+  MyRE->GetRecords(list);
+  for (re_record_list_t::iterator it=list.begin(); it!=list.end(); ++it)
     {
     if (argc == 0 || strstr(it->first.c_str(),argv[0]) != NULL)
       {
@@ -470,7 +629,9 @@ void re_dbc_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
   writer->printf("%-20.20s %10s %6s %s\n","key","records","ms","last");
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  re_record_list_t list;
+  MyRE->GetRecords(list);
+  for (re_record_list_t::iterator it=list.begin(); it!=list.end(); ++it)
     {
     if ((argc==0)||(strstr(it->first.c_str(),argv[0])))
       {
@@ -558,9 +719,9 @@ void re_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, co
     int bchanged = 0;
     int ndiscovered = 0;
     int bdiscovered = 0;
-    for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+    for (uint32_t i=0; i<MyRE->m_rmap.size(); i++)
       {
-      re_record_t *r = it->second;
+      re_record_t *r = MyRE->m_rmap[i];
       if (r->attr.b.Ignore) nignored++;
       if (r->attr.b.Changed) nchanged++;
       if (r->attr.b.Discovered) ndiscovered++;
@@ -629,10 +790,10 @@ void re_mode_discover(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int a
     }
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  for (uint32_t i=0; i<MyRE->m_rmap.size(); i++)
     {
-    it->second->attr.b.Discovered = 0;
-    it->second->attr.dd = 0;
+    MyRE->m_rmap[i]->attr.b.Discovered = 0;
+    MyRE->m_rmap[i]->attr.dd = 0;
     }
 
   MyRE->m_mode = Discover;
@@ -649,10 +810,10 @@ void re_clear_changed(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int a
     }
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  for (uint32_t i=0; i<MyRE->m_rmap.size(); i++)
     {
-    it->second->attr.b.Changed = 0;
-    it->second->attr.dc = 0;
+    MyRE->m_rmap[i]->attr.b.Changed = 0;
+    MyRE->m_rmap[i]->attr.dc = 0;
     }
 
   if (MyNotify.HasReader("stream", "retools.list"))
@@ -675,10 +836,10 @@ void re_clear_discovered(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, in
     }
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  for (uint32_t i=0; i<MyRE->m_rmap.size(); i++)
     {
-    it->second->attr.b.Discovered = 0;
-    it->second->attr.dd = 0;
+    MyRE->m_rmap[i]->attr.b.Discovered = 0;
+    MyRE->m_rmap[i]->attr.dd = 0;
     }
 
   if (MyNotify.HasReader("stream", "retools.list"))
@@ -706,7 +867,9 @@ void re_list_changed(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int ar
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
   writer->printf("%-20.20s %10s %6s %s\n","key","records","ms","last");
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  re_record_list_t list;
+  MyRE->GetRecords(list);
+  for (re_record_list_t::iterator it=list.begin(); it!=list.end(); ++it)
     {
     if ((it->second->attr.b.Changed)||(it->second->attr.dc))
       {
@@ -737,7 +900,9 @@ void re_stream_changed(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int
   writer->printf("[");
   int cnt = 0;
   char *ascii = NULL;
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  re_record_list_t list;
+  MyRE->GetRecords(list);
+  for (re_record_list_t::iterator it=list.begin(); it!=list.end(); ++it)
     {
     if ((it->second->attr.b.Changed || it->second->attr.dc) &&
         (argc == 0 || strstr(it->first.c_str(),argv[0]) != NULL))
@@ -769,7 +934,9 @@ void re_list_discovered(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int
 
   OvmsRecMutexLock lock(&MyRE->m_mutex);
   writer->printf("%-20.20s %10s %6s %s\n","key","records","ms","last");
-  for (re_record_map_t::iterator it=MyRE->m_rmap.begin(); it!=MyRE->m_rmap.end(); ++it)
+  re_record_list_t list;
+  MyRE->GetRecords(list);
+  for (re_record_list_t::iterator it=list.begin(); it!=list.end(); ++it)
     {
     if ((it->second->attr.b.Discovered)||(it->second->attr.dd))
       {
@@ -35,7 +35,7 @@
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include <string>
-#include <map>
+#include <vector>
 #include "can.h"
 #include "canformat.h"
 #include "dbc.h"
@@ -44,8 +44,34 @@
 #include "ovms_mutex.h"
 #include "ovms_netmanager.h"
 
+/**
+ * Record keys: frames are tracked per bus, ID and optionally multiplexer value
+ * or OBD-II request mode & PID, packed into a 64 bit integer:
+ *
+ *   bits  0…28   CAN ID
+ *   bit   29     extended ID flag
+ *   bits 30…33   bus number + 1 (0 = unknown origin)
+ *   bits 34…35   key type (RE_KEY_*)
+ *   bits 36…63   type specific: multiplexer value (truncated to 28 bits)
+ *                or OBD-II request (mode << 16 | PID)
+ *
+ * The key string ("can1/7e8:O2Pm1:12") is only formatted for display, see
+ * re::GetKeyName().
+ */
+typedef uint64_t re_key_t;
+
+#define RE_KEY_PLAIN      0
+#define RE_KEY_MUX        1
+#define RE_KEY_OBDII      2
+
+#define RE_KEY_EXT        (1ULL << 29)
+#define RE_KEY_BUS(k)     ((int)(((k) >> 30) & 0x0f))
+#define RE_KEY_TYPE(k)    ((int)(((k) >> 34) & 0x03))
+#define RE_KEY_DATA(k)    ((uint32_t)((k) >> 36))
+
 typedef struct
   {
+  re_key_t key;
   CAN_frame_t last;
   uint32_t rxcount;
   struct __attribute__((__packed__))
@@ -66,14 +92,56 @@ typedef struct
     } attr;
   } re_record_t;
 
-typedef std::map<std::string, re_record_t*> re_record_map_t;
+typedef std::vector< std::pair<std::string, re_record_t*> > re_record_list_t;
+
+/**
+ * re_record_table: record store
+ *
+ * Records are allocated from a pool of fixed size chunks (in SPIRAM) and are
+ * only freed as a whole by Clear(), which keeps the chunks for reuse. Records
+ * are found by an open addressing hash table (linear probing) of record indices,
+ * so a lookup does not allocate and normally needs a single key comparison.
+ */
+#define RE_RECORD_CHUNK   64          // Records per pool chunk
+#define RE_HASH_INITSIZE  256         // Initial hash table size (power of 2)
+
+class re_record_table
+  {
+  public:
+    re_record_table();
+    ~re_record_table();
+
+  public:
+    re_record_t* Find(re_key_t key);
+    re_record_t* Add(re_key_t key);
+    void Clear();
+    uint32_t size() { return m_count; }
+    re_record_t* operator[](uint32_t index)
+      {
+      return &m_chunks[index / RE_RECORD_CHUNK][index % RE_RECORD_CHUNK];
+      }
+
+  protected:
+    uint32_t Hash(re_key_t key)
+      {
+      uint32_t h = (uint32_t)key ^ (uint32_t)(key >> 29) ^ (uint32_t)(key >> 36);
+      return (h * 0x9e3779b1) >> (32 - m_hashbits);
+      }
+    bool Rehash(int bits);
+
+  protected:
+    std::vector<re_record_t*> m_chunks;
+    uint32_t m_count;           // Records in use
+    uint32_t* m_hash;           // Record index + 1, 0 = free slot
+    int m_hashbits;
+  };
 
 enum REMode { Analyse, Discover };
 
 class re : public pcp, public ExternalRamAllocated
   {
   public:
-    re(const char* name, canfilter* filter = NULL);
+    re(const char* name, canfilter* filter = NULL, bool listen = true);
     ~re();
 
   public:
@@ -82,9 +150,9 @@ class re : public pcp, public ExternalRamAllocated
   public:
     void Task();
     void Clear();
-    std::string GetKey(CAN_frame_t* frame);
-
-  protected:
+    re_key_t GetKey(CAN_frame_t* frame);
+    std::string GetKeyName(re_record_t* r);
+    void GetRecords(re_record_list_t& list, const char* filter = NULL);
     void DoAnalyse(CAN_frame_t* frame);
 
   protected:
@@ -95,7 +163,7 @@ class re : public pcp, public ExternalRamAllocated
     OvmsRecMutex m_mutex;
     canfilter* m_filter;
     REMode m_mode;
-    re_record_map_t m_rmap;
+    re_record_table m_rmap;
     uint32_t m_obdii_std_min;
     uint32_t m_obdii_std_max;
     uint32_t m_obdii_ext_min;
@@ -311,7 +311,7 @@ OvmsReToolsPidScanner::OvmsReToolsPidScanner(
     xTaskCreatePinnedToCore(
         &OvmsReToolsPidScanner::Task, "OVMS RE PID", 4096, this, 5, &m_task, CORE(1)
     );
-    MyCan.RegisterListener(m_rxqueue, true);
+    MyCan.RegisterListener(m_rxqueue, true, "re pidscan");
     m_currentPid = m_startPid - m_pidStep;
     MyEvents.RegisterEvent(
         TAG, "ticker.1",
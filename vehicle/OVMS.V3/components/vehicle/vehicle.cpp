@@ -63,6 +63,12 @@ OvmsVehicleFactory::OvmsVehicleFactory()
   cmd_vehicle->RegisterCommand("module","Set (or clear) vehicle module",vehicle_module,"<type>",0,1,true,vehicle_validate);
   cmd_vehicle->RegisterCommand("list","Show list of available vehicle modules",vehicle_list);
   cmd_vehicle->RegisterCommand("status","Show vehicle module status",vehicle_status);
+  OvmsCommand* cmd_poller = cmd_vehicle->RegisterCommand("poller","Vehicle poller framework", vehicle_poller_status, "", 0, 0, false);
+  cmd_poller->RegisterCommand("status","Show poller channel status & statistics",vehicle_poller_status);
+  cmd_poller->RegisterCommand("reset","Reset poller channel statistics",vehicle_poller_reset);
+  cmd_poller->RegisterCommand("concurrency","Show/set max poller requests in flight",vehicle_poller_concurrency,
+    "[<channels>|default]\n"
+    "0 = sequential poller, 1…255 = channel engine, default = use vehicle module setting", 0, 1);
 
   MyCommandApp.RegisterCommand("wakeup","Wake up vehicle",vehicle_wakeup);
   MyCommandApp.RegisterCommand("homelink","Activate specified homelink button",vehicle_homelink,"<homelink> [<duration=1000ms>]",1,2);
@@ -236,6 +242,10 @@ static void OvmsVehicleRxTask(void *pvParameters)
   }
 
 OvmsVehicle::OvmsVehicle()
+  : m_cfg_minsoc("vehicle", "minsoc", 0),
+    m_cfg_12v_ref("vehicle", "12v.ref", 12.6),
+    m_cfg_12v_alert("vehicle", "12v.alert", 1.6),
+    m_cfg_tpms_alerts("vehicle", "tpms.alerts.enabled", true)
   {
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -267,6 +277,7 @@ OvmsVehicle::OvmsVehicle()
   m_vehicleoff_ticker = 0;
   m_idle_ticker = 0;
   m_registeredlistener = false;
+  m_subscribedframes = false;
   m_autonotifications = true;
   m_ready = false;
 
@@ -294,7 +305,17 @@ OvmsVehicle::OvmsVehicle()
   m_poll_sequence_cnt = 0;
   m_poll_fc_septime = 25;       // response default timing: 25 milliseconds
   m_poll_ch_keepalive = 60;     // channel keepalive default: 60 seconds
-
+  m_poll_concurrency = 0;       // default: sequential poller
+  m_poll_concurrency_def = 0;
+  m_poll_chcur = NULL;
+  m_poll_sched_due = INT64_MAX;
+  m_poll_stats_start = 0;
+  m_poll_rxbuf = NULL;
+  m_poll_rxstream = 0;
+  m_poll_rxdelivered = 0;
+  m_poll_rxdropped = 0;
+
+  m_bms_vstore = NULL;
   m_bms_voltages = NULL;
   m_bms_vmins = NULL;
   m_bms_vmaxs = NULL;
@@ -305,6 +326,7 @@ OvmsVehicle::OvmsVehicle()
   m_bms_vstddev_avg = 0;
   m_bms_has_voltages = false;
 
+  m_bms_tstore = NULL;
   m_bms_temperatures = NULL;
   m_bms_tmins = NULL;
   m_bms_tmaxs = NULL;
@@ -376,56 +398,17 @@ OvmsVehicle::~OvmsVehicle()
   if (m_can3) m_can3->SetPowerMode(Off);
   if (m_can4) m_can4->SetPowerMode(Off);
 
-  if (m_bms_voltages != NULL)
-    {
-    delete [] m_bms_voltages;
-    m_bms_voltages = NULL;
-    }
-  if (m_bms_vmins != NULL)
-    {
-    delete [] m_bms_vmins;
-    m_bms_vmins = NULL;
-    }
-  if (m_bms_vmaxs != NULL)
-    {
-    delete [] m_bms_vmaxs;
-    m_bms_vmaxs = NULL;
-    }
-  if (m_bms_vdevmaxs != NULL)
-    {
-    delete [] m_bms_vdevmaxs;
-    m_bms_vdevmaxs = NULL;
-    }
-  if (m_bms_valerts != NULL)
-    {
-    delete [] m_bms_valerts;
-    m_bms_valerts = NULL;
-    }
+  PollerFreeRxPool();
 
-  if (m_bms_temperatures != NULL)
-    {
-    delete [] m_bms_temperatures;
-    m_bms_temperatures = NULL;
-    }
-  if (m_bms_tmins != NULL)
+  if (m_bms_vstore != NULL)
     {
-    delete [] m_bms_tmins;
-    m_bms_tmins = NULL;
+    delete [] m_bms_vstore;
+    m_bms_vstore = NULL;
     }
-  if (m_bms_tmaxs != NULL)
+  if (m_bms_tstore != NULL)
     {
-    delete [] m_bms_tmaxs;
-    m_bms_tmaxs = NULL;
-    }
-  if (m_bms_tdevmaxs != NULL)
-    {
-    delete [] m_bms_tdevmaxs;
-    m_bms_tdevmaxs = NULL;
-    }
-  if (m_bms_talerts != NULL)
-    {
-    delete [] m_bms_talerts;
-    m_bms_talerts = NULL;
+    delete [] m_bms_tstore;
+    m_bms_tstore = NULL;
     }
 
   if (m_registeredlistener)
@@ -457,13 +440,20 @@ void OvmsVehicle::RxTask()
 
   while(1)
     {
-    if (xQueueReceive(m_rxqueue, &frame, (portTickType)portMAX_DELAY)==pdTRUE)
+    // The channel poller needs to wake up for the next due request:
+    TickType_t timeout = m_poll_concurrency ? PollerScheduleDelay() : (portTickType)portMAX_DELAY;
+
+    if (xQueueReceive(m_rxqueue, &frame, timeout)==pdTRUE)
       {
       if (!m_ready)
         continue;
 
       // Pass frame to poller protocol handlers:
-      if (frame.origin == m_poll_vwtp.bus && frame.MsgID == m_poll_vwtp.rxid)
+      if (m_poll_concurrency)
+        {
+        PollerChannelReceive(&frame);
+        }
+      else if (frame.origin == m_poll_vwtp.bus && frame.MsgID == m_poll_vwtp.rxid)
         {
         PollerVWTPReceive(&frame, frame.MsgID);
         }
@@ -486,6 +476,10 @@ void OvmsVehicle::RxTask()
       else if (m_can3 == frame.origin) IncomingFrameCan3(&frame);
       else if (m_can4 == frame.origin) IncomingFrameCan4(&frame);
       }
+
+    // Start channel poller requests due:
+    if (m_poll_concurrency && m_ready && PollerScheduleDelay() == 0)
+      PollerSend(false);
     }
   }
 
@@ -541,8 +535,79 @@ void OvmsVehicle::RegisterCanBus(int bus, CAN_mode_t mode, CAN_speed_t speed, db
   if (!m_registeredlistener)
     {
     m_registeredlistener = true;
-    MyCan.RegisterListener(m_rxqueue);
+    MyCan.RegisterListener(m_rxqueue, false, "vehicle");
+    }
+  }
+
+/**
+ * GetCanBus: map bus number to registered bus
+ *  @param bus        CAN bus number (1-4)
+ *  @return           canbus or NULL if not registered
+ */
+canbus* OvmsVehicle::GetCanBus(int bus)
+  {
+  switch (bus)
+    {
+    case 1: return m_can1;
+    case 2: return m_can2;
+    case 3: return m_can3;
+    case 4: return m_can4;
+    default: return NULL;
+    }
+  }
+
+/**
+ * SubscribeCanFrames: restrict frame delivery to the IDs handled by the vehicle
+ *  By default, the vehicle receives all frames of all buses. Once a subscription
+ *  has been added, only matching frames will be queued for IncomingFrameCanN(),
+ *  all others are dropped by the CAN rx task before the queue copy.
+ *  Poll responses of the current poll list are subscribed automatically.
+ *  Call after RegisterCanBus(), subscriptions are additive.
+ *
+ *  @param bus        CAN bus number (1-4)
+ *  @param id_from    First CAN ID of range
+ *  @param id_to      Last CAN ID of range
+ *  @return           true = subscription active
+ */
+bool OvmsVehicle::SubscribeCanFrames(int bus, uint32_t id_from, uint32_t id_to)
+  {
+  canbus* cbus = GetCanBus(bus);
+  if (!cbus || !m_registeredlistener)
+    {
+    ESP_LOGE(TAG, "SubscribeCanFrames: bus %d not registered", bus);
+    return false;
+    }
+  if (!MyCan.SubscribeListener(m_rxqueue, cbus, id_from, id_to))
+    return false;
+  m_subscriptions.push_back({ cbus, id_from, id_to, 0 });
+  if (!m_subscribedframes)
+    {
+    m_subscribedframes = true;
+    PollerSubscribeFrames(m_poll_plist);
     }
+  return true;
+  }
+
+/**
+ * SubscribeCanFramesMask: like SubscribeCanFrames, matching (MsgID & mask) == (id & mask)
+ */
+bool OvmsVehicle::SubscribeCanFramesMask(int bus, uint32_t id, uint32_t mask)
+  {
+  canbus* cbus = GetCanBus(bus);
+  if (!cbus || !m_registeredlistener)
+    {
+    ESP_LOGE(TAG, "SubscribeCanFramesMask: bus %d not registered", bus);
+    return false;
+    }
+  if (!MyCan.SubscribeListenerMask(m_rxqueue, cbus, id, mask))
+    return false;
+  m_subscriptions.push_back({ cbus, id, id, mask });
+  if (!m_subscribedframes)
+    {
+    m_subscribedframes = true;
+    PollerSubscribeFrames(m_poll_plist);
+    }
+  return true;
   }
 
 bool OvmsVehicle::PinCheck(char* pin)
@@ -635,10 +700,10 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
     float volt = StandardMetrics.ms_v_bat_12v_voltage->AsFloat();
     // …against the maximum of default and measured reference voltage, so alerts will also
     //  be triggered if the measured ref follows a degrading battery:
-    float dref = MyConfig.GetParamValueFloat("vehicle", "12v.ref", 12.6);
+    float dref = m_cfg_12v_ref;
     float vref = MAX(StandardMetrics.ms_v_bat_12v_voltage_ref->AsFloat(), dref);
     bool alert_on = StandardMetrics.ms_v_bat_12v_voltage_alert->AsBool();
-    float alert_threshold = MyConfig.GetParamValueFloat("vehicle", "12v.alert", 1.6);
+    float alert_threshold = m_cfg_12v_alert;
     if (!alert_on && volt > 0 && vref > 0 && vref-volt > alert_threshold)
       {
       StandardMetrics.ms_v_bat_12v_voltage_alert->SetValue(true);
@@ -657,7 +722,7 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
     {
     // Check MINSOC
     int soc = (int) ceil(StandardMetrics.ms_v_bat_soc->AsFloat());
-    m_minsoc = MyConfig.GetParamValueInt("vehicle", "minsoc", 0);
+    m_minsoc = m_cfg_minsoc;
     if (m_minsoc <= 0)
       {
       m_minsoc_triggered = 0;
@@ -696,7 +761,7 @@ void OvmsVehicle::VehicleTicker1(std::string event, void* data)
     if (notify)
       {
       MyEvents.SignalEvent("vehicle.alert.tpms", NULL);
-      if (m_autonotifications && MyConfig.GetParamValueBool("vehicle", "tpms.alerts.enabled", true))
+      if (m_autonotifications && m_cfg_tpms_alerts)
         NotifyTpmsAlerts();
       }
     }
@@ -810,7 +875,7 @@ void OvmsVehicle::NotifyAlarmStopped()
 void OvmsVehicle::Notify12vCritical()
   {
   float volt = StandardMetrics.ms_v_bat_12v_voltage->AsFloat();
-  float dref = MyConfig.GetParamValueFloat("vehicle", "12v.ref", 12.6);
+  float dref = m_cfg_12v_ref;
   float vref = MAX(StandardMetrics.ms_v_bat_12v_voltage_ref->AsFloat(), dref);
 
   MyNotify.NotifyStringf("alert", "batt.12v.alert", "12V Battery critical: %.1fV (ref=%.1fV)", volt, vref);
@@ -819,7 +884,7 @@ void OvmsVehicle::Notify12vCritical()
 void OvmsVehicle::Notify12vRecovered()
   {
   float volt = StandardMetrics.ms_v_bat_12v_voltage->AsFloat();
-  float dref = MyConfig.GetParamValueFloat("vehicle", "12v.ref", 12.6);
+  float dref = m_cfg_12v_ref;
   float vref = MAX(StandardMetrics.ms_v_bat_12v_voltage_ref->AsFloat(), dref);
 
   MyNotify.NotifyStringf("alert", "batt.12v.recovered", "12V Battery restored: %.1fV (ref=%.1fV)", volt, vref);
@@ -1229,6 +1294,9 @@ void OvmsVehicle::VehicleConfigChanged(std::string event, void* data)
     m_brakelight_basepwr = MyConfig.GetParamValueFloat("vehicle", "brakelight.basepwr", 0);
     m_brakelight_ignftbrk = MyConfig.GetParamValueBool("vehicle", "brakelight.ignftbrk", false);
     m_brakelight_start = 0;
+
+    // poller mode:
+    PollerApplyConcurrency();
     }
 
   // read vehicle specific config:
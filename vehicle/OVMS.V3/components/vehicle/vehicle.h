@@ -65,6 +65,9 @@ struct DashboardConfig;
 // Argument tag:
 #define POLL_TXDATA                     0xff  // poll_pid_t using xargs for external payload up to 4095 bytes
 
+// Response reassembly buffer size (see PollSetReassembly()), max ISO-TP/VWTP response length is 4095:
+#define VEHICLE_POLL_RXBUF_SIZE         4096
+
 
 // OBD2/UDS Polling types supported:
 //  (see https://en.wikipedia.org/wiki/OBD-II_PIDs
@@ -115,6 +118,23 @@ struct DashboardConfig;
 // To explicitly close a VWTP_20 channel, send a poll (any type) to RXID 0, that just
 // closes the channel (ECU ID 0 is an invalid destination):
 //   { 0x200,    0,     0,      0,  {…times…},    0 , VWTP_20 }
+// 
+// Concurrent polling: by default, the poller processes the list sequentially with one
+// request in flight, stepping through the list once per second. Call PollSetConcurrency()
+// to switch to the channel engine: each target (bus, TXID, protocol) then gets its own
+// channel, so up to the configured number of requests are in flight in parallel and a slow
+// ECU no longer delays the others. Entries are scheduled by deadline, so you can set sub-
+// second intervals by the optional polltime_ms field (overrides polltime for the channel
+// engine, ignored by the sequential poller):
+//   // TXID, RXID,  TYPE,                       PID,      TIMES,  BUS, PROT,      TIMES [ms]
+//   { 0x7e4, 0x7ec, VEHICLE_POLL_TYPE_READDATA, 0x0101, {0,1,1,0},  0,  ISOTP_STD, {0,250,500,0} }
+// Channels with overlapping response ID ranges on the same bus (e.g. broadcasts) are not
+// polled in parallel, and all VWTP_20 entries share a single channel (see above). The
+// throttling limit (PollSetThrottling()) applies per channel in this mode.
+// Use the shell command "vehicle poller" to view the channel statistics. The user can
+// override the vehicle module's setting by config "vehicle poller.concurrency" (command
+// "vehicle poller concurrency"), e.g. to test the channel engine or to fall back to the
+// sequential poller.
 
 
 #define VEHICLE_POLL_TYPE_NONE          0x00
@@ -241,6 +261,28 @@ struct DashboardConfig;
 #define BMS_DEFTHR_TWARN                2.00    // [°C]
 #define BMS_DEFTHR_TALERT               3.00    // [°C]
 
+/**
+ * BMS cell statistics kernel:
+ *  BmsCellStats() gets min, max, average, standard deviation and optionally
+ *  the gradient over the cell index in a single pass. Sums are accumulated
+ *  in float relative to the first cell, so the variance does not suffer from
+ *  cancellation and no double emulation is needed.
+ *  BmsCellDeviations() then updates the per cell deviation maximums (rounded
+ *  to precision decimals) & alert levels and returns the number of new alerts.
+ */
+typedef struct
+  {
+  float min;
+  float max;
+  float avg;
+  float stddev;
+  float grad;                                 // only if requested
+  } bms_cellstats_t;
+
+void BmsCellStats(const float* values, int count, bms_cellstats_t* stats, bool gradient=false);
+int BmsCellDeviations(const float* values, int count, const bms_cellstats_t* stats, int precision,
+  float thr_warn, float thr_alert, float* devmaxs, short* alerts);
+
 
 // VWTP_20 channel states:
 typedef enum
@@ -288,6 +330,7 @@ class OvmsVehicle : public InternalRamAllocated
     QueueHandle_t m_rxqueue;
     TaskHandle_t m_rxtask;
     bool m_registeredlistener;
+    bool m_subscribedframes;
     bool m_autonotifications;
     bool m_ready;
 
@@ -318,6 +361,12 @@ class OvmsVehicle : public InternalRamAllocated
     int m_minsoc;            // The minimum SOC level before alert
     int m_minsoc_triggered;  // The triggered minimum SOC level to alert at
 
+  protected:
+    ConfigHandle<int> m_cfg_minsoc;             // vehicle minsoc
+    ConfigHandle<float> m_cfg_12v_ref;          // vehicle 12v.ref
+    ConfigHandle<float> m_cfg_12v_alert;        // vehicle 12v.alert
+    ConfigHandle<bool> m_cfg_tpms_alerts;       // vehicle tpms.alerts.enabled
+
   protected:
     float m_accel_refspeed;                 // Acceleration calculation: last speed measured (m/s)
     uint32_t m_accel_reftime;               // … timestamp for refspeed (ms)
@@ -452,8 +501,21 @@ class OvmsVehicle : public InternalRamAllocated
 
   protected:
     void RegisterCanBus(int bus, CAN_mode_t mode, CAN_speed_t speed, dbcfile* dbcfile = NULL);
+    bool SubscribeCanFrames(int bus, uint32_t id_from, uint32_t id_to);
+    bool SubscribeCanFramesMask(int bus, uint32_t id, uint32_t mask);
+    canbus* GetCanBus(int bus);
     bool PinCheck(char* pin);
 
+  private:
+    typedef struct
+      {
+      canbus*   bus;                    // bus to match
+      uint32_t  id_from;                // range: first ID / mask: ID bits to match
+      uint32_t  id_to;                  // range: last ID
+      uint32_t  mask;                   // 0 = range, else mask subscription
+      } vehicle_subscription_t;
+    std::vector<vehicle_subscription_t> m_subscriptions; // vehicle frame subscriptions (w/o poll responses)
+
   public:
     virtual void RxTask();
 
@@ -541,8 +603,79 @@ class OvmsVehicle : public InternalRamAllocated
       uint16_t polltime[VEHICLE_POLL_NSTATES];  // poll intervals in seconds for used poll states
       uint8_t  pollbus;                         // 0 = default CAN bus from PollSetPidList(), 1…4 = specific
       uint8_t  protocol;                        // ISOTP_STD / ISOTP_EXTADR / ISOTP_EXTFRAME / VWTP_20
+      uint16_t polltime_ms[VEHICLE_POLL_NSTATES]; // optional poll intervals in milliseconds (channel engine)
       } poll_pid_t;
 
+    typedef struct
+      {
+      canbus*        bus;                       // CAN bus the response was received on
+      uint32_t       moduleid;                  // response CAN ID (ISOTP_EXTADR: incl. address byte, VWTP: module id)
+      uint16_t       type;                      // UDS poll type / OBD2 "mode" of the request
+      uint16_t       pid;                       // PID of the request
+      const uint8_t* data;                      // response payload (section)
+      uint16_t       length;                    // … length of this section
+      uint16_t       offset;                    // … position of this section in the response
+      uint16_t       total;                     // total response payload length
+      } poll_reply_t;                           // complete if offset + length == total
+
+    typedef struct
+      {
+      uint8_t* data;                            // PSRAM buffer of VEHICLE_POLL_RXBUF_SIZE bytes
+      uint16_t fill;                            // bytes collected & not yet delivered
+      uint16_t offset;                          // response position of data[0]
+      uint16_t total;                           // total response length
+      bool     used;                            // assigned to a request
+      } poll_rxbuf_t;
+
+    typedef struct
+      {
+      uint32_t requests;                        // requests sent
+      uint32_t responses;                       // requests completed (response or NRC)
+      uint32_t timeouts;                        // requests abandoned without (complete) response
+      uint32_t txfails;                         // requests aborted by CAN transmission failure
+      uint32_t rxframes;                        // response frames processed
+      uint64_t latency_sum;                     // sum of request completion times [ms]
+      uint32_t latency_max;                     // max request completion time [ms]
+      } poll_channel_stats_t;
+
+    typedef struct
+      {
+      canbus*           bus;                    // channel key: bus (VWTP_20: last bus used)
+      uint32_t          txmoduleid;             // … TX ID (broadcasts: 0x7df / 0x18db33f1, VWTP_20: 0)
+      uint8_t           protocol;               // … protocol
+      uint32_t          rxid_low;               // response ID range of all entries
+      uint32_t          rxid_high;              //  … (for parallel polling conflict checks)
+      uint16_t          entries;                // number of poll list entries using the channel
+      // request state, swapped into the m_poll_* members while processing:
+      const poll_pid_t* plcur;
+      poll_pid_t        entry;
+      uint32_t          moduleid_sent;
+      uint32_t          moduleid_low;
+      uint32_t          moduleid_high;
+      uint16_t          type;
+      uint16_t          pid;
+      const uint8_t*    tx_data;
+      uint16_t          tx_remain;
+      uint16_t          tx_offset;
+      uint16_t          tx_frame;
+      uint16_t          ml_remain;
+      uint16_t          ml_offset;
+      uint16_t          ml_frame;
+      uint8_t           wait;                   // see m_poll_wait, channel is busy while > 0
+      bool              discard;                // pending request of a replaced list, response is dropped
+      poll_rxbuf_t*     rxbuf;
+      uint32_t          txmsgid;
+      uint8_t           seqcnt;                 // requests sent in the current time tick (second)
+      int64_t           sent_time;              // request start time [ms], 0 = none pending
+      poll_channel_stats_t stats;
+      } poll_channel_t;
+
+    typedef struct
+      {
+      int64_t           due;                    // next due time [ms]
+      uint16_t          index;                  // poll list entry index
+      } poll_sched_t;
+
   protected:
     OvmsRecMutex      m_poll_mutex;           // Concurrency protection for recursive calls
     uint8_t           m_poll_state;           // Current poll state
@@ -581,6 +714,24 @@ class OvmsVehicle : public InternalRamAllocated
     uint8_t           m_poll_fc_septime;      // Flow control separation time for multi frame responses
     uint16_t          m_poll_ch_keepalive;    // Seconds to keep an inactive channel (e.g. VWTP) alive (default: 60)
 
+  private:
+    uint8_t           m_poll_concurrency;     // Channel engine: max requests in flight, 0 = sequential poller
+    uint8_t           m_poll_concurrency_def; // … vehicle module default (see PollSetConcurrency)
+    std::vector<poll_channel_t> m_poll_channels; // … channels (kept over list changes for the statistics)
+    std::vector<uint16_t> m_poll_entry_ch;    // … poll list entry channel index
+    std::vector<poll_sched_t> m_poll_sched;   // … deadline min-heap of poll list entries
+    std::vector<poll_sched_t> m_poll_deferred; // … scheduler buffer for entries waiting for their channel
+    poll_channel_t*   m_poll_chcur;           // … channel currently loaded into the m_poll_* members
+    int64_t           m_poll_sched_due;       // … next scheduler run [ms]
+    int64_t           m_poll_stats_start;     // … statistics start time [ms]
+
+  private:
+    std::vector<poll_rxbuf_t> m_poll_rxpool;  // Response reassembly: buffer pool (empty = disabled)
+    poll_rxbuf_t*     m_poll_rxbuf;           // … buffer assigned to the current request
+    uint16_t          m_poll_rxstream;        // … streaming section size, 0 = complete responses only
+    uint32_t          m_poll_rxdelivered;     // … responses delivered
+    uint32_t          m_poll_rxdropped;       // … responses dropped (pool exhausted / overflow)
+
   private:
     OvmsRecMutex      m_poll_single_mutex;    // PollSingleRequest() concurrency protection
     std::string*      m_poll_single_rxbuf;    // … response buffer
@@ -596,6 +747,8 @@ class OvmsVehicle : public InternalRamAllocated
     void PollSetThrottling(uint8_t sequence_max);
     void PollSetResponseSeparationTime(uint8_t septime);
     void PollSetChannelKeepalive(uint16_t keepalive_seconds);
+    void PollSetConcurrency(uint8_t channels);
+    void PollSetReassembly(bool enable, uint16_t stream_size=0);
     int PollSingleRequest(canbus* bus, uint32_t txid, uint32_t rxid,
                       std::string request, std::string& response,
                       int timeout_ms=3000, uint8_t protocol=ISOTP_STD);
@@ -604,6 +757,39 @@ class OvmsVehicle : public InternalRamAllocated
                       int timeout_ms=3000, uint8_t protocol=ISOTP_STD);
     const char* PollResultCodeName(int code);
 
+  public:
+    void PollerStatus(int verbosity, OvmsWriter* writer);
+    void PollerResetStats();
+
+  private:
+    void PollerSubscribeFrames(const poll_pid_t* plist);
+    void PollerResubscribeFrames(const poll_pid_t* plist);
+    static void PollerBroadcastIds(uint8_t protocol, uint32_t* txid, uint32_t* rxid_low, uint32_t* rxid_high);
+    static uint32_t PollerBroadcastResponder(uint8_t protocol, uint32_t rxid);
+
+  public:
+    void PollerApplyConcurrency();
+
+  private:
+    void PollerBuildSchedule();
+    uint32_t PollerInterval(const poll_pid_t* entry);
+    canbus* PollerEntryBus(const poll_pid_t* entry);
+    void PollerLoadChannel(poll_channel_t* channel);
+    void PollerSaveChannel(bool timeout=false);
+    bool PollerChannelBlocked(const poll_channel_t* channel);
+    void PollerChannelStart(poll_channel_t* channel, const poll_pid_t* entry, bool fromTicker);
+    void PollerChannelTicker();
+    bool PollerChannelReceive(CAN_frame_t* frame);
+    void PollerSchedule(bool fromTicker);
+    TickType_t PollerScheduleDelay();
+
+  private:
+    void PollerInitRxPool();
+    void PollerFreeRxPool();
+    void PollerReleaseRxBuffer();
+    void PollerDeliverReply(canbus* bus, uint32_t msgid, uint8_t* data, uint16_t length);
+    void PollerRxPoolStatus(OvmsWriter* writer);
+
   private:
     void PollerISOTPStart(bool fromTicker);
     bool PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid);
@@ -623,10 +809,12 @@ class OvmsVehicle : public InternalRamAllocated
     void PollerTxCallback(const CAN_frame_t* frame, bool success);
   protected:
     virtual void IncomingPollTxCallback(canbus* bus, uint32_t txid, uint16_t type, uint16_t pid, bool success);
+    virtual void IncomingPollResponse(const poll_reply_t& reply);
 
 
   // BMS helpers
   protected:
+    float* m_bms_vstore;                      // BMS voltage cell store (arrays below in one block)
     float* m_bms_voltages;                    // BMS voltages (current value)
     float* m_bms_vmins;                       // BMS minimum voltages seen (since reset)
     float* m_bms_vmaxs;                       // BMS maximum voltages seen (since reset)
@@ -636,6 +824,7 @@ class OvmsVehicle : public InternalRamAllocated
     int m_bms_vstddev_cnt;                    // BMS internal stddev counter
     float m_bms_vstddev_avg;                  // BMS internal stddev average
     bool m_bms_has_voltages;                  // True if BMS has a complete set of voltage values
+    float* m_bms_tstore;                      // BMS temperature cell store (arrays below in one block)
     float* m_bms_temperatures;                // BMS temperatures (celcius current value)
     float* m_bms_tmins;                       // BMS minimum temperatures seen (since reset)
     float* m_bms_tmaxs;                       // BMS maximum temperatures seen (since reset)
@@ -753,6 +942,9 @@ class OvmsVehicleFactory
     static void vehicle_charge_cooldown(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void vehicle_stat(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void vehicle_stat_trip(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void vehicle_poller_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void vehicle_poller_reset(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void vehicle_poller_concurrency(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void bms_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void bms_reset(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void bms_alerts(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
@@ -32,6 +32,8 @@
 static const char *TAG = "vehicle";
 
 #include <stdio.h>
+#include <string.h>
+#include <math.h>
 #include <algorithm>
 #include <ovms_command.h>
 #include <ovms_script.h>
@@ -49,18 +51,131 @@ static const char *TAG = "vehicle";
 #define VSTDDEV_SMOOTHCNT         5
 
 
+/**
+ * BmsCellStats: single pass min, max, average, standard deviation & gradient
+ */
+void BmsCellStats(const float* values, int count, bms_cellstats_t* stats, bool gradient /*=false*/)
+  {
+  memset(stats, 0, sizeof(*stats));
+  if (count <= 0)
+    return;
+
+  float ref = values[0];
+  float min = ref, max = ref;
+  float sum = 0, sqrsum = 0, isum = 0;
+  float center = (count - 1) * 0.5f;
+  for (int i=0; i<count; i++)
+    {
+    float value = values[i];
+    float d = value - ref;
+    sum += d;
+    sqrsum += d * d;
+    isum += (i - center) * d;
+    if (value < min) min = value;
+    if (value > max) max = value;
+    }
+
+  float mean = sum / count;
+  stats->min = min;
+  stats->max = max;
+  stats->avg = ref + mean;
+  stats->stddev = sqrtf(LIMIT_MIN(sqrsum / count - mean * mean, 0));
+
+  if (gradient && count > 1)
+    {
+    // Linear regression slope over the cell index, scaled to the pack
+    //  (sum of squared index offsets = n(n²-1)/12):
+    float sumd = (float)count * ((float)count * count - 1) / 12;
+    stats->grad = isum / sumd * count;
+    }
+  }
+
+/**
+ * BmsCellDeviations: update cell deviation maximums & alert levels
+ *  Returns the number of cells newly raised to alert level.
+ */
+int BmsCellDeviations(const float* values, int count, const bms_cellstats_t* stats, int precision,
+  float thr_warn, float thr_alert, float* devmaxs, short* alerts)
+  {
+  float scale = powf(10, precision);
+  float lim_warn = stats->stddev + thr_warn;
+  float lim_alert = stats->stddev + thr_alert;
+  int alerts_new = 0;
+
+  for (int i=0; i<count; i++)
+    {
+    float dev = roundf((values[i] - stats->avg) * scale) / scale;
+    float absdev = fabsf(dev);
+    if (absdev > fabsf(devmaxs[i]))
+      devmaxs[i] = dev;
+    if (absdev >= lim_alert)
+      {
+      if (alerts[i] < 2)
+        {
+        alerts[i] = 2;
+        alerts_new++;
+        }
+      }
+    else if (absdev >= lim_warn && alerts[i] < 1)
+      {
+      alerts[i] = 1;
+      }
+    }
+
+  return alerts_new;
+  }
+
+/**
+ * BmsAllocCells: allocate the cell store as a single block holding the
+ *  arrays of values, minimums, maximums, deviation maximums & alert levels
+ */
+static float* BmsAllocCells(int readings, float** values, float** mins, float** maxs,
+  float** devmaxs, short** alerts)
+  {
+  float* store = new float[4*readings + (readings+1)/2];
+  *values = store;
+  *mins = store + readings;
+  *maxs = store + 2*readings;
+  *devmaxs = store + 3*readings;
+  *alerts = (short*)(store + 4*readings);
+  return store;
+  }
+
+/**
+ * BmsMetricBatch: store a set of cell vectors, then notify the listeners,
+ *  so they see the complete update
+ */
+class BmsMetricBatch
+  {
+  public:
+    BmsMetricBatch() { m_count = 0; }
+
+  public:
+    template <typename ElemType>
+    void Store(OvmsMetricVector<ElemType>* metric, int count, const ElemType* values)
+      {
+      m_metric[m_count] = metric;
+      m_modified[m_count] = metric->StoreElemValues(0, count, values);
+      m_count++;
+      }
+    void Publish()
+      {
+      for (int i=0; i<m_count; i++)
+        m_metric[i]->SetModified(m_modified[i]);
+      m_count = 0;
+      }
+
+  protected:
+    OvmsMetric* m_metric[5];
+    bool m_modified[5];
+    int m_count;
+  };
+
 void OvmsVehicle::BmsSetCellArrangementVoltage(int readings, int readingspermodule)
   {
-  if (m_bms_voltages != NULL) delete m_bms_voltages;
-  m_bms_voltages = new float[readings];
-  if (m_bms_vmins != NULL) delete m_bms_vmins;
-  m_bms_vmins = new float[readings];
-  if (m_bms_vmaxs != NULL) delete m_bms_vmaxs;
-  m_bms_vmaxs = new float[readings];
-  if (m_bms_vdevmaxs != NULL) delete m_bms_vdevmaxs;
-  m_bms_vdevmaxs = new float[readings];
-  if (m_bms_valerts != NULL) delete m_bms_valerts;
-  m_bms_valerts = new short[readings];
+  if (m_bms_vstore != NULL) delete [] m_bms_vstore;
+  m_bms_vstore = BmsAllocCells(readings,
+    &m_bms_voltages, &m_bms_vmins, &m_bms_vmaxs, &m_bms_vdevmaxs, &m_bms_valerts);
   m_bms_valerts_new = 0;
 
   m_bms_bitset_v.clear();
@@ -74,16 +189,9 @@ void OvmsVehicle::BmsSetCellArrangementVoltage(int readings, int readingspermodu
 
 void OvmsVehicle::BmsSetCellArrangementTemperature(int readings, int readingspermodule)
   {
-  if (m_bms_temperatures != NULL) delete m_bms_temperatures;
-  m_bms_temperatures = new float[readings];
-  if (m_bms_tmins != NULL) delete m_bms_tmins;
-  m_bms_tmins = new float[readings];
-  if (m_bms_tmaxs != NULL) delete m_bms_tmaxs;
-  m_bms_tmaxs = new float[readings];
-  if (m_bms_tdevmaxs != NULL) delete m_bms_tdevmaxs;
-  m_bms_tdevmaxs = new float[readings];
-  if (m_bms_talerts != NULL) delete m_bms_talerts;
-  m_bms_talerts = new short[readings];
+  if (m_bms_tstore != NULL) delete [] m_bms_tstore;
+  m_bms_tstore = BmsAllocCells(readings,
+    &m_bms_temperatures, &m_bms_tmins, &m_bms_tmaxs, &m_bms_tdevmaxs, &m_bms_talerts);
   m_bms_talerts_new = 0;
 
   m_bms_bitset_t.clear();
@@ -177,45 +285,26 @@ void OvmsVehicle::BmsSetCellVoltage(int index, float value)
     float thr_warn     = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.warn",     m_bms_defthr_vwarn);
     float thr_alert    = MyConfig.GetParamValueFloat("vehicle", "bms.dev.voltage.alert",    m_bms_defthr_valert);
 
-    // Get min, max, avg & standard deviation:
-    double sum=0, sqrsum=0, avg, stddev=0;
-    float min=0, max=0;
-    for (int i=0; i<m_bms_readings_v; i++)
-      {
-      sum += m_bms_voltages[i];
-      sqrsum += SQR(m_bms_voltages[i]);
-      if (min==0 || m_bms_voltages[i]<min)
-        min = m_bms_voltages[i];
-      if (max==0 || m_bms_voltages[i]>max)
-        max = m_bms_voltages[i];
-      }
-    avg = sum / m_bms_readings_v;
-    stddev = sqrt(LIMIT_MIN((sqrsum / m_bms_readings_v) - SQR(avg), 0));
-
-    // Get gradient:
-    double sumn = 0, sumd = 0;
-    for (int i=0; i<m_bms_readings_v; i++)
-      {
-      sumn += (i - (m_bms_readings_v / 2 - 0.5)) * (m_bms_voltages[i] - avg);
-      sumd += SQR(i - (m_bms_readings_v / 2 - 0.5));
-      }
-    float grad = (sumn / sumd) * m_bms_readings_v;
+    // Get min, max, avg, standard deviation & gradient:
+    bms_cellstats_t st;
+    BmsCellStats(m_bms_voltages, m_bms_readings_v, &st, true);
 
     // …publish to metrics:
-    StandardMetrics.ms_v_bat_pack_vmin->SetValue(min);
-    StandardMetrics.ms_v_bat_pack_vmax->SetValue(max);
-    StandardMetrics.ms_v_bat_pack_vavg->SetValue(ROUNDPREC(avg, 5));
-    StandardMetrics.ms_v_bat_pack_vstddev->SetValue(ROUNDPREC(stddev, 5));
-    StandardMetrics.ms_v_bat_pack_vgrad->SetValue(ROUNDPREC(grad, 5));
-    StandardMetrics.ms_v_bat_cell_voltage->SetElemValues(0, m_bms_readings_v, m_bms_voltages);
-    StandardMetrics.ms_v_bat_cell_vmin->SetElemValues(0, m_bms_readings_v, m_bms_vmins);
-    StandardMetrics.ms_v_bat_cell_vmax->SetElemValues(0, m_bms_readings_v, m_bms_vmaxs);
+    StandardMetrics.ms_v_bat_pack_vmin->SetValue(st.min);
+    StandardMetrics.ms_v_bat_pack_vmax->SetValue(st.max);
+    StandardMetrics.ms_v_bat_pack_vavg->SetValue(ROUNDPREC(st.avg, 5));
+    StandardMetrics.ms_v_bat_pack_vstddev->SetValue(ROUNDPREC(st.stddev, 5));
+    StandardMetrics.ms_v_bat_pack_vgrad->SetValue(ROUNDPREC(st.grad, 5));
+    BmsMetricBatch batch;
+    batch.Store(StandardMetrics.ms_v_bat_cell_voltage, m_bms_readings_v, m_bms_voltages);
+    batch.Store(StandardMetrics.ms_v_bat_cell_vmin, m_bms_readings_v, m_bms_vmins);
+    batch.Store(StandardMetrics.ms_v_bat_cell_vmax, m_bms_readings_v, m_bms_vmaxs);
 
     // Voltages are very volatile and may respond to a load change within the sensor query loop.
     // To detect an inconsistent series, we check for a too high gradient and/or a too high
     // offset of the momentary stddev level from the previously observed average:
     bool series_valid;
-    if (ABS(grad) > thr_maxgrad)
+    if (ABS(st.grad) > thr_maxgrad)
       {
       series_valid = false;
       }
@@ -223,43 +312,32 @@ void OvmsVehicle::BmsSetCellVoltage(int index, float value)
       {
       // skip the first VSTDDEV_SMOOTHCNT series to init the average:
       m_bms_vstddev_cnt++;
-      m_bms_vstddev_avg = ((m_bms_vstddev_cnt-1) * m_bms_vstddev_avg + stddev) / m_bms_vstddev_cnt;
+      m_bms_vstddev_avg = ((m_bms_vstddev_cnt-1) * m_bms_vstddev_avg + st.stddev) / m_bms_vstddev_cnt;
       series_valid = false;
       }
-    else if (stddev - m_bms_vstddev_avg > thr_maxsddev)
+    else if (st.stddev - m_bms_vstddev_avg > thr_maxsddev)
       {
       series_valid = false;
       }
     else
       {
-      m_bms_vstddev_avg = ((VSTDDEV_SMOOTHCNT-1) * m_bms_vstddev_avg + stddev) / VSTDDEV_SMOOTHCNT;
+      m_bms_vstddev_avg = ((VSTDDEV_SMOOTHCNT-1) * m_bms_vstddev_avg + st.stddev) / VSTDDEV_SMOOTHCNT;
       series_valid = true;
       }
 
     // Check cell deviations only if the series appears to be consistent:
     if (series_valid)
       {
-      float dev;
-      for (int i=0; i<m_bms_readings_v; i++)
-        {
-        dev = ROUNDPREC(m_bms_voltages[i] - avg, 5);
-        if (ABS(dev) > ABS(m_bms_vdevmaxs[i]))
-          m_bms_vdevmaxs[i] = dev;
-        if (ABS(dev) >= stddev + thr_alert && m_bms_valerts[i] < 2)
-          {
-          m_bms_valerts[i] = 2;
-          m_bms_valerts_new++; // trigger notification
-          }
-        else if (ABS(dev) >= stddev + thr_warn && m_bms_valerts[i] < 1)
-          m_bms_valerts[i] = 1;
-        }
+      m_bms_valerts_new += BmsCellDeviations(m_bms_voltages, m_bms_readings_v, &st, 5,
+        thr_warn, thr_alert, m_bms_vdevmaxs, m_bms_valerts);
 
       // Publish deviation maximums & alerts:
-      if (stddev > StandardMetrics.ms_v_bat_pack_vstddev_max->AsFloat())
-        StandardMetrics.ms_v_bat_pack_vstddev_max->SetValue(stddev);
-      StandardMetrics.ms_v_bat_cell_vdevmax->SetElemValues(0, m_bms_readings_v, m_bms_vdevmaxs);
-      StandardMetrics.ms_v_bat_cell_valert->SetElemValues(0, m_bms_readings_v, m_bms_valerts);
+      if (st.stddev > StandardMetrics.ms_v_bat_pack_vstddev_max->AsFloat())
+        StandardMetrics.ms_v_bat_pack_vstddev_max->SetValue(st.stddev);
+      batch.Store(StandardMetrics.ms_v_bat_cell_vdevmax, m_bms_readings_v, m_bms_vdevmaxs);
+      batch.Store(StandardMetrics.ms_v_bat_cell_valert, m_bms_readings_v, m_bms_valerts);
       }
+    batch.Publish();
 
     // complete:
     m_bms_has_voltages = true;
@@ -298,50 +376,29 @@ void OvmsVehicle::BmsSetCellTemperature(int index, float value)
     float thr_alert = MyConfig.GetParamValueFloat("vehicle", "bms.dev.temp.alert", m_bms_defthr_talert);
 
     // get min, max, avg & standard deviation:
-    double sum=0, sqrsum=0, avg, stddev=0;
-    float min=0, max=0;
-    for (int i=0; i<m_bms_readings_t; i++)
-      {
-      sum += m_bms_temperatures[i];
-      sqrsum += SQR(m_bms_temperatures[i]);
-      if (min==0 || m_bms_temperatures[i]<min)
-        min = m_bms_temperatures[i];
-      if (max==0 || m_bms_temperatures[i]>max)
-        max = m_bms_temperatures[i];
-      }
-    avg = sum / m_bms_readings_t;
-    stddev = sqrt(LIMIT_MIN((sqrsum / m_bms_readings_t) - SQR(avg), 0));
+    bms_cellstats_t st;
+    BmsCellStats(m_bms_temperatures, m_bms_readings_t, &st);
 
     // check cell deviations:
-    float dev;
-    for (int i=0; i<m_bms_readings_t; i++)
-      {
-      dev = ROUNDPREC(m_bms_temperatures[i] - avg, 2);
-      if (ABS(dev) > ABS(m_bms_tdevmaxs[i]))
-        m_bms_tdevmaxs[i] = dev;
-      if (ABS(dev) >= stddev + thr_alert && m_bms_talerts[i] < 2)
-        {
-        m_bms_talerts[i] = 2;
-        m_bms_talerts_new++; // trigger notification
-        }
-      else if (ABS(dev) >= stddev + thr_warn && m_bms_valerts[i] < 1)
-        m_bms_talerts[i] = 1;
-      }
+    m_bms_talerts_new += BmsCellDeviations(m_bms_temperatures, m_bms_readings_t, &st, 2,
+      thr_warn, thr_alert, m_bms_tdevmaxs, m_bms_talerts);
 
     // publish to metrics:
-    avg = ROUNDPREC(avg, 2);
-    stddev = ROUNDPREC(stddev, 2);
-    StandardMetrics.ms_v_bat_pack_tmin->SetValue(min);
-    StandardMetrics.ms_v_bat_pack_tmax->SetValue(max);
+    float avg = ROUNDPREC(st.avg, 2);
+    float stddev = ROUNDPREC(st.stddev, 2);
+    StandardMetrics.ms_v_bat_pack_tmin->SetValue(st.min);
+    StandardMetrics.ms_v_bat_pack_tmax->SetValue(st.max);
     StandardMetrics.ms_v_bat_pack_tavg->SetValue(avg);
     StandardMetrics.ms_v_bat_pack_tstddev->SetValue(stddev);
     if (stddev > StandardMetrics.ms_v_bat_pack_tstddev_max->AsFloat())
       StandardMetrics.ms_v_bat_pack_tstddev_max->SetValue(stddev);
-    StandardMetrics.ms_v_bat_cell_temp->SetElemValues(0, m_bms_readings_t, m_bms_temperatures);
-    StandardMetrics.ms_v_bat_cell_tmin->SetElemValues(0, m_bms_readings_t, m_bms_tmins);
-    StandardMetrics.ms_v_bat_cell_tmax->SetElemValues(0, m_bms_readings_t, m_bms_tmaxs);
-    StandardMetrics.ms_v_bat_cell_tdevmax->SetElemValues(0, m_bms_readings_t, m_bms_tdevmaxs);
-    StandardMetrics.ms_v_bat_cell_talert->SetElemValues(0, m_bms_readings_t, m_bms_talerts);
+    BmsMetricBatch batch;
+    batch.Store(StandardMetrics.ms_v_bat_cell_temp, m_bms_readings_t, m_bms_temperatures);
+    batch.Store(StandardMetrics.ms_v_bat_cell_tmin, m_bms_readings_t, m_bms_tmins);
+    batch.Store(StandardMetrics.ms_v_bat_cell_tmax, m_bms_readings_t, m_bms_tmaxs);
+    batch.Store(StandardMetrics.ms_v_bat_cell_tdevmax, m_bms_readings_t, m_bms_tdevmaxs);
+    batch.Store(StandardMetrics.ms_v_bat_cell_talert, m_bms_readings_t, m_bms_talerts);
+    batch.Publish();
 
     // complete:
     m_bms_has_temperatures = true;
@@ -365,7 +422,7 @@ void OvmsVehicle::BmsRestartCellVoltages()
 void OvmsVehicle::BmsRestartCellTemperatures()
   {
   m_bms_bitset_t.clear();
-  m_bms_bitset_v.resize(m_bms_readings_t);
+  m_bms_bitset_t.resize(m_bms_readings_t);
   m_bms_bitset_ct = 0;
   }
 
@@ -535,7 +592,7 @@ bool OvmsVehicle::FormatBmsAlerts(int verbosity, OvmsWriter* writer, bool show_w
   // Temperatures:
   // (Note: '°' is not SMS safe, so we only output 'C')
   writer->printf("Temperature: StdDev %.1fC", StdMetrics.ms_v_bat_pack_tstddev_max->AsFloat());
-  for (int i=0; i<m_bms_readings_v; i++)
+  for (int i=0; i<m_bms_readings_t; i++)
     {
     int sts = StdMetrics.ms_v_bat_cell_talert->GetElemValue(i);
     if (sts == 0) continue;
@@ -0,0 +1,176 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+
+#include "dbc_number.h"
+#include "vehicle_pid_decoder.h"
+
+OvmsPidDecoder::OvmsPidDecoder(const char* tag)
+  {
+  m_tag = tag;
+  }
+
+OvmsPidDecoder::~OvmsPidDecoder()
+  {
+  ClearTables();
+  }
+
+/**
+ * AddTable: register the field table of an ECU
+ *  - rxid: the response module id, as set in the poll list
+ *  - fields: table sorted by PID, must stay valid (normally constexpr)
+ *  - target metrics must exist at this point, unknown metrics are logged
+ *    and their fields are decoded without storing the value
+ */
+bool OvmsPidDecoder::AddTable(uint32_t rxid, const char* ecu, const pid_field_t* fields, size_t count)
+  {
+  for (size_t i = 1; i < count; i++)
+    {
+    if (fields[i].pid < fields[i-1].pid)
+      {
+      ESP_LOGE(m_tag, "PID table %s: not sorted at %04x/%s", ecu, fields[i].pid, fields[i].name);
+      return false;
+      }
+    }
+
+  pid_table_t table;
+  table.rxid = rxid;
+  table.ecu = ecu;
+  table.fields = fields;
+  table.count = count;
+  table.metrics = new OvmsMetric*[count];
+  for (size_t i = 0; i < count; i++)
+    {
+    table.metrics[i] = NULL;
+    if (fields[i].metric)
+      {
+      table.metrics[i] = MyMetrics.Find(fields[i].metric);
+      if (!table.metrics[i])
+        ESP_LOGW(m_tag, "PID table %s: %04x/%s: unknown metric '%s'",
+          ecu, fields[i].pid, fields[i].name, fields[i].metric);
+      }
+    }
+  m_tables.push_back(table);
+  return true;
+  }
+
+void OvmsPidDecoder::ClearTables()
+  {
+  for (auto& table : m_tables)
+    delete [] table.metrics;
+  m_tables.clear();
+  }
+
+const OvmsPidDecoder::pid_table_t* OvmsPidDecoder::FindTable(uint32_t rxid)
+  {
+  for (auto& table : m_tables)
+    {
+    if (table.rxid == rxid)
+      return &table;
+    }
+  return NULL;
+  }
+
+/**
+ * Decode: process a complete PID reply
+ *  - rxid: the response module id
+ *  - data, length: reply payload (without the response type & PID)
+ *  Returns the number of fields decoded, 0 if the PID is not in the ECU's
+ *  table, -1 if the reply is too short.
+ */
+int OvmsPidDecoder::Decode(uint32_t rxid, uint16_t pid, const uint8_t* data, size_t length)
+  {
+  const pid_table_t* table = FindTable(rxid);
+  if (!table)
+    return 0;
+
+  // Binary search for the first field of the PID:
+  const pid_field_t* fields = table->fields;
+  size_t lo = 0, hi = table->count;
+  while (lo < hi)
+    {
+    size_t mid = (lo + hi) / 2;
+    if (fields[mid].pid < pid)
+      lo = mid + 1;
+    else
+      hi = mid;
+    }
+  if (lo == table->count || fields[lo].pid != pid)
+    return 0;
+
+  size_t end, minlength = 0;
+  for (end = lo; end < table->count && fields[end].pid == pid; end++)
+    {
+    size_t fieldend = fields[end].offset + PID_FIELD_WIDTH(fields[end].type);
+    if (fieldend > minlength)
+      minlength = fieldend;
+    }
+  if (length < minlength)
+    {
+    ESP_LOGV(m_tag, "%s %04x: received %d bytes, expected %d", table->ecu, pid, (int)length, (int)minlength);
+    return -1;
+    }
+
+  for (size_t i = lo; i < end; i++)
+    {
+    const pid_field_t& field = fields[i];
+    int width = PID_FIELD_WIDTH(field.type);
+
+    uint32_t raw = 0;
+    for (int b = 0; b < width; b++)
+      raw = (raw << 8) | data[field.offset + b];
+
+    dbcNumber value;
+    if (PID_FIELD_SIGNED(field.type))
+      {
+      int shift = 32 - 8*width;
+      value = (int32_t)(raw << shift) >> shift;
+      }
+    else
+      {
+      value = raw;
+      }
+    if (field.scale != 1.0f || field.add != 0.0f)
+      value = (double)((float)value.GetDouble() * field.scale + field.add);
+
+    OvmsMetric* metric = table->metrics[i];
+    if (metric && field.unit != Other && metric->GetUnits() != Other && metric->GetUnits() != field.unit)
+      value = (double)UnitConvert(field.unit, metric->GetUnits(), (float)value.GetDouble());
+
+    ESP_LOGD(m_tag, "%s %04x: %s=%g%s", table->ecu, pid, field.name, value.GetDouble(),
+      OvmsMetricUnitLabel(field.unit));
+
+    if (metric)
+      metric->SetValue(value);
+    }
+
+  return end - lo;
+  }
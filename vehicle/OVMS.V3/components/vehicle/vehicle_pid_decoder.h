@@ -0,0 +1,114 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __VEHICLE_PID_DECODER_H__
+#define __VEHICLE_PID_DECODER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "ovms_metrics.h"
+
+/**
+ * Table driven UDS/OBD PID reply decoder
+ *
+ * A vehicle describes the reply layout of the PIDs it polls by a constant
+ * field table per ECU. Each row extracts one big endian integer from the
+ * reply, scales it (value = raw * scale + add) and optionally stores the
+ * result in a metric. Rows must be sorted by PID, fields of a PID are looked
+ * up by binary search. Use PID_FIELDS_ASSERT_SORTED() on constexpr tables to
+ * verify the order at compile time.
+ *
+ * Replies shorter than the last field of the PID are rejected as a whole.
+ * Fields without a metric are still validated and logged (debug level), so
+ * vehicle code can do custom processing of them after a successful Decode().
+ */
+
+// Field data types: low nibble = byte width, bit 7 = signed
+#define PID_FIELD_UINT8           0x01
+#define PID_FIELD_SINT8           0x81
+#define PID_FIELD_UINT16          0x02
+#define PID_FIELD_SINT16          0x82
+#define PID_FIELD_UINT24          0x03
+#define PID_FIELD_UINT32          0x04
+#define PID_FIELD_SINT32          0x84
+
+#define PID_FIELD_WIDTH(type)     ((type) & 0x0f)
+#define PID_FIELD_SIGNED(type)    ((type) & 0x80)
+
+typedef struct
+  {
+  uint16_t      pid;              // PID the field is returned by
+  uint8_t       offset;           // Byte offset in the reply payload
+  uint8_t       type;             // PID_FIELD_*
+  float         scale;            // value = raw * scale + add
+  float         add;
+  const char*   name;             // Field name for logging
+  metric_unit_t unit;             // Unit of the scaled value
+  const char*   metric;           // Target metric name, NULL = decode only
+  } pid_field_t;
+
+constexpr bool PidFieldsSorted(const pid_field_t* fields, size_t count)
+  {
+  return (count < 2) || ((fields[0].pid <= fields[1].pid) && PidFieldsSorted(fields+1, count-1));
+  }
+
+#define PID_FIELDS_ASSERT_SORTED(table) \
+  static_assert(PidFieldsSorted(table, sizeof(table)/sizeof(table[0])), #table " must be sorted by PID")
+
+class OvmsPidDecoder
+  {
+  public:
+    OvmsPidDecoder(const char* tag);
+    ~OvmsPidDecoder();
+
+  public:
+    bool AddTable(uint32_t rxid, const char* ecu, const pid_field_t* fields, size_t count);
+    void ClearTables();
+    int Decode(uint32_t rxid, uint16_t pid, const uint8_t* data, size_t length);
+
+  protected:
+    typedef struct
+      {
+      uint32_t              rxid;
+      const char*           ecu;
+      const pid_field_t*    fields;
+      size_t                count;
+      OvmsMetric**          metrics;    // Resolved targets, one per field
+      } pid_table_t;
+
+    const pid_table_t* FindTable(uint32_t rxid);
+
+  protected:
+    const char*               m_tag;
+    std::vector<pid_table_t>  m_tables;
+  };
+
+#endif //#ifndef __VEHICLE_PID_DECODER_H__
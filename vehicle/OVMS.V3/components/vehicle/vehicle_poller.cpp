@@ -28,10 +28,11 @@
 ; THE SOFTWARE.
 */
 
-// #include "ovms_log.h"
-// static const char *TAG = "vehicle";
+#include "ovms_log.h"
+static const char *TAG = "vehicle";
 
 #include <stdio.h>
+#include <string.h>
 #include <algorithm>
 #include <ovms_command.h>
 #include <ovms_script.h>
@@ -43,8 +44,21 @@
 #endif // #ifdef CONFIG_OVMS_COMP_WEBSERVER
 #include <ovms_peripherals.h>
 #include <string_writer.h>
+#include "esp_timer.h"
 #include "vehicle.h"
 
+// Channel poller time base [ms]:
+static inline int64_t PollerTime()
+  {
+  return esp_timer_get_time() / 1000;
+  }
+
+// Channel poller schedule heap order: earliest due first, list order on equal due times
+static inline bool PollerSchedLater(const OvmsVehicle::poll_sched_t& a, const OvmsVehicle::poll_sched_t& b)
+  {
+  return (a.due != b.due) ? (a.due > b.due) : (a.index > b.index);
+  }
+
 
 /**
  * PollerStateTicker: check for state changes (stub, override with vehicle implementation)
@@ -90,6 +104,27 @@ void OvmsVehicle::IncomingPollReply(canbus* bus, uint16_t type, uint16_t pid, ui
   }
 
 
+/**
+ * IncomingPollResponse: reassembled poll response handler (stub, override with vehicle implementation)
+ *  This is called instead of IncomingPollReply() if response reassembly has been enabled
+ *  by PollSetReassembly(). The response payload is collected in a pool buffer and delivered
+ *  in one call when complete. In streaming mode, responses longer than the section size
+ *  are delivered in consecutive sections as they arrive.
+ *  
+ *  The data is only valid during the call, copy what you need to keep.
+ *  
+ *  @param reply
+ *    Response (section) descriptor, see poll_reply_t. The response is complete
+ *    if reply.offset + reply.length == reply.total.
+ *  
+ *  @member m_poll_plcur
+ *    Pointer to the currently processed poll entry
+ */
+void OvmsVehicle::IncomingPollResponse(const poll_reply_t& reply)
+  {
+  }
+
+
 /**
  * IncomingPollError: poll response error handler (stub, override with vehicle implementation)
  *  This is called by PollerReceive() on reception of an OBD/UDS Negative Response Code (NRC),
@@ -144,6 +179,7 @@ void OvmsVehicle::IncomingPollTxCallback(canbus* bus, uint32_t txid, uint16_t ty
  *  Call this to install a new polling list or restart the list.
  *  This won't change the polling state; you can change the list while keeping the state.
  *  The list is changed without waiting for pending responses to finish (except PollSingleRequests).
+ *  Channel poller: pending responses are discarded, see PollerBuildSchedule().
  *  
  *  @param bus
  *    CAN bus to use as the default bus (for all poll entries with bus=0) or NULL to stop polling
@@ -154,6 +190,7 @@ void OvmsVehicle::PollSetPidList(canbus* bus, const poll_pid_t* plist)
   {
   OvmsRecMutexLock slock(&m_poll_single_mutex);
   OvmsRecMutexLock lock(&m_poll_mutex);
+  bool changed = (plist != m_poll_plist || bus != m_poll_bus_default);
   m_poll_bus = bus;
   m_poll_bus_default = bus;
   m_poll_plist = plist;
@@ -163,6 +200,103 @@ void OvmsVehicle::PollSetPidList(canbus* bus, const poll_pid_t* plist)
   m_poll_plcur = NULL;
   m_poll_entry = {};
   m_poll_txmsgid = 0;
+  if (changed)
+    PollerResubscribeFrames(plist);
+  PollerBuildSchedule();
+  }
+
+
+/**
+ * PollerSubscribeFrames: add the poll response IDs to the vehicle CAN subscriptions
+ *  Only applies if the vehicle has restricted its frame delivery by SubscribeCanFrames().
+ */
+void OvmsVehicle::PollerSubscribeFrames(const poll_pid_t* plist)
+  {
+  if (!m_subscribedframes || !plist)
+    return;
+  for (const poll_pid_t* p = plist; p->txmoduleid != 0; p++)
+    {
+    canbus* bus = (p->pollbus == 0) ? m_poll_bus_default : GetCanBus(p->pollbus);
+    if (!bus)
+      continue;
+    if (p->protocol == VWTP_20)
+      {
+      // channel setup response & data channel IDs are assigned relative to the base ID:
+      MyCan.SubscribeListener(m_rxqueue, bus, p->txmoduleid, p->txmoduleid + 0x1ff);
+      }
+    else if (p->protocol == ISOTP_EXTADR)
+      {
+      if (p->rxmoduleid != 0)
+        MyCan.SubscribeListener(m_rxqueue, bus, p->rxmoduleid >> 8, p->rxmoduleid >> 8);
+      }
+    else if (p->rxmoduleid != 0)
+      {
+      MyCan.SubscribeListener(m_rxqueue, bus, p->rxmoduleid, p->rxmoduleid);
+      }
+    else
+      {
+      // broadcast:
+      uint32_t txid, rxid_low, rxid_high;
+      PollerBroadcastIds(p->protocol, &txid, &rxid_low, &rxid_high);
+      MyCan.SubscribeListener(m_rxqueue, bus, rxid_low, rxid_high);
+      }
+    }
+  }
+
+
+/**
+ * PollerResubscribeFrames: replace the poll response subscriptions by those of a new list
+ *  The CAN listener cannot remove single subscriptions, so this clears all and restores
+ *  the vehicle subscriptions (see SubscribeCanFrames()) before adding the new list.
+ */
+void OvmsVehicle::PollerResubscribeFrames(const poll_pid_t* plist)
+  {
+  if (!m_subscribedframes)
+    return;
+  MyCan.UnsubscribeListener(m_rxqueue);
+  for (const vehicle_subscription_t &sub : m_subscriptions)
+    {
+    if (sub.mask)
+      MyCan.SubscribeListenerMask(m_rxqueue, sub.bus, sub.id_from, sub.mask);
+    else
+      MyCan.SubscribeListener(m_rxqueue, sub.bus, sub.id_from, sub.id_to);
+    }
+  PollerSubscribeFrames(plist);
+  }
+
+
+/**
+ * PollerBroadcastIds: get the broadcast request & response IDs for a protocol
+ *  ISOTP_EXTFRAME uses the 29 bit functional addressing of ISO 15765-4 (request
+ *  0x18DB33F1, responses 0x18DAF1xx), all others the 11 bit OBD2 IDs 0x7DF / 0x7E8-0x7EF.
+ */
+void OvmsVehicle::PollerBroadcastIds(uint8_t protocol, uint32_t* txid, uint32_t* rxid_low, uint32_t* rxid_high)
+  {
+  if (protocol == ISOTP_EXTFRAME)
+    {
+    *txid = 0x18db33f1;
+    *rxid_low = 0x18daf100;
+    *rxid_high = 0x18daf1ff;
+    }
+  else
+    {
+    *txid = 0x7df;
+    *rxid_low = 0x7e8;
+    *rxid_high = 0x7ef;
+    }
+  }
+
+
+/**
+ * PollerBroadcastResponder: derive the physical request ID of a broadcast responder
+ *  (Note: this only works for the SAE standard ID schemes)
+ */
+uint32_t OvmsVehicle::PollerBroadcastResponder(uint8_t protocol, uint32_t rxid)
+  {
+  if (protocol == ISOTP_EXTFRAME)
+    return 0x18da00f1 | (rxid & 0xff) << 8;
+  else
+    return rxid - 8;
   }
 
 
@@ -188,6 +322,7 @@ void OvmsVehicle::PollSetState(uint8_t state)
     m_poll_plcur = NULL;
     m_poll_entry = {};
     m_poll_txmsgid = 0;
+    PollerBuildSchedule();
     }
   }
 
@@ -250,6 +385,760 @@ void OvmsVehicle::PollSetChannelKeepalive(uint16_t keepalive_seconds)
   }
 
 
+/**
+ * PollSetConcurrency: configure the channel poller
+ *  By default, the poller processes the list sequentially with a single request in flight
+ *  over all buses, stepping through the list once per second. The channel engine instead
+ *  uses an independent ISO-TP/VWTP channel per target (bus, TX ID, protocol), schedules
+ *  the entries by their individual intervals (see poll_pid_t.polltime_ms) and keeps up to
+ *  the given number of requests in flight in parallel.
+ *  
+ *  Response timeouts work like in the sequential poller (see m_poll_wait). The throttling
+ *  limit set by PollSetThrottling() applies per channel. Channels with overlapping response
+ *  ID ranges on the same bus (e.g. broadcasts) are not polled in parallel. All VWTP_20 entries
+ *  share a single channel, as VW gateways only support one open channel.
+ *  
+ *  @param channels
+ *    Max number of requests in flight, 0 = sequential poller (default)
+ *  
+ *  The configuration is kept unchanged over calls to PollSetPidList() or PollSetState().
+ *  The user may override it by config "vehicle poller.concurrency".
+ */
+void OvmsVehicle::PollSetConcurrency(uint8_t channels)
+  {
+  m_poll_concurrency_def = channels;
+  PollerApplyConcurrency();
+  }
+
+
+/**
+ * PollerApplyConcurrency: switch to the configured poller mode
+ *  Config "vehicle poller.concurrency" overrides the vehicle module default if defined.
+ */
+void OvmsVehicle::PollerApplyConcurrency()
+  {
+  int channels = MyConfig.GetParamValueInt("vehicle", "poller.concurrency", m_poll_concurrency_def);
+  if (channels < 0 || channels > 255)
+    channels = m_poll_concurrency_def;
+  OvmsRecMutexLock slock(&m_poll_single_mutex);
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  if (channels == m_poll_concurrency)
+    return;
+  m_poll_concurrency = channels;
+  m_poll_sequence_cnt = 0;
+  m_poll_wait = 0;
+  m_poll_plcur = NULL;
+  m_poll_entry = {};
+  m_poll_txmsgid = 0;
+  if (!m_poll_rxpool.empty())
+    PollerInitRxPool();
+  PollerBuildSchedule();
+  ESP_LOGI(TAG, "Poller: %s mode, %d requests in flight", channels ? "concurrent" : "sequential",
+    std::max(1, channels));
+  }
+
+
+/**
+ * PollSetReassembly: configure poller response reassembly
+ *  By default, response frames are forwarded to IncomingPollReply() as they arrive, and
+ *  the vehicle needs to collect multi frame responses itself. With reassembly enabled, the
+ *  poller collects the response payload in a buffer from a fixed pool (allocated in PSRAM
+ *  once, one buffer per request in flight) and calls IncomingPollResponse() instead.
+ *  
+ *  For very long responses (e.g. cell voltage dumps), a streaming section size can be set.
+ *  Responses longer than this are delivered in sections of at least that size (plus the
+ *  rest of the last frame) as soon as they are available.
+ *  
+ *  @param enable
+ *    true = deliver reassembled responses to IncomingPollResponse()
+ *  @param stream_size
+ *    Streaming section size in bytes (max VEHICLE_POLL_RXBUF_SIZE-8), 0 = complete responses only
+ *  
+ *  The configuration is kept unchanged over calls to PollSetPidList() or PollSetState().
+ */
+void OvmsVehicle::PollSetReassembly(bool enable, uint16_t stream_size /*=0*/)
+  {
+  assert (stream_size <= VEHICLE_POLL_RXBUF_SIZE-8);
+  OvmsRecMutexLock slock(&m_poll_single_mutex);
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  m_poll_rxstream = stream_size;
+  if (!enable)
+    PollerFreeRxPool();
+  else if (m_poll_rxpool.empty())
+    PollerInitRxPool();
+  }
+
+
+/**
+ * PollerInitRxPool: internal: (re)allocate the reassembly buffer pool
+ *  The pool needs one buffer per request in flight.
+ */
+void OvmsVehicle::PollerInitRxPool()
+  {
+  PollerFreeRxPool();
+  int count = std::max<int>(1, m_poll_concurrency);
+  for (int i = 0; i < count; i++)
+    {
+    poll_rxbuf_t rb = {};
+    rb.data = (uint8_t*) ExternalRamMalloc(VEHICLE_POLL_RXBUF_SIZE);
+    if (!rb.data)
+      {
+      ESP_LOGE(TAG, "PollerInitRxPool: out of memory, got %d of %d buffers", i, count);
+      break;
+      }
+    m_poll_rxpool.push_back(rb);
+    }
+  }
+
+
+/**
+ * PollerFreeRxPool: internal: free the reassembly buffer pool & drop all assignments
+ */
+void OvmsVehicle::PollerFreeRxPool()
+  {
+  for (poll_rxbuf_t &rb : m_poll_rxpool)
+    free(rb.data);
+  m_poll_rxpool.clear();
+  m_poll_rxbuf = NULL;
+  for (poll_channel_t &ch : m_poll_channels)
+    ch.rxbuf = NULL;
+  }
+
+
+/**
+ * PollerReleaseRxBuffer: internal: return the buffer of the current request to the pool
+ */
+void OvmsVehicle::PollerReleaseRxBuffer()
+  {
+  if (m_poll_rxbuf)
+    {
+    m_poll_rxbuf->used = false;
+    m_poll_rxbuf = NULL;
+    }
+  }
+
+
+/**
+ * PollerDeliverReply: internal: forward a response frame payload to the application
+ *  Called by the protocol handlers for each valid response frame of the current request,
+ *  with m_poll_ml_frame / m_poll_ml_remain set for the frame. Without reassembly, this
+ *  calls IncomingPollReply(), else the payload is collected & delivered by
+ *  IncomingPollResponse().
+ */
+void OvmsVehicle::PollerDeliverReply(canbus* bus, uint32_t msgid, uint8_t* data, uint16_t length)
+  {
+  if (m_poll_rxpool.empty())
+    {
+    IncomingPollReply(bus, m_poll_type, m_poll_pid, data, length, m_poll_ml_remain);
+    return;
+    }
+
+  if (m_poll_ml_frame == 0)
+    {
+    // New response: assign a buffer
+    if (!m_poll_rxbuf)
+      {
+      for (poll_rxbuf_t &rb : m_poll_rxpool)
+        {
+        if (!rb.used)
+          {
+          rb.used = true;
+          m_poll_rxbuf = &rb;
+          break;
+          }
+        }
+      }
+    if (!m_poll_rxbuf)
+      {
+      ESP_LOGW(TAG, "PollerDeliverReply[%X]: no reassembly buffer available, dropping response %02X(%X)",
+               msgid, m_poll_type, m_poll_pid);
+      m_poll_rxdropped++;
+      return;
+      }
+    m_poll_rxbuf->fill = 0;
+    m_poll_rxbuf->offset = 0;
+    m_poll_rxbuf->total = length + m_poll_ml_remain;
+    }
+  else if (!m_poll_rxbuf)
+    {
+    // response has been dropped
+    return;
+    }
+
+  poll_rxbuf_t* rb = m_poll_rxbuf;
+  if (rb->fill + length > VEHICLE_POLL_RXBUF_SIZE || rb->offset + rb->fill + length > rb->total)
+    {
+    ESP_LOGW(TAG, "PollerDeliverReply[%X]: response %02X(%X) exceeds %u bytes, dropping",
+             msgid, m_poll_type, m_poll_pid, rb->total);
+    m_poll_rxdropped++;
+    PollerReleaseRxBuffer();
+    return;
+    }
+  memcpy(rb->data + rb->fill, data, length);
+  rb->fill += length;
+
+  bool complete = (m_poll_ml_remain == 0);
+  if (complete || (m_poll_rxstream && rb->total > m_poll_rxstream && rb->fill >= m_poll_rxstream))
+    {
+    poll_reply_t reply;
+    reply.bus = bus;
+    reply.moduleid = msgid;
+    reply.type = m_poll_type;
+    reply.pid = m_poll_pid;
+    reply.data = rb->data;
+    reply.length = rb->fill;
+    reply.offset = rb->offset;
+    reply.total = complete ? rb->offset + rb->fill : rb->total;
+    rb->offset += rb->fill;
+    rb->fill = 0;
+    IncomingPollResponse(reply);
+    if (complete)
+      {
+      m_poll_rxdelivered++;
+      PollerReleaseRxBuffer();
+      }
+    }
+  }
+
+
+/**
+ * PollerInterval: internal: get poll interval of a list entry in the current state
+ *  @return           Interval in milliseconds, 0 = entry not active
+ */
+uint32_t OvmsVehicle::PollerInterval(const poll_pid_t* entry)
+  {
+  if (entry->polltime_ms[m_poll_state] > 0)
+    return entry->polltime_ms[m_poll_state];
+  return entry->polltime[m_poll_state] * 1000;
+  }
+
+
+/**
+ * PollerEntryBus: internal: get bus to use for a list entry
+ */
+canbus* OvmsVehicle::PollerEntryBus(const poll_pid_t* entry)
+  {
+  canbus* bus = GetCanBus(entry->pollbus);
+  return bus ? bus : m_poll_bus_default;
+  }
+
+
+/**
+ * PollerBuildSchedule: internal: assign channels & restart the channel poller schedule
+ *  Like the sequential poller, this makes all entries active in the current state due
+ *  immediately, and drops pending requests. Channels are kept for the statistics.
+ *  A dropped ISO-TP request keeps its channel (and overlapping channels) blocked until
+ *  the response arrives (it's discarded then) or times out, so a late response cannot
+ *  be taken for the response to a request of the new list.
+ */
+void OvmsVehicle::PollerBuildSchedule()
+  {
+  m_poll_chcur = NULL;
+  m_poll_sched.clear();
+  m_poll_entry_ch.clear();
+
+  for (poll_rxbuf_t &rb : m_poll_rxpool)
+    rb.used = false;
+  m_poll_rxbuf = NULL;
+
+  int discarded = 0;
+  for (poll_channel_t &ch : m_poll_channels)
+    {
+    poll_channel_t reset = {};
+    reset.bus = ch.bus;
+    reset.txmoduleid = ch.txmoduleid;
+    reset.protocol = ch.protocol;
+    reset.rxid_low = UINT32_MAX;
+    reset.stats = ch.stats;
+    if (ch.wait > 0 && ch.protocol != VWTP_20)
+      {
+      reset.discard = true;
+      reset.wait = ch.wait;
+      reset.moduleid_sent = ch.moduleid_sent;
+      reset.moduleid_low = reset.rxid_low = ch.moduleid_low;
+      reset.moduleid_high = reset.rxid_high = ch.moduleid_high;
+      reset.txmsgid = ch.txmsgid;
+      discarded++;
+      }
+    ch = reset;
+    }
+  if (discarded)
+    ESP_LOGD(TAG, "PollerBuildSchedule: discarding %d pending request(s)", discarded);
+
+  if (!m_poll_concurrency || !m_poll_plist)
+    {
+    m_poll_sched_due = INT64_MAX;
+    return;
+    }
+
+  int64_t now = PollerTime();
+  if (!m_poll_stats_start)
+    m_poll_stats_start = now;
+
+  for (const poll_pid_t* p = m_poll_plist; p->txmoduleid != 0; p++)
+    {
+    // Get channel key & response ID range of the entry:
+    canbus* bus = PollerEntryBus(p);
+    uint32_t txmoduleid, rxid_low, rxid_high;
+    if (p->protocol == VWTP_20)
+      {
+      txmoduleid = 0;
+      rxid_low = rxid_high = 0;
+      }
+    else if (p->rxmoduleid != 0)
+      {
+      txmoduleid = p->txmoduleid;
+      rxid_low = rxid_high = p->rxmoduleid;
+      }
+    else
+      {
+      PollerBroadcastIds(p->protocol, &txmoduleid, &rxid_low, &rxid_high);
+      }
+
+    // Find or add channel:
+    size_t ci;
+    for (ci = 0; ci < m_poll_channels.size(); ci++)
+      {
+      poll_channel_t &ch = m_poll_channels[ci];
+      if (ch.protocol == p->protocol &&
+          (ch.protocol == VWTP_20 || (ch.bus == bus && ch.txmoduleid == txmoduleid)))
+        break;
+      }
+    if (ci == m_poll_channels.size())
+      {
+      poll_channel_t ch = {};
+      ch.bus = bus;
+      ch.txmoduleid = txmoduleid;
+      ch.protocol = p->protocol;
+      ch.rxid_low = UINT32_MAX;
+      m_poll_channels.push_back(ch);
+      }
+
+    poll_channel_t &ch = m_poll_channels[ci];
+    ch.entries++;
+    if (rxid_low < ch.rxid_low) ch.rxid_low = rxid_low;
+    if (rxid_high > ch.rxid_high) ch.rxid_high = rxid_high;
+    m_poll_entry_ch.push_back(ci);
+
+    if (PollerInterval(p) > 0)
+      m_poll_sched.push_back({ now, (uint16_t)(p - m_poll_plist) });
+    }
+
+  std::make_heap(m_poll_sched.begin(), m_poll_sched.end(), PollerSchedLater);
+  m_poll_sched_due = now;
+  }
+
+
+/**
+ * PollerLoadChannel: internal: swap channel request state into the m_poll_* members
+ *  This allows the protocol handlers to process the channel request like a sequential poll.
+ */
+void OvmsVehicle::PollerLoadChannel(poll_channel_t* channel)
+  {
+  m_poll_chcur = channel;
+  m_poll_bus = channel->bus;
+  m_poll_protocol = channel->protocol;
+  m_poll_plcur = channel->plcur;
+  m_poll_entry = channel->entry;
+  m_poll_moduleid_sent = channel->moduleid_sent;
+  m_poll_moduleid_low = channel->moduleid_low;
+  m_poll_moduleid_high = channel->moduleid_high;
+  m_poll_type = channel->type;
+  m_poll_pid = channel->pid;
+  m_poll_tx_data = channel->tx_data;
+  m_poll_tx_remain = channel->tx_remain;
+  m_poll_tx_offset = channel->tx_offset;
+  m_poll_tx_frame = channel->tx_frame;
+  m_poll_ml_remain = channel->ml_remain;
+  m_poll_ml_offset = channel->ml_offset;
+  m_poll_ml_frame = channel->ml_frame;
+  m_poll_wait = channel->wait;
+  m_poll_rxbuf = channel->rxbuf;
+  m_poll_txmsgid = channel->txmsgid;
+  }
+
+
+/**
+ * PollerSaveChannel: internal: store the m_poll_* request state back into the loaded channel
+ *  Updates the channel statistics if the pending request has been completed.
+ *  
+ *  @param timeout      true = the request has been abandoned by the ticker
+ */
+void OvmsVehicle::PollerSaveChannel(bool timeout /*=false*/)
+  {
+  poll_channel_t* channel = m_poll_chcur;
+  if (!channel)
+    return;
+  m_poll_chcur = NULL;
+
+  channel->bus = m_poll_bus;
+  channel->plcur = m_poll_plcur;
+  channel->entry = m_poll_entry;
+  channel->moduleid_sent = m_poll_moduleid_sent;
+  channel->moduleid_low = m_poll_moduleid_low;
+  channel->moduleid_high = m_poll_moduleid_high;
+  channel->type = m_poll_type;
+  channel->pid = m_poll_pid;
+  channel->tx_data = m_poll_tx_data;
+  channel->tx_remain = m_poll_tx_remain;
+  channel->tx_offset = m_poll_tx_offset;
+  channel->tx_frame = m_poll_tx_frame;
+  channel->ml_remain = m_poll_ml_remain;
+  channel->ml_offset = m_poll_ml_offset;
+  channel->ml_frame = m_poll_ml_frame;
+  channel->wait = m_poll_wait;
+  channel->rxbuf = m_poll_rxbuf;
+  channel->txmsgid = m_poll_txmsgid;
+
+  // Release the reassembly buffer of a finished or abandoned request:
+  if (channel->wait == 0 && channel->rxbuf)
+    {
+    channel->rxbuf->used = false;
+    channel->rxbuf = NULL;
+    }
+
+  if (channel->wait == 0 && channel->sent_time != 0)
+    {
+    if (timeout)
+      {
+      channel->stats.timeouts++;
+      }
+    else
+      {
+      uint32_t latency = PollerTime() - channel->sent_time;
+      channel->stats.responses++;
+      channel->stats.latency_sum += latency;
+      if (latency > channel->stats.latency_max)
+        channel->stats.latency_max = latency;
+      }
+    channel->sent_time = 0;
+    }
+
+  m_poll_wait = 0;
+  m_poll_rxbuf = NULL;
+  }
+
+
+/**
+ * PollerChannelBlocked: internal: check for a busy channel with overlapping response IDs
+ *  Responses can only be assigned unambiguously if the response ID ranges of the channels
+ *  polled in parallel on a bus are disjunct.
+ */
+bool OvmsVehicle::PollerChannelBlocked(const poll_channel_t* channel)
+  {
+  if (channel->protocol == VWTP_20)
+    return false;
+  for (const poll_channel_t &ch : m_poll_channels)
+    {
+    if (&ch == channel || ch.wait == 0 || ch.bus != channel->bus || ch.protocol == VWTP_20)
+      continue;
+    if (ch.rxid_low <= channel->rxid_high && channel->rxid_low <= ch.rxid_high)
+      return true;
+    }
+  return false;
+  }
+
+
+/**
+ * PollerChannelStart: internal: send list entry request on a channel
+ */
+void OvmsVehicle::PollerChannelStart(poll_channel_t* channel, const poll_pid_t* entry, bool fromTicker)
+  {
+  PollerLoadChannel(channel);
+  m_poll_bus = PollerEntryBus(entry);
+  m_poll_plcur = entry;
+  m_poll_entry = *entry;
+  m_poll_type = entry->type;
+  m_poll_pid = entry->pid;
+
+  channel->seqcnt++;
+  channel->sent_time = PollerTime();
+  channel->stats.requests++;
+
+  // Dispatch transmission start to protocol handler:
+  if (m_poll_protocol == VWTP_20)
+    PollerVWTPStart(fromTicker);
+  else
+    PollerISOTPStart(fromTicker);
+
+  m_poll_plcur++;
+  PollerSaveChannel();
+  }
+
+
+/**
+ * PollerChannelTicker: internal: per second channel maintenance
+ *  Resets the throttling counters and checks the response timeouts.
+ */
+void OvmsVehicle::PollerChannelTicker()
+  {
+  for (poll_channel_t &ch : m_poll_channels)
+    {
+    ch.seqcnt = 0;
+    if (ch.protocol == VWTP_20)
+      {
+      PollerLoadChannel(&ch);
+      bool expired = (m_poll_wait > 0 && --m_poll_wait == 0);
+      PollerVWTPTicker();
+      PollerSaveChannel(expired);
+      }
+    else if (ch.wait > 0 && --ch.wait == 0)
+      {
+      ch.discard = false;
+      if (ch.rxbuf)
+        {
+        ch.rxbuf->used = false;
+        ch.rxbuf = NULL;
+        }
+      if (ch.sent_time != 0)
+        {
+        ch.stats.timeouts++;
+        ch.sent_time = 0;
+        }
+      }
+    }
+  }
+
+
+/**
+ * PollerChannelReceive: internal: forward frame to the channel expecting it
+ *  @return           true if the frame has been processed by a channel
+ */
+bool OvmsVehicle::PollerChannelReceive(CAN_frame_t* frame)
+  {
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  poll_channel_t* channel = NULL;
+  uint32_t msgid = frame->MsgID;
+
+  if (frame->origin == m_poll_vwtp.bus && frame->MsgID == m_poll_vwtp.rxid)
+    {
+    for (poll_channel_t &ch : m_poll_channels)
+      {
+      if (ch.protocol == VWTP_20)
+        {
+        channel = &ch;
+        break;
+        }
+      }
+    }
+  else
+    {
+    for (poll_channel_t &ch : m_poll_channels)
+      {
+      if (ch.wait == 0 || ch.bus != frame->origin || ch.protocol == VWTP_20)
+        continue;
+      if (ch.protocol == ISOTP_EXTADR)
+        msgid = frame->MsgID << 8 | frame->data.u8[0];
+      else
+        msgid = frame->MsgID;
+      if (msgid >= ch.moduleid_low && msgid <= ch.moduleid_high)
+        {
+        channel = &ch;
+        break;
+        }
+      }
+    }
+
+  if (!channel)
+    return false;
+
+  // Response to a request of a replaced list: drop & free the channel:
+  if (channel->discard)
+    {
+    channel->stats.rxframes++;
+    channel->wait = 0;
+    channel->discard = false;
+    PollerSchedule(false);
+    return true;
+    }
+
+  PollerLoadChannel(channel);
+  channel->stats.rxframes++;
+  if (m_poll_protocol == VWTP_20)
+    PollerVWTPReceive(frame, msgid);
+  else
+    PollerISOTPReceive(frame, msgid);
+  PollerSaveChannel();
+
+  // Send next request(s) due, e.g. for the channel just freed:
+  PollerSchedule(false);
+  return true;
+  }
+
+
+/**
+ * PollerSchedule: internal: start channel poller requests due
+ */
+void OvmsVehicle::PollerSchedule(bool fromTicker)
+  {
+  if (!m_poll_bus_default || !m_poll_plist || m_poll_sched.empty())
+    {
+    m_poll_sched_due = INT64_MAX;
+    return;
+    }
+
+  int64_t now = PollerTime();
+  int busy = 0;
+  for (const poll_channel_t &ch : m_poll_channels)
+    {
+    if (ch.wait > 0) busy++;
+    }
+
+  m_poll_deferred.clear();
+  while (!m_poll_sched.empty() && m_poll_sched.front().due <= now && busy < m_poll_concurrency)
+    {
+    std::pop_heap(m_poll_sched.begin(), m_poll_sched.end(), PollerSchedLater);
+    poll_sched_t item = m_poll_sched.back();
+    m_poll_sched.pop_back();
+
+    const poll_pid_t* entry = m_poll_plist + item.index;
+    poll_channel_t* channel = &m_poll_channels[m_poll_entry_ch[item.index]];
+    if (channel->wait > 0 ||
+        (m_poll_sequence_max && channel->seqcnt >= m_poll_sequence_max) ||
+        PollerChannelBlocked(channel))
+      {
+      // Channel not available, keep the entry due:
+      m_poll_deferred.push_back(item);
+      continue;
+      }
+
+    PollerChannelStart(channel, entry, fromTicker);
+    if (channel->wait > 0) busy++;
+
+    // Schedule next poll, skip intervals missed:
+    uint32_t interval = PollerInterval(entry);
+    item.due += interval;
+    if (item.due <= now)
+      item.due = now + interval;
+    m_poll_sched.push_back(item);
+    std::push_heap(m_poll_sched.begin(), m_poll_sched.end(), PollerSchedLater);
+    }
+
+  for (const poll_sched_t &item : m_poll_deferred)
+    {
+    m_poll_sched.push_back(item);
+    std::push_heap(m_poll_sched.begin(), m_poll_sched.end(), PollerSchedLater);
+    }
+  m_poll_deferred.clear();
+
+  // Next run: when the next entry is due, or if entries are waiting for their channel,
+  // check again shortly (channels may also be freed by TX failures):
+  if (m_poll_sched.empty())
+    m_poll_sched_due = INT64_MAX;
+  else if (m_poll_sched.front().due <= now)
+    m_poll_sched_due = now + 100;
+  else
+    m_poll_sched_due = m_poll_sched.front().due;
+  }
+
+
+/**
+ * PollerScheduleDelay: internal: get time until the next channel poller schedule run
+ *  @return           Ticks to wait (max 1 second), 0 = run now
+ */
+TickType_t OvmsVehicle::PollerScheduleDelay()
+  {
+  int64_t delay = m_poll_sched_due - PollerTime();
+  if (delay <= 0)
+    return 0;
+  TickType_t ticks = pdMS_TO_TICKS(std::min<int64_t>(delay, 1000));
+  return (ticks > 0) ? ticks : 1;
+  }
+
+
+/**
+ * PollerRxPoolStatus: internal: output reassembly buffer usage
+ */
+void OvmsVehicle::PollerRxPoolStatus(OvmsWriter* writer)
+  {
+  if (m_poll_rxpool.empty())
+    {
+    writer->puts("Reassembly: off");
+    return;
+    }
+  int used = 0;
+  for (const poll_rxbuf_t &rb : m_poll_rxpool)
+    {
+    if (rb.used) used++;
+    }
+  writer->printf("Reassembly: %u buffers, %d in use, stream size %u, %u responses delivered, %u dropped\n",
+    (unsigned)m_poll_rxpool.size(), used, m_poll_rxstream, m_poll_rxdelivered, m_poll_rxdropped);
+  }
+
+
+/**
+ * PollerStatus: output poller mode & channel statistics
+ */
+void OvmsVehicle::PollerStatus(int verbosity, OvmsWriter* writer)
+  {
+  OvmsRecMutexLock lock(&m_poll_mutex);
+
+  if (!m_poll_concurrency)
+    {
+    writer->printf("Poller: sequential, state %u, %s\n", m_poll_state,
+      (m_poll_plist && m_poll_bus_default) ? "list active" : "no list");
+    PollerRxPoolStatus(writer);
+    writer->puts("Channel statistics are only available in concurrent mode.");
+    return;
+    }
+
+  int busy = 0;
+  for (const poll_channel_t &ch : m_poll_channels)
+    {
+    if (ch.wait > 0) busy++;
+    }
+  writer->printf("Poller: concurrent, state %u, %d/%u requests in flight, %u entries scheduled\n",
+    m_poll_state, busy, m_poll_concurrency, (unsigned)m_poll_sched.size());
+  PollerRxPoolStatus(writer);
+  if (m_poll_channels.empty())
+    return;
+
+  uint32_t secs = (PollerTime() - m_poll_stats_start) / 1000;
+  writer->printf("Channel statistics for %u seconds:\n", secs);
+  writer->printf("%-4s %-9s %-8s %4s %8s %8s %8s %6s %8s %7s %7s %7s\n",
+    "Bus", "Protocol", "TX ID", "Busy", "Requests", "Response", "Timeouts", "TXfail",
+    "Frames", "Avg ms", "Max ms", "Resp/s");
+
+  for (const poll_channel_t &ch : m_poll_channels)
+    {
+    const char* protocol;
+    char txid[12];
+    switch (ch.protocol)
+      {
+      case ISOTP_STD:       protocol = "ISOTP"; break;
+      case ISOTP_EXTADR:    protocol = "ISOTP-EA"; break;
+      case ISOTP_EXTFRAME:  protocol = "ISOTP-EF"; break;
+      case VWTP_20:         protocol = "VWTP20"; break;
+      default:              protocol = "?"; break;
+      }
+    if (ch.protocol == VWTP_20)
+      strcpy(txid, "-");
+    else
+      snprintf(txid, sizeof(txid), "%03x", ch.txmoduleid);
+    writer->printf("%-4s %-9s %-8s %4s %8u %8u %8u %6u %8u %7u %7u %7.1f\n",
+      ch.bus ? ch.bus->GetName() : "-", protocol, txid, (ch.wait > 0) ? "yes" : "no",
+      ch.stats.requests, ch.stats.responses, ch.stats.timeouts, ch.stats.txfails, ch.stats.rxframes,
+      ch.stats.responses ? (uint32_t)(ch.stats.latency_sum / ch.stats.responses) : 0,
+      ch.stats.latency_max,
+      secs ? (float)ch.stats.responses / secs : 0.0f);
+    }
+  }
+
+
+/**
+ * PollerResetStats: reset channel statistics
+ */
+void OvmsVehicle::PollerResetStats()
+  {
+  OvmsRecMutexLock lock(&m_poll_mutex);
+  for (poll_channel_t &ch : m_poll_channels)
+    ch.stats = {};
+  m_poll_rxdelivered = 0;
+  m_poll_rxdropped = 0;
+  m_poll_stats_start = PollerTime();
+  }
+
+
 /**
  * PollerSend: internal: start next due request
  */
@@ -257,6 +1146,18 @@ void OvmsVehicle::PollerSend(bool fromTicker)
   {
   OvmsRecMutexLock lock(&m_poll_mutex);
 
+  // Channel poller: check timeouts & run the scheduler. Calls by the protocol
+  // handlers during channel processing are deferred until the channel is saved.
+  if (m_poll_concurrency)
+    {
+    if (m_poll_chcur)
+      return;
+    if (fromTicker)
+      PollerChannelTicker();
+    PollerSchedule(fromTicker);
+    return;
+    }
+
   // ESP_LOGD(TAG, "PollerSend(%d): entry at[type=%02X, pid=%X], ticker=%u, wait=%u, cnt=%u/%u",
   //          fromTicker, m_poll_plcur->type, m_poll_plcur->pid,
   //          m_poll_ticker, m_poll_wait, m_poll_sequence_cnt, m_poll_sequence_max);
@@ -339,6 +1240,33 @@ void OvmsVehicle::PollerTxCallback(const CAN_frame_t* frame, bool success)
   {
   OvmsRecMutexLock lock(&m_poll_mutex);
 
+  // Channel poller: process in the context of the channel that sent the frame
+  // (ISOTP_EXTADR channels share the TX ID, the ECU address is the first data byte):
+  if (m_poll_concurrency && !m_poll_chcur)
+    {
+    for (poll_channel_t &ch : m_poll_channels)
+      {
+      if (ch.wait > 0 && ch.bus == frame->origin && ch.txmsgid == frame->MsgID &&
+          (ch.protocol != ISOTP_EXTADR || frame->data.u8[0] == (ch.moduleid_sent & 0xff)))
+        {
+        if (ch.discard)
+          {
+          if (!success)
+            {
+            ch.wait = 0;
+            ch.discard = false;
+            }
+          break;
+          }
+        PollerLoadChannel(&ch);
+        PollerTxCallback(frame, success);
+        PollerSaveChannel();
+        break;
+        }
+      }
+    return;
+    }
+
   // Check for a late callback:
   if (!m_poll_wait || !m_poll_plist || frame->origin != m_poll_bus || frame->MsgID != m_poll_txmsgid)
     return;
@@ -351,6 +1279,11 @@ void OvmsVehicle::PollerTxCallback(const CAN_frame_t* frame, bool success)
   if (!success)
     {
     m_poll_wait = 0;
+    if (m_poll_chcur)
+      {
+      m_poll_chcur->stats.txfails++;
+      m_poll_chcur->sent_time = 0;
+      }
     if (m_poll_single_rxbuf)
       {
       m_poll_single_rxerr = POLLSINGLE_TXFAILURE;
@@ -409,7 +1342,7 @@ int OvmsVehicle::PollSingleRequest(canbus* bus, uint32_t txid, uint32_t rxid,
   if (!m_registeredlistener)
     {
     m_registeredlistener = true;
-    MyCan.RegisterListener(m_rxqueue);
+    MyCan.RegisterListener(m_rxqueue, false, "vehicle");
     }
 
   OvmsRecMutexLock slock(&m_poll_single_mutex, pdMS_TO_TICKS(timeout_ms));
@@ -457,12 +1390,14 @@ int OvmsVehicle::PollSingleRequest(canbus* bus, uint32_t txid, uint32_t rxid,
   const poll_pid_t* p_list   = m_poll_plist;
   const poll_pid_t* p_plcur  = m_poll_plcur;
   uint32_t          p_ticker = m_poll_ticker;
+  std::vector<poll_sched_t> p_sched = m_poll_sched;
 
   // start single poll:
   PollSetPidList(bus, poll);
   m_poll_single_rxdone.Take(0);
   m_poll_single_rxbuf = &response;
-  PollerSend(true);
+  // Channel poller: don't tick the timeouts & throttling of the other channels:
+  PollerSend(!m_poll_concurrency);
   m_poll_mutex.Unlock();
 
   // wait for response:
@@ -474,6 +1409,11 @@ int OvmsVehicle::PollSingleRequest(canbus* bus, uint32_t txid, uint32_t rxid,
   m_poll_plcur = p_plcur;
   m_poll_ticker = p_ticker;
   m_poll_single_rxbuf = NULL;
+  if (m_poll_concurrency)
+    {
+    m_poll_sched = p_sched;
+    PollerSchedule(false);
+    }
   m_poll_mutex.Unlock();
 
   return (rxok == pdFALSE) ? -1 : m_poll_single_rxerr;
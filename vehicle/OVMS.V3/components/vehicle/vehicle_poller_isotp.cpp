@@ -51,10 +51,8 @@ void OvmsVehicle::PollerISOTPStart(bool fromTicker)
     }
   else
     {
-    // broadcast: send to 0x7df, listen to all responses:
-    m_poll_moduleid_sent = 0x7df;
-    m_poll_moduleid_low = 0x7e8;
-    m_poll_moduleid_high = 0x7ef;
+    // broadcast: send to 0x7df / 0x18db33f1, listen to all responses:
+    PollerBroadcastIds(m_poll_protocol, &m_poll_moduleid_sent, &m_poll_moduleid_low, &m_poll_moduleid_high);
     }
 
   ESP_LOGD(TAG, "PollerISOTPStart(%d): send [bus=%d, type=%02X, pid=%X], expecting %03x/%03x-%03x",
@@ -164,6 +162,7 @@ void OvmsVehicle::PollerISOTPStart(bool fromTicker)
   m_poll_ml_frame = 0;
   m_poll_ml_offset = 0;
   m_poll_ml_remain = 0;
+  PollerReleaseRxBuffer();
   m_poll_wait = 2;
 
   m_poll_bus->Write(&txframe);
@@ -291,11 +290,10 @@ bool OvmsVehicle::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       else
         tx_frame.FIR.B.FF = CAN_frame_std;
 
-      if (m_poll_moduleid_sent == 0x7df)
+      if (m_poll_moduleid_low != m_poll_moduleid_high)
         {
         // broadcast request: derive module ID from response ID:
-        // (Note: this only works for the SAE standard ID scheme)
-        txid = frame->MsgID - 8;
+        txid = PollerBroadcastResponder(m_poll_protocol, frame->MsgID);
         }
       else
         {
@@ -479,7 +477,7 @@ bool OvmsVehicle::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       }
     else
       {
-      IncomingPollReply(frame->origin, m_poll_type, m_poll_pid, response_data, response_datalen, m_poll_ml_remain);
+      PollerDeliverReply(frame->origin, msgid, response_data, response_datalen);
       }
     }
   else
@@ -511,11 +509,10 @@ bool OvmsVehicle::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       else
         txframe.FIR.B.FF = CAN_frame_std;
 
-      if (m_poll_moduleid_sent == 0x7df)
+      if (m_poll_moduleid_low != m_poll_moduleid_high)
         {
         // broadcast request: derive module ID from response ID:
-        // (Note: this only works for the SAE standard ID scheme)
-        txid = frame->MsgID - 8;
+        txid = PollerBroadcastResponder(m_poll_protocol, frame->MsgID);
         }
       else
         {
@@ -561,7 +558,7 @@ bool OvmsVehicle::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
   // - the poll was no broadcast (with potential further responses from other devices)
   // - poll throttling is unlimited or limit isn't reached yet
   if (m_poll_wait == 0 &&
-      m_poll_moduleid_sent != 0x7df &&
+      m_poll_moduleid_low == m_poll_moduleid_high &&
       (!m_poll_sequence_max || m_poll_sequence_cnt < m_poll_sequence_max))
     {
     PollerSend(false);
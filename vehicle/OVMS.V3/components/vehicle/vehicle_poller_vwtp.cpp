@@ -232,6 +232,7 @@ void OvmsVehicle::PollerVWTPEnter(vwtp_channelstate_t state)
       m_poll_ml_frame = 0;
       m_poll_ml_offset = 0;
       m_poll_ml_remain = 0;
+      PollerReleaseRxBuffer();
 
       // fall through to VWTP_Transmit
       }
@@ -744,7 +745,7 @@ bool OvmsVehicle::PollerVWTPReceive(CAN_frame_t* frame, uint32_t msgid)
             }
           else
             {
-            IncomingPollReply(frame->origin, m_poll_type, m_poll_pid, response_data, response_datalen, m_poll_ml_remain);
+            PollerDeliverReply(frame->origin, m_poll_vwtp.moduleid, response_data, response_datalen);
             }
           }
         else
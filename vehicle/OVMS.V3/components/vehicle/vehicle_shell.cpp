@@ -431,6 +431,62 @@ void OvmsVehicleFactory::vehicle_stat_trip(int verbosity, OvmsWriter* writer, Ov
     }
   }
 
+void OvmsVehicleFactory::vehicle_poller_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (MyVehicleFactory.m_currentvehicle != NULL)
+    {
+    MyVehicleFactory.m_currentvehicle->PollerStatus(verbosity, writer);
+    }
+  else
+    {
+    writer->puts("No vehicle module selected");
+    }
+  }
+
+void OvmsVehicleFactory::vehicle_poller_reset(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (MyVehicleFactory.m_currentvehicle != NULL)
+    {
+    MyVehicleFactory.m_currentvehicle->PollerResetStats();
+    writer->puts("Poller channel statistics have been reset.");
+    }
+  else
+    {
+    writer->puts("No vehicle module selected");
+    }
+  }
+
+void OvmsVehicleFactory::vehicle_poller_concurrency(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (argc == 1)
+    {
+    if (strcmp(argv[0], "default") == 0)
+      {
+      MyConfig.DeleteInstance("vehicle", "poller.concurrency");
+      }
+    else
+      {
+      char* ep;
+      long channels = strtol(argv[0], &ep, 10);
+      if (*ep || channels < 0 || channels > 255)
+        {
+        writer->puts("ERROR: invalid channel count, must be 0…255 or 'default'");
+        return;
+        }
+      MyConfig.SetParamValueInt("vehicle", "poller.concurrency", channels);
+      }
+    }
+
+  if (MyVehicleFactory.m_currentvehicle != NULL)
+    {
+    MyVehicleFactory.m_currentvehicle->PollerStatus(0, writer);
+    }
+  else
+    {
+    writer->puts("No vehicle module selected");
+    }
+  }
+
 void OvmsVehicleFactory::bms_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   if (MyVehicleFactory.m_currentvehicle != NULL)
@@ -0,0 +1,1714 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/bdc.json: BDC 40: Body domain controller
+// This generated code  makes it easier to process CANBUS messages from the BDC ecu in a BMW i3
+//
+
+// 0x0F27 I3_PID_BDC_PIA_NR_AKTUELL
+#define I3_FLD_BDC_STAT_PIA_NR_AKTUELL                           I3_PID_BDC_PIA_NR_AKTUELL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_NR_AKTUELL"
+
+// 0xA093 I3_PID_BDC_HOD_KALIBRIERUNG
+
+// 0xA099 I3_PID_BDC_BATTERIEVORSCHAEDIGUNGSHISTORIE
+
+// 0xA118 I3_PID_BDC_WISCHER_LIN_EINLERNVORGANG
+#define I3_FLD_BDC_STAT_ROUTINE                                  I3_PID_BDC_WISCHER_LIN_EINLERNVORGANG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE"
+#define I3_FLD_BDC_STAT_WISCHER_LIN_EINLERNVORGANG               I3_PID_BDC_WISCHER_LIN_EINLERNVORGANG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WISCHER_LIN_EINLERNVORGANG"
+
+// 0xA322 I3_PID_BDC_AUSSENSPIEGEL_SELBSTTEST
+#define I3_FLD_BDC_STAT_SELBSTTEST_NR                            I3_PID_BDC_AUSSENSPIEGEL_SELBSTTEST, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_SELBSTTEST_NR"
+#define I3_FLD_BDC_STAT_SELBSTTEST_FC_NR                         I3_PID_BDC_AUSSENSPIEGEL_SELBSTTEST, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_SELBSTTEST_FC_NR"
+
+// 0xA3B7 I3_PID_BDC_REGENSENSOR_INITIALISIERUNG
+#define I3_FLD_BDC_STAT_REGENSENSOR_INIT_VORGANG_NR              I3_PID_BDC_REGENSENSOR_INITIALISIERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REGENSENSOR_INIT_VORGANG_NR"
+
+// 0xA530 I3_PID_BDC_LEUCHTEN_KALTUEBERWACHUNG
+#define I3_FLD_BDC_STAT_KALTUEBERWACHUNG_NR                      I3_PID_BDC_LEUCHTEN_KALTUEBERWACHUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KALTUEBERWACHUNG_NR"
+
+// 0xA531 I3_PID_BDC_LEUCHTEN_WARMUEBERWACHUNG
+#define I3_FLD_BDC_STAT_WARMUEBERWACHUNG_NR                      I3_PID_BDC_LEUCHTEN_WARMUEBERWACHUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WARMUEBERWACHUNG_NR"
+
+// 0xA532 I3_PID_BDC_HOEHENSTAENDE_OFFSET_RESET
+
+// 0xA71A I3_PID_BDC_GURTZUBRINGER_INIT
+#define I3_FLD_BDC_STAT_ROUTINE_FA_NR                            I3_PID_BDC_GURTZUBRINGER_INIT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_FA_NR"
+#define I3_FLD_BDC_STAT_ROUTINE_BF_NR                            I3_PID_BDC_GURTZUBRINGER_INIT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_BF_NR"
+
+// 0xA838 I3_PID_BDC_LIN_AUTOADRESSIERUNG
+
+// 0xAA73 I3_PID_BDC_ELV_ANLIEFERZUSTAND
+#define I3_FLD_BDC_STAT_ELV_ANLIEFERZUSTAND                      I3_PID_BDC_ELV_ANLIEFERZUSTAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ELV_ANLIEFERZUSTAND"
+
+// 0xAA80 I3_PID_BDC_SMO_SIMULATION_BEDIENUNG
+#define I3_FLD_BDC_STAT_AUSFUEHRUNGSSTATUS                       I3_PID_BDC_SMO_SIMULATION_BEDIENUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUSFUEHRUNGSSTATUS"
+
+// 0xAC54 I3_PID_BDC_STEUERN_CA_BROADCAST
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM1                             I3_PID_BDC_STEUERN_CA_BROADCAST, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM1"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM2                             I3_PID_BDC_STEUERN_CA_BROADCAST, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM2"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM3                             I3_PID_BDC_STEUERN_CA_BROADCAST, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM3"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM4                             I3_PID_BDC_STEUERN_CA_BROADCAST, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM4"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM5                             I3_PID_BDC_STEUERN_CA_BROADCAST, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM5"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM6                             I3_PID_BDC_STEUERN_CA_BROADCAST, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM6"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM7                             I3_PID_BDC_STEUERN_CA_BROADCAST, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM7"
+#define I3_FLD_BDC_STAT_CA_SCHL_NUM8                             I3_PID_BDC_STEUERN_CA_BROADCAST, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_SCHL_NUM8"
+
+// 0xAC55 I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_TEST_OKAY                    I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_TEST_OKAY"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_1                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_1"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_2                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_2"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_3                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_3"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_4                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_4"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_5                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_5"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_6                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_6"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_7                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_7"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_VERBAUORT_8                  I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_VERBAUORT_8"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_1                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_1"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_2                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_2"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_3                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_3"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_4                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_4"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_5                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_5"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_6                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_6"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_7                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_7"
+#define I3_FLD_BDC_STAT_CA_ANTENNEN_STATUS_8                     I3_PID_BDC_STEUERN_CA_ANTENNEN_TEST, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CA_ANTENNEN_STATUS_8"
+
+// 0xAC58 I3_PID_BDC_STEUERN_FBD_EMPFAENGER_INIT
+#define I3_FLD_BDC_STAT_FBD_EMPFAENGER_INIT                      I3_PID_BDC_STEUERN_FBD_EMPFAENGER_INIT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FBD_EMPFAENGER_INIT"
+
+// 0xAC5D I3_PID_BDC_FBD_REICHWEITENMESSUNG
+#define I3_FLD_BDC_STAT_REICHWEITENMESSUNG_AKTIV                 I3_PID_BDC_FBD_REICHWEITENMESSUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REICHWEITENMESSUNG_AKTIV"
+
+// 0xAC5E I3_PID_BDC_FBD_FEHLER
+#define I3_FLD_BDC_STAT_FEHLER_X                                 I3_PID_BDC_FBD_FEHLER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_X"
+#define I3_FLD_BDC_STAT_ANZAHL_RESETS_WERT                       I3_PID_BDC_FBD_FEHLER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_RESETS_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE1_WERT     I3_PID_BDC_FBD_FEHLER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE1_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE2_WERT     I3_PID_BDC_FBD_FEHLER, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE2_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE3_WERT     I3_PID_BDC_FBD_FEHLER, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE3_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE4_WERT     I3_PID_BDC_FBD_FEHLER, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL1_PHASE4_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE1_WERT     I3_PID_BDC_FBD_FEHLER, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE1_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE2_WERT     I3_PID_BDC_FBD_FEHLER, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE2_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE3_WERT     I3_PID_BDC_FBD_FEHLER, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE3_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE4_WERT     I3_PID_BDC_FBD_FEHLER, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL2_PHASE4_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE1_WERT     I3_PID_BDC_FBD_FEHLER, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE1_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE2_WERT     I3_PID_BDC_FBD_FEHLER, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE2_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE3_WERT     I3_PID_BDC_FBD_FEHLER, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE3_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE4_WERT     I3_PID_BDC_FBD_FEHLER, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_STOERUNGEN_KANAL3_PHASE4_WERT"
+
+// 0xD070 I3_PID_BDC_ELSV_TASTER
+#define I3_FLD_BDC_STAT_TASTER_ELSV_HINTEN_EIN                   I3_PID_BDC_ELSV_TASTER, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_ELSV_HINTEN_EIN"
+#define I3_FLD_BDC_STAT_TASTER_ELSV_OBEN_EIN                     I3_PID_BDC_ELSV_TASTER, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_ELSV_OBEN_EIN"
+#define I3_FLD_BDC_STAT_TASTER_ELSV_UNTEN_EIN                    I3_PID_BDC_ELSV_TASTER, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_ELSV_UNTEN_EIN"
+#define I3_FLD_BDC_STAT_TASTER_ELSV_VORNE_EIN                    I3_PID_BDC_ELSV_TASTER, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_ELSV_VORNE_EIN"
+#define I3_FLD_BDC_STAT_TASTER_ELSV_NR                           I3_PID_BDC_ELSV_TASTER, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_ELSV_NR"
+
+// 0xD073 I3_PID_BDC_LENKRADHEIZUNG_TASTER
+#define I3_FLD_BDC_STAT_TASTER_LENKRADHEIZUNG_EIN                I3_PID_BDC_LENKRADHEIZUNG_TASTER, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRADHEIZUNG_EIN"
+
+// 0xD07B I3_PID_BDC_ELSV_STATEMACHINE
+#define I3_FLD_BDC_STAT_STATEMACHINE                             I3_PID_BDC_ELSV_STATEMACHINE, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_STATEMACHINE"
+
+// 0xD07F I3_PID_BDC_ELSV_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_ELSV_EIN                       I3_PID_BDC_ELSV_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_ELSV_EIN"
+
+// 0xD081 I3_PID_BDC_LENKRAD_MFL
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_FGR_SET_EIN           I3_PID_BDC_LENKRAD_MFL, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_SET_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_FGR_TIPPRAENDEL_NR    I3_PID_BDC_LENKRAD_MFL, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_TIPPRAENDEL_NR"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_FGR_RES_EIN           I3_PID_BDC_LENKRAD_MFL, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_RES_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_UMSCHALT_TASTE_EIN    I3_PID_BDC_LENKRAD_MFL, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_UMSCHALT_TASTE_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_ACC_ABSTAND_EIN       I3_PID_BDC_LENKRAD_MFL, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_ACC_ABSTAND_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_FGR_OFF_EIN           I3_PID_BDC_LENKRAD_MFL, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_FGR_OFF_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_PUSH_TO_TALK_EIN      I3_PID_BDC_LENKRAD_MFL, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_PUSH_TO_TALK_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_MODE_TASTE            I3_PID_BDC_LENKRAD_MFL, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_MODE_TASTE"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_TIPPRAENDEL_BC_NR     I3_PID_BDC_LENKRAD_MFL, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_TIPPRAENDEL_BC_NR"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_TEL_EIN               I3_PID_BDC_LENKRAD_MFL, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_TEL_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_VOL_MINUS_EIN         I3_PID_BDC_LENKRAD_MFL, 10, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_VOL_MINUS_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL_VOL_PLUS_EIN          I3_PID_BDC_LENKRAD_MFL, 11, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL_VOL_PLUS_EIN"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL1_NR                   I3_PID_BDC_LENKRAD_MFL, 12, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL1_NR"
+#define I3_FLD_BDC_STAT_TASTER_LENKRAD_MFL2_NR                   I3_PID_BDC_LENKRAD_MFL, 13, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_LENKRAD_MFL2_NR"
+
+// 0xD089 I3_PID_BDC_ELSV_POS_STATUS
+#define I3_FLD_BDC_STAT_ELSV_POS_HOEHE_WERT                      I3_PID_BDC_ELSV_POS_STATUS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ELSV_POS_HOEHE_WERT"
+#define I3_FLD_BDC_STAT_ELSV_POS_LAENGE_WERT                     I3_PID_BDC_ELSV_POS_STATUS, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ELSV_POS_LAENGE_WERT"
+#define I3_FLD_BDC_STAT_ELSV_BEWEGUNG_OBEN_EIN                   I3_PID_BDC_ELSV_POS_STATUS, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_OBEN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_BEWEGUNG_UNTEN_EIN                  I3_PID_BDC_ELSV_POS_STATUS, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_UNTEN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_BEWEGUNG_EINGEFAHREN_EIN            I3_PID_BDC_ELSV_POS_STATUS, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_EINGEFAHREN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_BEWEGUNG_AUSGEFAHREN_EIN            I3_PID_BDC_ELSV_POS_STATUS, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_BEWEGUNG_AUSGEFAHREN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_SOFTSTOP_OBEN_EIN                   I3_PID_BDC_ELSV_POS_STATUS, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_OBEN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_SOFTSTOP_UNTEN_EIN                  I3_PID_BDC_ELSV_POS_STATUS, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_UNTEN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_SOFTSTOP_EINGEFAHREN_EIN            I3_PID_BDC_ELSV_POS_STATUS, 10, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_EINGEFAHREN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_SOFTSTOP_AUSGEFAHREN_EIN            I3_PID_BDC_ELSV_POS_STATUS, 11, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_SOFTSTOP_AUSGEFAHREN_EIN"
+#define I3_FLD_BDC_STAT_ELSV_NORMIERUNG                          I3_PID_BDC_ELSV_POS_STATUS, 12, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ELSV_NORMIERUNG"
+
+// 0xD096 I3_PID_BDC_SMO_SPIELSCHUTZZAEHLER
+#define I3_FLD_BDC_STAT_SPIELSCHUTZZAEHLER_WERT                  I3_PID_BDC_SMO_SPIELSCHUTZZAEHLER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SPIELSCHUTZZAEHLER_WERT"
+
+// 0xD098 I3_PID_BDC_SMO_VARIANTE
+#define I3_FLD_BDC_STAT_FAHRZEUGTYP                              I3_PID_BDC_SMO_VARIANTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAHRZEUGTYP"
+
+// 0xD09D I3_PID_BDC_PLOCK
+#define I3_FLD_BDC_STAT_PLOCK_AKTIV                              I3_PID_BDC_PLOCK, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PLOCK_AKTIV"
+
+// 0xD0F1 I3_PID_BDC_ZUSATZINFO_LICHT
+#define I3_FLD_BDC_STAT_KM_STAND_1_WERT                          I3_PID_BDC_ZUSATZINFO_LICHT, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_STAND_1_WERT"
+#define I3_FLD_BDC_STAT_ENBN_AEP_STATUS_1_WERT                   I3_PID_BDC_ZUSATZINFO_LICHT, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENBN_AEP_STATUS_1_WERT"
+#define I3_FLD_BDC_STAT_U_BATT_ANFANG_1_WERT                     I3_PID_BDC_ZUSATZINFO_LICHT, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_U_BATT_ANFANG_1_WERT"
+#define I3_FLD_BDC_STAT_DAUER_1_WERT                             I3_PID_BDC_ZUSATZINFO_LICHT, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DAUER_1_WERT"
+#define I3_FLD_BDC_STAT_LICHT_1_NR                               I3_PID_BDC_ZUSATZINFO_LICHT, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHT_1_NR"
+#define I3_FLD_BDC_STAT_ABSCHALTUNG_LICHT_1_WERT                 I3_PID_BDC_ZUSATZINFO_LICHT, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTUNG_LICHT_1_WERT"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_1_WERT               I3_PID_BDC_ZUSATZINFO_LICHT, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_1_WERT"
+#define I3_FLD_BDC_STAT_KLEMMENSTATUS_1_WERT                     I3_PID_BDC_ZUSATZINFO_LICHT, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLEMMENSTATUS_1_WERT"
+#define I3_FLD_BDC_STAT_KM_STAND_2_WERT                          I3_PID_BDC_ZUSATZINFO_LICHT, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_STAND_2_WERT"
+#define I3_FLD_BDC_STAT_ENBN_AEP_STATUS_2_WERT                   I3_PID_BDC_ZUSATZINFO_LICHT, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENBN_AEP_STATUS_2_WERT"
+#define I3_FLD_BDC_STAT_U_BATT_ANFANG_2_WERT                     I3_PID_BDC_ZUSATZINFO_LICHT, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_U_BATT_ANFANG_2_WERT"
+#define I3_FLD_BDC_STAT_DAUER_2_WERT                             I3_PID_BDC_ZUSATZINFO_LICHT, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DAUER_2_WERT"
+#define I3_FLD_BDC_STAT_LICHT_2_NR                               I3_PID_BDC_ZUSATZINFO_LICHT, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHT_2_NR"
+#define I3_FLD_BDC_STAT_ABSCHALTUNG_LICHT_2_WERT                 I3_PID_BDC_ZUSATZINFO_LICHT, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTUNG_LICHT_2_WERT"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_2_WERT               I3_PID_BDC_ZUSATZINFO_LICHT, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_2_WERT"
+#define I3_FLD_BDC_STAT_KLEMMENSTATUS_2_WERT                     I3_PID_BDC_ZUSATZINFO_LICHT, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLEMMENSTATUS_2_WERT"
+
+// 0xD130 I3_PID_BDC_HANDBREMSE_KONTAKT
+#define I3_FLD_BDC_STAT_HANDBREMSE_KONTAKT_EIN                   I3_PID_BDC_HANDBREMSE_KONTAKT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HANDBREMSE_KONTAKT_EIN"
+
+// 0xD161 I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_LINKS
+#define I3_FLD_BDC_STAT_TASTER_SITZHEIZUNG_HINTEN_LINKS_EIN      I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_LINKS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_HINTEN_LINKS_EIN"
+
+// 0xD162 I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_RECHTS
+#define I3_FLD_BDC_STAT_TASTER_SITZHEIZUNG_HINTEN_RECHTS_EIN     I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_RECHTS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_HINTEN_RECHTS_EIN"
+
+// 0xD188 I3_PID_BDC_FH_FA_TASTER
+#define I3_FLD_BDC_STAT_TASTER_FA_FA_NR                          I3_PID_BDC_FH_FA_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_FA_FA_NR"
+#define I3_FLD_BDC_STAT_TASTER_FA_BF_NR                          I3_PID_BDC_FH_FA_TASTER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_FA_BF_NR"
+#define I3_FLD_BDC_STAT_TASTER_FA_FAH_NR                         I3_PID_BDC_FH_FA_TASTER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_FA_FAH_NR"
+#define I3_FLD_BDC_STAT_TASTER_FA_BFH_NR                         I3_PID_BDC_FH_FA_TASTER, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_FA_BFH_NR"
+#define I3_FLD_BDC_STAT_TASTER_FA_HS_NR                          I3_PID_BDC_FH_FA_TASTER, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_FA_HS_NR"
+#define I3_FLD_BDC_STAT_TASTER_FA_RESERVE                        I3_PID_BDC_FH_FA_TASTER, 5, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TASTER_FA_RESERVE"
+
+// 0xD189 I3_PID_BDC_FH_BF_TASTER
+#define I3_FLD_BDC_STAT_TASTER_BF_BF_NR                          I3_PID_BDC_FH_BF_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_BF_BF_NR"
+
+// 0xD18A I3_PID_BDC_FH_FAH_TASTER
+#define I3_FLD_BDC_STAT_TASTER_FAH_FAH_NR                        I3_PID_BDC_FH_FAH_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_FAH_FAH_NR"
+
+// 0xD18B I3_PID_BDC_FH_BFH_TASTER
+#define I3_FLD_BDC_STAT_TASTER_BFH_BFH_NR                        I3_PID_BDC_FH_BFH_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_BFH_BFH_NR"
+
+// 0xD18D I3_PID_BDC_FH_KISI_LED
+#define I3_FLD_BDC_STAT_KISI_LED_EIN                             I3_PID_BDC_FH_KISI_LED, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_KISI_LED_EIN"
+
+// 0xD1A7 I3_PID_BDC_FH_FA_BEWEGUNG
+#define I3_FLD_BDC_STAT_FH_FA_INIT_NR                            I3_PID_BDC_FH_FA_BEWEGUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_INIT_NR"
+#define I3_FLD_BDC_STAT_FH_FA_BEWEGUNG_NR                        I3_PID_BDC_FH_FA_BEWEGUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_BEWEGUNG_NR"
+#define I3_FLD_BDC_STAT_FH_FA_POSITION_NR                        I3_PID_BDC_FH_FA_BEWEGUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_POSITION_NR"
+#define I3_FLD_BDC_STAT_FH_FA_POSITION_HALL_WERT                 I3_PID_BDC_FH_FA_BEWEGUNG, 3, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FA_POSITION_HALL_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_POSITION_HALL_MAX_WERT             I3_PID_BDC_FH_FA_BEWEGUNG, 5, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FA_POSITION_HALL_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_POSITION_MM_WERT                   I3_PID_BDC_FH_FA_BEWEGUNG, 7, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FA_POSITION_MM_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_POSITION_MM_MAX_WERT               I3_PID_BDC_FH_FA_BEWEGUNG, 9, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FA_POSITION_MM_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_POSITION_PROZENT_WERT              I3_PID_BDC_FH_FA_BEWEGUNG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_POSITION_PROZENT_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_LAGE_NR                            I3_PID_BDC_FH_FA_BEWEGUNG, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_LAGE_NR"
+#define I3_FLD_BDC_STAT_FH_FA_ZUSTAND_TUER_NR                    I3_PID_BDC_FH_FA_BEWEGUNG, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_ZUSTAND_TUER_NR"
+#define I3_FLD_BDC_STAT_FH_FA_FREIGABE_AKTIV_NR                  I3_PID_BDC_FH_FA_BEWEGUNG, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_FREIGABE_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_FA_PANIKMODUS_AKTIV_NR                I3_PID_BDC_FH_FA_BEWEGUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_PANIKMODUS_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_FA_RESERVE                            I3_PID_BDC_FH_FA_BEWEGUNG, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FA_RESERVE"
+
+// 0xD1A8 I3_PID_BDC_FH_BF_BEWEGUNG
+#define I3_FLD_BDC_STAT_FH_BF_INIT_NR                            I3_PID_BDC_FH_BF_BEWEGUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_INIT_NR"
+#define I3_FLD_BDC_STAT_FH_BF_BEWEGUNG_NR                        I3_PID_BDC_FH_BF_BEWEGUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_BEWEGUNG_NR"
+#define I3_FLD_BDC_STAT_FH_BF_POSITION_NR                        I3_PID_BDC_FH_BF_BEWEGUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_POSITION_NR"
+#define I3_FLD_BDC_STAT_FH_BF_POSITION_HALL_WERT                 I3_PID_BDC_FH_BF_BEWEGUNG, 3, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BF_POSITION_HALL_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_POSITION_HALL_MAX_WERT             I3_PID_BDC_FH_BF_BEWEGUNG, 5, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BF_POSITION_HALL_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_POSITION_MM_WERT                   I3_PID_BDC_FH_BF_BEWEGUNG, 7, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BF_POSITION_MM_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_POSITION_MM_MAX_WERT               I3_PID_BDC_FH_BF_BEWEGUNG, 9, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BF_POSITION_MM_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_POSITION_PROZENT_WERT              I3_PID_BDC_FH_BF_BEWEGUNG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_POSITION_PROZENT_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_LAGE_NR                            I3_PID_BDC_FH_BF_BEWEGUNG, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_LAGE_NR"
+#define I3_FLD_BDC_STAT_FH_BF_ZUSTAND_TUER_NR                    I3_PID_BDC_FH_BF_BEWEGUNG, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_ZUSTAND_TUER_NR"
+#define I3_FLD_BDC_STAT_FH_BF_FREIGABE_AKTIV_NR                  I3_PID_BDC_FH_BF_BEWEGUNG, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_FREIGABE_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_BF_PANIKMODUS_AKTIV_NR                I3_PID_BDC_FH_BF_BEWEGUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_PANIKMODUS_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_BF_RESERVE                            I3_PID_BDC_FH_BF_BEWEGUNG, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BF_RESERVE"
+
+// 0xD1A9 I3_PID_BDC_FH_FAH_BEWEGUNG
+#define I3_FLD_BDC_STAT_FH_FAH_INIT_NR                           I3_PID_BDC_FH_FAH_BEWEGUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_INIT_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_BEWEGUNG_NR                       I3_PID_BDC_FH_FAH_BEWEGUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_BEWEGUNG_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_POSITION_NR                       I3_PID_BDC_FH_FAH_BEWEGUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_POSITION_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_POSITION_HALL_WERT                I3_PID_BDC_FH_FAH_BEWEGUNG, 3, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FAH_POSITION_HALL_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_POSITION_HALL_MAX_WERT            I3_PID_BDC_FH_FAH_BEWEGUNG, 5, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FAH_POSITION_HALL_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_POSITION_MM_WERT                  I3_PID_BDC_FH_FAH_BEWEGUNG, 7, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FAH_POSITION_MM_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_POSITION_MM_MAX_WERT              I3_PID_BDC_FH_FAH_BEWEGUNG, 9, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_FAH_POSITION_MM_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_POSITION_PROZENT_WERT             I3_PID_BDC_FH_FAH_BEWEGUNG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_POSITION_PROZENT_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_LAGE_NR                           I3_PID_BDC_FH_FAH_BEWEGUNG, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_LAGE_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_ZUSTAND_TUER_NR                   I3_PID_BDC_FH_FAH_BEWEGUNG, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_ZUSTAND_TUER_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_FREIGABE_AKTIV_NR                 I3_PID_BDC_FH_FAH_BEWEGUNG, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_FREIGABE_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_PANIKMODUS_AKTIV_NR               I3_PID_BDC_FH_FAH_BEWEGUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_PANIKMODUS_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_RESERVE                           I3_PID_BDC_FH_FAH_BEWEGUNG, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FAH_RESERVE"
+
+// 0xD1AA I3_PID_BDC_FH_BFH_BEWEGUNG
+#define I3_FLD_BDC_STAT_FH_BFH_INIT_NR                           I3_PID_BDC_FH_BFH_BEWEGUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_INIT_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_BEWEGUNG_NR                       I3_PID_BDC_FH_BFH_BEWEGUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_BEWEGUNG_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_POSITION_NR                       I3_PID_BDC_FH_BFH_BEWEGUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_POSITION_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_POSITION_HALL_WERT                I3_PID_BDC_FH_BFH_BEWEGUNG, 3, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BFH_POSITION_HALL_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_POSITION_HALL_MAX_WERT            I3_PID_BDC_FH_BFH_BEWEGUNG, 5, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BFH_POSITION_HALL_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_POSITION_MM_WERT                  I3_PID_BDC_FH_BFH_BEWEGUNG, 7, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BFH_POSITION_MM_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_POSITION_MM_MAX_WERT              I3_PID_BDC_FH_BFH_BEWEGUNG, 9, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FH_BFH_POSITION_MM_MAX_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_POSITION_PROZENT_WERT             I3_PID_BDC_FH_BFH_BEWEGUNG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_POSITION_PROZENT_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_LAGE_NR                           I3_PID_BDC_FH_BFH_BEWEGUNG, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_LAGE_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_ZUSTAND_TUER_NR                   I3_PID_BDC_FH_BFH_BEWEGUNG, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_ZUSTAND_TUER_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_FREIGABE_AKTIV_NR                 I3_PID_BDC_FH_BFH_BEWEGUNG, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_FREIGABE_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_PANIKMODUS_AKTIV_NR               I3_PID_BDC_FH_BFH_BEWEGUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_PANIKMODUS_AKTIV_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_RESERVE                           I3_PID_BDC_FH_BFH_BEWEGUNG, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BFH_RESERVE"
+
+// 0xD1AD I3_PID_BDC_FH_BFH_RELAIS
+#define I3_FLD_BDC_STAT_RELAIS_A_ANSTEUERUNG_EIN                 I3_PID_BDC_FH_BFH_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN"
+#define I3_FLD_BDC_STAT_RELAIS_A_RUECK_EIN                       I3_PID_BDC_FH_BFH_RELAIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN"
+#define I3_FLD_BDC_STAT_RELAIS_B_ANSTEUERUNG_EIN                 I3_PID_BDC_FH_BFH_RELAIS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN"
+#define I3_FLD_BDC_STAT_RELAIS_B_RUECK_EIN                       I3_PID_BDC_FH_BFH_RELAIS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN"
+#define I3_FLD_BDC_STAT_RELAIS_A_VERSORGUNG_WERT                 I3_PID_BDC_FH_BFH_RELAIS, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT"
+#define I3_FLD_BDC_STAT_RELAIS_B_VERSORGUNG_WERT                 I3_PID_BDC_FH_BFH_RELAIS, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT"
+
+// 0xD1AE I3_PID_BDC_FH_BFH_HALLSENSOREN
+#define I3_FLD_BDC_STAT_HALL_A_SCHALTZUSTAND_EIN                 I3_PID_BDC_FH_BFH_HALLSENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN"
+#define I3_FLD_BDC_STAT_HALL_A_VERSORGUNG_EIN                    I3_PID_BDC_FH_BFH_HALLSENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN"
+#define I3_FLD_BDC_STAT_HALL_A_FEHLERZUSZTAND_NR                 I3_PID_BDC_FH_BFH_HALLSENSOREN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSZTAND_NR"
+#define I3_FLD_BDC_STAT_HALL_B_SCHALTZUSTAND_EIN                 I3_PID_BDC_FH_BFH_HALLSENSOREN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN"
+#define I3_FLD_BDC_STAT_HALL_B_VERSORGUNG_EIN                    I3_PID_BDC_FH_BFH_HALLSENSOREN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN"
+#define I3_FLD_BDC_STAT_HALL_B_FEHLERZUSZTAND_NR                 I3_PID_BDC_FH_BFH_HALLSENSOREN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSZTAND_NR"
+
+// 0xD1AF I3_PID_BDC_FH_FAH_RELAIS
+#define I3_FLD_BDC_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1AF          I3_PID_BDC_FH_FAH_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1AF"
+#define I3_FLD_BDC_STAT_RELAIS_A_RUECK_EIN_0XD1AF                I3_PID_BDC_FH_FAH_RELAIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1AF"
+#define I3_FLD_BDC_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1AF          I3_PID_BDC_FH_FAH_RELAIS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1AF"
+#define I3_FLD_BDC_STAT_RELAIS_B_RUECK_EIN_0XD1AF                I3_PID_BDC_FH_FAH_RELAIS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1AF"
+#define I3_FLD_BDC_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1AF          I3_PID_BDC_FH_FAH_RELAIS, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1AF"
+#define I3_FLD_BDC_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1AF          I3_PID_BDC_FH_FAH_RELAIS, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1AF"
+
+// 0xD1B0 I3_PID_BDC_FH_FAH_HALLSENSOREN
+#define I3_FLD_BDC_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B0          I3_PID_BDC_FH_FAH_HALLSENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B0"
+#define I3_FLD_BDC_STAT_HALL_A_VERSORGUNG_EIN_0XD1B0             I3_PID_BDC_FH_FAH_HALLSENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1B0"
+#define I3_FLD_BDC_STAT_HALL_A_FEHLERZUSZTAND_NR_0XD1B0          I3_PID_BDC_FH_FAH_HALLSENSOREN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSZTAND_NR_0XD1B0"
+#define I3_FLD_BDC_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B0          I3_PID_BDC_FH_FAH_HALLSENSOREN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B0"
+#define I3_FLD_BDC_STAT_HALL_B_VERSORGUNG_EIN_1                  I3_PID_BDC_FH_FAH_HALLSENSOREN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_1"
+#define I3_FLD_BDC_STAT_HALL_B_FEHLERZUSZTAND_NR_0XD1B0          I3_PID_BDC_FH_FAH_HALLSENSOREN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSZTAND_NR_0XD1B0"
+
+// 0xD1B1 I3_PID_BDC_FH_FA_RELAIS
+#define I3_FLD_BDC_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1B1          I3_PID_BDC_FH_FA_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1B1"
+#define I3_FLD_BDC_STAT_RELAIS_A_RUECK_EIN_0XD1B1                I3_PID_BDC_FH_FA_RELAIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1B1"
+#define I3_FLD_BDC_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1B1          I3_PID_BDC_FH_FA_RELAIS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1B1"
+#define I3_FLD_BDC_STAT_RELAIS_B_RUECK_EIN_0XD1B1                I3_PID_BDC_FH_FA_RELAIS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1B1"
+#define I3_FLD_BDC_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1B1          I3_PID_BDC_FH_FA_RELAIS, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1B1"
+#define I3_FLD_BDC_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1B1          I3_PID_BDC_FH_FA_RELAIS, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1B1"
+
+// 0xD1B2 I3_PID_BDC_FH_FA_HALLSENSOREN
+#define I3_FLD_BDC_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B2          I3_PID_BDC_FH_FA_HALLSENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B2"
+#define I3_FLD_BDC_STAT_HALL_A_VERSORGUNG_EIN_0XD1B2             I3_PID_BDC_FH_FA_HALLSENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1B2"
+#define I3_FLD_BDC_STAT_HALL_A_FEHLERZUSTAND_NR                  I3_PID_BDC_FH_FA_HALLSENSOREN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR"
+#define I3_FLD_BDC_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B2          I3_PID_BDC_FH_FA_HALLSENSOREN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B2"
+#define I3_FLD_BDC_STAT_HALL_B_VERSORGUNG_EIN_0XD1B2             I3_PID_BDC_FH_FA_HALLSENSOREN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_0XD1B2"
+#define I3_FLD_BDC_STAT_HALL_B_FEHLERZUSTAND_NR                  I3_PID_BDC_FH_FA_HALLSENSOREN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR"
+
+// 0xD1B3 I3_PID_BDC_FH_BF_RELAIS
+#define I3_FLD_BDC_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1B3          I3_PID_BDC_FH_BF_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1B3"
+#define I3_FLD_BDC_STAT_RELAIS_A_RUECK_EIN_0XD1B3                I3_PID_BDC_FH_BF_RELAIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1B3"
+#define I3_FLD_BDC_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1B3          I3_PID_BDC_FH_BF_RELAIS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1B3"
+#define I3_FLD_BDC_STAT_RELAIS_B_RUECK_EIN_0XD1B3                I3_PID_BDC_FH_BF_RELAIS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1B3"
+#define I3_FLD_BDC_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1B3          I3_PID_BDC_FH_BF_RELAIS, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1B3"
+#define I3_FLD_BDC_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1B3          I3_PID_BDC_FH_BF_RELAIS, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1B3"
+
+// 0xD1B4 I3_PID_BDC_FH_BF_HALLSENSOREN
+#define I3_FLD_BDC_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B4          I3_PID_BDC_FH_BF_HALLSENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1B4"
+#define I3_FLD_BDC_STAT_HALL_A_VERSORGUNG_EIN_0XD1B4             I3_PID_BDC_FH_BF_HALLSENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1B4"
+#define I3_FLD_BDC_STAT_HALL_A_FEHLERZUSTAND_NR_0XD1B4           I3_PID_BDC_FH_BF_HALLSENSOREN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR_0XD1B4"
+#define I3_FLD_BDC_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B4          I3_PID_BDC_FH_BF_HALLSENSOREN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1B4"
+#define I3_FLD_BDC_STAT_HALL_B_VERSORGUNG_EIN_0XD1B4             I3_PID_BDC_FH_BF_HALLSENSOREN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_0XD1B4"
+#define I3_FLD_BDC_STAT_HALL_B_FEHLERZUSTAND_NR_0XD1B4           I3_PID_BDC_FH_BF_HALLSENSOREN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR_0XD1B4"
+
+// 0xD1B5 I3_PID_BDC_FH_FA_STATUS_DETAIL
+#define I3_FLD_BDC_STAT_FH_FA_KURZHUB_VORHANDEN                  I3_PID_BDC_FH_FA_STATUS_DETAIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_KURZHUB_VORHANDEN"
+#define I3_FLD_BDC_STAT_FH_FA_MOTORTEMPERATUR_NR                 I3_PID_BDC_FH_FA_STATUS_DETAIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_MOTORTEMPERATUR_NR"
+#define I3_FLD_BDC_STAT_FH_FA_AUSSENTEMPERATUR_WERT              I3_PID_BDC_FH_FA_STATUS_DETAIL, 2, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_FH_FA_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_MT_LIEFERANT_NR                    I3_PID_BDC_FH_FA_STATUS_DETAIL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_MT_LIEFERANT_NR"
+#define I3_FLD_BDC_STAT_FH_FA_MT_SW_VERSION_WERT                 I3_PID_BDC_FH_FA_STATUS_DETAIL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FA_MT_SW_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_MT_PARAMETER_VERSION_WERT          I3_PID_BDC_FH_FA_STATUS_DETAIL, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FA_MT_PARAMETER_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_EEPROM_PRUEFSUMME_NR               I3_PID_BDC_FH_FA_STATUS_DETAIL, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_EEPROM_PRUEFSUMME_NR"
+#define I3_FLD_BDC_STAT_FH_FA_STATUS_VON_FAH                     I3_PID_BDC_FH_FA_STATUS_DETAIL, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_STATUS_VON_FAH"
+#define I3_FLD_BDC_STAT_FH_FA_WACHHALTEN                         I3_PID_BDC_FH_FA_STATUS_DETAIL, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_WACHHALTEN"
+#define I3_FLD_BDC_STAT_FH_FA_FZG_GESCHWINDIGKEIT_WERT           I3_PID_BDC_FH_FA_STATUS_DETAIL, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_FZG_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_RELATIVZEIT_WERT                   I3_PID_BDC_FH_FA_STATUS_DETAIL, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FA_RELATIVZEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_FA_TEMPERATUR_UEBERWACHUNG            I3_PID_BDC_FH_FA_STATUS_DETAIL, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_TEMPERATUR_UEBERWACHUNG"
+#define I3_FLD_BDC_STAT_FH_FA_EKS_AKTIV                          I3_PID_BDC_FH_FA_STATUS_DETAIL, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_EKS_AKTIV"
+#define I3_FLD_BDC_STAT_FH_FA_SYSTEMTYP                          I3_PID_BDC_FH_FA_STATUS_DETAIL, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FA_SYSTEMTYP"
+
+// 0xD1B6 I3_PID_BDC_FH_BF_STATUS_DETAIL
+#define I3_FLD_BDC_STAT_FH_BF_KURZHUB_VORHANDEN                  I3_PID_BDC_FH_BF_STATUS_DETAIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_KURZHUB_VORHANDEN"
+#define I3_FLD_BDC_STAT_FH_BF_MOTORTEMPERATUR                    I3_PID_BDC_FH_BF_STATUS_DETAIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_MOTORTEMPERATUR"
+#define I3_FLD_BDC_STAT_FH_BF_AUSSENTEMPERATUR_WERT              I3_PID_BDC_FH_BF_STATUS_DETAIL, 2, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_FH_BF_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_MT_LIEFERANT                       I3_PID_BDC_FH_BF_STATUS_DETAIL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_MT_LIEFERANT"
+#define I3_FLD_BDC_STAT_FH_BF_MT_SW_VERSION_WERT                 I3_PID_BDC_FH_BF_STATUS_DETAIL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BF_MT_SW_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_MT_PARAMETER_VERSION_WERT          I3_PID_BDC_FH_BF_STATUS_DETAIL, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BF_MT_PARAMETER_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_EEPROM_PRUEFSUMME_NR               I3_PID_BDC_FH_BF_STATUS_DETAIL, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_EEPROM_PRUEFSUMME_NR"
+#define I3_FLD_BDC_STAT_FH_BF_STATUS_VON_BFH                     I3_PID_BDC_FH_BF_STATUS_DETAIL, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_STATUS_VON_BFH"
+#define I3_FLD_BDC_STAT_FH_BF_WACHHALTEN                         I3_PID_BDC_FH_BF_STATUS_DETAIL, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_WACHHALTEN"
+#define I3_FLD_BDC_STAT_FH_BF_FZG_GESCHWINDIGKEIT_WERT           I3_PID_BDC_FH_BF_STATUS_DETAIL, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_FZG_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_RELATIVZEIT_WERT                   I3_PID_BDC_FH_BF_STATUS_DETAIL, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BF_RELATIVZEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_BF_TEMPERATUR_UEBERWACHUNG            I3_PID_BDC_FH_BF_STATUS_DETAIL, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_TEMPERATUR_UEBERWACHUNG"
+#define I3_FLD_BDC_STAT_FH_BF_EKS_AKTIV                          I3_PID_BDC_FH_BF_STATUS_DETAIL, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_EKS_AKTIV"
+#define I3_FLD_BDC_STAT_FH_BF_SYSTEMTYP                          I3_PID_BDC_FH_BF_STATUS_DETAIL, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BF_SYSTEMTYP"
+
+// 0xD1B7 I3_PID_BDC_FH_FAH_STATUS_DETAIL
+#define I3_FLD_BDC_STAT_FH_FAH_KURZHUB_VORHANDEN                 I3_PID_BDC_FH_FAH_STATUS_DETAIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_KURZHUB_VORHANDEN"
+#define I3_FLD_BDC_STAT_FH_FAH_MOTORTEMPERATUR                   I3_PID_BDC_FH_FAH_STATUS_DETAIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_MOTORTEMPERATUR"
+#define I3_FLD_BDC_STAT_FH_FAH_AUSSENTEMPERATUR_WERT             I3_PID_BDC_FH_FAH_STATUS_DETAIL, 2, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_FH_FAH_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_MT_LIEFERANT                      I3_PID_BDC_FH_FAH_STATUS_DETAIL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_MT_LIEFERANT"
+#define I3_FLD_BDC_STAT_FH_FAH_MT_SW_VERSION_WERT                I3_PID_BDC_FH_FAH_STATUS_DETAIL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FAH_MT_SW_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_MT_PARAMETER_VERSION_WERT         I3_PID_BDC_FH_FAH_STATUS_DETAIL, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FAH_MT_PARAMETER_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_EEPROM_PRUEFSUMME_NR              I3_PID_BDC_FH_FAH_STATUS_DETAIL, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_EEPROM_PRUEFSUMME_NR"
+#define I3_FLD_BDC_STAT_FH_FAH_STATUS_VON_FA                     I3_PID_BDC_FH_FAH_STATUS_DETAIL, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_STATUS_VON_FA"
+#define I3_FLD_BDC_STAT_FH_FAH_WACHHALTEN                        I3_PID_BDC_FH_FAH_STATUS_DETAIL, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_WACHHALTEN"
+#define I3_FLD_BDC_STAT_FH_FAH_FZG_GESCHWINDIGKEIT_WERT          I3_PID_BDC_FH_FAH_STATUS_DETAIL, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_FZG_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_RELATIVZEIT_WERT                  I3_PID_BDC_FH_FAH_STATUS_DETAIL, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_FAH_RELATIVZEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_FAH_TEMPERATUR_UEBERWACHUNG           I3_PID_BDC_FH_FAH_STATUS_DETAIL, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_TEMPERATUR_UEBERWACHUNG"
+#define I3_FLD_BDC_STAT_FH_FAH_EKS_AKTIV                         I3_PID_BDC_FH_FAH_STATUS_DETAIL, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_EKS_AKTIV"
+#define I3_FLD_BDC_STAT_FH_FAH_SYSTEMTYP                         I3_PID_BDC_FH_FAH_STATUS_DETAIL, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_FAH_SYSTEMTYP"
+
+// 0xD1B8 I3_PID_BDC_FH_BFH_STATUS_DETAIL
+#define I3_FLD_BDC_STAT_FH_BFH_KURZHUB_VORHANDEN                 I3_PID_BDC_FH_BFH_STATUS_DETAIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_KURZHUB_VORHANDEN"
+#define I3_FLD_BDC_STAT_FH_BFH_MOTORTEMPERATUR                   I3_PID_BDC_FH_BFH_STATUS_DETAIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_MOTORTEMPERATUR"
+#define I3_FLD_BDC_STAT_FH_BFH_AUSSENTEMPERATUR_WERT             I3_PID_BDC_FH_BFH_STATUS_DETAIL, 2, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_FH_BFH_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_MT_LIEFERANT                      I3_PID_BDC_FH_BFH_STATUS_DETAIL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_MT_LIEFERANT"
+#define I3_FLD_BDC_STAT_FH_BFH_MT_SW_VERSION_WERT                I3_PID_BDC_FH_BFH_STATUS_DETAIL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BFH_MT_SW_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_MT_PARAMETER_VERSION_WERT         I3_PID_BDC_FH_BFH_STATUS_DETAIL, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BFH_MT_PARAMETER_VERSION_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_EEPROM_PRUEFSUMME_NR              I3_PID_BDC_FH_BFH_STATUS_DETAIL, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_EEPROM_PRUEFSUMME_NR"
+#define I3_FLD_BDC_STAT_FH_BFH_STATUS_VON_BF                     I3_PID_BDC_FH_BFH_STATUS_DETAIL, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_STATUS_VON_BF"
+#define I3_FLD_BDC_STAT_FH_BFH_WACHHALTEN                        I3_PID_BDC_FH_BFH_STATUS_DETAIL, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_WACHHALTEN"
+#define I3_FLD_BDC_STAT_FH_BFH_FZG_GESCHWINDIGKEIT_WERT          I3_PID_BDC_FH_BFH_STATUS_DETAIL, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_FZG_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_RELATIVZEIT_WERT                  I3_PID_BDC_FH_BFH_STATUS_DETAIL, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FH_BFH_RELATIVZEIT_WERT"
+#define I3_FLD_BDC_STAT_FH_BFH_TEMPERATUR_UEBERWACHUNG           I3_PID_BDC_FH_BFH_STATUS_DETAIL, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_TEMPERATUR_UEBERWACHUNG"
+#define I3_FLD_BDC_STAT_FH_BFH_EKS_AKTIV                         I3_PID_BDC_FH_BFH_STATUS_DETAIL, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_EKS_AKTIV"
+#define I3_FLD_BDC_STAT_FH_BFH_SYSTEMTYP                         I3_PID_BDC_FH_BFH_STATUS_DETAIL, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FH_BFH_SYSTEMTYP"
+
+// 0xD1CA I3_PID_BDC_STATUS_SITZEXT_TASTEN
+#define I3_FLD_BDC_STAT_SITZMEMORY_FA                            I3_PID_BDC_STATUS_SITZEXT_TASTEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZMEMORY_FA"
+#define I3_FLD_BDC_STAT_SITZMEMORY_BF                            I3_PID_BDC_STATUS_SITZEXT_TASTEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZMEMORY_BF"
+#define I3_FLD_BDC_STAT_SITZMEMORY_FAH                           I3_PID_BDC_STATUS_SITZEXT_TASTEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZMEMORY_FAH"
+#define I3_FLD_BDC_STAT_SITZMEMORY_BFH                           I3_PID_BDC_STATUS_SITZEXT_TASTEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZMEMORY_BFH"
+#define I3_FLD_BDC_STAT_MASSAGE_FA                               I3_PID_BDC_STATUS_SITZEXT_TASTEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MASSAGE_FA"
+#define I3_FLD_BDC_STAT_MASSAGE_BF                               I3_PID_BDC_STATUS_SITZEXT_TASTEN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MASSAGE_BF"
+#define I3_FLD_BDC_STAT_MASSAGE_FAH                              I3_PID_BDC_STATUS_SITZEXT_TASTEN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MASSAGE_FAH"
+#define I3_FLD_BDC_STAT_MASSAGE_BFH                              I3_PID_BDC_STATUS_SITZEXT_TASTEN, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MASSAGE_BFH"
+#define I3_FLD_BDC_STAT_FERNBEDIENUNG_FA                         I3_PID_BDC_STATUS_SITZEXT_TASTEN, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FERNBEDIENUNG_FA"
+#define I3_FLD_BDC_STAT_RESET_TASTE_BF                           I3_PID_BDC_STATUS_SITZEXT_TASTEN, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESET_TASTE_BF"
+#define I3_FLD_BDC_STAT_SCHLAFPOSITION_TASTE_BFTH                I3_PID_BDC_STATUS_SITZEXT_TASTEN, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHLAFPOSITION_TASTE_BFTH"
+#define I3_FLD_BDC_STAT_SITZPOSITION_TASTE_BFTH                  I3_PID_BDC_STATUS_SITZEXT_TASTEN, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZPOSITION_TASTE_BFTH"
+
+// 0xD1CB I3_PID_BDC_STATUS_SITZEXT_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SITZEXT_VORNE                  I3_PID_BDC_STATUS_SITZEXT_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SITZEXT_VORNE"
+#define I3_FLD_BDC_STAT_VORHANDEN_SITZEXT_HINTEN                 I3_PID_BDC_STATUS_SITZEXT_VORHANDEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SITZEXT_HINTEN"
+
+// 0xD258 I3_PID_BDC_TANK_FUELLSTAND_LINKS
+#define I3_FLD_BDC_STAT_FUELLSTAND_TANK_LI_WERT                  I3_PID_BDC_TANK_FUELLSTAND_LINKS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FUELLSTAND_TANK_LI_WERT"
+
+// 0xD259 I3_PID_BDC_TANK_FUELLSTAND_RECHTS
+#define I3_FLD_BDC_STAT_FUELLSTAND_TANK_RE_WERT                  I3_PID_BDC_TANK_FUELLSTAND_RECHTS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FUELLSTAND_TANK_RE_WERT"
+
+// 0xD297 I3_PID_BDC_HUPE_TASTER
+#define I3_FLD_BDC_STAT_TASTER_HUPE_EIN                          I3_PID_BDC_HUPE_TASTER, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TASTER_HUPE_EIN"
+
+// 0xD321 I3_PID_BDC_AUSSENSPIEGEL_THERMOSCHUTZ
+#define I3_FLD_BDC_STAT_SPIEGEL_THERMOSCHUTZ_AKTIV               I3_PID_BDC_AUSSENSPIEGEL_THERMOSCHUTZ, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_THERMOSCHUTZ_AKTIV"
+
+// 0xD329 I3_PID_BDC_AUSSENSPIEGEL_LIN
+#define I3_FLD_BDC_STAT_VORHANDEN_LIN_SPIEGEL_EIN                I3_PID_BDC_AUSSENSPIEGEL_LIN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_LIN_SPIEGEL_EIN"
+
+// 0xD32B I3_PID_BDC_AUSSENSPIEGEL_MEM_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SPIEGEL_MEMORY_EIN             I3_PID_BDC_AUSSENSPIEGEL_MEM_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_MEMORY_EIN"
+
+// 0xD32E I3_PID_BDC_AUSSENSPIEGEL_HEIZUNG_VERBAUT
+#define I3_FLD_BDC_STAT_VORHANDEN_SPIEGEL_HEIZUNG_EIN            I3_PID_BDC_AUSSENSPIEGEL_HEIZUNG_VERBAUT, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_HEIZUNG_EIN"
+
+// 0xD330 I3_PID_BDC_EC_SPIEGEL_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_EC_SPIEGEL                     I3_PID_BDC_EC_SPIEGEL_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_EC_SPIEGEL"
+
+// 0xD331 I3_PID_BDC_AUSSENSPIEGEL_TASTER
+#define I3_FLD_BDC_STAT_SPIEGEL_BEIKLAPPEN_EIN                   I3_PID_BDC_AUSSENSPIEGEL_TASTER, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_BEIKLAPPEN_EIN"
+#define I3_FLD_BDC_STAT_SPIEGEL_SCHALTER_FA_EIN                  I3_PID_BDC_AUSSENSPIEGEL_TASTER, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_SCHALTER_FA_EIN"
+#define I3_FLD_BDC_STAT_SPIEGEL_TASTER_LINKS_EIN                 I3_PID_BDC_AUSSENSPIEGEL_TASTER, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_LINKS_EIN"
+#define I3_FLD_BDC_STAT_SPIEGEL_TASTER_OBEN_EIN                  I3_PID_BDC_AUSSENSPIEGEL_TASTER, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_OBEN_EIN"
+#define I3_FLD_BDC_STAT_SPIEGEL_TASTER_RECHTS_EIN                I3_PID_BDC_AUSSENSPIEGEL_TASTER, 8, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_RECHTS_EIN"
+#define I3_FLD_BDC_STAT_SPIEGEL_TASTER_UNTEN_EIN                 I3_PID_BDC_AUSSENSPIEGEL_TASTER, 10, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_UNTEN_EIN"
+#define I3_FLD_BDC_STAT_SPIEGEL_TASTER_NR                        I3_PID_BDC_AUSSENSPIEGEL_TASTER, 12, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SPIEGEL_TASTER_NR"
+
+// 0xD332 I3_PID_BDC_AUSSENSPIEGEL_KLAPPEN_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SPIEGEL_BEIKLAPPEN_EIN         I3_PID_BDC_AUSSENSPIEGEL_KLAPPEN_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_BEIKLAPPEN_EIN"
+
+// 0xD33A I3_PID_BDC_UGDO_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_UGDO                           I3_PID_BDC_UGDO_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_UGDO"
+
+// 0xD33C I3_PID_BDC_AUSSENSPIEGEL_ABBLENDEN_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SPIEGEL_ABBLENDEN_EIN          I3_PID_BDC_AUSSENSPIEGEL_ABBLENDEN_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_SPIEGEL_ABBLENDEN_EIN"
+
+// 0xD33D I3_PID_BDC_UGDO_LAND
+#define I3_FLD_BDC_STAT_UGDO_LAND_NR                             I3_PID_BDC_UGDO_LAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_UGDO_LAND_NR"
+
+// 0xD33E I3_PID_BDC_UGDO_MODE
+#define I3_FLD_BDC_STAT_UGDO_MODE_NR                             I3_PID_BDC_UGDO_MODE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_UGDO_MODE_NR"
+
+// 0xD343 I3_PID_BDC_KOMPASS_SPIEGEL_VORHANDEN
+#define I3_FLD_BDC_STAT_KOMPASS_SPIEGEL_VORHANDEN_EIN            I3_PID_BDC_KOMPASS_SPIEGEL_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_VORHANDEN_EIN"
+
+// 0xD344 I3_PID_BDC_KOMPASS_SPIEGEL_MAGNET
+#define I3_FLD_BDC_STAT_KOMPASS_SPIEGEL_MAGNET_ZONE_NR           I3_PID_BDC_KOMPASS_SPIEGEL_MAGNET, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_MAGNET_ZONE_NR"
+
+// 0xD345 I3_PID_BDC_KOMPASS_SPIEGEL_SPRACHE
+#define I3_FLD_BDC_STAT_KOMPASS_SPIEGEL_SPRACHE_NR               I3_PID_BDC_KOMPASS_SPIEGEL_SPRACHE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_SPRACHE_NR"
+
+// 0xD346 I3_PID_BDC_KOMPASS_SPIEGEL_LENKUNG
+#define I3_FLD_BDC_STAT_KOMPASS_SPIEGEL_LENKUNG_NR               I3_PID_BDC_KOMPASS_SPIEGEL_LENKUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMPASS_SPIEGEL_LENKUNG_NR"
+
+// 0xD351 I3_PID_BDC_WISCHER_FRONT_MOTOR
+#define I3_FLD_BDC_STAT_MOTOR_FRONTWISCHER_EIN                   I3_PID_BDC_WISCHER_FRONT_MOTOR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_FRONTWISCHER_EIN"
+
+// 0xD353 I3_PID_BDC_WISCHER_HECK_MOTOR
+#define I3_FLD_BDC_STAT_MOTOR_HECKWISCHER_EIN                    I3_PID_BDC_WISCHER_HECK_MOTOR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_HECKWISCHER_EIN"
+
+// 0xD354 I3_PID_BDC_SRA_RELAIS
+#define I3_FLD_BDC_STAT_RELAIS_SRA_EIN                           I3_PID_BDC_SRA_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_SRA_EIN"
+
+// 0xD357 I3_PID_BDC_WASCHWASSERSTAND
+#define I3_FLD_BDC_STAT_WASCHWASSERSTAND_EIN                     I3_PID_BDC_WASCHWASSERSTAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WASCHWASSERSTAND_EIN"
+#define I3_FLD_BDC_STAT_WASCHWASSERSTAND_WERT                    I3_PID_BDC_WASCHWASSERSTAND, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_WASCHWASSERSTAND_WERT"
+
+// 0xD358 I3_PID_BDC_WISCHER_HECK_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_HECKWISCHER_EIN                I3_PID_BDC_WISCHER_HECK_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_HECKWISCHER_EIN"
+
+// 0xD359 I3_PID_BDC_SRA_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SRA                            I3_PID_BDC_SRA_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SRA"
+
+// 0xD35B I3_PID_BDC_LENKSTOCK_WISCHER
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_TASTER_AXIAL_EIN       I3_PID_BDC_LENKSTOCK_WISCHER, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_TASTER_AXIAL_EIN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_FRONTWASCHEN           I3_PID_BDC_LENKSTOCK_WISCHER, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_FRONTWASCHEN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_HECKWASCHEN            I3_PID_BDC_LENKSTOCK_WISCHER, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_HECKWASCHEN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_HECKWISCHEN            I3_PID_BDC_LENKSTOCK_WISCHER, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_HECKWISCHEN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_POS_INTERVALL          I3_PID_BDC_LENKSTOCK_WISCHER, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_POS_INTERVALL"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_NULLSTELLUNG           I3_PID_BDC_LENKSTOCK_WISCHER, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_NULLSTELLUNG"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_POS_1                  I3_PID_BDC_LENKSTOCK_WISCHER, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_POS_1"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_POS_2                  I3_PID_BDC_LENKSTOCK_WISCHER, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_POS_2"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_RAENDEL_NR             I3_PID_BDC_LENKSTOCK_WISCHER, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_RAENDEL_NR"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_TIPPWISCHEN            I3_PID_BDC_LENKSTOCK_WISCHER, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_TIPPWISCHEN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_WISCHER_NR                     I3_PID_BDC_LENKSTOCK_WISCHER, 10, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_WISCHER_NR"
+
+// 0xD35E I3_PID_BDC_WISCHER_FRONT_LIN
+#define I3_FLD_BDC_STAT_VORHANDEN_LIN_FRONTWISCHER               I3_PID_BDC_WISCHER_FRONT_LIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_LIN_FRONTWISCHER"
+
+// 0xD373 I3_PID_BDC_REGENSENSOR_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_REGENSENSOR_EIN                I3_PID_BDC_REGENSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_REGENSENSOR_EIN"
+
+// 0xD375 I3_PID_BDC_REGENSENSOR_INIT
+#define I3_FLD_BDC_STAT_REGENSENSOR_INIT                         I3_PID_BDC_REGENSENSOR_INIT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REGENSENSOR_INIT"
+
+// 0xD376 I3_PID_BDC_REGENSENSOR_INT_WERT
+#define I3_FLD_BDC_STAT_REGEN_INT_WERT                           I3_PID_BDC_REGENSENSOR_INT_WERT, 0, PID_FIELD_SINT16, 0.5f, 0.0f, "STAT_REGEN_INT_WERT"
+#define I3_FLD_BDC_STAT_RESERVE_WERT                             I3_PID_BDC_REGENSENSOR_INT_WERT, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_WERT"
+
+// 0xD3BE I3_PID_BDC_FAHRLICHTSENSOR
+#define I3_FLD_BDC_STAT_FRONTLICHT_WERT                          I3_PID_BDC_FAHRLICHTSENSOR, 0, PID_FIELD_UINT16, 6.7f, 0.0f, "STAT_FRONTLICHT_WERT"
+#define I3_FLD_BDC_STAT_FRONTLICHT_GEMITTELT_WERT                I3_PID_BDC_FAHRLICHTSENSOR, 2, PID_FIELD_UINT16, 6.7f, 0.0f, "STAT_FRONTLICHT_GEMITTELT_WERT"
+#define I3_FLD_BDC_STAT_UMGEBUNGSLICHT_WERT                      I3_PID_BDC_FAHRLICHTSENSOR, 4, PID_FIELD_SINT16, 100.0f, 0.0f, "STAT_UMGEBUNGSLICHT_WERT"
+#define I3_FLD_BDC_STAT_UMGEBUNGSLICHT_GEMITTELT_WERT            I3_PID_BDC_FAHRLICHTSENSOR, 6, PID_FIELD_SINT16, 100.0f, 0.0f, "STAT_UMGEBUNGSLICHT_GEMITTELT_WERT"
+#define I3_FLD_BDC_STAT_HUD_WERT                                 I3_PID_BDC_FAHRLICHTSENSOR, 8, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_HUD_WERT"
+#define I3_FLD_BDC_STAT_RESERVE_WERT_0XD3BE                      I3_PID_BDC_FAHRLICHTSENSOR, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_WERT_0XD3BE"
+
+// 0xD3BF I3_PID_BDC_FAHRLICHTSENSOR_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_FAHRLICHTSENSOR                I3_PID_BDC_FAHRLICHTSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_FAHRLICHTSENSOR"
+
+// 0xD3F0 I3_PID_BDC_HOD_LENKRAD
+#define I3_FLD_BDC_STAT_HOD_STATUS_NR                            I3_PID_BDC_HOD_LENKRAD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HOD_STATUS_NR"
+
+// 0xD3F1 I3_PID_BDC_HOD_ZUSTAND_GAP
+#define I3_FLD_BDC_STAT_ADC_ROHWERT_WERT                         I3_PID_BDC_HOD_ZUSTAND_GAP, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ADC_ROHWERT_WERT"
+
+// 0xD505 I3_PID_BDC_WISCHER_LIN_DATEN_LESEN
+#define I3_FLD_BDC_STAT_ANZAHL_WISCHZYKLEN_WERT                  I3_PID_BDC_WISCHER_LIN_DATEN_LESEN, 0, PID_FIELD_UINT16, 100.0f, 0.0f, "STAT_ANZAHL_WISCHZYKLEN_WERT"
+#define I3_FLD_BDC_STAT_CARCODE                                  I3_PID_BDC_WISCHER_LIN_DATEN_LESEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CARCODE"
+
+// 0xD507 I3_PID_BDC_WISCHER_HECK_MOTOR_2
+#define I3_FLD_BDC_STAT_MOTOR_HECKWISCHER_2_EIN                  I3_PID_BDC_WISCHER_HECK_MOTOR_2, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_HECKWISCHER_2_EIN"
+
+// 0xD52C I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE
+#define I3_FLD_BDC_STAT_INNENLICHT                               I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INNENLICHT"
+#define I3_FLD_BDC_STAT_LESELICHT_LINKS                          I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LESELICHT_LINKS"
+#define I3_FLD_BDC_STAT_LESELICHT_RECHTS                         I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LESELICHT_RECHTS"
+#define I3_FLD_BDC_STAT_WELCOMELIGHT                             I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WELCOMELIGHT"
+#define I3_FLD_BDC_STAT_AMBIENTELICHT                            I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AMBIENTELICHT"
+#define I3_FLD_BDC_STAT_TASTER_LESELICHT_LINKS                   I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_LESELICHT_LINKS"
+#define I3_FLD_BDC_STAT_TASTER_LESELICHT_RECHTS                  I3_PID_BDC_INNENLICHTEINHEIT_DRITTE_SITZREIHE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_LESELICHT_RECHTS"
+
+// 0xD53A I3_PID_BDC_LESELICHT_VORNE
+#define I3_FLD_BDC_STAT_LESELICHT_LINKS_VORNE                    I3_PID_BDC_LESELICHT_VORNE, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LESELICHT_LINKS_VORNE"
+#define I3_FLD_BDC_STAT_LESELICHT_RECHTS_VORNE                   I3_PID_BDC_LESELICHT_VORNE, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LESELICHT_RECHTS_VORNE"
+
+// 0xD53D I3_PID_BDC_LICHTSCHALTER_WBL_TASTER_BEL
+#define I3_FLD_BDC_STAT_TASTER_WBL_BEL_EIN                       I3_PID_BDC_LICHTSCHALTER_WBL_TASTER_BEL, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_TASTER_WBL_BEL_EIN"
+
+// 0xD540 I3_PID_BDC_RUECKWAERTSGANG_SCHALTER
+#define I3_FLD_BDC_STAT_SCHALTER_RUECK_EIN                       I3_PID_BDC_RUECKWAERTSGANG_SCHALTER, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SCHALTER_RUECK_EIN"
+
+// 0xD541 I3_PID_BDC_SCHEINWERFER_GRUNDSTELLUNG_STATUS
+#define I3_FLD_BDC_STAT_GRUNDSTELLUNG_SCHEINWERFER_EIN           I3_PID_BDC_SCHEINWERFER_GRUNDSTELLUNG_STATUS, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_GRUNDSTELLUNG_SCHEINWERFER_EIN"
+
+// 0xD544 I3_PID_BDC_LESELICHT_VORNE_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_LESELICHT_VORNE                I3_PID_BDC_LESELICHT_VORNE_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_LESELICHT_VORNE"
+
+// 0xD545 I3_PID_BDC_LESELICHT_HINTEN_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_LESELICHT_HINTEN               I3_PID_BDC_LESELICHT_HINTEN_VORHANDEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_LESELICHT_HINTEN"
+
+// 0xD548 I3_PID_BDC_LWR_DYNAMISCH_SCHRITTE_REFLAUF
+#define I3_FLD_BDC_STAT_VORHANDEN_LWR_SCHRITTE_REF_LAUF_WERT     I3_PID_BDC_LWR_DYNAMISCH_SCHRITTE_REFLAUF, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_LWR_SCHRITTE_REF_LAUF_WERT"
+
+// 0xD54B I3_PID_BDC_INNENLICHT_HINTEN_TASTER
+#define I3_FLD_BDC_STAT_INNENLICHT_TASTER_HINTEN_EIN             I3_PID_BDC_INNENLICHT_HINTEN_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INNENLICHT_TASTER_HINTEN_EIN"
+
+// 0xD54C I3_PID_BDC_INNENLICHT_VORNE_TASTER
+#define I3_FLD_BDC_STAT_INNENLICHT_TASTER_VORNE_EIN              I3_PID_BDC_INNENLICHT_VORNE_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INNENLICHT_TASTER_VORNE_EIN"
+#define I3_FLD_BDC_STAT_INNENLICHT_VORNE_DAUER_AUS_AKTIV         I3_PID_BDC_INNENLICHT_VORNE_TASTER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INNENLICHT_VORNE_DAUER_AUS_AKTIV"
+
+// 0xD54D I3_PID_BDC_BUS_IN_BELADUNGSSENSOR
+#define I3_FLD_BDC_STAT_BUS_IN_BELADUNGSSENSOR_VORNE_WERT        I3_PID_BDC_BUS_IN_BELADUNGSSENSOR, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BUS_IN_BELADUNGSSENSOR_VORNE_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_BELADUNGSSENSOR_HINTEN_WERT       I3_PID_BDC_BUS_IN_BELADUNGSSENSOR, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BUS_IN_BELADUNGSSENSOR_HINTEN_WERT"
+
+// 0xD54E I3_PID_BDC_LESELICHT_HINTEN_RECHTS_TASTER
+#define I3_FLD_BDC_STAT_TASTER_LESELICHT_HINTEN_RECHTS_EIN       I3_PID_BDC_LESELICHT_HINTEN_RECHTS_TASTER, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_TASTER_LESELICHT_HINTEN_RECHTS_EIN"
+
+// 0xD54F I3_PID_BDC_LWR_MANUELL_POTI
+#define I3_FLD_BDC_STAT_POTI_MAN_LWR_WERT                        I3_PID_BDC_LWR_MANUELL_POTI, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_POTI_MAN_LWR_WERT"
+
+// 0xD550 I3_PID_BDC_LICHTSCHALTEREINHEIT
+#define I3_FLD_BDC_STAT_LICHTSCHALTEREINHEIT_AL_EIN              I3_PID_BDC_LICHTSCHALTEREINHEIT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_AL_EIN"
+#define I3_FLD_BDC_STAT_LICHTSCHALTEREINHEIT_FLC_EIN             I3_PID_BDC_LICHTSCHALTEREINHEIT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_FLC_EIN"
+#define I3_FLD_BDC_STAT_LICHTSCHALTEREINHEIT_NEUTRAL_EIN         I3_PID_BDC_LICHTSCHALTEREINHEIT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_NEUTRAL_EIN"
+#define I3_FLD_BDC_STAT_LICHTSCHALTEREINHEIT_STL_EIN             I3_PID_BDC_LICHTSCHALTEREINHEIT, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_STL_EIN"
+#define I3_FLD_BDC_STAT_LICHTSCHALTEREINHEIT_NR                  I3_PID_BDC_LICHTSCHALTEREINHEIT, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LICHTSCHALTEREINHEIT_NR"
+
+// 0xD552 I3_PID_BDC_LICHTSCHALTER_WBL_TASTER
+#define I3_FLD_BDC_STAT_TASTER_WBL_EIN                           I3_PID_BDC_LICHTSCHALTER_WBL_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_WBL_EIN"
+
+// 0xD553 I3_PID_BDC_LESELICHT_HINTEN
+#define I3_FLD_BDC_STAT_LESELICHT_LINKS_HINTEN                   I3_PID_BDC_LESELICHT_HINTEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LESELICHT_LINKS_HINTEN"
+#define I3_FLD_BDC_STAT_LESELICHT_RECHTS_HINTEN                  I3_PID_BDC_LESELICHT_HINTEN, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LESELICHT_RECHTS_HINTEN"
+
+// 0xD555 I3_PID_BDC_PIA_FLA_FOLLOW
+#define I3_FLD_BDC_STAT_PIA_FLA_EIN                              I3_PID_BDC_PIA_FLA_FOLLOW, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_FLA_EIN"
+#define I3_FLD_BDC_STAT_PIA_FOLLOW_ME_HOME_ZEIT_WERT             I3_PID_BDC_PIA_FLA_FOLLOW, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_FOLLOW_ME_HOME_ZEIT_WERT"
+#define I3_FLD_BDC_STAT_PIA_WELCOMELIGHT_EIN                     I3_PID_BDC_PIA_FLA_FOLLOW, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_WELCOMELIGHT_EIN"
+
+// 0xD557 I3_PID_BDC_SCHALTERBELEUCHTUNG_RAENDELRAD
+#define I3_FLD_BDC_STAT_POTI_DIMMUNG_WERT                        I3_PID_BDC_SCHALTERBELEUCHTUNG_RAENDELRAD, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_POTI_DIMMUNG_WERT"
+
+// 0xD559 I3_PID_BDC_PIA_ABBIEGELICHT
+#define I3_FLD_BDC_STAT_PIA_ABBIEGELICHT_PIA_EIN                 I3_PID_BDC_PIA_ABBIEGELICHT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_ABBIEGELICHT_PIA_EIN"
+
+// 0xD55E I3_PID_BDC_PIA_TIPPBLINKEN
+#define I3_FLD_BDC_STAT_PIA_MIND_ANZAHL_BLINKZYKLEN_BEI_TIPP_WERT I3_PID_BDC_PIA_TIPPBLINKEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_MIND_ANZAHL_BLINKZYKLEN_BEI_TIPP_WERT"
+#define I3_FLD_BDC_STAT_PIA_QUITT_BLINK_ENTRIEGELN_EIN           I3_PID_BDC_PIA_TIPPBLINKEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_QUITT_BLINK_ENTRIEGELN_EIN"
+#define I3_FLD_BDC_STAT_PIA_QUITT_BLINK_SICHERN_EIN              I3_PID_BDC_PIA_TIPPBLINKEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_QUITT_BLINK_SICHERN_EIN"
+
+// 0xD55F I3_PID_BDC_LWR_MANUELL
+#define I3_FLD_BDC_STAT_MAN_LWR_MAXPOS_WERT                      I3_PID_BDC_LWR_MANUELL, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MAN_LWR_MAXPOS_WERT"
+#define I3_FLD_BDC_STAT_MAN_LWR_MINPOS_WERT                      I3_PID_BDC_LWR_MANUELL, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MAN_LWR_MINPOS_WERT"
+#define I3_FLD_BDC_STAT_MAN_LWR_LINKS_WERT                       I3_PID_BDC_LWR_MANUELL, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MAN_LWR_LINKS_WERT"
+#define I3_FLD_BDC_STAT_MAN_LWR_RECHTS_WERT                      I3_PID_BDC_LWR_MANUELL, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MAN_LWR_RECHTS_WERT"
+
+// 0xD573 I3_PID_BDC_PIA_TAGFAHRLICHT
+#define I3_FLD_BDC_STAT_PIA_TAGFAHRLICHT_EIN                     I3_PID_BDC_PIA_TAGFAHRLICHT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIA_TAGFAHRLICHT_EIN"
+
+// 0xD57B I3_PID_BDC_INNENLICHT_HINTEN
+#define I3_FLD_BDC_STAT_INNENLICHT_HINTEN_EIN                    I3_PID_BDC_INNENLICHT_HINTEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_INNENLICHT_HINTEN_EIN"
+#define I3_FLD_BDC_STAT_INNENLICHT_HINTEN_WERT                   I3_PID_BDC_INNENLICHT_HINTEN, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_INNENLICHT_HINTEN_WERT"
+
+// 0xD57E I3_PID_BDC_LWR_MODUS
+#define I3_FLD_BDC_STAT_KEINE_LWR_EIN                            I3_PID_BDC_LWR_MODUS, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_KEINE_LWR_EIN"
+#define I3_FLD_BDC_STAT_MAN_LWR_EIN                              I3_PID_BDC_LWR_MODUS, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MAN_LWR_EIN"
+#define I3_FLD_BDC_STAT_AUT_LWR_EIN                              I3_PID_BDC_LWR_MODUS, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUT_LWR_EIN"
+#define I3_FLD_BDC_STAT_DYN_LWR_EIN                              I3_PID_BDC_LWR_MODUS, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_DYN_LWR_EIN"
+
+// 0xD57F I3_PID_BDC_INNENLICHT_KLEMME_VA
+#define I3_FLD_BDC_STAT_INNENLICHT_KLEMME_VA_EIN                 I3_PID_BDC_INNENLICHT_KLEMME_VA, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_INNENLICHT_KLEMME_VA_EIN"
+#define I3_FLD_BDC_STAT_INNENLICHT_KLEMME_VA_NACHLAUFZEIT_WERT   I3_PID_BDC_INNENLICHT_KLEMME_VA, 2, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_INNENLICHT_KLEMME_VA_NACHLAUFZEIT_WERT"
+
+// 0xD580 I3_PID_BDC_LENKSTOCK_BLINKER_TASTER_FLA
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_TASTER_FLA_EIN         I3_PID_BDC_LENKSTOCK_BLINKER_TASTER_FLA, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_TASTER_FLA_EIN"
+
+// 0xD581 I3_PID_BDC_LENKSTOCK_BLINKER_TASTER_BC
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_TASTER_BC_EIN          I3_PID_BDC_LENKSTOCK_BLINKER_TASTER_BC, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_TASTER_BC_EIN"
+
+// 0xD582 I3_PID_BDC_LENKSTOCK_BLINKER_FRA
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_LINKS_EIN              I3_PID_BDC_LENKSTOCK_BLINKER_FRA, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_LINKS_EIN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_LINKS_DAUER_EIN        I3_PID_BDC_LENKSTOCK_BLINKER_FRA, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_LINKS_DAUER_EIN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_RECHTS_EIN             I3_PID_BDC_LENKSTOCK_BLINKER_FRA, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_RECHTS_EIN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_RECHTS_DAUER_EIN       I3_PID_BDC_LENKSTOCK_BLINKER_FRA, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_RECHTS_DAUER_EIN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_NULLSTELLUNG_EIN       I3_PID_BDC_LENKSTOCK_BLINKER_FRA, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_NULLSTELLUNG_EIN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_NR                     I3_PID_BDC_LENKSTOCK_BLINKER_FRA, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_NR"
+
+// 0xD583 I3_PID_BDC_LENKSTOCK_BLINKER_LICHTHUPE_FERNLICHT
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_FERNLICHT_BETAETIGT    I3_PID_BDC_LENKSTOCK_BLINKER_LICHTHUPE_FERNLICHT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_FERNLICHT_BETAETIGT"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_LICHTHUPE_BETAETIGT    I3_PID_BDC_LENKSTOCK_BLINKER_LICHTHUPE_FERNLICHT, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_LICHTHUPE_BETAETIGT"
+
+// 0xD585 I3_PID_BDC_LENKSTOCK_BLINKER_WIPPE
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_WIPPE_NACH_OBEN        I3_PID_BDC_LENKSTOCK_BLINKER_WIPPE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_WIPPE_NACH_OBEN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_WIPPE_NACH_UNTEN       I3_PID_BDC_LENKSTOCK_BLINKER_WIPPE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_WIPPE_NACH_UNTEN"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_WIPPE_NULLSTELLUNG     I3_PID_BDC_LENKSTOCK_BLINKER_WIPPE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_WIPPE_NULLSTELLUNG"
+#define I3_FLD_BDC_STAT_LENKSTOCK_BLINKER_TASTER_WIPPE_NR        I3_PID_BDC_LENKSTOCK_BLINKER_WIPPE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LENKSTOCK_BLINKER_TASTER_WIPPE_NR"
+
+// 0xD587 I3_PID_BDC_LESELICHT_HINTEN_LINKS_TASTER
+#define I3_FLD_BDC_STAT_TASTER_LESELICHT_HINTEN_LINKS_EIN        I3_PID_BDC_LESELICHT_HINTEN_LINKS_TASTER, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_TASTER_LESELICHT_HINTEN_LINKS_EIN"
+
+// 0xD588 I3_PID_BDC_LESELICHT_VORNE_RECHTS_TASTER
+#define I3_FLD_BDC_STAT_TASTER_LESELICHT_VORNE_RECHTS_EIN        I3_PID_BDC_LESELICHT_VORNE_RECHTS_TASTER, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_TASTER_LESELICHT_VORNE_RECHTS_EIN"
+
+// 0xD589 I3_PID_BDC_LESELICHT_VORNE_LINKS_TASTER
+#define I3_FLD_BDC_STAT_TASTER_LESELICHT_VORNE_LINKS_EIN         I3_PID_BDC_LESELICHT_VORNE_LINKS_TASTER, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_TASTER_LESELICHT_VORNE_LINKS_EIN"
+
+// 0xD58A I3_PID_BDC_LWR_POSITION_MIN_MAX
+#define I3_FLD_BDC_STAT_LWR_POSITION_MAX_EIN                     I3_PID_BDC_LWR_POSITION_MIN_MAX, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_POSITION_MAX_EIN"
+#define I3_FLD_BDC_STAT_LWR_POSITION_MIN_EIN                     I3_PID_BDC_LWR_POSITION_MIN_MAX, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_POSITION_MIN_EIN"
+
+// 0xD58B I3_PID_BDC_LICHTSCHALTER_NSW_TASTER
+#define I3_FLD_BDC_STAT_TASTER_NSW_EIN                           I3_PID_BDC_LICHTSCHALTER_NSW_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_NSW_EIN"
+
+// 0xD58C I3_PID_BDC_LICHTSCHALTER_NSL_TASTER
+#define I3_FLD_BDC_STAT_TASTER_NSL_EIN                           I3_PID_BDC_LICHTSCHALTER_NSL_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_NSL_EIN"
+
+// 0xD5D3 I3_PID_BDC_AMBIENTE_BELEUCHTUNG
+#define I3_FLD_BDC_STAT_AMBIENTE_EIN                             I3_PID_BDC_AMBIENTE_BELEUCHTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AMBIENTE_EIN"
+#define I3_FLD_BDC_STAT_AMBIENTE_WERT                            I3_PID_BDC_AMBIENTE_BELEUCHTUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AMBIENTE_WERT"
+
+// 0xD5DE I3_PID_BDC_INNENLICHT_MAPPING
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_0                           I3_PID_BDC_INNENLICHT_MAPPING, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_0"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_1                           I3_PID_BDC_INNENLICHT_MAPPING, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_1"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_2                           I3_PID_BDC_INNENLICHT_MAPPING, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_2"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_3                           I3_PID_BDC_INNENLICHT_MAPPING, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_3"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_4                           I3_PID_BDC_INNENLICHT_MAPPING, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_4"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_5                           I3_PID_BDC_INNENLICHT_MAPPING, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_5"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_6                           I3_PID_BDC_INNENLICHT_MAPPING, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_6"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_7                           I3_PID_BDC_INNENLICHT_MAPPING, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_7"
+#define I3_FLD_BDC_STAT_BELEGUNG_LCI_8                           I3_PID_BDC_INNENLICHT_MAPPING, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BELEGUNG_LCI_8"
+
+// 0xD5E5 I3_PID_BDC_AHL_LWR_TMS_ID_LESEN
+#define I3_FLD_BDC_STAT_TMS_ID_LINKS_WERT                        I3_PID_BDC_AHL_LWR_TMS_ID_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TMS_ID_LINKS_WERT"
+#define I3_FLD_BDC_STAT_TMS_ID_RECHTS_WERT                       I3_PID_BDC_AHL_LWR_TMS_ID_LESEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TMS_ID_RECHTS_WERT"
+
+// 0xD601 I3_PID_BDC_HOEHENSTAENDE_SENSOREN
+#define I3_FLD_BDC_STAT_HOEHENSTAND_ROHWERT_VR_WERT              I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 0, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_HOEHENSTAND_ROHWERT_VR_WERT"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_ROHWERT_HR_WERT              I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 2, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_HOEHENSTAND_ROHWERT_HR_WERT"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_SENSOR_VR_NR                 I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_HOEHENSTAND_SENSOR_VR_NR"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_SENSOR_HR_NR                 I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_HOEHENSTAND_SENSOR_HR_NR"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_VR_NR                        I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HOEHENSTAND_VR_NR"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_HR_NR                        I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HOEHENSTAND_HR_NR"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_VR_NR_1                      I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HOEHENSTAND_VR_NR_1"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_HR_NR_1                      I3_PID_BDC_HOEHENSTAENDE_SENSOREN, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HOEHENSTAND_HR_NR_1"
+
+// 0xD603 I3_PID_BDC_HOEHENSTAENDE_VERSORGUNG
+#define I3_FLD_BDC_STAT_HOEHENSTAND_VERSORGUNG_VR_WERT           I3_PID_BDC_HOEHENSTAENDE_VERSORGUNG, 0, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_HOEHENSTAND_VERSORGUNG_VR_WERT"
+#define I3_FLD_BDC_STAT_HOEHENSTAND_VERSORGUNG_HR_WERT           I3_PID_BDC_HOEHENSTAENDE_VERSORGUNG, 2, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_HOEHENSTAND_VERSORGUNG_HR_WERT"
+
+// 0xD604 I3_PID_BDC_HOEHENSTAENDE_KALIBRIERUNG_LESEN
+
+// 0xD611 I3_PID_BDC_STATUS_FES_MODUS
+#define I3_FLD_BDC_STAT_FES_MODUS                                I3_PID_BDC_STATUS_FES_MODUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FES_MODUS"
+
+// 0xD612 I3_PID_BDC_STATUS_FES_STATISTIK
+#define I3_FLD_BDC_STAT_ECO_GRUPPE_WERT                          I3_PID_BDC_STATUS_FES_STATISTIK, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ECO_GRUPPE_WERT"
+#define I3_FLD_BDC_STAT_COMFORT_GRUPPE_WERT                      I3_PID_BDC_STATUS_FES_STATISTIK, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_COMFORT_GRUPPE_WERT"
+#define I3_FLD_BDC_STAT_SONSTIGE_WERT                            I3_PID_BDC_STATUS_FES_STATISTIK, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SONSTIGE_WERT"
+
+// 0xD622 I3_PID_BDC_SWITCH_BOARD_TASTEN
+#define I3_FLD_BDC_RES_0xD622_D                                  I3_PID_BDC_SWITCH_BOARD_TASTEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0xD622_D"
+
+// 0xD625 I3_PID_BDC_STATUS_FES_DATEN
+#define I3_FLD_BDC_STAT_FES_LASTMODE                             I3_PID_BDC_STATUS_FES_DATEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FES_LASTMODE"
+#define I3_FLD_BDC_STAT_FES_SLEEPTIME_WERT                       I3_PID_BDC_STATUS_FES_DATEN, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FES_SLEEPTIME_WERT"
+
+// 0xD627 I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU
+#define I3_FLD_BDC_STAT_VERBAU_HDC_TASTE                         I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBAU_HDC_TASTE"
+#define I3_FLD_BDC_STAT_VERBAU_PDC_TASTE                         I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBAU_PDC_TASTE"
+#define I3_FLD_BDC_STAT_VERBAU_SV_TASTE                          I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBAU_SV_TASTE"
+#define I3_FLD_BDC_STAT_VERBAU_DSC_TASTE                         I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBAU_DSC_TASTE"
+#define I3_FLD_BDC_STAT_VERBAU_FES_WIPPE                         I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBAU_FES_WIPPE"
+#define I3_FLD_BDC_STAT_VERBAU_HUD_TASTE                         I3_PID_BDC_SWITCHBOARD_TASTE_VERBAU, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBAU_HUD_TASTE"
+
+// 0xD62B I3_PID_BDC_AUSSTATTUNG_CORONA_LED
+#define I3_FLD_BDC_STAT_VORHANDEN_CORONA_LED                     I3_PID_BDC_AUSSTATTUNG_CORONA_LED, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_VORHANDEN_CORONA_LED"
+
+// 0xD62D I3_PID_BDC_FES_MASTER_SW_FEHLER_INFO
+#define I3_FLD_BDC_STAT_FES_MASTER_SW_FEHLER_INFO_WERT           I3_PID_BDC_FES_MASTER_SW_FEHLER_INFO, 0, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_FES_MASTER_SW_FEHLER_INFO_WERT"
+
+// 0xD669 I3_PID_BDC_SWITCH_BOARD_TASTEN_VERBAU
+#define I3_FLD_BDC_RES_0xD669_D                                  I3_PID_BDC_SWITCH_BOARD_TASTEN_VERBAU, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0xD669_D"
+
+// 0xD672 I3_PID_BDC_KUEHLMITTELSTAND
+#define I3_FLD_BDC_STAT_KUEHLMITTELSTAND_EIN                     I3_PID_BDC_KUEHLMITTELSTAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KUEHLMITTELSTAND_EIN"
+#define I3_FLD_BDC_STAT_KUEHLMITTELSTAND_WERT                    I3_PID_BDC_KUEHLMITTELSTAND, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLMITTELSTAND_WERT"
+
+// 0xD71A I3_PID_BDC_GURTZUBRINGER_FA
+#define I3_FLD_BDC_STAT_GZB_FA_POS_WERT                          I3_PID_BDC_GURTZUBRINGER_FA, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GZB_FA_POS_WERT"
+#define I3_FLD_BDC_STAT_GZB_FA_ENDLAGE_EIN                       I3_PID_BDC_GURTZUBRINGER_FA, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GZB_FA_ENDLAGE_EIN"
+
+// 0xD71B I3_PID_BDC_GURTZUBRINGER_BF
+#define I3_FLD_BDC_STAT_GZB_BF_POS_WERT                          I3_PID_BDC_GURTZUBRINGER_BF, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GZB_BF_POS_WERT"
+#define I3_FLD_BDC_STAT_GZB_BF_ENDLAGE_EIN                       I3_PID_BDC_GURTZUBRINGER_BF, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GZB_BF_ENDLAGE_EIN"
+
+// 0xD726 I3_PID_BDC_SITZHEIZUNG_FA_VORHANDEN
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FA_VORHANDEN                 I3_PID_BDC_SITZHEIZUNG_FA_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_VORHANDEN"
+
+// 0xD727 I3_PID_BDC_SITZHEIZUNG_BF_VORHANDEN
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BF_VORHANDEN                 I3_PID_BDC_SITZHEIZUNG_BF_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_VORHANDEN"
+
+// 0xD728 I3_PID_BDC_SITZHEIZUNG_FAH_VORHANDEN
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FAH_VORHANDEN                I3_PID_BDC_SITZHEIZUNG_FAH_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_VORHANDEN"
+
+// 0xD729 I3_PID_BDC_SITZHEIZUNG_BFH_VORHANDEN
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BFH_VORHANDEN                I3_PID_BDC_SITZHEIZUNG_BFH_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_VORHANDEN"
+
+// 0xD72D I3_PID_BDC_BUS_IN_SITZHEIZUNG_STUFE_BF
+#define I3_FLD_BDC_STAT_BUS_IN_SITZHEIZUNG_BF_NR                 I3_PID_BDC_BUS_IN_SITZHEIZUNG_STUFE_BF, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_SITZHEIZUNG_BF_NR"
+
+// 0xD730 I3_PID_BDC_SITZHEIZUNG_BF
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BF_EIN                       I3_PID_BDC_SITZHEIZUNG_BF, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BF_VERBRAUCHSREDUZIERUNG_EIN I3_PID_BDC_SITZHEIZUNG_BF, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_VERBRAUCHSREDUZIERUNG_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BF_NOTBETRIEB_EIN            I3_PID_BDC_SITZHEIZUNG_BF, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_NOTBETRIEB_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BF_TIMEOUT                   I3_PID_BDC_SITZHEIZUNG_BF, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BF_TIMEOUT"
+
+// 0xD731 I3_PID_BDC_BUS_IN_SITZHEIZUNG_STUFE_FA
+#define I3_FLD_BDC_STAT_BUS_IN_SITZHEIZUNG_FA_NR                 I3_PID_BDC_BUS_IN_SITZHEIZUNG_STUFE_FA, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_SITZHEIZUNG_FA_NR"
+
+// 0xD762 I3_PID_BDC_VORHANDEN_DRITTE_SITZREIHE_EIN
+#define I3_FLD_BDC_STAT_VORHANDEN_DRITTE_SITZREIHE_EIN           I3_PID_BDC_VORHANDEN_DRITTE_SITZREIHE_EIN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_DRITTE_SITZREIHE_EIN"
+
+// 0xD763 I3_PID_BDC_VERRIEGELUNG_ZWEITE_SITZREIHE
+#define I3_FLD_BDC_STAT_VERRIEGELUNG_ZWEITE_SITZREIHE_EIN        I3_PID_BDC_VERRIEGELUNG_ZWEITE_SITZREIHE, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERRIEGELUNG_ZWEITE_SITZREIHE_EIN"
+
+// 0xD771 I3_PID_BDC_SITZHEIZUNG_FA
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FA_EIN                       I3_PID_BDC_SITZHEIZUNG_FA, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FA_VERBRAUCHSREDUZIERUNG_EIN I3_PID_BDC_SITZHEIZUNG_FA, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_VERBRAUCHSREDUZIERUNG_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FA_NOTBETRIEB_EIN            I3_PID_BDC_SITZHEIZUNG_FA, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_NOTBETRIEB_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FA_TIMEOUT                   I3_PID_BDC_SITZHEIZUNG_FA, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FA_TIMEOUT"
+
+// 0xD7EA I3_PID_BDC_SITZHEIZUNG_FAH
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FAH_EIN                      I3_PID_BDC_SITZHEIZUNG_FAH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FAH_VERBRAUCHSREDUZIERUNG_EIN I3_PID_BDC_SITZHEIZUNG_FAH, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_VERBRAUCHSREDUZIERUNG_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FAH_NOTBETRIEB_EIN           I3_PID_BDC_SITZHEIZUNG_FAH, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_NOTBETRIEB_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_FAH_TIMEOUT                  I3_PID_BDC_SITZHEIZUNG_FAH, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_FAH_TIMEOUT"
+
+// 0xD7EC I3_PID_BDC_SITZHEIZUNG_BFH
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BFH_EIN                      I3_PID_BDC_SITZHEIZUNG_BFH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BFH_VERBRAUCHSREDUZIERUNG_EIN I3_PID_BDC_SITZHEIZUNG_BFH, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_VERBRAUCHSREDUZIERUNG_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BFH_NOTBETRIEB_EIN           I3_PID_BDC_SITZHEIZUNG_BFH, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_NOTBETRIEB_EIN"
+#define I3_FLD_BDC_STAT_SITZHEIZUNG_BFH_TIMEOUT                  I3_PID_BDC_SITZHEIZUNG_BFH, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SITZHEIZUNG_BFH_TIMEOUT"
+
+// 0xD86C I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SITZHEIZUNG_TASTER_HINTEN      I3_PID_BDC_SITZHEIZUNG_HINTEN_TASTER_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SITZHEIZUNG_TASTER_HINTEN"
+
+// 0xD8AA I3_PID_BDC_VORHANDEN_FONDSCHICHTUNG
+#define I3_FLD_BDC_STAT_VORHANDEN_FONDSCHICHTUNGSPOTI            I3_PID_BDC_VORHANDEN_FONDSCHICHTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_FONDSCHICHTUNGSPOTI"
+
+// 0xD8AB I3_PID_BDC_SOLARSENSOR_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_SOLARSENSOR_EIN                I3_PID_BDC_SOLARSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SOLARSENSOR_EIN"
+
+// 0xD8AC I3_PID_BDC_AUC_SENSOR_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_AUC_SENSOR                     I3_PID_BDC_AUC_SENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_AUC_SENSOR"
+
+// 0xD8FE I3_PID_BDC_FENSTERHEBER_VORHANDEN
+#define I3_FLD_BDC_STAT_ANZAHL_FH_KODIERT                        I3_PID_BDC_FENSTERHEBER_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_FH_KODIERT"
+
+// 0xD906 I3_PID_BDC_KLIMAKOMPRESSOR
+#define I3_FLD_BDC_STAT_KLIMAKOMPRESSOR_EIN                      I3_PID_BDC_KLIMAKOMPRESSOR, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_KLIMAKOMPRESSOR_EIN"
+#define I3_FLD_BDC_STAT_KLIMAKOMPRESSOR_PWM_WERT                 I3_PID_BDC_KLIMAKOMPRESSOR, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMAKOMPRESSOR_PWM_WERT"
+
+// 0xD916 I3_PID_BDC_VORHANDEN_KOMPRESSORKUPPLUNG
+#define I3_FLD_BDC_RES_0xD916_D                                  I3_PID_BDC_VORHANDEN_KOMPRESSORKUPPLUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0xD916_D"
+
+// 0xD959 I3_PID_BDC_DRUCKSENSOR_VORHANDEN
+#define I3_FLD_BDC_STAT_DRUCKSENSOR_VORHANDEN                    I3_PID_BDC_DRUCKSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DRUCKSENSOR_VORHANDEN"
+
+// 0xD95A I3_PID_BDC_VORHANDEN_WASSERVENTIL
+#define I3_FLD_BDC_STAT_VORHANDEN_WASSERVENTIL_MONO              I3_PID_BDC_VORHANDEN_WASSERVENTIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_MONO"
+#define I3_FLD_BDC_STAT_VORHANDEN_WASSERVENTIL_DUO               I3_PID_BDC_VORHANDEN_WASSERVENTIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_DUO"
+
+// 0xD961 I3_PID_BDC_SOLARSENSOR
+#define I3_FLD_BDC_STAT_SOLARSENSOR_FA_WERT                      I3_PID_BDC_SOLARSENSOR, 0, PID_FIELD_UINT16, 4.0158f, 0.0f, "STAT_SOLARSENSOR_FA_WERT"
+#define I3_FLD_BDC_STAT_SOLARSENSOR_BF_WERT                      I3_PID_BDC_SOLARSENSOR, 2, PID_FIELD_UINT16, 4.0158f, 0.0f, "STAT_SOLARSENSOR_BF_WERT"
+
+// 0xD963 I3_PID_BDC_AUC_SENSOR
+#define I3_FLD_BDC_STAT_AUC_SENSOR_NR                            I3_PID_BDC_AUC_SENSOR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUC_SENSOR_NR"
+
+// 0xD967 I3_PID_BDC_DRUCKSENSOR
+#define I3_FLD_BDC_STAT_R134A_DRUCK_WERT                         I3_PID_BDC_DRUCKSENSOR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_R134A_DRUCK_WERT"
+
+// 0xD96C I3_PID_BDC_BESCHLAGSENSOR
+#define I3_FLD_BDC_STAT_BESCHLAGSENSOR_WERT                      I3_PID_BDC_BESCHLAGSENSOR, 0, PID_FIELD_SINT16, 0.5f, 0.0f, "STAT_BESCHLAGSENSOR_WERT"
+#define I3_FLD_BDC_STAT_BESCHLAGSENSOR_TEMP_WERT                 I3_PID_BDC_BESCHLAGSENSOR, 2, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BESCHLAGSENSOR_TEMP_WERT"
+
+// 0xD96D I3_PID_BDC_BESCHLAGSENSOR_VORHANDEN
+#define I3_FLD_BDC_STAT_VORHANDEN_BESCHLAGSENSOR                 I3_PID_BDC_BESCHLAGSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_BESCHLAGSENSOR"
+
+// 0xD96E I3_PID_BDC_FONDSCHICHTUNGS_POTI
+#define I3_FLD_BDC_STAT_FONDSCHICHTUNGS_POTI_WERT                I3_PID_BDC_FONDSCHICHTUNGS_POTI, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FONDSCHICHTUNGS_POTI_WERT"
+
+// 0xD9B8 I3_PID_BDC_DRUCKSENSOR_HOCHAUFLOESEND
+#define I3_FLD_BDC_STAT_DRUCK_WERT                               I3_PID_BDC_DRUCKSENSOR_HOCHAUFLOESEND, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_DRUCK_WERT"
+
+// 0xDA24 I3_PID_BDC_LENKRAD_SCHALTPADDLES
+#define I3_FLD_BDC_STAT_LENKRAD_SCHALTPADDLE_NR                  I3_PID_BDC_LENKRAD_SCHALTPADDLES, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LENKRAD_SCHALTPADDLE_NR"
+#define I3_FLD_BDC_STAT_SCHALTPADDLES_AD_WERT                    I3_PID_BDC_LENKRAD_SCHALTPADDLES, 1, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SCHALTPADDLES_AD_WERT"
+
+// 0xDA54 I3_PID_BDC_DC_DC_WANDLER_VORHANDEN
+#define I3_FLD_BDC_STAT_DC_DC_WANDLER_1_VORHANDEN                I3_PID_BDC_DC_DC_WANDLER_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DC_DC_WANDLER_1_VORHANDEN"
+#define I3_FLD_BDC_STAT_DC_DC_WANDLER_2_VORHANDEN                I3_PID_BDC_DC_DC_WANDLER_VORHANDEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DC_DC_WANDLER_2_VORHANDEN"
+
+// 0xDA5F I3_PID_BDC_STAT_LIN_LAYERING
+#define I3_FLD_BDC_STAT_SLAVE_NAME_1_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_1_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_1_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_1_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_1_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_1_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_1_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_1_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_1_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_1_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_1_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_1_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_1_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_1_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_1_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_1_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_1_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_1_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_1_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_1_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_2_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_2_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_2_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_2_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_2_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_2_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_2_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_2_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_2_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_2_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_2_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_2_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_2_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_2_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_2_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_2_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_2_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_2_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_2_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_2_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_3_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_3_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_3_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_3_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_3_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_3_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_3_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_3_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_3_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_3_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_3_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_3_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_3_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_3_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_3_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_3_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_3_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_3_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_3_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_3_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_4_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_4_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_4_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_4_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_4_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_4_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_4_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_4_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_4_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_4_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_4_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_4_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_4_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_4_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_4_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_4_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_4_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_4_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_4_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_4_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_5_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_5_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_5_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_5_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_5_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_5_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_5_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_5_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_5_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_5_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_5_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_5_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_5_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_5_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_5_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_5_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_5_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_5_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_5_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_5_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_6_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_6_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_6_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_6_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_6_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_6_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_6_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_6_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_6_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 54, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_6_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_6_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_6_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_6_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_6_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_6_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_6_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_6_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_6_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_6_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 59, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_6_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_7_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 60, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_7_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_7_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_7_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_7_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_7_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_7_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_7_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_7_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 64, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_7_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_7_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_7_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_7_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_7_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_7_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_7_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_7_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_7_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_7_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_7_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_8_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 70, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_8_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_8_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_8_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_8_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_8_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_8_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_8_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_8_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_8_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_8_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 75, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_8_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_8_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_8_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_8_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_8_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_8_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_8_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_8_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_8_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_9_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 80, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_9_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_9_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_9_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_9_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_9_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_9_WERT                           I3_PID_BDC_STAT_LIN_LAYERING, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_9_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_9_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 84, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_9_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_9_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 85, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_9_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_9_WERT                I3_PID_BDC_STAT_LIN_LAYERING, 86, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_9_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_9_WERT                   I3_PID_BDC_STAT_LIN_LAYERING, 87, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_9_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_9_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 88, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_9_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_9_WERT                     I3_PID_BDC_STAT_LIN_LAYERING, 89, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_9_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_10_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 90, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_10_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_10_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 91, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_10_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_10_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 92, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_10_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_10_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 93, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_10_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_10_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 94, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_10_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_10_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 95, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_10_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_10_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 96, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_10_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_10_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 97, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_10_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_10_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 98, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_10_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_10_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 99, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_10_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_11_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 100, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_11_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_11_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 101, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_11_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_11_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 102, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_11_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_11_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 103, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_11_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_11_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 104, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_11_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_11_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 105, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_11_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_11_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 106, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_11_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_11_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 107, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_11_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_11_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 108, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_11_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_11_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 109, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_11_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_12_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 110, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_12_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_12_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 111, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_12_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_12_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 112, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_12_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_12_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 113, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_12_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_12_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 114, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_12_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_12_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 115, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_12_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_12_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 116, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_12_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_12_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 117, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_12_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_12_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 118, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_12_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_12_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 119, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_12_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_13_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 120, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_13_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_13_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 121, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_13_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_13_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 122, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_13_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_13_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 123, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_13_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_13_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 124, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_13_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_13_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 125, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_13_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_13_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 126, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_13_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_13_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 127, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_13_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_13_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 128, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_13_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_13_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 129, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_13_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_14_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 130, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_14_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_14_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 131, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_14_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_14_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 132, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_14_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_14_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 133, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_14_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_14_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 134, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_14_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_14_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 135, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_14_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_14_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 136, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_14_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_14_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 137, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_14_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_14_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 138, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_14_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_14_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 139, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_14_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_15_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 140, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_15_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_15_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 141, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_15_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_15_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 142, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_15_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_15_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 143, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_15_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_15_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 144, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_15_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_15_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 145, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_15_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_15_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 146, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_15_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_15_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 147, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_15_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_15_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 148, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_15_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_15_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 149, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_15_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_16_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 150, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_16_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_16_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 151, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_16_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_16_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 152, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_16_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_16_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 153, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_16_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_16_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 154, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_16_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_16_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 155, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_16_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_16_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 156, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_16_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_16_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 157, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_16_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_16_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 158, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_16_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_16_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 159, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_16_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_17_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 160, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_17_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_17_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 161, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_17_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_17_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 162, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_17_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_17_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 163, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_17_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_17_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 164, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_17_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_17_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 165, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_17_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_17_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 166, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_17_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_17_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 167, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_17_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_17_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 168, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_17_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_17_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 169, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_17_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_18_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 170, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_18_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_18_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 171, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_18_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_18_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 172, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_18_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_18_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 173, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_18_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_18_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 174, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_18_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_18_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 175, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_18_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_18_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 176, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_18_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_18_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 177, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_18_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_18_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 178, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_18_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_18_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 179, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_18_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_19_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 180, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_19_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_19_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 181, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_19_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_19_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 182, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_19_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_19_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 183, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_19_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_19_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 184, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_19_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_19_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 185, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_19_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_19_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 186, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_19_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_19_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 187, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_19_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_19_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 188, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_19_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_19_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 189, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_19_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_20_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 190, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_20_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_20_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 191, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_20_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_20_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 192, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_20_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_20_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 193, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_20_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_20_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 194, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_20_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_20_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 195, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_20_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_20_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 196, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_20_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_20_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 197, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_20_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_20_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 198, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_20_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_20_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 199, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_20_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_21_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 200, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_21_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_21_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 201, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_21_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_21_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 202, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_21_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_21_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 203, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_21_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_21_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 204, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_21_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_21_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 205, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_21_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_21_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 206, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_21_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_21_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 207, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_21_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_21_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 208, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_21_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_21_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 209, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_21_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_22_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 210, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_22_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_22_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 211, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_22_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_22_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 212, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_22_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_22_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 213, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_22_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_22_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 214, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_22_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_22_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 215, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_22_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_22_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 216, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_22_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_22_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 217, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_22_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_22_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 218, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_22_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_22_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 219, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_22_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_23_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 220, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_23_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_23_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 221, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_23_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_23_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 222, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_23_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_23_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 223, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_23_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_23_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 224, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_23_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_23_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 225, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_23_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_23_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 226, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_23_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_23_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 227, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_23_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_23_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 228, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_23_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_23_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 229, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_23_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_24_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 230, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_24_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_24_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 231, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_24_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_24_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 232, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_24_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_24_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 233, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_24_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_24_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 234, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_24_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_24_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 235, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_24_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_24_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 236, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_24_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_24_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 237, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_24_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_24_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 238, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_24_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_24_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 239, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_24_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_25_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 240, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_25_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_25_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 241, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_25_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_25_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 242, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_25_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_25_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 243, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_25_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_25_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 244, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_25_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_25_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 245, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_25_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_25_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 246, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_25_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_25_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 247, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_25_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_25_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 248, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_25_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_25_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 249, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_25_WERT"
+#define I3_FLD_BDC_STAT_SLAVE_NAME_26_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 250, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLAVE_NAME_26_WERT"
+#define I3_FLD_BDC_STAT_LED_BLUE_26_WERT                         I3_PID_BDC_STAT_LIN_LAYERING, 251, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_BLUE_26_WERT"
+#define I3_FLD_BDC_STAT_LED_GREEN_26_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 252, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_GREEN_26_WERT"
+#define I3_FLD_BDC_STAT_LED_RED_26_WERT                          I3_PID_BDC_STAT_LIN_LAYERING, 253, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RED_26_WERT"
+#define I3_FLD_BDC_STAT_BRIGHTNESS_26_WERT                       I3_PID_BDC_STAT_LIN_LAYERING, 254, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BRIGHTNESS_26_WERT"
+#define I3_FLD_BDC_STAT_LED_WHITE_26_WERT                        I3_PID_BDC_STAT_LIN_LAYERING, 255, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_WHITE_26_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_KURZSCHLUSS_26_WERT               I3_PID_BDC_STAT_LIN_LAYERING, 256, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_KURZSCHLUSS_26_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OVERTEMP_26_WERT                  I3_PID_BDC_STAT_LIN_LAYERING, 257, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OVERTEMP_26_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_OPEN_LOAD_26_WERT                 I3_PID_BDC_STAT_LIN_LAYERING, 258, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_OPEN_LOAD_26_WERT"
+#define I3_FLD_BDC_STAT_FEHLER_INTERN_26_WERT                    I3_PID_BDC_STAT_LIN_LAYERING, 259, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLER_INTERN_26_WERT"
+
+// 0xDA61 I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN
+#define I3_FLD_BDC_STAT_CODIERUNG_FRONTKLAPPE                    I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_FRONTKLAPPE"
+#define I3_FLD_BDC_STAT_CODIERUNG_HECKKLAPPE                     I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_HECKKLAPPE"
+#define I3_FLD_BDC_STAT_CODIERUNG_HECKSCHEIBE                    I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_HECKSCHEIBE"
+#define I3_FLD_BDC_STAT_CODIERUNG_MOTORHAUBE                     I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_MOTORHAUBE"
+#define I3_FLD_BDC_STAT_CODIERUNG_SPLITDOORS                     I3_PID_BDC_STATUS_CODIERUNG_FAHRZEUGKLAPPEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_SPLITDOORS"
+
+// 0xDA7B I3_PID_BDC_TUERKONTAKT_BFH_OBEN
+#define I3_FLD_BDC_STAT_TUERKONTAKT_BFH_OBEN                     I3_PID_BDC_TUERKONTAKT_BFH_OBEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TUERKONTAKT_BFH_OBEN"
+
+// 0xDA7E I3_PID_BDC_TUERKONTAKT_FAH_OBEN
+#define I3_FLD_BDC_STAT_TUERKONTAKT_FA_OBEN                      I3_PID_BDC_TUERKONTAKT_FAH_OBEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TUERKONTAKT_FA_OBEN"
+
+// 0xDA81 I3_PID_BDC_ZV_BEIFAHRER
+#define I3_FLD_BDC_STAT_ZV_BF_ENTRIEGELT                         I3_PID_BDC_ZV_BEIFAHRER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BF_ENTRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_BF_VERRIEGELT                         I3_PID_BDC_ZV_BEIFAHRER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BF_VERRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_BF_GESICHERT                          I3_PID_BDC_ZV_BEIFAHRER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BF_GESICHERT"
+
+// 0xDA82 I3_PID_BDC_ZV_BEIFAHRER_HINTEN
+#define I3_FLD_BDC_STAT_ZV_BFH_ENTRIEGELT                        I3_PID_BDC_ZV_BEIFAHRER_HINTEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BFH_ENTRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_BFH_VERRIEGELT                        I3_PID_BDC_ZV_BEIFAHRER_HINTEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BFH_VERRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_BFH_GESICHERT                         I3_PID_BDC_ZV_BEIFAHRER_HINTEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BFH_GESICHERT"
+
+// 0xDA83 I3_PID_BDC_ZV_FAHRER
+#define I3_FLD_BDC_STAT_ZV_FA_ENTRIEGELT                         I3_PID_BDC_ZV_FAHRER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FA_ENTRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_FA_VERRIEGELT                         I3_PID_BDC_ZV_FAHRER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FA_VERRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_FA_GESICHERT                          I3_PID_BDC_ZV_FAHRER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FA_GESICHERT"
+
+// 0xDA84 I3_PID_BDC_ZV_FAHRER_HINTEN
+#define I3_FLD_BDC_STAT_ZV_FAH_ENTRIEGELT                        I3_PID_BDC_ZV_FAHRER_HINTEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FAH_ENTRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_FAH_VERRIEGELT                        I3_PID_BDC_ZV_FAHRER_HINTEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FAH_VERRIEGELT"
+#define I3_FLD_BDC_STAT_ZV_FAH_GESICHERT                         I3_PID_BDC_ZV_FAHRER_HINTEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FAH_GESICHERT"
+
+// 0xDA85 I3_PID_BDC_ZV_HECKKLAPPE
+#define I3_FLD_BDC_STAT_ZV_HECKKLAPPE_ENTRIEGELT_NR              I3_PID_BDC_ZV_HECKKLAPPE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_HECKKLAPPE_ENTRIEGELT_NR"
+#define I3_FLD_BDC_STAT_ZV_HECKKLAPPE_VERRIEGELT_NR              I3_PID_BDC_ZV_HECKKLAPPE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_HECKKLAPPE_VERRIEGELT_NR"
+
+// 0xDA86 I3_PID_BDC_ZV_HECKSCHEIBE
+#define I3_FLD_BDC_STAT_ZV_HECKSCHEIBE_ENTRIEGELT_NR             I3_PID_BDC_ZV_HECKSCHEIBE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_HECKSCHEIBE_ENTRIEGELT_NR"
+#define I3_FLD_BDC_STAT_ZV_HECKSCHEIBE_VERRIEGELT_NR             I3_PID_BDC_ZV_HECKSCHEIBE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_HECKSCHEIBE_VERRIEGELT_NR"
+
+// 0xDA87 I3_PID_BDC_ZV_GESAMT
+#define I3_FLD_BDC_STAT_ZV_FA_NR                                 I3_PID_BDC_ZV_GESAMT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FA_NR"
+#define I3_FLD_BDC_STAT_ZV_BF_NR                                 I3_PID_BDC_ZV_GESAMT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BF_NR"
+#define I3_FLD_BDC_STAT_ZV_FAH_NR                                I3_PID_BDC_ZV_GESAMT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_FAH_NR"
+#define I3_FLD_BDC_STAT_ZV_BFH_NR                                I3_PID_BDC_ZV_GESAMT, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_BFH_NR"
+
+// 0xDA95 I3_PID_BDC_ZV_KURZSCHLUSSABSCHALTUNG
+#define I3_FLD_BDC_STAT_HECKKLAPPE_KURZSCHLUSSABSCHALTUNG_AKTIV  I3_PID_BDC_ZV_KURZSCHLUSSABSCHALTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKKLAPPE_KURZSCHLUSSABSCHALTUNG_AKTIV"
+#define I3_FLD_BDC_STAT_HECKSCHEIBE_KURZSCHLUSSABSCHALTUNG_AKTIV I3_PID_BDC_ZV_KURZSCHLUSSABSCHALTUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKSCHEIBE_KURZSCHLUSSABSCHALTUNG_AKTIV"
+
+// 0xDAB3 I3_PID_BDC_SPANNUNG_KLEMMEN
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_30B_1_WERT               I3_PID_BDC_SPANNUNG_KLEMMEN, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_1_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_30B_2_WERT               I3_PID_BDC_SPANNUNG_KLEMMEN, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_2_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_30B_3_WERT               I3_PID_BDC_SPANNUNG_KLEMMEN, 4, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_3_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_15WUP                    I3_PID_BDC_SPANNUNG_KLEMMEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_KLEMME_15WUP"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_15N1_WERT                I3_PID_BDC_SPANNUNG_KLEMMEN, 8, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_15N1_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_15N2_WERT                I3_PID_BDC_SPANNUNG_KLEMMEN, 10, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_15N2_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_15_WERT                  I3_PID_BDC_SPANNUNG_KLEMMEN, 12, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_15_WERT"
+#define I3_FLD_BDC_STAT_STROM_KLEMME_15_50_WERT                  I3_PID_BDC_SPANNUNG_KLEMMEN, 14, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_STROM_KLEMME_15_50_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_50_WERT                  I3_PID_BDC_SPANNUNG_KLEMMEN, 16, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_50_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_50MSA_WERT               I3_PID_BDC_SPANNUNG_KLEMMEN, 18, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_50MSA_WERT"
+#define I3_FLD_BDC_STAT_STROM_LF_WERT                            I3_PID_BDC_SPANNUNG_KLEMMEN, 20, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_STROM_LF_WERT"
+#define I3_FLD_BDC_STAT_DIAG_LF_WERT                             I3_PID_BDC_SPANNUNG_KLEMMEN, 22, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_DIAG_LF_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_31ELV_WERT               I3_PID_BDC_SPANNUNG_KLEMMEN, 24, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_31ELV_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_30ELV_WERT               I3_PID_BDC_SPANNUNG_KLEMMEN, 26, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_KLEMME_30ELV_WERT"
+#define I3_FLD_BDC_STAT_SPANNUNG_INNENTEMPERATUR_WERT            I3_PID_BDC_SPANNUNG_KLEMMEN, 28, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_INNENTEMPERATUR_WERT"
+
+// 0xDAB4 I3_PID_BDC_KEY_VALID_NR_AKTUELL
+#define I3_FLD_BDC_STAT_KEY_VAILD_NR_AKTUELL                     I3_PID_BDC_KEY_VALID_NR_AKTUELL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KEY_VAILD_NR_AKTUELL"
+
+// 0xDAB5 I3_PID_BDC_CA_TAGE_ER_LEITUNG
+#define I3_FLD_BDC_STAT_TAGE_ER_FT                               I3_PID_BDC_CA_TAGE_ER_LEITUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_ER_FT"
+#define I3_FLD_BDC_STAT_TAGE_ER_BFT                              I3_PID_BDC_CA_TAGE_ER_LEITUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_ER_BFT"
+#define I3_FLD_BDC_STAT_TAGE_ER_FTH                              I3_PID_BDC_CA_TAGE_ER_LEITUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_ER_FTH"
+#define I3_FLD_BDC_STAT_TAGE_ER_BFTH                             I3_PID_BDC_CA_TAGE_ER_LEITUNG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_ER_BFTH"
+
+// 0xDAB6 I3_PID_BDC_START_STOP_TASTER
+#define I3_FLD_BDC_STAT_TASTER_SST_AKTIV                         I3_PID_BDC_START_STOP_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_SST_AKTIV"
+
+// 0xDABA I3_PID_BDC_STATUS_KLEMMEN_VERHINDERER
+#define I3_FLD_BDC_STAT_KL15_EIN_VERHINDERER                     I3_PID_BDC_STATUS_KLEMMEN_VERHINDERER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL15_EIN_VERHINDERER"
+#define I3_FLD_BDC_STAT_KL15_AUS_VERHINDERER                     I3_PID_BDC_STATUS_KLEMMEN_VERHINDERER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL15_AUS_VERHINDERER"
+#define I3_FLD_BDC_STAT_KL50_EIN_VERHINDERER                     I3_PID_BDC_STATUS_KLEMMEN_VERHINDERER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL50_EIN_VERHINDERER"
+
+// 0xDABB I3_PID_BDC_BUS_IN_DATUM_ZEIT
+#define I3_FLD_BDC_STAT_BUS_IN_ZEIT_STUNDEN_WERT                 I3_PID_BDC_BUS_IN_DATUM_ZEIT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_STUNDEN_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_ZEIT_MINUTEN_WERT                 I3_PID_BDC_BUS_IN_DATUM_ZEIT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_MINUTEN_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_DATUM_TAG_WERT                    I3_PID_BDC_BUS_IN_DATUM_ZEIT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_DATUM_TAG_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_DATUM_MONAT_WERT                  I3_PID_BDC_BUS_IN_DATUM_ZEIT, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_DATUM_MONAT_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_DATUM_JAHR_WERT                   I3_PID_BDC_BUS_IN_DATUM_ZEIT, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BUS_IN_DATUM_JAHR_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_ZEIT_RELATIV_WERT                 I3_PID_BDC_BUS_IN_DATUM_ZEIT, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_RELATIV_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_ZEIT_TAGE_RELATIV_WERT            I3_PID_BDC_BUS_IN_DATUM_ZEIT, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BUS_IN_ZEIT_TAGE_RELATIV_WERT"
+
+// 0xDABC I3_PID_BDC_BUS_IN_DME1
+#define I3_FLD_BDC_STAT_BUS_IN_GANG                              I3_PID_BDC_BUS_IN_DME1, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_GANG"
+#define I3_FLD_BDC_STAT_BUS_IN_MOTOR_LAEUFT                      I3_PID_BDC_BUS_IN_DME1, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_MOTOR_LAEUFT"
+#define I3_FLD_BDC_STAT_BUS_IN_MOTOR_FREIGABE                    I3_PID_BDC_BUS_IN_DME1, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_MOTOR_FREIGABE"
+#define I3_FLD_BDC_STAT_BUS_IN_ANLASSER_SPERRE                   I3_PID_BDC_BUS_IN_DME1, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_ANLASSER_SPERRE"
+#define I3_FLD_BDC_STAT_BUS_IN_KUPPLUNG                          I3_PID_BDC_BUS_IN_DME1, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_KUPPLUNG"
+#define I3_FLD_BDC_STAT_BUS_IN_DREHZAHL_WERT                     I3_PID_BDC_BUS_IN_DME1, 5, PID_FIELD_UINT16, 0.25f, 0.0f, "STAT_BUS_IN_DREHZAHL_WERT"
+
+// 0xDABD I3_PID_BDC_BUS_IN_DSC
+#define I3_FLD_BDC_STAT_BUS_IN_GESCHW_WERT                       I3_PID_BDC_BUS_IN_DSC, 0, PID_FIELD_UINT16, 0.015625f, 0.0f, "STAT_BUS_IN_GESCHW_WERT"
+#define I3_FLD_BDC_STAT_BUS_IN_GESCHW_STATUS                     I3_PID_BDC_BUS_IN_DSC, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_GESCHW_STATUS"
+#define I3_FLD_BDC_STAT_BUS_IN_BREMSPEDAL                        I3_PID_BDC_BUS_IN_DSC, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_BREMSPEDAL"
+
+// 0xDABF I3_PID_BDC_BUS_IN_FH
+#define I3_FLD_BDC_STAT_BUS_IN_FH_FT                             I3_PID_BDC_BUS_IN_FH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_FH_FT"
+#define I3_FLD_BDC_STAT_BUS_IN_FH_BFT                            I3_PID_BDC_BUS_IN_FH, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_FH_BFT"
+#define I3_FLD_BDC_STAT_BUS_IN_FH_FTH                            I3_PID_BDC_BUS_IN_FH, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_FH_FTH"
+#define I3_FLD_BDC_STAT_BUS_IN_FH_BFTH                           I3_PID_BDC_BUS_IN_FH, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_FH_BFTH"
+
+// 0xDACA I3_PID_BDC_CA_TAGE_STATUS
+#define I3_FLD_BDC_STAT_TAGE_FT                                  I3_PID_BDC_CA_TAGE_STATUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_FT"
+#define I3_FLD_BDC_STAT_TAGE_BFT                                 I3_PID_BDC_CA_TAGE_STATUS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_BFT"
+#define I3_FLD_BDC_STAT_TAGE_FTH                                 I3_PID_BDC_CA_TAGE_STATUS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_FTH"
+#define I3_FLD_BDC_STAT_TAGE_BFTH                                I3_PID_BDC_CA_TAGE_STATUS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAGE_BFTH"
+
+// 0xDAD6 I3_PID_BDC_SPANNUNG_KLEMME_30L1
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_30L1_WERT                I3_PID_BDC_SPANNUNG_KLEMME_30L1, 0, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30L1_WERT"
+
+// 0xDAD7 I3_PID_BDC_SPANNUNG_KLEMME_30L2
+#define I3_FLD_BDC_STAT_SPANNUNG_KLEMME_30L2_WERT                I3_PID_BDC_SPANNUNG_KLEMME_30L2, 0, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30L2_WERT"
+
+// 0xDB12 I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG
+#define I3_FLD_BDC_STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_15N1_AKTIV I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_15N1_AKTIV"
+#define I3_FLD_BDC_STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_15N2_AKTIV I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_15N2_AKTIV"
+#define I3_FLD_BDC_STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL30BACSM_AKTIV I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL30BACSM_AKTIV"
+#define I3_FLD_BDC_STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL301_AKTIV I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL301_AKTIV"
+#define I3_FLD_BDC_STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL302_AKTIV I3_PID_BDC_KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURZSCHLUSSABSCHALTUNG_TREIBER_KL302_AKTIV"
+
+// 0xDB16 I3_PID_BDC_HECKKLAPPENSENSOR
+#define I3_FLD_BDC_STAT_HECKKLAPPENSENSOR                        I3_PID_BDC_HECKKLAPPENSENSOR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKKLAPPENSENSOR"
+
+// 0xDB2D I3_PID_BDC_NACHLAUFZEIT_KLEMME_15N
+#define I3_FLD_BDC_STAT_NACHLAUFZEIT_KLEMME_15N_WERT             I3_PID_BDC_NACHLAUFZEIT_KLEMME_15N, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NACHLAUFZEIT_KLEMME_15N_WERT"
+
+// 0xDB2E I3_PID_BDC_NACHLAUFZEIT_KLEMME_30B
+#define I3_FLD_BDC_STAT_NACHLAUFZEIT_KLEMME_30B_WERT             I3_PID_BDC_NACHLAUFZEIT_KLEMME_30B, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NACHLAUFZEIT_KLEMME_30B_WERT"
+
+// 0xDC56 I3_PID_BDC_STATUS_KLEMMEN
+#define I3_FLD_BDC_STAT_KLEMMENSTATUS                            I3_PID_BDC_STATUS_KLEMMEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLEMMENSTATUS"
+
+// 0xDC57 I3_PID_BDC_STATUS_KL15_ABSCHALTUNG
+#define I3_FLD_BDC_STAT_CODIERUNG_KL15_ABSCHALTUNG               I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_OBDKOMMUNIKATION_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_OBDKOMMUNIKATION_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_BREMSE_AKTIV         I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_BREMSE_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_MOTORLAUF_AKTIV      I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_MOTORLAUF_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_KUPPLUNG_AKTIV       I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_KUPPLUNG_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_ENERGIESPARMODE_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_ENERGIESPARMODE_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_GESCHWINDIGKEIT_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_GESCHWINDIGKEIT_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_MSA_AKTIV            I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_MSA_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_ABBLENDLICHT_AKTIV   I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_ABBLENDLICHT_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_WAEHLHEBEL_IN_N_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_WAEHLHEBEL_IN_N_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_DIAGNOSE_AKTIV       I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_DIAGNOSE_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_FLA_MODE             I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_FLA_MODE"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_AKTIV                I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_AKTIV"
+#define I3_FLD_BDC_STAT_AUTOMATISCHE_ABSCHALTUNG_DURCHGEFUEHRT   I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOMATISCHE_ABSCHALTUNG_DURCHGEFUEHRT"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_PRAESENTATIONSMODUS_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_PRAESENTATIONSMODUS_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_GESCHWINDIGKEIT_UNPLAUSIBEL_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_GESCHWINDIGKEIT_UNPLAUSIBEL_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_FREMDLADUNG_HYBRID_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_FREMDLADUNG_HYBRID_AKTIV"
+#define I3_FLD_BDC_STAT_ABSCHALTVERHINDERER_GURT_FAHRER_GESTECKT_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABSCHALTVERHINDERER_GURT_FAHRER_GESTECKT_AKTIV"
+#define I3_FLD_BDC_STAT_CODIERUNG_KL15_ABSCHALTUNG_GURT_AKTIV    I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_GURT_AKTIV"
+#define I3_FLD_BDC_STAT_CODIERUNG_KL15_ABSCHALTUNG_KLAPPENWECHSEL_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_KLAPPENWECHSEL_AKTIV"
+#define I3_FLD_BDC_STAT_CODIERUNG_KL15_ABSCHALTUNG_OSFG_ERREICHT_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_OSFG_ERREICHT_AKTIV"
+#define I3_FLD_BDC_STAT_CODIERUNG_KL15_ABSCHALTUNG_TIMEOUT_OSFG_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_TIMEOUT_OSFG_AKTIV"
+#define I3_FLD_BDC_STAT_CODIERUNG_KL15_ABSCHALTUNG_ZV_SICHERN_AKTIV I3_PID_BDC_STATUS_KL15_ABSCHALTUNG, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CODIERUNG_KL15_ABSCHALTUNG_ZV_SICHERN_AKTIV"
+
+// 0xDC5A I3_PID_BDC_ANSTEUERUNG_KL30F_HINTEN
+#define I3_FLD_BDC_STAT_KL30F_HINTEN_AN                          I3_PID_BDC_ANSTEUERUNG_KL30F_HINTEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL30F_HINTEN_AN"
+#define I3_FLD_BDC_STAT_KL30F_HINTEN_AUS                         I3_PID_BDC_ANSTEUERUNG_KL30F_HINTEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL30F_HINTEN_AUS"
+
+// 0xDC61 I3_PID_BDC_BREMSLICHT_SCHALTER
+#define I3_FLD_BDC_STAT_SCHALTER_BREMSLICHT_AKTIV                I3_PID_BDC_BREMSLICHT_SCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER_BREMSLICHT_AKTIV"
+
+// 0xDC63 I3_PID_BDC_KUPPL_PN_SCHALTER
+#define I3_FLD_BDC_STAT_SCHALTER_KUPPL_PN_AKTIV                  I3_PID_BDC_KUPPL_PN_SCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER_KUPPL_PN_AKTIV"
+
+// 0xDC65 I3_PID_BDC_MOTORHAUBE_SCHALTER
+#define I3_FLD_BDC_STAT_SCHALTER_MOTORHAUBE_AKTIV                I3_PID_BDC_MOTORHAUBE_SCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER_MOTORHAUBE_AKTIV"
+
+// 0xDC66 I3_PID_BDC_HOTEL_SCHALTER
+#define I3_FLD_BDC_STAT_SCHALTER_HOTEL_AKTIV                     I3_PID_BDC_HOTEL_SCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER_HOTEL_AKTIV"
+
+// 0xF152 I3_PID_BDC_READHWMODIFICATIONINDEX
+#define I3_FLD_BDC_STAT_HW_MODIFICATION_INDEX_WERT               I3_PID_BDC_READHWMODIFICATIONINDEX, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HW_MODIFICATION_INDEX_WERT"
+#define I3_FLD_BDC_BF_22_F152_SUPPLIERINFO                       I3_PID_BDC_READHWMODIFICATIONINDEX, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_22_F152_SUPPLIERINFO"
+
+// 0x2302 I3_PID_BDC_LWR_STATISTIK
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_AL_AKTIV_WERT            I3_PID_BDC_LWR_STATISTIK, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_AL_AKTIV_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0000_WERT                I3_PID_BDC_LWR_STATISTIK, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0000_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0001_WERT                I3_PID_BDC_LWR_STATISTIK, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0001_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1000_WERT                I3_PID_BDC_LWR_STATISTIK, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1000_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1001_WERT                I3_PID_BDC_LWR_STATISTIK, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1001_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1010_WERT                I3_PID_BDC_LWR_STATISTIK, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1010_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1100_WERT                I3_PID_BDC_LWR_STATISTIK, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1100_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1110_WERT                I3_PID_BDC_LWR_STATISTIK, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1110_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1011_WERT                I3_PID_BDC_LWR_STATISTIK, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1011_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1101_WERT                I3_PID_BDC_LWR_STATISTIK, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1101_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_1111_WERT                I3_PID_BDC_LWR_STATISTIK, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_1111_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0010_WERT                I3_PID_BDC_LWR_STATISTIK, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0010_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0100_WERT                I3_PID_BDC_LWR_STATISTIK, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0100_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0110_WERT                I3_PID_BDC_LWR_STATISTIK, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0110_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0011_WERT                I3_PID_BDC_LWR_STATISTIK, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0011_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0101_WERT                I3_PID_BDC_LWR_STATISTIK, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0101_WERT"
+#define I3_FLD_BDC_STAT_BETRIEBSMINUTEN_0111_WERT                I3_PID_BDC_LWR_STATISTIK, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETRIEBSMINUTEN_0111_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_GES_WERT                          I3_PID_BDC_LWR_STATISTIK, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_GES_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_GES_KL_20_WERT                    I3_PID_BDC_LWR_STATISTIK, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_GES_KL_20_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_GES_KL_10_WERT                    I3_PID_BDC_LWR_STATISTIK, 42, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_GES_KL_10_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_GES_GR_10_WERT                    I3_PID_BDC_LWR_STATISTIK, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_GES_GR_10_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_GES_GR_20_WERT                    I3_PID_BDC_LWR_STATISTIK, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_GES_GR_20_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_AL_WERT                           I3_PID_BDC_LWR_STATISTIK, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_AL_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_AL_KL_20_WERT                     I3_PID_BDC_LWR_STATISTIK, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_AL_KL_20_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_AL_KL_10_WERT                     I3_PID_BDC_LWR_STATISTIK, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_AL_KL_10_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_AL_GR_10_WERT                     I3_PID_BDC_LWR_STATISTIK, 56, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_AL_GR_10_WERT"
+#define I3_FLD_BDC_STAT_ANZAHL_AL_GR_20_WERT                     I3_PID_BDC_LWR_STATISTIK, 58, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_AL_GR_20_WERT"
+
+// 0x2303 I3_PID_BDC_COUNT_NSC_MIRRORHEATING_ACTIVATIONS
+#define I3_FLD_BDC_STAT_ANZAHL_AKTIVIERUNGEN_ASP_NSC_WERT        I3_PID_BDC_COUNT_NSC_MIRRORHEATING_ACTIVATIONS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_AKTIVIERUNGEN_ASP_NSC_WERT"
+
+// 0x4507 I3_PID_BDC__LWR_DIAG
+#define I3_FLD_BDC_STAT_LWR_ENABLE                               I3_PID_BDC__LWR_DIAG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_ENABLE"
+#define I3_FLD_BDC_STAT_LWR_SPUL_ERR_STOP                        I3_PID_BDC__LWR_DIAG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_SPUL_ERR_STOP"
+#define I3_FLD_BDC_STAT_LWR_SPUL_EINTR                           I3_PID_BDC__LWR_DIAG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_SPUL_EINTR"
+#define I3_FLD_BDC_STAT_SP_PRUEF_AKTIV                           I3_PID_BDC__LWR_DIAG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SP_PRUEF_AKTIV"
+#define I3_FLD_BDC_STAT_LWR_DIAGNOSE_PARAM_WERT                  I3_PID_BDC__LWR_DIAG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_DIAGNOSE_PARAM_WERT"
+#define I3_FLD_BDC_STAT_LWR_DIAGNOSE_PARAM_A_WERT                I3_PID_BDC__LWR_DIAG, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_DIAGNOSE_PARAM_A_WERT"
+#define I3_FLD_BDC_STAT_LWR_CHECKGRENZE_WERT                     I3_PID_BDC__LWR_DIAG, 6, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_LWR_CHECKGRENZE_WERT"
+#define I3_FLD_BDC_STAT_LWR_PRUEF_SPANNUNG_WERT                  I3_PID_BDC__LWR_DIAG, 7, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_LWR_PRUEF_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_LWR_DIAG_HEAT_TIME_WERT                  I3_PID_BDC__LWR_DIAG, 8, PID_FIELD_UINT8, 512.0f, 0.0f, "STAT_LWR_DIAG_HEAT_TIME_WERT"
+#define I3_FLD_BDC_STAT_LWR_DIAG_COOL_TIME_WERT                  I3_PID_BDC__LWR_DIAG, 9, PID_FIELD_UINT8, 512.0f, 0.0f, "STAT_LWR_DIAG_COOL_TIME_WERT"
+#define I3_FLD_BDC_STAT_LWR_FRONT_LIGHT_HOT                      I3_PID_BDC__LWR_DIAG, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LWR_FRONT_LIGHT_HOT"
+#define I3_FLD_BDC_STAT_LWR_FRONT_LIGHT_THERMO_TIMER_WERT        I3_PID_BDC__LWR_DIAG, 11, PID_FIELD_UINT16, 0.5f, 0.0f, "STAT_LWR_FRONT_LIGHT_THERMO_TIMER_WERT"
+
+// 0x4508 I3_PID_BDC__LICHT_UEBERSPANNUNGSCOUNTER
+#define I3_FLD_BDC_STAT_LICHT_UESPANNUNG_COUNTER_WERT            I3_PID_BDC__LICHT_UEBERSPANNUNGSCOUNTER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LICHT_UESPANNUNG_COUNTER_WERT"
+
+// 0x4700 I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER
+#define I3_FLD_BDC_STAT_HECKKLAPPE_ZAEHLER_COUNT_MAX_WERT        I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HECKKLAPPE_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_HECKKLAPPE_ZAEHLER_KS_RESTARTS_WERT      I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKKLAPPE_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_HECKKLAPPE_ZAEHLER_KS_KL15_CYCLES_WERT   I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKKLAPPE_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_HECKSCHEIBE_ZAEHLER_COUNT_MAX_WERT       I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HECKSCHEIBE_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_HECKSCHEIBE_ZAEHLER_KS_RESTARTS_WERT     I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKSCHEIBE_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_HECKSCHEIBE_ZAEHLER_KS_KL15_CYCLES_WERT  I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HECKSCHEIBE_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_KODIERUNG_RESTARTS_WERT                  I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KODIERUNG_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_KODIERUNG_KL15_CYCLES_WERT               I3_PID_BDC__ZV_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KODIERUNG_KL15_CYCLES_WERT"
+
+// 0x4801 I3_PID_BDC__INNENBELEUCHTUNG_DAUERAUS
+#define I3_FLD_BDC_STAT_INNENLICHT_IB_1_DAUER_AUS                I3_PID_BDC__INNENBELEUCHTUNG_DAUERAUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INNENLICHT_IB_1_DAUER_AUS"
+
+// 0x4910 I3_PID_BDC__SARAH_STATISTIK
+#define I3_FLD_BDC_STAT_FAHRDAUER_WERT                           I3_PID_BDC__SARAH_STATISTIK, 0, PID_FIELD_UINT16, 0.166666667f, 0.0f, "STAT_FAHRDAUER_WERT"
+#define I3_FLD_BDC_STAT_FAHRZYKLEN_WERT                          I3_PID_BDC__SARAH_STATISTIK, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAHRZYKLEN_WERT"
+#define I3_FLD_BDC_STAT_SARAH_TASTER_WERT                        I3_PID_BDC__SARAH_STATISTIK, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SARAH_TASTER_WERT"
+#define I3_FLD_BDC_STAT_SARAH_CONFIG_WERT                        I3_PID_BDC__SARAH_STATISTIK, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SARAH_CONFIG_WERT"
+#define I3_FLD_BDC_STAT_SARAH_CONFIG_DIREKT_WERT                 I3_PID_BDC__SARAH_STATISTIK, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SARAH_CONFIG_DIREKT_WERT"
+#define I3_FLD_BDC_STAT_RESERVE1_WERT                            I3_PID_BDC__SARAH_STATISTIK, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESERVE1_WERT"
+#define I3_FLD_BDC_STAT_RESERVE2_WERT                            I3_PID_BDC__SARAH_STATISTIK, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE2_WERT"
+#define I3_FLD_BDC_STAT_RESERVE3_WERT                            I3_PID_BDC__SARAH_STATISTIK, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE3_WERT"
+#define I3_FLD_BDC_STAT_RESERVE4_WERT                            I3_PID_BDC__SARAH_STATISTIK, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE4_WERT"
+#define I3_FLD_BDC_STAT_RESERVE5_WERT                            I3_PID_BDC__SARAH_STATISTIK, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE5_WERT"
+#define I3_FLD_BDC_STAT_RESERVE6_WERT                            I3_PID_BDC__SARAH_STATISTIK, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE6_WERT"
+
+// 0x4E07 I3_PID_BDC__STATUS_BASESTATION
+
+// 0x4F0E I3_PID_BDC_IBS_WAKEUP_GRUND
+#define I3_FLD_BDC_STAT_IBS_WAKEUP                               I3_PID_BDC_IBS_WAKEUP_GRUND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_IBS_WAKEUP"
+
+// 0x5001 I3_PID_BDC__STATUS_DFZ_SK
+
+// 0x5003 I3_PID_BDC__STATUS_DFZ_GUELTIGKEIT
+#define I3_FLD_BDC_STAT_DFZ_GUELTIGKEITSZAEHLER_WERT             I3_PID_BDC__STATUS_DFZ_GUELTIGKEIT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DFZ_GUELTIGKEITSZAEHLER_WERT"
+
+// 0x5020 I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER
+#define I3_FLD_BDC_STAT_TREIBER_15N1_ZAEHLER_COUNT_MAX_WERT      I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TREIBER_15N1_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_15N1_ZAEHLER_KS_RESTARTS_WERT    I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_15N1_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_15N1_ZAEHLER_KS_KL15_CYCLES_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_15N1_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_15N2_ZAEHLER_COUNT_MAX_WERT      I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TREIBER_15N2_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_15N2_ZAEHLER_KS_RESTARTS_WERT    I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_15N2_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_15N2_ZAEHLER_KS_KL15_CYCLES_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_15N2_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30BACSM_ZAEHLER_COUNT_MAX_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TREIBER_KL30BACSM_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30BACSM_ZAEHLER_KS_RESTARTS_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_KL30BACSM_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30BACSM_ZAEHLER_KS_KL15_CYCLES_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_KL30BACSM_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30B1_ZAEHLER_COUNT_MAX_WERT    I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TREIBER_KL30B1_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30B1_ZAEHLER_KS_RESTARTS_WERT  I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_KL30B1_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30B1_ZAEHLER_KS_KL15_CYCLES_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_KL30B1_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30B2_ZAEHLER_COUNT_MAX_WERT    I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TREIBER_KL30B2_ZAEHLER_COUNT_MAX_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30B2_ZAEHLER_KS_RESTARTS_WERT  I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_KL30B2_ZAEHLER_KS_RESTARTS_WERT"
+#define I3_FLD_BDC_STAT_TREIBER_KL30B2_ZAEHLER_KS_KL15_CYCLES_WERT I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TREIBER_KL30B2_ZAEHLER_KS_KL15_CYCLES_WERT"
+#define I3_FLD_BDC_STAT_KODIERUNG_RESTARTS_WERT_0X5020           I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KODIERUNG_RESTARTS_WERT_0X5020"
+#define I3_FLD_BDC_STAT_KODIERUNG_KL15_CYCLES_WERT_0X5020        I3_PID_BDC__KLEMMENSTEUERUNG_KURZSCHLUSSABSCHALTUNG_ZAEHLER, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KODIERUNG_KL15_CYCLES_WERT_0X5020"
+
+// 0x5101 I3_PID_BDC__ECUMA_INTERN
+#define I3_FLD_BDC_STAT_ECUMA_LAST_HW_WAKEUP_ID_WERT             I3_PID_BDC__ECUMA_INTERN, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ECUMA_LAST_HW_WAKEUP_ID_WERT"
+#define I3_FLD_BDC_STAT_ECUMA_LAST_SW_WAKEUP_ID                  I3_PID_BDC__ECUMA_INTERN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECUMA_LAST_SW_WAKEUP_ID"
+#define I3_FLD_BDC_STAT_ECUMA_LAST_BUS_WAKEUP_ID                 I3_PID_BDC__ECUMA_INTERN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECUMA_LAST_BUS_WAKEUP_ID"
+#define I3_FLD_BDC_STAT_ECUMA_LAST_RESET_ID                      I3_PID_BDC__ECUMA_INTERN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECUMA_LAST_RESET_ID"
+#define I3_FLD_BDC_STAT_ECUMA_CAN_WAKEUP_ID_WERT                 I3_PID_BDC__ECUMA_INTERN, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ECUMA_CAN_WAKEUP_ID_WERT"
+#define I3_FLD_BDC_STAT_RESERVED_WERT                            I3_PID_BDC__ECUMA_INTERN, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVED_WERT"
+
+// 0x5109 I3_PID_BDC__ECUMA_SLEEP_MODE_NRC
+#define I3_FLD_BDC_STAT_SLEEP_MODE_NRC                           I3_PID_BDC__ECUMA_SLEEP_MODE_NRC, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLEEP_MODE_NRC"
+
+// 0x510A I3_PID_BDC_HW_INFO_PROVIDER
+#define I3_FLD_BDC_STAT_HW_VERSION                               I3_PID_BDC_HW_INFO_PROVIDER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HW_VERSION"
+
+// 0x510B I3_PID_BDC__JTAGLOCK
+#define I3_FLD_BDC_STAT_NORMAL_LOCK_STATE                        I3_PID_BDC__JTAGLOCK, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NORMAL_LOCK_STATE"
+#define I3_FLD_BDC_STAT_PERMANENT_LOCK_STATE                     I3_PID_BDC__JTAGLOCK, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PERMANENT_LOCK_STATE"
+
+// 0x5DBE I3_PID_BDC_READ_PULLUP_REF_RESFUEL_TANK_0
+#define I3_FLD_BDC_STAT_PULLUP_REF_RESFUEL_TANK_LEFT_WERT        I3_PID_BDC_READ_PULLUP_REF_RESFUEL_TANK_0, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PULLUP_REF_RESFUEL_TANK_LEFT_WERT"
+
+// 0x5DBF I3_PID_BDC_READ_PULLUP_REF_RESFUEL_TANK_1
+#define I3_FLD_BDC_STAT_PULLUP_REF_RESFUEL_TANK_RIGHT_WERT       I3_PID_BDC_READ_PULLUP_REF_RESFUEL_TANK_1, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PULLUP_REF_RESFUEL_TANK_RIGHT_WERT"
+
+// 0x6020 I3_PID_BDC__FH_FA_STATISTIKZAEHLER_LESEN
+
+// 0x6021 I3_PID_BDC__FH_BF_STATISTIKZAEHLER_LESEN
+
+// 0x6022 I3_PID_BDC__FH_FAH_STATISTIKZAEHLER_LESEN
+
+// 0x6023 I3_PID_BDC__FH_BFH_STATISTIKZAEHLER_LESEN
+
+// 0x603A I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT
+#define I3_FLD_BDC_STAT_FA_DENORM_ZAEHLER_WERT                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_DENORM_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_1_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_DENORM_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_DENORM_1_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_DENORM_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_1_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_DENORM_1_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_RESERVED_1_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_RESERVED_1_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_2_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_DENORM_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_DENORM_2_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 11, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_DENORM_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_2_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_DENORM_2_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_RESERVED_2_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_RESERVED_2_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_3_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_DENORM_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_DENORM_3_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 20, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_DENORM_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_3_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_DENORM_3_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_RESERVED_3_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_RESERVED_3_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_4_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_DENORM_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_DENORM_4_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 29, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_DENORM_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_4_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 31, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_DENORM_4_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_RESERVED_4_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 35, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_RESERVED_4_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_5_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_DENORM_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_DENORM_5_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 38, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_DENORM_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_DENORM_5_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_DENORM_5_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_RESERVED_5_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_RESERVED_5_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_ZAEHLER_WERT                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_DENORM_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_1_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_DENORM_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_DENORM_1_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 48, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_DENORM_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_1_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_DENORM_1_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_RESERVED_1_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_RESERVED_1_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_2_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_DENORM_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_DENORM_2_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 57, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_DENORM_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_2_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 59, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_DENORM_2_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_RESERVED_2_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 63, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_RESERVED_2_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_3_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_DENORM_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_DENORM_3_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 66, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_DENORM_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_3_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_DENORM_3_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_RESERVED_3_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 72, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_RESERVED_3_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_4_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_DENORM_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_DENORM_4_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 75, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_DENORM_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_4_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 77, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_DENORM_4_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_RESERVED_4_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 81, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_RESERVED_4_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_5_URSACHE_NR                   I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_DENORM_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_DENORM_5_POS_HALL_WERT                I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 84, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_DENORM_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_DENORM_5_KM_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 86, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_DENORM_5_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_RESERVED_5_WERT                       I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_FRONT, 90, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_RESERVED_5_WERT"
+
+// 0x603B I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR
+#define I3_FLD_BDC_STAT_FAH_DENORM_ZAEHLER_WERT                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_DENORM_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_1_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_DENORM_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_DENORM_1_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_DENORM_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_1_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_DENORM_1_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_RESERVED_1_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_RESERVED_1_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_2_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_DENORM_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_DENORM_2_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 11, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_DENORM_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_2_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_DENORM_2_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_RESERVED_2_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_RESERVED_2_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_3_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_DENORM_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_DENORM_3_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 20, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_DENORM_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_3_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_DENORM_3_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_RESERVED_3_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_RESERVED_3_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_4_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_DENORM_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_DENORM_4_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 29, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_DENORM_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_4_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 31, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_DENORM_4_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_RESERVED_4_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 35, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_RESERVED_4_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_5_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_DENORM_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_DENORM_5_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 38, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_DENORM_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_DENORM_5_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_DENORM_5_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_RESERVED_5_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_RESERVED_5_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_ZAEHLER_WERT                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_DENORM_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_1_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_DENORM_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_DENORM_1_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 48, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_DENORM_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_1_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_DENORM_1_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_RESERVED_1_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_RESERVED_1_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_2_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_DENORM_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_DENORM_2_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 57, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_DENORM_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_2_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 59, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_DENORM_2_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_RESERVED_2_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 63, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_RESERVED_2_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_3_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_DENORM_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_DENORM_3_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 66, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_DENORM_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_3_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_DENORM_3_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_RESERVED_3_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 72, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_RESERVED_3_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_4_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_DENORM_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_DENORM_4_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 75, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_DENORM_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_4_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 77, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_DENORM_4_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_RESERVED_4_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 81, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_RESERVED_4_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_5_URSACHE_NR                  I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_DENORM_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_DENORM_5_POS_HALL_WERT               I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 84, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_DENORM_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_DENORM_5_KM_WERT                     I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 86, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_DENORM_5_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_RESERVED_5_WERT                      I3_PID_BDC__FH_DENORMIERUNGS_LOGGER_LESEN_REAR, 90, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_RESERVED_5_WERT"
+
+// 0x603E I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_ZAEHLER_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_1_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_1_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_1_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_1_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_1_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_1_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_1_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_2_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_2_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 13, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_2_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 15, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_2_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 19, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_2_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_2_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 21, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_2_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_3_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_3_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 24, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_3_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 26, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_3_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 30, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_3_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_3_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_3_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_4_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_4_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 35, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_4_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 37, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_4_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 41, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_4_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_4_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 43, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_4_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_5_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_5_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 46, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_5_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_KM_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_5_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 52, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_5_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FA_REVERSIEREN_5_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FA_REVERSIEREN_5_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_ZAEHLER_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_1_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_1_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 58, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_1_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_1_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 64, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_1_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_1_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 66, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_1_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_2_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_2_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 69, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_2_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 71, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_2_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 75, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_2_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_2_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 77, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_2_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_3_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_3_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 80, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_3_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 82, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_3_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 86, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_3_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 87, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_3_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 88, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_3_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_4_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 90, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_4_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 91, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_4_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 93, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_4_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 97, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_4_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 98, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_4_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 99, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_4_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_5_URSACHE_NR              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 101, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_5_POS_HALL_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 102, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_5_KM_WERT                 I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 104, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_KM_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_5_ATEMP_WERT              I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 108, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_5_SPANNUNG_WERT           I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 109, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BF_REVERSIEREN_5_GESCHWINDIGKEIT_WERT    I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_FRONT, 110, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BF_REVERSIEREN_5_GESCHWINDIGKEIT_WERT"
+
+// 0x603F I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_ZAEHLER_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_1_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_1_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_1_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_1_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_1_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_1_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_1_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_2_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_2_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 13, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_2_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 15, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_2_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 19, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_2_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_2_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 21, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_2_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_3_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_3_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 24, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_3_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 26, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_3_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 30, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_3_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_3_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_3_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_4_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_4_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 35, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_4_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 37, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_4_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 41, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_4_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_4_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 43, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_4_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_5_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_5_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 46, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_5_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_KM_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_5_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 52, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_5_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_FAH_REVERSIEREN_5_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FAH_REVERSIEREN_5_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_ZAEHLER_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_ZAEHLER_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_1_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_1_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 58, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_1_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_1_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 64, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_1_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_1_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 66, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_1_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_2_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_2_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 69, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_2_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 71, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_2_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 75, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_2_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_2_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 77, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_2_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_3_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_3_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 80, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_3_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 82, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_3_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 86, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_3_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 87, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_3_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 88, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_3_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_4_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 90, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_4_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 91, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_4_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 93, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_4_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 97, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_4_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 98, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_4_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 99, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_4_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_5_URSACHE_NR             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 101, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_URSACHE_NR"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_5_POS_HALL_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 102, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_POS_HALL_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_5_KM_WERT                I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 104, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_KM_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_5_ATEMP_WERT             I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 108, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_ATEMP_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_5_SPANNUNG_WERT          I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 109, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_SPANNUNG_WERT"
+#define I3_FLD_BDC_STAT_BFH_REVERSIEREN_5_GESCHWINDIGKEIT_WERT   I3_PID_BDC__FH_REVERSIER_LOGGER_LESEN_REAR, 110, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BFH_REVERSIEREN_5_GESCHWINDIGKEIT_WERT"
+
+// 0x6042 I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT
+#define I3_FLD_BDC_STAT_FA_STOPREASON_1_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_1_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_2_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_2_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_3_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_3_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_4_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_4_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_5_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_5_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_6_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_6_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_7_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_7_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_8_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_8_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_9_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_9_NR"
+#define I3_FLD_BDC_STAT_FA_STOPREASON_10_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FA_STOPREASON_10_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_1_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_1_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_2_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_2_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_3_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_3_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_4_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_4_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_5_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_5_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_6_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_6_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_7_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_7_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_8_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_8_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_9_NR                       I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_9_NR"
+#define I3_FLD_BDC_STAT_BF_STOPREASON_10_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_FRONT, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BF_STOPREASON_10_NR"
+
+// 0x6043 I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_1_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_1_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_2_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_2_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_3_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_3_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_4_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_4_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_5_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_5_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_6_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_6_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_7_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_7_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_8_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_8_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_9_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_9_NR"
+#define I3_FLD_BDC_STAT_FAH_STOPREASON_10_NR                     I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAH_STOPREASON_10_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_1                         I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_1"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_2                         I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_2"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_3_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_3_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_4_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_4_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_5_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_5_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_6_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_6_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_7_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_7_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_8_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_8_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_9_NR                      I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_9_NR"
+#define I3_FLD_BDC_STAT_BFH_STOPREASON_10_NR                     I3_PID_BDC__FH_MOTORSTOP_LOGGER_LESEN_REAR, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BFH_STOPREASON_10_NR"
+
+// 0xF003 I3_PID_BDC__STEUERN_DFZ_VERBINDUNGSENDE
+
+// 0xF005 I3_PID_BDC__ECU_HW_RESET
+
+// 0xF105 I3_PID_BDC__LWR_STATISTIK_RESET
@@ -0,0 +1,853 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/dsc_i1.json: DSC 29: Dynamic stability controller
+// This generated code  makes it easier to process CANBUS messages from the DSC ecu in a BMW i3
+//
+
+// 0x1060 I3_PID_DSC_FS_LOESCHEN_PERMANENT
+
+// 0x1061 I3_PID_DSC_FEHLERSPEICHER_ENDE_WERKSABLAUF
+#define I3_FLD_DSC_STAT_FS_ENDE_WABL                             I3_PID_DSC_FEHLERSPEICHER_ENDE_WERKSABLAUF, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FS_ENDE_WABL"
+
+// 0xA051 I3_PID_DSC_START_ADAPTIVDATEN_RUECKSETZEN
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS                           I3_PID_DSC_START_ADAPTIVDATEN_RUECKSETZEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS"
+
+// 0xA052 I3_PID_DSC_STEUERN_AX_AY_ABGLEICH
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS_0XA052                    I3_PID_DSC_STEUERN_AX_AY_ABGLEICH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA052"
+
+// 0xA053 I3_PID_DSC_START_ADAPTIVDATEN_WERKSMODUS
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS_0XA053                    I3_PID_DSC_START_ADAPTIVDATEN_WERKSMODUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA053"
+
+// 0xA05B I3_PID_DSC_STEUERN_ADAPTIVDATEN_SLW_RESET
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS_0XA05B                    I3_PID_DSC_STEUERN_ADAPTIVDATEN_SLW_RESET, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA05B"
+#define I3_FLD_DSC_STAT_DATEN_SCHREIBEN_AKTIV_NR                 I3_PID_DSC_STEUERN_ADAPTIVDATEN_SLW_RESET, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DATEN_SCHREIBEN_AKTIV_NR"
+
+// 0xA068 I3_PID_DSC_RPA_RESET_STATISTIK
+
+// 0xA070 I3_PID_DSC_DSC_DRUCKSENSOREN_KALIBRIERUNG
+
+// 0xA074 I3_PID_DSC_RPA_RESET_STANDARDISIERUNG
+
+// 0xA087 I3_PID_DSC_DAC_RESET
+
+// 0xA088 I3_PID_DSC_DAC_AUSLOESUNG
+
+// 0xA123 I3_PID_DSC_IPB_LED
+#define I3_FLD_DSC_STAT_IPB_LED_ZUSTAND                          I3_PID_DSC_IPB_LED, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_IPB_LED_ZUSTAND"
+
+// 0xA130 I3_PID_DSC_FLM_RESET
+#define I3_FLD_DSC_STAT_FLM_RESET                                I3_PID_DSC_FLM_RESET, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLM_RESET"
+
+// 0xA1AA I3_PID_DSC_EXTERNE_ANFORDERUNG_GKU_IPB_ZAEHLER_RUECKSETZEN
+
+// 0xA1BE I3_PID_DSC_EXTERNE_ANFORDERUNG_EPB_ZAEHLER_RUECKSETZEN
+
+// 0xA222 I3_PID_DSC_DSC_PUMPENFUNKTIONSTEST
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS_0XA222                    I3_PID_DSC_DSC_PUMPENFUNKTIONSTEST, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XA222"
+#define I3_FLD_DSC_STAT_PUMPENLEISTUNG_LEERLAUF_WERT             I3_PID_DSC_DSC_PUMPENFUNKTIONSTEST, 1, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PUMPENLEISTUNG_LEERLAUF_WERT"
+#define I3_FLD_DSC_STAT_PUMPENLEISTUNG_KREIS_1_WERT              I3_PID_DSC_DSC_PUMPENFUNKTIONSTEST, 3, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PUMPENLEISTUNG_KREIS_1_WERT"
+#define I3_FLD_DSC_STAT_PUMPENLEISTUNG_KREIS_2_WERT              I3_PID_DSC_DSC_PUMPENFUNKTIONSTEST, 5, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PUMPENLEISTUNG_KREIS_2_WERT"
+
+// 0xA2A2 I3_PID_DSC_STEUERN_ANTI_POWER_HOP_FUNKTION_ZAEHLER_RUECKSETZEN
+
+// 0xAB5B I3_PID_DSC_STEUERN_EEPROM_SCHREIBEN
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS_0XAB5B                    I3_PID_DSC_STEUERN_EEPROM_SCHREIBEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XAB5B"
+#define I3_FLD_DSC_STAT_EEPROM_SICHERN_NR                        I3_PID_DSC_STEUERN_EEPROM_SCHREIBEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EEPROM_SICHERN_NR"
+
+// 0xABA3 I3_PID_DSC_START_ADAPTIVDATEN_WERKSMODUS_2
+#define I3_FLD_DSC_STAT_ROUTINE_STATUS_0XABA3                    I3_PID_DSC_START_ADAPTIVDATEN_WERKSMODUS_2, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS_0XABA3"
+
+// 0xD09A I3_PID_DSC_GMK_DATEN
+#define I3_FLD_DSC_STAT_ZUSTAND_IST_GMK_WERT                     I3_PID_DSC_GMK_DATEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZUSTAND_IST_GMK_WERT"
+#define I3_FLD_DSC_STAT_ZUSTAND_SOLL_GMK_WERT                    I3_PID_DSC_GMK_DATEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZUSTAND_SOLL_GMK_WERT"
+#define I3_FLD_DSC_STAT_MMOTOR_OFFSET_EPS_WERT                   I3_PID_DSC_GMK_DATEN, 2, PID_FIELD_SINT8, 0.01f, 0.0f, "STAT_MMOTOR_OFFSET_EPS_WERT"
+#define I3_FLD_DSC_STAT_OFFSET_EPS_QUALIFIER_WERT                I3_PID_DSC_GMK_DATEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_OFFSET_EPS_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_FUNKTION_GMK_CODIERUNG_EIN               I3_PID_DSC_GMK_DATEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUNKTION_GMK_CODIERUNG_EIN"
+#define I3_FLD_DSC_STAT_MMOTOR_OFFSET_GMK_EPS_WERT               I3_PID_DSC_GMK_DATEN, 5, PID_FIELD_SINT8, 0.01f, 0.0f, "STAT_MMOTOR_OFFSET_GMK_EPS_WERT"
+#define I3_FLD_DSC_STAT_LENKUNG_VERBAUT_FAHRZEUG_WERT            I3_PID_DSC_GMK_DATEN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LENKUNG_VERBAUT_FAHRZEUG_WERT"
+#define I3_FLD_DSC_STAT_EPS_FAKT_MOM_SERVICE_QUALIFIER_WERT      I3_PID_DSC_GMK_DATEN, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EPS_FAKT_MOM_SERVICE_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_FUNKTION_GBR_KENNLINIE_NUMMER_WERT       I3_PID_DSC_GMK_DATEN, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUNKTION_GBR_KENNLINIE_NUMMER_WERT"
+
+// 0xD0D2 I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR
+#define I3_FLD_DSC_STAT_WEG_IST_SENSOR1_WERT                     I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_IST_SENSOR1_WERT"
+#define I3_FLD_DSC_STAT_WEG_NULLPUNKT_INIT_SENSOR1_WERT          I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 2, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_INIT_SENSOR1_WERT"
+#define I3_FLD_DSC_STAT_WEG_NULLPUNKT_IST_SENSOR1_WERT           I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 4, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_IST_SENSOR1_WERT"
+#define I3_FLD_DSC_STAT_WEG_LEERWEG_IST_SENSOR1_WERT             I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 6, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_LEERWEG_IST_SENSOR1_WERT"
+#define I3_FLD_DSC_STAT_WEG_NULLPUNKT_INIT_SENSOR2_WERT          I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 8, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_INIT_SENSOR2_WERT"
+#define I3_FLD_DSC_STAT_WEG_NULLPUNKT_IST_SENSOR2_WERT           I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 10, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_IST_SENSOR2_WERT"
+#define I3_FLD_DSC_STAT_WEG_LEERWEG_IST_SENSOR2_WERT             I3_PID_DSC_STATUS_BREMSPEDALWINKELSENSOR, 12, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_LEERWEG_IST_SENSOR2_WERT"
+
+// 0xD272 I3_PID_DSC_CBS_BREMSE_DETAILS
+#define I3_FLD_DSC_STAT_VA_IDENT_WERT                            I3_PID_DSC_CBS_BREMSE_DETAILS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VA_IDENT_WERT"
+#define I3_FLD_DSC_STAT_VA_S_SIGNAL_WERT                         I3_PID_DSC_CBS_BREMSE_DETAILS, 1, PID_FIELD_UINT16, 100.0f, 0.0f, "STAT_VA_S_SIGNAL_WERT"
+#define I3_FLD_DSC_STAT_VA_S_WECHSEL_WERT                        I3_PID_DSC_CBS_BREMSE_DETAILS, 3, PID_FIELD_UINT16, 100.0f, 0.0f, "STAT_VA_S_WECHSEL_WERT"
+#define I3_FLD_DSC_STAT_VA_S_REST_ORIG_WERT                      I3_PID_DSC_CBS_BREMSE_DETAILS, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VA_S_REST_ORIG_WERT"
+#define I3_FLD_DSC_STAT_VA_S_MIN_WERT                            I3_PID_DSC_CBS_BREMSE_DETAILS, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VA_S_MIN_WERT"
+#define I3_FLD_DSC_STAT_VA_S_MAX_WERT                            I3_PID_DSC_CBS_BREMSE_DETAILS, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VA_S_MAX_WERT"
+#define I3_FLD_DSC_STAT_VA_S_REST_WERT                           I3_PID_DSC_CBS_BREMSE_DETAILS, 11, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VA_S_REST_WERT"
+#define I3_FLD_DSC_STAT_VA_S_GESAMT_1_WERT                       I3_PID_DSC_CBS_BREMSE_DETAILS, 15, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VA_S_GESAMT_1_WERT"
+#define I3_FLD_DSC_STAT_VA_S_GESAMT_2_WERT                       I3_PID_DSC_CBS_BREMSE_DETAILS, 19, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VA_S_GESAMT_2_WERT"
+#define I3_FLD_DSC_STAT_VA_S_GESAMT_3_WERT                       I3_PID_DSC_CBS_BREMSE_DETAILS, 23, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VA_S_GESAMT_3_WERT"
+#define I3_FLD_DSC_STAT_VA_SZ_WERT                               I3_PID_DSC_CBS_BREMSE_DETAILS, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VA_SZ_WERT"
+#define I3_FLD_DSC_BF_VA_FLAG_BVA                                I3_PID_DSC_CBS_BREMSE_DETAILS, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_VA_FLAG_BVA"
+#define I3_FLD_DSC_BF_VA_RESET_VERHINDERER_1                     I3_PID_DSC_CBS_BREMSE_DETAILS, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_VA_RESET_VERHINDERER_1"
+#define I3_FLD_DSC_BF_VA_RESET_VERHINDERER_2                     I3_PID_DSC_CBS_BREMSE_DETAILS, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_VA_RESET_VERHINDERER_2"
+#define I3_FLD_DSC_STAT_HA_IDENT_WERT                            I3_PID_DSC_CBS_BREMSE_DETAILS, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HA_IDENT_WERT"
+#define I3_FLD_DSC_STAT_HA_S_SIGNAL_WERT                         I3_PID_DSC_CBS_BREMSE_DETAILS, 32, PID_FIELD_UINT16, 100.0f, 0.0f, "STAT_HA_S_SIGNAL_WERT"
+#define I3_FLD_DSC_STAT_HA_S_WECHSEL_WERT                        I3_PID_DSC_CBS_BREMSE_DETAILS, 34, PID_FIELD_UINT16, 100.0f, 0.0f, "STAT_HA_S_WECHSEL_WERT"
+#define I3_FLD_DSC_STAT_HA_S_REST_ORIG_WERT                      I3_PID_DSC_CBS_BREMSE_DETAILS, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HA_S_REST_ORIG_WERT"
+#define I3_FLD_DSC_STAT_HA_S_MIN_WERT                            I3_PID_DSC_CBS_BREMSE_DETAILS, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HA_S_MIN_WERT"
+#define I3_FLD_DSC_STAT_HA_S_MAX_WERT                            I3_PID_DSC_CBS_BREMSE_DETAILS, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HA_S_MAX_WERT"
+#define I3_FLD_DSC_STAT_HA_S_REST_WERT                           I3_PID_DSC_CBS_BREMSE_DETAILS, 42, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HA_S_REST_WERT"
+#define I3_FLD_DSC_STAT_HA_S_GESAMT_1_WERT                       I3_PID_DSC_CBS_BREMSE_DETAILS, 46, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HA_S_GESAMT_1_WERT"
+#define I3_FLD_DSC_STAT_HA_S_GESAMT_2_WERT                       I3_PID_DSC_CBS_BREMSE_DETAILS, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HA_S_GESAMT_2_WERT"
+#define I3_FLD_DSC_STAT_HA_S_GESAMT_3_WERT                       I3_PID_DSC_CBS_BREMSE_DETAILS, 54, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HA_S_GESAMT_3_WERT"
+#define I3_FLD_DSC_STAT_HA_SZ_WERT                               I3_PID_DSC_CBS_BREMSE_DETAILS, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HA_SZ_WERT"
+#define I3_FLD_DSC_BF_HA_FLAG_BVA                                I3_PID_DSC_CBS_BREMSE_DETAILS, 59, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_HA_FLAG_BVA"
+#define I3_FLD_DSC_BF_HA_RESET_VERHINDERER_1                     I3_PID_DSC_CBS_BREMSE_DETAILS, 60, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_HA_RESET_VERHINDERER_1"
+#define I3_FLD_DSC_BF_HA_RESET_VERHINDERER_2                     I3_PID_DSC_CBS_BREMSE_DETAILS, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_HA_RESET_VERHINDERER_2"
+
+// 0xD62E I3_PID_DSC_FES_COORDINT_SW_FEHLER_INFO
+#define I3_FLD_DSC_STAT_FES_COORDINT_SW_FEHLER_INFO_WERT         I3_PID_DSC_FES_COORDINT_SW_FEHLER_INFO, 0, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_FES_COORDINT_SW_FEHLER_INFO_WERT"
+
+// 0xD6D6 I3_PID_DSC_FLM_LESEN
+
+// 0xD804 I3_PID_DSC_EMF_LERNDATEN_STATISTIK
+#define I3_FLD_DSC_STAT_ZAEHLER_FESTELLEN_STEIGUNG20_WERT        I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_FESTELLEN_STEIGUNG20_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_NACHSPANNEN_ROLLUEBERWACHUNG_WERT I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_NACHSPANNEN_ROLLUEBERWACHUNG_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_NACHSPANNEN_TEMPERATUR_WERT      I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_NACHSPANNEN_TEMPERATUR_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_AUTO_ADJUST_WERT                 I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_AUTO_ADJUST_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_NACHSPANNEN_PRAEVENTIV_WERT      I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_NACHSPANNEN_PRAEVENTIV_WERT"
+#define I3_FLD_DSC_STAT_RESERVE5_WERT                            I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE5_WERT"
+#define I3_FLD_DSC_STAT_RESERVE6_WERT                            I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE6_WERT"
+#define I3_FLD_DSC_STAT_RESERVE7_WERT                            I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE7_WERT"
+#define I3_FLD_DSC_STAT_RESERVE8_WERT                            I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE8_WERT"
+#define I3_FLD_DSC_STAT_RESERVE9_WERT                            I3_PID_DSC_EMF_LERNDATEN_STATISTIK, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE9_WERT"
+
+// 0xD805 I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL
+#define I3_FLD_DSC_STAT_SPANNUNG_MOTOR_HL_WERT                   I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 0, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_SPANNUNG_MOTOR_HL_WERT"
+#define I3_FLD_DSC_STAT_STROM_MOTOR_HL_WERT                      I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 2, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_STROM_MOTOR_HL_WERT"
+#define I3_FLD_DSC_STAT_TEMPERATUR_MOTOR_HL_WERT                 I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 4, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_TEMPERATUR_MOTOR_HL_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_MOTOR_HR_WERT                   I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 6, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_SPANNUNG_MOTOR_HR_WERT"
+#define I3_FLD_DSC_STAT_STROM_MOTOR_HR_WERT                      I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 8, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_STROM_MOTOR_HR_WERT"
+#define I3_FLD_DSC_STAT_TEMPERATUR_MOTOR_HR_WERT                 I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 10, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_TEMPERATUR_MOTOR_HR_WERT"
+#define I3_FLD_DSC_STAT_AKTUATOR_R                               I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AKTUATOR_R"
+#define I3_FLD_DSC_STAT_AKTUATOR_L                               I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AKTUATOR_L"
+#define I3_FLD_DSC_STAT_HU_MODE_STATUS                           I3_PID_DSC_EMF_AKTUATOR_KOMBISATTEL, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HU_MODE_STATUS"
+
+// 0xD808 I3_PID_DSC_EMF_LERNDATEN_TASTER
+#define I3_FLD_DSC_STAT_ZAEHLER_TASTER_FESTSTELLEN_WERT          I3_PID_DSC_EMF_LERNDATEN_TASTER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_TASTER_FESTSTELLEN_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_TASTER_LOESEN_WERT               I3_PID_DSC_EMF_LERNDATEN_TASTER, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_TASTER_LOESEN_WERT"
+
+// 0xD80A I3_PID_DSC_EMF_LERNDATEN_AKTUATOR
+#define I3_FLD_DSC_STAT_ZAEHLER_AKTUATOR_FESTSTELLEN_WERT        I3_PID_DSC_EMF_LERNDATEN_AKTUATOR, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_FESTSTELLEN_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_AKTUATOR_NOTENTRIEGELN_WERT      I3_PID_DSC_EMF_LERNDATEN_AKTUATOR, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_NOTENTRIEGELN_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_AKTUATOR_BOOST_WERT              I3_PID_DSC_EMF_LERNDATEN_AKTUATOR, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_BOOST_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_AKTUATOR_UEBERLAST_WERT          I3_PID_DSC_EMF_LERNDATEN_AKTUATOR, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_AKTUATOR_UEBERLAST_WERT"
+
+// 0xD80C I3_PID_DSC_EMF_KLEMMEN_KOMBISATTEL
+#define I3_FLD_DSC_STAT_SPANNUNG_ELEKTRONIK_WERT                 I3_PID_DSC_EMF_KLEMMEN_KOMBISATTEL, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_ELEKTRONIK_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_AKUATOR_HL_WERT                 I3_PID_DSC_EMF_KLEMMEN_KOMBISATTEL, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_AKUATOR_HL_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_AKUATOR_HR_WERT                 I3_PID_DSC_EMF_KLEMMEN_KOMBISATTEL, 4, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_AKUATOR_HR_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_WECKLEITUNG_WERT                I3_PID_DSC_EMF_KLEMMEN_KOMBISATTEL, 6, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_WECKLEITUNG_WERT"
+
+// 0xD80D I3_PID_DSC_EMF_TASTER
+#define I3_FLD_DSC_STAT_TASTER_EMF                               I3_PID_DSC_EMF_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_EMF"
+#define I3_FLD_DSC_STAT_TASTER_EMF_DIGITAL_WERT                  I3_PID_DSC_EMF_TASTER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_EMF_DIGITAL_WERT"
+#define I3_FLD_DSC_STAT_TASTER_EMF_1_WERT                        I3_PID_DSC_EMF_TASTER, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_TASTER_EMF_1_WERT"
+#define I3_FLD_DSC_STAT_TASTER_EMF_2_WERT                        I3_PID_DSC_EMF_TASTER, 4, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_TASTER_EMF_2_WERT"
+#define I3_FLD_DSC_STAT_TASTER_EMF_3_WERT                        I3_PID_DSC_EMF_TASTER, 6, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_TASTER_EMF_3_WERT"
+#define I3_FLD_DSC_STAT_TASTER_EMF_4_WERT                        I3_PID_DSC_EMF_TASTER, 8, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_TASTER_EMF_4_WERT"
+#define I3_FLD_DSC_STAT_TASTER_EMF_5_WERT                        I3_PID_DSC_EMF_TASTER, 10, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_TASTER_EMF_5_WERT"
+
+// 0xD81A I3_PID_DSC_EXTERNE_ANFORDERUNG_GKU_IPB_ZAEHLER_LESEN
+#define I3_FLD_DSC_STAT_AKTUELLER_ZAEHLERSTAND_GKU_WERT          I3_PID_DSC_EXTERNE_ANFORDERUNG_GKU_IPB_ZAEHLER_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AKTUELLER_ZAEHLERSTAND_GKU_WERT"
+
+// 0xD8EB I3_PID_DSC_STATUS_LESEN_ANTI_POWER_HOP_FUNKTION_ZAEHLER_LESEN
+#define I3_FLD_DSC_STAT_ZAEHLER_ANTI_POWER_HOP_FUNKTION_WERT     I3_PID_DSC_STATUS_LESEN_ANTI_POWER_HOP_FUNKTION_ZAEHLER_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_ANTI_POWER_HOP_FUNKTION_WERT"
+
+// 0xDB5B I3_PID_DSC_STATUS_MODUS_ROLLENPRUEFSTAND
+#define I3_FLD_DSC_STAT_ROLLENMODUS_NR                           I3_PID_DSC_STATUS_MODUS_ROLLENPRUEFSTAND, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ROLLENMODUS_NR"
+
+// 0xDBD9 I3_PID_DSC_STATUS_GIERRATE
+#define I3_FLD_DSC_STAT_GIERRATE_SENSOR_NR                       I3_PID_DSC_STATUS_GIERRATE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GIERRATE_SENSOR_NR"
+
+// 0xDBDA I3_PID_DSC_STATUS_QUERBESCHLEUNIGUNG
+#define I3_FLD_DSC_STAT_QUERBESCHLEUNIGUNG_SENSOR_NR             I3_PID_DSC_STATUS_QUERBESCHLEUNIGUNG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_QUERBESCHLEUNIGUNG_SENSOR_NR"
+
+// 0xDBDB I3_PID_DSC_STATUS_LAENGSBESCHLEUNIGUNG
+#define I3_FLD_DSC_STAT_LAENGSBESCHLEUNIGUNG_SENSOR1_NR          I3_PID_DSC_STATUS_LAENGSBESCHLEUNIGUNG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LAENGSBESCHLEUNIGUNG_SENSOR1_NR"
+
+// 0xDBDF I3_PID_DSC_BREMSBELAGSSENSOR
+#define I3_FLD_DSC_STAT_PILLE_VA                                 I3_PID_DSC_BREMSBELAGSSENSOR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PILLE_VA"
+#define I3_FLD_DSC_STAT_PILLE_HA                                 I3_PID_DSC_BREMSBELAGSSENSOR, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PILLE_HA"
+
+// 0xDBE3 I3_PID_DSC_REIFENPANNENANZEIGE
+#define I3_FLD_DSC_STAT_WARNUNG_AKTIV                            I3_PID_DSC_REIFENPANNENANZEIGE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WARNUNG_AKTIV"
+#define I3_FLD_DSC_STAT_FUNKTION_AKTIV                           I3_PID_DSC_REIFENPANNENANZEIGE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUNKTION_AKTIV"
+#define I3_FLD_DSC_STAT_PLATTROLLEN_ERKANNT                      I3_PID_DSC_REIFENPANNENANZEIGE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PLATTROLLEN_ERKANNT"
+#define I3_FLD_DSC_STAT_3PLUS1_ERKANNT                           I3_PID_DSC_REIFENPANNENANZEIGE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3PLUS1_ERKANNT"
+#define I3_FLD_DSC_STAT_NEUREIFEN_ERKANNT                        I3_PID_DSC_REIFENPANNENANZEIGE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NEUREIFEN_ERKANNT"
+#define I3_FLD_DSC_STAT_NAEHERUNG_WARNGRENZE_WERT                I3_PID_DSC_REIFENPANNENANZEIGE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NAEHERUNG_WARNGRENZE_WERT"
+#define I3_FLD_DSC_STAT_PANNEN_POSITION                          I3_PID_DSC_REIFENPANNENANZEIGE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PANNEN_POSITION"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_0_100_WERT            I3_PID_DSC_REIFENPANNENANZEIGE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_0_100_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_100_190_WERT          I3_PID_DSC_REIFENPANNENANZEIGE, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_100_190_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_UEBER_190_WERT        I3_PID_DSC_REIFENPANNENANZEIGE, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_UEBER_190_WERT"
+
+// 0xDBE4 I3_PID_DSC_GESCHWINDIGKEIT_RAD
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_RAD_VL_WERT              I3_PID_DSC_GESCHWINDIGKEIT_RAD, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_VL_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_RAD_VR_WERT              I3_PID_DSC_GESCHWINDIGKEIT_RAD, 2, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_VR_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_RAD_HL_WERT              I3_PID_DSC_GESCHWINDIGKEIT_RAD, 4, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_HL_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_RAD_HR_WERT              I3_PID_DSC_GESCHWINDIGKEIT_RAD, 6, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_RAD_HR_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_FZG_WERT                 I3_PID_DSC_GESCHWINDIGKEIT_RAD, 8, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_GESCHWINDIGKEIT_FZG_WERT"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_VL                          I3_PID_DSC_GESCHWINDIGKEIT_RAD, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_VL"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_VR                          I3_PID_DSC_GESCHWINDIGKEIT_RAD, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_VR"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_HL                          I3_PID_DSC_GESCHWINDIGKEIT_RAD, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_HL"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_HR                          I3_PID_DSC_GESCHWINDIGKEIT_RAD, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_HR"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_REF                         I3_PID_DSC_GESCHWINDIGKEIT_RAD, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_REF"
+#define I3_FLD_DSC_STAT_SIGNALQUALITAET_VL_WERT                  I3_PID_DSC_GESCHWINDIGKEIT_RAD, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIGNALQUALITAET_VL_WERT"
+#define I3_FLD_DSC_STAT_SIGNALQUALITAET_VR_WERT                  I3_PID_DSC_GESCHWINDIGKEIT_RAD, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIGNALQUALITAET_VR_WERT"
+#define I3_FLD_DSC_STAT_SIGNALQUALITAET_HL_WERT                  I3_PID_DSC_GESCHWINDIGKEIT_RAD, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIGNALQUALITAET_HL_WERT"
+#define I3_FLD_DSC_STAT_SIGNALQUALITAET_HR_WERT                  I3_PID_DSC_GESCHWINDIGKEIT_RAD, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIGNALQUALITAET_HR_WERT"
+
+// 0xDBE5 I3_PID_DSC_DSC_DRUCKSENSOREN
+#define I3_FLD_DSC_STAT_DRUCK_KREIS1_WERT                        I3_PID_DSC_DSC_DRUCKSENSOREN, 0, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_DRUCK_KREIS1_WERT"
+#define I3_FLD_DSC_STAT_DRUCK_KREIS2_WERT                        I3_PID_DSC_DSC_DRUCKSENSOREN, 2, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_DRUCK_KREIS2_WERT"
+#define I3_FLD_DSC_STAT_DRUCK_VL_WERT                            I3_PID_DSC_DSC_DRUCKSENSOREN, 4, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_DRUCK_VL_WERT"
+#define I3_FLD_DSC_STAT_DRUCK_VR_WERT                            I3_PID_DSC_DSC_DRUCKSENSOREN, 6, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_DRUCK_VR_WERT"
+#define I3_FLD_DSC_STAT_DRUCK_HL_WERT                            I3_PID_DSC_DSC_DRUCKSENSOREN, 8, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_DRUCK_HL_WERT"
+#define I3_FLD_DSC_STAT_DRUCK_HR_WERT                            I3_PID_DSC_DSC_DRUCKSENSOREN, 10, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_DRUCK_HR_WERT"
+
+// 0xDBE7 I3_PID_DSC_DSC_KLEMMEN
+#define I3_FLD_DSC_STAT_SPANNUNG_ELEKTRONIK_WERT_0XDBE7          I3_PID_DSC_DSC_KLEMMEN, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_ELEKTRONIK_WERT_0XDBE7"
+#define I3_FLD_DSC_STAT_SPANNUNG_PUMPE_WERT                      I3_PID_DSC_DSC_KLEMMEN, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_PUMPE_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_VENTILE_WERT                    I3_PID_DSC_DSC_KLEMMEN, 4, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_VENTILE_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_WECKLEITUNG_WERT_0XDBE7         I3_PID_DSC_DSC_KLEMMEN, 6, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_WECKLEITUNG_WERT_0XDBE7"
+
+// 0xDBF4 I3_PID_DSC_VAKUUMSENSOR
+#define I3_FLD_DSC_STAT_DRUCK_IST_WERT                           I3_PID_DSC_VAKUUMSENSOR, 0, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_DRUCK_IST_WERT"
+#define I3_FLD_DSC_STAT_SPANNUNG_IST_WERT                        I3_PID_DSC_VAKUUMSENSOR, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_IST_WERT"
+
+// 0xDBF5 I3_PID_DSC_BREMSPEDALWEGSENSOR
+#define I3_FLD_DSC_STAT_WEG_IST_WERT                             I3_PID_DSC_BREMSPEDALWEGSENSOR, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_IST_WERT"
+#define I3_FLD_DSC_STAT_WEG_NULLPUNKT_INIT_WERT                  I3_PID_DSC_BREMSPEDALWEGSENSOR, 2, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_INIT_WERT"
+#define I3_FLD_DSC_STAT_WEG_NULLPUNKT_IST_WERT                   I3_PID_DSC_BREMSPEDALWEGSENSOR, 4, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_NULLPUNKT_IST_WERT"
+#define I3_FLD_DSC_STAT_WEG_LEERWEG_IST_WERT                     I3_PID_DSC_BREMSPEDALWEGSENSOR, 6, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_WEG_LEERWEG_IST_WERT"
+
+// 0xDBF6 I3_PID_DSC_BREMSREKUPERATIONSMOMENT
+#define I3_FLD_DSC_STAT_MOMENT_SOLL_WERT                         I3_PID_DSC_BREMSREKUPERATIONSMOMENT, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MOMENT_SOLL_WERT"
+#define I3_FLD_DSC_STAT_MOMENT_IST_WERT                          I3_PID_DSC_BREMSREKUPERATIONSMOMENT, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MOMENT_IST_WERT"
+
+// 0xDC13 I3_PID_DSC_STATUS_ADAPTIVDATEN_ZUSTAND
+#define I3_FLD_DSC_STAT_ADAPTIVDATEN_RUECKSETZEN_NR              I3_PID_DSC_STATUS_ADAPTIVDATEN_ZUSTAND, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_ADAPTIVDATEN_RUECKSETZEN_NR"
+#define I3_FLD_DSC_STAT_AX_AY_ABGLEICH_NR                        I3_PID_DSC_STATUS_ADAPTIVDATEN_ZUSTAND, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AX_AY_ABGLEICH_NR"
+#define I3_FLD_DSC_STAT_ADAPTIVDATEN_WERKSMODUS_NR               I3_PID_DSC_STATUS_ADAPTIVDATEN_ZUSTAND, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ADAPTIVDATEN_WERKSMODUS_NR"
+#define I3_FLD_DSC_STAT_ADAPTIVDATEN_LERNWERTE_AKTIV_NR          I3_PID_DSC_STATUS_ADAPTIVDATEN_ZUSTAND, 10, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_ADAPTIVDATEN_LERNWERTE_AKTIV_NR"
+
+// 0xDC14 I3_PID_DSC_RPA_LERNDATEN_STATISTIK
+#define I3_FLD_DSC_STAT_RPA_VERSION_NR_1_WERT                    I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RPA_VERSION_NR_1_WERT"
+#define I3_FLD_DSC_STAT_RPA_VERSION_NR_2_WERT                    I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RPA_VERSION_NR_2_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_STANDARDISIERUNG_WERT          I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_STANDARDISIERUNG_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_STANDARDISIERUNG_MINUS_1_WERT  I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_STANDARDISIERUNG_MINUS_1_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_STANDARDISIERUNG_MINUS_2_WERT  I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_STANDARDISIERUNG_MINUS_2_WERT"
+#define I3_FLD_DSC_STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_WERT  I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_WERT"
+#define I3_FLD_DSC_STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_MINUS_1_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_MINUS_1_WERT"
+#define I3_FLD_DSC_STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_MINUS_2_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_STANDARDISIERUNG_MINUS_2_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_PANNE_WERT                     I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_PANNE_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_PANNE_MINUS_1_WERT             I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_PANNE_MINUS_1_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_PANNE_MINUS_2_WERT             I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_PANNE_MINUS_2_WERT"
+#define I3_FLD_DSC_STAT_TAGE_SEIT_LETZTER_PANNE_WERT             I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_PANNE_WERT"
+#define I3_FLD_DSC_STAT_TAGE_SEIT_LETZTER_PANNE_MINUS_1_WERT     I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_PANNE_MINUS_1_WERT"
+#define I3_FLD_DSC_STAT_TAGE_SEIT_LETZTER_PANNE_MINUS_2_WERT     I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAGE_SEIT_LETZTER_PANNE_MINUS_2_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_LETZTE_PANNE_WERT        I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_LETZTE_PANNE_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_LETZTE_PANNE_MINUS_1_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_LETZTE_PANNE_MINUS_1_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_LETZTE_PANNE_MINUS_2_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_LETZTE_PANNE_MINUS_2_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_WERT    I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_MINUS_1_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_MINUS_1_WERT"
+#define I3_FLD_DSC_STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_MINUS_2_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GESCHWINDIGKEIT_MAX_LETZTE_PANNE_MINUS_2_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_3PLUS1_ERKENNUNG_WERT          I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_3PLUS1_ERKENNUNG_WERT"
+#define I3_FLD_DSC_STAT_KM_LETZTE_NEUREIFEN_ERKENNUNG_WERT       I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_LETZTE_NEUREIFEN_ERKENNUNG_WERT"
+#define I3_FLD_DSC_STAT_NEUREIFEN_POSITON                        I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NEUREIFEN_POSITON"
+#define I3_FLD_DSC_STAT_URSACHE_WARNUNG_WERT                     I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_URSACHE_WARNUNG_WERT"
+#define I3_FLD_DSC_STAT_MAX_NAEHERUNG_WARNGRENZE_SEIT_LETZTER_STD_WERT I3_PID_DSC_RPA_LERNDATEN_STATISTIK, 54, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MAX_NAEHERUNG_WARNGRENZE_SEIT_LETZTER_STD_WERT"
+
+// 0xDC15 I3_PID_DSC_RPA_LERNDATEN_STD
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_0_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_0_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_1_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_1_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_2_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_2_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_3_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_3_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_4_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_4_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_5_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_5_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_6_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_6_WERT"
+#define I3_FLD_DSC_STAT_LERNSTATUS_BEREICH_7_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LERNSTATUS_BEREICH_7_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_0_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_0_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_1_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_1_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_2_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_2_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_3_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_3_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_4_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_4_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_5_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_5_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_6_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_6_WERT"
+#define I3_FLD_DSC_STAT_KURVENKOMPENSATION_7_WERT                I3_PID_DSC_RPA_LERNDATEN_STD, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KURVENKOMPENSATION_7_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_0_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_0_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_1_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_1_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_2_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_2_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_3_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_3_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_4_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_4_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_5_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_5_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_6_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_6_WERT"
+#define I3_FLD_DSC_STAT_MOMENTENKOMPENSATION_7_WERT              I3_PID_DSC_RPA_LERNDATEN_STD, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOMENTENKOMPENSATION_7_WERT"
+
+// 0xDC1E I3_PID_DSC_DSC_BREMSLICHTSCHALTER
+#define I3_FLD_DSC_STAT_SCHALTER_BREMSLICHT_EIN                  I3_PID_DSC_DSC_BREMSLICHTSCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER_BREMSLICHT_EIN"
+
+// 0xDC1F I3_PID_DSC_BREMSFLUESSIGKEITSSCHALTER
+#define I3_FLD_DSC_STAT_BREMSFLUESSIGKEIT_NIVEAU_SCHALTER_EIN    I3_PID_DSC_BREMSFLUESSIGKEITSSCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BREMSFLUESSIGKEIT_NIVEAU_SCHALTER_EIN"
+
+// 0xDC3A I3_PID_DSC_STATUS_GBRPLUS
+#define I3_FLD_DSC_STAT_FAKTORU_EPS_WERT                         I3_PID_DSC_STATUS_GBRPLUS, 0, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_FAKTORU_EPS_WERT"
+#define I3_FLD_DSC_STAT_FAKTORARD_EPS_WERT                       I3_PID_DSC_STATUS_GBRPLUS, 1, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_FAKTORARD_EPS_WERT"
+#define I3_FLD_DSC_STAT_FAKTORARZ_EPS_WERT                       I3_PID_DSC_STATUS_GBRPLUS, 2, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_FAKTORARZ_EPS_WERT"
+#define I3_FLD_DSC_STAT_MMOTOR_OFFSET_EPS_WERT_0XDC3A            I3_PID_DSC_STATUS_GBRPLUS, 3, PID_FIELD_SINT8, 0.01f, 0.0f, "STAT_MMOTOR_OFFSET_EPS_WERT_0XDC3A"
+#define I3_FLD_DSC_STAT_FAKTOR_EPS_QUALIFIER_WERT                I3_PID_DSC_STATUS_GBRPLUS, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKTOR_EPS_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_OFFSET_EPS_QUALIFIER_WERT_0XDC3A         I3_PID_DSC_STATUS_GBRPLUS, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_OFFSET_EPS_QUALIFIER_WERT_0XDC3A"
+#define I3_FLD_DSC_STAT_FUNKTION_GBR_CODIERUNG_EIN               I3_PID_DSC_STATUS_GBRPLUS, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUNKTION_GBR_CODIERUNG_EIN"
+#define I3_FLD_DSC_STAT_FUNKTION_GBR_KENNLINIE_NUMMER_WERT_0XDC3A I3_PID_DSC_STATUS_GBRPLUS, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUNKTION_GBR_KENNLINIE_NUMMER_WERT_0XDC3A"
+#define I3_FLD_DSC_STAT_EPS_FAKT_MOM_SERVICE_QUALIFIER_WERT_0XDC3A I3_PID_DSC_STATUS_GBRPLUS, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EPS_FAKT_MOM_SERVICE_QUALIFIER_WERT_0XDC3A"
+#define I3_FLD_DSC_STAT_ZUSTAND_GRENZBEREICHSREUCKMELDUNG_WERT   I3_PID_DSC_STATUS_GBRPLUS, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZUSTAND_GRENZBEREICHSREUCKMELDUNG_WERT"
+
+// 0xDC42 I3_PID_DSC_STATUS_LLP
+#define I3_FLD_DSC_STAT_LLP_MANI_AKTIV                           I3_PID_DSC_STATUS_LLP, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_MANI_AKTIV"
+#define I3_FLD_DSC_STAT_LLP_MANI_WERT                            I3_PID_DSC_STATUS_LLP, 1, PID_FIELD_SINT8, 0.1f, 0.0f, "STAT_LLP_MANI_WERT"
+#define I3_FLD_DSC_STAT_LLP_CALC_WERT                            I3_PID_DSC_STATUS_LLP, 2, PID_FIELD_SINT8, 0.1f, 0.0f, "STAT_LLP_CALC_WERT"
+#define I3_FLD_DSC_STAT_LLP_PEL_IST_WERT                         I3_PID_DSC_STATUS_LLP, 3, PID_FIELD_SINT8, 0.1f, 0.0f, "STAT_LLP_PEL_IST_WERT"
+#define I3_FLD_DSC_STAT_LLP_FZS_WERT                             I3_PID_DSC_STATUS_LLP, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LLP_FZS_WERT"
+#define I3_FLD_DSC_STAT_LLP_RITZELWINKEL_WERT                    I3_PID_DSC_STATUS_LLP, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LLP_RITZELWINKEL_WERT"
+#define I3_FLD_DSC_STAT_LLP_ANTEIL_HUB_WERT                      I3_PID_DSC_STATUS_LLP, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LLP_ANTEIL_HUB_WERT"
+#define I3_FLD_DSC_STAT_LLP_V_ZS_WERT                            I3_PID_DSC_STATUS_LLP, 9, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_LLP_V_ZS_WERT"
+#define I3_FLD_DSC_STAT_LLP_FAHRERHANDMOMENT_WERT                I3_PID_DSC_STATUS_LLP, 11, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_LLP_FAHRERHANDMOMENT_WERT"
+#define I3_FLD_DSC_STAT_LLP_VX_ENTRY                             I3_PID_DSC_STATUS_LLP, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_VX_ENTRY"
+#define I3_FLD_DSC_STAT_LLP_AX_KORR                              I3_PID_DSC_STATUS_LLP, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_AX_KORR"
+#define I3_FLD_DSC_STAT_LLP_RETURN                               I3_PID_DSC_STATUS_LLP, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_RETURN"
+#define I3_FLD_DSC_STAT_LLP_STOP                                 I3_PID_DSC_STATUS_LLP, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_STOP"
+#define I3_FLD_DSC_STAT_LLP_EXTRAP_PEL                           I3_PID_DSC_STATUS_LLP, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_EXTRAP_PEL"
+#define I3_FLD_DSC_STAT_LLP_EXTRAP_FZS                           I3_PID_DSC_STATUS_LLP, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_EXTRAP_FZS"
+#define I3_FLD_DSC_STAT_LLP_FZSREDUC_BRAKE                       I3_PID_DSC_STATUS_LLP, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FZSREDUC_BRAKE"
+#define I3_FLD_DSC_STAT_LLP_PMA                                  I3_PID_DSC_STATUS_LLP, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_PMA"
+#define I3_FLD_DSC_STAT_LLP_PDC                                  I3_PID_DSC_STATUS_LLP, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_PDC"
+#define I3_FLD_DSC_STAT_LLP_TEMP_A                               I3_PID_DSC_STATUS_LLP, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_TEMP_A"
+#define I3_FLD_DSC_STAT_LLP_RAIN                                 I3_PID_DSC_STATUS_LLP, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_RAIN"
+#define I3_FLD_DSC_STAT_LLP_FLAG_AX                              I3_PID_DSC_STATUS_LLP, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_AX"
+#define I3_FLD_DSC_STAT_LLP_FLAG_STOP                            I3_PID_DSC_STATUS_LLP, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_STOP"
+#define I3_FLD_DSC_STAT_LLP_FLAG_RAIN                            I3_PID_DSC_STATUS_LLP, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_RAIN"
+#define I3_FLD_DSC_STAT_LLP_FLAG_PMA                             I3_PID_DSC_STATUS_LLP, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_PMA"
+#define I3_FLD_DSC_STAT_LLP_FLAG_PDC                             I3_PID_DSC_STATUS_LLP, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_PDC"
+#define I3_FLD_DSC_STAT_LLP_FLAG_RETURN                          I3_PID_DSC_STATUS_LLP, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_RETURN"
+#define I3_FLD_DSC_STAT_LLP_FLAG_TEMP_A                          I3_PID_DSC_STATUS_LLP, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_TEMP_A"
+#define I3_FLD_DSC_STAT_LLP_FLAG_EXTRAP_FZS                      I3_PID_DSC_STATUS_LLP, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_EXTRAP_FZS"
+#define I3_FLD_DSC_STAT_LLP_FLAG_EXTRAP_PEL                      I3_PID_DSC_STATUS_LLP, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_EXTRAP_PEL"
+#define I3_FLD_DSC_STAT_LLP_FLAG_FZSREDUC_BRAKE                  I3_PID_DSC_STATUS_LLP, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LLP_FLAG_FZSREDUC_BRAKE"
+
+// 0xDC6C I3_PID_DSC_ABS_FUNKTION
+#define I3_FLD_DSC_STAT_ABS_FUNKTION                             I3_PID_DSC_ABS_FUNKTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABS_FUNKTION"
+#define I3_FLD_DSC_STAT_ABS_FUNKTION_QUALIFIER_WERT              I3_PID_DSC_ABS_FUNKTION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABS_FUNKTION_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_ABS_FUNKTION_QUALIFIER_ERW_WERT          I3_PID_DSC_ABS_FUNKTION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ABS_FUNKTION_QUALIFIER_ERW_WERT"
+
+// 0xDC6D I3_PID_DSC_ASC_FUNKTION
+#define I3_FLD_DSC_STAT_ASC_FUNKTION                             I3_PID_DSC_ASC_FUNKTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ASC_FUNKTION"
+#define I3_FLD_DSC_STAT_ASC_FUNKTION_QUALIFIER_WERT              I3_PID_DSC_ASC_FUNKTION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ASC_FUNKTION_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_ASC_FUNKTION_QUALIFIER_ERW_WERT          I3_PID_DSC_ASC_FUNKTION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ASC_FUNKTION_QUALIFIER_ERW_WERT"
+
+// 0xDC6E I3_PID_DSC_FDR_FUNKTION
+#define I3_FLD_DSC_STAT_FDR_FUNKTION                             I3_PID_DSC_FDR_FUNKTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDR_FUNKTION"
+#define I3_FLD_DSC_STAT_FDR_FUNKTION_QUALIFIER_WERT              I3_PID_DSC_FDR_FUNKTION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDR_FUNKTION_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_FDR_FUNKTION_QUALIFIER_ERW_WERT          I3_PID_DSC_FDR_FUNKTION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDR_FUNKTION_QUALIFIER_ERW_WERT"
+
+// 0xDC6F I3_PID_DSC_PBRK_FUNKTION
+#define I3_FLD_DSC_STAT_PBRK_FUNKTION                            I3_PID_DSC_PBRK_FUNKTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PBRK_FUNKTION"
+#define I3_FLD_DSC_STAT_PBRK_FUNKTION_QUALIFIER_WERT             I3_PID_DSC_PBRK_FUNKTION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PBRK_FUNKTION_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_PBRK_FUNKTION_QUALIFIER_ERW_WERT         I3_PID_DSC_PBRK_FUNKTION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PBRK_FUNKTION_QUALIFIER_ERW_WERT"
+
+// 0xDC70 I3_PID_DSC_HDC_FUNKTION
+#define I3_FLD_DSC_STAT_HDC_FUNKTION                             I3_PID_DSC_HDC_FUNKTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HDC_FUNKTION"
+#define I3_FLD_DSC_STAT_HDC_FUNKTION_QUALIFIER_WERT              I3_PID_DSC_HDC_FUNKTION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HDC_FUNKTION_QUALIFIER_WERT"
+#define I3_FLD_DSC_STAT_HDC_FUNKTION_QUALIFIER_ERW_WERT          I3_PID_DSC_HDC_FUNKTION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HDC_FUNKTION_QUALIFIER_ERW_WERT"
+
+// 0xDC8F I3_PID_DSC_MIRROR_AAEPS
+
+// 0xDC90 I3_PID_DSC_MIRROR_EV
+
+// 0xDC91 I3_PID_DSC_MIRROR_SBS
+
+// 0xDC92 I3_PID_DSC_MIRROR_TSC
+
+// 0xDC93 I3_PID_DSC_MIRROR_ZFM
+
+// 0xDC94 I3_PID_DSC_STATUS_RDC_VERSION
+#define I3_FLD_DSC_STAT_RDC_VERSION_WERT                         I3_PID_DSC_STATUS_RDC_VERSION, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RDC_VERSION_WERT"
+
+// 0xDC95 I3_PID_DSC_STATUS_RDC_LESEN
+#define I3_FLD_DSC_STAT_EIGENRAEDER_BEKANNT                      I3_PID_DSC_STATUS_RDC_LESEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EIGENRAEDER_BEKANNT"
+#define I3_FLD_DSC_STAT_RADPOS_ER_BEKANNT                        I3_PID_DSC_STATUS_RDC_LESEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOS_ER_BEKANNT"
+#define I3_FLD_DSC_STAT_RADPOS_UEBERPRUEFT_BESTAETIGT            I3_PID_DSC_STATUS_RDC_LESEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOS_UEBERPRUEFT_BESTAETIGT"
+#define I3_FLD_DSC_STAT_DTC_INACTIVE                             I3_PID_DSC_STATUS_RDC_LESEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DTC_INACTIVE"
+#define I3_FLD_DSC_STAT_KAL_ANFORDERUNG_AKTIV                    I3_PID_DSC_STATUS_RDC_LESEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAL_ANFORDERUNG_AKTIV"
+#define I3_FLD_DSC_STAT_RAD_ZUORDNUNG_TIMEOUT                    I3_PID_DSC_STATUS_RDC_LESEN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RAD_ZUORDNUNG_TIMEOUT"
+#define I3_FLD_DSC_STAT_BANDMODE_AKTIV                           I3_PID_DSC_STATUS_RDC_LESEN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BANDMODE_AKTIV"
+#define I3_FLD_DSC_STAT_ER_ERKENNUNG_FAHRT                       I3_PID_DSC_STATUS_RDC_LESEN, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ER_ERKENNUNG_FAHRT"
+#define I3_FLD_DSC_STAT_TEST_EIGENRAD_FAHRT                      I3_PID_DSC_STATUS_RDC_LESEN, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEST_EIGENRAD_FAHRT"
+#define I3_FLD_DSC_STAT_TEST_EIGENRAD_STAND                      I3_PID_DSC_STATUS_RDC_LESEN, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEST_EIGENRAD_STAND"
+#define I3_FLD_DSC_STAT_ER_FAHRT_VTHRS_AKTIV                     I3_PID_DSC_STATUS_RDC_LESEN, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ER_FAHRT_VTHRS_AKTIV"
+#define I3_FLD_DSC_STAT_BM_TIMEOUT_ACTIVE                        I3_PID_DSC_STATUS_RDC_LESEN, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BM_TIMEOUT_ACTIVE"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_UNSPEZIFISCH_AKTIV         I3_PID_DSC_STATUS_RDC_LESEN, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_UNSPEZIFISCH_AKTIV"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_VL_AKTIV                   I3_PID_DSC_STATUS_RDC_LESEN, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_VL_AKTIV"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_VR_AKTIV                   I3_PID_DSC_STATUS_RDC_LESEN, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_VR_AKTIV"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_HL_AKTIV                   I3_PID_DSC_STATUS_RDC_LESEN, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_HL_AKTIV"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_HR_AKTIV                   I3_PID_DSC_STATUS_RDC_LESEN, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_HR_AKTIV"
+#define I3_FLD_DSC_STAT_KL_15_EIN                                I3_PID_DSC_STATUS_RDC_LESEN, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL_15_EIN"
+#define I3_FLD_DSC_STAT_MOTOR_LAEUFT_EIN                         I3_PID_DSC_STATUS_RDC_LESEN, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_LAEUFT_EIN"
+#define I3_FLD_DSC_STAT_FZG_FAEHRT                               I3_PID_DSC_STATUS_RDC_LESEN, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZG_FAEHRT"
+#define I3_FLD_DSC_STAT_ERKENNUNG_ALLE_RE                        I3_PID_DSC_STATUS_RDC_LESEN, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ERKENNUNG_ALLE_RE"
+#define I3_FLD_DSC_STAT_ERKENNUNG_ZUVIELE_RE                     I3_PID_DSC_STATUS_RDC_LESEN, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ERKENNUNG_ZUVIELE_RE"
+#define I3_FLD_DSC_STAT_STOERSENDER                              I3_PID_DSC_STATUS_RDC_LESEN, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STOERSENDER"
+#define I3_FLD_DSC_STAT_FREQUENZ_WERT                            I3_PID_DSC_STATUS_RDC_LESEN, 23, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FREQUENZ_WERT"
+
+// 0xDC96 I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS
+#define I3_FLD_DSC_STAT_1_KILOMETERSTAND_WERT                    I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_1_KILOMETERSTAND_WERT"
+#define I3_FLD_DSC_STAT_1_SYSTEMFLAGS_WERT                       I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_1_SYSTEMFLAGS_WERT"
+#define I3_FLD_DSC_STAT_1_INTERNER_FEHLERCODE_WERT               I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_1_INTERNER_FEHLERCODE_WERT"
+#define I3_FLD_DSC_STAT_1_ZAEHLER_INAKTIV                        I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_ZAEHLER_INAKTIV"
+#define I3_FLD_DSC_STAT_2_KILOMETERSTAND_WERT                    I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 47, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_2_KILOMETERSTAND_WERT"
+#define I3_FLD_DSC_STAT_2_SYSTEMFLAGS_WERT                       I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 51, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_2_SYSTEMFLAGS_WERT"
+#define I3_FLD_DSC_STAT_2_INTERNER_FEHLERCODE_WERT               I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 55, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_2_INTERNER_FEHLERCODE_WERT"
+#define I3_FLD_DSC_STAT_2_ZAEHLER_INAKTIV                        I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_ZAEHLER_INAKTIV"
+#define I3_FLD_DSC_STAT_3_KILOMETERSTAND_WERT                    I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 76, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_3_KILOMETERSTAND_WERT"
+#define I3_FLD_DSC_STAT_3_SYSTEMFLAGS_WERT                       I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 80, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_3_SYSTEMFLAGS_WERT"
+#define I3_FLD_DSC_STAT_3_INTERNER_FEHLERCODE_WERT               I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 84, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_3_INTERNER_FEHLERCODE_WERT"
+#define I3_FLD_DSC_STAT_3_ZAEHLER_INAKTIV                        I3_PID_DSC_RDC_HS_INAKTIVEREIGNIS, 86, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_ZAEHLER_INAKTIV"
+
+// 0xDC97 I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS
+#define I3_FLD_DSC_STAT_1_PLAUSI_DRUCK                           I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_PLAUSI_DRUCK"
+#define I3_FLD_DSC_STAT_1_KALIBRIERUNG                           I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_KALIBRIERUNG"
+#define I3_FLD_DSC_STAT_1_KILOMETERSTAND_WERT_0XDC97             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 20, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_1_KILOMETERSTAND_WERT_0XDC97"
+#define I3_FLD_DSC_STAT_1_SYSTEMFLAGS_WERT_0XDC97                I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_1_SYSTEMFLAGS_WERT_0XDC97"
+#define I3_FLD_DSC_STAT_1_BEFUELL_AUSSENTEMPERATUR_WERT          I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 28, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_1_BEFUELL_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_DSC_STAT_1_BEFUELL_AUSSENDRUCK_WERT               I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 29, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_1_BEFUELL_AUSSENDRUCK_WERT"
+#define I3_FLD_DSC_STAT_1_RADPOSITION_RE0                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_RADPOSITION_RE0"
+#define I3_FLD_DSC_STAT_1_BEFUELLDRUCK_RE0_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 32, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE0_WERT"
+#define I3_FLD_DSC_STAT_1_BEFUELLTEMPERATUR_RE0_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 34, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE0_WERT"
+#define I3_FLD_DSC_STAT_1_RADPOSITION_RE1                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_RADPOSITION_RE1"
+#define I3_FLD_DSC_STAT_1_BEFUELLDRUCK_RE1_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 36, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE1_WERT"
+#define I3_FLD_DSC_STAT_1_BEFUELLTEMPERATUR_RE1_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 38, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE1_WERT"
+#define I3_FLD_DSC_STAT_1_RADPOSITION_RE2                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_RADPOSITION_RE2"
+#define I3_FLD_DSC_STAT_1_BEFUELLDRUCK_RE2_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 40, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE2_WERT"
+#define I3_FLD_DSC_STAT_1_BEFUELLTEMPERATUR_RE2_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 42, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE2_WERT"
+#define I3_FLD_DSC_STAT_1_RADPOSITION_RE3                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_RADPOSITION_RE3"
+#define I3_FLD_DSC_STAT_1_BEFUELLDRUCK_RE3_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 44, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_1_BEFUELLDRUCK_RE3_WERT"
+#define I3_FLD_DSC_STAT_1_BEFUELLTEMPERATUR_RE3_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 46, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_1_BEFUELLTEMPERATUR_RE3_WERT"
+#define I3_FLD_DSC_STAT_1_ZAEHLER_KALIBRIERUNG                   I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_1_ZAEHLER_KALIBRIERUNG"
+#define I3_FLD_DSC_STAT_2_PLAUSI_DRUCK                           I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_PLAUSI_DRUCK"
+#define I3_FLD_DSC_STAT_2_KALIBRIERUNG                           I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_KALIBRIERUNG"
+#define I3_FLD_DSC_STAT_2_KILOMETERSTAND_WERT_0XDC97             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 68, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_2_KILOMETERSTAND_WERT_0XDC97"
+#define I3_FLD_DSC_STAT_2_SYSTEMFLAGS_WERT_0XDC97                I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 72, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_2_SYSTEMFLAGS_WERT_0XDC97"
+#define I3_FLD_DSC_STAT_2_BEFUELL_AUSSENTEMPERATUR_WERT          I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 76, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_2_BEFUELL_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_DSC_STAT_2_BEFUELL_AUSSENDRUCK_WERT               I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 77, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_2_BEFUELL_AUSSENDRUCK_WERT"
+#define I3_FLD_DSC_STAT_2_RADPOSITION_RE0                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_RADPOSITION_RE0"
+#define I3_FLD_DSC_STAT_2_BEFUELLDRUCK_RE0_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 80, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE0_WERT"
+#define I3_FLD_DSC_STAT_2_BEFUELLTEMPERATUR_RE0_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 82, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE0_WERT"
+#define I3_FLD_DSC_STAT_2_RADPOSITION_RE1                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_RADPOSITION_RE1"
+#define I3_FLD_DSC_STAT_2_BEFUELLDRUCK_RE1_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 84, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE1_WERT"
+#define I3_FLD_DSC_STAT_2_BEFUELLTEMPERATUR_RE1_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 86, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE1_WERT"
+#define I3_FLD_DSC_STAT_2_RADPOSITION_RE2                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 87, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_RADPOSITION_RE2"
+#define I3_FLD_DSC_STAT_2_BEFUELLDRUCK_RE2_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 88, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE2_WERT"
+#define I3_FLD_DSC_STAT_2_BEFUELLTEMPERATUR_RE2_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 90, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE2_WERT"
+#define I3_FLD_DSC_STAT_2_RADPOSITION_RE3                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 91, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_RADPOSITION_RE3"
+#define I3_FLD_DSC_STAT_2_BEFUELLDRUCK_RE3_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 92, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_2_BEFUELLDRUCK_RE3_WERT"
+#define I3_FLD_DSC_STAT_2_BEFUELLTEMPERATUR_RE3_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 94, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_2_BEFUELLTEMPERATUR_RE3_WERT"
+#define I3_FLD_DSC_STAT_2_ZAEHLER_KALIBRIERUNG                   I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 95, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_2_ZAEHLER_KALIBRIERUNG"
+#define I3_FLD_DSC_STAT_3_PLAUSI_DRUCK                           I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 96, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_PLAUSI_DRUCK"
+#define I3_FLD_DSC_STAT_3_KALIBRIERUNG                           I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 97, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_KALIBRIERUNG"
+#define I3_FLD_DSC_STAT_3_KILOMETERSTAND_WERT_0XDC97             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 116, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_3_KILOMETERSTAND_WERT_0XDC97"
+#define I3_FLD_DSC_STAT_3_SYSTEMFLAGS_WERT_0XDC97                I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 120, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_3_SYSTEMFLAGS_WERT_0XDC97"
+#define I3_FLD_DSC_STAT_3_BEFUELL_AUSSENTEMPERATUR_WERT          I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 124, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_3_BEFUELL_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_DSC_STAT_3_BEFUELL_AUSSENDRUCK_WERT               I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 125, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_3_BEFUELL_AUSSENDRUCK_WERT"
+#define I3_FLD_DSC_STAT_3_RADPOSITION_RE0                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 127, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_RADPOSITION_RE0"
+#define I3_FLD_DSC_STAT_3_BEFUELLDRUCK_RE0_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 128, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE0_WERT"
+#define I3_FLD_DSC_STAT_3_BEFUELLTEMPERATUR_RE0_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 130, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE0_WERT"
+#define I3_FLD_DSC_STAT_3_RADPOSITION_RE1                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 131, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_RADPOSITION_RE1"
+#define I3_FLD_DSC_STAT_3_BEFUELLDRUCK_RE1_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 132, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE1_WERT"
+#define I3_FLD_DSC_STAT_3_BEFUELLTEMPERATUR_RE1_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 134, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE1_WERT"
+#define I3_FLD_DSC_STAT_3_RADPOSITION_RE2                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 135, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_RADPOSITION_RE2"
+#define I3_FLD_DSC_STAT_3_BEFUELLDRUCK_RE2_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 136, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE2_WERT"
+#define I3_FLD_DSC_STAT_3_BEFUELLTEMPERATUR_RE2_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 138, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE2_WERT"
+#define I3_FLD_DSC_STAT_3_RADPOSITION_RE3                        I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 139, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_RADPOSITION_RE3"
+#define I3_FLD_DSC_STAT_3_BEFUELLDRUCK_RE3_WERT                  I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 140, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_3_BEFUELLDRUCK_RE3_WERT"
+#define I3_FLD_DSC_STAT_3_BEFUELLTEMPERATUR_RE3_WERT             I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 142, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_3_BEFUELLTEMPERATUR_RE3_WERT"
+#define I3_FLD_DSC_STAT_3_ZAEHLER_KALIBRIERUNG                   I3_PID_DSC_RDC_HS_KALIBRIEREREIGNIS, 143, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_3_ZAEHLER_KALIBRIERUNG"
+
+// 0xDC98 I3_PID_DSC_RDC_MESSDATENBLOCK_1
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER                            I3_PID_DSC_RDC_MESSDATENBLOCK_1, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER"
+#define I3_FLD_DSC_STAT_RAD_POSITION_NR                          I3_PID_DSC_RDC_MESSDATENBLOCK_1, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RAD_POSITION_NR"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENDRUCKWERT_WERT             I3_PID_DSC_RDC_MESSDATENBLOCK_1, 5, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENTEMPERATURWERT_WERT        I3_PID_DSC_RDC_MESSDATENBLOCK_1, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT"
+#define I3_FLD_DSC_STAT_SOLLDRUCK_WERT                           I3_PID_DSC_RDC_MESSDATENBLOCK_1, 8, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT"
+#define I3_FLD_DSC_STAT_GUTEMPFAENGE                             I3_PID_DSC_RDC_MESSDATENBLOCK_1, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GUTEMPFAENGE"
+#define I3_FLD_DSC_STAT_AUSBEUTE                                 I3_PID_DSC_RDC_MESSDATENBLOCK_1, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUSBEUTE"
+#define I3_FLD_DSC_STAT_RSSI_PEGEL                               I3_PID_DSC_RDC_MESSDATENBLOCK_1, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RSSI_PEGEL"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER                          I3_PID_DSC_RDC_MESSDATENBLOCK_1, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS                     I3_PID_DSC_RDC_MESSDATENBLOCK_1, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_AKTIV                      I3_PID_DSC_RDC_MESSDATENBLOCK_1, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV"
+#define I3_FLD_DSC_STAT_POS_CHANGED                              I3_PID_DSC_RDC_MESSDATENBLOCK_1, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POS_CHANGED"
+#define I3_FLD_DSC_STAT_RE_OVERHEAT_AKTIV                        I3_PID_DSC_RDC_MESSDATENBLOCK_1, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG                             I3_PID_DSC_RDC_MESSDATENBLOCK_1, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG"
+#define I3_FLD_DSC_STAT_FOLGEAUSFALL                             I3_PID_DSC_RDC_MESSDATENBLOCK_1, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FOLGEAUSFALL"
+#define I3_FLD_DSC_STAT_RE_HERSTELLER                            I3_PID_DSC_RDC_MESSDATENBLOCK_1, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_HERSTELLER"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_SENDEMODE                  I3_PID_DSC_RDC_MESSDATENBLOCK_1, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_FEHLER_WERT                I3_PID_DSC_RDC_MESSDATENBLOCK_1, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT"
+#define I3_FLD_DSC_STAT_ROLLSWITCH                               I3_PID_DSC_RDC_MESSDATENBLOCK_1, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROLLSWITCH"
+#define I3_FLD_DSC_STAT_TELEGRAMMTYP                             I3_PID_DSC_RDC_MESSDATENBLOCK_1, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TELEGRAMMTYP"
+
+// 0xDC99 I3_PID_DSC_RDC_MESSDATENBLOCK_2
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_0XDC99                     I3_PID_DSC_RDC_MESSDATENBLOCK_2, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_0XDC99"
+#define I3_FLD_DSC_STAT_RAD_POSITION_NR_0XDC99                   I3_PID_DSC_RDC_MESSDATENBLOCK_2, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RAD_POSITION_NR_0XDC99"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC99      I3_PID_DSC_RDC_MESSDATENBLOCK_2, 5, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC99"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC99 I3_PID_DSC_RDC_MESSDATENBLOCK_2, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC99"
+#define I3_FLD_DSC_STAT_SOLLDRUCK_WERT_0XDC99                    I3_PID_DSC_RDC_MESSDATENBLOCK_2, 8, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT_0XDC99"
+#define I3_FLD_DSC_STAT_GUTEMPFAENGE_0XDC99                      I3_PID_DSC_RDC_MESSDATENBLOCK_2, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GUTEMPFAENGE_0XDC99"
+#define I3_FLD_DSC_STAT_AUSBEUTE_0XDC99                          I3_PID_DSC_RDC_MESSDATENBLOCK_2, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUSBEUTE_0XDC99"
+#define I3_FLD_DSC_STAT_RSSI_PEGEL_0XDC99                        I3_PID_DSC_RDC_MESSDATENBLOCK_2, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RSSI_PEGEL_0XDC99"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_0XDC99                   I3_PID_DSC_RDC_MESSDATENBLOCK_2, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_0XDC99"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_0XDC99              I3_PID_DSC_RDC_MESSDATENBLOCK_2, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_0XDC99"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_AKTIV_0XDC99               I3_PID_DSC_RDC_MESSDATENBLOCK_2, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV_0XDC99"
+#define I3_FLD_DSC_STAT_POS_CHANGED_0XDC99                       I3_PID_DSC_RDC_MESSDATENBLOCK_2, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POS_CHANGED_0XDC99"
+#define I3_FLD_DSC_STAT_RE_OVERHEAT_AKTIV_0XDC99                 I3_PID_DSC_RDC_MESSDATENBLOCK_2, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV_0XDC99"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_0XDC99                      I3_PID_DSC_RDC_MESSDATENBLOCK_2, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_0XDC99"
+#define I3_FLD_DSC_STAT_FOLGEAUSFALL_0XDC99                      I3_PID_DSC_RDC_MESSDATENBLOCK_2, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FOLGEAUSFALL_0XDC99"
+#define I3_FLD_DSC_STAT_RE_HERSTELLER_0XDC99                     I3_PID_DSC_RDC_MESSDATENBLOCK_2, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_HERSTELLER_0XDC99"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_SENDEMODE_0XDC99           I3_PID_DSC_RDC_MESSDATENBLOCK_2, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE_0XDC99"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_FEHLER_WERT_0XDC99         I3_PID_DSC_RDC_MESSDATENBLOCK_2, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT_0XDC99"
+#define I3_FLD_DSC_STAT_ROLLSWITCH_0XDC99                        I3_PID_DSC_RDC_MESSDATENBLOCK_2, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROLLSWITCH_0XDC99"
+#define I3_FLD_DSC_STAT_TELEGRAMMTYP_0XDC99                      I3_PID_DSC_RDC_MESSDATENBLOCK_2, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TELEGRAMMTYP_0XDC99"
+
+// 0xDC9A I3_PID_DSC_RDC_MESSDATENBLOCK_3
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_0XDC9A                     I3_PID_DSC_RDC_MESSDATENBLOCK_3, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_0XDC9A"
+#define I3_FLD_DSC_STAT_RAD_POSITION_NR_0XDC9A                   I3_PID_DSC_RDC_MESSDATENBLOCK_3, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RAD_POSITION_NR_0XDC9A"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC9A      I3_PID_DSC_RDC_MESSDATENBLOCK_3, 5, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC9A"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC9A I3_PID_DSC_RDC_MESSDATENBLOCK_3, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC9A"
+#define I3_FLD_DSC_STAT_SOLLDRUCK_WERT_0XDC9A                    I3_PID_DSC_RDC_MESSDATENBLOCK_3, 8, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT_0XDC9A"
+#define I3_FLD_DSC_STAT_GUTEMPFAENGE_0XDC9A                      I3_PID_DSC_RDC_MESSDATENBLOCK_3, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GUTEMPFAENGE_0XDC9A"
+#define I3_FLD_DSC_STAT_AUSBEUTE_0XDC9A                          I3_PID_DSC_RDC_MESSDATENBLOCK_3, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUSBEUTE_0XDC9A"
+#define I3_FLD_DSC_STAT_RSSI_PEGEL_0XDC9A                        I3_PID_DSC_RDC_MESSDATENBLOCK_3, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RSSI_PEGEL_0XDC9A"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_0XDC9A                   I3_PID_DSC_RDC_MESSDATENBLOCK_3, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_0XDC9A"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_0XDC9A              I3_PID_DSC_RDC_MESSDATENBLOCK_3, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_0XDC9A"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_AKTIV_0XDC9A               I3_PID_DSC_RDC_MESSDATENBLOCK_3, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV_0XDC9A"
+#define I3_FLD_DSC_STAT_POS_CHANGED_0XDC9A                       I3_PID_DSC_RDC_MESSDATENBLOCK_3, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POS_CHANGED_0XDC9A"
+#define I3_FLD_DSC_STAT_RE_OVERHEAT_AKTIV_0XDC9A                 I3_PID_DSC_RDC_MESSDATENBLOCK_3, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV_0XDC9A"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_0XDC9A                      I3_PID_DSC_RDC_MESSDATENBLOCK_3, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_0XDC9A"
+#define I3_FLD_DSC_STAT_FOLGEAUSFALL_0XDC9A                      I3_PID_DSC_RDC_MESSDATENBLOCK_3, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FOLGEAUSFALL_0XDC9A"
+#define I3_FLD_DSC_STAT_RE_HERSTELLER_0XDC9A                     I3_PID_DSC_RDC_MESSDATENBLOCK_3, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_HERSTELLER_0XDC9A"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_SENDEMODE_0XDC9A           I3_PID_DSC_RDC_MESSDATENBLOCK_3, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE_0XDC9A"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_FEHLER_WERT_0XDC9A         I3_PID_DSC_RDC_MESSDATENBLOCK_3, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT_0XDC9A"
+#define I3_FLD_DSC_STAT_ROLLSWITCH_0XDC9A                        I3_PID_DSC_RDC_MESSDATENBLOCK_3, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROLLSWITCH_0XDC9A"
+#define I3_FLD_DSC_STAT_TELEGRAMMTYP_0XDC9A                      I3_PID_DSC_RDC_MESSDATENBLOCK_3, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TELEGRAMMTYP_0XDC9A"
+
+// 0xDC9B I3_PID_DSC_RDC_MESSDATENBLOCK_4
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_0XDC9B                     I3_PID_DSC_RDC_MESSDATENBLOCK_4, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_0XDC9B"
+#define I3_FLD_DSC_STAT_RAD_POSITION_NR_0XDC9B                   I3_PID_DSC_RDC_MESSDATENBLOCK_4, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RAD_POSITION_NR_0XDC9B"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC9B      I3_PID_DSC_RDC_MESSDATENBLOCK_4, 5, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_LETZTER_REIFENDRUCKWERT_WERT_0XDC9B"
+#define I3_FLD_DSC_STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC9B I3_PID_DSC_RDC_MESSDATENBLOCK_4, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LETZTER_REIFENTEMPERATURWERT_WERT_0XDC9B"
+#define I3_FLD_DSC_STAT_SOLLDRUCK_WERT_0XDC9B                    I3_PID_DSC_RDC_MESSDATENBLOCK_4, 8, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_SOLLDRUCK_WERT_0XDC9B"
+#define I3_FLD_DSC_STAT_GUTEMPFAENGE_0XDC9B                      I3_PID_DSC_RDC_MESSDATENBLOCK_4, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GUTEMPFAENGE_0XDC9B"
+#define I3_FLD_DSC_STAT_AUSBEUTE_0XDC9B                          I3_PID_DSC_RDC_MESSDATENBLOCK_4, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUSBEUTE_0XDC9B"
+#define I3_FLD_DSC_STAT_RSSI_PEGEL_0XDC9B                        I3_PID_DSC_RDC_MESSDATENBLOCK_4, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RSSI_PEGEL_0XDC9B"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_0XDC9B                   I3_PID_DSC_RDC_MESSDATENBLOCK_4, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_0XDC9B"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_0XDC9B              I3_PID_DSC_RDC_MESSDATENBLOCK_4, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_0XDC9B"
+#define I3_FLD_DSC_STAT_HARTE_WARNUNG_AKTIV_0XDC9B               I3_PID_DSC_RDC_MESSDATENBLOCK_4, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HARTE_WARNUNG_AKTIV_0XDC9B"
+#define I3_FLD_DSC_STAT_POS_CHANGED_0XDC9B                       I3_PID_DSC_RDC_MESSDATENBLOCK_4, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POS_CHANGED_0XDC9B"
+#define I3_FLD_DSC_STAT_RE_OVERHEAT_AKTIV_0XDC9B                 I3_PID_DSC_RDC_MESSDATENBLOCK_4, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_OVERHEAT_AKTIV_0XDC9B"
+#define I3_FLD_DSC_STAT_DREHRICHTUNG_0XDC9B                      I3_PID_DSC_RDC_MESSDATENBLOCK_4, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DREHRICHTUNG_0XDC9B"
+#define I3_FLD_DSC_STAT_FOLGEAUSFALL_0XDC9B                      I3_PID_DSC_RDC_MESSDATENBLOCK_4, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FOLGEAUSFALL_0XDC9B"
+#define I3_FLD_DSC_STAT_RE_HERSTELLER_0XDC9B                     I3_PID_DSC_RDC_MESSDATENBLOCK_4, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RE_HERSTELLER_0XDC9B"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_SENDEMODE_0XDC9B           I3_PID_DSC_RDC_MESSDATENBLOCK_4, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_SENDEMODE_0XDC9B"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_FEHLER_WERT_0XDC9B         I3_PID_DSC_RDC_MESSDATENBLOCK_4, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RADELEKTRONIK_FEHLER_WERT_0XDC9B"
+#define I3_FLD_DSC_STAT_ROLLSWITCH_0XDC9B                        I3_PID_DSC_RDC_MESSDATENBLOCK_4, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROLLSWITCH_0XDC9B"
+#define I3_FLD_DSC_STAT_TELEGRAMMTYP_0XDC9B                      I3_PID_DSC_RDC_MESSDATENBLOCK_4, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TELEGRAMMTYP_0XDC9B"
+
+// 0xDC9C I3_PID_DSC_RDC_HS_WARNEREIGNIS_1
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT                      I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT                         I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT            I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT                 I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT                         I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT      I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0                           I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT               I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT                     I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT                I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1                           I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT               I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT                     I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT                I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2                           I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT               I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT                     I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT                I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3                           I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT               I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT                     I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT                I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARNEREIGNIS_WERT                I3_PID_DSC_RDC_HS_WARNEREIGNIS_1, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT"
+
+// 0xDC9D I3_PID_DSC_RDC_HS_WARNEREIGNIS_2
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT_0XDC9D               I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT_0XDC9D                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9D     I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9D          I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT_0XDC9D             I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT_0XDC9D                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9D I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD_0XDC9D             I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDC9D"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0_0XDC9D                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT_0XDC9D             I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9D        I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDC9D              I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9D         I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1_0XDC9D                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT_0XDC9D             I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9D        I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDC9D              I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9D         I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2_0XDC9D                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT_0XDC9D             I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9D        I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDC9D              I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9D         I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3_0XDC9D                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT_0XDC9D             I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9D        I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDC9D              I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9D         I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9D"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDC9D         I3_PID_DSC_RDC_HS_WARNEREIGNIS_2, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDC9D"
+
+// 0xDC9E I3_PID_DSC_RDC_HS_WARNEREIGNIS_3
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT_0XDC9E               I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT_0XDC9E                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9E     I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9E          I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT_0XDC9E             I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT_0XDC9E                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9E I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD_0XDC9E             I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDC9E"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0_0XDC9E                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT_0XDC9E             I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9E        I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDC9E              I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9E         I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1_0XDC9E                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT_0XDC9E             I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9E        I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDC9E              I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9E         I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2_0XDC9E                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT_0XDC9E             I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9E        I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDC9E              I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9E         I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3_0XDC9E                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT_0XDC9E             I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9E        I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDC9E              I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9E         I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9E"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDC9E         I3_PID_DSC_RDC_HS_WARNEREIGNIS_3, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDC9E"
+
+// 0xDC9F I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT_0XDC9F               I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT_0XDC9F                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9F     I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9F          I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT_0XDC9F             I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT_0XDC9F                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9F I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD_0XDC9F             I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDC9F"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0_0XDC9F                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT_0XDC9F             I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9F        I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDC9F              I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9F         I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1_0XDC9F                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT_0XDC9F             I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9F        I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDC9F              I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9F         I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2_0XDC9F                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT_0XDC9F             I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9F        I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDC9F              I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9F         I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3_0XDC9F                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT_0XDC9F             I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9F        I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDC9F              I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9F         I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDC9F"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARN_RUECKNAHME                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_RUECKNAHME, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARN_RUECKNAHME"
+
+// 0xDCD9 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE0_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE0_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDCD9              I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 4, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCD9"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE0_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE0_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE0_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE0_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE1_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE1_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDCD9              I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 13, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCD9"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE1_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 15, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE1_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE1_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE1_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE2_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE2_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDCD9              I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 22, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCD9"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE2_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 24, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE2_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE2_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE2_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE3_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 27, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE3_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDCD9              I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 31, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCD9"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE3_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 33, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE3_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE3_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE3_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE4_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE4_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE4_WERT                     I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 40, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE4_WERT"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE4_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 42, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE4_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE4_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE4_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE5_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 45, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE5_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE5_WERT                     I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE5_WERT"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE5_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 51, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE5_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE5_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE5_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE6_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 54, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE6_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE6_WERT                     I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 58, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE6_WERT"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE6_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 60, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE6_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE6_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE6_WERT"
+#define I3_FLD_DSC_STAT_RE_IDENTIFIER_RE7_WERT                   I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 63, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RE_IDENTIFIER_RE7_WERT"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE7_WERT                     I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 67, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE7_WERT"
+#define I3_FLD_DSC_STAT_RESTLEBENSDAUER_RE7_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 69, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RESTLEBENSDAUER_RE7_WERT"
+#define I3_FLD_DSC_STAT_EMPFANGSZAEHLER_RE7_WERT                 I3_PID_DSC_STATUS_RE_LESEN_DRUCKCODIERUNG, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EMPFANGSZAEHLER_RE7_WERT"
+
+// 0xDCF1 I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT_0XDCF1               I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT_0XDCF1                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF1     I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF1          I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT_0XDCF1             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT_0XDCF1                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF1 I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD_0XDCF1             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDCF1"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0_0XDCF1                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT_0XDCF1             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF1        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDCF1              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF1         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1_0XDCF1                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT_0XDCF1             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF1        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDCF1              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF1         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2_0XDCF1                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT_0XDCF1             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF1        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDCF1              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF1         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3_0XDCF1                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT_0XDCF1             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF1        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDCF1              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF1         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF1"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF1         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_1, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF1"
+
+// 0xDCF2 I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT_0XDCF2               I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT_0XDCF2                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF2     I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF2          I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT_0XDCF2             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT_0XDCF2                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF2 I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD_0XDCF2             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDCF2"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0_0XDCF2                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT_0XDCF2             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF2        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDCF2              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF2         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1_0XDCF2                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT_0XDCF2             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF2        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDCF2              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF2         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2_0XDCF2                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT_0XDCF2             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF2        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDCF2              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF2         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3_0XDCF2                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT_0XDCF2             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF2        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDCF2              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF2         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF2"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF2         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_2, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF2"
+
+// 0xDCF3 I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3
+#define I3_FLD_DSC_STAT_KILOMETERSTAND_WERT_0XDCF3               I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 18, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_KILOMETERSTAND_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_SYSTEMFLAGS_WERT_0XDCF3                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMFLAGS_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF3     I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELL_AUSSENTEMPERATUR_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF3          I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 27, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELL_AUSSENDRUCK_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_AUSSENTEMPERATUR_WERT_0XDCF3             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AUSSENTEMPERATUR_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_AUSSENDRUCK_WERT_0XDCF3                  I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 30, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_AUSSENDRUCK_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF3 I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADELEKTRONIK_STATUS_PANNENRAD_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_RADPOSITION_PANNENRAD_0XDCF3             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITION_PANNENRAD_0XDCF3"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE0_0XDCF3                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE0_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE0_WERT_0XDCF3             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 35, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE0_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF3        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 37, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE0_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE0_WERT_0XDCF3              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 38, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE0_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF3         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 40, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE0_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE1_0XDCF3                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE1_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE1_WERT_0XDCF3             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 42, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE1_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF3        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 44, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE1_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE1_WERT_0XDCF3              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 45, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE1_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF3         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 47, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE1_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE2_0XDCF3                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE2_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE2_WERT_0XDCF3             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 49, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE2_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF3        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 51, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE2_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE2_WERT_0XDCF3              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 52, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE2_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF3         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 54, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE2_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_RADPOSITON_RE3_0XDCF3                    I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RADPOSITON_RE3_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLDRUCK_RE3_WERT_0XDCF3             I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 56, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_BEFUELLDRUCK_RE3_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF3        I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 58, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BEFUELLTEMPERATUR_RE3_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENDRUCK_RE3_WERT_0XDCF3              I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 59, PID_FIELD_SINT16, 0.001f, 0.0f, "STAT_REIFENDRUCK_RE3_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF3         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_REIFENTEMPERATUR_RE3_WERT_0XDCF3"
+#define I3_FLD_DSC_STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF3         I3_PID_DSC_RDC_HS_WARNEREIGNIS_WEICH_3, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_WARNEREIGNIS_WERT_0XDCF3"
+
+// 0xDD1B I3_PID_DSC_STATUS_AUTO_EPB_ZAEHLER
+#define I3_FLD_DSC_STAT_AUTO_EPB_ZAEHLER_WERT                    I3_PID_DSC_STATUS_AUTO_EPB_ZAEHLER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AUTO_EPB_ZAEHLER_WERT"
+
+// 0xE354 I3_PID_DSC_EXTERNE_ANFORDERUNG_EPB_ZAEHLER_LESEN
+#define I3_FLD_DSC_STAT_ZAEHLERSTAND_EPB_AKTIVIERUNG_WERT        I3_PID_DSC_EXTERNE_ANFORDERUNG_EPB_ZAEHLER_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLERSTAND_EPB_AKTIVIERUNG_WERT"
+
+// 0x4000 I3_PID_DSC__SW_IDENTIFIKATION
+
+// 0x5002 I3_PID_DSC_FAHRZEUGZUSTAND
+#define I3_FLD_DSC_STAT_FAHRZEUGZUSTAND_WERT                     I3_PID_DSC_FAHRZEUGZUSTAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAHRZEUGZUSTAND_WERT"
+
+// 0x5004 I3_PID_DSC_ANTRIEBSZUSTAND
+#define I3_FLD_DSC_STAT_ANTRIEBSZUSTAND_WERT                     I3_PID_DSC_ANTRIEBSZUSTAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANTRIEBSZUSTAND_WERT"
+
+// 0x5008 I3_PID_DSC_SPANNUNGSMASTER_VERFUEGBAR
+#define I3_FLD_DSC_STAT_SPANNUNGSMASTER_VERFUEGBAR_WERT          I3_PID_DSC_SPANNUNGSMASTER_VERFUEGBAR, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SPANNUNGSMASTER_VERFUEGBAR_WERT"
+
+// 0x500B I3_PID_DSC_FUNKTIONSZUSTAND
+#define I3_FLD_DSC_STAT_FUNKTIONSZUSTAND_WERT                    I3_PID_DSC_FUNKTIONSZUSTAND, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FUNKTIONSZUSTAND_WERT"
+
+// 0x500C I3_PID_DSC_INTERNER_FUNKTIONSZUSTAND
+#define I3_FLD_DSC_STAT_INTERNER_FUNKTIONSZUSTAND_WERT           I3_PID_DSC_INTERNER_FUNKTIONSZUSTAND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INTERNER_FUNKTIONSZUSTAND_WERT"
+
+// 0x500F I3_PID_DSC_FEHLERSPEICHERSPERRE_AKTIV
+#define I3_FLD_DSC_STAT_FEHLERSPEICHERSPERRE_AKTIV               I3_PID_DSC_FEHLERSPEICHERSPERRE_AKTIV, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLERSPEICHERSPERRE_AKTIV"
+
+// 0x5010 I3_PID_DSC_NETZWERK_ROHDATEN
+#define I3_FLD_DSC_STAT_ROHDATEN_WERT                            I3_PID_DSC_NETZWERK_ROHDATEN, 0, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_ROHDATEN_WERT"
@@ -8,16 +8,19 @@
     #define I3_RES_EDM_STAT_T_BATT_WERT                               (RXBUF_SINT(0)/10)
     #define I3_RES_EDM_STAT_T_BATT_WERT_UNIT                          '°C'
     #define I3_RES_EDM_STAT_T_BATT_WERT_TYPE                          float
+    #define I3_FLD_EDM_STAT_T_BATT_WERT                               I3_PID_EDM_STATUS_MESSWERTE_IBS, 0, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_T_BATT_WERT"
         // Temp
 
     #define I3_RES_EDM_STAT_U_BATT_WERT                               (RXBUF_UINT(2)/4000.0f+6.0f)
     #define I3_RES_EDM_STAT_U_BATT_WERT_UNIT                          'V'
     #define I3_RES_EDM_STAT_U_BATT_WERT_TYPE                          float
+    #define I3_FLD_EDM_STAT_U_BATT_WERT                               I3_PID_EDM_STATUS_MESSWERTE_IBS, 2, PID_FIELD_UINT16, 0.00025f, 6.0f, "STAT_U_BATT_WERT"
         // Battery voltage
 
     #define I3_RES_EDM_STAT_I_BATT_WERT                               (RXBUF_UINT(4)/12.5f-200.0f)
     #define I3_RES_EDM_STAT_I_BATT_WERT_UNIT                          'A'
     #define I3_RES_EDM_STAT_I_BATT_WERT_TYPE                          float
+    #define I3_FLD_EDM_STAT_I_BATT_WERT                               I3_PID_EDM_STATUS_MESSWERTE_IBS, 4, PID_FIELD_UINT16, 0.08f, -200.0f, "STAT_I_BATT_WERT"
         // Battery current
 
 // POLL line
@@ -0,0 +1,323 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/edmei1.json: EDM 12: Electrical digital motor electronics (low voltage ECU)
+// This generated code  makes it easier to process CANBUS messages from the EDM ecu in a BMW i3
+//
+
+// 0xA1D0 I3_PID_EDM_ENTLUEFTUNG_KUEHLSYSTEM
+#define I3_FLD_EDM_STAT_ROUTINE_STATUS                           I3_PID_EDM_ENTLUEFTUNG_KUEHLSYSTEM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS"
+#define I3_FLD_EDM_STAT_RESTZEIT_WERT                            I3_PID_EDM_ENTLUEFTUNG_KUEHLSYSTEM, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESTZEIT_WERT"
+
+// 0xADFA I3_PID_EDM_MCAMOS
+
+// 0xAE02 I3_PID_EDM_12V_NACHLADEHISTORIE_LOESCHEN
+
+// 0xAE03 I3_PID_EDM_12V_NACHLADEHISTOGRAMM_LOESCHEN
+
+// 0xDE22 I3_PID_EDM_EME_KAELTEMITTEL_ABSPERRVENTIL_ON_OFF
+#define I3_FLD_EDM_STAT_AKAV_ON                                  I3_PID_EDM_EME_KAELTEMITTEL_ABSPERRVENTIL_ON_OFF, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AKAV_ON"
+
+// 0xDE9C I3_PID_EDM_PEDALWERTGEBER
+#define I3_FLD_EDM_STAT_SPANNUNG_PEDALWERT1_WERT                 I3_PID_EDM_PEDALWERTGEBER, 0, PID_FIELD_UINT16, 0.0049f, 0.0f, "STAT_SPANNUNG_PEDALWERT1_WERT"
+#define I3_FLD_EDM_STAT_SPANNUNG_PEDALWERT2_WERT                 I3_PID_EDM_PEDALWERTGEBER, 2, PID_FIELD_UINT16, 0.0049f, 0.0f, "STAT_SPANNUNG_PEDALWERT2_WERT"
+#define I3_FLD_EDM_STAT_PEDALWERT_WERT                           I3_PID_EDM_PEDALWERTGEBER, 4, PID_FIELD_UINT16, 0.0625f, 0.0f, "STAT_PEDALWERT_WERT"
+
+// 0xDEE1 I3_PID_EDM_REX_STATISTIK_BETRIEB
+#define I3_FLD_EDM_STAT_BETRIEB_KILOMETER_WERT                   I3_PID_EDM_REX_STATISTIK_BETRIEB, 0, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_BETRIEB_KILOMETER_WERT"
+#define I3_FLD_EDM_STAT_LAUFZEIT_WERT                            I3_PID_EDM_REX_STATISTIK_BETRIEB, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LAUFZEIT_WERT"
+#define I3_FLD_EDM_STAT_BETRIEB_ERSTSTARTS_WERT                  I3_PID_EDM_REX_STATISTIK_BETRIEB, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BETRIEB_ERSTSTARTS_WERT"
+#define I3_FLD_EDM_STAT_BETRIEB_MSA_STARTS_WERT                  I3_PID_EDM_REX_STATISTIK_BETRIEB, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_BETRIEB_MSA_STARTS_WERT"
+#define I3_FLD_EDM_STAT_REX_BETRIEB_WARTUNG_STARTS_WERT          I3_PID_EDM_REX_STATISTIK_BETRIEB, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_BETRIEB_WARTUNG_STARTS_WERT"
+#define I3_FLD_EDM_STAT_REX_BETRIEB_BEZUGSKILOMETER_WERT         I3_PID_EDM_REX_STATISTIK_BETRIEB, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_REX_BETRIEB_BEZUGSKILOMETER_WERT"
+
+// 0xDEE2 I3_PID_EDM_REX_STATISTIK_DREHZAHL
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_1_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_1_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_2_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_2_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_3_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_3_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_4_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_4_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_5_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_5_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_6_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_6_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_7_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_7_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_8_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_8_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_9_WERT              I3_PID_EDM_REX_STATISTIK_DREHZAHL, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_9_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_10_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_10_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_11_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_11_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_12_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_12_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_13_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_13_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_14_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_14_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_15_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_15_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_16_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_16_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_17_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_17_WERT"
+#define I3_FLD_EDM_STAT_REX_ZEIT_IN_DREHZAHL_18_WERT             I3_PID_EDM_REX_STATISTIK_DREHZAHL, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_ZEIT_IN_DREHZAHL_18_WERT"
+
+// 0xDEFD I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO
+#define I3_FLD_EDM_STAT_PARKEN_SYSTEMZEIT_WERT                   I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PARKEN_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_PARKEN_KILOMETERSTAND_WERT               I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PARKEN_KILOMETERSTAND_WERT"
+#define I3_FLD_EDM_STAT_PARKEN_NV_BATTERIE_SOC_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 8, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_PARKEN_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E1_PARKEN_SYSTEMZEIT_WERT                I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E1_PARKEN_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E1_PARKEN_KILOMETERSTAND_WERT            I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E1_PARKEN_KILOMETERSTAND_WERT"
+#define I3_FLD_EDM_STAT_E1_PARKEN_NV_BATTERIE_SOC_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 17, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_PARKEN_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E1_START_ZYKNL_SYSTEMZEIT_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E1_START_ZYKNL_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E1_START_ZYKNL_NV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 22, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_START_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E1_START_ZYKNL_HV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 23, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_START_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E1_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 24, PID_FIELD_UINT8, 1.0f, -128.0f, "STAT_E1_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT"
+#define I3_FLD_EDM_STAT_E1_LADEDAUER_WERT                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 25, PID_FIELD_UINT16, 1.0f, 1.0f, "STAT_E1_LADEDAUER_WERT"
+#define I3_FLD_EDM_STAT_E1_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 27, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E1_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 28, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E1_GRUND_LADEENDE                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E1_GRUND_LADEENDE"
+#define I3_FLD_EDM_STAT_E1_ZYKNL_PROGNOSE_EIN                    I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E1_ZYKNL_PROGNOSE_EIN"
+#define I3_FLD_EDM_STAT_E2_PARKEN_SYSTEMZEIT_WERT                I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 31, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E2_PARKEN_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E2_PARKEN_KILOMETERSTAND_WERT            I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 35, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E2_PARKEN_KILOMETERSTAND_WERT"
+#define I3_FLD_EDM_STAT_E2_PARKEN_NV_BATTERIE_SOC_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 39, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_PARKEN_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E2_START_ZYKNL_SYSTEMZEIT_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E2_START_ZYKNL_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E2_START_ZYKNL_NV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 44, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_START_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E2_START_ZYKNL_HV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 45, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_START_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E2_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 46, PID_FIELD_UINT8, 1.0f, -128.0f, "STAT_E2_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT"
+#define I3_FLD_EDM_STAT_E2_LADEDAUER_WERT                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 47, PID_FIELD_UINT16, 1.0f, 1.0f, "STAT_E2_LADEDAUER_WERT"
+#define I3_FLD_EDM_STAT_E2_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 49, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E2_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 50, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E2_GRUND_LADEENDE                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E2_GRUND_LADEENDE"
+#define I3_FLD_EDM_STAT_E2_ZYKNL_PROGNOSE_EIN                    I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E2_ZYKNL_PROGNOSE_EIN"
+#define I3_FLD_EDM_STAT_E3_PARKEN_SYSTEMZEIT_WERT                I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 53, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E3_PARKEN_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E3_PARKEN_KILOMETERSTAND_WERT            I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 57, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E3_PARKEN_KILOMETERSTAND_WERT"
+#define I3_FLD_EDM_STAT_E3_PARKEN_NV_BATTERIE_SOC_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 61, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_PARKEN_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E3_START_ZYKNL_SYSTEMZEIT_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 62, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E3_START_ZYKNL_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E3_START_ZYKNL_NV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 66, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_START_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E3_START_ZYKNL_HV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 67, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_START_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E3_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 68, PID_FIELD_UINT8, 1.0f, -128.0f, "STAT_E3_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT"
+#define I3_FLD_EDM_STAT_E3_LADEDAUER_WERT                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 69, PID_FIELD_UINT16, 1.0f, 1.0f, "STAT_E3_LADEDAUER_WERT"
+#define I3_FLD_EDM_STAT_E3_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 71, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E3_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 72, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E3_GRUND_LADEENDE                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E3_GRUND_LADEENDE"
+#define I3_FLD_EDM_STAT_E3_ZYKNL_PROGNOSE_EIN                    I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E3_ZYKNL_PROGNOSE_EIN"
+#define I3_FLD_EDM_STAT_E4_PARKEN_SYSTEMZEIT_WERT                I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 75, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E4_PARKEN_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E4_PARKEN_KILOMETERSTAND_WERT            I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 79, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E4_PARKEN_KILOMETERSTAND_WERT"
+#define I3_FLD_EDM_STAT_E4_PARKEN_NV_BATTERIE_SOC_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 83, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_PARKEN_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E4_START_ZYKNL_SYSTEMZEIT_WERT           I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 84, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E4_START_ZYKNL_SYSTEMZEIT_WERT"
+#define I3_FLD_EDM_STAT_E4_START_ZYKNL_NV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 88, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_START_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E4_START_ZYKNL_HV_BATTERIE_SOC_WERT      I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 89, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_START_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E4_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 90, PID_FIELD_UINT8, 1.0f, -128.0f, "STAT_E4_START_ZYKNL_NV_BATTERIE_TEMPERATUR_WERT"
+#define I3_FLD_EDM_STAT_E4_LADEDAUER_WERT                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 91, PID_FIELD_UINT16, 1.0f, 1.0f, "STAT_E4_LADEDAUER_WERT"
+#define I3_FLD_EDM_STAT_E4_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 93, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_ENDE_ZYKNL_NV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E4_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT       I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 94, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_ENDE_ZYKNL_HV_BATTERIE_SOC_WERT"
+#define I3_FLD_EDM_STAT_E4_GRUND_LADEENDE                        I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 95, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E4_GRUND_LADEENDE"
+#define I3_FLD_EDM_STAT_E4_ZYKNL_PROGNOSE_EIN                    I3_PID_EDM_ZYKLISCHES_NACHLADEN_INFO, 96, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E4_ZYKNL_PROGNOSE_EIN"
+
+// 0xDEFE I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_A_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_A_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_B_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_B_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_C_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_C_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_D_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_D_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_E_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_E_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_F_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_F_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_G_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_G_WERT"
+#define I3_FLD_EDM_STAT_STANDZEIT_START_ZYKNL_BEREICH_H_WERT     I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDZEIT_START_ZYKNL_BEREICH_H_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_A_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_A_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_B_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_B_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_C_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_C_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_D_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_D_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_E_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_E_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_F_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_F_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_G_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_G_WERT"
+#define I3_FLD_EDM_STAT_LADUNGSDAUER_BEREICH_H_WERT              I3_PID_EDM_ZYKLISCHES_NACHLADEN_HISTOGRAMM, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADUNGSDAUER_BEREICH_H_WERT"
+
+// 0xDF53 I3_PID_EDM_REX_STATISTIK_TEMPERATUR
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_1_WERT  I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_1_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_2_WERT  I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_2_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_3_WERT  I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOR_KUEHLMITTEL_3_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_MOTOROEL_1_WERT           I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOROEL_1_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_MOTOROEL_2_WERT           I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOROEL_2_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_MOTOROEL_3_WERT           I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_MOTOROEL_3_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_UMGEBUNG_1_WERT           I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_UMGEBUNG_1_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_UMGEBUNG_2_WERT           I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_UMGEBUNG_2_WERT"
+#define I3_FLD_EDM_STAT_REX_TEMPERATUR_UMGEBUNG_3_WERT           I3_PID_EDM_REX_STATISTIK_TEMPERATUR, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_REX_TEMPERATUR_UMGEBUNG_3_WERT"
+
+// 0xDF54 I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN
+#define I3_FLD_EDM_STAT_REX_FAHRT_KILOMETER_KLASSE_1_WERT        I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_1_WERT"
+#define I3_FLD_EDM_STAT_REX_FAHRT_KILOMETER_KLASSE_2_WERT        I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_2_WERT"
+#define I3_FLD_EDM_STAT_REX_FAHRT_KILOMETER_KLASSE_3_WERT        I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_3_WERT"
+#define I3_FLD_EDM_STAT_REX_FAHRT_KILOMETER_KLASSE_4_WERT        I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_4_WERT"
+#define I3_FLD_EDM_STAT_REX_FAHRT_KILOMETER_KLASSE_5_WERT        I3_PID_EDM_REX_STATISTIK_KILOMETER_KLASSEN, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_FAHRT_KILOMETER_KLASSE_5_WERT"
+
+// 0xDF55 I3_PID_EDM_REX_STATISTIK_ZYKLEN
+#define I3_FLD_EDM_STAT_ZYKLEN_GESAMT_WERT                       I3_PID_EDM_REX_STATISTIK_ZYKLEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZYKLEN_GESAMT_WERT"
+#define I3_FLD_EDM_STAT_ZYKLEN_REX_BETRIEB_WERT                  I3_PID_EDM_REX_STATISTIK_ZYKLEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZYKLEN_REX_BETRIEB_WERT"
+
+// 0xDF56 I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_1_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_1_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_1_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_1_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_1_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_1_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_1_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_1_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_2_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_2_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_2_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_2_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_2_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_2_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_2_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_2_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_3_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_3_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_3_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_3_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_3_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_3_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_3_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_3_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_4_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_4_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_4_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_4_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_4_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_4_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_4_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_4_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_5_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_5_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_5_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_5_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_5_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_5_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_5_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_5_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_6_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_6_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_6_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 42, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_6_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_6_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_6_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_6_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_6_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_7_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 48, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_7_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_7_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 50, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_7_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_7_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_7_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_7_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_7_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_1_KM_8_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 56, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_1_KM_8_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_2_KM_8_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 58, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_2_KM_8_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_3_KM_8_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_3_KM_8_WERT"
+#define I3_FLD_EDM_STAT_REX_START_SOC_4_KM_8_WERT                I3_PID_EDM_REX_STATISTIK_SOC_KILOMETER_KLASSEN, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_START_SOC_4_KM_8_WERT"
+
+// 0xDF5E I3_PID_EDM_REX_STATISTIK_ZAEHLER
+#define I3_FLD_EDM_STAT_REX_BETRIEB_LANGZEITSTART_IO_WERT        I3_PID_EDM_REX_STATISTIK_ZAEHLER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_BETRIEB_LANGZEITSTART_IO_WERT"
+#define I3_FLD_EDM_STAT_REX_BETRIEB_LANGZEITSTART_NIO_WERT       I3_PID_EDM_REX_STATISTIK_ZAEHLER, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_BETRIEB_LANGZEITSTART_NIO_WERT"
+#define I3_FLD_EDM_STAT_REX_BETRIEB_TANK_LEER_STOPS_WERT         I3_PID_EDM_REX_STATISTIK_ZAEHLER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REX_BETRIEB_TANK_LEER_STOPS_WERT"
+
+// 0x1061 I3_PID_EDM_STEUERN_INTERLOCK
+
+// 0x409D I3_PID_EDM_12V_NACHLADEHISTORIE
+#define I3_FLD_EDM_STAT_KM_STAND_WERT                            I3_PID_EDM_12V_NACHLADEHISTORIE, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_STAND_WERT"
+#define I3_FLD_EDM_STAT_SYSTEMZEIT_PARKEN_WERT                   I3_PID_EDM_12V_NACHLADEHISTORIE, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SYSTEMZEIT_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_12V_BATTERIE_SOC_PARKEN_WERT             I3_PID_EDM_12V_NACHLADEHISTORIE, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_12V_BATTERIE_SOC_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E1_KM_STAND_WERT                         I3_PID_EDM_12V_NACHLADEHISTORIE, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E1_KM_STAND_WERT"
+#define I3_FLD_EDM_STAT_E2_KM_STAND_WERT                         I3_PID_EDM_12V_NACHLADEHISTORIE, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E2_KM_STAND_WERT"
+#define I3_FLD_EDM_STAT_E3_KM_STAND_WERT                         I3_PID_EDM_12V_NACHLADEHISTORIE, 17, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E3_KM_STAND_WERT"
+#define I3_FLD_EDM_STAT_E4_KM_STAND_WERT                         I3_PID_EDM_12V_NACHLADEHISTORIE, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E4_KM_STAND_WERT"
+#define I3_FLD_EDM_STAT_E1_SYSTEMZEIT_PARKEN_WERT                I3_PID_EDM_12V_NACHLADEHISTORIE, 25, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E1_SYSTEMZEIT_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E2_SYSTEMZEIT_PARKEN_WERT                I3_PID_EDM_12V_NACHLADEHISTORIE, 29, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E2_SYSTEMZEIT_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E3_SYSTEMZEIT_PARKEN_WERT                I3_PID_EDM_12V_NACHLADEHISTORIE, 33, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E3_SYSTEMZEIT_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E4_SYSTEMZEIT_PARKEN_WERT                I3_PID_EDM_12V_NACHLADEHISTORIE, 37, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E4_SYSTEMZEIT_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E1_12V_BATTERIE_SOC_PARKEN_WERT          I3_PID_EDM_12V_NACHLADEHISTORIE, 41, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_12V_BATTERIE_SOC_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E2_12V_BATTERIE_SOC_PARKEN_WERT          I3_PID_EDM_12V_NACHLADEHISTORIE, 42, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_12V_BATTERIE_SOC_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E3_12V_BATTERIE_SOC_PARKEN_WERT          I3_PID_EDM_12V_NACHLADEHISTORIE, 43, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_12V_BATTERIE_SOC_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E4_12V_BATTERIE_SOC_PARKEN_WERT          I3_PID_EDM_12V_NACHLADEHISTORIE, 44, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_12V_BATTERIE_SOC_PARKEN_WERT"
+#define I3_FLD_EDM_STAT_E1_SYSTEMZEIT_LADEBEGINN_WERT            I3_PID_EDM_12V_NACHLADEHISTORIE, 45, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E1_SYSTEMZEIT_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E2_SYSTEMZEIT_LADEBEGINN_WERT            I3_PID_EDM_12V_NACHLADEHISTORIE, 49, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E2_SYSTEMZEIT_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E3_SYSTEMZEIT_LADEBEGINN_WERT            I3_PID_EDM_12V_NACHLADEHISTORIE, 53, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E3_SYSTEMZEIT_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E4_SYSTEMZEIT_LADEBEGINN_WERT            I3_PID_EDM_12V_NACHLADEHISTORIE, 57, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_E4_SYSTEMZEIT_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E1_12V_BATTERIE_SOC_LADEBEGINN_WERT      I3_PID_EDM_12V_NACHLADEHISTORIE, 61, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_12V_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E2_12V_BATTERIE_SOC_LADEBEGINN_WERT      I3_PID_EDM_12V_NACHLADEHISTORIE, 62, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_12V_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E3_12V_BATTERIE_SOC_LADEBEGINN_WERT      I3_PID_EDM_12V_NACHLADEHISTORIE, 63, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_12V_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E4_12V_BATTERIE_SOC_LADEBEGINN_WERT      I3_PID_EDM_12V_NACHLADEHISTORIE, 64, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_12V_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E1_HV_BATTERIE_SOC_LADEBEGINN_WERT       I3_PID_EDM_12V_NACHLADEHISTORIE, 65, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_HV_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E2_HV_BATTERIE_SOC_LADEBEGINN_WERT       I3_PID_EDM_12V_NACHLADEHISTORIE, 66, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_HV_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E3_HV_BATTERIE_SOC_LADEBEGINN_WERT       I3_PID_EDM_12V_NACHLADEHISTORIE, 67, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_HV_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E4_HV_BATTERIE_SOC_LADEBEGINN_WERT       I3_PID_EDM_12V_NACHLADEHISTORIE, 68, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_HV_BATTERIE_SOC_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E1_12V_BATTERIE_TEMP_LADEBEGINN_WERT     I3_PID_EDM_12V_NACHLADEHISTORIE, 69, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_E1_12V_BATTERIE_TEMP_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E2_12V_BATTERIE_TEMP_LADEBEGINN_WERT     I3_PID_EDM_12V_NACHLADEHISTORIE, 70, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_E2_12V_BATTERIE_TEMP_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E3_12V_BATTERIE_TEMP_LADEBEGINN_WERT     I3_PID_EDM_12V_NACHLADEHISTORIE, 71, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_E3_12V_BATTERIE_TEMP_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E4_12V_BATTERIE_TEMP_LADEBEGINN_WERT     I3_PID_EDM_12V_NACHLADEHISTORIE, 72, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_E4_12V_BATTERIE_TEMP_LADEBEGINN_WERT"
+#define I3_FLD_EDM_STAT_E1_LADEDAUER_WERT_0X409D                 I3_PID_EDM_12V_NACHLADEHISTORIE, 73, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_E1_LADEDAUER_WERT_0X409D"
+#define I3_FLD_EDM_STAT_E2_LADEDAUER_WERT_0X409D                 I3_PID_EDM_12V_NACHLADEHISTORIE, 75, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_E2_LADEDAUER_WERT_0X409D"
+#define I3_FLD_EDM_STAT_E3_LADEDAUER_WERT_0X409D                 I3_PID_EDM_12V_NACHLADEHISTORIE, 77, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_E3_LADEDAUER_WERT_0X409D"
+#define I3_FLD_EDM_STAT_E4_LADEDAUER_WERT_0X409D                 I3_PID_EDM_12V_NACHLADEHISTORIE, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_E4_LADEDAUER_WERT_0X409D"
+#define I3_FLD_EDM_STAT_E1_12V_BATTERIE_SOC_LADEENDE_WERT        I3_PID_EDM_12V_NACHLADEHISTORIE, 81, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_12V_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E2_12V_BATTERIE_SOC_LADEENDE_WERT        I3_PID_EDM_12V_NACHLADEHISTORIE, 82, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_12V_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E3_12V_BATTERIE_SOC_LADEENDE_WERT        I3_PID_EDM_12V_NACHLADEHISTORIE, 83, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_12V_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E4_12V_BATTERIE_SOC_LADEENDE_WERT        I3_PID_EDM_12V_NACHLADEHISTORIE, 84, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_12V_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E1_HV_BATTERIE_SOC_LADEENDE_WERT         I3_PID_EDM_12V_NACHLADEHISTORIE, 85, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E1_HV_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E2_HV_BATTERIE_SOC_LADEENDE_WERT         I3_PID_EDM_12V_NACHLADEHISTORIE, 86, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E2_HV_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E3_HV_BATTERIE_SOC_LADEENDE_WERT         I3_PID_EDM_12V_NACHLADEHISTORIE, 87, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E3_HV_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E4_HV_BATTERIE_SOC_LADEENDE_WERT         I3_PID_EDM_12V_NACHLADEHISTORIE, 88, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_E4_HV_BATTERIE_SOC_LADEENDE_WERT"
+#define I3_FLD_EDM_STAT_E1_12VLADEFEHLER                         I3_PID_EDM_12V_NACHLADEHISTORIE, 89, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E1_12VLADEFEHLER"
+#define I3_FLD_EDM_STAT_E2_12VLADEFEHLER                         I3_PID_EDM_12V_NACHLADEHISTORIE, 90, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E2_12VLADEFEHLER"
+#define I3_FLD_EDM_STAT_E3_12VLADEFEHLER                         I3_PID_EDM_12V_NACHLADEHISTORIE, 91, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E3_12VLADEFEHLER"
+#define I3_FLD_EDM_STAT_E4_12VLADEFEHLER                         I3_PID_EDM_12V_NACHLADEHISTORIE, 92, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_E4_12VLADEFEHLER"
+
+// 0x409E I3_PID_EDM_12V_NACHLADEHISTOGRAMM
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_A_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_A_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_B_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_B_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_C_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_C_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_D_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_D_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_E_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_E_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_F_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_F_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_G_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_G_WERT"
+#define I3_FLD_EDM_STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_H_WERT I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_STANDZEIT_BIS_LADEBEGINN_BEREICH_H_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_A_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_A_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_B_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_B_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_C_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_C_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_D_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_D_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_E_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_E_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_F_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_F_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_G_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_G_WERT"
+#define I3_FLD_EDM_STAT_HFK_LADEDAUER_BEREICH_H_WERT             I3_PID_EDM_12V_NACHLADEHISTOGRAMM, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HFK_LADEDAUER_BEREICH_H_WERT"
+
+// 0x4101 I3_PID_EDM_STATUS_E_S_KL_15_WUP
+#define I3_FLD_EDM_STAT_E_S_KL15_WUP                             I3_PID_EDM_STATUS_E_S_KL_15_WUP, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_E_S_KL15_WUP"
+
+// 0x4102 I3_PID_EDM_STATUS_E_A_PWG1_RAW
+#define I3_FLD_EDM_STAT_E_A_PWG1_RAW_WERT                        I3_PID_EDM_STATUS_E_A_PWG1_RAW, 0, PID_FIELD_UINT16, 0.0048828125f, 0.0f, "STAT_E_A_PWG1_RAW_WERT"
+
+// 0x4103 I3_PID_EDM_STATUS_E_A_PWG2_RAW
+#define I3_FLD_EDM_STAT_E_A_PWG2_RAW_WERT                        I3_PID_EDM_STATUS_E_A_PWG2_RAW, 0, PID_FIELD_UINT16, 0.0048828125f, 0.0f, "STAT_E_A_PWG2_RAW_WERT"
+
+// 0x4104 I3_PID_EDM_STATUS_E_A_TMEL_RAW
+#define I3_FLD_EDM_STAT_E_A_TMEL_RAW_WERT                        I3_PID_EDM_STATUS_E_A_TMEL_RAW, 0, PID_FIELD_UINT16, 0.00122070312f, 0.0f, "STAT_E_A_TMEL_RAW_WERT"
+
+// 0x4105 I3_PID_EDM_STATUS_BATTERIE_VOLTAGE_RAUS
+#define I3_FLD_EDM_STAT_BATTERY_VOLTAGE_RAW_WERT                 I3_PID_EDM_STATUS_BATTERIE_VOLTAGE_RAUS, 0, PID_FIELD_UINT16, 0.00122100122f, 0.0f, "STAT_BATTERY_VOLTAGE_RAW_WERT"
+
+// 0x4106 I3_PID_EDM_STATUS_A_U_PWG1
+#define I3_FLD_EDM_STAT_A_U_PWG1_WERT                            I3_PID_EDM_STATUS_A_U_PWG1, 0, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_A_U_PWG1_WERT"
+
+// 0x4107 I3_PID_EDM_STATUS_A_U_PWG2
+#define I3_FLD_EDM_STAT_A_U_PWG2_WERT                            I3_PID_EDM_STATUS_A_U_PWG2, 0, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_A_U_PWG2_WERT"
+
+// 0x4109 I3_PID_EDM_STATUS_E_A_MEL
+#define I3_FLD_EDM_STAT_E_A_MEL_WERT                             I3_PID_EDM_STATUS_E_A_MEL, 0, PID_FIELD_UINT16, 0.00305526252f, 0.0f, "STAT_E_A_MEL_WERT"
+
+// 0x410A I3_PID_EDM_STATUS_ECU_MICRO_TEMPERATUR
+#define I3_FLD_EDM_STAT_ECU_MICRO_TEMPERATUR_WERT                I3_PID_EDM_STATUS_ECU_MICRO_TEMPERATUR, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_ECU_MICRO_TEMPERATUR_WERT"
+
+// 0x410B I3_PID_EDM_STATUS_E_A_TMEL2_RAW
+#define I3_FLD_EDM_STAT__WERT                                    I3_PID_EDM_STATUS_E_A_TMEL2_RAW, 0, PID_FIELD_UINT16, 0.00488758553f, 0.0f, "STAT__WERT"
+
+// 0x4120 I3_PID_EDM_STATUS_A_S_ELRLY
+#define I3_FLD_EDM_STAT_A_S_ELRLY                                I3_PID_EDM_STATUS_A_S_ELRLY, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_A_S_ELRLY"
+
+// 0x4121 I3_PID_EDM_STATUS_A_T_ELUE
+#define I3_FLD_EDM_STAT_A_T_ELUE_WERT                            I3_PID_EDM_STATUS_A_T_ELUE, 0, PID_FIELD_UINT16, 0.00152590219f, 0.0f, "STAT_A_T_ELUE_WERT"
+
+// 0x4122 I3_PID_EDM_STATUS_A_T_EWP
+#define I3_FLD_EDM_STAT_A_T_EWAP_WERT                            I3_PID_EDM_STATUS_A_T_EWP, 0, PID_FIELD_UINT16, 0.00152590219f, 0.0f, "STAT_A_T_EWAP_WERT"
+
+// 0x4123 I3_PID_EDM_STATUS_A_S_KV1
+#define I3_FLD_EDM_STAT_A_S_KV1                                  I3_PID_EDM_STATUS_A_S_KV1, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_A_S_KV1"
+
+// 0x4124 I3_PID_EDM_STATUS_A_S_KV2
+#define I3_FLD_EDM_STAT_A_S_KV2                                  I3_PID_EDM_STATUS_A_S_KV2, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_A_S_KV2"
+
+// 0x4125 I3_PID_EDM_STATUS_A_S_MEL
+#define I3_FLD_EDM_STAT_A_S_MEL                                  I3_PID_EDM_STATUS_A_S_MEL, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_A_S_MEL"
+
+// 0x4182 I3_PID_EDM_STATUS_E_A_PWG1
+#define I3_FLD_EDM_STAT_E_A_PWG1_FILTERED_WERT                   I3_PID_EDM_STATUS_E_A_PWG1, 0, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_E_A_PWG1_FILTERED_WERT"
+
+// 0x4183 I3_PID_EDM_STATUS_E_A_PWG2_FILTERED
+#define I3_FLD_EDM_STAT_E_A_PWG2_FILTERED_WERT                   I3_PID_EDM_STATUS_E_A_PWG2_FILTERED, 0, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_E_A_PWG2_FILTERED_WERT"
+
+// 0x4184 I3_PID_EDM_STATUS_TEMPERATUR_SENSOR_1
+#define I3_FLD_EDM_STAT_TEMPERATUR_TEMPERATURSENSOR_1_WERT       I3_PID_EDM_STATUS_TEMPERATUR_SENSOR_1, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_TEMPERATUR_TEMPERATURSENSOR_1_WERT"
+
+// 0x4185 I3_PID_EDM_STATUS_BATTERY_VOLTAGE_FILTERED
+#define I3_FLD_EDM_STAT_BATTERY_VOLTAGE_FILTERED_WERT            I3_PID_EDM_STATUS_BATTERY_VOLTAGE_FILTERED, 0, PID_FIELD_SINT16, 0.0078125f, 0.0f, "STAT_BATTERY_VOLTAGE_FILTERED_WERT"
+
+// 0x418B I3_PID_EDM_STATUS_TEMPERATUR_SENSOR_2
+#define I3_FLD_EDM_STAT_TEMPERATUR_TEMPERATURSENSOR_2_WERT       I3_PID_EDM_STATUS_TEMPERATUR_SENSOR_2, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_TEMPERATUR_TEMPERATURSENSOR_2_WERT"
+
+// 0xF0D5 I3_PID_EDM_STEUERN_AKKS
+#define I3_FLD_EDM_STAT_AKKS_SMOTPOAKKSLIN_WERT                  I3_PID_EDM_STEUERN_AKKS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AKKS_SMOTPOAKKSLIN_WERT"
+#define I3_FLD_EDM_STAT_AKKS_IS_POS_LIN_WERT                     I3_PID_EDM_STEUERN_AKKS, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AKKS_IS_POS_LIN_WERT"
+#define I3_FLD_EDM_STAT_AKKS_DSRD_POS_ANGLE_WERT                 I3_PID_EDM_STEUERN_AKKS, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AKKS_DSRD_POS_ANGLE_WERT"
+#define I3_FLD_EDM_STAT_AKKS_ACT_POS_ANGLE_WERT                  I3_PID_EDM_STEUERN_AKKS, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_AKKS_ACT_POS_ANGLE_WERT"
+#define I3_FLD_EDM_BF_AKKS_ERROR                                 I3_PID_EDM_STEUERN_AKKS, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_AKKS_ERROR"
+#define I3_FLD_EDM_STAT_VRSAKKLIN_WERT                           I3_PID_EDM_STEUERN_AKKS, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VRSAKKLIN_WERT"
@@ -0,0 +1,1250 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/eme_i01.json: EME 1A: Electrical machine electronics
+// This generated code  makes it easier to process CANBUS messages from the EME ecu in a BMW i3
+//
+
+// 0x1060 I3_PID_EME_FS_LOESCHEN_PERMANENT
+
+// 0x1061 I3_PID_EME_FEHLERSPEICHER_ENDE_WERKSABLAUF
+#define I3_FLD_EME_STAT_FS_ENDE_WABL                             I3_PID_EME_FEHLERSPEICHER_ENDE_WERKSABLAUF, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FS_ENDE_WABL"
+
+// 0x4009 I3_PID_EME_AKS_DIAG_STATUS_INFO
+#define I3_FLD_EME_STAT_BAM_STATUS_WERT                          I3_PID_EME_AKS_DIAG_STATUS_INFO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BAM_STATUS_WERT"
+#define I3_FLD_EME_STAT_FRM_ISR_WERT                             I3_PID_EME_AKS_DIAG_STATUS_INFO, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FRM_ISR_WERT"
+#define I3_FLD_EME_STAT_POM_1MS_WERT                             I3_PID_EME_AKS_DIAG_STATUS_INFO, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_POM_1MS_WERT"
+#define I3_FLD_EME_STAT_POM_10MS_WERT                            I3_PID_EME_AKS_DIAG_STATUS_INFO, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_POM_10MS_WERT"
+#define I3_FLD_EME_STAT_ERR_MOT_TRCT_WERT                        I3_PID_EME_AKS_DIAG_STATUS_INFO, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ERR_MOT_TRCT_WERT"
+#define I3_FLD_EME_STAT_HVSM_MC0_WERT                            I3_PID_EME_AKS_DIAG_STATUS_INFO, 11, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVSM_MC0_WERT"
+#define I3_FLD_EME_STAT_HVSM_AKKUM_MC0_WERT                      I3_PID_EME_AKS_DIAG_STATUS_INFO, 15, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVSM_AKKUM_MC0_WERT"
+#define I3_FLD_EME_STAT_HVSM_MC2_WERT                            I3_PID_EME_AKS_DIAG_STATUS_INFO, 19, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVSM_MC2_WERT"
+#define I3_FLD_EME_STAT_HVSM_AKKUM_MC2_WERT                      I3_PID_EME_AKS_DIAG_STATUS_INFO, 23, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVSM_AKKUM_MC2_WERT"
+#define I3_FLD_EME_STAT_CPLD_INFO_WERT                           I3_PID_EME_AKS_DIAG_STATUS_INFO, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CPLD_INFO_WERT"
+#define I3_FLD_EME_STAT_FUSI_MC2_WERT                            I3_PID_EME_AKS_DIAG_STATUS_INFO, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FUSI_MC2_WERT"
+#define I3_FLD_EME_STAT_FUSI_MC0_WERT                            I3_PID_EME_AKS_DIAG_STATUS_INFO, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FUSI_MC0_WERT"
+#define I3_FLD_EME_STAT_SSD_MC0_WERT                             I3_PID_EME_AKS_DIAG_STATUS_INFO, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SSD_MC0_WERT"
+#define I3_FLD_EME_STAT_ERR_UPDATE_IN_PROGRESS_WERT              I3_PID_EME_AKS_DIAG_STATUS_INFO, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ERR_UPDATE_IN_PROGRESS_WERT"
+#define I3_FLD_EME_STAT_FRM_WHY_WERT                             I3_PID_EME_AKS_DIAG_STATUS_INFO, 41, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FRM_WHY_WERT"
+#define I3_FLD_EME_STAT_FRM_EM2_WERT                             I3_PID_EME_AKS_DIAG_STATUS_INFO, 45, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FRM_EM2_WERT"
+
+// 0xDDF6 I3_PID_EME_EME_DCDC_LV
+#define I3_FLD_EME_STAT_SPANNUNG_DCDC_LV_WERT                    I3_PID_EME_EME_DCDC_LV, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SPANNUNG_DCDC_LV_WERT"
+#define I3_FLD_EME_STAT_STROM_DCDC_LV_WERT                       I3_PID_EME_EME_DCDC_LV, 2, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_STROM_DCDC_LV_WERT"
+
+// 0xDE00 I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG
+#define I3_FLD_EME_STAT_SOC_HVB_WERT                             I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SOC_HVB_WERT"
+#define I3_FLD_EME_STAT_SOC_HVB_MIN_WERT                         I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 2, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_SOC_HVB_MIN_WERT"
+#define I3_FLD_EME_STAT_LADEGERAET                               I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEGERAET"
+#define I3_FLD_EME_STAT_FREMDLADUNG                              I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREMDLADUNG"
+#define I3_FLD_EME_STAT_FAHRB                                    I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAHRB"
+#define I3_FLD_EME_STAT_BA_DCDC_KOMM_NR                          I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BA_DCDC_KOMM_NR"
+#define I3_FLD_EME_STAT_I_DCDC_HV_OUT_WERT                       I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 7, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_I_DCDC_HV_OUT_WERT"
+#define I3_FLD_EME_STAT_U_DCDC_HV_OUT_WERT                       I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 9, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_U_DCDC_HV_OUT_WERT"
+#define I3_FLD_EME_STAT_I_DCDC_LV_OUT_WERT                       I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 11, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_I_DCDC_LV_OUT_WERT"
+#define I3_FLD_EME_STAT_U_DCDC_LV_OUT_WERT                       I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 13, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_U_DCDC_LV_OUT_WERT"
+#define I3_FLD_EME_STAT_BA_DCDC_IST_NR                           I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BA_DCDC_IST_NR"
+#define I3_FLD_EME_STAT_ALS_DCDC_WERT                            I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 16, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_ALS_DCDC_WERT"
+#define I3_FLD_EME_STAT_I_DCDC_HV_WERT                           I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 17, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_I_DCDC_HV_WERT"
+#define I3_FLD_EME_STAT_U_DCDC_HV_WERT                           I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 19, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_U_DCDC_HV_WERT"
+#define I3_FLD_EME_STAT_I_DCDC_LV_WERT                           I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 21, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_I_DCDC_LV_WERT"
+#define I3_FLD_EME_STAT_U_DCDC_LV_WERT                           I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 23, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_U_DCDC_LV_WERT"
+
+// 0xDE02 I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF
+#define I3_FLD_EME_STAT_U_DC_HV_LE_WERT                          I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 0, PID_FIELD_SINT16, 0.0313f, 0.0f, "STAT_U_DC_HV_LE_WERT"
+#define I3_FLD_EME_STAT_HV_READY                                 I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HV_READY"
+#define I3_FLD_EME_STAT_HDCAC_EREQ                               I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HDCAC_EREQ"
+#define I3_FLD_EME_STAT_I0ANF_HVB                                I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_I0ANF_HVB"
+#define I3_FLD_EME_STAT_ANF_ENTL_ZK                              I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANF_ENTL_ZK"
+#define I3_FLD_EME_STAT_HVSTART_KOMM                             I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVSTART_KOMM"
+#define I3_FLD_EME_STAT_ANF_ENTL_EME                             I3_PID_EME_EME_HVPM_HV_SYSTEM_ON_OFF, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANF_ENTL_EME"
+
+// 0xDE04 I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_0_20_WERT               I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_0_20_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_20_25_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_20_25_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_25_30_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_25_30_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_30_33_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_30_33_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_33_36_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_33_36_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_36_39_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_36_39_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_39_42_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_39_42_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_42_45_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_42_45_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_45_48_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_45_48_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_48_51_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_48_51_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_51_56_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_51_56_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_56_65_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_56_65_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_65_80_WERT              I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_65_80_WERT"
+#define I3_FLD_EME_STAT_NV_HVB_SOC_FAHRB_80_100_WERT             I3_PID_EME_EME_HVPM_ENERGIEBORDNETZ_2, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NV_HVB_SOC_FAHRB_80_100_WERT"
+
+// 0xDE06 I3_PID_EME_EME_HVPM_PKOR
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_0_WERT                     I3_PID_EME_EME_HVPM_PKOR, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_0_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_1_WERT                     I3_PID_EME_EME_HVPM_PKOR, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_1_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_2_WERT                     I3_PID_EME_EME_HVPM_PKOR, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_2_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_3_WERT                     I3_PID_EME_EME_HVPM_PKOR, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_3_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_4_WERT                     I3_PID_EME_EME_HVPM_PKOR, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_4_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_5_WERT                     I3_PID_EME_EME_HVPM_PKOR, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_5_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_6_WERT                     I3_PID_EME_EME_HVPM_PKOR, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_6_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_7_WERT                     I3_PID_EME_EME_HVPM_PKOR, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_7_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_8_WERT                     I3_PID_EME_EME_HVPM_PKOR, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_8_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_9_WERT                     I3_PID_EME_EME_HVPM_PKOR, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_9_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_10_WERT                    I3_PID_EME_EME_HVPM_PKOR, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_10_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_11_WERT                    I3_PID_EME_EME_HVPM_PKOR, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_11_WERT"
+#define I3_FLD_EME_STAT_T_P_WUNSCH_ID_12_WERT                    I3_PID_EME_EME_HVPM_PKOR, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_WUNSCH_ID_12_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_0_WERT         I3_PID_EME_EME_HVPM_PKOR, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_0_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_1_WERT         I3_PID_EME_EME_HVPM_PKOR, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_1_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_2_WERT         I3_PID_EME_EME_HVPM_PKOR, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_2_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_3_WERT         I3_PID_EME_EME_HVPM_PKOR, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_3_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_4_WERT         I3_PID_EME_EME_HVPM_PKOR, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_4_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_5_WERT         I3_PID_EME_EME_HVPM_PKOR, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_5_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_6_WERT         I3_PID_EME_EME_HVPM_PKOR, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_6_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_7_WERT         I3_PID_EME_EME_HVPM_PKOR, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_7_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_8_WERT         I3_PID_EME_EME_HVPM_PKOR, 42, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_8_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_9_WERT         I3_PID_EME_EME_HVPM_PKOR, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_9_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_10_WERT        I3_PID_EME_EME_HVPM_PKOR, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_10_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_11_WERT        I3_PID_EME_EME_HVPM_PKOR, 48, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_11_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE1_ID_12_WERT        I3_PID_EME_EME_HVPM_PKOR, 50, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE1_ID_12_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_0_WERT         I3_PID_EME_EME_HVPM_PKOR, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_0_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_1_WERT         I3_PID_EME_EME_HVPM_PKOR, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_1_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_2_WERT         I3_PID_EME_EME_HVPM_PKOR, 56, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_2_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_3_WERT         I3_PID_EME_EME_HVPM_PKOR, 58, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_3_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_4_WERT         I3_PID_EME_EME_HVPM_PKOR, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_4_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_5_WERT         I3_PID_EME_EME_HVPM_PKOR, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_5_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_6_WERT         I3_PID_EME_EME_HVPM_PKOR, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_6_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_7_WERT         I3_PID_EME_EME_HVPM_PKOR, 66, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_7_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_8_WERT         I3_PID_EME_EME_HVPM_PKOR, 68, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_8_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_9_WERT         I3_PID_EME_EME_HVPM_PKOR, 70, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_9_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_10_WERT        I3_PID_EME_EME_HVPM_PKOR, 72, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_10_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_11_WERT        I3_PID_EME_EME_HVPM_PKOR, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_11_WERT"
+#define I3_FLD_EME_STAT_T_P_SOLL_WUNSCH_RANGE2_ID_12_WERT        I3_PID_EME_EME_HVPM_PKOR, 76, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T_P_SOLL_WUNSCH_RANGE2_ID_12_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_0_WERT          I3_PID_EME_EME_HVPM_PKOR, 78, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_0_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_1_WERT          I3_PID_EME_EME_HVPM_PKOR, 80, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_1_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_2_WERT          I3_PID_EME_EME_HVPM_PKOR, 82, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_2_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_3_WERT          I3_PID_EME_EME_HVPM_PKOR, 84, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_3_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_4_WERT          I3_PID_EME_EME_HVPM_PKOR, 86, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_4_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_5_WERT          I3_PID_EME_EME_HVPM_PKOR, 88, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_5_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_6_WERT          I3_PID_EME_EME_HVPM_PKOR, 90, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_6_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_7_WERT          I3_PID_EME_EME_HVPM_PKOR, 92, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_7_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_8_WERT          I3_PID_EME_EME_HVPM_PKOR, 94, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_8_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_DCDC_MITTEL_30MIN_9_WERT          I3_PID_EME_EME_HVPM_PKOR, 96, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_DCDC_MITTEL_30MIN_9_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_0_WERT       I3_PID_EME_EME_HVPM_PKOR, 98, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_0_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_1_WERT       I3_PID_EME_EME_HVPM_PKOR, 100, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_1_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_2_WERT       I3_PID_EME_EME_HVPM_PKOR, 102, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_2_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_3_WERT       I3_PID_EME_EME_HVPM_PKOR, 104, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_3_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_4_WERT       I3_PID_EME_EME_HVPM_PKOR, 106, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_4_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_5_WERT       I3_PID_EME_EME_HVPM_PKOR, 108, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_5_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_6_WERT       I3_PID_EME_EME_HVPM_PKOR, 110, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_6_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_7_WERT       I3_PID_EME_EME_HVPM_PKOR, 112, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_7_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_8_WERT       I3_PID_EME_EME_HVPM_PKOR, 114, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_8_WERT"
+#define I3_FLD_EME_STAT_P_HVPM_KOMFORT_MITTEL_30MIN_9_WERT       I3_PID_EME_EME_HVPM_PKOR, 116, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_P_HVPM_KOMFORT_MITTEL_30MIN_9_WERT"
+
+// 0xDE0C I3_PID_EME_EME_HVIL_GESAMT
+#define I3_FLD_EME_STAT_HVIL_GESAMT_NR                           I3_PID_EME_EME_HVIL_GESAMT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVIL_GESAMT_NR"
+
+// 0xDE0E I3_PID_EME_EME_ANSTEUERUNG_ELUP
+#define I3_FLD_EME_STAT_ANST_ELUP_ON                             I3_PID_EME_EME_ANSTEUERUNG_ELUP, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANST_ELUP_ON"
+
+// 0xDE1C I3_PID_EME_EME_HVPM_DCDC_ALS
+#define I3_FLD_EME_STAT_NV_DCDC_ALS_HIST_BEREICH_NULL_WERT       I3_PID_EME_EME_HVPM_DCDC_ALS, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_NULL_WERT"
+#define I3_FLD_EME_STAT_NV_DCDC_ALS_HIST_BEREICH_1_WERT          I3_PID_EME_EME_HVPM_DCDC_ALS, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_1_WERT"
+#define I3_FLD_EME_STAT_NV_DCDC_ALS_HIST_BEREICH_2_WERT          I3_PID_EME_EME_HVPM_DCDC_ALS, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_2_WERT"
+#define I3_FLD_EME_STAT_NV_DCDC_ALS_HIST_BEREICH_3_WERT          I3_PID_EME_EME_HVPM_DCDC_ALS, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_NV_DCDC_ALS_HIST_BEREICH_3_WERT"
+
+// 0xDE2D I3_PID_EME_AE_CPLD_VERSION
+#define I3_FLD_EME_STAT_CPLD_VERSION_WERT                        I3_PID_EME_AE_CPLD_VERSION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CPLD_VERSION_WERT"
+
+// 0xDE39 I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM
+#define I3_FLD_EME_BF_STAT_ST_ERR_MOT_TRCT                       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_STAT_ST_ERR_MOT_TRCT"
+#define I3_FLD_EME_STAT_AVL_TEMP_MOT_TRCT_WERT                   I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 2, PID_FIELD_UINT8, 1.0f, -48.0f, "STAT_AVL_TEMP_MOT_TRCT_WERT"
+#define I3_FLD_EME_STAT_T_EM2TMODROT_WERT                        I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 3, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_T_EM2TMODROT_WERT"
+#define I3_FLD_EME_STAT_AVL_COL_TEMP_ENGMG_EL_WERT               I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 5, PID_FIELD_UINT8, 1.0f, -48.0f, "STAT_AVL_COL_TEMP_ENGMG_EL_WERT"
+#define I3_FLD_EME_STAT_TMOD_V_T_LE2_COOLANT_EXIT_EST_WERT       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TMOD_V_T_LE2_COOLANT_EXIT_EST_WERT"
+#define I3_FLD_EME_STAT_AVL_TEMP_INVE_IGBT_MAX_WERT              I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_TEMP_INVE_IGBT_MAX_WERT"
+#define I3_FLD_EME_BF_STAT_ST_INFO_DER_MOT_TRCT                  I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_STAT_ST_INFO_DER_MOT_TRCT"
+#define I3_FLD_EME_BF_STAT_ST_INFO_DER_INVE_TRCT                 I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_STAT_ST_INFO_DER_INVE_TRCT"
+#define I3_FLD_EME_BF_STAT_V_E_EM2POMERROR50US                   I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "BF_STAT_V_E_EM2POMERROR50US"
+#define I3_FLD_EME_BF_STAT_V_E_FUSILDUWB_MC2_UE2                 I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "BF_STAT_V_E_FUSILDUWB_MC2_UE2"
+#define I3_FLD_EME_BF_STAT_V_E_FUSILDUWB                         I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "BF_STAT_V_E_FUSILDUWB"
+#define I3_FLD_EME_STAT_V_E_EMOPMO_IST                           I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_V_E_EMOPMO_IST"
+#define I3_FLD_EME_STAT_V_E_BAMSTATUS                            I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_V_E_BAMSTATUS"
+#define I3_FLD_EME_STAT_V_LIM_TQP_MD_EM2_GEN_MAX_WERT            I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_LIM_TQP_MD_EM2_GEN_MAX_WERT"
+#define I3_FLD_EME_STAT_V_LIM_TQP_MD_EM2_MOT_MAX_WERT            I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_LIM_TQP_MD_EM2_MOT_MAX_WERT"
+#define I3_FLD_EME_STAT_V_U_INVEM2_UQ_WERT                       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 30, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_U_INVEM2_UQ_WERT"
+#define I3_FLD_EME_STAT_V_U_INVEM2_UD_WERT                       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 32, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_U_INVEM2_UD_WERT"
+#define I3_FLD_EME_STAT_V_I_INVEM2_IQ_WERT                       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 34, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_I_INVEM2_IQ_WERT"
+#define I3_FLD_EME_STAT_V_I_INVEM2_ID_WERT                       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 36, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_I_INVEM2_ID_WERT"
+#define I3_FLD_EME_STAT_V_N_RSLV_STATUS                          I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_V_N_RSLV_STATUS"
+#define I3_FLD_EME_STAT_V_PHI_RSLV_STATUS                        I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_V_PHI_RSLV_STATUS"
+#define I3_FLD_EME_STAT_TAR_TORQ_MOT_TRCT_ASD_WERT               I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 40, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_TAR_TORQ_MOT_TRCT_ASD_WERT"
+#define I3_FLD_EME_STAT_TAR_TORQ_MOT_TRCT_WERT                   I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 42, PID_FIELD_UINT16, 0.5f, -1023.5f, "STAT_TAR_TORQ_MOT_TRCT_WERT"
+#define I3_FLD_EME_STAT_V_N_EMMECHSLOW_UE2_WERT                  I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 44, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_N_EMMECHSLOW_UE2_WERT"
+#define I3_FLD_EME_STAT_V_E_RLSFUSI_ACVREQ                       I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_V_E_RLSFUSI_ACVREQ"
+#define I3_FLD_EME_BF_STAT_V_ST_RLS_FUSI_MC0                     I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_STAT_V_ST_RLS_FUSI_MC0"
+#define I3_FLD_EME_STAT_V_I_INV1_U_RMS_WERT                      I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 48, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_I_INV1_U_RMS_WERT"
+#define I3_FLD_EME_STAT_V_I_INV1_V_RMS_WERT                      I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 50, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_I_INV1_V_RMS_WERT"
+#define I3_FLD_EME_STAT_V_I_INV1_W_RMS_WERT                      I3_PID_EME_AE_SYSTEMLEISTUNG_INV_EM, 52, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_V_I_INV1_W_RMS_WERT"
+
+// 0xDE6E I3_PID_EME_AE_LSC_LADEN_2
+#define I3_FLD_EME_STAT_LADEMODUS                                I3_PID_EME_AE_LSC_LADEN_2, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEMODUS"
+#define I3_FLD_EME_STAT_POSITIONIERUNG                           I3_PID_EME_AE_LSC_LADEN_2, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POSITIONIERUNG"
+#define I3_FLD_EME_BF_LADEUNTERBRECHUNG                          I3_PID_EME_AE_LSC_LADEN_2, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_LADEUNTERBRECHUNG"
+#define I3_FLD_EME_STAT_HVB_SOC_DISP_WERT                        I3_PID_EME_AE_LSC_LADEN_2, 4, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_HVB_SOC_DISP_WERT"
+#define I3_FLD_EME_BF_STATUS_LSC_AUSWAHL_LADEN_MODUS             I3_PID_EME_AE_LSC_LADEN_2, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_STATUS_LSC_AUSWAHL_LADEN_MODUS"
+#define I3_FLD_EME_STAT_LSC_PROGNOSEMODE                         I3_PID_EME_AE_LSC_LADEN_2, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LSC_PROGNOSEMODE"
+#define I3_FLD_EME_STAT_LSC_VERSION                              I3_PID_EME_AE_LSC_LADEN_2, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LSC_VERSION"
+#define I3_FLD_EME_STAT_AKT_PHASE_COUNT_AC_CHARGING              I3_PID_EME_AE_LSC_LADEN_2, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AKT_PHASE_COUNT_AC_CHARGING"
+#define I3_FLD_EME_STAT_HV_BATTERY_SIZE_WERT                     I3_PID_EME_AE_LSC_LADEN_2, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HV_BATTERY_SIZE_WERT"
+#define I3_FLD_EME_STAT_ENERGIEDELTA_VOLL_WERT                   I3_PID_EME_AE_LSC_LADEN_2, 11, PID_FIELD_UINT16, 0.02f, 0.0f, "STAT_ENERGIEDELTA_VOLL_WERT"
+#define I3_FLD_EME_STAT_LADEENDE_URSACHE                         I3_PID_EME_AE_LSC_LADEN_2, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEENDE_URSACHE"
+#define I3_FLD_EME_STAT_LADEVERFAHREN_NR                         I3_PID_EME_AE_LSC_LADEN_2, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEVERFAHREN_NR"
+#define I3_FLD_EME_STAT_LADESTATUS_NR                            I3_PID_EME_AE_LSC_LADEN_2, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADESTATUS_NR"
+#define I3_FLD_EME_STAT_BEGINN_FENSTER_STD_WERT                  I3_PID_EME_AE_LSC_LADEN_2, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEGINN_FENSTER_STD_WERT"
+#define I3_FLD_EME_STAT_BEGINN_FENSTER_MIN_WERT                  I3_PID_EME_AE_LSC_LADEN_2, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEGINN_FENSTER_MIN_WERT"
+#define I3_FLD_EME_STAT_ENDE_FENSTER_STD_WERT                    I3_PID_EME_AE_LSC_LADEN_2, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENDE_FENSTER_STD_WERT"
+#define I3_FLD_EME_STAT_ENDE_FENSTER_MIN_WERT                    I3_PID_EME_AE_LSC_LADEN_2, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENDE_FENSTER_MIN_WERT"
+#define I3_FLD_EME_STAT_LADEFENSTER1_AUSWAHL_NR                  I3_PID_EME_AE_LSC_LADEN_2, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEFENSTER1_AUSWAHL_NR"
+#define I3_FLD_EME_STAT_LADEFENSTER2_AUSWAHL_NR                  I3_PID_EME_AE_LSC_LADEN_2, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEFENSTER2_AUSWAHL_NR"
+#define I3_FLD_EME_STAT_FAKTOR_STROMBEGRENZUNG_NR                I3_PID_EME_AE_LSC_LADEN_2, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKTOR_STROMBEGRENZUNG_NR"
+#define I3_FLD_EME_STAT_STROMBEGRENZUNG_AUSWAHL_NR               I3_PID_EME_AE_LSC_LADEN_2, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STROMBEGRENZUNG_AUSWAHL_NR"
+#define I3_FLD_EME_STAT_POLY_TIM_1_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 24, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_1_WERT"
+#define I3_FLD_EME_STAT_POLY_SOC_1_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 25, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_1_WERT"
+#define I3_FLD_EME_STAT_POLY_TIM_2_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 27, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_2_WERT"
+#define I3_FLD_EME_STAT_POLY_SOC_2_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 28, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_2_WERT"
+#define I3_FLD_EME_STAT_POLY_TIM_3_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 30, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_3_WERT"
+#define I3_FLD_EME_STAT_POLY_SOC_3_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 31, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_3_WERT"
+#define I3_FLD_EME_STAT_POLY_TIM_4_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 33, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_4_WERT"
+#define I3_FLD_EME_STAT_POLY_SOC_4_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 34, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_4_WERT"
+#define I3_FLD_EME_STAT_POLY_TIM_5_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 36, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_5_WERT"
+#define I3_FLD_EME_STAT_POLY_SOC_5_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 37, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_5_WERT"
+#define I3_FLD_EME_STAT_HV_SOC_IST_WERT                          I3_PID_EME_AE_LSC_LADEN_2, 39, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HV_SOC_IST_WERT"
+#define I3_FLD_EME_STAT_LADEN_PROGNOSE_WERT                      I3_PID_EME_AE_LSC_LADEN_2, 41, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEN_PROGNOSE_WERT"
+#define I3_FLD_EME_STAT_LADEN_SPANNUNG_WERT                      I3_PID_EME_AE_LSC_LADEN_2, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEN_SPANNUNG_WERT"
+#define I3_FLD_EME_STAT_LADEN_STROM_WERT                         I3_PID_EME_AE_LSC_LADEN_2, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEN_STROM_WERT"
+#define I3_FLD_EME_STAT_ENERGIEINHALT_IST_WERT                   I3_PID_EME_AE_LSC_LADEN_2, 45, PID_FIELD_UINT32, 3600.0f, 0.0f, "STAT_ENERGIEINHALT_IST_WERT"
+#define I3_FLD_EME_STAT_LSC_TRIGGER_INHALT_NR                    I3_PID_EME_AE_LSC_LADEN_2, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LSC_TRIGGER_INHALT_NR"
+#define I3_FLD_EME_STAT_ENERGIEINHALT_MAX_WERT                   I3_PID_EME_AE_LSC_LADEN_2, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ENERGIEINHALT_MAX_WERT"
+#define I3_FLD_EME_STAT_LADEN_PROGNOSE_REST_WERT                 I3_PID_EME_AE_LSC_LADEN_2, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEN_PROGNOSE_REST_WERT"
+#define I3_FLD_EME_STAT_LADESTECKER_NR                           I3_PID_EME_AE_LSC_LADEN_2, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADESTECKER_NR"
+#define I3_FLD_EME_STAT_LSC_AUSWAHL_LADEN_SOFORT_MODUS           I3_PID_EME_AE_LSC_LADEN_2, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LSC_AUSWAHL_LADEN_SOFORT_MODUS"
+
+// 0xDE71 I3_PID_EME_AE_CHARGE_ENABLE
+#define I3_FLD_EME_STAT_CHARGE_ENABLE_NR                         I3_PID_EME_AE_CHARGE_ENABLE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CHARGE_ENABLE_NR"
+
+// 0xDE74 I3_PID_EME_AE_PARKSPERRE_SENSOREN
+#define I3_FLD_EME_STAT_SENSOR_1_NR                              I3_PID_EME_AE_PARKSPERRE_SENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENSOR_1_NR"
+#define I3_FLD_EME_STAT_SENSOR_2_NR                              I3_PID_EME_AE_PARKSPERRE_SENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENSOR_2_NR"
+
+// 0xDE75 I3_PID_EME_AE_HV_SPANNUNG_LESEN
+#define I3_FLD_EME_STAT_SPANNUNG_HV_SLE_WERT                     I3_PID_EME_AE_HV_SPANNUNG_LESEN, 0, PID_FIELD_UINT16, 0.2f, 0.0f, "STAT_SPANNUNG_HV_SLE_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_HV_SLE_PFC_WERT                 I3_PID_EME_AE_HV_SPANNUNG_LESEN, 2, PID_FIELD_UINT16, 0.2f, 0.0f, "STAT_SPANNUNG_HV_SLE_PFC_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_HV_SLE_AC_WERT                  I3_PID_EME_AE_HV_SPANNUNG_LESEN, 4, PID_FIELD_UINT16, 0.2f, 0.0f, "STAT_SPANNUNG_HV_SLE_AC_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_HV_DCDC_WERT                    I3_PID_EME_AE_HV_SPANNUNG_LESEN, 6, PID_FIELD_UINT16, 0.2f, 0.0f, "STAT_SPANNUNG_HV_DCDC_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_HV_UMRICHTER_WERT               I3_PID_EME_AE_HV_SPANNUNG_LESEN, 8, PID_FIELD_UINT16, 0.2f, 0.0f, "STAT_SPANNUNG_HV_UMRICHTER_WERT"
+
+// 0xDE76 I3_PID_EME_AE_PARKSPERRE_SW
+#define I3_FLD_EME_STAT_PS_SW_NR                                 I3_PID_EME_AE_PARKSPERRE_SW, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PS_SW_NR"
+
+// 0xDE79 I3_PID_EME_AE_PARKSPERRE_POSITION
+#define I3_FLD_EME_STAT_POSITION_PARKSPERRE_NR                   I3_PID_EME_AE_PARKSPERRE_POSITION, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_POSITION_PARKSPERRE_NR"
+
+// 0xDE7B I3_PID_EME_AE_PARKSPERRE_STROM
+#define I3_FLD_EME_STAT_STROM_PARKSPERRE_WERT                    I3_PID_EME_AE_PARKSPERRE_STROM, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STROM_PARKSPERRE_WERT"
+
+// 0xDE7C I3_PID_EME_AE_PARKSPERRE_SPANNUNGEN
+#define I3_FLD_EME_STAT_PS_SPG_HBRUECKE_WERT                     I3_PID_EME_AE_PARKSPERRE_SPANNUNGEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PS_SPG_HBRUECKE_WERT"
+#define I3_FLD_EME_STAT_PS_POSITION_OFFEN_WERT                   I3_PID_EME_AE_PARKSPERRE_SPANNUNGEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PS_POSITION_OFFEN_WERT"
+
+// 0xDE7D I3_PID_EME_AE_ROHSIG_AUSGANG
+#define I3_FLD_EME_STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE1_WERT    I3_PID_EME_AE_ROHSIG_AUSGANG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE1_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE2         I3_PID_EME_AE_ROHSIG_AUSGANG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE2"
+#define I3_FLD_EME_STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE_NOTENTRIEGELUNG I3_PID_EME_AE_ROHSIG_AUSGANG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_PARKSPERRE_NOTENTRIEGELUNG"
+#define I3_FLD_EME_STAT_ROHSIGNAL_ANSTEURUNG_ELUP_NR             I3_PID_EME_AE_ROHSIG_AUSGANG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROHSIGNAL_ANSTEURUNG_ELUP_NR"
+
+// 0xDE7E I3_PID_EME_AE_ROHSIG_EINGANG_SENS_ELUP_BUDS
+#define I3_FLD_EME_STAT_ROHSIGNAL_TEMP_ENDSTUFE_ELUP_WERT        I3_PID_EME_AE_ROHSIG_EINGANG_SENS_ELUP_BUDS, 0, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_ENDSTUFE_ELUP_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_BUDS_WERT                      I3_PID_EME_AE_ROHSIG_EINGANG_SENS_ELUP_BUDS, 4, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_BUDS_WERT"
+
+// 0xDE7F I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV
+#define I3_FLD_EME_STAT_ROHSIGNAL_TEMP_EMASCHINE_STATOR_WERT     I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 0, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_EMASCHINE_STATOR_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_U_WERT    I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 4, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_U_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_V_WERT    I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 8, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_V_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_W_WERT    I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 12, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_TEMP_UMRICHTER_PHASE_W_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_SPANNUNG_HVDC_UMRICHTER_WERT   I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 16, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_SPANNUNG_HVDC_UMRICHTER_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_HVDC_UMRICHTER_WERT      I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 20, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_HVDC_UMRICHTER_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_U_WERT                   I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 24, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_U_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_V_WERT                   I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 28, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_V_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_W_WERT                   I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 32, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_W_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_ROTORLAGESENSOR_WERT           I3_PID_EME_AE_ROHSIG_EINGANG_SENS_EM_INV, 36, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_ROHSIGNAL_ROTORLAGESENSOR_WERT"
+
+// 0xDE80 I3_PID_EME_AE_ROHSIG_EINGANG_SENS_PARKSPERRE
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_PARKSPERRE_WERT          I3_PID_EME_AE_ROHSIG_EINGANG_SENS_PARKSPERRE, 0, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_PARKSPERRE_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_POSITION_PARKSPERRE3_WERT      I3_PID_EME_AE_ROHSIG_EINGANG_SENS_PARKSPERRE, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ROHSIGNAL_POSITION_PARKSPERRE3_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_POSITION_PARKSPERRE4_WERT      I3_PID_EME_AE_ROHSIG_EINGANG_SENS_PARKSPERRE, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ROHSIGNAL_POSITION_PARKSPERRE4_WERT"
+
+// 0xDE81 I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SG
+#define I3_FLD_EME_STAT_ROHSIGNAL_KL30B_WERT                     I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SG, 0, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_KL30B_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_KL15WUO_NR                     I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROHSIGNAL_KL15WUO_NR"
+#define I3_FLD_EME_STAT_ROHSIGNAL_CRASHSIGNAL_NR                 I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SG, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROHSIGNAL_CRASHSIGNAL_NR"
+
+// 0xDE82 I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SLE
+#define I3_FLD_EME_STAT_ROHSIGNAL_SPANNUNG_AC_NETZ_L1_WERT       I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SLE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ROHSIGNAL_SPANNUNG_AC_NETZ_L1_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_PFC_EFF_WERT             I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SLE, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ROHSIGNAL_STROM_PFC_EFF_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_E_S_CHARGE_EN_WERT             I3_PID_EME_AE_ROHSIG_EINGANG_SENS_SLE, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ROHSIGNAL_E_S_CHARGE_EN_WERT"
+
+// 0xDE83 I3_PID_EME_AE_ROHSIG_EINGANG_SENS_DCDC
+#define I3_FLD_EME_STAT_ROHSIGNAL_SPANNUNG_LV_DCDC_WERT          I3_PID_EME_AE_ROHSIG_EINGANG_SENS_DCDC, 0, PID_FIELD_UINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_SPANNUNG_LV_DCDC_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_LV_DCDC_WERT             I3_PID_EME_AE_ROHSIG_EINGANG_SENS_DCDC, 4, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_LV_DCDC_WERT"
+#define I3_FLD_EME_STAT_ROHSIGNAL_STROM_HV_DCDC_WERT             I3_PID_EME_AE_ROHSIG_EINGANG_SENS_DCDC, 8, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_ROHSIGNAL_STROM_HV_DCDC_WERT"
+
+// 0xDE84 I3_PID_EME_AE_BETRIEBSZUSTAND_SLE
+#define I3_FLD_EME_STAT_NETZFREQUENZ_PHASE_1_WERT                I3_PID_EME_AE_BETRIEBSZUSTAND_SLE, 0, PID_FIELD_UINT16, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_1_WERT"
+#define I3_FLD_EME_STAT_LADEDAUER_WERT                           I3_PID_EME_AE_BETRIEBSZUSTAND_SLE, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_WERT"
+#define I3_FLD_EME_STAT_FEHLERZUSTAND_NR                         I3_PID_EME_AE_BETRIEBSZUSTAND_SLE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FEHLERZUSTAND_NR"
+#define I3_FLD_EME_STAT_SLE_DERATING_WERT                        I3_PID_EME_AE_BETRIEBSZUSTAND_SLE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLE_DERATING_WERT"
+#define I3_FLD_EME_STAT_BETRIEBSART_NR                           I3_PID_EME_AE_BETRIEBSZUSTAND_SLE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BETRIEBSART_NR"
+#define I3_FLD_EME_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT             I3_PID_EME_AE_BETRIEBSZUSTAND_SLE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT"
+
+// 0xDE85 I3_PID_EME_AE_SLE_LEISTUNG
+#define I3_FLD_EME_STAT_SLE_DC_HV_LEISTUNG_WERT                  I3_PID_EME_AE_SLE_LEISTUNG, 0, PID_FIELD_UINT16, 1.0f, -30000.0f, "STAT_SLE_DC_HV_LEISTUNG_WERT"
+#define I3_FLD_EME_STAT_SLE_DC_HV_LEISTUNG_MAX_WERT              I3_PID_EME_AE_SLE_LEISTUNG, 2, PID_FIELD_UINT16, 1.0f, -30000.0f, "STAT_SLE_DC_HV_LEISTUNG_MAX_WERT"
+#define I3_FLD_EME_STAT_SLE_AC_WIRKLEISTUNG_WERT                 I3_PID_EME_AE_SLE_LEISTUNG, 4, PID_FIELD_UINT16, 1.0f, -30000.0f, "STAT_SLE_AC_WIRKLEISTUNG_WERT"
+
+// 0xDE86 I3_PID_EME_AE_SLE_SPANNUNG
+#define I3_FLD_EME_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT             I3_PID_EME_AE_SLE_SPANNUNG, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_SLE_DC_HV_WERT                  I3_PID_EME_AE_SLE_SPANNUNG, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_SLE_DC_HV_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_SLE_DC_HV_OBERGRENZE_WERT       I3_PID_EME_AE_SLE_SPANNUNG, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_SLE_DC_HV_OBERGRENZE_WERT"
+
+// 0xDE87 I3_PID_EME_AE_SLE_STROM
+#define I3_FLD_EME_STAT_STROM_TRAFO_WERT                         I3_PID_EME_AE_SLE_STROM, 0, PID_FIELD_UINT16, 0.01f, -100.0f, "STAT_STROM_TRAFO_WERT"
+
+// 0xDE88 I3_PID_EME_AE_SPANNUNG_KLEMME30B
+#define I3_FLD_EME_STAT_SPANNUNG_KL30B_WERT                      I3_PID_EME_AE_SPANNUNG_KLEMME30B, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SPANNUNG_KL30B_WERT"
+
+// 0xDE89 I3_PID_EME_AE_STROM_DCDC
+#define I3_FLD_EME_STAT_STROM_DCDC_WANDLER_HV_WERT               I3_PID_EME_AE_STROM_DCDC, 0, PID_FIELD_UINT16, 0.05f, -100.0f, "STAT_STROM_DCDC_WANDLER_HV_WERT"
+#define I3_FLD_EME_STAT_STROM_DCDC_WANDLER_12V_WERT              I3_PID_EME_AE_STROM_DCDC, 2, PID_FIELD_UINT16, 1.0f, -1000.0f, "STAT_STROM_DCDC_WANDLER_12V_WERT"
+#define I3_FLD_EME_STAT_STROM_DCDC_TS1_WERT                      I3_PID_EME_AE_STROM_DCDC, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STROM_DCDC_TS1_WERT"
+#define I3_FLD_EME_STAT_STROM_DCDC_TS2_WERT                      I3_PID_EME_AE_STROM_DCDC, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STROM_DCDC_TS2_WERT"
+#define I3_FLD_EME_STAT_STROM_DCDC_TRAFO1_WERT                   I3_PID_EME_AE_STROM_DCDC, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STROM_DCDC_TRAFO1_WERT"
+
+// 0xDE8A I3_PID_EME_AE_STROM_EMASCHINE
+#define I3_FLD_EME_STAT_STROM_AC_EFF_W_WERT                      I3_PID_EME_AE_STROM_EMASCHINE, 0, PID_FIELD_SINT16, 0.0625f, 0.0f, "STAT_STROM_AC_EFF_W_WERT"
+#define I3_FLD_EME_STAT_STROM_AC_EFF_V_WERT                      I3_PID_EME_AE_STROM_EMASCHINE, 2, PID_FIELD_SINT16, 0.0625f, 0.0f, "STAT_STROM_AC_EFF_V_WERT"
+#define I3_FLD_EME_STAT_STROM_AC_EFF_U_WERT                      I3_PID_EME_AE_STROM_EMASCHINE, 4, PID_FIELD_SINT16, 0.0625f, 0.0f, "STAT_STROM_AC_EFF_U_WERT"
+#define I3_FLD_EME_STAT_ERREGERSTROM_WERT                        I3_PID_EME_AE_STROM_EMASCHINE, 6, PID_FIELD_SINT16, 0.0625f, 0.0f, "STAT_ERREGERSTROM_WERT"
+#define I3_FLD_EME_STAT_STROM_DC_HV_UMRICHTER_EM_WERT            I3_PID_EME_AE_STROM_EMASCHINE, 8, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_STROM_DC_HV_UMRICHTER_EM_WERT"
+
+// 0xDE8C I3_PID_EME_AE_TEMP_LE
+#define I3_FLD_EME_STAT_TEMP_UMRICHTER_PHASE_U_WERT              I3_PID_EME_AE_TEMP_LE, 0, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_PHASE_U_WERT"
+#define I3_FLD_EME_STAT_TEMP_UMRICHTER_PHASE_V_WERT              I3_PID_EME_AE_TEMP_LE, 2, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_PHASE_V_WERT"
+#define I3_FLD_EME_STAT_TEMP_UMRICHTER_PHASE_W_WERT              I3_PID_EME_AE_TEMP_LE, 4, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_PHASE_W_WERT"
+#define I3_FLD_EME_STAT_TEMP_UMRICHTER_GT_WERT                   I3_PID_EME_AE_TEMP_LE, 6, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_UMRICHTER_GT_WERT"
+#define I3_FLD_EME_STAT_TEMP_DCDC_BO_WERT                        I3_PID_EME_AE_TEMP_LE, 8, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_DCDC_BO_WERT"
+#define I3_FLD_EME_STAT_TEMP_DCDC_GTW_WERT                       I3_PID_EME_AE_TEMP_LE, 10, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_DCDC_GTW_WERT"
+#define I3_FLD_EME_STAT_TEMP_DCDC_TS_WERT                        I3_PID_EME_AE_TEMP_LE, 12, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_DCDC_TS_WERT"
+#define I3_FLD_EME_STAT_TEMP_DCDC_GR_WERT                        I3_PID_EME_AE_TEMP_LE, 14, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_DCDC_GR_WERT"
+#define I3_FLD_EME_STAT_TEMP_SLE_PFC_WERT                        I3_PID_EME_AE_TEMP_LE, 16, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_SLE_PFC_WERT"
+#define I3_FLD_EME_STAT_TEMP_SLE_GR_WERT                         I3_PID_EME_AE_TEMP_LE, 18, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_SLE_GR_WERT"
+#define I3_FLD_EME_STAT_TEMP_SLE_GTW_WERT                        I3_PID_EME_AE_TEMP_LE, 20, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_SLE_GTW_WERT"
+#define I3_FLD_EME_STAT_TEMP_SLE_BO_WERT                         I3_PID_EME_AE_TEMP_LE, 22, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_SLE_BO_WERT"
+#define I3_FLD_EME_STAT_TEMP_ELUP_LE_WERT                        I3_PID_EME_AE_TEMP_LE, 24, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_ELUP_LE_WERT"
+#define I3_FLD_EME_STAT_TEMP_PROZESSOR_MC0_WERT                  I3_PID_EME_AE_TEMP_LE, 26, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_PROZESSOR_MC0_WERT"
+#define I3_FLD_EME_STAT_TEMP_PROZESSOR_MC2_WERT                  I3_PID_EME_AE_TEMP_LE, 28, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP_PROZESSOR_MC2_WERT"
+
+// 0xDE92 I3_PID_EME_AE_ZUSTAND_1_DCDC
+#define I3_FLD_EME_STAT_BETRIEBSART_DCDC_IST                     I3_PID_EME_AE_ZUSTAND_1_DCDC, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BETRIEBSART_DCDC_IST"
+#define I3_FLD_EME_STAT_SPANNUNG_LV_IST_WERT                     I3_PID_EME_AE_ZUSTAND_1_DCDC, 1, PID_FIELD_UINT16, 0.05f, 0.0f, "STAT_SPANNUNG_LV_IST_WERT"
+#define I3_FLD_EME_STAT_AUSLASTUNG_WERT                          I3_PID_EME_AE_ZUSTAND_1_DCDC, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUSLASTUNG_WERT"
+
+// 0xDE96 I3_PID_EME_AE_ZUSTAND_DCDC_FEHLERBILD
+#define I3_FLD_EME_RES_0xDE96_D                                  I3_PID_EME_AE_ZUSTAND_DCDC_FEHLERBILD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0xDE96_D"
+
+// 0xDE9E I3_PID_EME_STATUS_CONNECTED_DRIVE
+#define I3_FLD_EME_STAT_LADEN_NR                                 I3_PID_EME_STATUS_CONNECTED_DRIVE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEN_NR"
+#define I3_FLD_EME_STAT_REMOTE_LADEN_NR                          I3_PID_EME_STATUS_CONNECTED_DRIVE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REMOTE_LADEN_NR"
+#define I3_FLD_EME_STAT_TIMER_LADEN_NR                           I3_PID_EME_STATUS_CONNECTED_DRIVE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TIMER_LADEN_NR"
+#define I3_FLD_EME_STAT_HV_SOC_WERT                              I3_PID_EME_STATUS_CONNECTED_DRIVE, 3, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_HV_SOC_WERT"
+#define I3_FLD_EME_STAT_ZEIT_LADEENDE_WERT                       I3_PID_EME_STATUS_CONNECTED_DRIVE, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZEIT_LADEENDE_WERT"
+#define I3_FLD_EME_STAT_MAX_LADESTROM_LADEGERAET_WERT            I3_PID_EME_STATUS_CONNECTED_DRIVE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MAX_LADESTROM_LADEGERAET_WERT"
+#define I3_FLD_EME_STAT_IST_AC_SPANNUNG_LADEGERAET_WERT          I3_PID_EME_STATUS_CONNECTED_DRIVE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_IST_AC_SPANNUNG_LADEGERAET_WERT"
+#define I3_FLD_EME_STAT_REICHWEITE_WERT                          I3_PID_EME_STATUS_CONNECTED_DRIVE, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REICHWEITE_WERT"
+#define I3_FLD_EME_STAT_HVB_TEMP_WERT                            I3_PID_EME_STATUS_CONNECTED_DRIVE, 10, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_HVB_TEMP_WERT"
+#define I3_FLD_EME_STAT_TRIGGER_SEGMENTSPEICHER_WERT             I3_PID_EME_STATUS_CONNECTED_DRIVE, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRIGGER_SEGMENTSPEICHER_WERT"
+
+// 0xDEA5 I3_PID_EME_AE_BUDS
+#define I3_FLD_EME_STAT_BUDS_WERT                                I3_PID_EME_AE_BUDS, 0, PID_FIELD_UINT8, 4.0f, -1000.0f, "STAT_BUDS_WERT"
+
+// 0xDEA6 I3_PID_EME_AE_TEMP_EMASCHINE
+#define I3_FLD_EME_STAT_TEMP1_E_MOTOR_WERT                       I3_PID_EME_AE_TEMP_EMASCHINE, 0, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP1_E_MOTOR_WERT"
+#define I3_FLD_EME_STAT_TEMP2_E_MOTOR_WERT                       I3_PID_EME_AE_TEMP_EMASCHINE, 2, PID_FIELD_SINT16, 0.0156f, 0.0f, "STAT_TEMP2_E_MOTOR_WERT"
+
+// 0xDEA7 I3_PID_EME_AE_ELEKTRISCHE_MASCHINE
+#define I3_FLD_EME_STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT       I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 0, PID_FIELD_UINT16, 0.5f, -5000.0f, "STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT"
+#define I3_FLD_EME_STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT     I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 2, PID_FIELD_SINT16, 0.5f, 0.0f, "STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT"
+#define I3_FLD_EME_STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT    I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 4, PID_FIELD_SINT16, 0.5f, 0.0f, "STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT"
+#define I3_FLD_EME_STAT_ELEKTRISCHE_BETRIEBSART_NR               I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ELEKTRISCHE_BETRIEBSART_NR"
+
+// 0xDEA9 I3_PID_EME_AE_ZUSTAND_2_DCDC
+#define I3_FLD_EME_RES_0xDEA9_D                                  I3_PID_EME_AE_ZUSTAND_2_DCDC, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0xDEA9_D"
+
+// 0xDEB0 I3_PID_EME_AE_PARKSPERRE_VERSION
+#define I3_FLD_EME_STAT_PS_VERSION_MAIN_WERT                     I3_PID_EME_AE_PARKSPERRE_VERSION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PS_VERSION_MAIN_WERT"
+#define I3_FLD_EME_STAT_PS_VERSION_SUB_WERT                      I3_PID_EME_AE_PARKSPERRE_VERSION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PS_VERSION_SUB_WERT"
+
+// 0xDEBC I3_PID_EME_AE_CTRL_VERSION
+#define I3_FLD_EME_STAT_CTRL_VERSION_WERT                        I3_PID_EME_AE_CTRL_VERSION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CTRL_VERSION_WERT"
+
+// 0xDEBD I3_PID_EME_AE_SPANNUNG_DCDC
+#define I3_FLD_EME_STAT_SPANNUNG_LV_WERT                         I3_PID_EME_AE_SPANNUNG_DCDC, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_LV_WERT"
+
+// 0xDEBE I3_PID_EME_AE_SPANNUNG_LE
+#define I3_FLD_EME_STAT_SPANNUNG_CY0_5V0_WERT                    I3_PID_EME_AE_SPANNUNG_LE, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_CY0_5V0_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_CY2_5V0_WERT                    I3_PID_EME_AE_SPANNUNG_LE, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_CY2_5V0_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_CY0_3V3_WERT                    I3_PID_EME_AE_SPANNUNG_LE, 4, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_CY0_3V3_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_CY2_3V3_WERT                    I3_PID_EME_AE_SPANNUNG_LE, 6, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_CY2_3V3_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_CY0_1V5_WERT                    I3_PID_EME_AE_SPANNUNG_LE, 8, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_CY0_1V5_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_CY2_1V5_WERT                    I3_PID_EME_AE_SPANNUNG_LE, 10, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_CY2_1V5_WERT"
+#define I3_FLD_EME_STAT_SPANNUNG_32V_WERT                        I3_PID_EME_AE_SPANNUNG_LE, 12, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_SPANNUNG_32V_WERT"
+
+// 0xDEBF I3_PID_EME_AE_SYSSTATE
+#define I3_FLD_EME_STAT_SYSSTATE_DPR                             I3_PID_EME_AE_SYSSTATE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SYSSTATE_DPR"
+#define I3_FLD_EME_STAT_SYSSTATE_MC0_NR                          I3_PID_EME_AE_SYSSTATE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SYSSTATE_MC0_NR"
+#define I3_FLD_EME_STAT_SYSSTATE_MC2_NR                          I3_PID_EME_AE_SYSSTATE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SYSSTATE_MC2_NR"
+#define I3_FLD_EME_BF_SYSSTATE_KLEMMEN                           I3_PID_EME_AE_SYSSTATE, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_SYSSTATE_KLEMMEN"
+
+// 0xDEC2 I3_PID_EME_SPANNUNG_ELUP
+#define I3_FLD_EME_STAT_U_ELUP_WERT                              I3_PID_EME_SPANNUNG_ELUP, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_U_ELUP_WERT"
+
+// 0xDEC3 I3_PID_EME_STROM_ELUP
+#define I3_FLD_EME_STAT_I_ELUP_WERT                              I3_PID_EME_STROM_ELUP, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_I_ELUP_WERT"
+
+// 0xDEDD I3_PID_EME_AE_FAHRSTUFE
+#define I3_FLD_EME_STAT_POS_PRND_NR                              I3_PID_EME_AE_FAHRSTUFE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POS_PRND_NR"
+
+// 0xDEDE I3_PID_EME_AE_LSC_LADEN
+#define I3_FLD_EME_STAT_LADEVERFAHREN_NR_0XDEDE                  I3_PID_EME_AE_LSC_LADEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEVERFAHREN_NR_0XDEDE"
+#define I3_FLD_EME_STAT_LADESTATUS_NR_0XDEDE                     I3_PID_EME_AE_LSC_LADEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADESTATUS_NR_0XDEDE"
+#define I3_FLD_EME_STAT_BEGINN_FENSTER_STD_WERT_0XDEDE           I3_PID_EME_AE_LSC_LADEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEGINN_FENSTER_STD_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_BEGINN_FENSTER_MIN_WERT_0XDEDE           I3_PID_EME_AE_LSC_LADEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEGINN_FENSTER_MIN_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_ENDE_FENSTER_STD_WERT_0XDEDE             I3_PID_EME_AE_LSC_LADEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENDE_FENSTER_STD_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_ENDE_FENSTER_MIN_WERT_0XDEDE             I3_PID_EME_AE_LSC_LADEN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENDE_FENSTER_MIN_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LADEFENSTER1_AUSWAHL_NR_0XDEDE           I3_PID_EME_AE_LSC_LADEN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEFENSTER1_AUSWAHL_NR_0XDEDE"
+#define I3_FLD_EME_STAT_LADEFENSTER2_AUSWAHL_NR_0XDEDE           I3_PID_EME_AE_LSC_LADEN, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEFENSTER2_AUSWAHL_NR_0XDEDE"
+#define I3_FLD_EME_STAT_FAKTOR_STROMBEGRENZUNG_NR_0XDEDE         I3_PID_EME_AE_LSC_LADEN, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKTOR_STROMBEGRENZUNG_NR_0XDEDE"
+#define I3_FLD_EME_STAT_STROMBEGRENZUNG_AUSWAHL_NR_0XDEDE        I3_PID_EME_AE_LSC_LADEN, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STROMBEGRENZUNG_AUSWAHL_NR_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_TIM_1_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 10, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_1_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_SOC_1_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 11, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_1_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_TIM_2_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 13, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_2_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_SOC_2_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 14, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_2_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_TIM_3_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 16, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_3_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_SOC_3_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 17, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_3_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_TIM_4_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 19, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_4_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_SOC_4_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 20, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_4_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_TIM_5_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 22, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_POLY_TIM_5_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_POLY_SOC_5_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 23, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_POLY_SOC_5_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_HV_SOC_IST_WERT_0XDEDE                   I3_PID_EME_AE_LSC_LADEN, 25, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HV_SOC_IST_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LADEN_PROGNOSE_WERT_0XDEDE               I3_PID_EME_AE_LSC_LADEN, 27, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_LADEN_PROGNOSE_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LADEN_SPANNUNG_WERT_0XDEDE               I3_PID_EME_AE_LSC_LADEN, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEN_SPANNUNG_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LADEN_STROM_WERT_0XDEDE                  I3_PID_EME_AE_LSC_LADEN, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEN_STROM_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_ENERGIEINHALT_IST_WERT_0XDEDE            I3_PID_EME_AE_LSC_LADEN, 30, PID_FIELD_UINT32, 3600.0f, 0.0f, "STAT_ENERGIEINHALT_IST_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LSC_TRIGGER_INHALT_NR_0XDEDE             I3_PID_EME_AE_LSC_LADEN, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LSC_TRIGGER_INHALT_NR_0XDEDE"
+#define I3_FLD_EME_STAT_ENERGIEINHALT_MAX_WERT_0XDEDE            I3_PID_EME_AE_LSC_LADEN, 35, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ENERGIEINHALT_MAX_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LADEN_PROGNOSE_REST_WERT_0XDEDE          I3_PID_EME_AE_LSC_LADEN, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEN_PROGNOSE_REST_WERT_0XDEDE"
+#define I3_FLD_EME_STAT_LADESTECKER_NR_0XDEDE                    I3_PID_EME_AE_LSC_LADEN, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADESTECKER_NR_0XDEDE"
+
+// 0xDEED I3_PID_EME_HISTOGRAMM_ANTRIEB
+#define I3_FLD_EME_STAT_ANTR_HIST_010_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_010_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_011_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_011_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_012_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_012_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_013_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_013_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_014_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_014_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_015_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_015_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_016_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_016_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_017_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_017_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_018_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_018_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_019_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_019_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_020_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_020_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_021_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_021_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_022_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_022_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_023_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_023_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_024_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_024_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_025_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_025_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_026_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 64, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_026_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_027_WERT                       I3_PID_EME_HISTOGRAMM_ANTRIEB, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_027_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_1601_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 72, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_1601_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_1602_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 76, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_1602_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_1603_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 80, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_1603_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_1604_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 84, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_1604_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_1605_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 88, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_1605_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_1606_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 92, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANTR_HIST_1606_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3214_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 96, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3214_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3215_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 100, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3215_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3216_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 104, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3216_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3217_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 108, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3217_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3218_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 112, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3218_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3219_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 116, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3219_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3220_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 120, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3220_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3221_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 124, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3221_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3278_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 128, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3278_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3279_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 132, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3279_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3280_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 136, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3280_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3281_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 140, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3281_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3282_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 144, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3282_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3283_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 148, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3283_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3284_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 152, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3284_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3285_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 156, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3285_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3286_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 160, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3286_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3287_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 164, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3287_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3288_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 168, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3288_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3289_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 172, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3289_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3290_WERT                      I3_PID_EME_HISTOGRAMM_ANTRIEB, 176, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3290_WERT"
+
+// 0xDEEF I3_PID_EME_HISTOGRAMM_DEGRADATION
+#define I3_FLD_EME_STAT_ANTR_HIST_3238_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3238_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3239_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3239_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3240_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 8, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3240_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3241_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 12, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3241_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3242_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 16, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3242_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3243_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 20, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3243_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3244_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 24, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3244_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3245_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 28, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3245_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3246_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 32, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3246_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3247_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 36, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3247_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3248_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 40, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3248_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3249_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 44, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3249_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3250_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 48, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3250_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3251_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 52, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3251_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3252_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 56, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3252_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3253_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 60, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3253_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3254_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 64, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3254_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3255_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 68, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3255_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3256_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 72, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3256_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3257_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 76, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3257_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3258_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 80, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3258_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3259_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 84, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3259_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3260_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 88, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3260_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3261_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 92, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3261_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3262_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 96, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3262_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3263_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 100, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3263_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3264_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 104, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3264_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3265_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 108, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3265_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3266_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 112, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3266_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3267_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 116, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3267_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3268_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 120, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3268_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3269_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 124, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3269_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3270_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 128, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3270_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3271_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 132, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3271_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3272_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 136, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3272_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3273_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 140, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3273_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3274_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 144, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3274_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3275_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 148, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3275_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3276_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 152, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3276_WERT"
+#define I3_FLD_EME_STAT_ANTR_HIST_3277_WERT                      I3_PID_EME_HISTOGRAMM_DEGRADATION, 156, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ANTR_HIST_3277_WERT"
+
+// 0xDEFB I3_PID_EME_AUTOP_SBW
+#define I3_FLD_EME_STAT_COUNT_AUTOP_LVEH_WERT                    I3_PID_EME_AUTOP_SBW, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COUNT_AUTOP_LVEH_WERT"
+#define I3_FLD_EME_STAT_COUNT_AUTOP_EMF_N_WERT                   I3_PID_EME_AUTOP_SBW, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COUNT_AUTOP_EMF_N_WERT"
+#define I3_FLD_EME_STAT_COUNT_AUTOP_EMF_DR_WERT                  I3_PID_EME_AUTOP_SBW, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COUNT_AUTOP_EMF_DR_WERT"
+#define I3_FLD_EME_STAT_COUNT_AUTOP_FB_WERT                      I3_PID_EME_AUTOP_SBW, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COUNT_AUTOP_FB_WERT"
+#define I3_FLD_EME_STAT_COUNT_AUTOP_KL15_WERT                    I3_PID_EME_AUTOP_SBW, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COUNT_AUTOP_KL15_WERT"
+#define I3_FLD_EME_STAT_COUNT_AUTOP_CHRGWIRE_WERT                I3_PID_EME_AUTOP_SBW, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COUNT_AUTOP_CHRGWIRE_WERT"
+
+// 0xDEFF I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_P_NACH_R_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_P_NACH_R_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_P_NACH_N_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_P_NACH_N_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_P_NACH_D_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_P_NACH_D_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_R_NACH_P_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_R_NACH_P_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_R_NACH_N_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_R_NACH_N_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_R_NACH_D_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_R_NACH_D_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_N_NACH_P_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_N_NACH_P_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_N_NACH_R_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_N_NACH_R_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_N_NACH_D_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_N_NACH_D_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_D_NACH_P_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_D_NACH_P_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_D_NACH_R_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_D_NACH_R_WERT"
+#define I3_FLD_EME_STAT_ZAEHLER_WECHSEL_D_NACH_N_WERT            I3_PID_EME_FAHRSTUFEN_ZAEHLER_SBW, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_WECHSEL_D_NACH_N_WERT"
+
+// 0xDF49 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_INT_1_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_1_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_INT_2_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_2_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_INT_3_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_3_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_INT_4_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_4_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_INT_5_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_5_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_INT_6_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_INT_6_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_INT_1_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_INT_1_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_INT_2_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_INT_2_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_INT_3_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_INT_3_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_INT_4_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_INT_4_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_INT_5_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_INT_5_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_INT_6_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_INT_6_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_EXT_1_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_1_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_EXT_2_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_2_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_EXT_3_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_3_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_EXT_4_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_4_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_EXT_5_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 64, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_5_WERT"
+#define I3_FLD_EME_STAT_LEISTUNG_HIST_EXT_6_WERT                 I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LEISTUNG_HIST_EXT_6_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_EXT_1_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 72, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_1_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_EXT_2_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 76, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_2_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_EXT_3_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 80, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_3_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_EXT_4_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 84, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_4_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_EXT_5_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 88, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_5_WERT"
+#define I3_FLD_EME_STAT_TEMP_HIST_EXT_6_WERT                     I3_PID_EME_HISTOGRAMM_LADEKOORDINATOR, 92, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_HIST_EXT_6_WERT"
+
+// 0xDF4D I3_PID_EME_INVERTER_HISTOGRAMM
+#define I3_FLD_EME_STAT_INVERTER_IGBT_LEBENSZEIT_WERT            I3_PID_EME_INVERTER_HISTOGRAMM, 0, PID_FIELD_UINT8, 1.0f, -10.0f, "STAT_INVERTER_IGBT_LEBENSZEIT_WERT"
+#define I3_FLD_EME_STAT_INVERTER_IGBT_LEBENSZEIT_KONST_KUEHLUNG_WERT I3_PID_EME_INVERTER_HISTOGRAMM, 1, PID_FIELD_UINT8, 1.0f, -10.0f, "STAT_INVERTER_IGBT_LEBENSZEIT_KONST_KUEHLUNG_WERT"
+#define I3_FLD_EME_STAT_INVERTER_DIODE_LEBENSZEIT_WERT           I3_PID_EME_INVERTER_HISTOGRAMM, 2, PID_FIELD_UINT8, 1.0f, -10.0f, "STAT_INVERTER_DIODE_LEBENSZEIT_WERT"
+#define I3_FLD_EME_STAT_INVERTER_DIODE_LEBENSZEIT_KONST_KUEHLUNG_WERT I3_PID_EME_INVERTER_HISTOGRAMM, 3, PID_FIELD_UINT8, 1.0f, -10.0f, "STAT_INVERTER_DIODE_LEBENSZEIT_KONST_KUEHLUNG_WERT"
+#define I3_FLD_EME_STAT_INVERTER_RESET_LEBENSZEIT_WERT           I3_PID_EME_INVERTER_HISTOGRAMM, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INVERTER_RESET_LEBENSZEIT_WERT"
+
+// 0xDF58 I3_PID_EME_INVERTER_RBM_INFO
+#define I3_FLD_EME_STAT_SAE_DTC1_WERT                            I3_PID_EME_INVERTER_RBM_INFO, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC1_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM1_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM1_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN1_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN1_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC2_WERT                            I3_PID_EME_INVERTER_RBM_INFO, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC2_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM2_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM2_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN2_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN2_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC3_WERT                            I3_PID_EME_INVERTER_RBM_INFO, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC3_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM3_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM3_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN3_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN3_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC4_WERT                            I3_PID_EME_INVERTER_RBM_INFO, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC4_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM4_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM4_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN4_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN4_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC5_WERT                            I3_PID_EME_INVERTER_RBM_INFO, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC5_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM5_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM5_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN5_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN5_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC6_WERT                            I3_PID_EME_INVERTER_RBM_INFO, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC6_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM6_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM6_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN6_WERT                        I3_PID_EME_INVERTER_RBM_INFO, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN6_WERT"
+
+// 0xDF59 I3_PID_EME_DCDC_RBM_INFO
+#define I3_FLD_EME_STAT_SAE_DTC1_WERT_0XDF59                     I3_PID_EME_DCDC_RBM_INFO, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC1_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM1_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM1_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN1_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN1_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC2_WERT_0XDF59                     I3_PID_EME_DCDC_RBM_INFO, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC2_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM2_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM2_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN2_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN2_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC3_WERT_0XDF59                     I3_PID_EME_DCDC_RBM_INFO, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC3_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM3_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM3_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN3_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN3_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC4_WERT_0XDF59                     I3_PID_EME_DCDC_RBM_INFO, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC4_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM4_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM4_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN4_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN4_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC5_WERT_0XDF59                     I3_PID_EME_DCDC_RBM_INFO, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC5_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM5_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM5_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN5_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN5_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC6_WERT_0XDF59                     I3_PID_EME_DCDC_RBM_INFO, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC6_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM6_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM6_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN6_WERT_0XDF59                 I3_PID_EME_DCDC_RBM_INFO, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN6_WERT_0XDF59"
+#define I3_FLD_EME_STAT_SAE_DTC7_WERT                            I3_PID_EME_DCDC_RBM_INFO, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC7_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM7_WERT                        I3_PID_EME_DCDC_RBM_INFO, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM7_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN7_WERT                        I3_PID_EME_DCDC_RBM_INFO, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN7_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC8_WERT                            I3_PID_EME_DCDC_RBM_INFO, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC8_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM8_WERT                        I3_PID_EME_DCDC_RBM_INFO, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM8_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN8_WERT                        I3_PID_EME_DCDC_RBM_INFO, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN8_WERT"
+
+// 0xDF5A I3_PID_EME_LADEGERAET_RBM_INFO
+#define I3_FLD_EME_STAT_SAE_DTC1_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC1_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM1_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM1_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN1_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN1_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC2_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC2_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM2_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM2_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN2_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN2_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC3_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC3_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM3_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM3_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN3_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN3_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC4_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC4_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM4_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM4_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN4_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN4_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC5_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC5_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM5_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM5_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN5_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN5_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC6_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC6_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM6_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM6_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN6_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN6_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC7_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC7_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM7_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM7_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN7_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN7_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC8_WERT_0XDF5A                     I3_PID_EME_LADEGERAET_RBM_INFO, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC8_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM8_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM8_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN8_WERT_0XDF5A                 I3_PID_EME_LADEGERAET_RBM_INFO, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN8_WERT_0XDF5A"
+#define I3_FLD_EME_STAT_SAE_DTC9_WERT                            I3_PID_EME_LADEGERAET_RBM_INFO, 64, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC9_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM9_WERT                        I3_PID_EME_LADEGERAET_RBM_INFO, 68, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM9_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN9_WERT                        I3_PID_EME_LADEGERAET_RBM_INFO, 70, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN9_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC10_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 72, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC10_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM10_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 76, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM10_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN10_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 78, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN10_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC11_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 80, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC11_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM11_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 84, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM11_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN11_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 86, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN11_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC12_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 88, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC12_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM12_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 92, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM12_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN12_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 94, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN12_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC13_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 96, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC13_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM13_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 100, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM13_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN13_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 102, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN13_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC14_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 104, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC14_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM14_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 108, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM14_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN14_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 110, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN14_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC15_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 112, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC15_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM15_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 116, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM15_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN15_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 118, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN15_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC16_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 120, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC16_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM16_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 124, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM16_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN16_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 126, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN16_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC17_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 128, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC17_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM17_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 132, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM17_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN17_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 134, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN17_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC18_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 136, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC18_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM18_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 140, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM18_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN18_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 142, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN18_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC19_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 144, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC19_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM19_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 148, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM19_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN19_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 150, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN19_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC20_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 152, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC20_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM20_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 156, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM20_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN20_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 158, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN20_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC21_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 160, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC21_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM21_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 164, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM21_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN21_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 166, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN21_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC22_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 168, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC22_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM22_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 172, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM22_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN22_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 174, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN22_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC23_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 176, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC23_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM23_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 180, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM23_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN23_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 182, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN23_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC24_WERT                           I3_PID_EME_LADEGERAET_RBM_INFO, 184, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SAE_DTC24_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_NUM24_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 188, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_NUM24_WERT"
+#define I3_FLD_EME_STAT_SAE_DTC_DEN24_WERT                       I3_PID_EME_LADEGERAET_RBM_INFO, 190, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SAE_DTC_DEN24_WERT"
+
+// 0xDF5B I3_PID_EME_LIEFERANT_TRACE_NUMMER
+
+// 0xDFB5 I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM
+#define I3_FLD_EME_STAT_TEMP_LLCHVFIL_1_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_1_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCHVFIL_2_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_2_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCHVFIL_3_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_3_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCHVFIL_4_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_4_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCHVFIL_5_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_5_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCHVFIL_6_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCHVFIL_6_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCTRAFIL_1_WERT                    I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_1_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCTRAFIL_2_WERT                    I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_2_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCTRAFIL_3_WERT                    I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_3_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCTRAFIL_4_WERT                    I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_4_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCTRAFIL_5_WERT                    I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_5_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCTRAFIL_6_WERT                    I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCTRAFIL_6_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCZKFIL_1_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_1_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCZKFIL_2_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_2_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCZKFIL_3_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_3_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCZKFIL_4_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_4_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCZKFIL_5_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 64, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_5_WERT"
+#define I3_FLD_EME_STAT_TEMP_LLCZKFIL_6_WERT                     I3_PID_EME_LADEGERAET_TEMPERATUR_HISTOGRAMM, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_LLCZKFIL_6_WERT"
+
+// 0xDFB7 I3_PID_EME_LADEGERAET_HV_UEBERSTROM
+#define I3_FLD_EME_STAT_ZAEHLER_HV_UEBERSTROM_WERT               I3_PID_EME_LADEGERAET_HV_UEBERSTROM, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZAEHLER_HV_UEBERSTROM_WERT"
+
+// 0xDFCE I3_PID_EME_EMASCHINE_MAX_DREHZAHL
+#define I3_FLD_EME_STAT_DREHZAHL_BEREICH_1_WERT                  I3_PID_EME_EMASCHINE_MAX_DREHZAHL, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DREHZAHL_BEREICH_1_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_BEREICH_2_WERT                  I3_PID_EME_EMASCHINE_MAX_DREHZAHL, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DREHZAHL_BEREICH_2_WERT"
+
+// 0xDFD0 I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_1_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 0, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_1_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_2_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 2, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_2_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_3_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 4, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_3_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_4_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 6, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_4_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_5_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 8, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_5_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_6_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 10, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_6_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_7_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 12, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_7_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_8_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 14, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_8_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_9_WERT       I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 16, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_9_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_10_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 18, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_10_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_11_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 20, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_11_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_12_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 22, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_12_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_13_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 24, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_13_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_14_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 26, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_14_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_15_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 28, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_15_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_16_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 30, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_16_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_17_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 32, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_17_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_18_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 34, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_18_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_19_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 36, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_19_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_20_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 38, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_20_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_21_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 40, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_21_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_22_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 42, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_22_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_23_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 44, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_23_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_24_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 46, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_24_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_25_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 48, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_25_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_26_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 50, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_26_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_27_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 52, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_27_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_28_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 54, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_28_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_29_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 56, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_29_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_30_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 58, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_30_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_31_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 60, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_31_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_32_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 62, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_32_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_33_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 64, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_33_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_34_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 66, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_34_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_35_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 68, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_35_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_36_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 70, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_36_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_37_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 72, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_37_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_38_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 74, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_38_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_39_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 76, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_39_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_40_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 78, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_40_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_41_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 80, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_41_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_42_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 82, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_42_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_43_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 84, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_43_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_44_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 86, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_44_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_45_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 88, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_45_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_46_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 90, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_46_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_47_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 92, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_47_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_48_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 94, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_48_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_49_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 96, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_49_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_50_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 98, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_50_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_51_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 100, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_51_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_52_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 102, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_52_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_53_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 104, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_53_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_54_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 106, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_54_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_55_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 108, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_55_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_56_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 110, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_56_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_57_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 112, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_57_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_58_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 114, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_58_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_59_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 116, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_59_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_60_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 118, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_60_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_61_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 120, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_61_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_62_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 122, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_62_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_63_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 124, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_63_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_64_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 126, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_64_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_65_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 128, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_65_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_66_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 130, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_66_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_67_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 132, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_67_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_68_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 134, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_68_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_69_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 136, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_69_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_70_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 138, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_70_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_71_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 140, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_71_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_72_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 142, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_72_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_73_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 144, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_73_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_74_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 146, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_74_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_75_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 148, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_75_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_76_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 150, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_76_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_77_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 152, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_77_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_78_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 154, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_78_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_79_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 156, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_79_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_80_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 158, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_80_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_81_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 160, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_81_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_82_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 162, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_82_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_83_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 164, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_83_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_84_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 166, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_84_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_85_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 168, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_85_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_86_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 170, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_86_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_87_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 172, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_87_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_88_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 174, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_88_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_89_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 176, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_89_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_90_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 178, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_90_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_91_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 180, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_91_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_92_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 182, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_92_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_93_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 184, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_93_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_94_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 186, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_94_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_95_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 188, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_95_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_96_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 190, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_96_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_97_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 192, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_97_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_98_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 194, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_98_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_99_WERT      I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 196, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_99_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_100_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 198, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_100_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_101_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 200, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_101_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_102_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 202, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_102_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_103_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 204, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_103_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_104_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 206, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_104_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_105_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 208, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_105_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_106_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 210, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_106_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_107_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 212, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_107_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_108_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 214, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_108_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_109_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 216, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_109_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_110_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 218, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_110_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_111_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 220, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_111_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_112_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 222, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_112_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_113_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 224, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_113_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_114_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 226, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_114_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_115_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 228, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_115_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_116_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 230, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_116_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_117_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 232, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_117_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_118_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 234, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_118_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_119_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 236, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_119_WERT"
+#define I3_FLD_EME_STAT_DREHZAHL_DREHMOMENT_BEREICH_120_WERT     I3_PID_EME_LAST_HISTOGRAMM_EMASCHINE_LESEN, 238, PID_FIELD_UINT16, 0.002f, 0.0f, "STAT_DREHZAHL_DREHMOMENT_BEREICH_120_WERT"
+
+// 0xE52F I3_PID_EME_RATE_BASED_MONITORING
+#define I3_FLD_EME_STAT_DTC_1_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_1_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_1_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_1_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_2_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_2_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_2_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_2_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_3_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_3_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_3_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_3_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_4_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_4_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_4_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_4_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_5_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 31, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_5_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_5_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 33, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_5_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_6_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_6_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_6_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_6_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_7_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 45, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_7_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_7_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 47, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_7_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_8_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_8_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_8_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_8_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_9_NUM_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_9_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_9_DEN_WERT                           I3_PID_EME_RATE_BASED_MONITORING, 61, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_9_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_10_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 66, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_10_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_10_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 68, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_10_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_11_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 73, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_11_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_11_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 75, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_11_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_12_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 80, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_12_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_12_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 82, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_12_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_13_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 87, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_13_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_13_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 89, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_13_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_14_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 94, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_14_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_14_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 96, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_14_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_15_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 101, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_15_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_15_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 103, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_15_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_16_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 108, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_16_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_16_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 110, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_16_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_17_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 115, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_17_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_17_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 117, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_17_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_18_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 122, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_18_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_18_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 124, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_18_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_19_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 129, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_19_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_19_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 131, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_19_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_20_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 136, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_20_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_20_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 138, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_20_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_21_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 143, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_21_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_21_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 145, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_21_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_22_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 150, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_22_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_22_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 152, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_22_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_23_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 157, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_23_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_23_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 159, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_23_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_24_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 164, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_24_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_24_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 166, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_24_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_25_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 171, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_25_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_25_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 173, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_25_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_26_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 178, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_26_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_26_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 180, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_26_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_27_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 185, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_27_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_27_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 187, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_27_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_28_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 192, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_28_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_28_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 194, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_28_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_29_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 199, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_29_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_29_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 201, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_29_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_30_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 206, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_30_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_30_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 208, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_30_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_31_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 213, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_31_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_31_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 215, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_31_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_32_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 220, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_32_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_32_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 222, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_32_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_33_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 227, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_33_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_33_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 229, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_33_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_34_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 234, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_34_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_34_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 236, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_34_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_35_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 241, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_35_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_35_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 243, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_35_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_36_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 248, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_36_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_36_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 250, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_36_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_37_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 255, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_37_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_37_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 257, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_37_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_38_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 262, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_38_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_38_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 264, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_38_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_39_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 269, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_39_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_39_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 271, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_39_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_40_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 276, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_40_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_40_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 278, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_40_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_41_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 283, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_41_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_41_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 285, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_41_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_42_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 290, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_42_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_42_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 292, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_42_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_43_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 297, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_43_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_43_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 299, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_43_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_44_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 304, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_44_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_44_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 306, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_44_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_45_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 311, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_45_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_45_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 313, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_45_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_46_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 318, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_46_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_46_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 320, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_46_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_47_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 325, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_47_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_47_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 327, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_47_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_48_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 332, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_48_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_48_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 334, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_48_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_49_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 339, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_49_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_49_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 341, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_49_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_50_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 346, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_50_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_50_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 348, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_50_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_51_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 353, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_51_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_51_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 355, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_51_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_52_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 360, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_52_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_52_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 362, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_52_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_53_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 367, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_53_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_53_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 369, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_53_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_54_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 374, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_54_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_54_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 376, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_54_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_55_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 381, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_55_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_55_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 383, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_55_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_56_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 388, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_56_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_56_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 390, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_56_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_57_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 395, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_57_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_57_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 397, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_57_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_58_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 402, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_58_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_58_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 404, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_58_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_59_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 409, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_59_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_59_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 411, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_59_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_60_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 416, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_60_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_60_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 418, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_60_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_61_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 423, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_61_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_61_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 425, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_61_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_62_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 430, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_62_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_62_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 432, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_62_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_63_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 437, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_63_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_63_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 439, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_63_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_64_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 444, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_64_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_64_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 446, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_64_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_65_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 451, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_65_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_65_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 453, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_65_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_66_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 458, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_66_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_66_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 460, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_66_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_67_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 465, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_67_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_67_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 467, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_67_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_68_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 472, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_68_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_68_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 474, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_68_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_69_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 479, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_69_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_69_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 481, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_69_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_70_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 486, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_70_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_70_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 488, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_70_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_71_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 493, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_71_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_71_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 495, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_71_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_72_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 500, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_72_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_72_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 502, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_72_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_73_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 507, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_73_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_73_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 509, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_73_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_74_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 514, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_74_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_74_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 516, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_74_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_75_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 521, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_75_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_75_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 523, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_75_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_76_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 528, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_76_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_76_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 530, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_76_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_77_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 535, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_77_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_77_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 537, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_77_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_78_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 542, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_78_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_78_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 544, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_78_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_79_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 549, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_79_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_79_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 551, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_79_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_80_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 556, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_80_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_80_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 558, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_80_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_81_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 563, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_81_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_81_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 565, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_81_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_82_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 570, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_82_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_82_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 572, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_82_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_83_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 577, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_83_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_83_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 579, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_83_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_84_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 584, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_84_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_84_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 586, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_84_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_85_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 591, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_85_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_85_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 593, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_85_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_86_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 598, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_86_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_86_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 600, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_86_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_87_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 605, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_87_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_87_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 607, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_87_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_88_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 612, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_88_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_88_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 614, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_88_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_89_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 619, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_89_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_89_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 621, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_89_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_90_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 626, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_90_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_90_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 628, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_90_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_91_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 633, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_91_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_91_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 635, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_91_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_92_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 640, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_92_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_92_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 642, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_92_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_93_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 647, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_93_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_93_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 649, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_93_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_94_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 654, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_94_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_94_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 656, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_94_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_95_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 661, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_95_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_95_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 663, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_95_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_96_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 668, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_96_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_96_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 670, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_96_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_97_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 675, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_97_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_97_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 677, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_97_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_98_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 682, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_98_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_98_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 684, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_98_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_99_NUM_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 689, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_99_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_99_DEN_WERT                          I3_PID_EME_RATE_BASED_MONITORING, 691, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_99_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_100_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 696, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_100_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_100_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 698, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_100_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_101_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 703, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_101_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_101_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 705, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_101_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_102_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 710, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_102_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_102_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 712, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_102_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_103_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 717, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_103_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_103_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 719, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_103_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_104_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 724, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_104_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_104_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 726, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_104_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_105_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 731, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_105_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_105_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 733, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_105_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_106_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 738, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_106_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_106_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 740, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_106_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_107_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 745, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_107_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_107_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 747, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_107_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_108_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 752, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_108_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_108_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 754, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_108_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_109_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 759, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_109_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_109_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 761, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_109_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_110_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 766, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_110_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_110_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 768, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_110_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_111_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 773, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_111_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_111_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 775, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_111_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_112_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 780, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_112_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_112_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 782, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_112_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_113_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 787, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_113_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_113_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 789, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_113_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_114_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 794, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_114_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_114_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 796, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_114_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_115_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 801, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_115_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_115_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 803, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_115_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_116_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 808, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_116_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_116_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 810, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_116_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_117_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 815, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_117_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_117_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 817, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_117_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_118_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 822, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_118_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_118_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 824, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_118_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_119_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 829, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_119_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_119_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 831, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_119_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_120_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 836, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_120_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_120_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 838, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_120_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_121_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 843, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_121_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_121_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 845, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_121_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_122_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 850, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_122_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_122_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 852, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_122_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_123_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 857, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_123_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_123_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 859, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_123_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_124_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 864, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_124_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_124_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 866, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_124_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_125_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 871, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_125_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_125_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 873, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_125_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_126_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 878, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_126_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_126_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 880, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_126_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_127_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 885, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_127_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_127_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 887, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_127_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_128_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 892, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_128_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_128_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 894, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_128_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_129_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 899, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_129_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_129_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 901, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_129_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_130_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 906, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_130_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_130_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 908, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_130_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_131_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 913, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_131_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_131_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 915, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_131_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_132_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 920, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_132_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_132_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 922, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_132_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_133_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 927, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_133_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_133_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 929, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_133_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_134_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 934, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_134_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_134_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 936, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_134_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_135_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 941, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_135_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_135_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 943, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_135_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_136_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 948, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_136_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_136_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 950, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_136_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_137_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 955, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_137_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_137_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 957, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_137_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_138_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 962, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_138_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_138_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 964, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_138_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_139_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 969, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_139_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_139_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 971, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_139_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_140_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 976, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_140_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_140_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 978, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_140_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_141_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 983, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_141_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_141_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 985, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_141_DEN_WERT"
+#define I3_FLD_EME_STAT_DTC_142_NUM_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 990, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_142_NUM_WERT"
+#define I3_FLD_EME_STAT_DTC_142_DEN_WERT                         I3_PID_EME_RATE_BASED_MONITORING, 992, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DTC_142_DEN_WERT"
+
+// 0xE5FE I3_PID_EME_LADEKOORDINATOR_INTERFACE
+#define I3_FLD_EME_STAT_TAR_OPMO_CHGE_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAR_OPMO_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_OPMOCHGE_WERT                        I3_PID_EME_LADEKOORDINATOR_INTERFACE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_OPMOCHGE_WERT"
+#define I3_FLD_EME_STAT_TAR_OPMO_INTLE_WERT                      I3_PID_EME_LADEKOORDINATOR_INTERFACE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAR_OPMO_INTLE_WERT"
+#define I3_FLD_EME_STAT_AVL_OPMO_INTLE_WERT                      I3_PID_EME_LADEKOORDINATOR_INTERFACE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_OPMO_INTLE_WERT"
+#define I3_FLD_EME_STAT_TAR_OPMO_CF_CHGE_WERT                    I3_PID_EME_LADEKOORDINATOR_INTERFACE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAR_OPMO_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_OPMO_CF_CHGE_WERT                    I3_PID_EME_LADEKOORDINATOR_INTERFACE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_OPMO_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_TAR_CHG_MOD_CF_CHGE_WERT                 I3_PID_EME_LADEKOORDINATOR_INTERFACE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAR_CHG_MOD_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_CHG_MOD_CF_CHGE_WERT                 I3_PID_EME_LADEKOORDINATOR_INTERFACE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_CHG_MOD_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_TAR_PWR_CHGNG_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TAR_PWR_CHGNG_WERT"
+#define I3_FLD_EME_STAT_AVL_PWR_CHGNG_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_AVL_PWR_CHGNG_WERT"
+#define I3_FLD_EME_STAT_TAR_PWR_INTLE_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_TAR_PWR_INTLE_WERT"
+#define I3_FLD_EME_STAT_AVL_PWR_INTLE_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_AVL_PWR_INTLE_WERT"
+#define I3_FLD_EME_STAT_TAR_PWR_CF_CHGE_WERT                     I3_PID_EME_LADEKOORDINATOR_INTERFACE, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TAR_PWR_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_PWR_CF_CHGE_WERT                     I3_PID_EME_LADEKOORDINATOR_INTERFACE, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AVL_PWR_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_SPEC_I_MAX_ALTC_CHGE_WERT                I3_PID_EME_LADEKOORDINATOR_INTERFACE, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_SPEC_I_MAX_ALTC_CHGE_WERT"
+#define I3_FLD_EME_STAT_SPEC_I_MAX_ALTC_CF_CHGE_WERT             I3_PID_EME_LADEKOORDINATOR_INTERFACE, 32, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPEC_I_MAX_ALTC_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_SPEC_I_MAX_DC_CHGE_WERT                  I3_PID_EME_LADEKOORDINATOR_INTERFACE, 34, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_SPEC_I_MAX_DC_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_I_CHGE_WERT                          I3_PID_EME_LADEKOORDINATOR_INTERFACE, 38, PID_FIELD_SINT16, 0.1f, -204.7f, "STAT_AVL_I_CHGE_WERT"
+#define I3_FLD_EME_STAT_SPEC_I_MAX_DC_INTLE_WERT                 I3_PID_EME_LADEKOORDINATOR_INTERFACE, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_SPEC_I_MAX_DC_INTLE_WERT"
+#define I3_FLD_EME_STAT_AVL_I_INTLE_WERT                         I3_PID_EME_LADEKOORDINATOR_INTERFACE, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_AVL_I_INTLE_WERT"
+#define I3_FLD_EME_STAT_SPEC_I_MAX_DC_CF_CHGE_WERT               I3_PID_EME_LADEKOORDINATOR_INTERFACE, 48, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPEC_I_MAX_DC_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_I_CF_CHGE_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 50, PID_FIELD_SINT16, 0.1f, -204.7f, "STAT_AVL_I_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_SPEC_U_MAX_CHG_CHGE_WERT                 I3_PID_EME_LADEKOORDINATOR_INTERFACE, 52, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPEC_U_MAX_CHG_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_U_CHGE_WERT                          I3_PID_EME_LADEKOORDINATOR_INTERFACE, 54, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_AVL_U_CHGE_WERT"
+#define I3_FLD_EME_STAT_SPEC_U_MAX_INTLE_WERT                    I3_PID_EME_LADEKOORDINATOR_INTERFACE, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SPEC_U_MAX_INTLE_WERT"
+#define I3_FLD_EME_STAT_AVL_U_INTLE_WERT                         I3_PID_EME_LADEKOORDINATOR_INTERFACE, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_AVL_U_INTLE_WERT"
+#define I3_FLD_EME_STAT_SPEC_U_MAX_CF_CHGE_WERT                  I3_PID_EME_LADEKOORDINATOR_INTERFACE, 64, PID_FIELD_SINT16, 0.25f, 0.0f, "STAT_SPEC_U_MAX_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_U_CF_CHGE_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 66, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_AVL_U_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_U_CHGE_ALTC_WR_1_WERT                I3_PID_EME_LADEKOORDINATOR_INTERFACE, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_U_CHGE_ALTC_WR_1_WERT"
+#define I3_FLD_EME_STAT_AVL_U_1_CF_CHGE_ALTC_WERT                I3_PID_EME_LADEKOORDINATOR_INTERFACE, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_U_1_CF_CHGE_ALTC_WERT"
+#define I3_FLD_EME_STAT_AVL_U_2_CF_CHGE_ALTC_WERT                I3_PID_EME_LADEKOORDINATOR_INTERFACE, 70, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_U_2_CF_CHGE_ALTC_WERT"
+#define I3_FLD_EME_STAT_AVL_TEMP_CHGE_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 71, PID_FIELD_SINT16, 1.0f, -48.0f, "STAT_AVL_TEMP_CHGE_WERT"
+#define I3_FLD_EME_STAT_AVL_TEMP_INTLE_WERT                      I3_PID_EME_LADEKOORDINATOR_INTERFACE, 73, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_AVL_TEMP_INTLE_WERT"
+#define I3_FLD_EME_STAT_AVL_TEMP_CF_CHGE_WERT                    I3_PID_EME_LADEKOORDINATOR_INTERFACE, 75, PID_FIELD_SINT16, 1.0f, -48.0f, "STAT_AVL_TEMP_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_PWR_HV_STAT_AVLB_DER_WERT                I3_PID_EME_LADEKOORDINATOR_INTERFACE, 77, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PWR_HV_STAT_AVLB_DER_WERT"
+#define I3_FLD_EME_STAT_PWR_HV_STAT_AVLB_INTLE_DER_WERT          I3_PID_EME_LADEKOORDINATOR_INTERFACE, 81, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PWR_HV_STAT_AVLB_INTLE_DER_WERT"
+#define I3_FLD_EME_STAT_PWR_HV_STAT_AVLB_CF_CHGE_DER_WERT        I3_PID_EME_LADEKOORDINATOR_INTERFACE, 85, PID_FIELD_UINT32, 10.0f, 0.0f, "STAT_PWR_HV_STAT_AVLB_CF_CHGE_DER_WERT"
+#define I3_FLD_EME_STAT_REAS_FAILSAFE_CHGNG_WERT                 I3_PID_EME_LADEKOORDINATOR_INTERFACE, 89, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REAS_FAILSAFE_CHGNG_WERT"
+#define I3_FLD_EME_STAT_REAS_FAILSAFE_INTLE_WERT                 I3_PID_EME_LADEKOORDINATOR_INTERFACE, 91, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REAS_FAILSAFE_INTLE_WERT"
+#define I3_FLD_EME_STAT_REAS_CON_VRFD_CF_CHGE_WERT               I3_PID_EME_LADEKOORDINATOR_INTERFACE, 93, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REAS_CON_VRFD_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_REAS_DER_CHGNG_WERT                      I3_PID_EME_LADEKOORDINATOR_INTERFACE, 95, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAS_DER_CHGNG_WERT"
+#define I3_FLD_EME_STAT_REAS_DER_INTLE_WERT                      I3_PID_EME_LADEKOORDINATOR_INTERFACE, 96, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAS_DER_INTLE_WERT"
+#define I3_FLD_EME_STAT_REAS_DER_CF_CHGNG_WERT                   I3_PID_EME_LADEKOORDINATOR_INTERFACE, 97, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAS_DER_CF_CHGNG_WERT"
+#define I3_FLD_EME_STAT_ST_ERR_CHGNG_WERT                        I3_PID_EME_LADEKOORDINATOR_INTERFACE, 98, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ST_ERR_CHGNG_WERT"
+#define I3_FLD_EME_STAT_ST_ERR_INTLE_WERT                        I3_PID_EME_LADEKOORDINATOR_INTERFACE, 99, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ST_ERR_INTLE_WERT"
+#define I3_FLD_EME_STAT_ST_ERR_CF_CHGE_WERT                      I3_PID_EME_LADEKOORDINATOR_INTERFACE, 100, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ST_ERR_CF_CHGE_WERT"
+#define I3_FLD_EME_STAT_FREQWR_CHGNG_WERT                        I3_PID_EME_LADEKOORDINATOR_INTERFACE, 101, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREQWR_CHGNG_WERT"
+#define I3_FLD_EME_STAT_FREQWR_INTLE_WERT                        I3_PID_EME_LADEKOORDINATOR_INTERFACE, 105, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREQWR_INTLE_WERT"
+#define I3_FLD_EME_STAT_FREQWR_1_CF_CHGE_ALTC_WERT               I3_PID_EME_LADEKOORDINATOR_INTERFACE, 109, PID_FIELD_UINT32, 0.25f, 0.0f, "STAT_FREQWR_1_CF_CHGE_ALTC_WERT"
+#define I3_FLD_EME_STAT_FREQWR_2_CF_CHGE_ALTC_WERT               I3_PID_EME_LADEKOORDINATOR_INTERFACE, 113, PID_FIELD_UINT32, 0.25f, 0.0f, "STAT_FREQWR_2_CF_CHGE_ALTC_WERT"
+#define I3_FLD_EME_STAT_AVL_EFFY_CHGNG_CYC_WERT                  I3_PID_EME_LADEKOORDINATOR_INTERFACE, 117, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AVL_EFFY_CHGNG_CYC_WERT"
+#define I3_FLD_EME_STAT_AVL_EFFY_INTLE_CYC_WERT                  I3_PID_EME_LADEKOORDINATOR_INTERFACE, 121, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_EFFY_INTLE_CYC_WERT"
+#define I3_FLD_EME_STAT_AVL_EFFY_CF_CHGNG_CYC_WERT               I3_PID_EME_LADEKOORDINATOR_INTERFACE, 122, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_EFFY_CF_CHGNG_CYC_WERT"
+#define I3_FLD_EME_STAT_TAR_CHGNG_TYP_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 123, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAR_CHGNG_TYP_WERT"
+#define I3_FLD_EME_STAT_AVL_CHGNG_TYP_WERT                       I3_PID_EME_LADEKOORDINATOR_INTERFACE, 124, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_CHGNG_TYP_WERT"
+
+// 0xE5FF I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT
+#define I3_FLD_EME_STAT_AVL_CUTIL_DCDC_CNV_WERT                  I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AVL_CUTIL_DCDC_CNV_WERT"
+#define I3_FLD_EME_STAT_AVL_I_HV_DCDC_WERT                       I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 4, PID_FIELD_SINT32, 0.1f, 0.0f, "STAT_AVL_I_HV_DCDC_WERT"
+#define I3_FLD_EME_STAT_AVL_I_LV_DCDC_WERT                       I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AVL_I_LV_DCDC_WERT"
+#define I3_FLD_EME_STAT_AVL_OPMO_DCDC_CNV_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AVL_OPMO_DCDC_CNV_WERT"
+#define I3_FLD_EME_STAT_AVL_U_DCDC_CNV_HV_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AVL_U_DCDC_CNV_HV_WERT"
+#define I3_FLD_EME_STAT_AVL_U_LV_DCDC_CNV_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 17, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_AVL_U_LV_DCDC_CNV_WERT"
+#define I3_FLD_EME_STAT_SPEC_PWR_DCDC_CNV_MAX_WERT               I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SPEC_PWR_DCDC_CNV_MAX_WERT"
+#define I3_FLD_EME_STAT_ST_DCDC_CNV_DIAG_WERT                    I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 25, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ST_DCDC_CNV_DIAG_WERT"
+#define I3_FLD_EME_STAT_ST_ERR_DCDC_CNV_WERT                     I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ST_ERR_DCDC_CNV_WERT"
+#define I3_FLD_EME_STAT_TAR_OPMO_DCDC_CNV_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TAR_OPMO_DCDC_CNV_WERT"
+#define I3_FLD_EME_STAT_TAR_U_LV_DCDC_CNV_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_TAR_U_LV_DCDC_CNV_WERT"
+#define I3_FLD_EME_STAT_U_DCDC_CNV_HV_MIN_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_U_DCDC_CNV_HV_MIN_WERT"
+#define I3_FLD_EME_STAT_V_B_DCDC_HI_ENABLE_WERT                  I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_V_B_DCDC_HI_ENABLE_WERT"
+#define I3_FLD_EME_STAT_V_E_DCDC_BTS_STATUS_MC6_WERT             I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 41, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_E_DCDC_BTS_STATUS_MC6_WERT"
+#define I3_FLD_EME_STAT_V_E_DCDC_CTRL_STATUS_MC6_PKR2_WERT       I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 43, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_E_DCDC_CTRL_STATUS_MC6_PKR2_WERT"
+#define I3_FLD_EME_STAT_V_E_DCDC_HI_ST_OUT_WERT                  I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 45, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_E_DCDC_HI_ST_OUT_WERT"
+#define I3_FLD_EME_STAT_V_E_DCDC_MC0_CTRL_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 49, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_E_DCDC_MC0_CTRL_WERT"
+#define I3_FLD_EME_STAT_V_H_SPI_DCDC_0_SPI_DATA_E_STATUS_WERT    I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 53, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_H_SPI_DCDC_0_SPI_DATA_E_STATUS_WERT"
+#define I3_FLD_EME_STAT_V_H_SPI_DCDC_6_SPI_DATA_E_STATUS_WERT    I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 55, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_H_SPI_DCDC_6_SPI_DATA_E_STATUS_WERT"
+#define I3_FLD_EME_STAT_V_I_DCDC_HV_MC6_WERT                     I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 57, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_V_I_DCDC_HV_MC6_WERT"
+#define I3_FLD_EME_STAT_V_I_DCDC_TRA1_MC6_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 61, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_V_I_DCDC_TRA1_MC6_WERT"
+#define I3_FLD_EME_STAT_V_I_DCDC_TRA_FIL_WERT                    I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 65, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_V_I_DCDC_TRA_FIL_WERT"
+#define I3_FLD_EME_STAT_V_S_DCDC_PWM_HTS1_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_S_DCDC_PWM_HTS1_WERT"
+#define I3_FLD_EME_STAT_V_S_DCDC_PWM_HTS2_WERT                   I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 71, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_S_DCDC_PWM_HTS2_WERT"
+#define I3_FLD_EME_STAT_V_S_DCDC_SW_VERSION_WERT                 I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 73, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_V_S_DCDC_SW_VERSION_WERT"
+#define I3_FLD_EME_STAT_V_T_DCDC_BO_WERT                         I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 75, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_T_DCDC_BO_WERT"
+#define I3_FLD_EME_STAT_V_T_DCDC_GR_MC6_WERT                     I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 79, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_T_DCDC_GR_MC6_WERT"
+#define I3_FLD_EME_STAT_V_T_DCDC_GTW_MC6_WERT                    I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 83, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_T_DCDC_GTW_MC6_WERT"
+#define I3_FLD_EME_STAT_V_U_DCDC_GT_MC6_PKR2_WERT                I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 87, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_U_DCDC_GT_MC6_PKR2_WERT"
+#define I3_FLD_EME_STAT_V_U_DCDC_LV_WERT                         I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 91, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_V_U_DCDC_LV_WERT"
+#define I3_FLD_EME_STAT_V_U_DCDC_LV_CAL_WERT                     I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 95, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_V_U_DCDC_LV_CAL_WERT"
+#define I3_FLD_EME_STAT_V_U_DCDC_LV_SOLL_WERT                    I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 99, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_V_U_DCDC_LV_SOLL_WERT"
+#define I3_FLD_EME_STAT_V_I_DCDC_TS1_MC6_RUKO_WERT               I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 103, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_I_DCDC_TS1_MC6_RUKO_WERT"
+#define I3_FLD_EME_STAT_V_I_DCDC_TS2_MC6_RUKO_WERT               I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 107, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_I_DCDC_TS2_MC6_RUKO_WERT"
+#define I3_FLD_EME_STAT_V_T_DCDC_TS_MC6_RUKO_WERT                I3_PID_EME_DCDC_MESSGROESSEN_KOMPLETT, 111, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_V_T_DCDC_TS_MC6_RUKO_WERT"
+
+// 0xF011 I3_PID_EME_AE_RESETINFO_LESEN
+
+// 0xF050 I3_PID_EME_AE_FREILAUF_MODUS
+#define I3_FLD_EME_STAT_STATUS                                   I3_PID_EME_AE_FREILAUF_MODUS, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_STATUS"
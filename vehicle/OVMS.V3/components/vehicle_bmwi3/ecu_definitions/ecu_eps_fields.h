@@ -0,0 +1,38 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/eps_i1.json: EPS 30: Power steering
+// This generated code  makes it easier to process CANBUS messages from the EPS ecu in a BMW i3
+//
+
+// 0xA2BB I3_PID_EPS_STEUERN_EPS_PULLDRIFT_OFFSET_RESET
+
+// 0xAB69 I3_PID_EPS_EPS_LENKWINKELSENSOR_KALIBRIERUNG_RESET
+
+// 0xAB6C I3_PID_EPS_EPS_INITIALISIERUNG_SERVICE
+#define I3_FLD_EPS_STAT_ROUTINE_STATUS                           I3_PID_EPS_EPS_INITIALISIERUNG_SERVICE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTINE_STATUS"
+#define I3_FLD_EPS_STAT_LENKRADWINKEL_WERT                       I3_PID_EPS_EPS_INITIALISIERUNG_SERVICE, 1, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_LENKRADWINKEL_WERT"
+#define I3_FLD_EPS_STAT_SENSOR_ZUSTAND_NR                        I3_PID_EPS_EPS_INITIALISIERUNG_SERVICE, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_SENSOR_ZUSTAND_NR"
+
+// 0xAB7D I3_PID_EPS_STEUERN_EPS_MULTITURNWERT_RESET
+
+// 0xDB57 I3_PID_EPS_EPS_RITZELWINKELSENSOR
+#define I3_FLD_EPS_STAT_RITZELWINKEL_WERT                        I3_PID_EPS_EPS_RITZELWINKELSENSOR, 0, PID_FIELD_SINT32, 0.01f, 0.0f, "STAT_RITZELWINKEL_WERT"
+#define I3_FLD_EPS_STAT_RITZELWINKELGESCHWINDIGKEIT_WERT         I3_PID_EPS_EPS_RITZELWINKELSENSOR, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_RITZELWINKELGESCHWINDIGKEIT_WERT"
+#define I3_FLD_EPS_STAT_SENSOR_ZUSTAND_NR_0XDB57                 I3_PID_EPS_EPS_RITZELWINKELSENSOR, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_SENSOR_ZUSTAND_NR_0XDB57"
+
+// 0xDB99 I3_PID_EPS_EPS_MOMENTENSENSOR
+#define I3_FLD_EPS_STAT_MOMENT_WERT                              I3_PID_EPS_EPS_MOMENTENSENSOR, 0, PID_FIELD_SINT16, 0.0078125f, 0.0f, "STAT_MOMENT_WERT"
+#define I3_FLD_EPS_STAT_SENSOR_ZUSTAND_NR_0XDB99                 I3_PID_EPS_EPS_MOMENTENSENSOR, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_SENSOR_ZUSTAND_NR_0XDB99"
+
+// 0xDC77 I3_PID_EPS_EPS_ZAHNSTANGENMITTE
+#define I3_FLD_EPS_STAT_ZAHNSTANGENMITTE_ZUSTAND_NR              I3_PID_EPS_EPS_ZAHNSTANGENMITTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAHNSTANGENMITTE_ZUSTAND_NR"
+
+// 0xDFDD I3_PID_EPS_GELERNTER_ZAHNSTANGENWEG
+
+// 0xF152 I3_PID_EPS_READHWMODIFICATIONINDEX
+#define I3_FLD_EPS_STAT_HW_MODIFICATION_INDEX_WERT               I3_PID_EPS_READHWMODIFICATIONINDEX, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HW_MODIFICATION_INDEX_WERT"
+#define I3_FLD_EPS_BF_22_F152_SUPPLIERINFO                       I3_PID_EPS_READHWMODIFICATIONINDEX, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_22_F152_SUPPLIERINFO"
+
+// 0x1234 I3_PID_EPS_FLASH_UPDATE_MULTITURNZAEHLER
+#define I3_FLD_EPS_STAT_SERVICE                                  I3_PID_EPS_FLASH_UPDATE_MULTITURNZAEHLER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SERVICE"
+#define I3_FLD_EPS_STAT_PIC                                      I3_PID_EPS_FLASH_UPDATE_MULTITURNZAEHLER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PIC"
@@ -0,0 +1,287 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/fzd_f15.json: FZD 56: Roof function centre
+// This generated code  makes it easier to process CANBUS messages from the FZD ecu in a BMW i3
+//
+
+// 0xAA70 I3_PID_FZD_DWA_SINE_ANSTEUERUNG
+
+// 0xAA71 I3_PID_FZD_DWA_SINE_BATT_LEVEL_RESET
+
+// 0xAA7A I3_PID_FZD_DWA_ALARM_ANZAHL_LOESCHEN
+
+// 0xD180 I3_PID_FZD_SHD_HALLSENSOREN
+#define I3_FLD_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN                 I3_PID_FZD_SHD_HALLSENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN"
+#define I3_FLD_FZD_STAT_HALL_A_VERSORGUNG_EIN                    I3_PID_FZD_SHD_HALLSENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN"
+#define I3_FLD_FZD_STAT_HALL_A_FEHLERZUSTAND_NR                  I3_PID_FZD_SHD_HALLSENSOREN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR"
+#define I3_FLD_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN                 I3_PID_FZD_SHD_HALLSENSOREN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN"
+#define I3_FLD_FZD_STAT_HALL_B_VERSORGUNG_EIN                    I3_PID_FZD_SHD_HALLSENSOREN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN"
+#define I3_FLD_FZD_STAT_HALL_B_FEHLERZUSTAND_NR                  I3_PID_FZD_SHD_HALLSENSOREN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR"
+
+// 0xD192 I3_PID_FZD_SHD_ESH_TASTER
+#define I3_FLD_FZD_STAT_TASTER_SHD_ESH_NR                        I3_PID_FZD_SHD_ESH_TASTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_SHD_ESH_NR"
+#define I3_FLD_FZD_STAT_TASTER_RESERVE                           I3_PID_FZD_SHD_ESH_TASTER, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TASTER_RESERVE"
+
+// 0xD193 I3_PID_FZD_ESH_VORHANDEN
+#define I3_FLD_FZD_STAT_VORHANDEN_ESH                            I3_PID_FZD_ESH_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_ESH"
+
+// 0xD194 I3_PID_FZD_SHD_ESH_TASTER_VORHANDEN
+#define I3_FLD_FZD_STAT_VORHANDEN_TASTER_SHD_ESH                 I3_PID_FZD_SHD_ESH_TASTER_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_TASTER_SHD_ESH"
+
+// 0xD195 I3_PID_FZD_SHD_VORHANDEN
+#define I3_FLD_FZD_STAT_VORHANDEN_SHD                            I3_PID_FZD_SHD_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SHD"
+
+// 0xD196 I3_PID_FZD_SHD_BEWEGUNG
+#define I3_FLD_FZD_STAT_SHD_INIT_NR                              I3_PID_FZD_SHD_BEWEGUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_INIT_NR"
+#define I3_FLD_FZD_STAT_SHD_BEWEGUNG_NR                          I3_PID_FZD_SHD_BEWEGUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_BEWEGUNG_NR"
+#define I3_FLD_FZD_STAT_SHD_POSITION_NR                          I3_PID_FZD_SHD_BEWEGUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_POSITION_NR"
+#define I3_FLD_FZD_STAT_SHD_POSITION_HALL_WERT                   I3_PID_FZD_SHD_BEWEGUNG, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SHD_POSITION_HALL_WERT"
+#define I3_FLD_FZD_STAT_SHD_POSITION_HALL_MIN_WERT               I3_PID_FZD_SHD_BEWEGUNG, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SHD_POSITION_HALL_MIN_WERT"
+#define I3_FLD_FZD_STAT_SHD_POSITION_HALL_MAX_WERT               I3_PID_FZD_SHD_BEWEGUNG, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SHD_POSITION_HALL_MAX_WERT"
+#define I3_FLD_FZD_STAT_SHD_POSITION_MM_WERT                     I3_PID_FZD_SHD_BEWEGUNG, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SHD_POSITION_MM_WERT"
+#define I3_FLD_FZD_STAT_SHD_POSITION_MM_MIN_WERT                 I3_PID_FZD_SHD_BEWEGUNG, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SHD_POSITION_MM_MIN_WERT"
+#define I3_FLD_FZD_STAT_SHD_POSITION_MM_MAX_WERT                 I3_PID_FZD_SHD_BEWEGUNG, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SHD_POSITION_MM_MAX_WERT"
+#define I3_FLD_FZD_STAT_SHD_POSITION_PROZENT_WERT                I3_PID_FZD_SHD_BEWEGUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_POSITION_PROZENT_WERT"
+#define I3_FLD_FZD_STAT_SHD_LAGE_NR                              I3_PID_FZD_SHD_BEWEGUNG, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_LAGE_NR"
+#define I3_FLD_FZD_STAT_SHD_ZUSTAND_TUER_NR                      I3_PID_FZD_SHD_BEWEGUNG, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_ZUSTAND_TUER_NR"
+#define I3_FLD_FZD_STAT_SHD_FREIGABE_AKTIV_NR                    I3_PID_FZD_SHD_BEWEGUNG, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_FREIGABE_AKTIV_NR"
+#define I3_FLD_FZD_STAT_SHD_PANIKMODUS_AKTIV_NR                  I3_PID_FZD_SHD_BEWEGUNG, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_PANIKMODUS_AKTIV_NR"
+#define I3_FLD_FZD_STAT_SHD_RESERVE                              I3_PID_FZD_SHD_BEWEGUNG, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SHD_RESERVE"
+
+// 0xD1A6 I3_PID_FZD_SHD_STATUS_DETAIL
+#define I3_FLD_FZD_STAT_SHD_RESERVE_1                            I3_PID_FZD_SHD_STATUS_DETAIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_RESERVE_1"
+#define I3_FLD_FZD_STAT_SHD_MOTORTEMPERATUR_NR                   I3_PID_FZD_SHD_STATUS_DETAIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_MOTORTEMPERATUR_NR"
+#define I3_FLD_FZD_STAT_SHD_AUSSENTEMPERATUR_WERT                I3_PID_FZD_SHD_STATUS_DETAIL, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_FZD_STAT_SHD_MT_LIEFERANT_NR                      I3_PID_FZD_SHD_STATUS_DETAIL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_MT_LIEFERANT_NR"
+#define I3_FLD_FZD_STAT_SHD_MT_SW_VERSION                        I3_PID_FZD_SHD_STATUS_DETAIL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SHD_MT_SW_VERSION"
+#define I3_FLD_FZD_STAT_SHD_EEPROM_PRUEFSUMME_NR                 I3_PID_FZD_SHD_STATUS_DETAIL, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_EEPROM_PRUEFSUMME_NR"
+#define I3_FLD_FZD_STAT_SHD_RESERVE_2                            I3_PID_FZD_SHD_STATUS_DETAIL, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_RESERVE_2"
+#define I3_FLD_FZD_STAT_SHD_WACHHALTEN                           I3_PID_FZD_SHD_STATUS_DETAIL, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_WACHHALTEN"
+#define I3_FLD_FZD_STAT_SHD_FZG_GESCHWINDIGKEIT                  I3_PID_FZD_SHD_STATUS_DETAIL, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_FZG_GESCHWINDIGKEIT"
+#define I3_FLD_FZD_STAT_SHD_RELATIVZEIT                          I3_PID_FZD_SHD_STATUS_DETAIL, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SHD_RELATIVZEIT"
+#define I3_FLD_FZD_STAT_SHD_TEMPERATUR_UEBERWACHUNG              I3_PID_FZD_SHD_STATUS_DETAIL, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_TEMPERATUR_UEBERWACHUNG"
+#define I3_FLD_FZD_STAT_SHD_EKS_AKTIV                            I3_PID_FZD_SHD_STATUS_DETAIL, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_EKS_AKTIV"
+#define I3_FLD_FZD_STAT_SHD_FREIGABE_DEAKTIVIERT                 I3_PID_FZD_SHD_STATUS_DETAIL, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_FREIGABE_DEAKTIVIERT"
+#define I3_FLD_FZD_STAT_SHD_PANIKMODUS_DEAKTIVIERT               I3_PID_FZD_SHD_STATUS_DETAIL, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SHD_PANIKMODUS_DEAKTIVIERT"
+#define I3_FLD_FZD_STAT_SHD_RESERVE_0XD1A6                       I3_PID_FZD_SHD_STATUS_DETAIL, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SHD_RESERVE_0XD1A6"
+
+// 0xD1B9 I3_PID_FZD_SHD_RELAIS
+#define I3_FLD_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN                 I3_PID_FZD_SHD_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN"
+#define I3_FLD_FZD_STAT_RELAIS_A_RUECK_EIN                       I3_PID_FZD_SHD_RELAIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN"
+#define I3_FLD_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN                 I3_PID_FZD_SHD_RELAIS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN"
+#define I3_FLD_FZD_STAT_RELAIS_B_RUECK_EIN                       I3_PID_FZD_SHD_RELAIS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN"
+#define I3_FLD_FZD_STAT_RELAIS_A_VERSORGUNG_WERT                 I3_PID_FZD_SHD_RELAIS, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT"
+#define I3_FLD_FZD_STAT_RELAIS_B_VERSORGUNG_WERT                 I3_PID_FZD_SHD_RELAIS, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT"
+
+// 0xD1BA I3_PID_FZD_ESH_BEWEGUNG
+#define I3_FLD_FZD_STAT_ESH_INIT_NR                              I3_PID_FZD_ESH_BEWEGUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_INIT_NR"
+#define I3_FLD_FZD_STAT_ESH_BEWEGUNG_NR                          I3_PID_FZD_ESH_BEWEGUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_BEWEGUNG_NR"
+#define I3_FLD_FZD_STAT_ESH_POSITION_NR                          I3_PID_FZD_ESH_BEWEGUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_POSITION_NR"
+#define I3_FLD_FZD_STAT_ESH_POSITION_HALL_WERT                   I3_PID_FZD_ESH_BEWEGUNG, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ESH_POSITION_HALL_WERT"
+#define I3_FLD_FZD_STAT_ESH_POSITION_HALL_MIN_WERT               I3_PID_FZD_ESH_BEWEGUNG, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ESH_POSITION_HALL_MIN_WERT"
+#define I3_FLD_FZD_STAT_ESH_POSITION_HALL_MAX_WERT               I3_PID_FZD_ESH_BEWEGUNG, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ESH_POSITION_HALL_MAX_WERT"
+#define I3_FLD_FZD_STAT_ESH_POSITION_MM_WERT                     I3_PID_FZD_ESH_BEWEGUNG, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ESH_POSITION_MM_WERT"
+#define I3_FLD_FZD_STAT_ESH_POSITION_MM_MIN_WERT                 I3_PID_FZD_ESH_BEWEGUNG, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ESH_POSITION_MM_MIN_WERT"
+#define I3_FLD_FZD_STAT_ESH_POSITION_MM_MAX_WERT                 I3_PID_FZD_ESH_BEWEGUNG, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ESH_POSITION_MM_MAX_WERT"
+#define I3_FLD_FZD_STAT_ESH_POSITION_PROZENT_WERT                I3_PID_FZD_ESH_BEWEGUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_POSITION_PROZENT_WERT"
+#define I3_FLD_FZD_STAT_ESH_LAGE_NR                              I3_PID_FZD_ESH_BEWEGUNG, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_LAGE_NR"
+#define I3_FLD_FZD_STAT_ESH_ZUSTAND_TUER_NR                      I3_PID_FZD_ESH_BEWEGUNG, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_ZUSTAND_TUER_NR"
+#define I3_FLD_FZD_STAT_ESH_FREIGABE_AKTIV_NR                    I3_PID_FZD_ESH_BEWEGUNG, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_FREIGABE_AKTIV_NR"
+#define I3_FLD_FZD_STAT_ESH_PANIKMODUS_AKTIV_NR                  I3_PID_FZD_ESH_BEWEGUNG, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_PANIKMODUS_AKTIV_NR"
+#define I3_FLD_FZD_STAT_ESH_RESERVE                              I3_PID_FZD_ESH_BEWEGUNG, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ESH_RESERVE"
+
+// 0xD1BB I3_PID_FZD_ESH_HALLSENSOREN
+#define I3_FLD_FZD_STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1BB          I3_PID_FZD_ESH_HALLSENSOREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_SCHALTZUSTAND_EIN_0XD1BB"
+#define I3_FLD_FZD_STAT_HALL_A_VERSORGUNG_EIN_0XD1BB             I3_PID_FZD_ESH_HALLSENSOREN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_VERSORGUNG_EIN_0XD1BB"
+#define I3_FLD_FZD_STAT_HALL_A_FEHLERZUSTAND_NR_0XD1BB           I3_PID_FZD_ESH_HALLSENSOREN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_A_FEHLERZUSTAND_NR_0XD1BB"
+#define I3_FLD_FZD_STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1BB          I3_PID_FZD_ESH_HALLSENSOREN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_SCHALTZUSTAND_EIN_0XD1BB"
+#define I3_FLD_FZD_STAT_HALL_B_VERSORGUNG_EIN_0XD1BB             I3_PID_FZD_ESH_HALLSENSOREN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_VERSORGUNG_EIN_0XD1BB"
+#define I3_FLD_FZD_STAT_HALL_B_FEHLERZUSTAND_NR_0XD1BB           I3_PID_FZD_ESH_HALLSENSOREN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HALL_B_FEHLERZUSTAND_NR_0XD1BB"
+
+// 0xD1BC I3_PID_FZD_ESH_RELAIS
+#define I3_FLD_FZD_STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1BC          I3_PID_FZD_ESH_RELAIS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_ANSTEUERUNG_EIN_0XD1BC"
+#define I3_FLD_FZD_STAT_RELAIS_A_RUECK_EIN_0XD1BC                I3_PID_FZD_ESH_RELAIS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_A_RUECK_EIN_0XD1BC"
+#define I3_FLD_FZD_STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1BC          I3_PID_FZD_ESH_RELAIS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_ANSTEUERUNG_EIN_0XD1BC"
+#define I3_FLD_FZD_STAT_RELAIS_B_RUECK_EIN_0XD1BC                I3_PID_FZD_ESH_RELAIS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RELAIS_B_RUECK_EIN_0XD1BC"
+#define I3_FLD_FZD_STAT_RELAIS_A_VERSORGUNG_WERT_0XD1BC          I3_PID_FZD_ESH_RELAIS, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RELAIS_A_VERSORGUNG_WERT_0XD1BC"
+#define I3_FLD_FZD_STAT_RELAIS_B_VERSORGUNG_WERT_0XD1BC          I3_PID_FZD_ESH_RELAIS, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RELAIS_B_VERSORGUNG_WERT_0XD1BC"
+
+// 0xD1BD I3_PID_FZD_ESH_STATUS_DETAIL
+#define I3_FLD_FZD_STAT_ESH_RESERVE_1                            I3_PID_FZD_ESH_STATUS_DETAIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_RESERVE_1"
+#define I3_FLD_FZD_STAT_ESH_MOTORTEMPERATUR_NR                   I3_PID_FZD_ESH_STATUS_DETAIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_MOTORTEMPERATUR_NR"
+#define I3_FLD_FZD_STAT_ESH_AUSSENTEMPERATUR_WERT                I3_PID_FZD_ESH_STATUS_DETAIL, 2, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_ESH_AUSSENTEMPERATUR_WERT"
+#define I3_FLD_FZD_STAT_ESH_MT_LIEFERANT_NR                      I3_PID_FZD_ESH_STATUS_DETAIL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_MT_LIEFERANT_NR"
+#define I3_FLD_FZD_STAT_ESH_MT_SW_VERSION                        I3_PID_FZD_ESH_STATUS_DETAIL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ESH_MT_SW_VERSION"
+#define I3_FLD_FZD_STAT_ESH_EEPROM_PRUEFSUMME_NR                 I3_PID_FZD_ESH_STATUS_DETAIL, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_EEPROM_PRUEFSUMME_NR"
+#define I3_FLD_FZD_STAT_ESH_RESERVE_2                            I3_PID_FZD_ESH_STATUS_DETAIL, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_RESERVE_2"
+#define I3_FLD_FZD_STAT_ESH_WACHHALTEN                           I3_PID_FZD_ESH_STATUS_DETAIL, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_WACHHALTEN"
+#define I3_FLD_FZD_STAT_ESH_FZG_GESCHWINDIGKEIT                  I3_PID_FZD_ESH_STATUS_DETAIL, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_FZG_GESCHWINDIGKEIT"
+#define I3_FLD_FZD_STAT_ESH_RELATIVZEIT                          I3_PID_FZD_ESH_STATUS_DETAIL, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ESH_RELATIVZEIT"
+#define I3_FLD_FZD_STAT_ESH_TEMPERATUR_UEBERWACHUNG              I3_PID_FZD_ESH_STATUS_DETAIL, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_TEMPERATUR_UEBERWACHUNG"
+#define I3_FLD_FZD_STAT_ESH_EKS_AKTIV                            I3_PID_FZD_ESH_STATUS_DETAIL, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_EKS_AKTIV"
+#define I3_FLD_FZD_STAT_ESH_FREIGABE_DEAKTIVIERT                 I3_PID_FZD_ESH_STATUS_DETAIL, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_FREIGABE_DEAKTIVIERT"
+#define I3_FLD_FZD_STAT_ESH_PANIKMODUS_DEAKTIVIERT               I3_PID_FZD_ESH_STATUS_DETAIL, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ESH_PANIKMODUS_DEAKTIVIERT"
+#define I3_FLD_FZD_STAT_ESH_RESERVE_0XD1BD                       I3_PID_FZD_ESH_STATUS_DETAIL, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ESH_RESERVE_0XD1BD"
+
+// 0xD1BE I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN
+#define I3_FLD_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH               I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NACHNORMIERUNG_AUTOMATISCH"
+#define I3_FLD_FZD_STAT_NACHNORMIERUNG_MANUELL                   I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NACHNORMIERUNG_MANUELL"
+#define I3_FLD_FZD_STAT_VERFAHREN_EMERGENCY                      I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERFAHREN_EMERGENCY"
+#define I3_FLD_FZD_STAT_PANIC                                    I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PANIC"
+#define I3_FLD_FZD_STAT_REVERSIER_NORMALMODUS                    I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REVERSIER_NORMALMODUS"
+#define I3_FLD_FZD_STAT_REVERSIERER_EMERGENCY                    I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REVERSIERER_EMERGENCY"
+#define I3_FLD_FZD_STAT_ABBRUCH_MOTORLAUF                        I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ABBRUCH_MOTORLAUF"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_80_KMH                   I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_80_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_80_KMH                     I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_80_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_80_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_120_KMH                  I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_120_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_120_KMH                    I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_120_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH               I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_120_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_160_KMH                  I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_160_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_160_KMH                    I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_160_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH               I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_160_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_300_KMH                  I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_300_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_300_KMH                    I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_300_KMH"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH               I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_300_KMH"
+#define I3_FLD_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD            I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETAETIGUNG_BEI_MINUS_10_GRAD"
+#define I3_FLD_FZD_STAT_REVERSIER_BEI_0_GRAD                     I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REVERSIER_BEI_0_GRAD"
+#define I3_FLD_FZD_STAT_RESERVE_1                                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 42, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_1"
+#define I3_FLD_FZD_STAT_RESERVE_2                                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 46, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_2"
+#define I3_FLD_FZD_STAT_RESERVE_3                                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_3"
+#define I3_FLD_FZD_STAT_RESERVE_4                                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 54, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_4"
+#define I3_FLD_FZD_STAT_RESERVE_5                                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 58, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_5"
+#define I3_FLD_FZD_STAT_RESERVE_6                                I3_PID_FZD_SHD_STATISTIKZAEHLER_LESEN, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE_6"
+
+// 0xD1C0 I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN
+#define I3_FLD_FZD_STAT_NACHNORMIERUNG_AUTOMATISCH_0XD1C0        I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NACHNORMIERUNG_AUTOMATISCH_0XD1C0"
+#define I3_FLD_FZD_STAT_NACHNORMIERUNG_MANUELL_0XD1C0            I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NACHNORMIERUNG_MANUELL_0XD1C0"
+#define I3_FLD_FZD_STAT_VERFAHREN_EMERGENCY_0XD1C0               I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERFAHREN_EMERGENCY_0XD1C0"
+#define I3_FLD_FZD_STAT_PANIC_0XD1C0                             I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PANIC_0XD1C0"
+#define I3_FLD_FZD_STAT_REVERSIER_NORMALMODUS_0XD1C0             I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REVERSIER_NORMALMODUS_0XD1C0"
+#define I3_FLD_FZD_STAT_REVERSIERER_EMERGENCY_0XD1C0             I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REVERSIERER_EMERGENCY_0XD1C0"
+#define I3_FLD_FZD_STAT_ABBRUCH_MOTORLAUF_0XD1C0                 I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ABBRUCH_MOTORLAUF_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_80_KMH_0XD1C0            I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_80_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_80_KMH_0XD1C0              I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_80_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_80_KMH_0XD1C0         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_80_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_120_KMH_0XD1C0           I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_120_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_120_KMH_0XD1C0             I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_120_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_120_KMH_0XD1C0        I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_120_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_160_KMH_0XD1C0           I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_160_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_160_KMH_0XD1C0             I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_160_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_160_KMH_0XD1C0        I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_160_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_OEFFNEN_300_KMH_0XD1C0           I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_OEFFNEN_300_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_HEBEN_300_KMH_0XD1C0             I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_HEBEN_300_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_VORGANG_SCHLIESSEN_300_KMH_0XD1C0        I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VORGANG_SCHLIESSEN_300_KMH_0XD1C0"
+#define I3_FLD_FZD_STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_0XD1C0     I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BETAETIGUNG_BEI_MINUS_10_GRAD_0XD1C0"
+#define I3_FLD_FZD_STAT_REVERSIER_BEI_0_GRAD_0XD1C0              I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REVERSIER_BEI_0_GRAD_0XD1C0"
+#define I3_FLD_FZD_STAT_RESERVE_1_0XD1C0                         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 42, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_1_0XD1C0"
+#define I3_FLD_FZD_STAT_RESERVE_2_0XD1C0                         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 46, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_2_0XD1C0"
+#define I3_FLD_FZD_STAT_RESERVE_3_0XD1C0                         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_3_0XD1C0"
+#define I3_FLD_FZD_STAT_RESERVE_4_0XD1C0                         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 54, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_4_0XD1C0"
+#define I3_FLD_FZD_STAT_RESERVE_5_0XD1C0                         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 58, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_5_0XD1C0"
+#define I3_FLD_FZD_STAT_RESERVE_6_0XD1C0                         I3_PID_FZD_ESH_STATISTIKZAEHLER_LESEN, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESERVE_6_0XD1C0"
+
+// 0xDCA1 I3_PID_FZD_DWA_SINE_LIN
+#define I3_FLD_FZD_STAT_VORHANDEN_LIN_SIRENE                     I3_PID_FZD_DWA_SINE_LIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_LIN_SIRENE"
+
+// 0xDCA2 I3_PID_FZD_DWA_SINE
+#define I3_FLD_FZD_STAT_LEITUNG_NR                               I3_PID_FZD_DWA_SINE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LEITUNG_NR"
+#define I3_FLD_FZD_STAT_UNTERSPANNUNG_EXT_NR                     I3_PID_FZD_DWA_SINE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_UNTERSPANNUNG_EXT_NR"
+#define I3_FLD_FZD_STAT_EEPROM_NR                                I3_PID_FZD_DWA_SINE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EEPROM_NR"
+#define I3_FLD_FZD_STAT_AKTIVER_SCHUTZ_NR                        I3_PID_FZD_DWA_SINE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AKTIVER_SCHUTZ_NR"
+#define I3_FLD_FZD_STAT_WAKE_UP_NR                               I3_PID_FZD_DWA_SINE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WAKE_UP_NR"
+#define I3_FLD_FZD_STAT_SIRENE_AKUSTIK_NR                        I3_PID_FZD_DWA_SINE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIRENE_AKUSTIK_NR"
+#define I3_FLD_FZD_STAT_TILT_NR                                  I3_PID_FZD_DWA_SINE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TILT_NR"
+
+// 0xDCA3 I3_PID_FZD_DWA_SINE_BATT_LEVEL
+#define I3_FLD_FZD_STAT_SIRENE_INTERNER_BATTERIE_LEVEL_NR        I3_PID_FZD_DWA_SINE_BATT_LEVEL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIRENE_INTERNER_BATTERIE_LEVEL_NR"
+
+// 0xDCA9 I3_PID_FZD_DWA_SINE_NEIGUNG
+#define I3_FLD_FZD_STAT_NEIGUNG_X_ACHSE_WERT                     I3_PID_FZD_DWA_SINE_NEIGUNG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NEIGUNG_X_ACHSE_WERT"
+#define I3_FLD_FZD_STAT_NEIGUNG_Y_ACHSE_WERT                     I3_PID_FZD_DWA_SINE_NEIGUNG, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_NEIGUNG_Y_ACHSE_WERT"
+
+// 0xDCAC I3_PID_FZD_DWA_INTERN
+#define I3_FLD_FZD_STAT_DWA_INTERN_NR                            I3_PID_FZD_DWA_INTERN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DWA_INTERN_NR"
+
+// 0xDCB0 I3_PID_FZD_DWA_ALARM_AUSGELOEST
+#define I3_FLD_FZD_STAT_DWA_ALARM_MOTORHAUBE_AUSGELOEST_EIN      I3_PID_FZD_DWA_ALARM_AUSGELOEST, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_MOTORHAUBE_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_FAT_AUSGELOEST_EIN             I3_PID_FZD_DWA_ALARM_AUSGELOEST, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_FAT_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_BFT_AUSGELOEST_EIN             I3_PID_FZD_DWA_ALARM_AUSGELOEST, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_BFT_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_FATH_AUSGELOEST_EIN            I3_PID_FZD_DWA_ALARM_AUSGELOEST, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_FATH_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_BFTH_AUSGELOEST_EIN            I3_PID_FZD_DWA_ALARM_AUSGELOEST, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_BFTH_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_HECKKLAPPE_AUSGELOEST_EIN      I3_PID_FZD_DWA_ALARM_AUSGELOEST, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_HECKKLAPPE_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_HECKSCHEIBE_AUSGELOEST_EIN     I3_PID_FZD_DWA_ALARM_AUSGELOEST, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_HECKSCHEIBE_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_OBD_KOMMUNIKATION_EIN          I3_PID_FZD_DWA_ALARM_AUSGELOEST, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_OBD_KOMMUNIKATION_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_LEITUNGSUEBERWACHUNG_SINE_AUSGELOEST_EIN I3_PID_FZD_DWA_ALARM_AUSGELOEST, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_LEITUNGSUEBERWACHUNG_SINE_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_MANIPULATION_AUTH_AUSGELOEST_EIN I3_PID_FZD_DWA_ALARM_AUSGELOEST, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_MANIPULATION_AUTH_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_USIS_A_UND_B_AUSGELOEST_EIN    I3_PID_FZD_DWA_ALARM_AUSGELOEST, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_USIS_A_UND_B_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_USIS_A_AUSGELOEST_EIN          I3_PID_FZD_DWA_ALARM_AUSGELOEST, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_USIS_A_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_USIS_B_AUSGELOEST_EIN          I3_PID_FZD_DWA_ALARM_AUSGELOEST, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_USIS_B_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_AUSGELOEST_EIN I3_PID_FZD_DWA_ALARM_AUSGELOEST, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_NEIGUNGSGEBER_X_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_Y_AUSGELOEST_EIN I3_PID_FZD_DWA_ALARM_AUSGELOEST, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_NEIGUNGSGEBER_Y_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_NEIGUNGSGEBER_X_UND_Y_AUSGELOEST_EIN I3_PID_FZD_DWA_ALARM_AUSGELOEST, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_NEIGUNGSGEBER_X_UND_Y_AUSGELOEST_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_SINE_SPANNUNG_EIN              I3_PID_FZD_DWA_ALARM_AUSGELOEST, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_SINE_SPANNUNG_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_SINE_LIN_TELEGRAMM_EIN         I3_PID_FZD_DWA_ALARM_AUSGELOEST, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_SINE_LIN_TELEGRAMM_EIN"
+#define I3_FLD_FZD_STAT_DWA_ALARM_PANIKALARM_EIN                 I3_PID_FZD_DWA_ALARM_AUSGELOEST, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DWA_ALARM_PANIKALARM_EIN"
+
+// 0xDCB1 I3_PID_FZD_DWA_VORHANDEN
+#define I3_FLD_FZD_STAT_VORHANDEN_DWA                            I3_PID_FZD_DWA_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_DWA"
+
+// 0xDCB2 I3_PID_FZD_DWA_USIS_EMPFINDLICHKEIT
+#define I3_FLD_FZD_STAT_IRS_SENS_EMPFINDLICHKEIT_NR              I3_PID_FZD_DWA_USIS_EMPFINDLICHKEIT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_IRS_SENS_EMPFINDLICHKEIT_NR"
+
+// 0xDCDD I3_PID_FZD_DWA_KLAPPENKONTAKTE
+#define I3_FLD_FZD_STAT_KONTAKT_FAHRERTUER_NR                    I3_PID_FZD_DWA_KLAPPENKONTAKTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_FAHRERTUER_NR"
+#define I3_FLD_FZD_STAT_KONTAKT_BEIFAHRERTUER_NR                 I3_PID_FZD_DWA_KLAPPENKONTAKTE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_BEIFAHRERTUER_NR"
+#define I3_FLD_FZD_STAT_KONTAKT_FAHRERTUER_HINTEN_NR             I3_PID_FZD_DWA_KLAPPENKONTAKTE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_FAHRERTUER_HINTEN_NR"
+#define I3_FLD_FZD_STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR          I3_PID_FZD_DWA_KLAPPENKONTAKTE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR"
+#define I3_FLD_FZD_STAT_KONTAKT_MOTORHAUBE_NR                    I3_PID_FZD_DWA_KLAPPENKONTAKTE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_MOTORHAUBE_NR"
+#define I3_FLD_FZD_STAT_KONTAKT_HECKKLAPPE_NR                    I3_PID_FZD_DWA_KLAPPENKONTAKTE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_HECKKLAPPE_NR"
+#define I3_FLD_FZD_STAT_KONTAKT_HECKSCHEIBE_NR                   I3_PID_FZD_DWA_KLAPPENKONTAKTE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KONTAKT_HECKSCHEIBE_NR"
+#define I3_FLD_FZD_STAT_ZV_NR                                    I3_PID_FZD_DWA_KLAPPENKONTAKTE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZV_NR"
+#define I3_FLD_FZD_STAT_RESERVE_WERT                             I3_PID_FZD_DWA_KLAPPENKONTAKTE, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RESERVE_WERT"
+
+// 0x4107 I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE
+#define I3_FLD_FZD_STAT_SCHLIESSZEIT_WERT                        I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE, 256, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHLIESSZEIT_WERT"
+#define I3_FLD_FZD_STAT_BN_SPANNUNG_WERT                         I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE, 258, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BN_SPANNUNG_WERT"
+#define I3_FLD_FZD_STAT_SPIEL_WERT                               I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE, 259, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SPIEL_WERT"
+#define I3_FLD_FZD_STAT_GUELTIGKEIT                              I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE, 260, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GUELTIGKEIT"
+#define I3_FLD_FZD_STAT_BEWERTUNG                                I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE, 261, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEWERTUNG"
+#define I3_FLD_FZD_STAT_REGELVERLETZUNG_WERT                     I3_PID_FZD_ESH_BEWERTUNG_KENNLINIE_SCHIEBELAGE, 262, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REGELVERLETZUNG_WERT"
+
+// 0x4108 I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1
+#define I3_FLD_FZD_STAT_SCHLIESSZEIT_WERT_0X4108                 I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1, 256, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHLIESSZEIT_WERT_0X4108"
+#define I3_FLD_FZD_STAT_BN_SPANNUNG_WERT_0X4108                  I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1, 258, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BN_SPANNUNG_WERT_0X4108"
+#define I3_FLD_FZD_STAT_SPIEL_WERT_0X4108                        I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1, 259, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SPIEL_WERT_0X4108"
+#define I3_FLD_FZD_STAT_GUELTIGKEIT_0X4108                       I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1, 260, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GUELTIGKEIT_0X4108"
+#define I3_FLD_FZD_STAT_BEWERTUNG_0X4108                         I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1, 261, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEWERTUNG_0X4108"
+#define I3_FLD_FZD_STAT_REGELVERLETZUNG_WERT_0X4108              I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_AUSSTELLLAGE_1, 262, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REGELVERLETZUNG_WERT_0X4108"
+
+// 0x4109 I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1
+#define I3_FLD_FZD_STAT_SCHLIESSZEIT_WERT_0X4109                 I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1, 256, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHLIESSZEIT_WERT_0X4109"
+#define I3_FLD_FZD_STAT_BN_SPANNUNG_WERT_0X4109                  I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1, 258, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BN_SPANNUNG_WERT_0X4109"
+#define I3_FLD_FZD_STAT_SPIEL_WERT_0X4109                        I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1, 259, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SPIEL_WERT_0X4109"
+#define I3_FLD_FZD_STAT_GUELTIGKEIT_0X4109                       I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1, 260, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GUELTIGKEIT_0X4109"
+#define I3_FLD_FZD_STAT_BEWERTUNG_0X4109                         I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1, 261, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BEWERTUNG_0X4109"
+#define I3_FLD_FZD_STAT_REGELVERLETZUNG_WERT_0X4109              I3_PID_FZD_SHD_BEWERTUNG_KENNLINIE_SCHIEBELAGE_1, 262, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REGELVERLETZUNG_WERT_0X4109"
+
+// 0x6012 I3_PID_FZD_DWA_ALARM_ANZAHL
+#define I3_FLD_FZD_STAT_FZD_ALARM_MOTORHAUBE_WERT                I3_PID_FZD_DWA_ALARM_ANZAHL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_MOTORHAUBE_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_FAT_WERT                       I3_PID_FZD_DWA_ALARM_ANZAHL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_FAT_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_BFT_WERT                       I3_PID_FZD_DWA_ALARM_ANZAHL, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_BFT_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_FATH_WERT                      I3_PID_FZD_DWA_ALARM_ANZAHL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_FATH_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_BFTH_WERT                      I3_PID_FZD_DWA_ALARM_ANZAHL, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_BFTH_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_HECKKLAPPE_WERT                I3_PID_FZD_DWA_ALARM_ANZAHL, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_HECKKLAPPE_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_HECKSCHEIBE_WERT               I3_PID_FZD_DWA_ALARM_ANZAHL, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_HECKSCHEIBE_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_OBD_KOMMUNIKATION_WERT         I3_PID_FZD_DWA_ALARM_ANZAHL, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_OBD_KOMMUNIKATION_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_LEITUNGSUEBERWACHUNG_SINE_WERT I3_PID_FZD_DWA_ALARM_ANZAHL, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_LEITUNGSUEBERWACHUNG_SINE_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_MANIPULATION_AUTH_WERT         I3_PID_FZD_DWA_ALARM_ANZAHL, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_MANIPULATION_AUTH_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_USIS_KANAL_A_UND_B_WERT        I3_PID_FZD_DWA_ALARM_ANZAHL, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_USIS_KANAL_A_UND_B_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_USIS_KANAL_A_WERT              I3_PID_FZD_DWA_ALARM_ANZAHL, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_USIS_KANAL_A_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_USIS_KANAL_B_WERT              I3_PID_FZD_DWA_ALARM_ANZAHL, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_USIS_KANAL_B_WERT"
+#define I3_FLD_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_WERT          I3_PID_FZD_DWA_ALARM_ANZAHL, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SINE_ALARM_NEIGUNGSGEBER_X_WERT"
+#define I3_FLD_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_Y_WERT          I3_PID_FZD_DWA_ALARM_ANZAHL, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SINE_ALARM_NEIGUNGSGEBER_Y_WERT"
+#define I3_FLD_FZD_STAT_SINE_ALARM_NEIGUNGSGEBER_X_UND_Y_WERT    I3_PID_FZD_DWA_ALARM_ANZAHL, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SINE_ALARM_NEIGUNGSGEBER_X_UND_Y_WERT"
+#define I3_FLD_FZD_STAT_SINE_ALARM_SPANNUNG_WERT                 I3_PID_FZD_DWA_ALARM_ANZAHL, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SINE_ALARM_SPANNUNG_WERT"
+#define I3_FLD_FZD_STAT_SINE_ALARM_LIN_TELEGRAMM_WERT            I3_PID_FZD_DWA_ALARM_ANZAHL, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SINE_ALARM_LIN_TELEGRAMM_WERT"
+#define I3_FLD_FZD_STAT_FZD_ALARM_PANIKALARM_WERT                I3_PID_FZD_DWA_ALARM_ANZAHL, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FZD_ALARM_PANIKALARM_WERT"
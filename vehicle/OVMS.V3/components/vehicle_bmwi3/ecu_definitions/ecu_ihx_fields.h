@@ -0,0 +1,448 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ihx_i1.json: IHX 78: Integrated automatic heating/aircon
+// This generated code  makes it easier to process CANBUS messages from the IHX ecu in a BMW i3
+//
+
+// 0xA11B I3_PID_IHX_EDH_VERRIEGELUNG
+#define I3_FLD_IHX_STAT_EDH_VERRIEGELUNG_AKTIV                   I3_PID_IHX_EDH_VERRIEGELUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EDH_VERRIEGELUNG_AKTIV"
+#define I3_FLD_IHX_STAT_EDH_VERRIEGELUNG_ZAEHLER_WERT            I3_PID_IHX_EDH_VERRIEGELUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EDH_VERRIEGELUNG_ZAEHLER_WERT"
+
+// 0xA11C I3_PID_IHX_WP_BEFUELLUNG
+#define I3_FLD_IHX_STAT_WP_BEFUELLUNG                            I3_PID_IHX_WP_BEFUELLUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WP_BEFUELLUNG"
+
+// 0xA11D I3_PID_IHX_WP_EXP_VENTIL_KALIBRIEREN
+#define I3_FLD_IHX_STAT_KALIBRIERUNG                             I3_PID_IHX_WP_EXP_VENTIL_KALIBRIEREN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KALIBRIERUNG"
+
+// 0xD15D I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_LINKS
+#define I3_FLD_IHX_STAT_TASTER_SITZHEIZUNG_VORNE_LINKS_EIN       I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_LINKS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_VORNE_LINKS_EIN"
+
+// 0xD15E I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_RECHTS
+#define I3_FLD_IHX_STAT_TASTER_SITZHEIZUNG_VORNE_RECHTS_EIN      I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_RECHTS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TASTER_SITZHEIZUNG_VORNE_RECHTS_EIN"
+
+// 0xD15F I3_PID_IHX_SITZHEIZUNG_VORNE_LED_RECHTS
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE1_EIN  I3_PID_IHX_SITZHEIZUNG_VORNE_LED_RECHTS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE1_EIN"
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE2_EIN  I3_PID_IHX_SITZHEIZUNG_VORNE_LED_RECHTS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE2_EIN"
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE3_EIN  I3_PID_IHX_SITZHEIZUNG_VORNE_LED_RECHTS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_STUFE3_EIN"
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_RECHTS_NR          I3_PID_IHX_SITZHEIZUNG_VORNE_LED_RECHTS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_RECHTS_NR"
+
+// 0xD160 I3_PID_IHX_SITZHEIZUNG_VORNE_LED_LINKS
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE1_EIN   I3_PID_IHX_SITZHEIZUNG_VORNE_LED_LINKS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE1_EIN"
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE2_EIN   I3_PID_IHX_SITZHEIZUNG_VORNE_LED_LINKS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE2_EIN"
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE3_EIN   I3_PID_IHX_SITZHEIZUNG_VORNE_LED_LINKS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_STUFE3_EIN"
+#define I3_FLD_IHX_STAT_LED_SITZHEIZUNG_VORNE_LINKS_NR           I3_PID_IHX_SITZHEIZUNG_VORNE_LED_LINKS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_SITZHEIZUNG_VORNE_LINKS_NR"
+
+// 0xD599 I3_PID_IHX_FBM_TASTEN_VORHANDEN_WERT
+#define I3_FLD_IHX_STAT_FBM_TASTEN_VORHANDEN_WERT                I3_PID_IHX_FBM_TASTEN_VORHANDEN_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FBM_TASTEN_VORHANDEN_WERT"
+
+// 0xD859 I3_PID_IHX_TEMP_FUSSRAUM_LINKS_WERT
+#define I3_FLD_IHX_STAT_TEMP_FUSSRAUM_LINKS_WERT                 I3_PID_IHX_TEMP_FUSSRAUM_LINKS_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_FUSSRAUM_LINKS_WERT"
+
+// 0xD85A I3_PID_IHX_TEMP_FUSSRAUM_RECHTS_WERT
+#define I3_FLD_IHX_STAT_TEMP_FUSSRAUM_RECHTS_WERT                I3_PID_IHX_TEMP_FUSSRAUM_RECHTS_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_FUSSRAUM_RECHTS_WERT"
+
+// 0xD85C I3_PID_IHX_TEMP_INNEN_UNBELUEFTET
+#define I3_FLD_IHX_STAT_TEMP_INNEN_WERT                          I3_PID_IHX_TEMP_INNEN_UNBELUEFTET, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_INNEN_WERT"
+
+// 0xD860 I3_PID_IHX_BUS_IN_POTI_SCHICHTUNG_FOND_WERT
+#define I3_FLD_IHX_STAT_BUS_IN_POTI_SCHICHTUNG_FOND_WERT         I3_PID_IHX_BUS_IN_POTI_SCHICHTUNG_FOND_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_POTI_SCHICHTUNG_FOND_WERT"
+
+// 0xD866 I3_PID_IHX_KONFIGURATION_KLIMA_VORN
+#define I3_FLD_IHX_STAT_VORHANDEN_ZUSATZWASSERPUMPE              I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_ZUSATZWASSERPUMPE"
+#define I3_FLD_IHX_STAT_KLIMA_DISPLAY_EINHEIT_NR                 I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_DISPLAY_EINHEIT_NR"
+#define I3_FLD_IHX_STAT_KLIMA_VARIANTE_NR                        I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VARIANTE_NR"
+#define I3_FLD_IHX_STAT_VORHANDEN_EMOTORWASSERPUMPE              I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_EMOTORWASSERPUMPE"
+#define I3_FLD_IHX_STAT_VORHANDEN_KOMPRESSORKUPPLUNG             I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_KOMPRESSORKUPPLUNG"
+#define I3_FLD_IHX_STAT_VORHANDEN_PTC_VORN                       I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_PTC_VORN"
+#define I3_FLD_IHX_STAT_VORHANDEN_UMWAELZPUMPE                   I3_PID_IHX_KONFIGURATION_KLIMA_VORN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_UMWAELZPUMPE"
+
+// 0xD868 I3_PID_IHX_KAELTEMITTEL_MEDIUM
+#define I3_FLD_IHX_STAT_KAELTEMITTEL_MEDIUM_NR                   I3_PID_IHX_KAELTEMITTEL_MEDIUM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAELTEMITTEL_MEDIUM_NR"
+
+// 0xD88D I3_PID_IHX_STEUERN_MOTOREN_KALIBRIERLAUF
+
+// 0xD88E I3_PID_IHX_SCHRITTMOTOR_FEHLER
+#define I3_FLD_IHX_STAT_SCHRITTMOTOR_BLOCKIERUNG_WERT            I3_PID_IHX_SCHRITTMOTOR_FEHLER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHRITTMOTOR_BLOCKIERUNG_WERT"
+#define I3_FLD_IHX_STAT_SCHRITTMOTOR_ANTWORT_FEHLT_WERT          I3_PID_IHX_SCHRITTMOTOR_FEHLER, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHRITTMOTOR_ANTWORT_FEHLT_WERT"
+#define I3_FLD_IHX_STAT_SCHRITTMOTOR_INTERNER_FEHLER_WERT        I3_PID_IHX_SCHRITTMOTOR_FEHLER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHRITTMOTOR_INTERNER_FEHLER_WERT"
+#define I3_FLD_IHX_STAT_SCHRITTMOTOR_INITIALISIERUNG_FEHLER_WERT I3_PID_IHX_SCHRITTMOTOR_FEHLER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SCHRITTMOTOR_INITIALISIERUNG_FEHLER_WERT"
+
+// 0xD88F I3_PID_IHX_STEUERN_SELBSTTEST_SCHRITTMOTOREN
+
+// 0xD8AA I3_PID_IHX_VORHANDEN_FONDSCHICHTUNG
+#define I3_FLD_IHX_STAT_VORHANDEN_FONDSCHICHTUNGSPOTI            I3_PID_IHX_VORHANDEN_FONDSCHICHTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_FONDSCHICHTUNGSPOTI"
+
+// 0xD8AB I3_PID_IHX_SOLARSENSOR_VORHANDEN
+#define I3_FLD_IHX_STAT_VORHANDEN_SOLARSENSOR_EIN                I3_PID_IHX_SOLARSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SOLARSENSOR_EIN"
+
+// 0xD8AC I3_PID_IHX_AUC_SENSOR_VORHANDEN
+#define I3_FLD_IHX_STAT_VORHANDEN_AUC_SENSOR                     I3_PID_IHX_AUC_SENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_AUC_SENSOR"
+
+// 0xD8C2 I3_PID_IHX_EKK_DREHZAHLERHOEHUNG
+#define I3_FLD_IHX_STAT_EKK_DREHZAHLERHOEHUNG_EIN                I3_PID_IHX_EKK_DREHZAHLERHOEHUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EKK_DREHZAHLERHOEHUNG_EIN"
+
+// 0xD8C4 I3_PID_IHX_EKMV_ANALOGWERTE_GEN20
+#define I3_FLD_IHX_STAT_DREHZAHL_WERT                            I3_PID_IHX_EKMV_ANALOGWERTE_GEN20, 0, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_DREHZAHL_WERT"
+#define I3_FLD_IHX_STAT_LEISTUNG_WERT                            I3_PID_IHX_EKMV_ANALOGWERTE_GEN20, 1, PID_FIELD_UINT8, 0.04f, 0.0f, "STAT_LEISTUNG_WERT"
+#define I3_FLD_IHX_STAT_STROM_DC_WERT                            I3_PID_IHX_EKMV_ANALOGWERTE_GEN20, 2, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_STROM_DC_WERT"
+#define I3_FLD_IHX_STAT_HOCHSPANNUNG_WERT                        I3_PID_IHX_EKMV_ANALOGWERTE_GEN20, 3, PID_FIELD_UINT8, 2.0f, 0.0f, "STAT_HOCHSPANNUNG_WERT"
+#define I3_FLD_IHX_STAT_TEMPERATUR_WERT                          I3_PID_IHX_EKMV_ANALOGWERTE_GEN20, 4, PID_FIELD_UINT8, 1.0f, -50.0f, "STAT_TEMPERATUR_WERT"
+#define I3_FLD_IHX_STAT_STROM_AC_WERT                            I3_PID_IHX_EKMV_ANALOGWERTE_GEN20, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STROM_AC_WERT"
+
+// 0xD8C5 I3_PID_IHX_EKMV_BETRIEBSZUSTAND_GEN20
+#define I3_FLD_IHX_RES_0xD8C5_D                                  I3_PID_IHX_EKMV_BETRIEBSZUSTAND_GEN20, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0xD8C5_D"
+
+// 0xD8CD I3_PID_IHX_EDH_STATUS
+#define I3_FLD_IHX_STAT_TEMPERATUR_WASSERAUSTRITT_WERT           I3_PID_IHX_EDH_STATUS, 0, PID_FIELD_UINT16, 1.0f, -40.0f, "STAT_TEMPERATUR_WASSERAUSTRITT_WERT"
+#define I3_FLD_IHX_STAT_STROM_WERT                               I3_PID_IHX_EDH_STATUS, 2, PID_FIELD_UINT16, 0.2f, 0.0f, "STAT_STROM_WERT"
+#define I3_FLD_IHX_STAT_HOCHVOLTSPANNUNG_WERT                    I3_PID_IHX_EDH_STATUS, 4, PID_FIELD_UINT16, 2.0f, 0.0f, "STAT_HOCHVOLTSPANNUNG_WERT"
+#define I3_FLD_IHX_STAT_ZAEHLER_VERRIEGELUNG_WERT                I3_PID_IHX_EDH_STATUS, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZAEHLER_VERRIEGELUNG_WERT"
+
+// 0xD8CE I3_PID_IHX_KONFIGURATION_KLIMA_PRODUKTLINIE
+#define I3_FLD_IHX_STAT_KLIMA_PRODUKTLINIE                       I3_PID_IHX_KONFIGURATION_KLIMA_PRODUKTLINIE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_PRODUKTLINIE"
+
+// 0xD8D2 I3_PID_IHX_BUS_IN_HV_POWERMANAGEMENT
+#define I3_FLD_IHX_STAT_FREIGABE_KLIMAKOMPRESSOR                 I3_PID_IHX_BUS_IN_HV_POWERMANAGEMENT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREIGABE_KLIMAKOMPRESSOR"
+#define I3_FLD_IHX_STAT_LEISTUNG_KLIMAKOMPRESSOR_MAXIMAL_WERT    I3_PID_IHX_BUS_IN_HV_POWERMANAGEMENT, 1, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_LEISTUNG_KLIMAKOMPRESSOR_MAXIMAL_WERT"
+
+// 0xD8D3 I3_PID_IHX_BUS_IN_HV_PM_EDH
+#define I3_FLD_IHX_STAT_FREIGABE_EDH                             I3_PID_IHX_BUS_IN_HV_PM_EDH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREIGABE_EDH"
+#define I3_FLD_IHX_STAT_LEISTUNG_EDH_MAXIMAL_WERT                I3_PID_IHX_BUS_IN_HV_PM_EDH, 1, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_LEISTUNG_EDH_MAXIMAL_WERT"
+
+// 0xD8D4 I3_PID_IHX_BUS_IN_KUEHLMITTELTEMPERATUR
+#define I3_FLD_IHX_STAT_BUS_IN_KUEHLMITTEL_MOTOR_TEMP_WERT       I3_PID_IHX_BUS_IN_KUEHLMITTELTEMPERATUR, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BUS_IN_KUEHLMITTEL_MOTOR_TEMP_WERT"
+
+// 0xD902 I3_PID_IHX_SOLLWERT_ELEKTRISCHER_ZUHEIZER_VORN
+#define I3_FLD_IHX_STAT_SOLLWERT_ELEKTRISCHER_ZUHEIZER_WERT      I3_PID_IHX_SOLLWERT_ELEKTRISCHER_ZUHEIZER_VORN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOLLWERT_ELEKTRISCHER_ZUHEIZER_WERT"
+
+// 0xD904 I3_PID_IHX_BUS_OUT_ZUSATZWASSERPUMPE_EIN
+#define I3_FLD_IHX_STAT_BUS_OUT_ZUSATZWASSERPUMPE_EIN            I3_PID_IHX_BUS_OUT_ZUSATZWASSERPUMPE_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_OUT_ZUSATZWASSERPUMPE_EIN"
+
+// 0xD905 I3_PID_IHX_TIMER_EINLAUFSCHUTZ
+#define I3_FLD_IHX_STAT_TIMER_EINLAUFSCHUTZ_WERT                 I3_PID_IHX_TIMER_EINLAUFSCHUTZ, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TIMER_EINLAUFSCHUTZ_WERT"
+#define I3_FLD_IHX_STAT_TIMER_START_WERT                         I3_PID_IHX_TIMER_EINLAUFSCHUTZ, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TIMER_START_WERT"
+
+// 0xD90E I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_VORHANDEN
+#define I3_FLD_IHX_STAT_VORHANDEN_SITZHEIZUNG_TASTER_VORNE       I3_PID_IHX_SITZHEIZUNG_VORNE_TASTER_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SITZHEIZUNG_TASTER_VORNE"
+
+// 0xD916 I3_PID_IHX_VORHANDEN_KOMPRESSORKUPPLUNG
+#define I3_FLD_IHX_STAT_VORHANDEN_KOMPRESSORKUPPLUNG_0XD916      I3_PID_IHX_VORHANDEN_KOMPRESSORKUPPLUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_KOMPRESSORKUPPLUNG_0XD916"
+
+// 0xD91A I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE
+#define I3_FLD_IHX_STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR       I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR"
+#define I3_FLD_IHX_STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR      I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR"
+
+// 0xD91D I3_PID_IHX_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT
+#define I3_FLD_IHX_STAT_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT         I3_PID_IHX_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_OUT_KLIMAKOMPRESSOR_PWM_WERT"
+
+// 0xD928 I3_PID_IHX_KLIMA_VORN_KLAPPEN_PRG_MITTE
+#define I3_FLD_IHX_STAT_KLIMA_VORN_KLAPPEN_PRG_MITTE             I3_PID_IHX_KLIMA_VORN_KLAPPEN_PRG_MITTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_KLAPPEN_PRG_MITTE"
+
+// 0xD92B I3_PID_IHX_KLIMA_VORN_GEBLAESESTUFE_ANZ
+#define I3_FLD_IHX_STAT_KLIMA_VORN_GEBLAESESTUFE_ANZ_WERT        I3_PID_IHX_KLIMA_VORN_GEBLAESESTUFE_ANZ, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_GEBLAESESTUFE_ANZ_WERT"
+
+// 0xD92C I3_PID_IHX_KLIMA_VORN_OFF_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_OFF_EIN                       I3_PID_IHX_KLIMA_VORN_OFF_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_OFF_EIN"
+
+// 0xD92D I3_PID_IHX_KLIMA_VORN_PRG_DEFROST_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_DEFROST_EIN               I3_PID_IHX_KLIMA_VORN_PRG_DEFROST_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_DEFROST_EIN"
+
+// 0xD92E I3_PID_IHX_KLIMA_VORN_PRG_MAX_AC_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_MAX_AC_EIN                I3_PID_IHX_KLIMA_VORN_PRG_MAX_AC_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_MAX_AC_EIN"
+
+// 0xD930 I3_PID_IHX_KLIMA_VORN_PRG_AUC_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_AUC_EIN                   I3_PID_IHX_KLIMA_VORN_PRG_AUC_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_AUC_EIN"
+
+// 0xD931 I3_PID_IHX_KLIMA_VORN_PRG_UMLUFT_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_UMLUFT_EIN                I3_PID_IHX_KLIMA_VORN_PRG_UMLUFT_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_UMLUFT_EIN"
+
+// 0xD932 I3_PID_IHX_KLIMA_VORN_PRG_HHS_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_HHS_EIN                   I3_PID_IHX_KLIMA_VORN_PRG_HHS_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_HHS_EIN"
+
+// 0xD934 I3_PID_IHX_KLIMA_VORN_PRG_AC_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_AC_EIN                    I3_PID_IHX_KLIMA_VORN_PRG_AC_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_AC_EIN"
+
+// 0xD936 I3_PID_IHX_KLIMA_VORN_PRG_KLIMASTIL_MITTE
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_KLIMASTIL_MITTE_WERT      I3_PID_IHX_KLIMA_VORN_PRG_KLIMASTIL_MITTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_KLIMASTIL_MITTE_WERT"
+
+// 0xD939 I3_PID_IHX_KLIMA_VORN_PRG_STANDLUEFTEN_EIN
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_STANDLUEFTEN_EIN          I3_PID_IHX_KLIMA_VORN_PRG_STANDLUEFTEN_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_STANDLUEFTEN_EIN"
+
+// 0xD93F I3_PID_IHX_KLIMA_VORN_GEBLAESELEISTUNG_WERT
+#define I3_FLD_IHX_STAT_KLIMA_VORN_GEBLAESELEISTUNG_WERT         I3_PID_IHX_KLIMA_VORN_GEBLAESELEISTUNG_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_GEBLAESELEISTUNG_WERT"
+
+// 0xD941 I3_PID_IHX_KLP_POS_DEFROST_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_DEFROST_WERT                  I3_PID_IHX_KLP_POS_DEFROST_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_DEFROST_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_DEFROST_WERT                 I3_PID_IHX_KLP_POS_DEFROST_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_DEFROST_WERT"
+
+// 0xD942 I3_PID_IHX_KLP_POS_BELUEFTUNG_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_BELUEFTUNG_WERT               I3_PID_IHX_KLP_POS_BELUEFTUNG_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_BELUEFTUNG_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_BELUEFTUNG_WERT              I3_PID_IHX_KLP_POS_BELUEFTUNG_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_BELUEFTUNG_WERT"
+
+// 0xD947 I3_PID_IHX_KLP_POS_FUSSRAUM_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_FUSSRAUM_WERT                 I3_PID_IHX_KLP_POS_FUSSRAUM_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_FUSSRAUM_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_FUSSRAUM_WERT                I3_PID_IHX_KLP_POS_FUSSRAUM_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_FUSSRAUM_WERT"
+
+// 0xD949 I3_PID_IHX_KLP_POS_SCHICHTUNG_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_SCHICHTUNG_WERT               I3_PID_IHX_KLP_POS_SCHICHTUNG_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_SCHICHTUNG_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_SCHICHTUNG_WERT              I3_PID_IHX_KLP_POS_SCHICHTUNG_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_SCHICHTUNG_WERT"
+
+// 0xD94A I3_PID_IHX_KLP_POS_SCHICHTUNG_LI_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_SCHICHTUNG_LI_WERT            I3_PID_IHX_KLP_POS_SCHICHTUNG_LI_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_SCHICHTUNG_LI_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_SCHICHTUNG_LI_WERT           I3_PID_IHX_KLP_POS_SCHICHTUNG_LI_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_SCHICHTUNG_LI_WERT"
+
+// 0xD94B I3_PID_IHX_KLP_POS_SCHICHTUNG_RE_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_SCHICHTUNG_RE_WERT            I3_PID_IHX_KLP_POS_SCHICHTUNG_RE_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_SCHICHTUNG_RE_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_SCHICHTUNG_RE_WERT           I3_PID_IHX_KLP_POS_SCHICHTUNG_RE_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_SCHICHTUNG_RE_WERT"
+
+// 0xD94D I3_PID_IHX_KLP_POS_UMLUFT_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_UMLUFT_WERT                   I3_PID_IHX_KLP_POS_UMLUFT_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_UMLUFT_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_UMLUFT_WERT                  I3_PID_IHX_KLP_POS_UMLUFT_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_UMLUFT_WERT"
+
+// 0xD950 I3_PID_IHX_KLP_POS_TEMP_LUFT_FOND_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_TEMP_LUFT_FOND_WERT           I3_PID_IHX_KLP_POS_TEMP_LUFT_FOND_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_TEMP_LUFT_FOND_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_TEMP_LUFT_FOND_WERT          I3_PID_IHX_KLP_POS_TEMP_LUFT_FOND_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_TEMP_LUFT_FOND_WERT"
+
+// 0xD953 I3_PID_IHX_MOTOR_KALIBRIERLAUF
+#define I3_FLD_IHX_STAT_KALIBRIERLAUF_NR                         I3_PID_IHX_MOTOR_KALIBRIERLAUF, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KALIBRIERLAUF_NR"
+#define I3_FLD_IHX_STAT_KALIBRIERLAUF_ERGEBNIS                   I3_PID_IHX_MOTOR_KALIBRIERLAUF, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KALIBRIERLAUF_ERGEBNIS"
+#define I3_FLD_IHX_STAT_MOTOR_1_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_1_NR"
+#define I3_FLD_IHX_STAT_MOTOR_2_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_2_NR"
+#define I3_FLD_IHX_STAT_MOTOR_3_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_3_NR"
+#define I3_FLD_IHX_STAT_MOTOR_4_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_4_NR"
+#define I3_FLD_IHX_STAT_MOTOR_5_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_5_NR"
+#define I3_FLD_IHX_STAT_MOTOR_6_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_6_NR"
+#define I3_FLD_IHX_STAT_MOTOR_7_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_7_NR"
+#define I3_FLD_IHX_STAT_MOTOR_8_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_8_NR"
+#define I3_FLD_IHX_STAT_MOTOR_9_NR                               I3_PID_IHX_MOTOR_KALIBRIERLAUF, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_9_NR"
+#define I3_FLD_IHX_STAT_MOTOR_10_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_10_NR"
+#define I3_FLD_IHX_STAT_MOTOR_11_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_11_NR"
+#define I3_FLD_IHX_STAT_MOTOR_12_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_12_NR"
+#define I3_FLD_IHX_STAT_MOTOR_13_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_13_NR"
+#define I3_FLD_IHX_STAT_MOTOR_14_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_14_NR"
+#define I3_FLD_IHX_STAT_MOTOR_15_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_15_NR"
+#define I3_FLD_IHX_STAT_MOTOR_16_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_16_NR"
+#define I3_FLD_IHX_STAT_MOTOR_17_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_17_NR"
+#define I3_FLD_IHX_STAT_MOTOR_18_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_18_NR"
+#define I3_FLD_IHX_STAT_MOTOR_19_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_19_NR"
+#define I3_FLD_IHX_STAT_MOTOR_20_NR                              I3_PID_IHX_MOTOR_KALIBRIERLAUF, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOTOR_20_NR"
+
+// 0xD954 I3_PID_IHX_SELBSTTEST_SCHRITTMOTORE
+#define I3_FLD_IHX_STAT_SELBSTTEST_SCHRITTMOTORE_NR              I3_PID_IHX_SELBSTTEST_SCHRITTMOTORE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SELBSTTEST_SCHRITTMOTORE_NR"
+
+// 0xD957 I3_PID_IHX_TEMP_BELUEFTUNG_LINKS_WERT
+#define I3_FLD_IHX_STAT_TEMP_BELUEFTUNG_LINKS_WERT               I3_PID_IHX_TEMP_BELUEFTUNG_LINKS_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_BELUEFTUNG_LINKS_WERT"
+
+// 0xD958 I3_PID_IHX_TEMP_BELUEFTUNG_RECHTS_WERT
+#define I3_FLD_IHX_STAT_TEMP_BELUEFTUNG_RECHTS_WERT              I3_PID_IHX_TEMP_BELUEFTUNG_RECHTS_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_BELUEFTUNG_RECHTS_WERT"
+
+// 0xD959 I3_PID_IHX_DRUCKSENSOR_VORHANDEN
+#define I3_FLD_IHX_STAT_DRUCKSENSOR_VORHANDEN                    I3_PID_IHX_DRUCKSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DRUCKSENSOR_VORHANDEN"
+
+// 0xD95A I3_PID_IHX_VORHANDEN_WASSERVENTIL
+#define I3_FLD_IHX_STAT_VORHANDEN_WASSERVENTIL_MONO              I3_PID_IHX_VORHANDEN_WASSERVENTIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_MONO"
+#define I3_FLD_IHX_STAT_VORHANDEN_WASSERVENTIL_DUO               I3_PID_IHX_VORHANDEN_WASSERVENTIL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_WASSERVENTIL_DUO"
+
+// 0xD95C I3_PID_IHX_TEMP_VERDAMPFER_WERT
+#define I3_FLD_IHX_STAT_TEMP_VERDAMPFER_WERT                     I3_PID_IHX_TEMP_VERDAMPFER_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_VERDAMPFER_WERT"
+
+// 0xD960 I3_PID_IHX_BUS_IN_KOMPRESSORFREIGABE
+#define I3_FLD_IHX_STAT_BUS_IN_KOMPRESSORFREIGABE_EIN            I3_PID_IHX_BUS_IN_KOMPRESSORFREIGABE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_KOMPRESSORFREIGABE_EIN"
+
+// 0xD962 I3_PID_IHX_BUS_IN_SOLARSENSOR_WERT
+#define I3_FLD_IHX_STAT_BUS_IN_SOLARSENSOR_LINKS_WERT            I3_PID_IHX_BUS_IN_SOLARSENSOR_WERT, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BUS_IN_SOLARSENSOR_LINKS_WERT"
+#define I3_FLD_IHX_STAT_BUS_IN_SOLARSENSOR_RECHTS_WERT           I3_PID_IHX_BUS_IN_SOLARSENSOR_WERT, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_BUS_IN_SOLARSENSOR_RECHTS_WERT"
+
+// 0xD964 I3_PID_IHX_BUS_IN_AUC_SENSOR_WERT
+#define I3_FLD_IHX_STAT_BUS_IN_AUC_SENSOR_WERT                   I3_PID_IHX_BUS_IN_AUC_SENSOR_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_AUC_SENSOR_WERT"
+
+// 0xD966 I3_PID_IHX_BUS_IN_BESCHLAGSENSOR_WERT
+#define I3_FLD_IHX_STAT_BUS_IN_BESCHLAGSENSOR_WERT               I3_PID_IHX_BUS_IN_BESCHLAGSENSOR_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_BESCHLAGSENSOR_WERT"
+
+// 0xD968 I3_PID_IHX_BUS_IN_KAELTEMITTELDRUCK_WERT
+#define I3_FLD_IHX_STAT_BUS_IN_R134A_DRUCK_WERT                  I3_PID_IHX_BUS_IN_KAELTEMITTELDRUCK_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_IN_R134A_DRUCK_WERT"
+
+// 0xD96B I3_PID_IHX_BUS_IN_TEMP_AUSSEN_WERT
+#define I3_FLD_IHX_STAT_BUS_IN_TEMP_AUSSEN_WERT                  I3_PID_IHX_BUS_IN_TEMP_AUSSEN_WERT, 0, PID_FIELD_SINT16, 0.5f, -40.0f, "STAT_BUS_IN_TEMP_AUSSEN_WERT"
+
+// 0xD96D I3_PID_IHX_BESCHLAGSENSOR_VORHANDEN
+#define I3_FLD_IHX_STAT_VORHANDEN_BESCHLAGSENSOR                 I3_PID_IHX_BESCHLAGSENSOR_VORHANDEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_BESCHLAGSENSOR"
+
+// 0xD977 I3_PID_IHX_KLIMA_TEMPERATUR_SOLLWERT
+#define I3_FLD_IHX_STAT_KLIMA_VORNE_SOLLTEMP_LINKS_WERT          I3_PID_IHX_KLIMA_TEMPERATUR_SOLLWERT, 0, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_KLIMA_VORNE_SOLLTEMP_LINKS_WERT"
+#define I3_FLD_IHX_STAT_KLIMA_VORNE_SOLLTEMP_RECHTS_WERT         I3_PID_IHX_KLIMA_TEMPERATUR_SOLLWERT, 1, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_KLIMA_VORNE_SOLLTEMP_RECHTS_WERT"
+
+// 0xD97B I3_PID_IHX_KLIMA_LIN_1_ADRESSEN
+#define I3_FLD_IHX_STAT_SLAVE1_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE1_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE2_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE2_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE3_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE3_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE4_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE4_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE5_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 8, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE5_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE6_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 10, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE6_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE7_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 12, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE7_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE8_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 14, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE8_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE9_ADR_WERT                          I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 16, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE9_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE10_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 18, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE10_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE11_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 20, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE11_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE12_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 22, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE12_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE13_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 24, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE13_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE14_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 26, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE14_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE15_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 28, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE15_ADR_WERT"
+#define I3_FLD_IHX_STAT_SLAVE16_ADR_WERT                         I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 30, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SLAVE16_ADR_WERT"
+#define I3_FLD_IHX_STAT_MOT_0X3F_WERT                            I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 32, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_MOT_0X3F_WERT"
+#define I3_FLD_IHX_STAT_FEHLERSTATUS_WERT                        I3_PID_IHX_KLIMA_LIN_1_ADRESSEN, 34, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_FEHLERSTATUS_WERT"
+
+// 0xD97C I3_PID_IHX_STEUERN_RESET_LIN
+
+// 0xD980 I3_PID_IHX_KLAPPEN_VERSTELLBEREICH
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE1_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE1_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE2_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE2_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE3_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE3_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE4_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE4_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE5_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 8, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE5_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE6_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 10, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE6_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE7_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 12, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE7_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE8_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 14, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE8_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE9_WERT             I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 16, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE9_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE10_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 18, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE10_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE11_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 20, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE11_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE12_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 22, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE12_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE13_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 24, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE13_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE14_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 26, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE14_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE15_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 28, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE15_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE16_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 30, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE16_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE17_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 32, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE17_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE18_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 34, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE18_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE19_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 36, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE19_WERT"
+#define I3_FLD_IHX_STAT_VERSTELLBEREICH_KLAPPE20_WERT            I3_PID_IHX_KLAPPEN_VERSTELLBEREICH, 38, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VERSTELLBEREICH_KLAPPE20_WERT"
+
+// 0xD981 I3_PID_IHX_STEUERN_AUTOADR_KLAPPENMOTOREN
+
+// 0xD988 I3_PID_IHX_KLIMA_TEMPERATUR_MITTE_SOLLWERT
+#define I3_FLD_IHX_STAT_KLIMA_SOLLTEMP_MITTE_WERT                I3_PID_IHX_KLIMA_TEMPERATUR_MITTE_SOLLWERT, 0, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_KLIMA_SOLLTEMP_MITTE_WERT"
+
+// 0xD98A I3_PID_IHX_KLP_POS_MISCHLUFT_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_MISCHLUFT_WERT                I3_PID_IHX_KLP_POS_MISCHLUFT_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_MISCHLUFT_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_MISCHLUFT_WERT               I3_PID_IHX_KLP_POS_MISCHLUFT_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_MISCHLUFT_WERT"
+
+// 0xD98B I3_PID_IHX_KLP_POS_ZENTRALANTRIEB_WERT
+#define I3_FLD_IHX_STAT_MOT_ISTPOS_ZENTRALANTRIEB_WERT           I3_PID_IHX_KLP_POS_ZENTRALANTRIEB_WERT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_MOT_ISTPOS_ZENTRALANTRIEB_WERT"
+#define I3_FLD_IHX_STAT_MOT_SOLLPOS_ZENTRALANTRIEB_WERT          I3_PID_IHX_KLP_POS_ZENTRALANTRIEB_WERT, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_MOT_SOLLPOS_ZENTRALANTRIEB_WERT"
+
+// 0xD98C I3_PID_IHX_KLP_POS_MISCHLUFT_LINKS_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_MISCHLUFT_LINKS_WERT          I3_PID_IHX_KLP_POS_MISCHLUFT_LINKS_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_MISCHLUFT_LINKS_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_MISCHLUFT_LINKS_WERT         I3_PID_IHX_KLP_POS_MISCHLUFT_LINKS_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_MISCHLUFT_LINKS_WERT"
+
+// 0xD98E I3_PID_IHX_KLP_POS_MISCHLUFT_RECHTS_WERT
+#define I3_FLD_IHX_STAT_KLP_ISTPOS_MISCHLUFT_RECHTS_WERT         I3_PID_IHX_KLP_POS_MISCHLUFT_RECHTS_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_ISTPOS_MISCHLUFT_RECHTS_WERT"
+#define I3_FLD_IHX_STAT_KLP_SOLLPOS_MISCHLUFT_RECHTS_WERT        I3_PID_IHX_KLP_POS_MISCHLUFT_RECHTS_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLP_SOLLPOS_MISCHLUFT_RECHTS_WERT"
+
+// 0xD98F I3_PID_IHX_MIKROSCHALTER_ZENTRALANTRIEB
+#define I3_FLD_IHX_STAT_MIKROSCHALTER_ZENTRALANTRIEB_EIN         I3_PID_IHX_MIKROSCHALTER_ZENTRALANTRIEB, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIKROSCHALTER_ZENTRALANTRIEB_EIN"
+
+// 0xD990 I3_PID_IHX_TEMP_BELUEFTUNG_WERT
+#define I3_FLD_IHX_STAT_TEMP_BELUEFTUNG_WERT                     I3_PID_IHX_TEMP_BELUEFTUNG_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_BELUEFTUNG_WERT"
+
+// 0xD991 I3_PID_IHX_TEMP_FUSSRAUM_WERT
+#define I3_FLD_IHX_STAT_TEMP_FUSSRAUM_WERT                       I3_PID_IHX_TEMP_FUSSRAUM_WERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_FUSSRAUM_WERT"
+
+// 0xD995 I3_PID_IHX_VORHANDEN_AUDIOBEDIENTEIL
+#define I3_FLD_IHX_STAT_VORHANDEN_AUDIOBEDIENTEIL                I3_PID_IHX_VORHANDEN_AUDIOBEDIENTEIL, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_VORHANDEN_AUDIOBEDIENTEIL"
+
+// 0xD998 I3_PID_IHX_POTI_SCHICHTUNG_MITTE_WERT
+#define I3_FLD_IHX_STAT_POTI_SCHICHTUNG_MITTE_WERT               I3_PID_IHX_POTI_SCHICHTUNG_MITTE_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_POTI_SCHICHTUNG_MITTE_WERT"
+
+// 0xD99C I3_PID_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT
+#define I3_FLD_IHX_STAT_MOT_ISTPOS_BEL_FUSS_LINKS_WERT           I3_PID_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOT_ISTPOS_BEL_FUSS_LINKS_WERT"
+#define I3_FLD_IHX_STAT_MOT_ISTPOS_BEL_FUSS_RECHTS_WERT          I3_PID_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOT_ISTPOS_BEL_FUSS_RECHTS_WERT"
+#define I3_FLD_IHX_STAT_MOT_SOLLPOS_BEL_FUSS_LINKS_WERT          I3_PID_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOT_SOLLPOS_BEL_FUSS_LINKS_WERT"
+#define I3_FLD_IHX_STAT_MOT_SOLLPOS_BEL_FUSS_RECHTS_WERT         I3_PID_IHX_MOT_POS_BEL_FUSS_LI_RE_WERT, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MOT_SOLLPOS_BEL_FUSS_RECHTS_WERT"
+
+// 0xD9A0 I3_PID_IHX_VARIANTE_AUDIOBEDIENTEIL
+#define I3_FLD_IHX_STAT_VARIANTE_AUDIOBEDIENTEIL                 I3_PID_IHX_VARIANTE_AUDIOBEDIENTEIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VARIANTE_AUDIOBEDIENTEIL"
+
+// 0xD9A1 I3_PID_IHX_BUS_OUT_KOMPRESSORKUPPLUNG_EIN
+#define I3_FLD_IHX_STAT_BUS_OUT_KOMPRESSORKUPPLUNG_EIN           I3_PID_IHX_BUS_OUT_KOMPRESSORKUPPLUNG_EIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BUS_OUT_KOMPRESSORKUPPLUNG_EIN"
+
+// 0xD9A4 I3_PID_IHX_VORHANDEN_EKMV
+#define I3_FLD_IHX_STAT_VORHANDEN_EKMV                           I3_PID_IHX_VORHANDEN_EKMV, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_EKMV"
+
+// 0xD9A8 I3_PID_IHX_KLIMA_VORN_PRG_HFS
+#define I3_FLD_IHX_STAT_KLIMA_VORN_PRG_HFS                       I3_PID_IHX_KLIMA_VORN_PRG_HFS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLIMA_VORN_PRG_HFS"
+
+// 0xD9AC I3_PID_IHX_WAERMEPUMPE_SENSOREN
+#define I3_FLD_IHX_STAT_WP_TEMPERATURFUEHLER_1_WERT              I3_PID_IHX_WAERMEPUMPE_SENSOREN, 0, PID_FIELD_UINT16, 0.2f, -20.0f, "STAT_WP_TEMPERATURFUEHLER_1_WERT"
+#define I3_FLD_IHX_STAT_WP_TEMPERATURFUEHLER_2_WERT              I3_PID_IHX_WAERMEPUMPE_SENSOREN, 2, PID_FIELD_UINT16, 0.2f, -20.0f, "STAT_WP_TEMPERATURFUEHLER_2_WERT"
+#define I3_FLD_IHX_STAT_WP_TEMPERATURFUEHLER_3_WERT              I3_PID_IHX_WAERMEPUMPE_SENSOREN, 4, PID_FIELD_UINT16, 0.2f, -20.0f, "STAT_WP_TEMPERATURFUEHLER_3_WERT"
+#define I3_FLD_IHX_STAT_WP_PT_FUEHLER_1_DRUCK_WERT               I3_PID_IHX_WAERMEPUMPE_SENSOREN, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_WP_PT_FUEHLER_1_DRUCK_WERT"
+#define I3_FLD_IHX_STAT_WP_PT_FUEHLER_1_TEMP_WERT                I3_PID_IHX_WAERMEPUMPE_SENSOREN, 8, PID_FIELD_UINT16, 0.2f, -20.0f, "STAT_WP_PT_FUEHLER_1_TEMP_WERT"
+#define I3_FLD_IHX_STAT_WP_PT_FUEHLER_2_DRUCK_WERT               I3_PID_IHX_WAERMEPUMPE_SENSOREN, 10, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_WP_PT_FUEHLER_2_DRUCK_WERT"
+#define I3_FLD_IHX_STAT_WP_PT_FUEHLER_2_TEMP_WERT                I3_PID_IHX_WAERMEPUMPE_SENSOREN, 12, PID_FIELD_UINT16, 0.2f, -20.0f, "STAT_WP_PT_FUEHLER_2_TEMP_WERT"
+
+// 0xD9AE I3_PID_IHX_VORHANDEN_EDH
+#define I3_FLD_IHX_STAT_VORHANDEN_EDH                            I3_PID_IHX_VORHANDEN_EDH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_EDH"
+
+// 0xD9AF I3_PID_IHX_VORHANDEN_WAERMEPUMPE
+#define I3_FLD_IHX_STAT_VORHANDEN_WAERMEPUMPE                    I3_PID_IHX_VORHANDEN_WAERMEPUMPE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_WAERMEPUMPE"
+
+// 0xD9B1 I3_PID_IHX_VORHANDEN_FSH
+#define I3_FLD_IHX_STAT_VORHANDEN_FSH                            I3_PID_IHX_VORHANDEN_FSH, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_FSH"
+
+// 0xDAD8 I3_PID_IHX_SPANNUNG_KLEMME_30_WERT
+#define I3_FLD_IHX_STAT_SPANNUNG_KLEMME_30_WERT                  I3_PID_IHX_SPANNUNG_KLEMME_30_WERT, 0, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30_WERT"
+
+// 0xDAFD I3_PID_IHX_STATUS_KLEMME_R_EIN
+#define I3_FLD_IHX_STAT_STATUS_KLEMME_R_EIN                      I3_PID_IHX_STATUS_KLEMME_R_EIN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_STATUS_KLEMME_R_EIN"
+
+// 0xDAFE I3_PID_IHX_STATUS_KLEMME_15_EIN
+#define I3_FLD_IHX_STAT_STATUS_KLEMME_15_EIN                     I3_PID_IHX_STATUS_KLEMME_15_EIN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_STATUS_KLEMME_15_EIN"
+
+// 0xDB06 I3_PID_IHX_STATUS_KLEMME_30B_EIN
+#define I3_FLD_IHX_STAT_STATUS_KLEMME_30B_EIN                    I3_PID_IHX_STATUS_KLEMME_30B_EIN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_STATUS_KLEMME_30B_EIN"
+
+// 0xDB10 I3_PID_IHX_STATUS_KLEMME_50_EIN
+#define I3_FLD_IHX_STAT_STATUS_KLEMME_50_EIN                     I3_PID_IHX_STATUS_KLEMME_50_EIN, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_STATUS_KLEMME_50_EIN"
+
+// 0xDFC0 I3_PID_IHX_HV_EDH_STECKVERBINDUNG
+#define I3_FLD_IHX_STAT_HV_STECKER_EDH                           I3_PID_IHX_HV_EDH_STECKVERBINDUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HV_STECKER_EDH"
+
+// 0xDFC1 I3_PID_IHX_HV_EKMV_STECKVERBINDUNG
+#define I3_FLD_IHX_STAT_HV_STECKER_EKMV                          I3_PID_IHX_HV_EKMV_STECKVERBINDUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HV_STECKER_EKMV"
+
+// 0x4001 I3_PID_IHX_UWB_CPD_DIAGINFO
+
+// 0x4002 I3_PID_IHX_UWB_HKLUSV_DIAGINFO
+#define I3_FLD_IHX_STAT_AUTOADR                                  I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOADR"
+#define I3_FLD_IHX_STAT_AUTOADR_ERROR                            I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOADR_ERROR"
+#define I3_FLD_IHX_STAT_AUTOADR_MOTOR_0_1_2_3                    I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_0_1_2_3"
+#define I3_FLD_IHX_STAT_AUTOADR_MOTOR_4_5_6_7                    I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_4_5_6_7"
+#define I3_FLD_IHX_STAT_AUTOADR_MOTOR_8_9_10_11                  I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_8_9_10_11"
+#define I3_FLD_IHX_STAT_AUTOADR_MOTOR_12_13_14                   I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUTOADR_MOTOR_12_13_14"
+#define I3_FLD_IHX_STAT_PROGRAMM_MOTOR_0_1_2_3                   I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_0_1_2_3"
+#define I3_FLD_IHX_STAT_PROGRAMM_MOTOR_4_5_6_7                   I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_4_5_6_7"
+#define I3_FLD_IHX_STAT_PROGRAMM_MOTOR_8_9_10_11                 I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_8_9_10_11"
+#define I3_FLD_IHX_STAT_PROGRAMM_MOTOR_12_13_14                  I3_PID_IHX_UWB_HKLUSV_DIAGINFO, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROGRAMM_MOTOR_12_13_14"
+
+// 0x4010 I3_PID_IHX__ADC_EINGAENGE_WERT
+#define I3_FLD_IHX_STAT_ADC_VERDAMPFER                           I3_PID_IHX__ADC_EINGAENGE_WERT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_VERDAMPFER"
+#define I3_FLD_IHX_STAT_ADC_ZWEITE_VERDAMPFER                    I3_PID_IHX__ADC_EINGAENGE_WERT, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_ZWEITE_VERDAMPFER"
+#define I3_FLD_IHX_STAT_ADC_BELUEFTUNG_LINKS                     I3_PID_IHX__ADC_EINGAENGE_WERT, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_BELUEFTUNG_LINKS"
+#define I3_FLD_IHX_STAT_ADC_BELEUFTUNG_RECHTS                    I3_PID_IHX__ADC_EINGAENGE_WERT, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_BELEUFTUNG_RECHTS"
+#define I3_FLD_IHX_STAT_ADC_FUSSRAUM_LINKS                       I3_PID_IHX__ADC_EINGAENGE_WERT, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_FUSSRAUM_LINKS"
+#define I3_FLD_IHX_STAT_ADC_FUSSRAUM_RECHTS                      I3_PID_IHX__ADC_EINGAENGE_WERT, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_FUSSRAUM_RECHTS"
+#define I3_FLD_IHX_STAT_ADC_SCHICHTUNG_POTI                      I3_PID_IHX__ADC_EINGAENGE_WERT, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_SCHICHTUNG_POTI"
+#define I3_FLD_IHX_STAT_ADC_KLEMME_30                            I3_PID_IHX__ADC_EINGAENGE_WERT, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_KLEMME_30"
+#define I3_FLD_IHX_STAT_EXT_SUPPLY_DIAG                          I3_PID_IHX__ADC_EINGAENGE_WERT, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_EXT_SUPPLY_DIAG"
+#define I3_FLD_IHX_STAT_ADC_LIN_DIAG_SPANNUNG                    I3_PID_IHX__ADC_EINGAENGE_WERT, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_LIN_DIAG_SPANNUNG"
+#define I3_FLD_IHX_STAT_ADC_LIN_DIAG_STROM                       I3_PID_IHX__ADC_EINGAENGE_WERT, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ADC_LIN_DIAG_STROM"
+
+// 0x4011 I3_PID_IHX__STAT_STANDHEIZUNG_WERT
+#define I3_FLD_IHX_STAT_STANDHEIZUNG_WERT                        I3_PID_IHX__STAT_STANDHEIZUNG_WERT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STANDHEIZUNG_WERT"
+
+// 0x4012 I3_PID_IHX__STANDHEIZUNG_AUSGANG
+#define I3_FLD_IHX_STAT_STADHEIZING_AUSGANG                      I3_PID_IHX__STANDHEIZUNG_AUSGANG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STADHEIZING_AUSGANG"
+#define I3_FLD_IHX_STAT_AC_LIN_SPANNUNG_CMD_AUSGANG              I3_PID_IHX__STANDHEIZUNG_AUSGANG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AC_LIN_SPANNUNG_CMD_AUSGANG"
+#define I3_FLD_IHX_STAT_AC_LIN_SPANNUNG_DEN_AUSGANG              I3_PID_IHX__STANDHEIZUNG_AUSGANG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AC_LIN_SPANNUNG_DEN_AUSGANG"
+
+// 0x4020 I3_PID_IHX__VALEO_LESEN_SPEICHER
+#define I3_FLD_IHX_STAT_SPEICHER_BLOCK                           I3_PID_IHX__VALEO_LESEN_SPEICHER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SPEICHER_BLOCK"
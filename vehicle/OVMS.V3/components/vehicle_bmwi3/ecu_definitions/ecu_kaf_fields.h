@@ -0,0 +1,180 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/kafas20.json: KAF 5D: Camera based driver assistance system
+// This generated code  makes it easier to process CANBUS messages from the KAF ecu in a BMW i3
+//
+
+// 0x4001 I3_PID_KAF__FASTA_FLA_DATA
+#define I3_FLD_KAF_STAT_FLA_OP_TIME_WERT                         I3_PID_KAF__FASTA_FLA_DATA, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FLA_OP_TIME_WERT"
+#define I3_FLD_KAF_STAT_DELTA_TIME_FLA_NIGHT_WERT                I3_PID_KAF__FASTA_FLA_DATA, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DELTA_TIME_FLA_NIGHT_WERT"
+#define I3_FLD_KAF_STAT_DELTA_TIME_FLA_ACT_HB_WERT               I3_PID_KAF__FASTA_FLA_DATA, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DELTA_TIME_FLA_ACT_HB_WERT"
+#define I3_FLD_KAF_STAT_DELTA_TIME_FLA_ACT_LB_WERT               I3_PID_KAF__FASTA_FLA_DATA, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DELTA_TIME_FLA_ACT_LB_WERT"
+#define I3_FLD_KAF_STAT_FLA_COUNT_OVERRIDE_WERT                  I3_PID_KAF__FASTA_FLA_DATA, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FLA_COUNT_OVERRIDE_WERT"
+#define I3_FLD_KAF_STAT_OPTIME_TOTAL_WERT                        I3_PID_KAF__FASTA_FLA_DATA, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_OPTIME_TOTAL_WERT"
+
+// 0x4002 I3_PID_KAF__KAFAS_ECU_DATA
+#define I3_FLD_KAF_STAT_CNTRY_CODE_WERT                          I3_PID_KAF__KAFAS_ECU_DATA, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CNTRY_CODE_WERT"
+#define I3_FLD_KAF_STAT_OPTIME_TOTAL_WERT_0X4002                 I3_PID_KAF__KAFAS_ECU_DATA, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_OPTIME_TOTAL_WERT_0X4002"
+#define I3_FLD_KAF_STAT_OPTIME_NIGHT_WERT                        I3_PID_KAF__KAFAS_ECU_DATA, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_OPTIME_NIGHT_WERT"
+#define I3_FLD_KAF_STAT_OPTIME_WIPER_WERT                        I3_PID_KAF__KAFAS_ECU_DATA, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_OPTIME_WIPER_WERT"
+#define I3_FLD_KAF_STAT_DRIVEN_DIST_TOTAL_WERT                   I3_PID_KAF__KAFAS_ECU_DATA, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DRIVEN_DIST_TOTAL_WERT"
+#define I3_FLD_KAF_STAT_DRIVEN_DIST_URBAN_WERT                   I3_PID_KAF__KAFAS_ECU_DATA, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DRIVEN_DIST_URBAN_WERT"
+#define I3_FLD_KAF_STAT_DRIVEN_DIST_RURAL_WERT                   I3_PID_KAF__KAFAS_ECU_DATA, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DRIVEN_DIST_RURAL_WERT"
+#define I3_FLD_KAF_STAT_DRIVEN_DIST_MOWAY_WERT                   I3_PID_KAF__KAFAS_ECU_DATA, 26, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DRIVEN_DIST_MOWAY_WERT"
+#define I3_FLD_KAF_STAT_DRIVEN_DIST_NA_WERT                      I3_PID_KAF__KAFAS_ECU_DATA, 30, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_DRIVEN_DIST_NA_WERT"
+#define I3_FLD_KAF_STAT_AMNT_EYEQ_RESET_WERT                     I3_PID_KAF__KAFAS_ECU_DATA, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AMNT_EYEQ_RESET_WERT"
+#define I3_FLD_KAF_STAT_AMNT_ONLINE_CALIB_WERT                   I3_PID_KAF__KAFAS_ECU_DATA, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AMNT_ONLINE_CALIB_WERT"
+
+// 0x4003 I3_PID_KAF__KAFAS_TLC_DATA
+#define I3_FLD_KAF_STAT_TLC_DRIV_LEFT_AVAIL_WERT                 I3_PID_KAF__KAFAS_TLC_DATA, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TLC_DRIV_LEFT_AVAIL_WERT"
+#define I3_FLD_KAF_STAT_TLC_DRIV_RIGHT_AVAIL_WERT                I3_PID_KAF__KAFAS_TLC_DATA, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TLC_DRIV_RIGHT_AVAIL_WERT"
+#define I3_FLD_KAF_STAT_TLC_DRIV_DIST_REL_SPD_WERT               I3_PID_KAF__KAFAS_TLC_DATA, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TLC_DRIV_DIST_REL_SPD_WERT"
+#define I3_FLD_KAF_STAT_TLC_AMNT_WARN_WERT                       I3_PID_KAF__KAFAS_TLC_DATA, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TLC_AMNT_WARN_WERT"
+#define I3_FLD_KAF_STAT_TLC_AMNT_DEACT_WERT                      I3_PID_KAF__KAFAS_TLC_DATA, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TLC_AMNT_DEACT_WERT"
+#define I3_FLD_KAF_STAT_TLC_DRIV_DIST_ACT_WERT                   I3_PID_KAF__KAFAS_TLC_DATA, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TLC_DRIV_DIST_ACT_WERT"
+
+// 0x4004 I3_PID_KAF_KAFAS_FCW_DATA
+#define I3_FLD_KAF_STAT_FCW_DRIVEN_DIST_ACT_WERT                 I3_PID_KAF_KAFAS_FCW_DATA, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_ACT_WERT"
+#define I3_FLD_KAF_STAT_FCW_DRIVEN_DIST_FS_WERT                  I3_PID_KAF_KAFAS_FCW_DATA, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FS_WERT"
+#define I3_FLD_KAF_STAT_FCW_DRIVEN_DIST_FS_ACT_WERT              I3_PID_KAF_KAFAS_FCW_DATA, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FS_ACT_WERT"
+#define I3_FLD_KAF_STAT_FCW_DRIVEN_DIST_FOR_OFF_WERT             I3_PID_KAF_KAFAS_FCW_DATA, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FOR_OFF_WERT"
+#define I3_FLD_KAF_STAT_FCW_DRIVEN_DIST_FOR_EARLY_WERT           I3_PID_KAF_KAFAS_FCW_DATA, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FOR_EARLY_WERT"
+#define I3_FLD_KAF_STAT_FCW_DRIVEN_DIST_FOR_LATE_WERT            I3_PID_KAF_KAFAS_FCW_DATA, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FCW_DRIVEN_DIST_FOR_LATE_WERT"
+#define I3_FLD_KAF_STAT_FCW_AMNT_FOR_WERT                        I3_PID_KAF_KAFAS_FCW_DATA, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_AMNT_FOR_WERT"
+#define I3_FLD_KAF_STAT_FCW_AMNT_ACUTE_WERT                      I3_PID_KAF_KAFAS_FCW_DATA, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_WERT"
+#define I3_FLD_KAF_STAT_FCW_AMNT_ACUTE_45_WERT                   I3_PID_KAF_KAFAS_FCW_DATA, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_45_WERT"
+#define I3_FLD_KAF_STAT_FCW_AMNT_ACUTE_90_WERT                   I3_PID_KAF_KAFAS_FCW_DATA, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_90_WERT"
+#define I3_FLD_KAF_STAT_FCW_AMNT_ACUTE_135_WERT                  I3_PID_KAF_KAFAS_FCW_DATA, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_AMNT_ACUTE_135_WERT"
+#define I3_FLD_KAF_STAT_FCW_PREFILLS_WERT                        I3_PID_KAF_KAFAS_FCW_DATA, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_PREFILLS_WERT"
+#define I3_FLD_KAF_STAT_FCW_PRECRASH_WERT                        I3_PID_KAF_KAFAS_FCW_DATA, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_PRECRASH_WERT"
+#define I3_FLD_KAF_STAT_FCW_DEACT_WERT                           I3_PID_KAF_KAFAS_FCW_DATA, 38, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_DEACT_WERT"
+#define I3_FLD_KAF_STAT_FCW_FS_CC_WERT                           I3_PID_KAF_KAFAS_FCW_DATA, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FCW_FS_CC_WERT"
+
+// 0x4005 I3_PID_KAF__KAFAS_SLI_DATA
+#define I3_FLD_KAF_STAT_SLI_AMT_CAM_DET_WERT                     I3_PID_KAF__KAFAS_SLI_DATA, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SLI_AMT_CAM_DET_WERT"
+#define I3_FLD_KAF_STAT_SLI_MATCH_URBAN_WERT                     I3_PID_KAF__KAFAS_SLI_DATA, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLI_MATCH_URBAN_WERT"
+#define I3_FLD_KAF_STAT_SLI_MATCH_RURAL_WERT                     I3_PID_KAF__KAFAS_SLI_DATA, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLI_MATCH_RURAL_WERT"
+#define I3_FLD_KAF_STAT_SLI_MATCH_MOWAY_WERT                     I3_PID_KAF__KAFAS_SLI_DATA, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SLI_MATCH_MOWAY_WERT"
+#define I3_FLD_KAF_STAT_SLI_REP_URBAN_WERT                       I3_PID_KAF__KAFAS_SLI_DATA, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SLI_REP_URBAN_WERT"
+#define I3_FLD_KAF_STAT_SLI_REP_RURAL_WERT                       I3_PID_KAF__KAFAS_SLI_DATA, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SLI_REP_RURAL_WERT"
+#define I3_FLD_KAF_STAT_SLI_REP_MOWAY_WERT                       I3_PID_KAF__KAFAS_SLI_DATA, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SLI_REP_MOWAY_WERT"
+#define I3_FLD_KAF_STAT_SLI_OVER_SLI_WERT                        I3_PID_KAF__KAFAS_SLI_DATA, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SLI_OVER_SLI_WERT"
+#define I3_FLD_KAF_STAT_SLI_SSS_TIME_WERT                        I3_PID_KAF__KAFAS_SLI_DATA, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SLI_SSS_TIME_WERT"
+#define I3_FLD_KAF_STAT_SLI_NPI_WERT                             I3_PID_KAF__KAFAS_SLI_DATA, 19, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SLI_NPI_WERT"
+#define I3_FLD_KAF_STAT_SLI_NP_WITHDRAW_DIST_WERT                I3_PID_KAF__KAFAS_SLI_DATA, 23, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SLI_NP_WITHDRAW_DIST_WERT"
+#define I3_FLD_KAF_STAT_SLI_NP_WITHDRAW_SIGN_WERT                I3_PID_KAF__KAFAS_SLI_DATA, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SLI_NP_WITHDRAW_SIGN_WERT"
+
+// 0x400E I3_PID_KAF__STATUS_SAFETY_DIAG_INFO
+#define I3_FLD_KAF_STAT_BYTE_0_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_0_FAULT_WERT"
+#define I3_FLD_KAF_STAT_BYTE_1_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_1_FAULT_WERT"
+#define I3_FLD_KAF_STAT_BYTE_2_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_2_FAULT_WERT"
+#define I3_FLD_KAF_STAT_BYTE_3_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_3_FAULT_WERT"
+#define I3_FLD_KAF_STAT_BYTE_4_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_4_FAULT_WERT"
+#define I3_FLD_KAF_STAT_BYTE_5_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_5_FAULT_WERT"
+#define I3_FLD_KAF_STAT_BYTE_6_FAULT_WERT                        I3_PID_KAF__STATUS_SAFETY_DIAG_INFO, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BYTE_6_FAULT_WERT"
+
+// 0x400F I3_PID_KAF__STATUS_WARNZEITPUNKT_FCW
+#define I3_FLD_KAF_STAT_WARN_FLAV_FCW                            I3_PID_KAF__STATUS_WARNZEITPUNKT_FCW, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WARN_FLAV_FCW"
+
+// 0x4010 I3_PID_KAF_FASTA_PPP_DATA
+#define I3_FLD_KAF_STAT_PPP_WARNING_ZONE                         I3_PID_KAF_FASTA_PPP_DATA, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_WARNING_ZONE"
+#define I3_FLD_KAF_STAT_PPP_AMNT_DZ_EVENTS_0_TO_20_WERT          I3_PID_KAF_FASTA_PPP_DATA, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_DZ_EVENTS_0_TO_20_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_DZ_EVENTS_20_TO_40_WERT         I3_PID_KAF_FASTA_PPP_DATA, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_DZ_EVENTS_20_TO_40_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_DZ_EVENTS_40_TO_60_WERT         I3_PID_KAF_FASTA_PPP_DATA, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_DZ_EVENTS_40_TO_60_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PDZ1_EVENTS_0_TO_20_WERT        I3_PID_KAF_FASTA_PPP_DATA, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ1_EVENTS_0_TO_20_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PDZ1_EVENTS_20_TO_40_WERT       I3_PID_KAF_FASTA_PPP_DATA, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ1_EVENTS_20_TO_40_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PDZ1_EVENTS_40_TO_60_WERT       I3_PID_KAF_FASTA_PPP_DATA, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ1_EVENTS_40_TO_60_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PDZ2_EVENTS_0_TO_20_WERT        I3_PID_KAF_FASTA_PPP_DATA, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ2_EVENTS_0_TO_20_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PDZ2_EVENTS_20_TO_40_WERT       I3_PID_KAF_FASTA_PPP_DATA, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ2_EVENTS_20_TO_40_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PDZ2_EVENTS_40_TO_60_WERT       I3_PID_KAF_FASTA_PPP_DATA, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PDZ2_EVENTS_40_TO_60_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PREWARNUNG_REQUESTS_WERT        I3_PID_KAF_FASTA_PPP_DATA, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PREWARNUNG_REQUESTS_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_ACUTEWARNING_REQUESTS_WERT      I3_PID_KAF_FASTA_PPP_DATA, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_ACUTEWARNING_REQUESTS_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_HBA_REQUESTS_WERT               I3_PID_KAF_FASTA_PPP_DATA, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_HBA_REQUESTS_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_PREFILL_REQUESTS_WERT           I3_PID_KAF_FASTA_PPP_DATA, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_PREFILL_REQUESTS_WERT"
+#define I3_FLD_KAF_STAT_PPP_AMNT_BRAKE_REQUESTS_WERT             I3_PID_KAF_FASTA_PPP_DATA, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_AMNT_BRAKE_REQUESTS_WERT"
+#define I3_FLD_KAF_STAT_PPP_DEACT_DRIVER_WERT                    I3_PID_KAF_FASTA_PPP_DATA, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_DEACT_DRIVER_WERT"
+#define I3_FLD_KAF_STAT_PPP_DEACT_AVAILABILITY_WERT              I3_PID_KAF_FASTA_PPP_DATA, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_DEACT_AVAILABILITY_WERT"
+#define I3_FLD_KAF_STAT_PPP_DEACT_WARNING_CHAIN_WERT             I3_PID_KAF_FASTA_PPP_DATA, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_DEACT_WARNING_CHAIN_WERT"
+#define I3_FLD_KAF_STAT_PPP_OPERATION_TIME_CL50_WERT             I3_PID_KAF_FASTA_PPP_DATA, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PPP_OPERATION_TIME_CL50_WERT"
+#define I3_FLD_KAF_STAT_PPP_OPERATION_TIME_ACTIVE_WERT           I3_PID_KAF_FASTA_PPP_DATA, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PPP_OPERATION_TIME_ACTIVE_WERT"
+#define I3_FLD_KAF_STAT_PPP_FS_CC_WERT                           I3_PID_KAF_FASTA_PPP_DATA, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PPP_FS_CC_WERT"
+#define I3_FLD_KAF_STAT_PPP_DRIVEN_TIME_FS_ACT_WERT              I3_PID_KAF_FASTA_PPP_DATA, 46, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_PPP_DRIVEN_TIME_FS_ACT_WERT"
+
+// 0x4011 I3_PID_KAF_FASTA_CCM_DATA
+#define I3_FLD_KAF_STAT_CCM_AMNT_BRAKE_20_WERT                   I3_PID_KAF_FASTA_CCM_DATA, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CCM_AMNT_BRAKE_20_WERT"
+#define I3_FLD_KAF_STAT_CCM_AMNT_BRAKE_40_WERT                   I3_PID_KAF_FASTA_CCM_DATA, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CCM_AMNT_BRAKE_40_WERT"
+#define I3_FLD_KAF_STAT_CCM_AMNT_BRAKE_GEQ40_WERT                I3_PID_KAF_FASTA_CCM_DATA, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CCM_AMNT_BRAKE_GEQ40_WERT"
+
+// 0x4012 I3_PID_KAF__KAFAS_ENVINT_DATA
+#define I3_FLD_KAF_STAT_ENVINT_DRIVEN_DIST_FS_WERT               I3_PID_KAF__KAFAS_ENVINT_DATA, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ENVINT_DRIVEN_DIST_FS_WERT"
+#define I3_FLD_KAF_STAT_ENVINT_DRIVEN_TIME_FS_WERT               I3_PID_KAF__KAFAS_ENVINT_DATA, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ENVINT_DRIVEN_TIME_FS_WERT"
+
+// 0x4016 I3_PID_KAF_PPP_ANFORDERUNGEN
+#define I3_FLD_KAF_STAT_TYPE_OF_WARNING                          I3_PID_KAF_PPP_ANFORDERUNGEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TYPE_OF_WARNING"
+#define I3_FLD_KAF_STAT_TIMESTAMP_ACUTE_WERT                     I3_PID_KAF_PPP_ANFORDERUNGEN, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TIMESTAMP_ACUTE_WERT"
+#define I3_FLD_KAF_STAT_TIMESTAMP_BRAKE_WERT                     I3_PID_KAF_PPP_ANFORDERUNGEN, 5, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TIMESTAMP_BRAKE_WERT"
+
+// 0x4017 I3_PID_KAF__GENERIC_EYEQ2_INFO
+#define I3_FLD_KAF_STAT_EYEQ2_RESTARTS_WERT                      I3_PID_KAF__GENERIC_EYEQ2_INFO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EYEQ2_RESTARTS_WERT"
+
+// 0x4050 I3_PID_KAF__STATUS_CAMERA_MONITORING_WERT
+#define I3_FLD_KAF_STAT_FRAME_INDEX_WERT                         I3_PID_KAF__STATUS_CAMERA_MONITORING_WERT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FRAME_INDEX_WERT"
+#define I3_FLD_KAF_STAT_VIDEO_ERROR_COUNT_WERT                   I3_PID_KAF__STATUS_CAMERA_MONITORING_WERT, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VIDEO_ERROR_COUNT_WERT"
+#define I3_FLD_KAF_STAT_DROPPED_FRAME_COUNT_WERT                 I3_PID_KAF__STATUS_CAMERA_MONITORING_WERT, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DROPPED_FRAME_COUNT_WERT"
+#define I3_FLD_KAF_STAT_CAMERA_TEMP_WERT                         I3_PID_KAF__STATUS_CAMERA_MONITORING_WERT, 6, PID_FIELD_UINT8, 1.0f, -60.0f, "STAT_CAMERA_TEMP_WERT"
+
+// 0xD341 I3_PID_KAF_ABSCHALTGRUND_FERNLICHT
+#define I3_FLD_KAF_STAT_FLA_ENTGEGENKOMMENDES_FAHRZEUG           I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_ENTGEGENKOMMENDES_FAHRZEUG"
+#define I3_FLD_KAF_STAT_FLA_VORAUSFAHRENDES_FAHRZEUG             I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_VORAUSFAHRENDES_FAHRZEUG"
+#define I3_FLD_KAF_STAT_FLA_GESCHWINDIGKEITSLIMIT                I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_GESCHWINDIGKEITSLIMIT"
+#define I3_FLD_KAF_STAT_FLA_UMGEBUNGSHELLIGKEIT                  I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_UMGEBUNGSHELLIGKEIT"
+#define I3_FLD_KAF_STAT_FLA_ORTSCHAFTSERKENNUNG                  I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_ORTSCHAFTSERKENNUNG"
+#define I3_FLD_KAF_STAT_FLA_NEBELERKENNUNG                       I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_NEBELERKENNUNG"
+#define I3_FLD_KAF_STAT_FLA_AUTOBAHNMODE                         I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_AUTOBAHNMODE"
+#define I3_FLD_KAF_STAT_FLA_VERZOEGERUNGSZEIT                    I3_PID_KAF_ABSCHALTGRUND_FERNLICHT, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLA_VERZOEGERUNGSZEIT"
+
+// 0xD374 I3_PID_KAF_KONFIGURATION_KAFAS
+#define I3_FLD_KAF_STAT_VORHANDEN_TLC                            I3_PID_KAF_KONFIGURATION_KAFAS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_TLC"
+#define I3_FLD_KAF_STAT_VORHANDEN_FLA                            I3_PID_KAF_KONFIGURATION_KAFAS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_FLA"
+#define I3_FLD_KAF_STAT_VORHANDEN_SLI                            I3_PID_KAF_KONFIGURATION_KAFAS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_SLI"
+#define I3_FLD_KAF_STAT_VORHANDEN_NPI                            I3_PID_KAF_KONFIGURATION_KAFAS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_NPI"
+#define I3_FLD_KAF_STAT_VORHANDEN_FCW                            I3_PID_KAF_KONFIGURATION_KAFAS, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_FCW"
+#define I3_FLD_KAF_STAT_VORHANDEN_PED                            I3_PID_KAF_KONFIGURATION_KAFAS, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VORHANDEN_PED"
+
+// 0xD393 I3_PID_KAF_KAFAS_VINS_LESEN
+#define I3_FLD_KAF_STAT_KAFAS_VIN_STATUS_NR                      I3_PID_KAF_KAFAS_VINS_LESEN, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAFAS_VIN_STATUS_NR"
+
+// 0xD396 I3_PID_KAF_KALIBRIERDATEN_KAFAS
+#define I3_FLD_KAF_STAT_OFFLINE_YAW_WERT                         I3_PID_KAF_KALIBRIERDATEN_KAFAS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OFFLINE_YAW_WERT"
+#define I3_FLD_KAF_STAT_OFFLINE_HORIZON_WERT                     I3_PID_KAF_KALIBRIERDATEN_KAFAS, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OFFLINE_HORIZON_WERT"
+#define I3_FLD_KAF_STAT_OFFLINE_ROLL_WERT                        I3_PID_KAF_KALIBRIERDATEN_KAFAS, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_OFFLINE_ROLL_WERT"
+#define I3_FLD_KAF_STAT_ONLINE_YAW_WERT                          I3_PID_KAF_KALIBRIERDATEN_KAFAS, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ONLINE_YAW_WERT"
+#define I3_FLD_KAF_STAT_ONLINE_HORIZON_WERT                      I3_PID_KAF_KALIBRIERDATEN_KAFAS, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ONLINE_HORIZON_WERT"
+#define I3_FLD_KAF_STAT_ONLINE_ROLL_WERT                         I3_PID_KAF_KALIBRIERDATEN_KAFAS, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ONLINE_ROLL_WERT"
+#define I3_FLD_KAF_STAT_KAM_HOEHE_WERT                           I3_PID_KAF_KALIBRIERDATEN_KAFAS, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KAM_HOEHE_WERT"
+#define I3_FLD_KAF_STAT_BRENNWEITE_WERT                          I3_PID_KAF_KALIBRIERDATEN_KAFAS, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BRENNWEITE_WERT"
+#define I3_FLD_KAF_STAT_GRABBING_SHIFT_WERT                      I3_PID_KAF_KALIBRIERDATEN_KAFAS, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_GRABBING_SHIFT_WERT"
+
+// 0xD397 I3_PID_KAF_KAMERAVERBINDUNG_ECU
+#define I3_FLD_KAF_STAT_KAFAS_VERBINDUNG_KAM_NR                  I3_PID_KAF_KAMERAVERBINDUNG_ECU, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAFAS_VERBINDUNG_KAM_NR"
+
+// 0xD3AA I3_PID_KAF_ERGEBNIS_SLI
+#define I3_FLD_KAF_STAT_KAMERA_ZEICHEN_NR                        I3_PID_KAF_ERGEBNIS_SLI, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAMERA_ZEICHEN_NR"
+#define I3_FLD_KAF_STAT_KAMERA_GESCHWINDIGKEIT_WERT              I3_PID_KAF_ERGEBNIS_SLI, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAMERA_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_KAF_STAT_KARTE_ZEICHEN_NR                         I3_PID_KAF_ERGEBNIS_SLI, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KARTE_ZEICHEN_NR"
+#define I3_FLD_KAF_STAT_KARTE_GESCHWINDIGKEIT_WERT               I3_PID_KAF_ERGEBNIS_SLI, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KARTE_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_KAF_STAT_FUSIONIERT_ZEICHEN_NR                    I3_PID_KAF_ERGEBNIS_SLI, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUSIONIERT_ZEICHEN_NR"
+#define I3_FLD_KAF_STAT_FUSIONIERT_GESCHWINDIGKEIT_WERT          I3_PID_KAF_ERGEBNIS_SLI, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FUSIONIERT_GESCHWINDIGKEIT_WERT"
+#define I3_FLD_KAF_STAT_GUETE_KAM_SLI_GESCHW_WERT                I3_PID_KAF_ERGEBNIS_SLI, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GUETE_KAM_SLI_GESCHW_WERT"
+
+// 0xDAD2 I3_PID_KAF_SPANNUNG_KLEMME_15N_WERT
+#define I3_FLD_KAF_STAT_SPANNUNG_KLEMME_15N_WERT                 I3_PID_KAF_SPANNUNG_KLEMME_15N_WERT, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_15N_WERT"
+
+// 0xF001 I3_PID_KAF__DEBUG_AUSGABE
+#define I3_FLD_KAF_STAT_DEBUG_AUSGABE                            I3_PID_KAF__DEBUG_AUSGABE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DEBUG_AUSGABE"
+
+// 0xF003 I3_PID_KAF__PEDANTIC_MODE
+#define I3_FLD_KAF_STAT_PEDANTIC_MODE                            I3_PID_KAF__PEDANTIC_MODE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PEDANTIC_MODE"
+
+// 0xF004 I3_PID_KAF__ERASE_MICRO_CORE_DUMP
+#define I3_FLD_KAF_STAT_ERASE_RESULT                             I3_PID_KAF__ERASE_MICRO_CORE_DUMP, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ERASE_RESULT"
@@ -0,0 +1,150 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/ucx2_i01.json: KLE 15: Convenience charging electronics
+// This generated code  makes it easier to process CANBUS messages from the KLE ecu in a BMW i3
+//
+
+// 0xAF43 I3_PID_KLE_FLASH_DSPS
+#define I3_FLD_KLE_STAT_DSP_FLASHING                             I3_PID_KLE_FLASH_DSPS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DSP_FLASHING"
+
+// 0xDE84 I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET
+#define I3_FLD_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT                I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 0, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_1_WERT"
+#define I3_FLD_KLE_BF_LADEGERAET_DERATING                        I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_LADEGERAET_DERATING"
+#define I3_FLD_KLE_STAT_LEISTUNG_DERATING_WERT                   I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 2, PID_FIELD_UINT16, 10.0f, 0.0f, "STAT_LEISTUNG_DERATING_WERT"
+#define I3_FLD_KLE_STAT_DERATING_WERT                            I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DERATING_WERT"
+#define I3_FLD_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII             I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_LADEGERAET_FEHLERZUSTAND_UCXII"
+#define I3_FLD_KLE_BF_AUSLOESER_FAILSAFE_UCXII                   I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_AUSLOESER_FAILSAFE_UCXII"
+#define I3_FLD_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG       I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG"
+#define I3_FLD_KLE_STAT_BETRIEBSART_NR                           I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BETRIEBSART_NR"
+#define I3_FLD_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT                I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 10, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_2_WERT"
+#define I3_FLD_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT                I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 11, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_3_WERT"
+#define I3_FLD_KLE_BF_MOD_ERR                                    I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "BF_MOD_ERR"
+
+// 0xDE85 I3_PID_KLE_LADEGERAET_LEISTUNG
+#define I3_FLD_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT             I3_PID_KLE_LADEGERAET_LEISTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT"
+#define I3_FLD_KLE_STAT_WIRKUNGSGRAD_DC_WERT                     I3_PID_KLE_LADEGERAET_LEISTUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_DC_WERT"
+#define I3_FLD_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT           I3_PID_KLE_LADEGERAET_LEISTUNG, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEGERAET_DC_HV_LEISTUNG_WERT"
+
+// 0xDE86 I3_PID_KLE_LADEGERAET_SPANNUNG
+#define I3_FLD_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT             I3_PID_KLE_LADEGERAET_SPANNUNG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT"
+#define I3_FLD_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT           I3_PID_KLE_LADEGERAET_SPANNUNG, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT"
+#define I3_FLD_KLE_STAT_SPANNUNG_DC_HV_WERT                      I3_PID_KLE_LADEGERAET_SPANNUNG, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_WERT"
+#define I3_FLD_KLE_STAT_SPANNUNG_KL30_WERT                       I3_PID_KLE_LADEGERAET_SPANNUNG, 6, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_SPANNUNG_KL30_WERT"
+#define I3_FLD_KLE_STAT_SPANNUNG_KL30C_WERT                      I3_PID_KLE_LADEGERAET_SPANNUNG, 7, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_SPANNUNG_KL30C_WERT"
+#define I3_FLD_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT             I3_PID_KLE_LADEGERAET_SPANNUNG, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_2_WERT"
+#define I3_FLD_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT             I3_PID_KLE_LADEGERAET_SPANNUNG, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_3_WERT"
+
+// 0xDE87 I3_PID_KLE_LADEGERAET_STROM
+#define I3_FLD_KLE_STAT_STROM_AC_PHASE_1_WERT                    I3_PID_KLE_LADEGERAET_STROM, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_PHASE_1_WERT"
+#define I3_FLD_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT            I3_PID_KLE_LADEGERAET_STROM, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_MAX_GESPEICHERT_WERT"
+#define I3_FLD_KLE_STAT_STROM_HV_DC_WERT                         I3_PID_KLE_LADEGERAET_STROM, 4, PID_FIELD_UINT16, 0.1f, -204.7f, "STAT_STROM_HV_DC_WERT"
+#define I3_FLD_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT               I3_PID_KLE_LADEGERAET_STROM, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_HV_DC_MAX_LIMIT_WERT"
+#define I3_FLD_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT         I3_PID_KLE_LADEGERAET_STROM, 8, PID_FIELD_UINT16, 0.1f, -204.7f, "STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT"
+#define I3_FLD_KLE_STAT_STROM_AC_PHASE_2_WERT                    I3_PID_KLE_LADEGERAET_STROM, 10, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_PHASE_2_WERT"
+#define I3_FLD_KLE_STAT_STROM_AC_PHASE_3_WERT                    I3_PID_KLE_LADEGERAET_STROM, 12, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_PHASE_3_WERT"
+
+// 0xDF25 I3_PID_KLE_AC_PHASENANZAHL
+#define I3_FLD_KLE_STAT_AC_PHASENANZAHL_WERT                     I3_PID_KLE_AC_PHASENANZAHL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AC_PHASENANZAHL_WERT"
+
+// 0xDFB0 I3_PID_KLE_LADEGERAET_LADEDAUER
+#define I3_FLD_KLE_STAT_MINUTEN_LADEZYKLUS_WERT                  I3_PID_KLE_LADEGERAET_LADEDAUER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT                 I3_PID_KLE_LADEGERAET_LADEDAUER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_WERT"
+#define I3_FLD_KLE_STAT_LADEZYKLEN_WERT                          I3_PID_KLE_LADEGERAET_LADEDAUER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEZYKLEN_WERT"
+
+// 0xDFB1 I3_PID_KLE_LADEGERAET_TEMPERATUREN
+#define I3_FLD_KLE_STAT_NTC1_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 0, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC1_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC2_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 1, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC2_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC3_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 2, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC3_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC4_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 3, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC4_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC5_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 4, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC5_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC6_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 5, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC6_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC7_TEMPERAUTR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 6, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC7_TEMPERAUTR_WERT"
+#define I3_FLD_KLE_STAT_NTC8_TEMPERATUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 7, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC8_TEMPERATUR_WERT"
+#define I3_FLD_KLE_STAT_NTC9_TEMPEARTUR_WERT                     I3_PID_KLE_LADEGERAET_TEMPERATUREN, 8, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC9_TEMPEARTUR_WERT"
+#define I3_FLD_KLE_STAT_NTC10_TEMPEARTUR_WERT                    I3_PID_KLE_LADEGERAET_TEMPERATUREN, 9, PID_FIELD_UINT8, 1.0f, -75.0f, "STAT_NTC10_TEMPEARTUR_WERT"
+
+// 0xDFB4 I3_PID_KLE_LADEGERAET_LEISTUNG2
+#define I3_FLD_KLE_STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_0XDFB4      I3_PID_KLE_LADEGERAET_LEISTUNG2, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT_0XDFB4"
+#define I3_FLD_KLE_STAT_WIRKUNGSGRAD_DC_WERT_0XDFB4              I3_PID_KLE_LADEGERAET_LEISTUNG2, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WIRKUNGSGRAD_DC_WERT_0XDFB4"
+#define I3_FLD_KLE_STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_0XDFB4    I3_PID_KLE_LADEGERAET_LEISTUNG2, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEGERAET_DC_HV_LEISTUNG_WERT_0XDFB4"
+
+// 0xDFB6 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT       I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT       I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT       I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT       I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT       I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT       I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT         I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT         I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT         I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT         I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT"
+
+// 0xDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_0XDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_1_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_0XDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_2_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_0XDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_3_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_0XDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_4_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_0XDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_5_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_0XDFB7 I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_TEMPERATUR_BEREICH_6_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_0XDFB7  I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_1_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_0XDFB7  I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_2_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_0XDFB7  I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_3_WERT_0XDFB7"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_0XDFB7  I3_PID_KLE_LADEGERAET_LADE_HISTOGRAMM2, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_LEISTUNG_BEREICH_4_WERT_0XDFB7"
+
+// 0xDFB8 I3_PID_KLE_LADEGERAET_LADEDAUER2
+#define I3_FLD_KLE_STAT_MINUTEN_LADEZYKLUS_WERT_0XDFB8           I3_PID_KLE_LADEGERAET_LADEDAUER2, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_WERT_0XDFB8"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LADEZYKLUS_WERT_0XDFB8          I3_PID_KLE_LADEGERAET_LADEDAUER2, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_WERT_0XDFB8"
+#define I3_FLD_KLE_STAT_LADEZYKLEN_WERT_0XDFB8                   I3_PID_KLE_LADEGERAET_LADEDAUER2, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEZYKLEN_WERT_0XDFB8"
+
+// 0xDFB9 I3_PID_KLE_UMSCHALTMATRIX
+#define I3_FLD_KLE_STAT_SCHALTER1_SCHALTZYKLEN_ANZAHL_WERT       I3_PID_KLE_UMSCHALTMATRIX, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SCHALTER1_SCHALTZYKLEN_ANZAHL_WERT"
+#define I3_FLD_KLE_STAT_SCHALTER2_SCHALTZYKLEN_ANZAHL_WERT       I3_PID_KLE_UMSCHALTMATRIX, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SCHALTER2_SCHALTZYKLEN_ANZAHL_WERT"
+#define I3_FLD_KLE_STAT_SCHALTER3_SCHALTZYKLEN_ANZAHL_WERT       I3_PID_KLE_UMSCHALTMATRIX, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SCHALTER3_SCHALTZYKLEN_ANZAHL_WERT"
+#define I3_FLD_KLE_STAT_SCHALTER4_SCHALTZYKLEN_ANZAHL_WERT       I3_PID_KLE_UMSCHALTMATRIX, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SCHALTER4_SCHALTZYKLEN_ANZAHL_WERT"
+#define I3_FLD_KLE_STAT_SCHALTER1                                I3_PID_KLE_UMSCHALTMATRIX, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER1"
+#define I3_FLD_KLE_STAT_SCHALTER2                                I3_PID_KLE_UMSCHALTMATRIX, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER2"
+#define I3_FLD_KLE_STAT_SCHALTER3                                I3_PID_KLE_UMSCHALTMATRIX, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER3"
+#define I3_FLD_KLE_STAT_SCHALTER4                                I3_PID_KLE_UMSCHALTMATRIX, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHALTER4"
+
+// 0xDFBA I3_PID_KLE_LADEGERAET_SPANNUNG2
+#define I3_FLD_KLE_STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_0XDFBA      I3_PID_KLE_LADEGERAET_SPANNUNG2, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT_0XDFBA"
+#define I3_FLD_KLE_STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_0XDFBA    I3_PID_KLE_LADEGERAET_SPANNUNG2, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT_0XDFBA"
+#define I3_FLD_KLE_STAT_SPANNUNG_DC_HV_WERT_0XDFBA               I3_PID_KLE_LADEGERAET_SPANNUNG2, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_DC_HV_WERT_0XDFBA"
+#define I3_FLD_KLE_STAT_SPANNUNG_KL30_WERT_0XDFBA                I3_PID_KLE_LADEGERAET_SPANNUNG2, 6, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_SPANNUNG_KL30_WERT_0XDFBA"
+#define I3_FLD_KLE_STAT_SPANNUNG_KL30C_WERT_0XDFBA               I3_PID_KLE_LADEGERAET_SPANNUNG2, 7, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_SPANNUNG_KL30C_WERT_0XDFBA"
+#define I3_FLD_KLE_STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_0XDFBA      I3_PID_KLE_LADEGERAET_SPANNUNG2, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_2_WERT_0XDFBA"
+#define I3_FLD_KLE_STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_0XDFBA      I3_PID_KLE_LADEGERAET_SPANNUNG2, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPANNUNG_RMS_AC_PHASE_3_WERT_0XDFBA"
+
+// 0xDFBB I3_PID_KLE_LADEGERAET_STROM2
+#define I3_FLD_KLE_STAT_STROM_AC_PHASE_1_WERT_0XDFBB             I3_PID_KLE_LADEGERAET_STROM2, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_PHASE_1_WERT_0XDFBB"
+#define I3_FLD_KLE_STAT_STROM_AC_MAX_GESPEICHERT_WERT_0XDFBB     I3_PID_KLE_LADEGERAET_STROM2, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_MAX_GESPEICHERT_WERT_0XDFBB"
+#define I3_FLD_KLE_STAT_STROM_HV_DC_WERT_0XDFBB                  I3_PID_KLE_LADEGERAET_STROM2, 4, PID_FIELD_UINT16, 0.1f, -204.7f, "STAT_STROM_HV_DC_WERT_0XDFBB"
+#define I3_FLD_KLE_STAT_STROM_HV_DC_MAX_LIMIT_WERT_0XDFBB        I3_PID_KLE_LADEGERAET_STROM2, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_HV_DC_MAX_LIMIT_WERT_0XDFBB"
+#define I3_FLD_KLE_STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_0XDFBB  I3_PID_KLE_LADEGERAET_STROM2, 8, PID_FIELD_UINT16, 0.1f, -204.7f, "STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT_0XDFBB"
+#define I3_FLD_KLE_STAT_STROM_AC_PHASE_2_WERT_0XDFBB             I3_PID_KLE_LADEGERAET_STROM2, 10, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_PHASE_2_WERT_0XDFBB"
+#define I3_FLD_KLE_STAT_STROM_AC_PHASE_3_WERT_0XDFBB             I3_PID_KLE_LADEGERAET_STROM2, 12, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_STROM_AC_PHASE_3_WERT_0XDFBB"
+
+// 0xDFBC I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2
+#define I3_FLD_KLE_STAT_NETZFREQUENZ_PHASE_1_WERT_0XDFBC         I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 0, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_1_WERT_0XDFBC"
+#define I3_FLD_KLE_BF_LADEGERAET_DERATING_0XDFBC                 I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_LADEGERAET_DERATING_0XDFBC"
+#define I3_FLD_KLE_STAT_LEISTUNG_DERATING_WERT_0XDFBC            I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 2, PID_FIELD_UINT16, 10.0f, 0.0f, "STAT_LEISTUNG_DERATING_WERT_0XDFBC"
+#define I3_FLD_KLE_STAT_DERATING_WERT_0XDFBC                     I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DERATING_WERT_0XDFBC"
+#define I3_FLD_KLE_BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC      I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_LADEGERAET_FEHLERZUSTAND_UCXII_0XDFBC"
+#define I3_FLD_KLE_BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC            I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_AUSLOESER_FAILSAFE_UCXII_0XDFBC"
+#define I3_FLD_KLE_BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG_0XDFBC"
+#define I3_FLD_KLE_STAT_BETRIEBSART_NR_0XDFBC                    I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BETRIEBSART_NR_0XDFBC"
+#define I3_FLD_KLE_STAT_NETZFREQUENZ_PHASE_2_WERT_0XDFBC         I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 9, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_2_WERT_0XDFBC"
+#define I3_FLD_KLE_STAT_NETZFREQUENZ_PHASE_3_WERT_0XDFBC         I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 10, PID_FIELD_UINT8, 0.25f, 0.0f, "STAT_NETZFREQUENZ_PHASE_3_WERT_0XDFBC"
+#define I3_FLD_KLE_BF_MOD_ERR_0XDFBC                             I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET2, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_MOD_ERR_0XDFBC"
+
+// 0xDFBD I3_PID_KLE_LADEDAUER_LADEART
+#define I3_FLD_KLE_STAT_MINUTEN_LADEZYKLUS_1PH_WERT              I3_PID_KLE_LADEDAUER_LADEART, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_1PH_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LADEZYKLUS_1PH_WERT             I3_PID_KLE_LADEDAUER_LADEART, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_1PH_WERT"
+#define I3_FLD_KLE_STAT_LADEZYKLUS_1PH_WERT                      I3_PID_KLE_LADEDAUER_LADEART, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEZYKLUS_1PH_WERT"
+#define I3_FLD_KLE_STAT_MINUTEN_LADEZYKLUS_3PH_WERT              I3_PID_KLE_LADEDAUER_LADEART, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MINUTEN_LADEZYKLUS_3PH_WERT"
+#define I3_FLD_KLE_STAT_SEKUNDEN_LADEZYKLUS_3PH_WERT             I3_PID_KLE_LADEDAUER_LADEART, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SEKUNDEN_LADEZYKLUS_3PH_WERT"
+#define I3_FLD_KLE_STAT_LADEZYKLUS_3PH_WERT                      I3_PID_KLE_LADEDAUER_LADEART, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEZYKLUS_3PH_WERT"
+
+// 0xF000 I3_PID_KLE_FLASH_DSPS_0XF000
+#define I3_FLD_KLE_STAT_DSP_FLASHING_0XF000                      I3_PID_KLE_FLASH_DSPS_0XF000, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DSP_FLASHING_0XF000"
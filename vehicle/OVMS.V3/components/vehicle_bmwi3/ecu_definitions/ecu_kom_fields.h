@@ -0,0 +1,1169 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/komb25.json: KOM 60: Instrument panel
+// This generated code  makes it easier to process CANBUS messages from the KOM ecu in a BMW i3
+//
+
+// 0x0F04 I3_PID_KOM_SELBSTTEST
+
+// 0x1005 I3_PID_KOM_START_SYSTIME
+
+// 0x1725 I3_PID_KOM_STATUS_SYSTIME
+#define I3_FLD_KOM_STAT_SEKUNDEN_SEIT_INIT_WERT                  I3_PID_KOM_STATUS_SYSTIME, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDEN_SEIT_INIT_WERT"
+
+// 0x2521 I3_PID_KOM_STATUS_AKT_AUSFALL_CCMS
+
+// 0xA104 I3_PID_KOM_SELBSTTEST_HUD
+
+// 0xA108 I3_PID_KOM_AO_TOTAL_TIME_RESET
+
+// 0xAA00 I3_PID_KOM_HUD_SHOWMODE
+
+// 0xAA01 I3_PID_KOM_HUD_LOGBUCH_RESET
+
+// 0xD106 I3_PID_KOM_DREHZAHL_WERT
+#define I3_FLD_KOM_STAT_DREHZAHL_WERT                            I3_PID_KOM_DREHZAHL_WERT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DREHZAHL_WERT"
+
+// 0xD107 I3_PID_KOM_TACHO_WERT
+#define I3_FLD_KOM_STAT_GESCHWINDIGKEIT_WERT                     I3_PID_KOM_TACHO_WERT, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_GESCHWINDIGKEIT_WERT"
+
+// 0xD10D I3_PID_KOM_GWSZ_ABSOLUT_WERT
+#define I3_FLD_KOM_STAT_ABSOLUT_GWSZ_RAM_WERT                    I3_PID_KOM_GWSZ_ABSOLUT_WERT, 0, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_ABSOLUT_GWSZ_RAM_WERT"
+#define I3_FLD_KOM_STAT_ABSOLUT_GWSZ_EEP_WERT                    I3_PID_KOM_GWSZ_ABSOLUT_WERT, 4, PID_FIELD_SINT32, 1.0f, 0.0f, "STAT_ABSOLUT_GWSZ_EEP_WERT"
+
+// 0xD10E I3_PID_KOM_LSS_TASTE
+#define I3_FLD_KOM_STAT_KOMBI_LSS_TASTE_GEDRUECKT                I3_PID_KOM_LSS_TASTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_LSS_TASTE_GEDRUECKT"
+
+// 0xD111 I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV
+#define I3_FLD_KOM_STAT_ELECTRIC_RANGE_CURRENT_WERT              I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_ELECTRIC_RANGE_CURRENT_WERT"
+#define I3_FLD_KOM_STAT_ELECTRIC_RANGE_MAXIMUM_WERT              I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_ELECTRIC_RANGE_MAXIMUM_WERT"
+#define I3_FLD_KOM_STAT_FUEL_RANGE_CURRENT_WERT                  I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_FUEL_RANGE_CURRENT_WERT"
+#define I3_FLD_KOM_STAT_FUEL_RANGE_MAXIMUM_WERT                  I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_FUEL_RANGE_MAXIMUM_WERT"
+#define I3_FLD_KOM_STAT_RANGE_CONSUMPTION_ELECTRIC_WERT          I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 8, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_RANGE_CONSUMPTION_ELECTRIC_WERT"
+#define I3_FLD_KOM_STAT_NEBENVERBRAUCHERLEISTUNG_WERT            I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_NEBENVERBRAUCHERLEISTUNG_WERT"
+
+// 0xD112 I3_PID_KOM_A_TEMP_WERT
+#define I3_FLD_KOM_STAT_A_TEMP_ANZEIGE_WERT                      I3_PID_KOM_A_TEMP_WERT, 0, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_A_TEMP_ANZEIGE_WERT"
+#define I3_FLD_KOM_STAT_A_TEMP_ROHWERT_WERT                      I3_PID_KOM_A_TEMP_WERT, 1, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_A_TEMP_ROHWERT_WERT"
+
+// 0xD113 I3_PID_KOM_KOMBI_UHRZEIT_DATUM
+#define I3_FLD_KOM_STAT_KOMBI_STUNDE_WERT                        I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_KOMBI_MINUTE_WERT                        I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_KOMBI_SEKUNDE_WERT                       I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_SEKUNDE_WERT"
+#define I3_FLD_KOM_STAT_KOMBI_TAG_WERT                           I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_TAG_WERT"
+#define I3_FLD_KOM_STAT_KOMBI_MONAT_WERT                         I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_MONAT_WERT"
+#define I3_FLD_KOM_STAT_KOMBI_JAHR_WERT                          I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KOMBI_JAHR_WERT"
+#define I3_FLD_KOM_STAT_KOMBI_ZEIT_FORMAT                        I3_PID_KOM_KOMBI_UHRZEIT_DATUM, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMBI_ZEIT_FORMAT"
+
+// 0xD114 I3_PID_KOM_GWSZ_RESET
+#define I3_FLD_KOM_STAT_GWSZ_OFFSET_WERT                         I3_PID_KOM_GWSZ_RESET, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GWSZ_OFFSET_WERT"
+
+// 0xD118 I3_PID_KOM_STARTWERT_ZEITEN
+#define I3_FLD_KOM_STAT_ANZAHL_KODIERTE_STARTZEITEN_WERT         I3_PID_KOM_STARTWERT_ZEITEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_KODIERTE_STARTZEITEN_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_1_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 1, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_1_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_2_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 2, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_2_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_3_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 3, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_3_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_4_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 4, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_4_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_5_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 5, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_5_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_6_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 6, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_6_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ANFANG_7_WERT                  I3_PID_KOM_STARTWERT_ZEITEN, 7, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ANFANG_7_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_1_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 8, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_1_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_2_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 9, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_2_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_3_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 10, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_3_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_4_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 11, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_4_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_5_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 12, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_5_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_6_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 13, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_6_WERT"
+#define I3_FLD_KOM_STAT_STARTZEIT_ENDE_7_WERT                    I3_PID_KOM_STARTWERT_ZEITEN, 14, PID_FIELD_UINT8, 15.0f, 0.0f, "STAT_STARTZEIT_ENDE_7_WERT"
+
+// 0xD11F I3_PID_KOM_TANKINHALT
+#define I3_FLD_KOM_STAT_TANKKAMMER_RECHTS_WERT                   I3_PID_KOM_TANKINHALT, 0, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_TANKKAMMER_RECHTS_WERT"
+#define I3_FLD_KOM_STAT_TANKKAMMER_LINKS_WERT                    I3_PID_KOM_TANKINHALT, 2, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_TANKKAMMER_LINKS_WERT"
+#define I3_FLD_KOM_STAT_SUMMENWERT_WERT                          I3_PID_KOM_TANKINHALT, 4, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_SUMMENWERT_WERT"
+#define I3_FLD_KOM_STAT_GEDAEMPFT_ANZ_WERT                       I3_PID_KOM_TANKINHALT, 6, PID_FIELD_UINT16, 0.0078125f, 0.0f, "STAT_GEDAEMPFT_ANZ_WERT"
+#define I3_FLD_KOM_STAT_TANKPHASE                                I3_PID_KOM_TANKINHALT, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TANKPHASE"
+
+// 0xD121 I3_PID_KOM_TIMER_KLIMATISIERUNG
+#define I3_FLD_KOM_STAT_T1_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T1_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T1_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T1_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T1_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T1_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T1_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T1_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T1_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T1_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+#define I3_FLD_KOM_STAT_T2_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T2_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T2_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T2_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T2_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T2_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T2_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T2_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T2_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T2_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+#define I3_FLD_KOM_STAT_T3_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T3_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T3_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T3_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T3_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T3_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T3_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T3_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T3_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T3_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+#define I3_FLD_KOM_STAT_T4_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T4_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T4_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T4_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T4_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T4_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T4_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T4_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T4_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T4_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+#define I3_FLD_KOM_STAT_T5_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T5_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T5_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T5_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T5_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T5_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T5_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T5_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T5_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T5_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+#define I3_FLD_KOM_STAT_T6_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T6_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T6_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T6_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T6_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T6_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T6_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T6_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T6_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T6_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+#define I3_FLD_KOM_STAT_T7_ID_FUNKTION_BEDIENUNG_TIMER_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 48, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_T7_ID_FUNKTION_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T7_ID_BEDIENUNG_TIMER_WERT               I3_PID_KOM_TIMER_KLIMATISIERUNG, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T7_ID_BEDIENUNG_TIMER_WERT"
+#define I3_FLD_KOM_STAT_T7_BEDIENUNG_TIMER_STUNDE_WERT           I3_PID_KOM_TIMER_KLIMATISIERUNG, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T7_BEDIENUNG_TIMER_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_T7_BEDIENUNG_TIMER_MINUTEN_WERT          I3_PID_KOM_TIMER_KLIMATISIERUNG, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T7_BEDIENUNG_TIMER_MINUTEN_WERT"
+#define I3_FLD_KOM_STAT_T7_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT      I3_PID_KOM_TIMER_KLIMATISIERUNG, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_T7_BEDIENUNG_AUSWAHL_WOCHENTAG_WERT"
+
+// 0xD12C I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN
+#define I3_FLD_KOM_STAT_SEKUNDENZAEHLER_WERT                     I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SEKUNDENZAEHLER_WERT"
+#define I3_FLD_KOM_STAT_TAG_WERT                                 I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TAG_WERT"
+#define I3_FLD_KOM_STAT_MONAT_WERT                               I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MONAT_WERT"
+#define I3_FLD_KOM_STAT_JAHR_WERT                                I3_PID_KOM_ZEITSTEMPEL_HU_ABFRAGEN, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_JAHR_WERT"
+
+// 0xD12F I3_PID_KOM_SEGMENTDATEN_SPEICHER
+#define I3_FLD_KOM_STAT_BLOCK_01_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_01_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_01_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_01_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 3, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_01_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_01_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_01_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 9, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_01_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 10, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_01_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 11, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 12, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_01_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_01_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 17, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_01_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_01_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_02_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_02_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_02_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_02_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 24, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_02_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_02_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_02_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 30, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_02_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 31, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_02_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 32, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 33, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_02_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_02_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 38, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_02_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_02_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_03_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_03_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_03_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_03_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 45, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_03_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_03_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_03_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 51, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_03_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 52, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_03_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 53, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 54, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_03_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_03_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 59, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_03_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_03_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_04_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_04_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 64, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_04_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_04_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 66, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_04_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_04_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_04_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 72, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_04_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 73, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_04_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 74, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 75, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_04_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_04_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 80, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_04_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_04_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_05_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 84, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_05_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 85, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_05_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 86, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_05_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 87, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_05_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 88, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_05_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 89, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_05_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 93, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_05_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 94, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_05_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 95, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 96, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_05_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 100, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_05_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 101, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_05_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 104, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_05_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_06_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 105, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_06_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 106, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_06_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 107, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_06_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 108, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_06_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 109, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_06_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 110, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_06_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 114, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_06_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 115, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_06_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 116, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 117, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_06_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 121, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_06_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 122, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_06_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 125, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_06_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_07_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 126, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_07_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 127, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_07_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 128, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_07_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 129, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_07_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 130, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_07_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 131, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_07_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 135, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_07_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 136, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_07_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 137, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 138, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_07_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 142, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_07_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 143, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_07_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 146, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_07_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_08_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 147, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_08_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 148, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_08_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 149, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_08_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 150, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_08_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 151, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_08_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 152, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_08_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 156, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_08_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 157, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_08_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 158, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 159, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_08_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 163, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_08_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 164, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_08_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 167, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_08_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_09_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 168, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_09_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 169, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_09_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 170, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_09_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 171, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_09_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 172, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_09_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 173, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_09_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 177, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_09_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 178, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_09_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 179, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 180, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_09_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 184, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_09_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 185, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_09_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 188, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_09_STERNE"
+#define I3_FLD_KOM_STAT_BLOCK_10_SEGMENT_ID_WERT                 I3_PID_KOM_SEGMENTDATEN_SPEICHER, 189, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_10_SEGMENT_ID_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_TAG_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 190, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_10_TAG_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_MONAT_WERT                      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 191, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_10_MONAT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_JAHR_WERT                       I3_PID_KOM_SEGMENTDATEN_SPEICHER, 192, PID_FIELD_UINT8, 1.0f, 2000.0f, "STAT_BLOCK_10_JAHR_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_STUNDE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 193, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_10_STUNDE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_MINUTE_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 194, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_10_MINUTE_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_A_TEMP_WERT                     I3_PID_KOM_SEGMENTDATEN_SPEICHER, 198, PID_FIELD_UINT8, 0.5f, -40.0f, "STAT_BLOCK_10_A_TEMP_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_AKT_DAUER_ECO_WERT              I3_PID_KOM_SEGMENTDATEN_SPEICHER, 199, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_10_AKT_DAUER_ECO_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT    I3_PID_KOM_SEGMENTDATEN_SPEICHER, 200, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_SOC_WERT                        I3_PID_KOM_SEGMENTDATEN_SPEICHER, 201, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_10_SOC_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_REKUPERATION_WERT               I3_PID_KOM_SEGMENTDATEN_SPEICHER, 205, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLOCK_10_REKUPERATION_WERT"
+#define I3_FLD_KOM_STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT      I3_PID_KOM_SEGMENTDATEN_SPEICHER, 206, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT"
+#define I3_FLD_KOM_BF_BLOCK_10_STERNE                            I3_PID_KOM_SEGMENTDATEN_SPEICHER, 209, PID_FIELD_UINT8, 1.0f, 0.0f, "BF_BLOCK_10_STERNE"
+
+// 0xD1D0 I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF
+#define I3_FLD_KOM_STAT_PRW_WERT                                 I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PRW_WERT"
+#define I3_FLD_KOM_STAT_CRW_WERT                                 I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CRW_WERT"
+#define I3_FLD_KOM_STAT_BCRW_WERT                                I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BCRW_WERT"
+#define I3_FLD_KOM_STAT_GRW_WERT                                 I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_GRW_WERT"
+#define I3_FLD_KOM_STAT_GK_WERT                                  I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_GK_WERT"
+
+// 0xD1D1 I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA
+#define I3_FLD_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT                 I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AKKUM_ABS_VERBR_ERH_WERT"
+#define I3_FLD_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT              I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VERBR_ERH_VERZOEGERUNG_WERT"
+#define I3_FLD_KOM_STAT_VERBR_ERH_MSA_WERT                       I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VERBR_ERH_MSA_WERT"
+#define I3_FLD_KOM_STAT_V_REF_WERT                               I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 12, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_V_REF_WERT"
+#define I3_FLD_KOM_STAT_V_IST_WERT                               I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 14, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_V_IST_WERT"
+#define I3_FLD_KOM_STAT_FWP_AKT_WERT                             I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 16, PID_FIELD_UINT16, 0.025f, 0.0f, "STAT_FWP_AKT_WERT"
+#define I3_FLD_KOM_STAT_BLS_VERZOEGERUNG                         I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLS_VERZOEGERUNG"
+
+// 0xD1D2 I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI
+#define I3_FLD_KOM_STAT_PI_PROZ_VERBR_ERH_WERT                   I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_PROZ_VERBR_ERH_WERT"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_GW_WERT                     I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GW_WERT"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT                 I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GESCHW_WERT"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT                 I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_BESCHL_WERT"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_KOMF_WERT                   I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_KOMF_WERT"
+
+// 0xD1D3 I3_PID_KOM_MEHRVERBRAUCH_MV_REF
+#define I3_FLD_KOM_STAT_MV_AKT_WERT                              I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_AKT_WERT"
+#define I3_FLD_KOM_STAT_MV_REF_WERT                              I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_WERT"
+#define I3_FLD_KOM_STAT_MV_REF_30_WERT                           I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_30_WERT"
+#define I3_FLD_KOM_STAT_MV_REF_70_WERT                           I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_70_WERT"
+#define I3_FLD_KOM_STAT_MV_REF_100_WERT                          I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_100_WERT"
+#define I3_FLD_KOM_STAT_MV_REF_MAX_WERT                          I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_MAX_WERT"
+#define I3_FLD_KOM_STAT_MV_REF_GESAMT_WERT                       I3_PID_KOM_MEHRVERBRAUCH_MV_REF, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_GESAMT_WERT"
+
+// 0xD1D4 I3_PID_KOM_ECO_MODE_AUSTRITT
+#define I3_FLD_KOM_STAT_ECO_MODE_AUSTRITT                        I3_PID_KOM_ECO_MODE_AUSTRITT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECO_MODE_AUSTRITT"
+#define I3_FLD_KOM_STAT_ECO_TIPP_ANZ                             I3_PID_KOM_ECO_MODE_AUSTRITT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECO_TIPP_ANZ"
+
+// 0xD1D5 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_X_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_X_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_X_WERT"
+
+// 0xD1D6 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_Y_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Y_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Y_WERT"
+
+// 0xD1D7 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_Z_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Z_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Z_WERT"
+
+// 0xD1D8 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT               I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT                  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT              I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_A_WERT                I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_A_WERT"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT                 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_A_WERT"
+
+// 0xD1D9 I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT
+#define I3_FLD_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT    I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT"
+
+// 0xDA00 I3_PID_KOM_KOMBI_HUD_AKTIVE_WARPLISTE
+#define I3_FLD_KOM_STAT_WARPLISTE_AKTIV                          I3_PID_KOM_KOMBI_HUD_AKTIVE_WARPLISTE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WARPLISTE_AKTIV"
+
+// 0xDA0A I3_PID_KOM_STATUS_HUD_BILDPOSITION_SCHRITTE
+#define I3_FLD_KOM_STAT_HUD_BILDPOSITION_SCHRITTE_WERT           I3_PID_KOM_STATUS_HUD_BILDPOSITION_SCHRITTE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_BILDPOSITION_SCHRITTE_WERT"
+
+// 0xDA0F I3_PID_KOM_STATUS_HUD_BILDROTATION_SCHRITTE
+#define I3_FLD_KOM_STAT_HUD_BILDROTATION_SCHRITTE_WERT           I3_PID_KOM_STATUS_HUD_BILDROTATION_SCHRITTE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_BILDROTATION_SCHRITTE_WERT"
+
+// 0xDA43 I3_PID_KOM_HUD_PORTS_LESEN
+#define I3_FLD_KOM_STAT_HUD_AD_TEMP_BL_WERT                      I3_PID_KOM_HUD_PORTS_LESEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_AD_TEMP_BL_WERT"
+#define I3_FLD_KOM_STAT_HUD_AD_KL30_WERT                         I3_PID_KOM_HUD_PORTS_LESEN, 1, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_HUD_AD_KL30_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_DRV_CUR_WERT                     I3_PID_KOM_HUD_PORTS_LESEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_DRV_CUR_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_DRV_SPG_WERT                     I3_PID_KOM_HUD_PORTS_LESEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_DRV_SPG_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_DRV_FET1_WERT                    I3_PID_KOM_HUD_PORTS_LESEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_DRV_FET1_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_DRV_FET2_WERT                    I3_PID_KOM_HUD_PORTS_LESEN, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_DRV_FET2_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_DRV_OV_WERT                      I3_PID_KOM_HUD_PORTS_LESEN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_DRV_OV_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_DRV_FAULT_WERT                   I3_PID_KOM_HUD_PORTS_LESEN, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_DRV_FAULT_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_PWM_WERT                         I3_PID_KOM_HUD_PORTS_LESEN, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HUD_LED_PWM_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_PWM_INV_WERT                     I3_PID_KOM_HUD_PORTS_LESEN, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HUD_LED_PWM_INV_WERT"
+#define I3_FLD_KOM_STAT_HUD_SMC_FLAGS_WERT                       I3_PID_KOM_HUD_PORTS_LESEN, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_SMC_FLAGS_WERT"
+#define I3_FLD_KOM_STAT_RESERVE1_WERT                            I3_PID_KOM_HUD_PORTS_LESEN, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESERVE1_WERT"
+#define I3_FLD_KOM_STAT_RESERVE2_WERT                            I3_PID_KOM_HUD_PORTS_LESEN, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESERVE2_WERT"
+#define I3_FLD_KOM_STAT_RESERVE3_WERT                            I3_PID_KOM_HUD_PORTS_LESEN, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESERVE3_WERT"
+#define I3_FLD_KOM_STAT_RESERVE4_WERT                            I3_PID_KOM_HUD_PORTS_LESEN, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESERVE4_WERT"
+
+// 0xDA44 I3_PID_KOM_HUD_SW_VERSION_LESEN
+#define I3_FLD_KOM_STAT_SW_VERSION_MAIN_WERT                     I3_PID_KOM_HUD_SW_VERSION_LESEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_VERSION_MAIN_WERT"
+#define I3_FLD_KOM_STAT_SW_VERSION_MINOR_WERT                    I3_PID_KOM_HUD_SW_VERSION_LESEN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_VERSION_MINOR_WERT"
+#define I3_FLD_KOM_STAT_SW_VERSION_PATCH_WERT                    I3_PID_KOM_HUD_SW_VERSION_LESEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_VERSION_PATCH_WERT"
+
+// 0xDA46 I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT
+#define I3_FLD_KOM_STAT_SENSOR_VERBAUORT_NR_WERT                 I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SENSOR_VERBAUORT_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_BMW_TEILE_NR_WERT                 I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SENSOR_BMW_TEILE_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_HERSTELLER_NR_WERT                I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SENSOR_HERSTELLER_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_SERIEN_NR_WERT                    I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SENSOR_SERIEN_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_PROD_DATUM_YEAR_WERT              I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENSOR_PROD_DATUM_YEAR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_PROD_DATUM_MONTH_WERT             I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENSOR_PROD_DATUM_MONTH_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_PROD_DATUM_DAY_WERT               I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENSOR_PROD_DATUM_DAY_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_HW_VERSION_NR_WERT                I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SENSOR_HW_VERSION_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_OPTIK_VERSION_NR_WERT             I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SENSOR_OPTIK_VERSION_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_MECHANIK_VERSION_NR_WERT          I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SENSOR_MECHANIK_VERSION_NR_WERT"
+#define I3_FLD_KOM_STAT_SENSOR_FLASH_VERSION_NR_WERT             I3_PID_KOM_HUD_SENSOREN_IDENT_LESEN_ERWEITERT, 21, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SENSOR_FLASH_VERSION_NR_WERT"
+
+// 0xDA47 I3_PID_KOM_KOMBI_HUD_BILDPOSITION_STUFEN
+#define I3_FLD_KOM_STAT_HUD_BILDROTATION_STUFEN_WERT             I3_PID_KOM_KOMBI_HUD_BILDPOSITION_STUFEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_BILDROTATION_STUFEN_WERT"
+
+// 0x4200 I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200
+#define I3_FLD_KOM_STAT_PRW_WERT_0X4200                          I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PRW_WERT_0X4200"
+#define I3_FLD_KOM_STAT_CRW_WERT_0X4200                          I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CRW_WERT_0X4200"
+#define I3_FLD_KOM_STAT_BCRW_WERT_0X4200                         I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BCRW_WERT_0X4200"
+#define I3_FLD_KOM_STAT_GRW_WERT_0X4200                          I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_GRW_WERT_0X4200"
+#define I3_FLD_KOM_STAT_GK_WERT_0X4200                           I3_PID_KOM_REICHWEITE_GEWONNENER_KRAFTSTOFF_0X4200, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_GK_WERT_0X4200"
+
+// 0x4201 I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201
+#define I3_FLD_KOM_STAT_AKKUM_ABS_VERBR_ERH_WERT_0X4201          I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AKKUM_ABS_VERBR_ERH_WERT_0X4201"
+#define I3_FLD_KOM_STAT_VERBR_ERH_VERZOEGERUNG_WERT_0X4201       I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VERBR_ERH_VERZOEGERUNG_WERT_0X4201"
+#define I3_FLD_KOM_STAT_VERBR_ERH_MSA_WERT_0X4201                I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VERBR_ERH_MSA_WERT_0X4201"
+#define I3_FLD_KOM_STAT_V_REF_WERT_0X4201                        I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 12, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_V_REF_WERT_0X4201"
+#define I3_FLD_KOM_STAT_V_IST_WERT_0X4201                        I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 14, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_V_IST_WERT_0X4201"
+#define I3_FLD_KOM_STAT_FWP_AKT_WERT_0X4201                      I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 16, PID_FIELD_UINT16, 0.025f, 0.0f, "STAT_FWP_AKT_WERT_0X4201"
+#define I3_FLD_KOM_STAT_BLS_VERZOEGERUNG_0X4201                  I3_PID_KOM_VERBRAUCHSERHOEHUNG_ALPHA_0X4201, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLS_VERZOEGERUNG_0X4201"
+
+// 0x4202 I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202
+#define I3_FLD_KOM_STAT_PI_PROZ_VERBR_ERH_WERT_0X4202            I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_PROZ_VERBR_ERH_WERT_0X4202"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_GW_WERT_0X4202              I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GW_WERT_0X4202"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_GESCHW_WERT_0X4202          I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_GESCHW_WERT_0X4202"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_BESCHL_WERT_0X4202          I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_BESCHL_WERT_0X4202"
+#define I3_FLD_KOM_STAT_PI_VERBR_ERH_KOMF_WERT_0X4202            I3_PID_KOM_VERBRAUCHSERHOEHUNG_PI_0X4202, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PI_VERBR_ERH_KOMF_WERT_0X4202"
+
+// 0x4203 I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203
+#define I3_FLD_KOM_STAT_MV_AKT_WERT_0X4203                       I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_AKT_WERT_0X4203"
+#define I3_FLD_KOM_STAT_MV_REF_WERT_0X4203                       I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_WERT_0X4203"
+#define I3_FLD_KOM_STAT_MV_REF_30_WERT_0X4203                    I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_30_WERT_0X4203"
+#define I3_FLD_KOM_STAT_MV_REF_70_WERT_0X4203                    I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_70_WERT_0X4203"
+#define I3_FLD_KOM_STAT_MV_REF_100_WERT_0X4203                   I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_100_WERT_0X4203"
+#define I3_FLD_KOM_STAT_MV_REF_MAX_WERT_0X4203                   I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_MAX_WERT_0X4203"
+#define I3_FLD_KOM_STAT_MV_REF_GESAMT_WERT_0X4203                I3_PID_KOM_MEHRVERBRAUCH_MV_REF_0X4203, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MV_REF_GESAMT_WERT_0X4203"
+
+// 0x4204 I3_PID_KOM_ECO_MODE_AUSTRITT_0X4204
+#define I3_FLD_KOM_STAT_ECO_MODE_AUSTRITT_0X4204                 I3_PID_KOM_ECO_MODE_AUSTRITT_0X4204, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECO_MODE_AUSTRITT_0X4204"
+#define I3_FLD_KOM_STAT_ECO_TIPP_ANZ_0X4204                      I3_PID_KOM_ECO_MODE_AUSTRITT_0X4204, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ECO_TIPP_ANZ_0X4204"
+
+// 0x4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_0X4205   I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_0X4205  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_X_WERT_0X4205        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_X_WERT_0X4205           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_X_WERT_0X4205       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_0X4205 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_X_WERT_0X4205         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_X_WERT_0X4205"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_X_WERT_0X4205          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_X_0X4205, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_X_WERT_0X4205"
+
+// 0x4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_0X4206   I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_0X4206  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_0X4206        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_Y_WERT_0X4206           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_0X4206       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_0X4206 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_Y_WERT_0X4206         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Y_WERT_0X4206"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_Y_WERT_0X4206          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Y_0X4206, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Y_WERT_0X4206"
+
+// 0x4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_0X4207   I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_0X4207  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_0X4207        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_Z_WERT_0X4207           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_0X4207       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_0X4207 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_Z_WERT_0X4207         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_Z_WERT_0X4207"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_Z_WERT_0X4207          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_Z_0X4207, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_Z_WERT_0X4207"
+
+// 0x4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_0X4208   I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_8_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_0X4208  I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSWERT_16_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG1_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG1_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG1_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG1_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG1_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG2_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG2_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG2_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG2_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG2_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG3_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG3_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG3_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG3_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG3_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG4_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG4_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG4_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG4_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG4_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG5_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG5_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG5_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG5_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG5_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG6_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG6_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG6_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG6_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG6_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG7_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG7_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG7_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG7_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG7_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG8_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG8_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG8_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG8_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG8_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG9_SKAL_A_WERT_0X4208        I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 44, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG9_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG9_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG9_SKAL_A_WERT_0X4208           I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG9_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG10_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG10_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG10_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG10_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG10_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG11_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG11_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG11_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG11_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG11_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG12_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG12_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG12_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG12_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG12_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG13_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG13_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 66, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG13_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 67, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG13_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG13_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG14_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG14_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 71, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG14_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG14_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG14_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG15_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 74, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG15_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG15_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 77, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG15_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG15_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCH_SEG16_SKAL_A_WERT_0X4208       I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 79, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBRAUCH_SEG16_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_0X4208 I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERBRAUCHVORTEIL_SEG16_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_SKAL_A_WERT_0X4208         I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 82, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_SKAL_A_WERT_0X4208"
+#define I3_FLD_KOM_STAT_FDS_FU_SEG16_SKAL_A_WERT_0X4208          I3_PID_KOM_VERBRAEUCHE_SKALIERUNG_A_0X4208, 83, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FDS_FU_SEG16_SKAL_A_WERT_0X4208"
+
+// 0x4209 I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_0X4209
+#define I3_FLD_KOM_STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_0X4209 I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_0X4209, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITT_AKT_BERECH_SEGMENTS_WERT_0X4209"
+#define I3_FLD_KOM_STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_0X4209 I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_0X4209, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DURCHSCHNITT_HYBRID_RUECKGEW_AKT_SEGM_WERT_0X4209"
+
+// 0x420A I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_8_WERT            I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_8_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_16_WERT           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_16_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG1_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG1_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG1_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG1_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG1_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG1_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG1_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG1_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG2_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG2_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG2_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG2_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG2_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG2_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG2_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG2_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG3_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG3_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG3_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG3_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG3_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG3_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG3_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG3_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG4_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG4_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG4_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG4_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG4_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG4_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG4_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG4_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG5_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG5_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG5_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG5_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG5_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG5_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG5_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG5_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG6_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG6_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG6_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 36, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG6_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG6_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG6_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG6_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG6_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG7_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 40, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG7_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG7_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 42, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG7_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG7_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG7_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG7_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG7_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG8_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG8_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG8_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 48, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG8_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG8_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG8_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG8_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG8_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG9_X_WERT       I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 52, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG9_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG9_X_WERT    I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 54, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG9_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG9_X_WERT                      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 56, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG9_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG9_X_WERT                           I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG9_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG10_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 58, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG10_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG10_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG10_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG10_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG10_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG10_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG10_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG11_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 64, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG11_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG11_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 66, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG11_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG11_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 68, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG11_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG11_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG11_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG12_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 70, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG12_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG12_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 72, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG12_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG12_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG12_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG12_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 75, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG12_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG13_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 76, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG13_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG13_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 78, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG13_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG13_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 80, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG13_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG13_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG13_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG14_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 82, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG14_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG14_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 84, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG14_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG14_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 86, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG14_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG14_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 87, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG14_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG15_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 88, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG15_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG15_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 90, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG15_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG15_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 92, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG15_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG15_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 93, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG15_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSVERBRAUCH_SEG16_X_WERT      I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 94, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSVERBRAUCH_SEG16_X_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNITTSREKUPERATION_SEG16_X_WERT   I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 96, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DURCHSCHNITTSREKUPERATION_SEG16_X_WERT"
+#define I3_FLD_KOM_STAT_ZAEHLER_SEG16_X_WERT                     I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 98, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZAEHLER_SEG16_X_WERT"
+#define I3_FLD_KOM_STAT_FU_SEG16_X_WERT                          I3_PID_KOM_VERVRAEUCHE_SKALIERUNG_MCV, 99, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FU_SEG16_X_WERT"
+
+// 0x420B I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_MCV
+#define I3_FLD_KOM_STAT_DURCHSCHNT_VERBRAUCH_AKT_SEGM_WERT       I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_MCV, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNT_VERBRAUCH_AKT_SEGM_WERT"
+#define I3_FLD_KOM_STAT_DURCHSCHNT_REKUPERATION_AKT_SEGM_WERT    I3_PID_KOM_VERBRAUCHSVORTEIL_HYBRID_AKT_SEGMENT_MCV, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DURCHSCHNT_REKUPERATION_AKT_SEGM_WERT"
+
+// 0x420C I3_PID_KOM_REICHWEITE_MCV
+#define I3_FLD_KOM_STAT_ECO_MODE_REICHWEITE_WERT                 I3_PID_KOM_REICHWEITE_MCV, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ECO_MODE_REICHWEITE_WERT"
+#define I3_FLD_KOM_STAT_COMFORT_MODE_REICHWEITE_WERT             I3_PID_KOM_REICHWEITE_MCV, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_COMFORT_MODE_REICHWEITE_WERT"
+#define I3_FLD_KOM_STAT_BC_REICHWEITE_WERT                       I3_PID_KOM_REICHWEITE_MCV, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BC_REICHWEITE_WERT"
+#define I3_FLD_KOM_STAT_ECO_PRO_PLUS_REICHWEITE_WERT             I3_PID_KOM_REICHWEITE_MCV, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_ECO_PRO_PLUS_REICHWEITE_WERT"
+
+// 0x420D I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A
+#define I3_FLD_KOM_STAT_AKKUMULIERTE_ABS_VERBR_ERHOEHUNG_WERT    I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_AKKUMULIERTE_ABS_VERBR_ERHOEHUNG_WERT"
+#define I3_FLD_KOM_STAT_VERBR_ERHOEHUNG_VERZ_WERT                I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VERBR_ERHOEHUNG_VERZ_WERT"
+#define I3_FLD_KOM_STAT_VERBR_REF_WERT                           I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBR_REF_WERT"
+#define I3_FLD_KOM_STAT_VERBR_IST_WERT                           I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBR_IST_WERT"
+#define I3_FLD_KOM_STAT_FWP_AKT_WERT_0X420D                      I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A, 12, PID_FIELD_UINT16, 0.0004f, 0.0f, "STAT_FWP_AKT_WERT_0X420D"
+#define I3_FLD_KOM_STAT_BLS_VERZOEGERUNG_0X420D                  I3_PID_KOM_VERBRAUCH_ERHOEHUNG_A, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BLS_VERZOEGERUNG_0X420D"
+
+// 0x420E I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT
+#define I3_FLD_KOM_STAT_PROZENTUALE_VERBRAUCH_ERHOEHUNG_WERT     I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_PROZENTUALE_VERBRAUCH_ERHOEHUNG_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_ERHOEHUNG_GESCHW_WERT          I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_VERBRAUCH_ERHOEHUNG_GESCHW_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_ERHOEHUNG_BESCHLEUN_WERT       I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_VERBRAUCH_ERHOEHUNG_BESCHLEUN_WERT"
+#define I3_FLD_KOM_STAT_VERBRAUCH_ERHOEHUNG_KOMFORT_WERT         I3_PID_KOM_VERBRAUCH_ERHOEHUNG_TT, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_VERBRAUCH_ERHOEHUNG_KOMFORT_WERT"
+
+// 0x420F I3_PID_KOM_MEHRVERBRAUCH
+#define I3_FLD_KOM_STAT_MEHRVERBRAUCH_AKT_WERT                   I3_PID_KOM_MEHRVERBRAUCH, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_AKT_WERT"
+#define I3_FLD_KOM_STAT_MEHRVERBRAUCH_REF_WERT                   I3_PID_KOM_MEHRVERBRAUCH, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_REF_WERT"
+#define I3_FLD_KOM_STAT_MEHRVERBRAUCH_ECO_WERT                   I3_PID_KOM_MEHRVERBRAUCH, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_ECO_WERT"
+#define I3_FLD_KOM_STAT_MEHRVERBRAUCH_ECO_PLUS_WERT              I3_PID_KOM_MEHRVERBRAUCH, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_ECO_PLUS_WERT"
+#define I3_FLD_KOM_STAT_MEHRVERBRAUCH_200M_WERT                  I3_PID_KOM_MEHRVERBRAUCH, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MEHRVERBRAUCH_200M_WERT"
+
+// 0x4210 I3_PID_KOM_ECO_MODE_AUSTRITT_0X4210
+#define I3_FLD_KOM_RES_0x4210_D                                  I3_PID_KOM_ECO_MODE_AUSTRITT_0X4210, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "RES_0x4210_D"
+
+// 0x4230 I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO
+#define I3_FLD_KOM_STAT_STUETZSTELLE1_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE1_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE2_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE2_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE3_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE3_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE4_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE4_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE5_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE5_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE6_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE6_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE7_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE7_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE8_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 14, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE8_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE9_WERT                       I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 16, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE9_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE10_WERT                      I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 18, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE10_WERT"
+#define I3_FLD_KOM_STAT_STUETZSTELLE11_WERT                      I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_ECO, 20, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE11_WERT"
+
+// 0x4231 I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL
+#define I3_FLD_KOM_STAT_STUETZSTELLE1_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE1_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE2_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE2_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE3_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE3_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE4_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE4_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE5_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE5_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE6_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE6_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE7_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE7_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE8_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 14, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE8_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE9_WERT_0X4231                I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 16, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE9_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE10_WERT_0X4231               I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 18, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE10_WERT_0X4231"
+#define I3_FLD_KOM_STAT_STUETZSTELLE11_WERT_0X4231               I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_NORMAL, 20, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_STUETZSTELLE11_WERT_0X4231"
+
+// 0x4232 I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR
+#define I3_FLD_KOM_STAT_LERNFAKTOR1_ECO_WERT                     I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR1_ECO_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR2_ECO_WERT                     I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR2_ECO_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR3_ECO_WERT                     I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR3_ECO_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR4_ECO_WERT                     I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR4_ECO_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR1_NORMAL_WERT                  I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR1_NORMAL_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR2_NORMAL_WERT                  I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR2_NORMAL_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR3_NORMAL_WERT                  I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR3_NORMAL_WERT"
+#define I3_FLD_KOM_STAT_LERNFAKTOR4_NORMAL_WERT                  I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_LERNFAKTOR, 14, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LERNFAKTOR4_NORMAL_WERT"
+
+// 0x4233 I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR
+#define I3_FLD_KOM_STAT_DELTA_RATIO_ECO_WERT                     I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_DELTA_RATIO_ECO_WERT"
+#define I3_FLD_KOM_STAT_VB_INTERPOLIERT_ECO_WERT                 I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_VB_INTERPOLIERT_ECO_WERT"
+#define I3_FLD_KOM_STAT_DELTA_RATIO_NORMAL_WERT                  I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_DELTA_RATIO_NORMAL_WERT"
+#define I3_FLD_KOM_STAT_VB_INTERPOLIERT_NORMAL_WERT              I3_PID_KOM_VERBRAUCH_CHARAKTERISTIK_FAKTOR, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_VB_INTERPOLIERT_NORMAL_WERT"
+
+// 0x4800 I3_PID_KOM_HUD_LOGBUCH
+#define I3_FLD_KOM_STAT_HUD_OPERATION_HOURS_WERT                 I3_PID_KOM_HUD_LOGBUCH, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_OPERATION_HOURS_WERT"
+#define I3_FLD_KOM_STAT_HUD_OPERATION_MINUTES_WERT               I3_PID_KOM_HUD_LOGBUCH, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_OPERATION_MINUTES_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_OPERATION_HOURS_WERT             I3_PID_KOM_HUD_LOGBUCH, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_LED_OPERATION_HOURS_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_OPERATION_MINUTES_WERT           I3_PID_KOM_HUD_LOGBUCH, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_OPERATION_MINUTES_WERT"
+#define I3_FLD_KOM_STAT_HUD_LED_REPEAT_TIME_WERT                 I3_PID_KOM_HUD_LOGBUCH, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_LED_REPEAT_TIME_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP_THRESHOLD_01_WERT               I3_PID_KOM_HUD_LOGBUCH, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_01_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP_THRESHOLD_02_WERT               I3_PID_KOM_HUD_LOGBUCH, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_02_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP_THRESHOLD_03_WERT               I3_PID_KOM_HUD_LOGBUCH, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_03_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP_THRESHOLD_04_WERT               I3_PID_KOM_HUD_LOGBUCH, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_TEMP_THRESHOLD_04_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP1_WERT                           I3_PID_KOM_HUD_LOGBUCH, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_TEMP1_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP2_WERT                           I3_PID_KOM_HUD_LOGBUCH, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_TEMP2_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP3_WERT                           I3_PID_KOM_HUD_LOGBUCH, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_TEMP3_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP4_WERT                           I3_PID_KOM_HUD_LOGBUCH, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_TEMP4_WERT"
+#define I3_FLD_KOM_STAT_HUD_TEMP5_WERT                           I3_PID_KOM_HUD_LOGBUCH, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_TEMP5_WERT"
+#define I3_FLD_KOM_STAT_HUD_LOGTIME_WERT                         I3_PID_KOM_HUD_LOGBUCH, 21, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_LOGTIME_WERT"
+#define I3_FLD_KOM_STAT_HUD_DIM_THRESHOLD_01_WERT                I3_PID_KOM_HUD_LOGBUCH, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_01_WERT"
+#define I3_FLD_KOM_STAT_HUD_DIM_THRESHOLD_02_WERT                I3_PID_KOM_HUD_LOGBUCH, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_02_WERT"
+#define I3_FLD_KOM_STAT_HUD_DIM_THRESHOLD_03_WERT                I3_PID_KOM_HUD_LOGBUCH, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_03_WERT"
+#define I3_FLD_KOM_STAT_HUD_DIM_THRESHOLD_04_WERT                I3_PID_KOM_HUD_LOGBUCH, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_DIM_THRESHOLD_04_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_1_DIM1_WERT                     I3_PID_KOM_HUD_LOGBUCH, 27, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM1_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_1_DIM2_WERT                     I3_PID_KOM_HUD_LOGBUCH, 29, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM2_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_1_DIM3_WERT                     I3_PID_KOM_HUD_LOGBUCH, 31, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM3_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_1_DIM4_WERT                     I3_PID_KOM_HUD_LOGBUCH, 33, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM4_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_1_DIM5_WERT                     I3_PID_KOM_HUD_LOGBUCH, 35, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_1_DIM5_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_2_DIM1_WERT                     I3_PID_KOM_HUD_LOGBUCH, 37, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM1_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_2_DIM2_WERT                     I3_PID_KOM_HUD_LOGBUCH, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM2_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_2_DIM3_WERT                     I3_PID_KOM_HUD_LOGBUCH, 41, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM3_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_2_DIM4_WERT                     I3_PID_KOM_HUD_LOGBUCH, 43, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM4_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_2_DIM5_WERT                     I3_PID_KOM_HUD_LOGBUCH, 45, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_2_DIM5_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_3_DIM1_WERT                     I3_PID_KOM_HUD_LOGBUCH, 47, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM1_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_3_DIM2_WERT                     I3_PID_KOM_HUD_LOGBUCH, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM2_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_3_DIM3_WERT                     I3_PID_KOM_HUD_LOGBUCH, 51, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM3_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_3_DIM4_WERT                     I3_PID_KOM_HUD_LOGBUCH, 53, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM4_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_3_DIM5_WERT                     I3_PID_KOM_HUD_LOGBUCH, 55, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_3_DIM5_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_4_DIM1_WERT                     I3_PID_KOM_HUD_LOGBUCH, 57, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM1_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_4_DIM2_WERT                     I3_PID_KOM_HUD_LOGBUCH, 59, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM2_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_4_DIM3_WERT                     I3_PID_KOM_HUD_LOGBUCH, 61, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM3_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_4_DIM4_WERT                     I3_PID_KOM_HUD_LOGBUCH, 63, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM4_WERT"
+#define I3_FLD_KOM_STAT_HUD_ZONE_4_DIM5_WERT                     I3_PID_KOM_HUD_LOGBUCH, 65, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ZONE_4_DIM5_WERT"
+#define I3_FLD_KOM_STAT_HUD_HEIGHT_ADJUSTMENT_WERT               I3_PID_KOM_HUD_LOGBUCH, 67, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_HEIGHT_ADJUSTMENT_WERT"
+#define I3_FLD_KOM_STAT_HUD_ROTATION_WERT                        I3_PID_KOM_HUD_LOGBUCH, 69, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ROTATION_WERT"
+#define I3_FLD_KOM_STAT_HUD_ACTIVATION_WERT                      I3_PID_KOM_HUD_LOGBUCH, 71, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_ACTIVATION_WERT"
+#define I3_FLD_KOM_STAT_HUD_ENVIRONMENTAL_COND_WERT              I3_PID_KOM_HUD_LOGBUCH, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_ENVIRONMENTAL_COND_WERT"
+
+// 0x4801 I3_PID_KOM_HUD_PIA
+#define I3_FLD_KOM_STAT_HUD_USER0_BRIGHT_WERT                    I3_PID_KOM_HUD_PIA, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER0_BRIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER0_HEIGHT_WERT                    I3_PID_KOM_HUD_PIA, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER0_HEIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER0_ROTATION_WERT                  I3_PID_KOM_HUD_PIA, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER0_ROTATION_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER0_FUNKTION_WERT                  I3_PID_KOM_HUD_PIA, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_USER0_FUNKTION_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER1_BRIGHT_WERT                    I3_PID_KOM_HUD_PIA, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER1_BRIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER1_HEIGHT_WERT                    I3_PID_KOM_HUD_PIA, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER1_HEIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER1_ROTATION_WERT                  I3_PID_KOM_HUD_PIA, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER1_ROTATION_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER1_FUNKTION_WERT                  I3_PID_KOM_HUD_PIA, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_USER1_FUNKTION_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER2_BRIGHT_WERT                    I3_PID_KOM_HUD_PIA, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER2_BRIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER2_HEIGHT_WERT                    I3_PID_KOM_HUD_PIA, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER2_HEIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER2_ROTATION_WERT                  I3_PID_KOM_HUD_PIA, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_USER2_ROTATION_WERT"
+#define I3_FLD_KOM_STAT_HUD_USER2_FUNKTION_WERT                  I3_PID_KOM_HUD_PIA, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_USER2_FUNKTION_WERT"
+#define I3_FLD_KOM_STAT_HUD_GUEST_BRIGHT_WERT                    I3_PID_KOM_HUD_PIA, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_GUEST_BRIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_GUEST_HEIGHT_WERT                    I3_PID_KOM_HUD_PIA, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_GUEST_HEIGHT_WERT"
+#define I3_FLD_KOM_STAT_HUD_GUEST_ROTATION_WERT                  I3_PID_KOM_HUD_PIA, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HUD_GUEST_ROTATION_WERT"
+#define I3_FLD_KOM_STAT_HUD_GUEST_FUNKTION_WERT                  I3_PID_KOM_HUD_PIA, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HUD_GUEST_FUNKTION_WERT"
+
+// 0x4803 I3_PID_KOM_HUD_NO_SIGNAL_SCREEN
+
+// 0x4804 I3_PID_KOM_HUD_START_UP_SCREEN
+
+// 0x4805 I3_PID_KOM_HUD_PROCESS_VERSION_READ
+#define I3_FLD_KOM_STAT_AL_NUMMER_WERT                           I3_PID_KOM_HUD_PROCESS_VERSION_READ, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AL_NUMMER_WERT"
+
+// 0xD126 I3_PID_KOM_KOMBI_BC_BCW_L_KM
+#define I3_FLD_KOM_STAT_BC_DSV_L_KM_WERT                         I3_PID_KOM_KOMBI_BC_BCW_L_KM, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_BC_DSV_L_KM_WERT"
+#define I3_FLD_KOM_STAT_BC_DSG_L_KM_WERT                         I3_PID_KOM_KOMBI_BC_BCW_L_KM, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_BC_DSG_L_KM_WERT"
+#define I3_FLD_KOM_STAT_BC_MVERB_L_KM_WERT                       I3_PID_KOM_KOMBI_BC_BCW_L_KM, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_BC_MVERB_L_KM_WERT"
+#define I3_FLD_KOM_STAT_BC_RW_L_KM_WERT                          I3_PID_KOM_KOMBI_BC_BCW_L_KM, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BC_RW_L_KM_WERT"
+
+// 0xD127 I3_PID_KOM_KOMBI_BC_RBC_L_KM
+#define I3_FLD_KOM_STAT_RBC_DSV_L_KM_WERT                        I3_PID_KOM_KOMBI_BC_RBC_L_KM, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RBC_DSV_L_KM_WERT"
+#define I3_FLD_KOM_STAT_RBC_DSG_L_KM_WERT                        I3_PID_KOM_KOMBI_BC_RBC_L_KM, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RBC_DSG_L_KM_WERT"
+#define I3_FLD_KOM_STAT_RBC_STRECKE_L_KM_WERT                    I3_PID_KOM_KOMBI_BC_RBC_L_KM, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RBC_STRECKE_L_KM_WERT"
+
+// 0xD129 I3_PID_KOM_KOMBI_BC_BCW_KWH_KM
+#define I3_FLD_KOM_STAT_BC_DSV_KWH_KM_WERT                       I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BC_DSV_KWH_KM_WERT"
+#define I3_FLD_KOM_STAT_BC_DSG_KWH_KM_WERT                       I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_BC_DSG_KWH_KM_WERT"
+#define I3_FLD_KOM_STAT_BC_MVERB_KWH_KM_WERT                     I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BC_MVERB_KWH_KM_WERT"
+#define I3_FLD_KOM_STAT_BC_RW_KWH_KM_WERT                        I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_BC_RW_KWH_KM_WERT"
+
+// 0xD12A I3_PID_KOM_KOMBI_BC_RBC_KWH_KM
+#define I3_FLD_KOM_STAT_RBC_DSV_KWH_KM_WERT                      I3_PID_KOM_KOMBI_BC_RBC_KWH_KM, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_RBC_DSV_KWH_KM_WERT"
+#define I3_FLD_KOM_STAT_RBC_DSG_KWH_KM_WERT                      I3_PID_KOM_KOMBI_BC_RBC_KWH_KM, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_RBC_DSG_KWH_KM_WERT"
+#define I3_FLD_KOM_STAT_RBC_STRECKE_KWH_KM_WERT                  I3_PID_KOM_KOMBI_BC_RBC_KWH_KM, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RBC_STRECKE_KWH_KM_WERT"
+
+// 0xF010 I3_PID_KOM_CC_MELDUNGSSPEICHER_LOESCHEN
+
+// 0xF018 I3_PID_KOM_HUD_M_SHOWMODE
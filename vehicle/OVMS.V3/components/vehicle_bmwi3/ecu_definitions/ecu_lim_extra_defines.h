@@ -9,6 +9,7 @@
     #define I3_RES_LIM_STAT_LADEKLAPPE                                (RXBUF_UINT(0))
     #define I3_RES_LIM_STAT_LADEKLAPPE_UNIT                           ''
     #define I3_RES_LIM_STAT_LADEKLAPPE_TYPE                           unsigned short
+    #define I3_FLD_LIM_STAT_LADEKLAPPE                                I3_PID_LIM_STATUS_LADEKLAPPE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEKLAPPE"
 
 // POLL line
   //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_STATUS_LADEKLAPPE,                     {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF1
@@ -21,6 +22,7 @@
     #define I3_RES_LIM_STAT_LADESTECKER_0XDEFO                       (RXBUF_UCHAR(0))
     #define I3_RES_LIM_STAT_LADESTECKER_0XDEFO_UNIT                  ''
     #define I3_RES_LIM_STAT_LADESTECKER_0XDEFO_TYPE                  unsigned char
+    #define I3_FLD_LIM_STAT_LADESTECKER_0XDEFO                       I3_PID_LIM_STATUS_LADESTECKER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADESTECKER"
 
 // POLL line
   //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_STATUS_LADESTECKER,                    {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF0
@@ -32,6 +34,7 @@
     #define I3_RES_LIM_LED_LADESTATUS                                 (RXBUF_UCHAR(0))
     #define I3_RES_LIM_LED_LADESTATUS_UNIT                            ''
     #define I3_RES_LIM_LED_LADESTATUS_TYPE                            unsigned char
+    #define I3_FLD_LIM_LED_LADESTATUS                                 I3_PID_LIM_LED_LADESTATUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "LED_LADESTATUS"
 
 // POLL line
   //{ I3_ECU_LIM_TX, I3_ECU_LIM_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_LIM_LED_LADESTATUS,                        {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // 0xDEF3
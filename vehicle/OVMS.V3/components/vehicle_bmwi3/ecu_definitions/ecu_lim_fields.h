@@ -0,0 +1,42 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/lim_i1.json: LIM 14: Charging interface module
+// This generated code  makes it easier to process CANBUS messages from the LIM ecu in a BMW i3
+//
+
+// 0x2541 I3_PID_LIM_STATUS_CALCVN
+#define I3_FLD_LIM_STAT_CVN_WERT                                 I3_PID_LIM_STATUS_CALCVN, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CVN_WERT"
+
+// 0xDB0F I3_PID_LIM_LADESTECKDOSE_TEMPERATUR
+#define I3_FLD_LIM_STAT_LADESTECKDOSE_TEMP_WERT                  I3_PID_LIM_LADESTECKDOSE_TEMPERATUR, 0, PID_FIELD_UINT16, 0.1f, -40.0f, "STAT_LADESTECKDOSE_TEMP_WERT"
+
+// 0xDEF2 I3_PID_LIM_LADEBEREITSCHAFT_LIM
+#define I3_FLD_LIM_STAT_LADEBEREITSCHAFT_LIM                     I3_PID_LIM_LADEBEREITSCHAFT_LIM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADEBEREITSCHAFT_LIM"
+
+// 0xDEF5 I3_PID_LIM_PROXIMITY
+#define I3_FLD_LIM_STAT_STECKER_NR                               I3_PID_LIM_PROXIMITY, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STECKER_NR"
+#define I3_FLD_LIM_STAT_STROMTRAGFAEHIGKEIT_WERT                 I3_PID_LIM_PROXIMITY, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STROMTRAGFAEHIGKEIT_WERT"
+
+// 0xDEF6 I3_PID_LIM_PILOTSIGNAL
+#define I3_FLD_LIM_STAT_PILOT_AKTIV                              I3_PID_LIM_PILOTSIGNAL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PILOT_AKTIV"
+#define I3_FLD_LIM_STAT_PILOT_PWM_DUTYCYCLE_WERT                 I3_PID_LIM_PILOTSIGNAL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PILOT_PWM_DUTYCYCLE_WERT"
+#define I3_FLD_LIM_STAT_PILOT_CURRENT_WERT                       I3_PID_LIM_PILOTSIGNAL, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PILOT_CURRENT_WERT"
+#define I3_FLD_LIM_STAT_PILOT_LADEBEREIT                         I3_PID_LIM_PILOTSIGNAL, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PILOT_LADEBEREIT"
+#define I3_FLD_LIM_STAT_PILOT_FREQUENZ_WERT                      I3_PID_LIM_PILOTSIGNAL, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PILOT_FREQUENZ_WERT"
+#define I3_FLD_LIM_STAT_PILOT_PEGEL_WERT                         I3_PID_LIM_PILOTSIGNAL, 6, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_PILOT_PEGEL_WERT"
+
+// 0xDEF7 I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO
+#define I3_FLD_LIM_STAT_CHARGE_CONTROL_1                         I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CHARGE_CONTROL_1"
+#define I3_FLD_LIM_STAT_CHARGE_CONTROL_2                         I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CHARGE_CONTROL_2"
+#define I3_FLD_LIM_STAT_CHARGE_PERMISSION                        I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CHARGE_PERMISSION"
+#define I3_FLD_LIM_STAT_LADESTECKER                              I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADESTECKER"
+
+// 0xDEF8 I3_PID_LIM_DC_SCHUETZ_SCHALTER
+#define I3_FLD_LIM_STAT_DC_SCHUETZ_SCHALTER                      I3_PID_LIM_DC_SCHUETZ_SCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DC_SCHUETZ_SCHALTER"
+
+// 0xDEF9 I3_PID_LIM_DC_SCHUETZ_SPANNUNG_EINGANG
+#define I3_FLD_LIM_STAT_DC_SCHUETZ_SPANNUNG_EINGANG_WERT         I3_PID_LIM_DC_SCHUETZ_SPANNUNG_EINGANG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DC_SCHUETZ_SPANNUNG_EINGANG_WERT"
+#define I3_FLD_LIM_STAT_DC_SCHUETZ_SPANNUNG_NEGATIV              I3_PID_LIM_DC_SCHUETZ_SPANNUNG_EINGANG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DC_SCHUETZ_SPANNUNG_NEGATIV"
+
+// 0xDEFA I3_PID_LIM_DC_PINABDECKUNG_COMBO
+#define I3_FLD_LIM_STAT_DC_PINABDECKUNG                          I3_PID_LIM_DC_PINABDECKUNG_COMBO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DC_PINABDECKUNG"
@@ -0,0 +1,656 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/nbtevo.json: NBT 63: Headunit high
+// This generated code  makes it easier to process CANBUS messages from the NBT ecu in a BMW i3
+//
+
+// 0x1024 I3_PID_NBT_RESET_AKTIVIERUNGSLEITUNG
+
+// 0x1044 I3_PID_NBT_ETH_PHY_SWITCH_ENGINE_RESET
+#define I3_FLD_NBT_STAT_PHY_STOPPED_FOR_T_WERT                   I3_PID_NBT_ETH_PHY_SWITCH_ENGINE_RESET, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PHY_STOPPED_FOR_T_WERT"
+
+// 0x104A I3_PID_NBT_ETH_RESET_PORT_CONFIGURATION
+
+// 0x104B I3_PID_NBT_ETH_RESET_PORT_TX_RX_STATS
+
+// 0x1735 I3_PID_NBT_STATUS_LIFECYCLE
+#define I3_FLD_NBT_STAT_LIFECYCLE                                I3_PID_NBT_STATUS_LIFECYCLE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LIFECYCLE"
+
+// 0x1800 I3_PID_NBT_ETH_GET_NUMBER_OF_PORTS
+#define I3_FLD_NBT_STAT_NUM_PORTS_WERT                           I3_PID_NBT_ETH_GET_NUMBER_OF_PORTS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NUM_PORTS_WERT"
+
+// 0x1802 I3_PID_NBT_ETH_PHY_LINK_STATE
+#define I3_FLD_NBT_STAT_NUM_OF_PORTS_WERT                        I3_PID_NBT_ETH_PHY_LINK_STATE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NUM_OF_PORTS_WERT"
+#define I3_FLD_NBT_BF_PHY_LINK_STATE_BTFLD                       I3_PID_NBT_ETH_PHY_LINK_STATE, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_PHY_LINK_STATE_BTFLD"
+
+// 0x1803 I3_PID_NBT_ETH_LEARN_PORT_CONFIGURATION
+#define I3_FLD_NBT_STAT_LEARN_PORT_CONFIGURATION                 I3_PID_NBT_ETH_LEARN_PORT_CONFIGURATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LEARN_PORT_CONFIGURATION"
+#define I3_FLD_NBT_BF_ETH_PORT_CONFIGURATION                     I3_PID_NBT_ETH_LEARN_PORT_CONFIGURATION, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "BF_ETH_PORT_CONFIGURATION"
+
+// 0xA002 I3_PID_NBT_STEUERN_VOLUMEAUDIO_DEFAULT
+
+// 0xA004 I3_PID_NBT_STEUERN_LINEAR
+
+// 0xA00A I3_PID_NBT_FIND_BEST_STATION
+#define I3_FLD_NBT_STAT_SEARCHING_PROCESS                        I3_PID_NBT_FIND_BEST_STATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SEARCHING_PROCESS"
+#define I3_FLD_NBT_STAT_PI_WERT                                  I3_PID_NBT_FIND_BEST_STATION, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PI_WERT"
+#define I3_FLD_NBT_STAT_FIELDSTRENGTH_WERT                       I3_PID_NBT_FIND_BEST_STATION, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT"
+#define I3_FLD_NBT_STAT_QUALITY_WERT                             I3_PID_NBT_FIND_BEST_STATION, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_QUALITY_WERT"
+
+// 0xA023 I3_PID_NBT_STEUERN_INTERNAL_RESET
+
+// 0xA02F I3_PID_NBT_PROVISIONING
+#define I3_FLD_NBT_STAT_PROVISIONING                             I3_PID_NBT_PROVISIONING, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROVISIONING"
+
+// 0xA030 I3_PID_NBT_STEUERN_DELETE_COOKIES
+
+// 0xA03B I3_PID_NBT_STEUERN_RESCUE_MODE
+
+// 0xA03D I3_PID_NBT_SDARS_FACTORY_DEFAULTS
+#define I3_FLD_NBT_STAT_SDARS_FACTORY_DEFAULTS                   I3_PID_NBT_SDARS_FACTORY_DEFAULTS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SDARS_FACTORY_DEFAULTS"
+
+// 0xA03F I3_PID_NBT_FIND_BEST_STATION_DAB
+#define I3_FLD_NBT_STAT_SEARCHING_PROCESS_STATUS_DAB             I3_PID_NBT_FIND_BEST_STATION_DAB, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SEARCHING_PROCESS_STATUS_DAB"
+#define I3_FLD_NBT_STAT_ENSEMBLE_BER_WERT                        I3_PID_NBT_FIND_BEST_STATION_DAB, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ENSEMBLE_BER_WERT"
+
+// 0xA045 I3_PID_NBT_FIND_BEST_TMC_STATION
+#define I3_FLD_NBT_STAT_SEARCHING_PROCESS_STATUS                 I3_PID_NBT_FIND_BEST_TMC_STATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SEARCHING_PROCESS_STATUS"
+#define I3_FLD_NBT_STAT_PI_WERT_0XA045                           I3_PID_NBT_FIND_BEST_TMC_STATION, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PI_WERT_0XA045"
+#define I3_FLD_NBT_STAT_FIELDSTRENGTH_WERT_0XA045                I3_PID_NBT_FIND_BEST_TMC_STATION, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT_0XA045"
+#define I3_FLD_NBT_STAT_QUALITY_WERT_0XA045                      I3_PID_NBT_FIND_BEST_TMC_STATION, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_QUALITY_WERT_0XA045"
+
+// 0xA04B I3_PID_NBT_STEUERN_BT_DELETE_ALL_PHONE_ID
+
+// 0xA04D I3_PID_NBT_INITIALISATION_COUNTER_REGION_CODE_DVD
+#define I3_FLD_NBT_STAT_INITIALISATION_COUNTER_REGION_CODE_DVD_WERT I3_PID_NBT_INITIALISATION_COUNTER_REGION_CODE_DVD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INITIALISATION_COUNTER_REGION_CODE_DVD_WERT"
+
+// 0xA05A I3_PID_NBT_SWUP_REMOVE_CUSTOMER_UPDATES
+#define I3_FLD_NBT_STAT_REMOVE_CUSTOMER_UPDATES                  I3_PID_NBT_SWUP_REMOVE_CUSTOMER_UPDATES, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REMOVE_CUSTOMER_UPDATES"
+
+// 0xA085 I3_PID_NBT_STEUERN_CLEAR_FAULT_TRACKING
+
+// 0xA0A8 I3_PID_NBT_TDA_AKTIVIERUNG
+
+// 0xA0A9 I3_PID_NBT_UPDATE_ZERTIFIKATE
+
+// 0xA0B0 I3_PID_NBT_TELNET_ZUGANG_AUS
+#define I3_FLD_NBT_STAT_TELNET_ZUGANG                            I3_PID_NBT_TELNET_ZUGANG_AUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TELNET_ZUGANG"
+
+// 0xA0BB I3_PID_NBT_WLAN_WPS_PUSH_BUTTON
+
+// 0xA0F6 I3_PID_NBT_HU_VIN_PROTECTION
+#define I3_FLD_NBT_STAT_HU_VIN_PROTECTION                        I3_PID_NBT_HU_VIN_PROTECTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HU_VIN_PROTECTION"
+
+// 0xA0F7 I3_PID_NBT_HU_FSC_REFURBISH_UI
+#define I3_FLD_NBT_STAT_HU_FSC_REFURBISH_UI_WERT                 I3_PID_NBT_HU_FSC_REFURBISH_UI, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HU_FSC_REFURBISH_UI_WERT"
+
+// 0xA0FB I3_PID_NBT_HU_FSC_REFURBISH_VIN
+
+// 0xA109 I3_PID_NBT_HU_VIN_PROTECTION_ENFORCE_CYCLIC
+
+// 0xD002 I3_PID_NBT_STATUS_LESEN_SYSTEMAUDIO
+#define I3_FLD_NBT_STAT_AUDIO_SYSTEM                             I3_PID_NBT_STATUS_LESEN_SYSTEMAUDIO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUDIO_SYSTEM"
+
+// 0xD004 I3_PID_NBT_INITIALISIERUNG
+#define I3_FLD_NBT_STAT_INITIALISIERUNG                          I3_PID_NBT_INITIALISIERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INITIALISIERUNG"
+
+// 0xD007 I3_PID_NBT_STATUS_DRIVE_HDD
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_HDD_PERCENT_WERT          I3_PID_NBT_STATUS_DRIVE_HDD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_HDD_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_HDD_MBYTE_WERT            I3_PID_NBT_STATUS_DRIVE_HDD, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_HDD_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION1_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION1_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION1_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION1_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION2_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION2_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION2_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 11, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION2_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION3_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION3_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION3_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION3_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION4_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION4_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION4_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION4_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION5_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION5_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION5_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 26, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION5_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION6_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION6_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION6_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 31, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION6_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION7_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION7_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION7_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION7_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION8_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION8_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION8_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 41, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION8_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION9_PERCENT_WERT   I3_PID_NBT_STATUS_DRIVE_HDD, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION9_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION9_MBYTE_WERT     I3_PID_NBT_STATUS_DRIVE_HDD, 46, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION9_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION10_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION10_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION10_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 51, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION10_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION11_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION11_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION11_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION11_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION12_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 60, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION12_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION12_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 61, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION12_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION13_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 65, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION13_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION13_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 66, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION13_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION14_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 70, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION14_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION14_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 71, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION14_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION15_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 75, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION15_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION15_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 76, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION15_MBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION16_PERCENT_WERT  I3_PID_NBT_STATUS_DRIVE_HDD, 80, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION16_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_FREE_DISKSPACE_PARTITION16_MBYTE_WERT    I3_PID_NBT_STATUS_DRIVE_HDD, 81, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_DISKSPACE_PARTITION16_MBYTE_WERT"
+
+// 0xD00A I3_PID_NBT_STATUS_MEMORY_USAGE
+#define I3_FLD_NBT_STAT_MEMORYSPACE_FLASH_KBYTE_WERT             I3_PID_NBT_STATUS_MEMORY_USAGE, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MEMORYSPACE_FLASH_KBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_MEMORYSPACE_FLASH_KBYTE_WERT        I3_PID_NBT_STATUS_MEMORY_USAGE, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_FLASH_KBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_MEMORYSPACE_FLASH_PERCENT_WERT      I3_PID_NBT_STATUS_MEMORY_USAGE, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_FLASH_PERCENT_WERT"
+#define I3_FLD_NBT_STAT_MEMORYSPACE_RAM_KBYTE_WERT               I3_PID_NBT_STATUS_MEMORY_USAGE, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MEMORYSPACE_RAM_KBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_MEMORYSPACE_RAM_KBYTE_WERT          I3_PID_NBT_STATUS_MEMORY_USAGE, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_RAM_KBYTE_WERT"
+#define I3_FLD_NBT_STAT_FREE_MEMORYSPACE_RAM_PERCENT_WERT        I3_PID_NBT_STATUS_MEMORY_USAGE, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FREE_MEMORYSPACE_RAM_PERCENT_WERT"
+
+// 0xD00B I3_PID_NBT_STATUS_VERSION_ID_LESEN
+
+// 0xD00C I3_PID_NBT_STATUS_LESEN_LAUFWERK
+#define I3_FLD_NBT_STAT_VERBAUTE_LAUFWERKE                       I3_PID_NBT_STATUS_LESEN_LAUFWERK, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VERBAUTE_LAUFWERKE"
+
+// 0xD010 I3_PID_NBT_STATUS_ANT_QFS
+#define I3_FLD_NBT_STAT_QUALITY_WERT_0XD010                      I3_PID_NBT_STATUS_ANT_QFS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_QUALITY_WERT_0XD010"
+#define I3_FLD_NBT_STAT_FIELDSTRENGTH_WERT_0XD010                I3_PID_NBT_STATUS_ANT_QFS, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT_0XD010"
+#define I3_FLD_NBT_STAT_ANT_PW                                   I3_PID_NBT_STATUS_ANT_QFS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANT_PW"
+#define I3_FLD_NBT_STAT_FIELDSTRENGTH_EXACT_WERT                 I3_PID_NBT_STATUS_ANT_QFS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FIELDSTRENGTH_EXACT_WERT"
+#define I3_FLD_NBT_STAT_FREQUENZ_WERT                            I3_PID_NBT_STATUS_ANT_QFS, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREQUENZ_WERT"
+
+// 0xD012 I3_PID_NBT_STATUS_SGBMID_NAVIMAP
+
+// 0xD019 I3_PID_NBT_SER_NR_DOM_LESEN
+
+// 0xD01D I3_PID_NBT_STATUS_BT_GEKOPPELTE_GERAETE_LESEN
+
+// 0xD01E I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY
+#define I3_FLD_NBT_STAT_HISTORY_1_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_1_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_1_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_1_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_1_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 5, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_1_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_1_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_1_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_2_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_2_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_2_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_2_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_2_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 15, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_2_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_2_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_2_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_3_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_3_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_3_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_3_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_3_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 25, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_3_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_3_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_3_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_4_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 30, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_4_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_4_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_4_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_4_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 35, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_4_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_4_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_4_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_5_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_5_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_5_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_5_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_5_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 45, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_5_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_5_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_5_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_6_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_6_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_6_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 54, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_6_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_6_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 55, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_6_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_6_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 59, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_6_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_7_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_7_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_7_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 64, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_7_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_7_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 65, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_7_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_7_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_7_ERROR_CODE"
+#define I3_FLD_NBT_STAT_HISTORY_8_KILOMETER_WERT                 I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 70, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_8_KILOMETER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_8_TYP                            I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_8_TYP"
+#define I3_FLD_NBT_STAT_HISTORY_8_FLASHSPEICHER_WERT             I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 75, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTORY_8_FLASHSPEICHER_WERT"
+#define I3_FLD_NBT_STAT_HISTORY_8_ERROR_CODE                     I3_PID_NBT_STATUS_SWUP_INSTALLATION_HISTORY, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HISTORY_8_ERROR_CODE"
+
+// 0xD020 I3_PID_NBT_LOGISTIC_NR
+
+// 0xD021 I3_PID_NBT_APPLICATION
+#define I3_FLD_NBT_STAT_APPL_1                                   I3_PID_NBT_APPLICATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_1"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_1                           I3_PID_NBT_APPLICATION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_1"
+#define I3_FLD_NBT_STAT_APPL_CODED_1                             I3_PID_NBT_APPLICATION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_1"
+#define I3_FLD_NBT_STAT_APPL_2                                   I3_PID_NBT_APPLICATION, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_2"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_2                           I3_PID_NBT_APPLICATION, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_2"
+#define I3_FLD_NBT_STAT_APPL_CODED_2                             I3_PID_NBT_APPLICATION, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_2"
+#define I3_FLD_NBT_STAT_APPL_3                                   I3_PID_NBT_APPLICATION, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_3"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_3                           I3_PID_NBT_APPLICATION, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_3"
+#define I3_FLD_NBT_STAT_APPL_CODED_3                             I3_PID_NBT_APPLICATION, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_3"
+#define I3_FLD_NBT_STAT_APPL_4                                   I3_PID_NBT_APPLICATION, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_4"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_4                           I3_PID_NBT_APPLICATION, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_4"
+#define I3_FLD_NBT_STAT_APPL_CODED_4                             I3_PID_NBT_APPLICATION, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_4"
+#define I3_FLD_NBT_STAT_APPL_5                                   I3_PID_NBT_APPLICATION, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_5"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_5                           I3_PID_NBT_APPLICATION, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_5"
+#define I3_FLD_NBT_STAT_APPL_CODED_5                             I3_PID_NBT_APPLICATION, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_5"
+#define I3_FLD_NBT_STAT_APPL_6                                   I3_PID_NBT_APPLICATION, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_6"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_6                           I3_PID_NBT_APPLICATION, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_6"
+#define I3_FLD_NBT_STAT_APPL_CODED_6                             I3_PID_NBT_APPLICATION, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_6"
+#define I3_FLD_NBT_STAT_APPL_7                                   I3_PID_NBT_APPLICATION, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_7"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_7                           I3_PID_NBT_APPLICATION, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_7"
+#define I3_FLD_NBT_STAT_APPL_CODED_7                             I3_PID_NBT_APPLICATION, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_7"
+#define I3_FLD_NBT_STAT_APPL_8                                   I3_PID_NBT_APPLICATION, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_8"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_8                           I3_PID_NBT_APPLICATION, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_8"
+#define I3_FLD_NBT_STAT_APPL_CODED_8                             I3_PID_NBT_APPLICATION, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_8"
+#define I3_FLD_NBT_STAT_APPL_9                                   I3_PID_NBT_APPLICATION, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_9"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_9                           I3_PID_NBT_APPLICATION, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_9"
+#define I3_FLD_NBT_STAT_APPL_CODED_9                             I3_PID_NBT_APPLICATION, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_9"
+#define I3_FLD_NBT_STAT_APPL_10                                  I3_PID_NBT_APPLICATION, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_10"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_10                          I3_PID_NBT_APPLICATION, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_10"
+#define I3_FLD_NBT_STAT_APPL_CODED_10                            I3_PID_NBT_APPLICATION, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_10"
+#define I3_FLD_NBT_STAT_APPL_11                                  I3_PID_NBT_APPLICATION, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_11"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_11                          I3_PID_NBT_APPLICATION, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_11"
+#define I3_FLD_NBT_STAT_APPL_CODED_11                            I3_PID_NBT_APPLICATION, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_11"
+#define I3_FLD_NBT_STAT_APPL_12                                  I3_PID_NBT_APPLICATION, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_12"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_12                          I3_PID_NBT_APPLICATION, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_12"
+#define I3_FLD_NBT_STAT_APPL_CODED_12                            I3_PID_NBT_APPLICATION, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_12"
+#define I3_FLD_NBT_STAT_APPL_13                                  I3_PID_NBT_APPLICATION, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_13"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_13                          I3_PID_NBT_APPLICATION, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_13"
+#define I3_FLD_NBT_STAT_APPL_CODED_13                            I3_PID_NBT_APPLICATION, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_13"
+#define I3_FLD_NBT_STAT_APPL_14                                  I3_PID_NBT_APPLICATION, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_14"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_14                          I3_PID_NBT_APPLICATION, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_14"
+#define I3_FLD_NBT_STAT_APPL_CODED_14                            I3_PID_NBT_APPLICATION, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_14"
+#define I3_FLD_NBT_STAT_APPL_15                                  I3_PID_NBT_APPLICATION, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_15"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_15                          I3_PID_NBT_APPLICATION, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_15"
+#define I3_FLD_NBT_STAT_APPL_CODED_15                            I3_PID_NBT_APPLICATION, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_15"
+#define I3_FLD_NBT_STAT_APPL_16                                  I3_PID_NBT_APPLICATION, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_16"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_16                          I3_PID_NBT_APPLICATION, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_16"
+#define I3_FLD_NBT_STAT_APPL_CODED_16                            I3_PID_NBT_APPLICATION, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_16"
+#define I3_FLD_NBT_STAT_APPL_17                                  I3_PID_NBT_APPLICATION, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_17"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_17                          I3_PID_NBT_APPLICATION, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_17"
+#define I3_FLD_NBT_STAT_APPL_CODED_17                            I3_PID_NBT_APPLICATION, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_17"
+#define I3_FLD_NBT_STAT_APPL_18                                  I3_PID_NBT_APPLICATION, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_18"
+#define I3_FLD_NBT_STAT_APPL_ENABLED_18                          I3_PID_NBT_APPLICATION, 52, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_ENABLED_18"
+#define I3_FLD_NBT_STAT_APPL_CODED_18                            I3_PID_NBT_APPLICATION, 53, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_APPL_CODED_18"
+
+// 0xD026 I3_PID_NBT_STATUS_ANALOG_TEMPERATUR
+#define I3_FLD_NBT_STAT_TEMP_FOT_WERT                            I3_PID_NBT_STATUS_ANALOG_TEMPERATUR, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_FOT_WERT"
+#define I3_FLD_NBT_STAT_TEMP_ENDSTU_WERT                         I3_PID_NBT_STATUS_ANALOG_TEMPERATUR, 1, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_TEMP_ENDSTU_WERT"
+#define I3_FLD_NBT_STAT_TEMP_GYRO_WERT                           I3_PID_NBT_STATUS_ANALOG_TEMPERATUR, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_GYRO_WERT"
+#define I3_FLD_NBT_STAT_TEMP_MOD_WERT                            I3_PID_NBT_STATUS_ANALOG_TEMPERATUR, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MOD_WERT"
+#define I3_FLD_NBT_STAT_TEMP_HDD_WERT                            I3_PID_NBT_STATUS_ANALOG_TEMPERATUR, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_HDD_WERT"
+#define I3_FLD_NBT_STAT_TEMP_DVD_WERT                            I3_PID_NBT_STATUS_ANALOG_TEMPERATUR, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_DVD_WERT"
+
+// 0xD02C I3_PID_NBT_STATUS_CD_MD_CDC
+#define I3_FLD_NBT_STAT_DIGITAL_PLAYBACK_QUALITY_WERT            I3_PID_NBT_STATUS_CD_MD_CDC, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIGITAL_PLAYBACK_QUALITY_WERT"
+
+// 0xD030 I3_PID_NBT_STATUS_SPEED
+#define I3_FLD_NBT_STAT_WHEEL1_SENSOR_SPEED_WERT                 I3_PID_NBT_STATUS_SPEED, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_WHEEL1_SENSOR_SPEED_WERT"
+#define I3_FLD_NBT_STAT_WHEEL2_SENSOR_SPEED_WERT                 I3_PID_NBT_STATUS_SPEED, 2, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_WHEEL2_SENSOR_SPEED_WERT"
+#define I3_FLD_NBT_STAT_WHEEL3_SENSOR_SPEED_WERT                 I3_PID_NBT_STATUS_SPEED, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_WHEEL3_SENSOR_SPEED_WERT"
+#define I3_FLD_NBT_STAT_WHEEL4_SENSOR_SPEED_WERT                 I3_PID_NBT_STATUS_SPEED, 6, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_WHEEL4_SENSOR_SPEED_WERT"
+#define I3_FLD_NBT_STAT_COMBINED_SENSOR_SPEED_WERT               I3_PID_NBT_STATUS_SPEED, 8, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_COMBINED_SENSOR_SPEED_WERT"
+#define I3_FLD_NBT_STAT_GPS_SPEED_WERT                           I3_PID_NBT_STATUS_SPEED, 10, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_GPS_SPEED_WERT"
+#define I3_FLD_NBT_STAT_SPEED_DIFFERENCE_PERCENT_WERT            I3_PID_NBT_STATUS_SPEED, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SPEED_DIFFERENCE_PERCENT_WERT"
+
+// 0xD031 I3_PID_NBT_STATUS_DIRECTION
+#define I3_FLD_NBT_STAT_DIRECTION                                I3_PID_NBT_STATUS_DIRECTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIRECTION"
+#define I3_FLD_NBT_STAT_DIRECTION_SOURCE                         I3_PID_NBT_STATUS_DIRECTION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIRECTION_SOURCE"
+
+// 0xD032 I3_PID_NBT_STATUS_GPS_DILUTION_OF_POSITION
+#define I3_FLD_NBT_STAT_GPS_PDOP_WERT                            I3_PID_NBT_STATUS_GPS_DILUTION_OF_POSITION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GPS_PDOP_WERT"
+#define I3_FLD_NBT_STAT_GPS_HDOP_WERT                            I3_PID_NBT_STATUS_GPS_DILUTION_OF_POSITION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GPS_HDOP_WERT"
+#define I3_FLD_NBT_STAT_GPS_VDOP_WERT                            I3_PID_NBT_STATUS_GPS_DILUTION_OF_POSITION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GPS_VDOP_WERT"
+
+// 0xD034 I3_PID_NBT_STATUS_GPS_SATINFO
+#define I3_FLD_NBT_STAT_NUMBER_VISIBLE_SATS_WERT                 I3_PID_NBT_STATUS_GPS_SATINFO, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NUMBER_VISIBLE_SATS_WERT"
+#define I3_FLD_NBT_STAT_NUMBER_TRACKED_SATS_WERT                 I3_PID_NBT_STATUS_GPS_SATINFO, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NUMBER_TRACKED_SATS_WERT"
+#define I3_FLD_NBT_STAT_SAT_1_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_1_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_1_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_1_STATUS"
+#define I3_FLD_NBT_STAT_SAT_1_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 4, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_1_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_2_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_2_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_2_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_2_STATUS"
+#define I3_FLD_NBT_STAT_SAT_2_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 8, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_2_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_3_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_3_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_3_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_3_STATUS"
+#define I3_FLD_NBT_STAT_SAT_3_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 12, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_3_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_4_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_4_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_4_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_4_STATUS"
+#define I3_FLD_NBT_STAT_SAT_4_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 16, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_4_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_5_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_5_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_5_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_5_STATUS"
+#define I3_FLD_NBT_STAT_SAT_5_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 20, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_5_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_6_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_6_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_6_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_6_STATUS"
+#define I3_FLD_NBT_STAT_SAT_6_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 24, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_6_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_7_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_7_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_7_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_7_STATUS"
+#define I3_FLD_NBT_STAT_SAT_7_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 28, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_7_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_8_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_8_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_8_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_8_STATUS"
+#define I3_FLD_NBT_STAT_SAT_8_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 32, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_8_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_9_ID_WERT                            I3_PID_NBT_STATUS_GPS_SATINFO, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_9_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_9_STATUS                             I3_PID_NBT_STATUS_GPS_SATINFO, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_9_STATUS"
+#define I3_FLD_NBT_STAT_SAT_9_SIGNAL_TO_NOISE_WERT               I3_PID_NBT_STATUS_GPS_SATINFO, 36, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_9_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_10_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_10_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_10_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_10_STATUS"
+#define I3_FLD_NBT_STAT_SAT_10_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 40, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_10_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_11_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_11_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_11_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_11_STATUS"
+#define I3_FLD_NBT_STAT_SAT_11_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 44, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_11_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_12_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_12_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_12_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_12_STATUS"
+#define I3_FLD_NBT_STAT_SAT_12_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 48, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_12_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_13_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_13_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_13_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_13_STATUS"
+#define I3_FLD_NBT_STAT_SAT_13_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 52, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_13_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_14_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 54, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_14_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_14_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_14_STATUS"
+#define I3_FLD_NBT_STAT_SAT_14_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 56, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_14_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_15_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_15_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_15_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 59, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_15_STATUS"
+#define I3_FLD_NBT_STAT_SAT_15_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 60, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_15_SIGNAL_TO_NOISE_WERT"
+#define I3_FLD_NBT_STAT_SAT_16_ID_WERT                           I3_PID_NBT_STATUS_GPS_SATINFO, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_16_ID_WERT"
+#define I3_FLD_NBT_STAT_SAT_16_STATUS                            I3_PID_NBT_STATUS_GPS_SATINFO, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SAT_16_STATUS"
+#define I3_FLD_NBT_STAT_SAT_16_SIGNAL_TO_NOISE_WERT              I3_PID_NBT_STATUS_GPS_SATINFO, 64, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_SAT_16_SIGNAL_TO_NOISE_WERT"
+
+// 0xD038 I3_PID_NBT_STATUS_GPS
+#define I3_FLD_NBT_STAT_GPS                                      I3_PID_NBT_STATUS_GPS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GPS"
+
+// 0xD03B I3_PID_NBT_STATUS_GPS_RECEIVER_SW_VERSION
+
+// 0xD03C I3_PID_NBT_STATUS_MAPMATERIAL_VERSION
+
+// 0xD03D I3_PID_NBT_STATUS_NAVI_CALIBRATION
+#define I3_FLD_NBT_STAT_NAVI_CALIBRATION                         I3_PID_NBT_STATUS_NAVI_CALIBRATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NAVI_CALIBRATION"
+
+// 0xD03E I3_PID_NBT_STATUS_EXT_GYROSIGNAL
+#define I3_FLD_NBT_STAT_EXT_GYRO_SIGNAL                          I3_PID_NBT_STATUS_EXT_GYROSIGNAL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EXT_GYRO_SIGNAL"
+
+// 0xD03F I3_PID_NBT_STATUS_HMI_VERSION
+
+// 0xD042 I3_PID_NBT_STATUS_SGBMID_GRACENOTES
+
+// 0xD045 I3_PID_NBT_STATUS_ANT_QFS_FM2
+#define I3_FLD_NBT_STAT_QUALITY_WERT_0XD045                      I3_PID_NBT_STATUS_ANT_QFS_FM2, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_QUALITY_WERT_0XD045"
+#define I3_FLD_NBT_STAT_FIELDSTRENGTH_WERT_0XD045                I3_PID_NBT_STATUS_ANT_QFS_FM2, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FIELDSTRENGTH_WERT_0XD045"
+#define I3_FLD_NBT_STAT_ANT_PW_0XD045                            I3_PID_NBT_STATUS_ANT_QFS_FM2, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANT_PW_0XD045"
+#define I3_FLD_NBT_STAT_FIELDSTRENGTH_EXACT_WERT_0XD045          I3_PID_NBT_STATUS_ANT_QFS_FM2, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FIELDSTRENGTH_EXACT_WERT_0XD045"
+#define I3_FLD_NBT_STAT_FREQUENZ_WERT_0XD045                     I3_PID_NBT_STATUS_ANT_QFS_FM2, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FREQUENZ_WERT_0XD045"
+
+// 0xD053 I3_PID_NBT_STATUS_SIGNAL_DAB
+#define I3_FLD_NBT_STAT_SIGNAL_DAB                               I3_PID_NBT_STATUS_SIGNAL_DAB, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SIGNAL_DAB"
+
+// 0xD057 I3_PID_NBT_STATUS_USB_HUB_TEST
+#define I3_FLD_NBT_STAT_USB_HUB_TEST_PORT_1                      I3_PID_NBT_STATUS_USB_HUB_TEST, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_HUB_TEST_PORT_1"
+#define I3_FLD_NBT_STAT_USB_HUB_TEST_PORT_2                      I3_PID_NBT_STATUS_USB_HUB_TEST, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_HUB_TEST_PORT_2"
+
+// 0xD065 I3_PID_NBT_STATUS_ROUTE_DOWNLOAD
+#define I3_FLD_NBT_STAT_ROUTE_DOWNLOAD                           I3_PID_NBT_STATUS_ROUTE_DOWNLOAD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ROUTE_DOWNLOAD"
+#define I3_FLD_NBT_STAT_PERCENT_COMPLETE_WERT                    I3_PID_NBT_STATUS_ROUTE_DOWNLOAD, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PERCENT_COMPLETE_WERT"
+#define I3_FLD_NBT_STAT_AVAILABLE_DATASETS_WERT                  I3_PID_NBT_STATUS_ROUTE_DOWNLOAD, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AVAILABLE_DATASETS_WERT"
+
+// 0xD067 I3_PID_NBT_STATUS_ADAS
+#define I3_FLD_NBT_STAT_LIFECYCLE_DURATION_WERT                  I3_PID_NBT_STATUS_ADAS, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LIFECYCLE_DURATION_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_ACC_WERT                I3_PID_NBT_STATUS_ADAS, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_ACC_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_NIVI_WERT               I3_PID_NBT_STATUS_ADAS, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_NIVI_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_LDM_WERT                I3_PID_NBT_STATUS_ADAS, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_LDM_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_ICM_QL_WERT             I3_PID_NBT_STATUS_ADAS, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_ICM_QL_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_KAFAS_WERT              I3_PID_NBT_STATUS_ADAS, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_KAFAS_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_FLA_WERT                I3_PID_NBT_STATUS_ADAS, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_FLA_WERT"
+#define I3_FLD_NBT_STAT_RECEIVED_RESYNCS_FRMFA_WERT              I3_PID_NBT_STATUS_ADAS, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RECEIVED_RESYNCS_FRMFA_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGRAPH_WERT                       I3_PID_NBT_STATUS_ADAS, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGRAPH_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGRAPH_V_WERT                     I3_PID_NBT_STATUS_ADAS, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGRAPH_V_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGRAPH_LNE_WERT                   I3_PID_NBT_STATUS_ADAS, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGRAPH_LNE_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGRAPHSYNC_WERT                   I3_PID_NBT_STATUS_ADAS, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGRAPHSYNC_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGPS1_WERT                        I3_PID_NBT_STATUS_ADAS, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGPS1_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGPS2_WERT                        I3_PID_NBT_STATUS_ADAS, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGPS2_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVSYSINFO_WERT                     I3_PID_NBT_STATUS_ADAS, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVSYSINFO_WERT"
+#define I3_FLD_NBT_STAT_SENT_NAVGRAPHMATCH_WERT                  I3_PID_NBT_STATUS_ADAS, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SENT_NAVGRAPHMATCH_WERT"
+
+// 0xD091 I3_PID_NBT_STATUS_TDA_AKTIVIERUNG
+#define I3_FLD_NBT_STAT_DIENSTE_AKTIVIERUNG                      I3_PID_NBT_STATUS_TDA_AKTIVIERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIENSTE_AKTIVIERUNG"
+
+// 0xD092 I3_PID_NBT_STATUS_TIME_AFTER_STARTUP
+#define I3_FLD_NBT_STAT_TIME_AFTER_START_UP_WERT                 I3_PID_NBT_STATUS_TIME_AFTER_STARTUP, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TIME_AFTER_START_UP_WERT"
+#define I3_FLD_NBT_STAT_TIME_AFTER_POWER_DOWN_AVAILABLE_WERT     I3_PID_NBT_STATUS_TIME_AFTER_STARTUP, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TIME_AFTER_POWER_DOWN_AVAILABLE_WERT"
+#define I3_FLD_NBT_STAT_TIME_AFTER_FULLY_OPERATIONAL_WERT        I3_PID_NBT_STATUS_TIME_AFTER_STARTUP, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TIME_AFTER_FULLY_OPERATIONAL_WERT"
+
+// 0xD093 I3_PID_NBT_STATUS_FM_PHASDIV_ANTENNA
+#define I3_FLD_NBT_STAT_FM_PHASEDIV_ANTENNA1                     I3_PID_NBT_STATUS_FM_PHASDIV_ANTENNA, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FM_PHASEDIV_ANTENNA1"
+#define I3_FLD_NBT_STAT_FM_PHASEDIV_ANTENNA2                     I3_PID_NBT_STATUS_FM_PHASDIV_ANTENNA, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FM_PHASEDIV_ANTENNA2"
+
+// 0xD095 I3_PID_NBT_STATUS_BT_FIRMWARE
+
+// 0xD0B8 I3_PID_NBT_HD_DECODER_FIRMWARE
+
+// 0xD0B9 I3_PID_NBT_ABLAUF_ZERTIFIKAT
+
+// 0xD0BA I3_PID_NBT_COOKIES
+
+// 0xD0C1 I3_PID_NBT_COUNTER_FILES_MUSICDB
+#define I3_FLD_NBT_STAT_MUSICDB_STORED_FILES_WERT                I3_PID_NBT_COUNTER_FILES_MUSICDB, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MUSICDB_STORED_FILES_WERT"
+
+// 0xD0C9 I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT
+#define I3_FLD_NBT_STAT_HW_INDEX_WERT                            I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HW_INDEX_WERT"
+#define I3_FLD_NBT_STAT_SW_INDEX_WERT                            I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_INDEX_WERT"
+#define I3_FLD_NBT_STAT_CRC_COUNTER_WERT                         I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CRC_COUNTER_WERT"
+#define I3_FLD_NBT_STAT_SERIAL_NUMBER_WERT                       I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT, 3, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SERIAL_NUMBER_WERT"
+#define I3_FLD_NBT_STAT_DIAGNOSTIC_FLAGS                         I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIAGNOSTIC_FLAGS"
+#define I3_FLD_NBT_STAT_ZIN_VARIANT                              I3_PID_NBT_ZIN_CENTRAL_INSTRUMENT, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZIN_VARIANT"
+
+// 0xD0CA I3_PID_NBT_ZIN_EVENT_QUEUE
+#define I3_FLD_NBT_STAT_EVENT_ID_0_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_0_WERT"
+#define I3_FLD_NBT_STAT_EVENT_ID_1_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_1_WERT"
+#define I3_FLD_NBT_STAT_EVENT_ID_2_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_2_WERT"
+#define I3_FLD_NBT_STAT_EVENT_ID_3_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_3_WERT"
+#define I3_FLD_NBT_STAT_EVENT_ID_4_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_4_WERT"
+#define I3_FLD_NBT_STAT_EVENT_ID_5_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_5_WERT"
+#define I3_FLD_NBT_STAT_EVENT_ID_6_WERT                          I3_PID_NBT_ZIN_EVENT_QUEUE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_EVENT_ID_6_WERT"
+
+// 0xD0CB I3_PID_NBT_ZIN_INTERNAL_STATES
+#define I3_FLD_NBT_STAT_CURRENT_WIDGET_ID_WERT                   I3_PID_NBT_ZIN_INTERNAL_STATES, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CURRENT_WIDGET_ID_WERT"
+#define I3_FLD_NBT_STAT_NEXT_WIDGET_ID_PRIO_1_WERT               I3_PID_NBT_ZIN_INTERNAL_STATES, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NEXT_WIDGET_ID_PRIO_1_WERT"
+#define I3_FLD_NBT_STAT_NEXT_WIDGET_ID_PRIO_2_WERT               I3_PID_NBT_ZIN_INTERNAL_STATES, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NEXT_WIDGET_ID_PRIO_2_WERT"
+#define I3_FLD_NBT_STAT_NEXT_WIDGET_ID_PRIO_3_WERT               I3_PID_NBT_ZIN_INTERNAL_STATES, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_NEXT_WIDGET_ID_PRIO_3_WERT"
+#define I3_FLD_NBT_STAT_SW_MAJOR_VERSION_WERT                    I3_PID_NBT_ZIN_INTERNAL_STATES, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_MAJOR_VERSION_WERT"
+#define I3_FLD_NBT_STAT_SW_MINOR_VERSION_WERT                    I3_PID_NBT_ZIN_INTERNAL_STATES, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_MINOR_VERSION_WERT"
+#define I3_FLD_NBT_STAT_SW_PATCH_VERSION_WERT                    I3_PID_NBT_ZIN_INTERNAL_STATES, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SW_PATCH_VERSION_WERT"
+#define I3_FLD_NBT_STAT_TARGET_BRIGHTNESS_WERT                   I3_PID_NBT_ZIN_INTERNAL_STATES, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TARGET_BRIGHTNESS_WERT"
+#define I3_FLD_NBT_STAT_LED_RING_OFFSET_BRIGHTNESS_WERT          I3_PID_NBT_ZIN_INTERNAL_STATES, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_LED_RING_OFFSET_BRIGHTNESS_WERT"
+#define I3_FLD_NBT_STAT_CURRENT_PWM_OUTPUT_VALUE_WERT            I3_PID_NBT_ZIN_INTERNAL_STATES, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CURRENT_PWM_OUTPUT_VALUE_WERT"
+#define I3_FLD_NBT_STAT_LED_RING_SWITCH_WERT                     I3_PID_NBT_ZIN_INTERNAL_STATES, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LED_RING_SWITCH_WERT"
+#define I3_FLD_NBT_STAT_PERMANENT_SWITCH_WERT                    I3_PID_NBT_ZIN_INTERNAL_STATES, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PERMANENT_SWITCH_WERT"
+#define I3_FLD_NBT_STAT_PERMANENT_DISPLAYS_WERT                  I3_PID_NBT_ZIN_INTERNAL_STATES, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PERMANENT_DISPLAYS_WERT"
+#define I3_FLD_NBT_STAT_ANIMATION_SWITCH_WERT                    I3_PID_NBT_ZIN_INTERNAL_STATES, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANIMATION_SWITCH_WERT"
+#define I3_FLD_NBT_STAT_ANIMATION_DISPLAYS_WERT                  I3_PID_NBT_ZIN_INTERNAL_STATES, 15, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANIMATION_DISPLAYS_WERT"
+#define I3_FLD_NBT_STAT_ANAIMATION_TRIGGER_EVENT_WERT            I3_PID_NBT_ZIN_INTERNAL_STATES, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANAIMATION_TRIGGER_EVENT_WERT"
+#define I3_FLD_NBT_STAT_SEMI_PER_EVENT_ID_WERT                   I3_PID_NBT_ZIN_INTERNAL_STATES, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SEMI_PER_EVENT_ID_WERT"
+#define I3_FLD_NBT_STAT_SEMI_PER_EVENT_PRIO_WERT                 I3_PID_NBT_ZIN_INTERNAL_STATES, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SEMI_PER_EVENT_PRIO_WERT"
+#define I3_FLD_NBT_STAT_SEMI_PER_EVENT_TRIGGER_WERT              I3_PID_NBT_ZIN_INTERNAL_STATES, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SEMI_PER_EVENT_TRIGGER_WERT"
+
+// 0xD0CE I3_PID_NBT_PROVISIONING_PARAMETER
+#define I3_FLD_NBT_STAT_CAUSE_WERT                               I3_PID_NBT_PROVISIONING_PARAMETER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CAUSE_WERT"
+
+// 0xD0D1 I3_PID_NBT_MEDIA_STATISTIK
+#define I3_FLD_NBT_STAT_COUNTER_MEDIA_WERT                       I3_PID_NBT_MEDIA_STATISTIK, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_COUNTER_MEDIA_WERT"
+#define I3_FLD_NBT_STAT_COUNTER_AUDIO_CDS_WERT                   I3_PID_NBT_MEDIA_STATISTIK, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_COUNTER_AUDIO_CDS_WERT"
+#define I3_FLD_NBT_STAT_COUNTER_CD_ROM_WERT                      I3_PID_NBT_MEDIA_STATISTIK, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_COUNTER_CD_ROM_WERT"
+#define I3_FLD_NBT_STAT_COUNTER_DVD_VIDEO_WERT                   I3_PID_NBT_MEDIA_STATISTIK, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_COUNTER_DVD_VIDEO_WERT"
+#define I3_FLD_NBT_STAT_COUNTER_BLURAY_WERT                      I3_PID_NBT_MEDIA_STATISTIK, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_COUNTER_BLURAY_WERT"
+#define I3_FLD_NBT_STAT_RECOGNIZED_AUDIO_CDS_WERT                I3_PID_NBT_MEDIA_STATISTIK, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RECOGNIZED_AUDIO_CDS_WERT"
+#define I3_FLD_NBT_STAT_ERROR_DURING_PLAYBACK_WERT               I3_PID_NBT_MEDIA_STATISTIK, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ERROR_DURING_PLAYBACK_WERT"
+#define I3_FLD_NBT_STAT_PLAYBACK_TIME_CD_WERT                    I3_PID_NBT_MEDIA_STATISTIK, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PLAYBACK_TIME_CD_WERT"
+#define I3_FLD_NBT_STAT_PLAYBACK_TIME_DVD_WERT                   I3_PID_NBT_MEDIA_STATISTIK, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PLAYBACK_TIME_DVD_WERT"
+#define I3_FLD_NBT_STAT_PLAYBACK_TIME_BLURAY_WERT                I3_PID_NBT_MEDIA_STATISTIK, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PLAYBACK_TIME_BLURAY_WERT"
+#define I3_FLD_NBT_STAT_INSERT_EJECT_COUNT_WERT                  I3_PID_NBT_MEDIA_STATISTIK, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INSERT_EJECT_COUNT_WERT"
+
+// 0xD0D3 I3_PID_NBT_PROVISIONING_DATA
+#define I3_FLD_NBT_STAT_PROVISIONING_0XD0D3                      I3_PID_NBT_PROVISIONING_DATA, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROVISIONING_0XD0D3"
+
+// 0xD0D6 I3_PID_NBT_STATUS_LAST_DESTINATIONS_FIRST_DATA_SET
+
+// 0xD0DA I3_PID_NBT_STATUS_SDARS_RADIO_ID
+
+// 0xD0DD I3_PID_NBT_SDARS_VERSIONS
+
+// 0xD0DF I3_PID_NBT_STATUS_SDARS_SIGNAL_QUALITY_SXM
+#define I3_FLD_NBT_STAT_SDARS_COMP_RECEPTION_SXM                 I3_PID_NBT_STATUS_SDARS_SIGNAL_QUALITY_SXM, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SDARS_COMP_RECEPTION_SXM"
+#define I3_FLD_NBT_STAT_SDARS_GLOBAL_STATUS                      I3_PID_NBT_STATUS_SDARS_SIGNAL_QUALITY_SXM, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SDARS_GLOBAL_STATUS"
+
+// 0xD0E0 I3_PID_NBT_STATUS_LAST_DESTINATIONS_SECOND_DATA_SET
+
+// 0xD0E2 I3_PID_NBT_STATUS_DRIVE
+#define I3_FLD_NBT_STAT_MEDIUM_INSERTED                          I3_PID_NBT_STATUS_DRIVE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MEDIUM_INSERTED"
+
+// 0xD0E5 I3_PID_NBT_STATUS_BORDERLINE_SETTING
+
+// 0xD0E8 I3_PID_NBT_STATUS_BORDERLINE_CHANGE_MODE
+#define I3_FLD_NBT_STAT_BORDERLINE_CHANGE_MODE                   I3_PID_NBT_STATUS_BORDERLINE_CHANGE_MODE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BORDERLINE_CHANGE_MODE"
+
+// 0xD0E9 I3_PID_NBT_STATUS_SDARS_PELLET_LESEN
+
+// 0xD0EB I3_PID_NBT_PROVISIONING_FORMAT
+#define I3_FLD_NBT_STAT_STAT_SIGNATURE                           I3_PID_NBT_PROVISIONING_FORMAT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STAT_SIGNATURE"
+
+// 0xD1FA I3_PID_NBT_WLAN_AUSSTATTUNG
+#define I3_FLD_NBT_STAT_WLAN_CODED                               I3_PID_NBT_WLAN_AUSSTATTUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_CODED"
+#define I3_FLD_NBT_STAT_WLAN_AP_SA                               I3_PID_NBT_WLAN_AUSSTATTUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_AP_SA"
+#define I3_FLD_NBT_STAT_WLAN_WIFI_DIRECT_SA                      I3_PID_NBT_WLAN_AUSSTATTUNG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_WIFI_DIRECT_SA"
+#define I3_FLD_NBT_STAT_WLAN_STATION_SA                          I3_PID_NBT_WLAN_AUSSTATTUNG, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_STATION_SA"
+
+// 0xD1FC I3_PID_NBT_WLAN_DEVICELIST_WIFI_DIRECT
+
+// 0xD207 I3_PID_NBT_USB_TEST
+#define I3_FLD_NBT_STAT_USB_HUB_KDZ_CODING                       I3_PID_NBT_USB_TEST, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_HUB_KDZ_CODING"
+#define I3_FLD_NBT_STAT_USB_TEST_HUB                             I3_PID_NBT_USB_TEST, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_TEST_HUB"
+#define I3_FLD_NBT_STAT_VENDORID_HUB_WERT                        I3_PID_NBT_USB_TEST, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VENDORID_HUB_WERT"
+#define I3_FLD_NBT_STAT_PRODUCTID_HUB_WERT                       I3_PID_NBT_USB_TEST, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PRODUCTID_HUB_WERT"
+#define I3_FLD_NBT_STAT_USB_TEST_KDZ1                            I3_PID_NBT_USB_TEST, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_TEST_KDZ1"
+#define I3_FLD_NBT_STAT_VENDORID_KDZ1_WERT                       I3_PID_NBT_USB_TEST, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VENDORID_KDZ1_WERT"
+#define I3_FLD_NBT_STAT_PRODUCTID_KDZ1_WERT                      I3_PID_NBT_USB_TEST, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PRODUCTID_KDZ1_WERT"
+#define I3_FLD_NBT_STAT_USB_TEST_KDZ2                            I3_PID_NBT_USB_TEST, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_TEST_KDZ2"
+#define I3_FLD_NBT_STAT_VENDORID_KDZ2_WERT                       I3_PID_NBT_USB_TEST, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VENDORID_KDZ2_WERT"
+#define I3_FLD_NBT_STAT_PRODUCTID_KDZ2_WERT                      I3_PID_NBT_USB_TEST, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PRODUCTID_KDZ2_WERT"
+#define I3_FLD_NBT_STAT_USB_TEST_SIA                             I3_PID_NBT_USB_TEST, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_USB_TEST_SIA"
+#define I3_FLD_NBT_STAT_VENDORID_SIA_WERT                        I3_PID_NBT_USB_TEST, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VENDORID_SIA_WERT"
+#define I3_FLD_NBT_STAT_PRODUCTID_SIA_WERT                       I3_PID_NBT_USB_TEST, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PRODUCTID_SIA_WERT"
+
+// 0xD20E I3_PID_NBT_WLAN_AP_NETWORK
+#define I3_FLD_NBT_STAT_WLAN_AP_ENCRYPTION                       I3_PID_NBT_WLAN_AP_NETWORK, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_AP_ENCRYPTION"
+
+// 0xD26A I3_PID_NBT_TOUCH_COMMAND_NUMBER
+
+// 0xD5CB I3_PID_NBT_CID_PHOTOSENSOR
+#define I3_FLD_NBT_STAT_PHOTOSENSOR_CID_WERT                     I3_PID_NBT_CID_PHOTOSENSOR, 0, PID_FIELD_SINT16, 1.0f, 0.0f, "STAT_PHOTOSENSOR_CID_WERT"
+
+// 0xD5CC I3_PID_NBT_CID_TEMP_BACKLIGHT
+#define I3_FLD_NBT_STAT_TEMP_BACKLIGHT_WERT                      I3_PID_NBT_CID_TEMP_BACKLIGHT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_BACKLIGHT_WERT"
+
+// 0xD5CD I3_PID_NBT_CID_HELLIGKEIT_SOLLWERT
+#define I3_FLD_NBT_STAT_HELLIGKEIT_SOLL_WERT                     I3_PID_NBT_CID_HELLIGKEIT_SOLLWERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HELLIGKEIT_SOLL_WERT"
+
+// 0xD5CE I3_PID_NBT_CID_HELLIGKEIT_ISTWERT
+#define I3_FLD_NBT_STAT_HELLIGKEIT_IST_WERT                      I3_PID_NBT_CID_HELLIGKEIT_ISTWERT, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HELLIGKEIT_IST_WERT"
+
+// 0xD5CF I3_PID_NBT_CID_EINGANGSWERTE_LESEN
+#define I3_FLD_NBT_STAT_DISPLAY_AKTIVIERUNG                      I3_PID_NBT_CID_EINGANGSWERTE_LESEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DISPLAY_AKTIVIERUNG"
+#define I3_FLD_NBT_STAT_OFFSET_HELLIGKEIT_WERT                   I3_PID_NBT_CID_EINGANGSWERTE_LESEN, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_OFFSET_HELLIGKEIT_WERT"
+#define I3_FLD_NBT_STAT_DIMMRAD_WERT                             I3_PID_NBT_CID_EINGANGSWERTE_LESEN, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIMMRAD_WERT"
+#define I3_FLD_NBT_STAT_HELLIGKEIT_KOMBI_WERT                    I3_PID_NBT_CID_EINGANGSWERTE_LESEN, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HELLIGKEIT_KOMBI_WERT"
+#define I3_FLD_NBT_STAT_DAEMPFUNG_LCD_WERT                       I3_PID_NBT_CID_EINGANGSWERTE_LESEN, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DAEMPFUNG_LCD_WERT"
+
+// 0xD5D0 I3_PID_NBT_CID_VERBINDUNG
+#define I3_FLD_NBT_STAT_CID_VERBINDUNG                           I3_PID_NBT_CID_VERBINDUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CID_VERBINDUNG"
+
+// 0xD5D4 I3_PID_NBT_CID_DETAIL_INFORMATIONEN
+#define I3_FLD_NBT_STAT_CID_LOCATION_WERT                        I3_PID_NBT_CID_DETAIL_INFORMATIONEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CID_LOCATION_WERT"
+
+// 0x4008 I3_PID_NBT_EQDATA_FILENAME
+
+// 0x400A I3_PID_NBT_STATUS_SENSOR_WERTE
+#define I3_FLD_NBT_STAT_AMB_SENSOR_WERT                          I3_PID_NBT_STATUS_SENSOR_WERTE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AMB_SENSOR_WERT"
+#define I3_FLD_NBT_STAT_BL_TEMP_WERT                             I3_PID_NBT_STATUS_SENSOR_WERTE, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_BL_TEMP_WERT"
+#define I3_FLD_NBT_STAT_VCC_VOLTAGE_WERT                         I3_PID_NBT_STATUS_SENSOR_WERTE, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VCC_VOLTAGE_WERT"
+#define I3_FLD_NBT_STAT_BACKLIGT_DRIVER_WERT                     I3_PID_NBT_STATUS_SENSOR_WERTE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BACKLIGT_DRIVER_WERT"
+#define I3_FLD_NBT_STAT_INT_STATUS_WERT                          I3_PID_NBT_STATUS_SENSOR_WERTE, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INT_STATUS_WERT"
+
+// 0x400E I3_PID_NBT_STATUS_CID_SW_VERSION
+#define I3_FLD_NBT_STAT_MAJOR_VERSION_WERT                       I3_PID_NBT_STATUS_CID_SW_VERSION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MAJOR_VERSION_WERT"
+#define I3_FLD_NBT_STAT_MINOR_VERSION_WERT                       I3_PID_NBT_STATUS_CID_SW_VERSION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MINOR_VERSION_WERT"
+#define I3_FLD_NBT_STAT_PATCH_VERSION_WERT                       I3_PID_NBT_STATUS_CID_SW_VERSION, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PATCH_VERSION_WERT"
+
+// 0x400F I3_PID_NBT_STATUS_INTERNAL_STATES
+#define I3_FLD_NBT_STAT_CID_POWER_MODE                           I3_PID_NBT_STATUS_INTERNAL_STATES, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CID_POWER_MODE"
+#define I3_FLD_NBT_STAT_ERROR_FLAGS_WERT                         I3_PID_NBT_STATUS_INTERNAL_STATES, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ERROR_FLAGS_WERT"
+#define I3_FLD_NBT_STAT_MAIN_STATE                               I3_PID_NBT_STATUS_INTERNAL_STATES, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MAIN_STATE"
+#define I3_FLD_NBT_STAT_OPERATION_STATE                          I3_PID_NBT_STATUS_INTERNAL_STATES, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_OPERATION_STATE"
+#define I3_FLD_NBT_STAT_INIT_STATE                               I3_PID_NBT_STATUS_INTERNAL_STATES, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INIT_STATE"
+#define I3_FLD_NBT_STAT_COM_STATE                                I3_PID_NBT_STATUS_INTERNAL_STATES, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_COM_STATE"
+#define I3_FLD_NBT_STAT_SCHEDULE_ID                              I3_PID_NBT_STATUS_INTERNAL_STATES, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHEDULE_ID"
+#define I3_FLD_NBT_STAT_FADE_STATE                               I3_PID_NBT_STATUS_INTERNAL_STATES, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FADE_STATE"
+#define I3_FLD_NBT_STAT_FLASH_STATE                              I3_PID_NBT_STATUS_INTERNAL_STATES, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLASH_STATE"
+#define I3_FLD_NBT_STAT_FLASH_DATA_CHANGED                       I3_PID_NBT_STATUS_INTERNAL_STATES, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FLASH_DATA_CHANGED"
+#define I3_FLD_NBT_STAT_DISPLAY_VOLTAGE                          I3_PID_NBT_STATUS_INTERNAL_STATES, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DISPLAY_VOLTAGE"
+#define I3_FLD_NBT_STAT_DISPLAY_ENABLE                           I3_PID_NBT_STATUS_INTERNAL_STATES, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DISPLAY_ENABLE"
+#define I3_FLD_NBT_STAT_DISPLAY_READY                            I3_PID_NBT_STATUS_INTERNAL_STATES, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DISPLAY_READY"
+
+// 0x4010 I3_PID_NBT_CID_CODIERDATEN
+#define I3_FLD_NBT_STAT_DIM_CURVE_X1_WERT                        I3_PID_NBT_CID_CODIERDATEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_CURVE_X1_WERT"
+#define I3_FLD_NBT_STAT_DIM_CURVE_X2_WERT                        I3_PID_NBT_CID_CODIERDATEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_CURVE_X2_WERT"
+#define I3_FLD_NBT_STAT_DIM_CURVE_X3_WERT                        I3_PID_NBT_CID_CODIERDATEN, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_CURVE_X3_WERT"
+#define I3_FLD_NBT_STAT_DIM_CURVE_Y1_WERT                        I3_PID_NBT_CID_CODIERDATEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_CURVE_Y1_WERT"
+#define I3_FLD_NBT_STAT_DIM_CURVE_Y2_WERT                        I3_PID_NBT_CID_CODIERDATEN, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_CURVE_Y2_WERT"
+#define I3_FLD_NBT_STAT_DIM_CURVE_Y3_WERT                        I3_PID_NBT_CID_CODIERDATEN, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_CURVE_Y3_WERT"
+#define I3_FLD_NBT_STAT_DIM_TOLERANCE_ALPHA_WERT                 I3_PID_NBT_CID_CODIERDATEN, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_TOLERANCE_ALPHA_WERT"
+#define I3_FLD_NBT_STAT_DIM_TOLERANCE_ABS_WERT                   I3_PID_NBT_CID_CODIERDATEN, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_TOLERANCE_ABS_WERT"
+#define I3_FLD_NBT_STAT_DIM_DIFF_GAIN_WERT                       I3_PID_NBT_CID_CODIERDATEN, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_DIFF_GAIN_WERT"
+#define I3_FLD_NBT_STAT_DIM_DIFF_THRESHOLD_WERT                  I3_PID_NBT_CID_CODIERDATEN, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_DIFF_THRESHOLD_WERT"
+#define I3_FLD_NBT_STAT_DIM_DIFF_BIAS_WERT                       I3_PID_NBT_CID_CODIERDATEN, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_DIFF_BIAS_WERT"
+#define I3_FLD_NBT_STAT_DIM_DIFF_MAX_WERT                        I3_PID_NBT_CID_CODIERDATEN, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_DIFF_MAX_WERT"
+#define I3_FLD_NBT_STAT_DIM_DIFF_MIN_WERT                        I3_PID_NBT_CID_CODIERDATEN, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_DIFF_MIN_WERT"
+#define I3_FLD_NBT_STAT_DIM_UP_MIN_WERT                          I3_PID_NBT_CID_CODIERDATEN, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_UP_MIN_WERT"
+#define I3_FLD_NBT_STAT_DIM_DOWN_MIN_WERT                        I3_PID_NBT_CID_CODIERDATEN, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_DOWN_MIN_WERT"
+#define I3_FLD_NBT_STAT_DIM_MAX_OFFSET_BRIG_WERT                 I3_PID_NBT_CID_CODIERDATEN, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_MAX_OFFSET_BRIG_WERT"
+#define I3_FLD_NBT_STAT_DIM_FADE_TIME_T0_WERT                    I3_PID_NBT_CID_CODIERDATEN, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_FADE_TIME_T0_WERT"
+#define I3_FLD_NBT_STAT_DIM_FADE_TIME_T1_WERT                    I3_PID_NBT_CID_CODIERDATEN, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_FADE_TIME_T1_WERT"
+#define I3_FLD_NBT_STAT_DIM_FADE_TIME_T2_WERT                    I3_PID_NBT_CID_CODIERDATEN, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_FADE_TIME_T2_WERT"
+#define I3_FLD_NBT_STAT_DIM_FADE_EXPO_T1_WERT                    I3_PID_NBT_CID_CODIERDATEN, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_FADE_EXPO_T1_WERT"
+#define I3_FLD_NBT_STAT_DIM_FADE_EXPO_T2_WERT                    I3_PID_NBT_CID_CODIERDATEN, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_FADE_EXPO_T2_WERT"
+#define I3_FLD_NBT_STAT_DIM_FILT_CHANGE_SENSITIVITY_WERT         I3_PID_NBT_CID_CODIERDATEN, 27, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DIM_FILT_CHANGE_SENSITIVITY_WERT"
+#define I3_FLD_NBT_STAT_DIM_MIN_OFFSET_BRIG_WERT                 I3_PID_NBT_CID_CODIERDATEN, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIM_MIN_OFFSET_BRIG_WERT"
+#define I3_FLD_NBT_STAT_ENDIANESS_ADAPTED_WERT                   I3_PID_NBT_CID_CODIERDATEN, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ENDIANESS_ADAPTED_WERT"
+#define I3_FLD_NBT_STAT_PADDING_WERT                             I3_PID_NBT_CID_CODIERDATEN, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PADDING_WERT"
+
+// 0x4011 I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED
+#define I3_FLD_NBT_STAT_CID_LOCATION_WERT_0X4011                 I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CID_LOCATION_WERT_0X4011"
+#define I3_FLD_NBT_STAT_SUPPLIER_NR_WERT                         I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SUPPLIER_NR_WERT"
+#define I3_FLD_NBT_STAT_SERIAL_NUMBER_WERT_0X4011                I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SERIAL_NUMBER_WERT_0X4011"
+#define I3_FLD_NBT_STAT_PRODUCTION_YEAR_WERT                     I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PRODUCTION_YEAR_WERT"
+#define I3_FLD_NBT_STAT_PRODUCTION_MONTH_WERT                    I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PRODUCTION_MONTH_WERT"
+#define I3_FLD_NBT_STAT_PRODUCTION_DAY_WERT                      I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PRODUCTION_DAY_WERT"
+#define I3_FLD_NBT_STAT_HARDWARE_VERSION_WERT                    I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HARDWARE_VERSION_WERT"
+#define I3_FLD_NBT_STAT_DISPLAY_VERSION_WERT                     I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_DISPLAY_VERSION_WERT"
+#define I3_FLD_NBT_STAT_MECHANICAL_VERSION_WERT                  I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_MECHANICAL_VERSION_WERT"
+#define I3_FLD_NBT_STAT_FLASH_DATA_VERSION_WERT                  I3_PID_NBT_STATUS_CID_DETAIL_INFORMATION_EXTENDED, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_FLASH_DATA_VERSION_WERT"
+
+// 0x4044 I3_PID_NBT_WLAN_SIGNAL_TEST_AP
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_1_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_1_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_1_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 7, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_1_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_2_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_2_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_2_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 15, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_2_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_3_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_3_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_3_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 23, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_3_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_4_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_4_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_4_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 31, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_4_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_5_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_5_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_5_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 39, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_5_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_6_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_6_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_6_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 47, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_6_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_7_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 54, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_7_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_7_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 55, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_7_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_AP_8_WERT                 I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_AP_8_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_AP_8_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_AP, 63, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_AP_8_WERT"
+
+// 0x4045 I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_1_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_1_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_1_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 7, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_1_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_2_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_2_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_2_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 15, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_2_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_3_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_3_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_3_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 23, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_3_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_4_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_4_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_4_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 31, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_4_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_5_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_5_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_5_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 39, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_5_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_6_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_6_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_6_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 47, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_6_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_7_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 54, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_7_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_7_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 55, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_7_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DIRECT_8_WERT             I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_WLAN_ERRORRATE_DIRECT_8_WERT"
+#define I3_FLD_NBT_STAT_WLAN_ERRORRATE_DBM_DIRECT_8_WERT         I3_PID_NBT_WLAN_SIGNAL_TEST_WIFI_DIRECT, 63, PID_FIELD_UINT8, 1.0f, -255.0f, "STAT_WLAN_ERRORRATE_DBM_DIRECT_8_WERT"
+
+// 0xFDE1 I3_PID_NBT__STEUERN_DELETE_PERSISTENCY_JACINTO
+
+// 0xFDE2 I3_PID_NBT__STEUERN_DELETE_PERSISTENCY_INTEL_PLUS_SWT
+
+// 0xFDE3 I3_PID_NBT__STEUERN_DELETE_PERSISTENCY_INTEL
+
+// 0xFDE5 I3_PID_NBT__STEUERN_BACKUP_PERSISTENCY
+
+// 0xFDE6 I3_PID_NBT__STEUERN_RESTORE_PERSISTENCY
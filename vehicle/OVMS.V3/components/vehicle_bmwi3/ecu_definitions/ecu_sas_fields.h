@@ -0,0 +1,52 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/sas_i1.json: SAS 22: Optional equipment system
+// This generated code  makes it easier to process CANBUS messages from the SAS ecu in a BMW i3
+//
+
+// 0xABC9 I3_PID_SAS_LERNDATEN_RUECKSETZEN
+
+// 0xD817 I3_PID_SAS_VDC0_LESEN
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_VL_WERT                    I3_PID_SAS_VDC0_LESEN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VL_WERT"
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_VR_WERT                    I3_PID_SAS_VDC0_LESEN, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VR_WERT"
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_HL_WERT                    I3_PID_SAS_VDC0_LESEN, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HL_WERT"
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_HR_WERT                    I3_PID_SAS_VDC0_LESEN, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HR_WERT"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_VL_WERT                     I3_PID_SAS_VDC0_LESEN, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VL_WERT"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_VR_WERT                     I3_PID_SAS_VDC0_LESEN, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VR_WERT"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_HL_WERT                     I3_PID_SAS_VDC0_LESEN, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HL_WERT"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_HR_WERT                     I3_PID_SAS_VDC0_LESEN, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HR_WERT"
+#define I3_FLD_SAS_STAT_VDC_STATUS_VL                            I3_PID_SAS_VDC0_LESEN, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_VL"
+#define I3_FLD_SAS_STAT_VDC_STATUS_VR                            I3_PID_SAS_VDC0_LESEN, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_VR"
+#define I3_FLD_SAS_STAT_VDC_STATUS_HL                            I3_PID_SAS_VDC0_LESEN, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_HL"
+#define I3_FLD_SAS_STAT_VDC_STATUS_HR                            I3_PID_SAS_VDC0_LESEN, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_HR"
+#define I3_FLD_SAS_STAT_KLEMMEN                                  I3_PID_SAS_VDC0_LESEN, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLEMMEN"
+#define I3_FLD_SAS_STAT_WHL_SPD_VL_WERT                          I3_PID_SAS_VDC0_LESEN, 21, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_VL_WERT"
+#define I3_FLD_SAS_STAT_WHL_SPD_VR_WERT                          I3_PID_SAS_VDC0_LESEN, 23, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_VR_WERT"
+#define I3_FLD_SAS_STAT_WHL_SPD_HL_WERT                          I3_PID_SAS_VDC0_LESEN, 25, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_HL_WERT"
+#define I3_FLD_SAS_STAT_WHL_SPD_HR_WERT                          I3_PID_SAS_VDC0_LESEN, 27, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_HR_WERT"
+
+// 0xD817 I3_PID_SAS_VDC0_LESEN_0XD817
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_VL_WERT_0XD817             I3_PID_SAS_VDC0_LESEN_0XD817, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VL_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_VR_WERT_0XD817             I3_PID_SAS_VDC0_LESEN_0XD817, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_VR_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_HL_WERT_0XD817             I3_PID_SAS_VDC0_LESEN_0XD817, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HL_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_SOLLSTROM_HR_WERT_0XD817             I3_PID_SAS_VDC0_LESEN_0XD817, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_SOLLSTROM_HR_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_VL_WERT_0XD817              I3_PID_SAS_VDC0_LESEN_0XD817, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VL_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_VR_WERT_0XD817              I3_PID_SAS_VDC0_LESEN_0XD817, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_VR_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_HL_WERT_0XD817              I3_PID_SAS_VDC0_LESEN_0XD817, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HL_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_ISTSTROM_HR_WERT_0XD817              I3_PID_SAS_VDC0_LESEN_0XD817, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_VDC_ISTSTROM_HR_WERT_0XD817"
+#define I3_FLD_SAS_STAT_VDC_STATUS_VL_0XD817                     I3_PID_SAS_VDC0_LESEN_0XD817, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_VL_0XD817"
+#define I3_FLD_SAS_STAT_VDC_STATUS_VR_0XD817                     I3_PID_SAS_VDC0_LESEN_0XD817, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_VR_0XD817"
+#define I3_FLD_SAS_STAT_VDC_STATUS_HL_0XD817                     I3_PID_SAS_VDC0_LESEN_0XD817, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_HL_0XD817"
+#define I3_FLD_SAS_STAT_VDC_STATUS_HR_0XD817                     I3_PID_SAS_VDC0_LESEN_0XD817, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VDC_STATUS_HR_0XD817"
+#define I3_FLD_SAS_STAT_KLEMMEN_0XD817                           I3_PID_SAS_VDC0_LESEN_0XD817, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KLEMMEN_0XD817"
+#define I3_FLD_SAS_STAT_WHL_SPD_VL_WERT_0XD817                   I3_PID_SAS_VDC0_LESEN_0XD817, 21, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_VL_WERT_0XD817"
+#define I3_FLD_SAS_STAT_WHL_SPD_VR_WERT_0XD817                   I3_PID_SAS_VDC0_LESEN_0XD817, 23, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_VR_WERT_0XD817"
+#define I3_FLD_SAS_STAT_WHL_SPD_HL_WERT_0XD817                   I3_PID_SAS_VDC0_LESEN_0XD817, 25, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_HL_WERT_0XD817"
+#define I3_FLD_SAS_STAT_WHL_SPD_HR_WERT_0XD817                   I3_PID_SAS_VDC0_LESEN_0XD817, 27, PID_FIELD_UINT16, 0.0156f, -511.984f, "STAT_WHL_SPD_HR_WERT_0XD817"
+
+// 0xDD33 I3_PID_SAS_STATUS_SWC_VERSIONEN_LESEN_ANZAHL_DATENSAETZE
+#define I3_FLD_SAS_STAT_INDEX_DATENSATZ_WERT                     I3_PID_SAS_STATUS_SWC_VERSIONEN_LESEN_ANZAHL_DATENSAETZE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INDEX_DATENSATZ_WERT"
+
+// 0x4001 I3_PID_SAS_READ_EXCEPTION_DATA
+
+// 0xF000 I3_PID_SAS_CLEAR_EXCEPTION_DATA
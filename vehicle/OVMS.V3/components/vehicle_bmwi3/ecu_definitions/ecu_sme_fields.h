@@ -0,0 +1,1951 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/sme_i1.json: SME 07: Battery management electronics
+// This generated code  makes it easier to process CANBUS messages from the SME ecu in a BMW i3
+//
+
+// 0x6334 I3_PID_SME_ALTERUNG_INNENWIDERSTAND_TS
+#define I3_FLD_SME_STAT_ALTERUNG_INNENWIDERSTAND_WERT            I3_PID_SME_ALTERUNG_INNENWIDERSTAND_TS, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ALTERUNG_INNENWIDERSTAND_WERT"
+
+// 0x6335 I3_PID_SME_ALTERUNG_KAPAZITAET_TS
+#define I3_FLD_SME_STAT_ALTERUNG_KAPAZITAET_WERT                 I3_PID_SME_ALTERUNG_KAPAZITAET_TS, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ALTERUNG_KAPAZITAET_WERT"
+
+// 0x6516 I3_PID_SME__ST_SYM_MODUS
+#define I3_FLD_SME_STAT_SYM_MODUS                                I3_PID_SME__ST_SYM_MODUS, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SYM_MODUS"
+
+// 0x651D I3_PID_SME__UEBERLAST_ZAHELER
+#define I3_FLD_SME_STAT_OVERLOAD_K1_WERT                         I3_PID_SME__UEBERLAST_ZAHELER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_K1_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_K2_WERT                         I3_PID_SME__UEBERLAST_ZAHELER, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_K2_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_K3_WERT                         I3_PID_SME__UEBERLAST_ZAHELER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_K3_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_COOLING_VALVE_WERT              I3_PID_SME__UEBERLAST_ZAHELER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_COOLING_VALVE_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_CSC_SUPPLY_WERT                 I3_PID_SME__UEBERLAST_ZAHELER, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_CSC_SUPPLY_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_ISENS_WERT                      I3_PID_SME__UEBERLAST_ZAHELER, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_ISENS_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_COOLING_PUMP_WERT               I3_PID_SME__UEBERLAST_ZAHELER, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_COOLING_PUMP_WERT"
+#define I3_FLD_SME_STAT_OVERLOAD_HEATING_WERT                    I3_PID_SME__UEBERLAST_ZAHELER, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_OVERLOAD_HEATING_WERT"
+
+// 0x6526 I3_PID_SME__STATUS_UEBERNAHME_KAPATEST_NV
+#define I3_FLD_SME_STAT_UEBERNAHME_KAPATEST_NV                   I3_PID_SME__STATUS_UEBERNAHME_KAPATEST_NV, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_UEBERNAHME_KAPATEST_NV"
+
+// 0xAD5E I3_PID_SME_ISOLATIONSWIDERSTAND_KOMMUNIKATION
+#define I3_FLD_SME_STAT_KOMMUNIKATION_AVL_ISRE                   I3_PID_SME_ISOLATIONSWIDERSTAND_KOMMUNIKATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KOMMUNIKATION_AVL_ISRE"
+
+// 0xAD61 I3_PID_SME_ISOLATION
+#define I3_FLD_SME_STAT_MESSUNG_ERFOLGREICH                      I3_PID_SME_ISOLATION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MESSUNG_ERFOLGREICH"
+#define I3_FLD_SME_STAT_MESSUNG_ISOLATIONSFEHLER                 I3_PID_SME_ISOLATION, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MESSUNG_ISOLATIONSFEHLER"
+
+// 0xAD66 I3_PID_SME_KAPAZITAET_BESTIMMUNG
+#define I3_FLD_SME_STAT_KAPAZITAET_WERT                          I3_PID_SME_KAPAZITAET_BESTIMMUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAPAZITAET_WERT"
+#define I3_FLD_SME_STAT_AKTUELLER_ZUSTAND_NR                     I3_PID_SME_KAPAZITAET_BESTIMMUNG, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AKTUELLER_ZUSTAND_NR"
+
+// 0xAD6A I3_PID_SME_HEIZUNG
+#define I3_FLD_SME_STAT_HEIZUNG_AKTIV_NR                         I3_PID_SME_HEIZUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HEIZUNG_AKTIV_NR"
+
+// 0xAD6B I3_PID_SME_SYMMETRIERUNG
+#define I3_FLD_SME_STAT_SYM                                      I3_PID_SME_SYMMETRIERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SYM"
+
+// 0xAD73 I3_PID_SME_HEIZUNG_FUNKTION
+#define I3_FLD_SME_STAT_HEIZUNG_FUNKTION_NR                      I3_PID_SME_HEIZUNG_FUNKTION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HEIZUNG_FUNKTION_NR"
+
+// 0xD4C5 I3_PID_SME_RB_SOC_REKALIBRIERUNG
+#define I3_FLD_SME_STAT_GRUND_REKAL_1                            I3_PID_SME_RB_SOC_REKALIBRIERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_REKAL_1"
+#define I3_FLD_SME_STAT_ZEITPUNKT_REKAL_1_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_1_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_REKAL_1_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 5, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_VOR_1_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_NACH_1_WERT               I3_PID_SME_RB_SOC_REKALIBRIERUNG, 10, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_1_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 11, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_1_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 13, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_1_WERT                         I3_PID_SME_RB_SOC_REKALIBRIERUNG, 15, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_VOR_1_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 17, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_VOR_1_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 19, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_VOR_1_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 21, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_NACH_1_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 23, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_NACH_1_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 25, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_NACH_1_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 27, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_VOR_1_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 29, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_VOR_1_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 31, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_VOR_1_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 33, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_NACH_1_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 35, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_NACH_1_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 37, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_NACH_1_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 39, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_1_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 41, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_1_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_1_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 43, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_1_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_1_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 45, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_1_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_VOR_1_WERT                      I3_PID_SME_RB_SOC_REKALIBRIERUNG, 47, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_VOR_1_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_NACH_1_WERT                     I3_PID_SME_RB_SOC_REKALIBRIERUNG, 49, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_NACH_1_WERT"
+#define I3_FLD_SME_STAT_GRUND_REKAL_2                            I3_PID_SME_RB_SOC_REKALIBRIERUNG, 51, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_REKAL_2"
+#define I3_FLD_SME_STAT_ZEITPUNKT_REKAL_2_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_2_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_REKAL_2_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_VOR_2_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 60, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_NACH_2_WERT               I3_PID_SME_RB_SOC_REKALIBRIERUNG, 61, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_2_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 62, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_2_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 64, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_2_WERT                         I3_PID_SME_RB_SOC_REKALIBRIERUNG, 66, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_VOR_2_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 68, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_VOR_2_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 70, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_VOR_2_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 72, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_NACH_2_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 74, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_NACH_2_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 76, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_NACH_2_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 78, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_VOR_2_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 80, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_VOR_2_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 82, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_VOR_2_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 84, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_NACH_2_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 86, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_NACH_2_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 88, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_NACH_2_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 90, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_2_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 92, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_2_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_2_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 94, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_2_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_2_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 96, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_2_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_VOR_2_WERT                      I3_PID_SME_RB_SOC_REKALIBRIERUNG, 98, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_VOR_2_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_NACH_2_WERT                     I3_PID_SME_RB_SOC_REKALIBRIERUNG, 100, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_NACH_2_WERT"
+#define I3_FLD_SME_STAT_GRUND_REKAL_3                            I3_PID_SME_RB_SOC_REKALIBRIERUNG, 102, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_REKAL_3"
+#define I3_FLD_SME_STAT_ZEITPUNKT_REKAL_3_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 103, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_3_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_REKAL_3_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 107, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_VOR_3_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 111, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_NACH_3_WERT               I3_PID_SME_RB_SOC_REKALIBRIERUNG, 112, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_3_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 113, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_3_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 115, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_3_WERT                         I3_PID_SME_RB_SOC_REKALIBRIERUNG, 117, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_VOR_3_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 119, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_VOR_3_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 121, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_VOR_3_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 123, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_NACH_3_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 125, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_NACH_3_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 127, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_NACH_3_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 129, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_VOR_3_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 131, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_VOR_3_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 133, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_VOR_3_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 135, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_NACH_3_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 137, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_NACH_3_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 139, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_NACH_3_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 141, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_3_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 143, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_3_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_3_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 145, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_3_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_3_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 147, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_3_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_VOR_3_WERT                      I3_PID_SME_RB_SOC_REKALIBRIERUNG, 149, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_VOR_3_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_NACH_3_WERT                     I3_PID_SME_RB_SOC_REKALIBRIERUNG, 151, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_NACH_3_WERT"
+#define I3_FLD_SME_STAT_GRUND_REKAL_4                            I3_PID_SME_RB_SOC_REKALIBRIERUNG, 153, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_REKAL_4"
+#define I3_FLD_SME_STAT_ZEITPUNKT_REKAL_4_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 154, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_4_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_REKAL_4_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 158, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_VOR_4_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 162, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_NACH_4_WERT               I3_PID_SME_RB_SOC_REKALIBRIERUNG, 163, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_4_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 164, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_4_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 166, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_4_WERT                         I3_PID_SME_RB_SOC_REKALIBRIERUNG, 168, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_VOR_4_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 170, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_VOR_4_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 172, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_VOR_4_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 174, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_NACH_4_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 176, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_NACH_4_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 178, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_NACH_4_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 180, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_VOR_4_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 182, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_VOR_4_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 184, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_VOR_4_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 186, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_NACH_4_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 188, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_NACH_4_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 190, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_NACH_4_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 192, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_4_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 194, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_4_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_4_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 196, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_4_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_4_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 198, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_4_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_VOR_4_WERT                      I3_PID_SME_RB_SOC_REKALIBRIERUNG, 200, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_VOR_4_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_NACH_4_WERT                     I3_PID_SME_RB_SOC_REKALIBRIERUNG, 202, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_NACH_4_WERT"
+#define I3_FLD_SME_STAT_GRUND_REKAL_5                            I3_PID_SME_RB_SOC_REKALIBRIERUNG, 204, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_REKAL_5"
+#define I3_FLD_SME_STAT_ZEITPUNKT_REKAL_5_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 205, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_REKAL_5_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_REKAL_5_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 209, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFFTIME_REKAL_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_VOR_5_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 213, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_VOR_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_MESS_MEAN_NACH_5_WERT               I3_PID_SME_RB_SOC_REKALIBRIERUNG, 214, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MESS_MEAN_NACH_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_5_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 215, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_5_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 217, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_5_WERT                         I3_PID_SME_RB_SOC_REKALIBRIERUNG, 219, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_VOR_5_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 221, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_VOR_5_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 223, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_VOR_5_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 225, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_NACH_5_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 227, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_NENN_NACH_5_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 229, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_NENN_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_NENN_NACH_5_WERT                I3_PID_SME_RB_SOC_REKALIBRIERUNG, 231, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_NENN_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_VOR_5_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 233, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_VOR_5_WERT                   I3_PID_SME_RB_SOC_REKALIBRIERUNG, 235, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_VOR_5_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 237, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_AKT_NACH_5_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 239, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_AKT_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_NACH_5_WERT                  I3_PID_SME_RB_SOC_REKALIBRIERUNG, 241, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MEAN_AKT_NACH_5_WERT                 I3_PID_SME_RB_SOC_REKALIBRIERUNG, 243, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MEAN_AKT_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_5_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 245, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_5_WERT                           I3_PID_SME_RB_SOC_REKALIBRIERUNG, 247, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_5_WERT                          I3_PID_SME_RB_SOC_REKALIBRIERUNG, 249, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_5_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_VOR_5_WERT                      I3_PID_SME_RB_SOC_REKALIBRIERUNG, 251, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOC_BAND_NACH_5_WERT                     I3_PID_SME_RB_SOC_REKALIBRIERUNG, 253, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_BAND_NACH_5_WERT"
+
+// 0xD4C7 I3_PID_SME_SOC_GUETE
+#define I3_FLD_SME_STAT_SOC_GUETE_WERT                           I3_PID_SME_SOC_GUETE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_GUETE_WERT"
+
+// 0xD4C8 I3_PID_SME_HIS_SOC_GUETE
+#define I3_FLD_SME_STAT_HIS_SOC_GUETE_1_WERT                     I3_PID_SME_HIS_SOC_GUETE, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_1_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_GUETE_2_WERT                     I3_PID_SME_HIS_SOC_GUETE, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_2_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_GUETE_3_WERT                     I3_PID_SME_HIS_SOC_GUETE, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_3_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_GUETE_4_WERT                     I3_PID_SME_HIS_SOC_GUETE, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_4_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_GUETE_5_WERT                     I3_PID_SME_HIS_SOC_GUETE, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_GUETE_5_WERT"
+
+// 0xD4C9 I3_PID_SME_ANZAHL_OCV_SOC_REKAL
+#define I3_FLD_SME_STAT_ANZAHL_OCV_SOC_REKAL_WERT                I3_PID_SME_ANZAHL_OCV_SOC_REKAL, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_OCV_SOC_REKAL_WERT"
+
+// 0xD4CA I3_PID_SME_ANZAHL_LADEENDE_REKAL
+#define I3_FLD_SME_STAT_ANZAHL_LADEENDE_REKAL_WERT               I3_PID_SME_ANZAHL_LADEENDE_REKAL, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LADEENDE_REKAL_WERT"
+
+// 0xD4CB I3_PID_SME_RB_SOC_VOLLADEENDE
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_1_WERT                      I3_PID_SME_RB_SOC_VOLLADEENDE, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_WENN_VOLL_1_WERT            I3_PID_SME_RB_SOC_VOLLADEENDE, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_1_WERT                       I3_PID_SME_RB_SOC_VOLLADEENDE, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_WENN_VOLL_1_WERT             I3_PID_SME_RB_SOC_VOLLADEENDE, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEBEGINN_1_WERT                   I3_PID_SME_RB_SOC_VOLLADEENDE, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEENDE_1_WERT                     I3_PID_SME_RB_SOC_VOLLADEENDE, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEENDE_1_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_2_WERT                      I3_PID_SME_RB_SOC_VOLLADEENDE, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_WENN_VOLL_2_WERT            I3_PID_SME_RB_SOC_VOLLADEENDE, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_2_WERT                       I3_PID_SME_RB_SOC_VOLLADEENDE, 14, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_WENN_VOLL_2_WERT             I3_PID_SME_RB_SOC_VOLLADEENDE, 16, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEBEGINN_2_WERT                   I3_PID_SME_RB_SOC_VOLLADEENDE, 18, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEENDE_2_WERT                     I3_PID_SME_RB_SOC_VOLLADEENDE, 19, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEENDE_2_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_3_WERT                      I3_PID_SME_RB_SOC_VOLLADEENDE, 20, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_WENN_VOLL_3_WERT            I3_PID_SME_RB_SOC_VOLLADEENDE, 22, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_3_WERT                       I3_PID_SME_RB_SOC_VOLLADEENDE, 24, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_WENN_VOLL_3_WERT             I3_PID_SME_RB_SOC_VOLLADEENDE, 26, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEBEGINN_3_WERT                   I3_PID_SME_RB_SOC_VOLLADEENDE, 28, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEENDE_3_WERT                     I3_PID_SME_RB_SOC_VOLLADEENDE, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEENDE_3_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_4_WERT                      I3_PID_SME_RB_SOC_VOLLADEENDE, 30, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_WENN_VOLL_4_WERT            I3_PID_SME_RB_SOC_VOLLADEENDE, 32, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_4_WERT                       I3_PID_SME_RB_SOC_VOLLADEENDE, 34, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_WENN_VOLL_4_WERT             I3_PID_SME_RB_SOC_VOLLADEENDE, 36, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEBEGINN_4_WERT                   I3_PID_SME_RB_SOC_VOLLADEENDE, 38, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEENDE_4_WERT                     I3_PID_SME_RB_SOC_VOLLADEENDE, 39, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEENDE_4_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_5_WERT                      I3_PID_SME_RB_SOC_VOLLADEENDE, 40, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_WENN_VOLL_5_WERT            I3_PID_SME_RB_SOC_VOLLADEENDE, 42, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MIN_NENN_WENN_VOLL_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_5_WERT                       I3_PID_SME_RB_SOC_VOLLADEENDE, 44, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_5_WERT"
+#define I3_FLD_SME_STAT_SOC_MAX_AKT_WENN_VOLL_5_WERT             I3_PID_SME_RB_SOC_VOLLADEENDE, 46, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOC_MAX_AKT_WENN_VOLL_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEBEGINN_5_WERT                   I3_PID_SME_RB_SOC_VOLLADEENDE, 48, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEBEGINN_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_LADEENDE_5_WERT                     I3_PID_SME_RB_SOC_VOLLADEENDE, 49, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_LADEENDE_5_WERT"
+
+// 0xD4CC I3_PID_SME_KUEHLDAUER_HVB
+#define I3_FLD_SME_STAT_KUEHLDAUER_MAX_WERT                      I3_PID_SME_KUEHLDAUER_HVB, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KUEHLDAUER_MAX_WERT"
+#define I3_FLD_SME_STAT_KUEHLDAUER_1_WERT                        I3_PID_SME_KUEHLDAUER_HVB, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_1_WERT"
+#define I3_FLD_SME_STAT_KUEHLDAUER_2_WERT                        I3_PID_SME_KUEHLDAUER_HVB, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_2_WERT"
+#define I3_FLD_SME_STAT_KUEHLDAUER_3_WERT                        I3_PID_SME_KUEHLDAUER_HVB, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_3_WERT"
+#define I3_FLD_SME_STAT_KUEHLDAUER_4_WERT                        I3_PID_SME_KUEHLDAUER_HVB, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_4_WERT"
+
+// 0xD67F I3_PID_SME_LADUNGSVERLUST_ZELLE
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_01_WERT                     I3_PID_SME_LADUNGSVERLUST_ZELLE, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SOC_MIN_NENN_01_WERT"
+#define I3_FLD_SME_STAT_DIFF_SOC_01_WERT                         I3_PID_SME_LADUNGSVERLUST_ZELLE, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DIFF_SOC_01_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_02_WERT                     I3_PID_SME_LADUNGSVERLUST_ZELLE, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SOC_MIN_NENN_02_WERT"
+#define I3_FLD_SME_STAT_DIFF_SOC_02_WERT                         I3_PID_SME_LADUNGSVERLUST_ZELLE, 6, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DIFF_SOC_02_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_03_WERT                     I3_PID_SME_LADUNGSVERLUST_ZELLE, 8, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SOC_MIN_NENN_03_WERT"
+#define I3_FLD_SME_STAT_DIFF_SOC_03_WERT                         I3_PID_SME_LADUNGSVERLUST_ZELLE, 10, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DIFF_SOC_03_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_04_WERT                     I3_PID_SME_LADUNGSVERLUST_ZELLE, 12, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SOC_MIN_NENN_04_WERT"
+#define I3_FLD_SME_STAT_DIFF_SOC_04_WERT                         I3_PID_SME_LADUNGSVERLUST_ZELLE, 14, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DIFF_SOC_04_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_05_WERT                     I3_PID_SME_LADUNGSVERLUST_ZELLE, 16, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SOC_MIN_NENN_05_WERT"
+#define I3_FLD_SME_STAT_DIFF_SOC_05_WERT                         I3_PID_SME_LADUNGSVERLUST_ZELLE, 18, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_DIFF_SOC_05_WERT"
+#define I3_FLD_SME_STAT_ID_ZELLE_SOC_MIN_WERT                    I3_PID_SME_LADUNGSVERLUST_ZELLE, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ID_ZELLE_SOC_MIN_WERT"
+#define I3_FLD_SME_STAT_COUNTER_RG_WERT                          I3_PID_SME_LADUNGSVERLUST_ZELLE, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_COUNTER_RG_WERT"
+
+// 0xD681 I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_01_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_01_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_02_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_02_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_03_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_03_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_04_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_04_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_05_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_05_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_06_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_06_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_07_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_07_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_08_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_08_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_09_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_09_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_10_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_10_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_11_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_11_WERT"
+#define I3_FLD_SME_STAT_MIN_KAPA_MOD_12_WERT                     I3_PID_SME_STATUS_MIN_KAPAZITAET_MOD, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_MIN_KAPA_MOD_12_WERT"
+
+// 0xD6C7 I3_PID_SME_RB_ISO_MESS_TRG
+#define I3_FLD_SME_STAT_R_ISO_TRG_01_WERT                        I3_PID_SME_RB_ISO_MESS_TRG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_R_ISO_TRG_01_WERT"
+#define I3_FLD_SME_STAT_R_ISO_QAL_TRG_01_WERT                    I3_PID_SME_RB_ISO_MESS_TRG, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_01_WERT"
+#define I3_FLD_SME_STAT_R_ISO_TRG_02_WERT                        I3_PID_SME_RB_ISO_MESS_TRG, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_R_ISO_TRG_02_WERT"
+#define I3_FLD_SME_STAT_R_ISO_QAL_TRG_02_WERT                    I3_PID_SME_RB_ISO_MESS_TRG, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_02_WERT"
+#define I3_FLD_SME_STAT_R_ISO_TRG_03_WERT                        I3_PID_SME_RB_ISO_MESS_TRG, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_R_ISO_TRG_03_WERT"
+#define I3_FLD_SME_STAT_R_ISO_QAL_TRG_03_WERT                    I3_PID_SME_RB_ISO_MESS_TRG, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_03_WERT"
+#define I3_FLD_SME_STAT_R_ISO_TRG_04_WERT                        I3_PID_SME_RB_ISO_MESS_TRG, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_R_ISO_TRG_04_WERT"
+#define I3_FLD_SME_STAT_R_ISO_QAL_TRG_04_WERT                    I3_PID_SME_RB_ISO_MESS_TRG, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_04_WERT"
+#define I3_FLD_SME_STAT_R_ISO_TRG_05_WERT                        I3_PID_SME_RB_ISO_MESS_TRG, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_R_ISO_TRG_05_WERT"
+#define I3_FLD_SME_STAT_R_ISO_QAL_TRG_05_WERT                    I3_PID_SME_RB_ISO_MESS_TRG, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_R_ISO_QAL_TRG_05_WERT"
+
+// 0xD6C8 I3_PID_SME_RB_ISO_MESS_STD_IO_NIO
+#define I3_FLD_SME_STAT_STD_KM_ISO_01_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_01_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_01_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_01_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_01_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_01_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_02_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 7, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_02_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_02_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_02_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_02_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_02_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_03_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_03_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_03_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_03_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_03_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_03_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_04_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_04_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_04_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_04_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_04_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_04_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_05_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_05_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_05_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_05_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_05_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_05_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_06_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 35, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_06_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_06_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_06_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_06_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_06_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_07_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 42, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_07_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_07_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_07_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_07_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_07_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_08_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 49, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_08_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_08_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 53, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_08_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_08_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_08_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_09_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_09_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_09_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_09_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_09_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_09_WERT"
+#define I3_FLD_SME_STAT_STD_KM_ISO_10_WERT                       I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 63, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_STD_KM_ISO_10_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_10_WERT                        I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 67, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_STD_R_ISO_10_WERT"
+#define I3_FLD_SME_STAT_STD_R_ISO_QAL_10_WERT                    I3_PID_SME_RB_ISO_MESS_STD_IO_NIO, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_STD_R_ISO_QAL_10_WERT"
+
+// 0xD6C9 I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO
+#define I3_FLD_SME_STAT_TRG_KM_ISO_01_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_01_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_01_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_01_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_01_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_01_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_02_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 7, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_02_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_02_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_02_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_02_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_02_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_03_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_03_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_03_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_03_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_03_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_03_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_04_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_04_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_04_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_04_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_04_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_04_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_05_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_05_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_05_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_05_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_05_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_05_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_06_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 35, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_06_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_06_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 39, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_06_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_06_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_06_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_07_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 42, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_07_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_07_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_07_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_07_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_07_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_08_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 49, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_08_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_08_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 53, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_08_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_08_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 55, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_08_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_09_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_09_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_09_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 60, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_09_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_09_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_09_WERT"
+#define I3_FLD_SME_STAT_TRG_KM_ISO_10_WERT                       I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 63, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TRG_KM_ISO_10_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_10_WERT                        I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 67, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRG_R_ISO_10_WERT"
+#define I3_FLD_SME_STAT_TRG_R_ISO_QAL_10_WERT                    I3_PID_SME_RB_ISO_MESS_TRG_IO_NIO, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TRG_R_ISO_QAL_10_WERT"
+
+// 0xD6CA I3_PID_SME_ISODIAG_INPUT_ISTWERTE
+#define I3_FLD_SME_STAT_INPUT_ISO_01_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_01_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_02_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_02_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_03_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 3, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_03_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_04_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_04_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_05_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_05_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_06_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_06_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_07_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 9, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_07_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_08_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_08_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_09_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 12, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_09_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_10_WERT                        I3_PID_SME_ISODIAG_INPUT_ISTWERTE, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_10_WERT"
+
+// 0xD6CB I3_PID_SME_ISO_ERR_STD_FZ1_2
+#define I3_FLD_SME_STAT_FEHLERZAEHLER_STD_WERT                   I3_PID_SME_ISO_ERR_STD_FZ1_2, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FEHLERZAEHLER_STD_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_01_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_01_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_02_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_02_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_03_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 7, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_03_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_04_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_04_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_05_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_05_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_06_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_06_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_07_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 13, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_07_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_08_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_08_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_09_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 16, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_09_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_10_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_10_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_11_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_11_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_12_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_12_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_13_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_13_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_14_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 24, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_14_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_15_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_15_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ1_16_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 27, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ1_16_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_01_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 28, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_01_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_02_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_02_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_03_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 31, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_03_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_04_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_04_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_05_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 34, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_05_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_06_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_06_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_07_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 37, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_07_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_08_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_08_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_09_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 40, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_09_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_10_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_10_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_11_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 43, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_11_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_12_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_12_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_13_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_13_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_14_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 48, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_14_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_15_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_15_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_STD_FZ2_16_WERT                I3_PID_SME_ISO_ERR_STD_FZ1_2, 51, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_STD_FZ2_16_WERT"
+
+// 0xD6CC I3_PID_SME_RB_SOH_KAPATEST
+#define I3_FLD_SME_STAT_SOH_C_MIN_ERG_TEST_1_WERT                I3_PID_SME_RB_SOH_KAPATEST, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MIN_ERG_TEST_1_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MIN_VOR_TEST_1_WERT                I3_PID_SME_RB_SOH_KAPATEST, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MIN_VOR_TEST_1_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MAX_VOR_TEST_1_WERT                I3_PID_SME_RB_SOH_KAPATEST, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MAX_VOR_TEST_1_WERT"
+#define I3_FLD_SME_STAT_SOH_C_AVG_VOR_TEST_1_WERT                I3_PID_SME_RB_SOH_KAPATEST, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_AVG_VOR_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_VOR_TEST_1_WERT                     I3_PID_SME_RB_SOH_KAPATEST, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_VOR_TEST_1_WERT"
+#define I3_FLD_SME_STAT_MAX_DELTA_U_CELL_1_WERT                  I3_PID_SME_RB_SOH_KAPATEST, 9, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_MAX_DELTA_U_CELL_1_WERT"
+#define I3_FLD_SME_STAT_MAX_DELTA_SOC_NENN_1_WERT                I3_PID_SME_RB_SOH_KAPATEST, 11, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MAX_DELTA_SOC_NENN_1_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_TEST_1_WERT                    I3_PID_SME_RB_SOH_KAPATEST, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_TEST_1_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MIN_ERG_TEST_2_WERT                I3_PID_SME_RB_SOH_KAPATEST, 17, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MIN_ERG_TEST_2_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MIN_VOR_TEST_2_WERT                I3_PID_SME_RB_SOH_KAPATEST, 19, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MIN_VOR_TEST_2_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MAX_VOR_TEST_2_WERT                I3_PID_SME_RB_SOH_KAPATEST, 21, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MAX_VOR_TEST_2_WERT"
+#define I3_FLD_SME_STAT_SOH_C_AVG_VOR_TEST_2_WERT                I3_PID_SME_RB_SOH_KAPATEST, 23, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_AVG_VOR_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_VOR_TEST_2_WERT                     I3_PID_SME_RB_SOH_KAPATEST, 25, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_VOR_TEST_2_WERT"
+#define I3_FLD_SME_STAT_MAX_DELTA_U_CELL_2_WERT                  I3_PID_SME_RB_SOH_KAPATEST, 26, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_MAX_DELTA_U_CELL_2_WERT"
+#define I3_FLD_SME_STAT_MAX_DELTA_SOC_NENN_2_WERT                I3_PID_SME_RB_SOH_KAPATEST, 28, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MAX_DELTA_SOC_NENN_2_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_TEST_2_WERT                    I3_PID_SME_RB_SOH_KAPATEST, 30, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_TEST_2_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MIN_ERG_TEST_3_WERT                I3_PID_SME_RB_SOH_KAPATEST, 34, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MIN_ERG_TEST_3_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MIN_VOR_TEST_3_WERT                I3_PID_SME_RB_SOH_KAPATEST, 36, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MIN_VOR_TEST_3_WERT"
+#define I3_FLD_SME_STAT_SOH_C_MAX_VOR_TEST_3_WERT                I3_PID_SME_RB_SOH_KAPATEST, 38, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_MAX_VOR_TEST_3_WERT"
+#define I3_FLD_SME_STAT_SOH_C_AVG_VOR_TEST_3_WERT                I3_PID_SME_RB_SOH_KAPATEST, 40, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_C_AVG_VOR_TEST_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_VOR_TEST_3_WERT                     I3_PID_SME_RB_SOH_KAPATEST, 42, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_VOR_TEST_3_WERT"
+#define I3_FLD_SME_STAT_MAX_DELTA_U_CELL_3_WERT                  I3_PID_SME_RB_SOH_KAPATEST, 43, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_MAX_DELTA_U_CELL_3_WERT"
+#define I3_FLD_SME_STAT_MAX_DELTA_SOC_NENN_3_WERT                I3_PID_SME_RB_SOH_KAPATEST, 45, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_MAX_DELTA_SOC_NENN_3_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_TEST_3_WERT                    I3_PID_SME_RB_SOH_KAPATEST, 47, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_TEST_3_WERT"
+
+// 0xD6CD I3_PID_SME_REKU_VOLTAGE_LIFT
+#define I3_FLD_SME_STAT_ANZAHL_REKU_VOLT_LIFT_WERT               I3_PID_SME_REKU_VOLTAGE_LIFT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_REKU_VOLT_LIFT_WERT"
+#define I3_FLD_SME_STAT_DAUER_REKU_VOLT_LIFT_WERT                I3_PID_SME_REKU_VOLTAGE_LIFT, 2, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_DAUER_REKU_VOLT_LIFT_WERT"
+
+// 0xD6CE I3_PID_SME_RB_ALTERUNG_KAPA
+#define I3_FLD_SME_STAT_SOH_ADAPT_COUNT_1_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_1_WERT"
+#define I3_FLD_SME_STAT_GRUND_ADAPTION_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_ADAPTION_1_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_ADAP_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 3, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_1_WERT"
+#define I3_FLD_SME_STAT_AH_CUM_ABS_1_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 7, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_1_WERT"
+#define I3_FLD_SME_STAT_AH_INTEGRAL_1_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 11, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_1_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_ADAP_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 15, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN1_1_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 17, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN1_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN2_1_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 18, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN2_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT1_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 19, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT1_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 21, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT1_1_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 23, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT2_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 25, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT2_1_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 27, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_1_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT2_1_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 29, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_1_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_VOR_ADAPT_1_WERT              I3_PID_SME_RB_ALTERUNG_KAPA, 31, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_1_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_NACH_ADAPT_1_WERT             I3_PID_SME_RB_ALTERUNG_KAPA, 33, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_1_WERT"
+#define I3_FLD_SME_STAT_OVC1_ZELLE1_1_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 35, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC1_ZELLE1_1_WERT"
+#define I3_FLD_SME_STAT_OVC2_ZELLE1_1_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 37, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC2_ZELLE1_1_WERT"
+#define I3_FLD_SME_STAT_SOH_GAIN_FAKTOR_ZELLE1_1_WERT            I3_PID_SME_RB_ALTERUNG_KAPA, 39, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_1_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_NACH_1_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 41, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_NACH_1_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 43, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_NACH_1_WERT                     I3_PID_SME_RB_ALTERUNG_KAPA, 45, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_1_WERT"
+#define I3_FLD_SME_STAT_SOH_ADAPT_COUNT_2_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 47, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_2_WERT"
+#define I3_FLD_SME_STAT_GRUND_ADAPTION_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_ADAPTION_2_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_ADAP_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_2_WERT"
+#define I3_FLD_SME_STAT_AH_CUM_ABS_2_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 54, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_2_WERT"
+#define I3_FLD_SME_STAT_AH_INTEGRAL_2_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 58, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_2_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_ADAP_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 62, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN1_2_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 64, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN1_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN2_2_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 65, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN2_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT1_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 66, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT1_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 68, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT1_2_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 70, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT2_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 72, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT2_2_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 74, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_2_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT2_2_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 76, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_2_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_VOR_ADAPT_2_WERT              I3_PID_SME_RB_ALTERUNG_KAPA, 78, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_2_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_NACH_ADAPT_2_WERT             I3_PID_SME_RB_ALTERUNG_KAPA, 80, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_2_WERT"
+#define I3_FLD_SME_STAT_OVC1_ZELLE1_2_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 82, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC1_ZELLE1_2_WERT"
+#define I3_FLD_SME_STAT_OVC2_ZELLE1_2_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 84, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC2_ZELLE1_2_WERT"
+#define I3_FLD_SME_STAT_SOH_GAIN_FAKTOR_ZELLE1_2_WERT            I3_PID_SME_RB_ALTERUNG_KAPA, 86, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_2_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_NACH_2_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 88, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_NACH_2_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 90, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_NACH_2_WERT                     I3_PID_SME_RB_ALTERUNG_KAPA, 92, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_2_WERT"
+#define I3_FLD_SME_STAT_SOH_ADAPT_COUNT_3_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 94, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_3_WERT"
+#define I3_FLD_SME_STAT_GRUND_ADAPTION_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 96, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_ADAPTION_3_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_ADAP_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 97, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_3_WERT"
+#define I3_FLD_SME_STAT_AH_CUM_ABS_3_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 101, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_3_WERT"
+#define I3_FLD_SME_STAT_AH_INTEGRAL_3_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 105, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_3_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_ADAP_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 109, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN1_3_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 111, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN1_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN2_3_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 112, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN2_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT1_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 113, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT1_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 115, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT1_3_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 117, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT2_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 119, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT2_3_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 121, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_3_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT2_3_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 123, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_3_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_VOR_ADAPT_3_WERT              I3_PID_SME_RB_ALTERUNG_KAPA, 125, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_3_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_NACH_ADAPT_3_WERT             I3_PID_SME_RB_ALTERUNG_KAPA, 127, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_3_WERT"
+#define I3_FLD_SME_STAT_OVC1_ZELLE1_3_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 129, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC1_ZELLE1_3_WERT"
+#define I3_FLD_SME_STAT_OVC2_ZELLE1_3_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 131, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC2_ZELLE1_3_WERT"
+#define I3_FLD_SME_STAT_SOH_GAIN_FAKTOR_ZELLE1_3_WERT            I3_PID_SME_RB_ALTERUNG_KAPA, 133, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_3_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_NACH_3_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 135, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_NACH_3_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 137, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_NACH_3_WERT                     I3_PID_SME_RB_ALTERUNG_KAPA, 139, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_3_WERT"
+#define I3_FLD_SME_STAT_SOH_ADAPT_COUNT_4_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 141, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_4_WERT"
+#define I3_FLD_SME_STAT_GRUND_ADAPTION_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 143, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_ADAPTION_4_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_ADAP_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 144, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_4_WERT"
+#define I3_FLD_SME_STAT_AH_CUM_ABS_4_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 148, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_4_WERT"
+#define I3_FLD_SME_STAT_AH_INTEGRAL_4_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 152, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_4_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_ADAP_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 156, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN1_4_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 158, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN1_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN2_4_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 159, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN2_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT1_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 160, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT1_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 162, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT1_4_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 164, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT2_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 166, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT2_4_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 168, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_4_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT2_4_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 170, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_4_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_VOR_ADAPT_4_WERT              I3_PID_SME_RB_ALTERUNG_KAPA, 172, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_4_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_NACH_ADAPT_4_WERT             I3_PID_SME_RB_ALTERUNG_KAPA, 174, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_4_WERT"
+#define I3_FLD_SME_STAT_OVC1_ZELLE1_4_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 176, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC1_ZELLE1_4_WERT"
+#define I3_FLD_SME_STAT_OVC2_ZELLE1_4_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 178, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC2_ZELLE1_4_WERT"
+#define I3_FLD_SME_STAT_SOH_GAIN_FAKTOR_ZELLE1_4_WERT            I3_PID_SME_RB_ALTERUNG_KAPA, 180, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_4_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_NACH_4_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 182, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_NACH_4_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 184, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_NACH_4_WERT                     I3_PID_SME_RB_ALTERUNG_KAPA, 186, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_4_WERT"
+#define I3_FLD_SME_STAT_SOH_ADAPT_COUNT_5_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 188, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SOH_ADAPT_COUNT_5_WERT"
+#define I3_FLD_SME_STAT_GRUND_ADAPTION_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 190, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_ADAPTION_5_WERT"
+#define I3_FLD_SME_STAT_ZEITPUNKT_ADAP_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 191, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITPUNKT_ADAP_5_WERT"
+#define I3_FLD_SME_STAT_AH_CUM_ABS_5_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 195, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_CUM_ABS_5_WERT"
+#define I3_FLD_SME_STAT_AH_INTEGRAL_5_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 199, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_AH_INTEGRAL_5_WERT"
+#define I3_FLD_SME_STAT_HVOFFTIME_ADAP_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 203, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HVOFFTIME_ADAP_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN1_5_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 205, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN1_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN2_5_WERT                        I3_PID_SME_RB_ALTERUNG_KAPA, 206, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN2_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT1_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 207, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT1_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT1_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 209, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT1_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT1_5_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 211, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT1_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MIN_INIT2_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 213, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MIN_INIT2_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MAX_INIT2_5_WERT                    I3_PID_SME_RB_ALTERUNG_KAPA, 215, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MAX_INIT2_5_WERT"
+#define I3_FLD_SME_STAT_UCEL_MEAN_INIT2_5_WERT                   I3_PID_SME_RB_ALTERUNG_KAPA, 217, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCEL_MEAN_INIT2_5_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_VOR_ADAPT_5_WERT              I3_PID_SME_RB_ALTERUNG_KAPA, 219, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_VOR_ADAPT_5_WERT"
+#define I3_FLD_SME_STAT_SOH_ZELLE1_NACH_ADAPT_5_WERT             I3_PID_SME_RB_ALTERUNG_KAPA, 221, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_ZELLE1_NACH_ADAPT_5_WERT"
+#define I3_FLD_SME_STAT_OVC1_ZELLE1_5_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 223, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC1_ZELLE1_5_WERT"
+#define I3_FLD_SME_STAT_OVC2_ZELLE1_5_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 225, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVC2_ZELLE1_5_WERT"
+#define I3_FLD_SME_STAT_SOH_GAIN_FAKTOR_ZELLE1_5_WERT            I3_PID_SME_RB_ALTERUNG_KAPA, 227, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_SOH_GAIN_FAKTOR_ZELLE1_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_NACH_5_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 229, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_NACH_5_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 231, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_NACH_5_WERT                     I3_PID_SME_RB_ALTERUNG_KAPA, 233, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_NACH_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MIN_VOR_5_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 235, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MIN_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MAX_VOR_5_WERT                       I3_PID_SME_RB_ALTERUNG_KAPA, 237, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MAX_VOR_5_WERT"
+#define I3_FLD_SME_STAT_SOH_MEAN_VOR_5_WERT                      I3_PID_SME_RB_ALTERUNG_KAPA, 239, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SOH_MEAN_VOR_5_WERT"
+
+// 0xD6CF I3_PID_SME_CSC_TEMPERATUREN
+#define I3_FLD_SME_STAT_MESSTEMP_CSC1_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 0, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC1_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC1_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 1, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC1_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC2_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC2_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC2_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC2_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC3_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC3_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC3_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC3_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC4_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 6, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC4_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC4_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 7, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC4_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC5_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 8, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC5_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC5_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 9, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC5_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC6_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 10, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC6_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC6_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 11, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC6_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC7_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 12, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC7_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC7_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 13, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC7_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC8_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 14, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC8_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC8_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 15, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC8_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC9_SENS1_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 16, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC9_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC9_SENS2_WERT                 I3_PID_SME_CSC_TEMPERATUREN, 17, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC9_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC10_SENS1_WERT                I3_PID_SME_CSC_TEMPERATUREN, 18, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC10_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC10_SENS2_WERT                I3_PID_SME_CSC_TEMPERATUREN, 19, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC10_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC11_SENS1_WERT                I3_PID_SME_CSC_TEMPERATUREN, 20, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC11_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC11_SENS2_WERT                I3_PID_SME_CSC_TEMPERATUREN, 21, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC11_SENS2_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC12_SENS1_WERT                I3_PID_SME_CSC_TEMPERATUREN, 22, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC12_SENS1_WERT"
+#define I3_FLD_SME_STAT_MESSTEMP_CSC12_SENS2_WERT                I3_PID_SME_CSC_TEMPERATUREN, 23, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_MESSTEMP_CSC12_SENS2_WERT"
+
+// 0xD6D1 I3_PID_SME_ISO_ERR_TRG_FZ1_2
+#define I3_FLD_SME_STAT_FEHLERZAEHLER_TRG_WERT                   I3_PID_SME_ISO_ERR_TRG_FZ1_2, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_FEHLERZAEHLER_TRG_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_01_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_01_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_02_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_02_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_03_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 7, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_03_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_04_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_04_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_05_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 10, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_05_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_06_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_06_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_07_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 13, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_07_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_08_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_08_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_09_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 16, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_09_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_10_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_10_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_11_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_11_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_12_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_12_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_13_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_13_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_14_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 24, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_14_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_15_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 25, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_15_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ1_16_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 27, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ1_16_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_01_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 28, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_01_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_02_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_02_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_03_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 31, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_03_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_04_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_04_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_05_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 34, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_05_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_06_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_06_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_07_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 37, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_07_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_08_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_08_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_09_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 40, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_09_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_10_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_10_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_11_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 43, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_11_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_12_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_12_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_13_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 46, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_13_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_14_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 48, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_14_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_15_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 49, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_15_WERT"
+#define I3_FLD_SME_STAT_INPUT_ISO_TRG_FZ2_16_WERT                I3_PID_SME_ISO_ERR_TRG_FZ1_2, 51, PID_FIELD_UINT8, 0.01f, 0.0f, "STAT_INPUT_ISO_TRG_FZ2_16_WERT"
+
+// 0xDD60 I3_PID_SME_SCHUETZ_SCHALTER
+#define I3_FLD_SME_STAT_SCHUETZ_SCHALTER                         I3_PID_SME_SCHUETZ_SCHALTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SCHUETZ_SCHALTER"
+
+// 0xDD63 I3_PID_SME_SCHUETZSCHALTUNGEN_ANZAHL
+#define I3_FLD_SME_STAT_ANZAHL_SCHALTUNGEN_WERT                  I3_PID_SME_SCHUETZSCHALTUNGEN_ANZAHL, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_SCHALTUNGEN_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_SCHALTUNGEN_LAST_WERT             I3_PID_SME_SCHUETZSCHALTUNGEN_ANZAHL, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_SCHALTUNGEN_LAST_WERT"
+
+// 0xDD64 I3_PID_SME_HVIL
+#define I3_FLD_SME_STAT_GUELTIG                                  I3_PID_SME_HVIL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GUELTIG"
+
+// 0xDD66 I3_PID_SME_HV_SPANNUNG
+#define I3_FLD_SME_STAT_HV_SPANNUNG_WERT                         I3_PID_SME_HV_SPANNUNG, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HV_SPANNUNG_WERT"
+
+// 0xDD67 I3_PID_SME_ANZAHL_KUEHLANFORDERUNG_DRINGEND
+#define I3_FLD_SME_STAT_ANZAHL_KUEHLANFORDERUNG_DRINGEND_WERT    I3_PID_SME_ANZAHL_KUEHLANFORDERUNG_DRINGEND, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_KUEHLANFORDERUNG_DRINGEND_WERT"
+
+// 0xDD68 I3_PID_SME_HV_SPANNUNG_BERECHNET
+#define I3_FLD_SME_STAT_HV_SPANNUNG_BERECHNET_WERT               I3_PID_SME_HV_SPANNUNG_BERECHNET, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HV_SPANNUNG_BERECHNET_WERT"
+
+// 0xDD69 I3_PID_SME_HV_STROM
+#define I3_FLD_SME_STAT_HV_STROM_WERT                            I3_PID_SME_HV_STROM, 0, PID_FIELD_SINT32, 0.01f, 0.0f, "STAT_HV_STROM_WERT"
+
+// 0xDD6A I3_PID_SME_ISOLATIONSWIDERSTAND
+#define I3_FLD_SME_STAT_ISOWIDERSTAND_EXT_TRG_WERT               I3_PID_SME_ISOLATIONSWIDERSTAND, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_TRG_WERT"
+#define I3_FLD_SME_STAT_ISOWIDERSTAND_EXT_STD_WERT               I3_PID_SME_ISOLATIONSWIDERSTAND, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_STD_WERT"
+#define I3_FLD_SME_STAT_ISOWIDERSTAND_INT_WERT                   I3_PID_SME_ISOLATIONSWIDERSTAND, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ISOWIDERSTAND_INT_WERT"
+#define I3_FLD_SME_STAT_ISOWIDERSTAND_EXT_TRG_PLAUS              I3_PID_SME_ISOLATIONSWIDERSTAND, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_TRG_PLAUS"
+#define I3_FLD_SME_STAT_ISOWIDERSTAND_EXT_STD_PLAUS              I3_PID_SME_ISOLATIONSWIDERSTAND, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ISOWIDERSTAND_EXT_STD_PLAUS"
+#define I3_FLD_SME_STAT_ISOWIDERSTAND_INT_PLAUS                  I3_PID_SME_ISOLATIONSWIDERSTAND, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ISOWIDERSTAND_INT_PLAUS"
+
+// 0xDD6C I3_PID_SME_KUEHLKREISLAUF_TEMP
+#define I3_FLD_SME_STAT_TEMP_KUEHLKREISLAUF_WERT                 I3_PID_SME_KUEHLKREISLAUF_TEMP, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_TEMP_KUEHLKREISLAUF_WERT"
+
+// 0xDD72 I3_PID_SME_AUFSTART_VERHINDERER
+#define I3_FLD_SME_STAT_AUFSTART_VERHINDERER                     I3_PID_SME_AUFSTART_VERHINDERER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_AUFSTART_VERHINDERER"
+
+// 0xDD73 I3_PID_SME_CUMULATIVE_LADUNG
+#define I3_FLD_SME_STAT_LADUNG_AMP_STUNDEN_WERT                  I3_PID_SME_CUMULATIVE_LADUNG, 0, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_LADUNG_AMP_STUNDEN_WERT"
+
+// 0xDD74 I3_PID_SME_CUMULATIVE_ENTLADUNG
+#define I3_FLD_SME_STAT_ENTLADUNG_AMP_STUNDEN_WERT               I3_PID_SME_CUMULATIVE_ENTLADUNG, 0, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_ENTLADUNG_AMP_STUNDEN_WERT"
+
+// 0xDD76 I3_PID_SME_STATUS_KL30C_SPANNUNG
+#define I3_FLD_SME_STAT_KL30C_SPANNUNG_WERT                      I3_PID_SME_STATUS_KL30C_SPANNUNG, 0, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_KL30C_SPANNUNG_WERT"
+
+// 0xDD7B I3_PID_SME_ALTERUNG_KAPAZITAET
+#define I3_FLD_SME_STAT_KAPAZITAET_WERT_0XDD7B                   I3_PID_SME_ALTERUNG_KAPAZITAET, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAPAZITAET_WERT_0XDD7B"
+
+// 0xDD7C I3_PID_SME_GW_INFO
+#define I3_FLD_SME_STAT_LEISTUNG_MAX_WERT                        I3_PID_SME_GW_INFO, 0, PID_FIELD_UINT16, 1000.0f, 0.0f, "STAT_LEISTUNG_MAX_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_1_WERT                   I3_PID_SME_GW_INFO, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_1_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_2_WERT                   I3_PID_SME_GW_INFO, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_2_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_3_WERT                   I3_PID_SME_GW_INFO, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_3_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_4_WERT                   I3_PID_SME_GW_INFO, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_4_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_5_WERT                   I3_PID_SME_GW_INFO, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_5_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_6_WERT                   I3_PID_SME_GW_INFO, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_6_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_DCHG_7_WERT                   I3_PID_SME_GW_INFO, 26, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_DCHG_7_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_1_WERT                    I3_PID_SME_GW_INFO, 30, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_1_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_2_WERT                    I3_PID_SME_GW_INFO, 34, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_2_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_3_WERT                    I3_PID_SME_GW_INFO, 38, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_3_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_4_WERT                    I3_PID_SME_GW_INFO, 42, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_4_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_5_WERT                    I3_PID_SME_GW_INFO, 46, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_5_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_6_WERT                    I3_PID_SME_GW_INFO, 50, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_6_WERT"
+#define I3_FLD_SME_STAT_ZEIT_POWER_CHG_7_WERT                    I3_PID_SME_GW_INFO, 54, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_POWER_CHG_7_WERT"
+#define I3_FLD_SME_STAT_UCELLMAX_EIN                             I3_PID_SME_GW_INFO, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_UCELLMAX_EIN"
+#define I3_FLD_SME_STAT_UCELLMIN_EIN                             I3_PID_SME_GW_INFO, 59, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_UCELLMIN_EIN"
+#define I3_FLD_SME_STAT_KM_STAND_WERT                            I3_PID_SME_GW_INFO, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_KM_STAND_WERT"
+#define I3_FLD_SME_STAT_IMAX_DCHG_WERT                           I3_PID_SME_GW_INFO, 64, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_IMAX_DCHG_WERT"
+#define I3_FLD_SME_STAT_IMAX_CHG_WERT                            I3_PID_SME_GW_INFO, 68, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_IMAX_CHG_WERT"
+#define I3_FLD_SME_STAT_IMAX_LAD_ERROR_EIN                       I3_PID_SME_GW_INFO, 72, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_IMAX_LAD_ERROR_EIN"
+#define I3_FLD_SME_STAT_TMAX_ERROR_OP_EIN                        I3_PID_SME_GW_INFO, 73, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TMAX_ERROR_OP_EIN"
+#define I3_FLD_SME_STAT_TMAX_ERROR_NO_OP_EIN                     I3_PID_SME_GW_INFO, 74, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TMAX_ERROR_NO_OP_EIN"
+#define I3_FLD_SME_STAT_TMIN_ERROR_OP_EIN                        I3_PID_SME_GW_INFO, 75, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TMIN_ERROR_OP_EIN"
+#define I3_FLD_SME_STAT_TMIN_ERROR_NO_OP_EIN                     I3_PID_SME_GW_INFO, 76, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TMIN_ERROR_NO_OP_EIN"
+#define I3_FLD_SME_STAT_CUMULATIVE_ENERGIE_LADUNG_WERT           I3_PID_SME_GW_INFO, 77, PID_FIELD_UINT32, 36.0f, 0.0f, "STAT_CUMULATIVE_ENERGIE_LADUNG_WERT"
+#define I3_FLD_SME_STAT_CUMULATIVE_ENERGIE_ENTLADUNG_WERT        I3_PID_SME_GW_INFO, 81, PID_FIELD_UINT32, 36.0f, 0.0f, "STAT_CUMULATIVE_ENERGIE_ENTLADUNG_WERT"
+
+// 0xDD7D I3_PID_SME_STROMGRENZEN
+#define I3_FLD_SME_STAT_LADESTROMGRENZE_WERT                     I3_PID_SME_STROMGRENZEN, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_LADESTROMGRENZE_WERT"
+#define I3_FLD_SME_STAT_ENTLADESTROMGRENZE_WERT                  I3_PID_SME_STROMGRENZEN, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_ENTLADESTROMGRENZE_WERT"
+
+// 0xDD7E I3_PID_SME_SPANNUNGSGRENZEN
+#define I3_FLD_SME_STAT_LADESPANNUNGSGRENZE_WERT                 I3_PID_SME_SPANNUNGSGRENZEN, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LADESPANNUNGSGRENZE_WERT"
+#define I3_FLD_SME_STAT_ENTLADESPANNUNGSGRENZE_WERT              I3_PID_SME_SPANNUNGSGRENZEN, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ENTLADESPANNUNGSGRENZE_WERT"
+
+// 0xDD8E I3_PID_SME_HVB_HISTORIE_ZYKLEN
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_1_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_1_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_2_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_2_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_3_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_3_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_4_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_4_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_5_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_5_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_6_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_6_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_7_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_7_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_8_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_8_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_9_WERT                 I3_PID_SME_HVB_HISTORIE_ZYKLEN, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_9_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_CHARGE_10_WERT                I3_PID_SME_HVB_HISTORIE_ZYKLEN, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_CHARGE_10_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_1_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_1_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_2_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_2_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_3_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_3_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_4_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_4_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_5_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_5_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_6_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_6_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_7_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 64, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_7_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_8_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_8_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_9_WERT              I3_PID_SME_HVB_HISTORIE_ZYKLEN, 72, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_9_WERT"
+#define I3_FLD_SME_STAT_SUM_OF_SOC_DISCHARGE_10_WERT             I3_PID_SME_HVB_HISTORIE_ZYKLEN, 76, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_SUM_OF_SOC_DISCHARGE_10_WERT"
+#define I3_FLD_SME_STAT_STROM_MAX_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 80, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_STROM_MAX_WERT"
+#define I3_FLD_SME_STAT_STROM_MIN_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 82, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_STROM_MIN_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_1_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 84, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_1_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_2_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 88, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_2_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_3_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 92, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_3_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_4_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 96, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_4_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_5_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 100, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_5_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_6_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 104, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_6_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_7_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 108, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_7_WERT"
+#define I3_FLD_SME_STAT_I_HISTO_8_WERT                           I3_PID_SME_HVB_HISTORIE_ZYKLEN, 112, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_I_HISTO_8_WERT"
+
+// 0xDD90 I3_PID_SME_ZEIT_TEMP_HISTOGRAMM
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_1_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_1_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_2_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_2_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_3_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_3_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_4_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_4_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_5_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_5_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_6_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_6_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_7_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_7_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_8_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_8_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_9_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_9_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_10_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_10_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_11_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_11_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_12_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_12_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_13_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_13_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_TOTAL_14_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_TOTAL_14_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_1_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_1_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_2_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 60, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_2_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_3_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 64, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_3_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_4_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 68, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_4_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_5_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 72, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_5_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_6_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 76, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_6_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_7_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 80, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_7_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_8_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 84, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_8_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_9_WERT                   I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 88, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_9_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_10_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 92, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_10_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_11_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 96, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_11_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_12_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 100, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_12_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_13_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 104, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_13_WERT"
+#define I3_FLD_SME_STAT_ZEIT_TEMP_NO_OP_14_WERT                  I3_PID_SME_ZEIT_TEMP_HISTOGRAMM, 108, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_TEMP_NO_OP_14_WERT"
+
+// 0xDD91 I3_PID_SME_ZEIT_SOC_KLASSE
+#define I3_FLD_SME_STAT_ZEIT_SOC_1_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_1_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_2_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_2_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_3_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_3_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_4_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_4_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_5_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_5_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_6_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_6_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_7_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_7_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_8_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_8_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_9_WERT                          I3_PID_SME_ZEIT_SOC_KLASSE, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_9_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_10_WERT                         I3_PID_SME_ZEIT_SOC_KLASSE, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_10_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_11_WERT                         I3_PID_SME_ZEIT_SOC_KLASSE, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_11_WERT"
+#define I3_FLD_SME_STAT_ZEIT_SOC_12_WERT                         I3_PID_SME_ZEIT_SOC_KLASSE, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEIT_SOC_12_WERT"
+
+// 0xDD94 I3_PID_SME_HV_BATT_HIST_SOC_T1_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T1_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T1_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T1_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T1_I10_WERT"
+
+// 0xDD95 I3_PID_SME_HV_BATT_HIST_SOC_T2_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T2_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T2_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T2_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T2_I10_WERT"
+
+// 0xDD96 I3_PID_SME_HV_BATT_HIST_SOC_T3_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T3_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T3_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T3_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T3_I10_WERT"
+
+// 0xDD97 I3_PID_SME_HV_BATT_HIST_SOC_T4_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T4_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T4_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T4_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T4_I10_WERT"
+
+// 0xDD98 I3_PID_SME_HV_BATT_HIST_SOC_T5_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T5_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T5_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T5_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T5_I10_WERT"
+
+// 0xDD99 I3_PID_SME_HV_BATT_HIST_SOC_T6_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T6_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T6_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T6_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T6_I10_WERT"
+
+// 0xDD9A I3_PID_SME_HV_BATT_HIST_SOC_T7_1
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC1_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC1_T7_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC2_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC2_T7_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC3_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC3_T7_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 120, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 124, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 128, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 132, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 136, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 140, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 144, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 148, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 152, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC4_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_1, 156, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC4_T7_I10_WERT"
+
+// 0xDDAB I3_PID_SME_LADEZIELSPANNUNG_TAUSCH
+#define I3_FLD_SME_STAT_LADEZIELSPANNUNG_WERT                    I3_PID_SME_LADEZIELSPANNUNG_TAUSCH, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_LADEZIELSPANNUNG_WERT"
+
+// 0xDDB4 I3_PID_SME_HV_SPANNUNG_BATTERIE
+#define I3_FLD_SME_STAT_HV_SPANNUNG_BATT_WERT                    I3_PID_SME_HV_SPANNUNG_BATTERIE, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_HV_SPANNUNG_BATT_WERT"
+
+// 0xDDB6 I3_PID_SME_ALTERUNG_INNENWIDERSTAND
+#define I3_FLD_SME_STAT_ALTERUNG_INNENWIDERSTAND_WERT_0XDDB6     I3_PID_SME_ALTERUNG_INNENWIDERSTAND, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_ALTERUNG_INNENWIDERSTAND_WERT_0XDDB6"
+
+// 0xDDBC I3_PID_SME_ANZEIGE_SOC
+#define I3_FLD_SME_STAT_ANZEIGE_SOC_WERT                         I3_PID_SME_ANZEIGE_SOC, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_ANZEIGE_SOC_WERT"
+#define I3_FLD_SME_STAT_MAXIMALE_ANZEIGE_SOC_WERT                I3_PID_SME_ANZEIGE_SOC, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_MAXIMALE_ANZEIGE_SOC_WERT"
+#define I3_FLD_SME_STAT_MINIMALE_ANZEIGE_SOC_WERT                I3_PID_SME_ANZEIGE_SOC, 4, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_MINIMALE_ANZEIGE_SOC_WERT"
+
+// 0xDDBD I3_PID_SME_SERVICE_DISCONNECT
+#define I3_FLD_SME_STAT_SERVICE_DISCONNECT                       I3_PID_SME_SERVICE_DISCONNECT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SERVICE_DISCONNECT"
+
+// 0xDDBE I3_PID_SME_VORLADUNG
+#define I3_FLD_SME_STAT_ZEIT_VORLADUNG_WERT                      I3_PID_SME_VORLADUNG, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_WERT"
+#define I3_FLD_SME_STAT_ZEIT_VORLADUNG_1_WERT                    I3_PID_SME_VORLADUNG, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_1_WERT"
+#define I3_FLD_SME_STAT_ZEIT_VORLADUNG_2_WERT                    I3_PID_SME_VORLADUNG, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_2_WERT"
+#define I3_FLD_SME_STAT_ZEIT_VORLADUNG_3_WERT                    I3_PID_SME_VORLADUNG, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_3_WERT"
+#define I3_FLD_SME_STAT_ZEIT_VORLADUNG_4_WERT                    I3_PID_SME_VORLADUNG, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ZEIT_VORLADUNG_4_WERT"
+#define I3_FLD_SME_STAT_MAX_STROM_VORLADUNG_WERT                 I3_PID_SME_VORLADUNG, 10, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_WERT"
+#define I3_FLD_SME_STAT_MAX_STROM_VORLADUNG_1_WERT               I3_PID_SME_VORLADUNG, 12, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_1_WERT"
+#define I3_FLD_SME_STAT_MAX_STROM_VORLADUNG_2_WERT               I3_PID_SME_VORLADUNG, 14, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_2_WERT"
+#define I3_FLD_SME_STAT_MAX_STROM_VORLADUNG_3_WERT               I3_PID_SME_VORLADUNG, 16, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_3_WERT"
+#define I3_FLD_SME_STAT_MAX_STROM_VORLADUNG_4_WERT               I3_PID_SME_VORLADUNG, 18, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MAX_STROM_VORLADUNG_4_WERT"
+
+// 0xDDBF I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX
+#define I3_FLD_SME_STAT_UCELL_MIN_WERT                           I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCELL_MIN_WERT"
+#define I3_FLD_SME_STAT_UCELL_MAX_WERT                           I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UCELL_MAX_WERT"
+
+// 0xDDC0 I3_PID_SME_TEMPERATUREN
+#define I3_FLD_SME_STAT_TCORE_MIN_WERT                           I3_PID_SME_TEMPERATUREN, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_TCORE_MIN_WERT"
+#define I3_FLD_SME_STAT_TCORE_MAX_WERT                           I3_PID_SME_TEMPERATUREN, 2, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_TCORE_MAX_WERT"
+#define I3_FLD_SME_STAT_TCORE_MEAN_WERT                          I3_PID_SME_TEMPERATUREN, 4, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_TCORE_MEAN_WERT"
+
+// 0xDDC2 I3_PID_SME_ALTERUNG_PARAMETER
+#define I3_FLD_SME_STAT_FAKTOR_RS_WERT                           I3_PID_SME_ALTERUNG_PARAMETER, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_FAKTOR_RS_WERT"
+#define I3_FLD_SME_STAT_FAKTOR_RP_WERT                           I3_PID_SME_ALTERUNG_PARAMETER, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_FAKTOR_RP_WERT"
+#define I3_FLD_SME_STAT_FAKTOR_CP_WERT                           I3_PID_SME_ALTERUNG_PARAMETER, 4, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_FAKTOR_CP_WERT"
+
+// 0xDDC6 I3_PID_SME_HISTO_SYM_DAUER
+#define I3_FLD_SME_STAT_SYM_DAUER_MAX_WERT                       I3_PID_SME_HISTO_SYM_DAUER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SYM_DAUER_MAX_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_1_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_1_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_2_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_2_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_3_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_3_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_4_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_4_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_5_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_5_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_6_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_6_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_7_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 26, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_7_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_DAUER_8_WERT                   I3_PID_SME_HISTO_SYM_DAUER, 30, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HISTO_SYM_DAUER_8_WERT"
+
+// 0xDDC7 I3_PID_SME_HISTO_SYM_ZELLANZAHL
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_1_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_1_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_2_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_2_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_3_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_3_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_4_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_4_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_5_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_5_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_6_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_6_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_7_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_7_WERT"
+#define I3_FLD_SME_STAT_HISTO_SYM_ZELLANZAHL_8_WERT              I3_PID_SME_HISTO_SYM_ZELLANZAHL, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HISTO_SYM_ZELLANZAHL_8_WERT"
+
+// 0xDDC8 I3_PID_SME_SYM_DELTASOC
+#define I3_FLD_SME_STAT_SYM_DELTASOC_1_WERT                      I3_PID_SME_SYM_DELTASOC, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SYM_DELTASOC_1_WERT"
+#define I3_FLD_SME_STAT_SYM_DELTASOC_2_WERT                      I3_PID_SME_SYM_DELTASOC, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SYM_DELTASOC_2_WERT"
+#define I3_FLD_SME_STAT_SYM_DELTASOC_3_WERT                      I3_PID_SME_SYM_DELTASOC, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SYM_DELTASOC_3_WERT"
+#define I3_FLD_SME_STAT_SYM_DELTASOC_4_WERT                      I3_PID_SME_SYM_DELTASOC, 6, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SYM_DELTASOC_4_WERT"
+#define I3_FLD_SME_STAT_SYM_DELTASOC_5_WERT                      I3_PID_SME_SYM_DELTASOC, 8, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_SYM_DELTASOC_5_WERT"
+
+// 0xDDC9 I3_PID_SME_MAX_SYM_DAUER
+#define I3_FLD_SME_STAT_MAX_SYM_DAUER_1_WERT                     I3_PID_SME_MAX_SYM_DAUER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_1_WERT"
+#define I3_FLD_SME_STAT_MAX_SYM_ZEIT_1_WERT                      I3_PID_SME_MAX_SYM_DAUER, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_1_WERT"
+#define I3_FLD_SME_STAT_BAL_COMPL_1_NR                           I3_PID_SME_MAX_SYM_DAUER, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BAL_COMPL_1_NR"
+#define I3_FLD_SME_STAT_MAX_SYM_DAUER_2_WERT                     I3_PID_SME_MAX_SYM_DAUER, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_2_WERT"
+#define I3_FLD_SME_STAT_MAX_SYM_ZEIT_2_WERT                      I3_PID_SME_MAX_SYM_DAUER, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_2_WERT"
+#define I3_FLD_SME_STAT_BAL_COMPL_2_NR                           I3_PID_SME_MAX_SYM_DAUER, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BAL_COMPL_2_NR"
+#define I3_FLD_SME_STAT_MAX_SYM_DAUER_3_WERT                     I3_PID_SME_MAX_SYM_DAUER, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_3_WERT"
+#define I3_FLD_SME_STAT_MAX_SYM_ZEIT_3_WERT                      I3_PID_SME_MAX_SYM_DAUER, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_3_WERT"
+#define I3_FLD_SME_STAT_BAL_COMPL_3_NR                           I3_PID_SME_MAX_SYM_DAUER, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BAL_COMPL_3_NR"
+#define I3_FLD_SME_STAT_MAX_SYM_DAUER_4_WERT                     I3_PID_SME_MAX_SYM_DAUER, 27, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_4_WERT"
+#define I3_FLD_SME_STAT_MAX_SYM_ZEIT_4_WERT                      I3_PID_SME_MAX_SYM_DAUER, 31, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_4_WERT"
+#define I3_FLD_SME_STAT_BAL_COMPL_4_NR                           I3_PID_SME_MAX_SYM_DAUER, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BAL_COMPL_4_NR"
+#define I3_FLD_SME_STAT_MAX_SYM_DAUER_5_WERT                     I3_PID_SME_MAX_SYM_DAUER, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_DAUER_5_WERT"
+#define I3_FLD_SME_STAT_MAX_SYM_ZEIT_5_WERT                      I3_PID_SME_MAX_SYM_DAUER, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_MAX_SYM_ZEIT_5_WERT"
+#define I3_FLD_SME_STAT_BAL_COMPL_5_NR                           I3_PID_SME_MAX_SYM_DAUER, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_BAL_COMPL_5_NR"
+
+// 0xDDCA I3_PID_SME_SERIENNUMMER_ECU
+
+// 0xDDCB I3_PID_SME_SOC_GRENZEN
+#define I3_FLD_SME_STAT_MIN_SOC_GRENZE_WERT                      I3_PID_SME_SOC_GRENZEN, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MIN_SOC_GRENZE_WERT"
+#define I3_FLD_SME_STAT_MAX_SOC_GRENZE_WERT                      I3_PID_SME_SOC_GRENZEN, 2, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_MAX_SOC_GRENZE_WERT"
+
+// 0xDDCF I3_PID_SME_DIFFERENZ_SPANNUNGEN
+#define I3_FLD_SME_STAT_DIFF_SPANNUNG_STATISCH_WERT              I3_PID_SME_DIFFERENZ_SPANNUNGEN, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_DIFF_SPANNUNG_STATISCH_WERT"
+
+// 0xDDE8 I3_PID_SME_ALTERUNG_KAPAZITAET_DEGRADATION
+#define I3_FLD_SME_STAT_ANZAHL_DEGRADATION_GESAMT_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_DEGRADATION, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_DEGRADATION_GESAMT_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_DEGRADATION_LAUFENDES_JAHR_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_DEGRADATION, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_DEGRADATION_LAUFENDES_JAHR_WERT"
+
+// 0xDDE9 I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB
+#define I3_FLD_SME_STAT_HFK_GESAMT_SOC_HUB_50_65_WERT            I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_50_65_WERT"
+#define I3_FLD_SME_STAT_HFK_GESAMT_SOC_HUB_65_80_WERT            I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_65_80_WERT"
+#define I3_FLD_SME_STAT_HFK_GESAMT_SOC_HUB_80_85_WERT            I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_80_85_WERT"
+#define I3_FLD_SME_STAT_HFK_GESAMT_SOC_HUB_85_90_WERT            I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_85_90_WERT"
+#define I3_FLD_SME_STAT_HFK_GESAMT_SOC_HUB_90_95_WERT            I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_90_95_WERT"
+#define I3_FLD_SME_STAT_HFK_GESAMT_SOC_HUB_95_100_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_GESAMT_SOC_HUB_95_100_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_JAHR_SOC_HUB_50_65_WERT    I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_50_65_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_JAHR_SOC_HUB_65_80_WERT    I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_65_80_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_JAHR_SOC_HUB_80_85_WERT    I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 16, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_80_85_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_JAHR_SOC_HUB_85_90_WERT    I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 18, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_85_90_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_JAHR_SOC_HUB_90_95_WERT    I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 20, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_90_95_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_JAHR_SOC_HUB_95_100_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 22, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_JAHR_SOC_HUB_95_100_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_MONAT_SOC_HUB_50_65_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 24, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_50_65_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_MONAT_SOC_HUB_65_80_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 26, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_65_80_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_MONAT_SOC_HUB_80_85_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 28, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_80_85_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_MONAT_SOC_HUB_85_90_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 30, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_85_90_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_MONAT_SOC_HUB_90_95_WERT   I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 32, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_90_95_WERT"
+#define I3_FLD_SME_STAT_HFK_LAUFENDES_MONAT_SOC_HUB_95_100_WERT  I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 34, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HFK_LAUFENDES_MONAT_SOC_HUB_95_100_WERT"
+#define I3_FLD_SME_STAT_ZEITSTEMPEL_SOC_HUB_50_65_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_50_65_WERT"
+#define I3_FLD_SME_STAT_ZEITSTEMPEL_SOC_HUB_65_80_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_65_80_WERT"
+#define I3_FLD_SME_STAT_ZEITSTEMPEL_SOC_HUB_80_85_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_80_85_WERT"
+#define I3_FLD_SME_STAT_ZEITSTEMPEL_SOC_HUB_85_90_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_85_90_WERT"
+#define I3_FLD_SME_STAT_ZEITSTEMPEL_SOC_HUB_90_95_WERT           I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_90_95_WERT"
+#define I3_FLD_SME_STAT_ZEITSTEMPEL_SOC_HUB_95_100_WERT          I3_PID_SME_ALTERUNG_KAPAZITAET_HISTOGRAMM_SOC_HUB, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ZEITSTEMPEL_SOC_HUB_95_100_WERT"
+
+// 0xDDEB I3_PID_SME_RINGPUFFER_LADEVORGAENGE
+#define I3_FLD_SME_STAT_START_SOC_1_WERT                         I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_START_SOC_1_WERT"
+#define I3_FLD_SME_STAT_START_SOC_2_WERT                         I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_START_SOC_2_WERT"
+#define I3_FLD_SME_STAT_START_SOC_3_WERT                         I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_START_SOC_3_WERT"
+#define I3_FLD_SME_STAT_START_SOC_4_WERT                         I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_START_SOC_4_WERT"
+#define I3_FLD_SME_STAT_START_SOC_5_WERT                         I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_START_SOC_5_WERT"
+#define I3_FLD_SME_STAT_VERF_P_LADEN_1_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERF_P_LADEN_1_WERT"
+#define I3_FLD_SME_STAT_VERF_P_LADEN_2_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERF_P_LADEN_2_WERT"
+#define I3_FLD_SME_STAT_VERF_P_LADEN_3_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERF_P_LADEN_3_WERT"
+#define I3_FLD_SME_STAT_VERF_P_LADEN_4_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERF_P_LADEN_4_WERT"
+#define I3_FLD_SME_STAT_VERF_P_LADEN_5_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERF_P_LADEN_5_WERT"
+#define I3_FLD_SME_STAT_REAL_END_SOC_1_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAL_END_SOC_1_WERT"
+#define I3_FLD_SME_STAT_REAL_END_SOC_2_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAL_END_SOC_2_WERT"
+#define I3_FLD_SME_STAT_REAL_END_SOC_3_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAL_END_SOC_3_WERT"
+#define I3_FLD_SME_STAT_REAL_END_SOC_4_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAL_END_SOC_4_WERT"
+#define I3_FLD_SME_STAT_REAL_END_SOC_5_WERT                      I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_REAL_END_SOC_5_WERT"
+#define I3_FLD_SME_STAT_GRUND_LADEENDE_WERT_1                    I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_1"
+#define I3_FLD_SME_STAT_GRUND_LADEENDE_WERT_2                    I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_2"
+#define I3_FLD_SME_STAT_GRUND_LADEENDE_WERT_3                    I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_3"
+#define I3_FLD_SME_STAT_GRUND_LADEENDE_WERT_4                    I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_4"
+#define I3_FLD_SME_STAT_GRUND_LADEENDE_WERT_5                    I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_GRUND_LADEENDE_WERT_5"
+#define I3_FLD_SME_STAT_START_TEMP_1_WERT                        I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 20, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_START_TEMP_1_WERT"
+#define I3_FLD_SME_STAT_START_TEMP_2_WERT                        I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 21, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_START_TEMP_2_WERT"
+#define I3_FLD_SME_STAT_START_TEMP_3_WERT                        I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 22, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_START_TEMP_3_WERT"
+#define I3_FLD_SME_STAT_START_TEMP_4_WERT                        I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 23, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_START_TEMP_4_WERT"
+#define I3_FLD_SME_STAT_START_TEMP_5_WERT                        I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 24, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_START_TEMP_5_WERT"
+#define I3_FLD_SME_STAT_END_TEMP_1_WERT                          I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 25, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_END_TEMP_1_WERT"
+#define I3_FLD_SME_STAT_END_TEMP_2_WERT                          I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 26, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_END_TEMP_2_WERT"
+#define I3_FLD_SME_STAT_END_TEMP_3_WERT                          I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 27, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_END_TEMP_3_WERT"
+#define I3_FLD_SME_STAT_END_TEMP_4_WERT                          I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 28, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_END_TEMP_4_WERT"
+#define I3_FLD_SME_STAT_END_TEMP_5_WERT                          I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 29, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_END_TEMP_5_WERT"
+#define I3_FLD_SME_STAT_BEGINN_PROG_LADEZEIT_1_WERT              I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 30, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_1_WERT"
+#define I3_FLD_SME_STAT_BEGINN_PROG_LADEZEIT_2_WERT              I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 31, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_2_WERT"
+#define I3_FLD_SME_STAT_BEGINN_PROG_LADEZEIT_3_WERT              I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 32, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_3_WERT"
+#define I3_FLD_SME_STAT_BEGINN_PROG_LADEZEIT_4_WERT              I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 33, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_4_WERT"
+#define I3_FLD_SME_STAT_BEGINN_PROG_LADEZEIT_5_WERT              I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 34, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_BEGINN_PROG_LADEZEIT_5_WERT"
+#define I3_FLD_SME_STAT_REAL_LADEZEIT_1_WERT                     I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 35, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_REAL_LADEZEIT_1_WERT"
+#define I3_FLD_SME_STAT_REAL_LADEZEIT_2_WERT                     I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 36, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_REAL_LADEZEIT_2_WERT"
+#define I3_FLD_SME_STAT_REAL_LADEZEIT_3_WERT                     I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 37, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_REAL_LADEZEIT_3_WERT"
+#define I3_FLD_SME_STAT_REAL_LADEZEIT_4_WERT                     I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 38, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_REAL_LADEZEIT_4_WERT"
+#define I3_FLD_SME_STAT_REAL_LADEZEIT_5_WERT                     I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 39, PID_FIELD_UINT8, 5.0f, 0.0f, "STAT_REAL_LADEZEIT_5_WERT"
+#define I3_FLD_SME_STAT_RELATIVZEIT_1_WERT                       I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RELATIVZEIT_1_WERT"
+#define I3_FLD_SME_STAT_RELATIVZEIT_2_WERT                       I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RELATIVZEIT_2_WERT"
+#define I3_FLD_SME_STAT_RELATIVZEIT_3_WERT                       I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 48, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RELATIVZEIT_3_WERT"
+#define I3_FLD_SME_STAT_RELATIVZEIT_4_WERT                       I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 52, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RELATIVZEIT_4_WERT"
+#define I3_FLD_SME_STAT_RELATIVZEIT_5_WERT                       I3_PID_SME_RINGPUFFER_LADEVORGAENGE, 56, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RELATIVZEIT_5_WERT"
+
+// 0xDDEC I3_PID_SME_HIS_PROG_LADEZEIT
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_1_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_1_WERT"
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_2_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_2_WERT"
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_3_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_3_WERT"
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_4_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_4_WERT"
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_5_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_5_WERT"
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_6_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_6_WERT"
+#define I3_FLD_SME_STAT_HIS_PROG_LADEZEIT_7_WERT                 I3_PID_SME_HIS_PROG_LADEZEIT, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_PROG_LADEZEIT_7_WERT"
+
+// 0xDDEF I3_PID_SME_HV_SPANNUNG_QUER
+#define I3_FLD_SME_STAT_HV_SPANNUNG_QUER_WERT                    I3_PID_SME_HV_SPANNUNG_QUER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HV_SPANNUNG_QUER_WERT"
+
+// 0xDE37 I3_PID_SME_ALPHA_INITIAL_ALTERUNG
+#define I3_FLD_SME_STAT_ALPHA_INIT_ALTERUNG_WERT                 I3_PID_SME_ALPHA_INITIAL_ALTERUNG, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_ALPHA_INIT_ALTERUNG_WERT"
+
+// 0xDF60 I3_PID_SME_BETRIEBSSTUNDEN
+#define I3_FLD_SME_STAT_TIME_HV_ON_WERT                          I3_PID_SME_BETRIEBSSTUNDEN, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TIME_HV_ON_WERT"
+#define I3_FLD_SME_STAT_TIME_TOTAL_WERT                          I3_PID_SME_BETRIEBSSTUNDEN, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TIME_TOTAL_WERT"
+
+// 0xDF62 I3_PID_SME_COOL_DOWN
+#define I3_FLD_SME_STAT_ANZAHL_KUEHLVORGAENGE_WERT               I3_PID_SME_COOL_DOWN, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_KUEHLVORGAENGE_WERT"
+
+// 0xDF63 I3_PID_SME_KLEMMENZYKLEN
+#define I3_FLD_SME_STAT_ANZAHL_KLEMMENZYKLEN_WERT                I3_PID_SME_KLEMMENZYKLEN, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_KLEMMENZYKLEN_WERT"
+
+// 0xDF64 I3_PID_SME_KUEHLDAUER
+#define I3_FLD_SME_STAT_KUEHLDAUER_MAX_WERT_0XDF64               I3_PID_SME_KUEHLDAUER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_MAX_WERT_0XDF64"
+#define I3_FLD_SME_STAT_KUEHLDAUER_1_WERT_0XDF64                 I3_PID_SME_KUEHLDAUER, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_1_WERT_0XDF64"
+#define I3_FLD_SME_STAT_KUEHLDAUER_2_WERT_0XDF64                 I3_PID_SME_KUEHLDAUER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_2_WERT_0XDF64"
+#define I3_FLD_SME_STAT_KUEHLDAUER_3_WERT_0XDF64                 I3_PID_SME_KUEHLDAUER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_3_WERT_0XDF64"
+#define I3_FLD_SME_STAT_KUEHLDAUER_4_WERT_0XDF64                 I3_PID_SME_KUEHLDAUER, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_KUEHLDAUER_4_WERT_0XDF64"
+
+// 0xDF65 I3_PID_SME_TEMP_SPREIZUNG_SYSTEM
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_MAX_WERT                  I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_TEMP_SPREIZUNG_MAX_WERT"
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_SYS_1_WERT                I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_SYS_2_WERT                I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_SYS_3_WERT                I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_SYS_4_WERT                I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_SYS_5_WERT                I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_SPREIZUNG_SYS_6_WERT                I3_PID_SME_TEMP_SPREIZUNG_SYSTEM, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_SPREIZUNG_SYS_6_WERT"
+
+// 0xDF66 I3_PID_SME_TEMP_KUEHLMITTEL
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_MAX_WERT                I3_PID_SME_TEMP_KUEHLMITTEL, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_TEMP_KUEHLMITTEL_MAX_WERT"
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_1_WERT                  I3_PID_SME_TEMP_KUEHLMITTEL, 2, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_2_WERT                  I3_PID_SME_TEMP_KUEHLMITTEL, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_3_WERT                  I3_PID_SME_TEMP_KUEHLMITTEL, 10, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_4_WERT                  I3_PID_SME_TEMP_KUEHLMITTEL, 14, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_4_WERT"
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_5_WERT                  I3_PID_SME_TEMP_KUEHLMITTEL, 18, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_5_WERT"
+#define I3_FLD_SME_STAT_TEMP_KUEHLMITTEL_6_WERT                  I3_PID_SME_TEMP_KUEHLMITTEL, 22, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TEMP_KUEHLMITTEL_6_WERT"
+
+// 0xDF67 I3_PID_SME_LADUNG_KUEHLUNG
+#define I3_FLD_SME_STAT_LADUNG_KUEHLUNG_WERT                     I3_PID_SME_LADUNG_KUEHLUNG, 0, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_LADUNG_KUEHLUNG_WERT"
+#define I3_FLD_SME_STAT_ENTLADUNG_KUEHLUNG_WERT                  I3_PID_SME_LADUNG_KUEHLUNG, 4, PID_FIELD_UINT32, 0.000277777778f, 0.0f, "STAT_ENTLADUNG_KUEHLUNG_WERT"
+
+// 0xDF68 I3_PID_SME_HV_BATT_HIST_SOC_T1_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T1_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T1_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T1_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T1_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T1_I10_WERT"
+
+// 0xDF69 I3_PID_SME_HV_BATT_HIST_SOC_T4_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T4_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T4_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T4_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T4_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T4_I10_WERT"
+
+// 0xDF6A I3_PID_SME_HV_BATT_HIST_SOC_T3_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T3_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T3_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T3_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T3_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T3_I10_WERT"
+
+// 0xDF6B I3_PID_SME_HV_BATT_HIST_SOC_T5_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T5_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T5_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T5_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T5_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T5_I10_WERT"
+
+// 0xDF6C I3_PID_SME_HV_BATT_HIST_SOC_T2_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T2_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T2_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T2_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T2_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T2_I10_WERT"
+
+// 0xDF6D I3_PID_SME_HV_BATT_HIST_SOC_T7_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T7_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T7_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T7_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T7_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T7_I10_WERT"
+
+// 0xDF6E I3_PID_SME_HV_BATT_HIST_SOC_T6_2
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 0, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 16, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 20, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 24, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 28, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 32, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC5_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 36, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC5_T6_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 40, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 44, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 48, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 52, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 56, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 60, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 64, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 68, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 72, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC6_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 76, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC6_T6_I10_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I1_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 80, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I1_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I2_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 84, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I2_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I3_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 88, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I3_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I4_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 92, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I4_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I5_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 96, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I5_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I6_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 100, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I6_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I7_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 104, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I7_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I8_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 108, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I8_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I9_WERT             I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 112, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I9_WERT"
+#define I3_FLD_SME_STAT_HV_BATT_HIST_SOC7_T6_I10_WERT            I3_PID_SME_HV_BATT_HIST_SOC_T6_2, 116, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_HV_BATT_HIST_SOC7_T6_I10_WERT"
+
+// 0xDF6F I3_PID_SME_HIS_ERR_LIM_STROM
+#define I3_FLD_SME_STAT_CHA_CURR_ERR_INT_LIM_WERT                I3_PID_SME_HIS_ERR_LIM_STROM, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_WERT"
+#define I3_FLD_SME_STAT_DCH_CURR_ERR_INT_LIM_WERT                I3_PID_SME_HIS_ERR_LIM_STROM, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_1_WERT             I3_PID_SME_HIS_ERR_LIM_STROM, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_2_WERT             I3_PID_SME_HIS_ERR_LIM_STROM, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_1_WERT             I3_PID_SME_HIS_ERR_LIM_STROM, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_2_WERT             I3_PID_SME_HIS_ERR_LIM_STROM, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_WERT"
+
+// 0xDF70 I3_PID_SME_HIS_EFF_STROM
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_100_PERC_WERT           I3_PID_SME_HIS_EFF_STROM, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_WERT"
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_3_PERC_WERT             I3_PID_SME_HIS_EFF_STROM, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_100_PERC_WERT           I3_PID_SME_HIS_EFF_STROM, 8, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_3_PERC_WERT             I3_PID_SME_HIS_EFF_STROM, 12, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_1_WERT                  I3_PID_SME_HIS_EFF_STROM, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_2_WERT                  I3_PID_SME_HIS_EFF_STROM, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_3_WERT                  I3_PID_SME_HIS_EFF_STROM, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_4_WERT                  I3_PID_SME_HIS_EFF_STROM, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_1_WERT                  I3_PID_SME_HIS_EFF_STROM, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_2_WERT                  I3_PID_SME_HIS_EFF_STROM, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_3_WERT                  I3_PID_SME_HIS_EFF_STROM, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_4_WERT                  I3_PID_SME_HIS_EFF_STROM, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_WERT"
+
+// 0xDF71 I3_PID_SME_PROJEKT_PARAMETER
+#define I3_FLD_SME_STAT_ANZAHL_ZELLEN_INSGESAMT_WERT             I3_PID_SME_PROJEKT_PARAMETER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_ZELLEN_INSGESAMT_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT             I3_PID_SME_PROJEKT_PARAMETER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_MODULE_WERT                       I3_PID_SME_PROJEKT_PARAMETER, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_MODULE_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT I3_PID_SME_PROJEKT_PARAMETER, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT"
+
+// 0xDF72 I3_PID_SME_KURZSCHLUESSE
+#define I3_FLD_SME_STAT_ANZAHL_KURZSCHLUESSE_WERT                I3_PID_SME_KURZSCHLUESSE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_KURZSCHLUESSE_WERT"
+
+// 0xDF73 I3_PID_SME_HEIZUNG_VERBAUT
+#define I3_FLD_SME_STAT_HEIZUNG_VERBAUT                          I3_PID_SME_HEIZUNG_VERBAUT, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HEIZUNG_VERBAUT"
+
+// 0xDF74 I3_PID_SME_VOKO_HEIZ_DAUER
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_MAX_WERT                 I3_PID_SME_VOKO_HEIZ_DAUER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_MAX_WERT"
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_1_WERT                   I3_PID_SME_VOKO_HEIZ_DAUER, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_1_WERT"
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_2_WERT                   I3_PID_SME_VOKO_HEIZ_DAUER, 5, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_2_WERT"
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_3_WERT                   I3_PID_SME_VOKO_HEIZ_DAUER, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_3_WERT"
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_4_WERT                   I3_PID_SME_VOKO_HEIZ_DAUER, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_4_WERT"
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_5_WERT                   I3_PID_SME_VOKO_HEIZ_DAUER, 17, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_5_WERT"
+#define I3_FLD_SME_STAT_VOKO_HEIZ_DAUER_6_WERT                   I3_PID_SME_VOKO_HEIZ_DAUER, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_HEIZ_DAUER_6_WERT"
+
+// 0xDF75 I3_PID_SME_LADE_KOND_HEIZ_DAUER
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_MAX_WERT            I3_PID_SME_LADE_KOND_HEIZ_DAUER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_MAX_WERT"
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_1_WERT              I3_PID_SME_LADE_KOND_HEIZ_DAUER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_1_WERT"
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_2_WERT              I3_PID_SME_LADE_KOND_HEIZ_DAUER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_2_WERT"
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_3_WERT              I3_PID_SME_LADE_KOND_HEIZ_DAUER, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_3_WERT"
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_4_WERT              I3_PID_SME_LADE_KOND_HEIZ_DAUER, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_4_WERT"
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_5_WERT              I3_PID_SME_LADE_KOND_HEIZ_DAUER, 12, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_5_WERT"
+#define I3_FLD_SME_STAT_LADE_KOND_HEIZ_DAUER_6_WERT              I3_PID_SME_LADE_KOND_HEIZ_DAUER, 14, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADE_KOND_HEIZ_DAUER_6_WERT"
+
+// 0xDF76 I3_PID_SME_VOKO_KUEHL_DAUER
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_MAX_WERT                I3_PID_SME_VOKO_KUEHL_DAUER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_MAX_WERT"
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_1_WERT                  I3_PID_SME_VOKO_KUEHL_DAUER, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_1_WERT"
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_2_WERT                  I3_PID_SME_VOKO_KUEHL_DAUER, 5, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_2_WERT"
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_3_WERT                  I3_PID_SME_VOKO_KUEHL_DAUER, 9, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_3_WERT"
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_4_WERT                  I3_PID_SME_VOKO_KUEHL_DAUER, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_4_WERT"
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_5_WERT                  I3_PID_SME_VOKO_KUEHL_DAUER, 17, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_5_WERT"
+#define I3_FLD_SME_STAT_VOKO_KUEHL_DAUER_6_WERT                  I3_PID_SME_VOKO_KUEHL_DAUER, 21, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_VOKO_KUEHL_DAUER_6_WERT"
+
+// 0xDF77 I3_PID_SME_LADE_DAUER
+#define I3_FLD_SME_STAT_LADE_DAUER_MAX_WERT                      I3_PID_SME_LADE_DAUER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_LADE_DAUER_MAX_WERT"
+#define I3_FLD_SME_STAT_LADEDAUER_1_WERT                         I3_PID_SME_LADE_DAUER, 1, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_1_WERT"
+#define I3_FLD_SME_STAT_LADEDAUER_2_WERT                         I3_PID_SME_LADE_DAUER, 3, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_2_WERT"
+#define I3_FLD_SME_STAT_LADEDAUER_3_WERT                         I3_PID_SME_LADE_DAUER, 5, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_3_WERT"
+#define I3_FLD_SME_STAT_LADEDAUER_4_WERT                         I3_PID_SME_LADE_DAUER, 7, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_4_WERT"
+#define I3_FLD_SME_STAT_LADEDAUER_5_WERT                         I3_PID_SME_LADE_DAUER, 9, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_5_WERT"
+#define I3_FLD_SME_STAT_LADEDAUER_6_WERT                         I3_PID_SME_LADE_DAUER, 11, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LADEDAUER_6_WERT"
+
+// 0xDF81 I3_PID_SME_HIS_SOC_WARN_GRENZEN
+#define I3_FLD_SME_STAT_SOC_LOW_I_ZERO_WERT                      I3_PID_SME_HIS_SOC_WARN_GRENZEN, 0, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_SOC_LOW_I_ZERO_WERT"
+#define I3_FLD_SME_STAT_SOC_LOW_WARN_WERT                        I3_PID_SME_HIS_SOC_WARN_GRENZEN, 2, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_SOC_LOW_WARN_WERT"
+#define I3_FLD_SME_STAT_SOC_HIGH_I_ZERO_WERT                     I3_PID_SME_HIS_SOC_WARN_GRENZEN, 4, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_SOC_HIGH_I_ZERO_WERT"
+#define I3_FLD_SME_STAT_SOC_HIGH_WARN_WERT                       I3_PID_SME_HIS_SOC_WARN_GRENZEN, 6, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_SOC_HIGH_WARN_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_WARN_GRENZEN_1_WERT              I3_PID_SME_HIS_SOC_WARN_GRENZEN, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_1_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_WARN_GRENZEN_2_WERT              I3_PID_SME_HIS_SOC_WARN_GRENZEN, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_2_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_WARN_GRENZEN_3_WERT              I3_PID_SME_HIS_SOC_WARN_GRENZEN, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_3_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_WARN_GRENZEN_4_WERT              I3_PID_SME_HIS_SOC_WARN_GRENZEN, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_4_WERT"
+#define I3_FLD_SME_STAT_HIS_SOC_WARN_GRENZEN_5_WERT              I3_PID_SME_HIS_SOC_WARN_GRENZEN, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_SOC_WARN_GRENZEN_5_WERT"
+
+// 0xDF83 I3_PID_SME_ID_SBOX
+#define I3_FLD_SME_STAT_ID_SER_NR_WERT                           I3_PID_SME_ID_SBOX, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ID_SER_NR_WERT"
+#define I3_FLD_SME_STAT_ID_MV_HW_WERT                            I3_PID_SME_ID_SBOX, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ID_MV_HW_WERT"
+#define I3_FLD_SME_STAT_ID_MV_SW_WERT                            I3_PID_SME_ID_SBOX, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ID_MV_SW_WERT"
+#define I3_FLD_SME_STAT_ID_SV_SW_WERT                            I3_PID_SME_ID_SBOX, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ID_SV_SW_WERT"
+#define I3_FLD_SME_STAT_ID_VAR_WERT                              I3_PID_SME_ID_SBOX, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ID_VAR_WERT"
+
+// 0xDF86 I3_PID_SME_SOC_HISTORIE
+#define I3_FLD_SME_STAT_SOC_DAY_1_WERT                           I3_PID_SME_SOC_HISTORIE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_1_WERT"
+#define I3_FLD_SME_STAT_SOC_DAY_2_WERT                           I3_PID_SME_SOC_HISTORIE, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_2_WERT"
+#define I3_FLD_SME_STAT_SOC_DAY_3_WERT                           I3_PID_SME_SOC_HISTORIE, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_3_WERT"
+#define I3_FLD_SME_STAT_SOC_DAY_4_WERT                           I3_PID_SME_SOC_HISTORIE, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_4_WERT"
+#define I3_FLD_SME_STAT_SOC_DAY_5_WERT                           I3_PID_SME_SOC_HISTORIE, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_5_WERT"
+#define I3_FLD_SME_STAT_SOC_DAY_6_WERT                           I3_PID_SME_SOC_HISTORIE, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_6_WERT"
+#define I3_FLD_SME_STAT_SOC_DAY_7_WERT                           I3_PID_SME_SOC_HISTORIE, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_DAY_7_WERT"
+#define I3_FLD_SME_STAT_SOC_WEEK_2_WERT                          I3_PID_SME_SOC_HISTORIE, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_WEEK_2_WERT"
+#define I3_FLD_SME_STAT_SOC_WEEK_3_WERT                          I3_PID_SME_SOC_HISTORIE, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_WEEK_3_WERT"
+#define I3_FLD_SME_STAT_SOC_WEEK_4_WERT                          I3_PID_SME_SOC_HISTORIE, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_WEEK_4_WERT"
+#define I3_FLD_SME_STAT_LAST_HV_ON_WERT                          I3_PID_SME_SOC_HISTORIE, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_LAST_HV_ON_WERT"
+#define I3_FLD_SME_STAT_SOC_LAST_DRIVE_CYCLE_WERT                I3_PID_SME_SOC_HISTORIE, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_LAST_DRIVE_CYCLE_WERT"
+#define I3_FLD_SME_STAT_TIME_STAMP_LAST_CHG_END_WERT             I3_PID_SME_SOC_HISTORIE, 13, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TIME_STAMP_LAST_CHG_END_WERT"
+
+// 0xDF89 I3_PID_SME_KL30C
+#define I3_FLD_SME_STAT_KL30C                                    I3_PID_SME_KL30C, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KL30C"
+
+// 0xDF8A I3_PID_SME_HIS_EFF_STROM_TMIN
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_100_PERC_TMIN_WERT      I3_PID_SME_HIS_EFF_STROM_TMIN, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TMIN_WERT"
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_3_PERC_TMIN_WERT        I3_PID_SME_HIS_EFF_STROM_TMIN, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TMIN_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_100_PERC_TMIN_WERT      I3_PID_SME_HIS_EFF_STROM_TMIN, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TMIN_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_3_PERC_TMIN_WERT        I3_PID_SME_HIS_EFF_STROM_TMIN, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_1_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_2_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_3_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_4_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_1_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_2_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_3_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_4_TMIN_WERT             I3_PID_SME_HIS_EFF_STROM_TMIN, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TMIN_WERT"
+
+// 0xDF8B I3_PID_SME_HIS_EFF_STROM_TLOW
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_100_PERC_TLOW_WERT      I3_PID_SME_HIS_EFF_STROM_TLOW, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TLOW_WERT"
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_3_PERC_TLOW_WERT        I3_PID_SME_HIS_EFF_STROM_TLOW, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TLOW_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_100_PERC_TLOW_WERT      I3_PID_SME_HIS_EFF_STROM_TLOW, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TLOW_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_3_PERC_TLOW_WERT        I3_PID_SME_HIS_EFF_STROM_TLOW, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_1_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_2_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_3_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_4_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_1_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_2_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_3_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_4_TLOW_WERT             I3_PID_SME_HIS_EFF_STROM_TLOW, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TLOW_WERT"
+
+// 0xDF8C I3_PID_SME_HIS_EFF_STROM_TMID
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_100_PERC_TMID_WERT      I3_PID_SME_HIS_EFF_STROM_TMID, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TMID_WERT"
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_3_PERC_TMID_WERT        I3_PID_SME_HIS_EFF_STROM_TMID, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TMID_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_100_PERC_TMID_WERT      I3_PID_SME_HIS_EFF_STROM_TMID, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TMID_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_3_PERC_TMID_WERT        I3_PID_SME_HIS_EFF_STROM_TMID, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_1_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_2_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_3_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_4_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_1_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_2_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_3_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TMID_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_4_TMID_WERT             I3_PID_SME_HIS_EFF_STROM_TMID, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TMID_WERT"
+
+// 0xDF8D I3_PID_SME_HIS_EFF_STROM_THIGH
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_100_PERC_THIGH_WERT     I3_PID_SME_HIS_EFF_STROM_THIGH, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_THIGH_WERT"
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_3_PERC_THIGH_WERT       I3_PID_SME_HIS_EFF_STROM_THIGH, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_THIGH_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_100_PERC_THIGH_WERT     I3_PID_SME_HIS_EFF_STROM_THIGH, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_THIGH_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_3_PERC_THIGH_WERT       I3_PID_SME_HIS_EFF_STROM_THIGH, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_1_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_2_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_3_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_4_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_1_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_2_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_3_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_4_THIGH_WERT            I3_PID_SME_HIS_EFF_STROM_THIGH, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_THIGH_WERT"
+
+// 0xDF8E I3_PID_SME_HIS_EFF_STROM_TMAX
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_100_PERC_TMAX_WERT      I3_PID_SME_HIS_EFF_STROM_TMAX, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_100_PERC_TMAX_WERT"
+#define I3_FLD_SME_STAT_CHA_EFF_CURR_LIM_3_PERC_TMAX_WERT        I3_PID_SME_HIS_EFF_STROM_TMAX, 4, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CHA_EFF_CURR_LIM_3_PERC_TMAX_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_100_PERC_TMAX_WERT      I3_PID_SME_HIS_EFF_STROM_TMAX, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_100_PERC_TMAX_WERT"
+#define I3_FLD_SME_STAT_ABS_EFF_CURR_LIM_3_PERC_TMAX_WERT        I3_PID_SME_HIS_EFF_STROM_TMAX, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ABS_EFF_CURR_LIM_3_PERC_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_1_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_1_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_2_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_2_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_3_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_3_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_CHG_4_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 28, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_CHG_4_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_1_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 32, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_1_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_2_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 36, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_2_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_3_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 40, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_3_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_EFF_CURR_ABS_4_TMAX_WERT             I3_PID_SME_HIS_EFF_STROM_TMAX, 44, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_EFF_CURR_ABS_4_TMAX_WERT"
+
+// 0xDF8F I3_PID_SME_HIS_ERR_LIM_STROM_TMIN
+#define I3_FLD_SME_STAT_CHA_CURR_ERR_INT_LIM_TMIN_WERT           I3_PID_SME_HIS_ERR_LIM_STROM_TMIN, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_TMIN_WERT"
+#define I3_FLD_SME_STAT_DCH_CURR_ERR_INT_LIM_TMIN_WERT           I3_PID_SME_HIS_ERR_LIM_STROM_TMIN, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_1_TMIN_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMIN, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_2_TMIN_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMIN, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_1_TMIN_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMIN, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_TMIN_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_2_TMIN_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMIN, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_TMIN_WERT"
+
+// 0xDF90 I3_PID_SME_HIS_ERR_LIM_STROM_TLOW
+#define I3_FLD_SME_STAT_CHA_CURR_ERR_INT_LIM_TLOW_WERT           I3_PID_SME_HIS_ERR_LIM_STROM_TLOW, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_TLOW_WERT"
+#define I3_FLD_SME_STAT_DCH_CURR_ERR_INT_LIM_TLOW_WERT           I3_PID_SME_HIS_ERR_LIM_STROM_TLOW, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_1_TLOW_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TLOW, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_2_TLOW_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TLOW, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_1_TLOW_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TLOW, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_TLOW_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_2_TLOW_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TLOW, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_TLOW_WERT"
+
+// 0xDF91 I3_PID_SME_HIS_ERR_LIM_STROM_THIGH
+#define I3_FLD_SME_STAT_CHA_CURR_ERR_INT_LIM_THIGH_WERT          I3_PID_SME_HIS_ERR_LIM_STROM_THIGH, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_THIGH_WERT"
+#define I3_FLD_SME_STAT_DCH_CURR_ERR_INT_LIM_THIGH_WERT          I3_PID_SME_HIS_ERR_LIM_STROM_THIGH, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_1_THIGH_WERT       I3_PID_SME_HIS_ERR_LIM_STROM_THIGH, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_2_THIGH_WERT       I3_PID_SME_HIS_ERR_LIM_STROM_THIGH, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_1_THIGH_WERT       I3_PID_SME_HIS_ERR_LIM_STROM_THIGH, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_THIGH_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_2_THIGH_WERT       I3_PID_SME_HIS_ERR_LIM_STROM_THIGH, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_THIGH_WERT"
+
+// 0xDF92 I3_PID_SME_HIS_ERR_LIM_STROM_TMAX
+#define I3_FLD_SME_STAT_CHA_CURR_ERR_INT_LIM_TMAX_WERT           I3_PID_SME_HIS_ERR_LIM_STROM_TMAX, 0, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_CHA_CURR_ERR_INT_LIM_TMAX_WERT"
+#define I3_FLD_SME_STAT_DCH_CURR_ERR_INT_LIM_TMAX_WERT           I3_PID_SME_HIS_ERR_LIM_STROM_TMAX, 4, PID_FIELD_UINT32, 0.01f, 0.0f, "STAT_DCH_CURR_ERR_INT_LIM_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_1_TMAX_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMAX, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_1_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_CHG_ERR_LIM_STROM_2_TMAX_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMAX, 12, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_CHG_ERR_LIM_STROM_2_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_1_TMAX_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMAX, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_1_TMAX_WERT"
+#define I3_FLD_SME_STAT_HIS_DCH_ERR_LIM_STROM_2_TMAX_WERT        I3_PID_SME_HIS_ERR_LIM_STROM_TMAX, 20, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HIS_DCH_ERR_LIM_STROM_2_TMAX_WERT"
+
+// 0xDF9C I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN
+#define I3_FLD_SME_STAT_PWR_STUETZP_P1_WERT                      I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 0, PID_FIELD_UINT8, 200.0f, 0.0f, "STAT_PWR_STUETZP_P1_WERT"
+#define I3_FLD_SME_STAT_PWR_STUETZP_P2_WERT                      I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 1, PID_FIELD_UINT8, 200.0f, 0.0f, "STAT_PWR_STUETZP_P2_WERT"
+#define I3_FLD_SME_STAT_TEMP_STUETZP_T1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 2, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_STUETZP_T1_WERT"
+#define I3_FLD_SME_STAT_TEMP_STUETZP_T2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 3, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_STUETZP_T2_WERT"
+#define I3_FLD_SME_STAT_TEMP_STUETZP_T3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 4, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_STUETZP_T3_WERT"
+#define I3_FLD_SME_STAT_TEMP_STUETZP_T4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 5, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_TEMP_STUETZP_T4_WERT"
+#define I3_FLD_SME_STAT_SOC_STUETZP_SOC1_WERT                    I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 6, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC1_WERT"
+#define I3_FLD_SME_STAT_SOC_STUETZP_SOC2_WERT                    I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 7, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC2_WERT"
+#define I3_FLD_SME_STAT_SOC_STUETZP_SOC3_WERT                    I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC3_WERT"
+#define I3_FLD_SME_STAT_SOC_STUETZP_SOC4_WERT                    I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC4_WERT"
+#define I3_FLD_SME_STAT_SOC_STUETZP_SOC5_WERT                    I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_STUETZP_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T1_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T1_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T1_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T1_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T1_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 15, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T1_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T2_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 16, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T2_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T2_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T2_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T2_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T2_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T3_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T3_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T3_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T3_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 24, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T3_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 25, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T3_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T4_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T4_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 27, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T4_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 28, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T4_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P1_T4_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P1_T4_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T1_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T1_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T1_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 33, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T1_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 34, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T1_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 35, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T1_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T2_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 36, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T2_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 37, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T2_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 38, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T2_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 39, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T2_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 40, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T2_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T3_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 41, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T3_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 42, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T3_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 43, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T3_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 44, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T3_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 45, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T3_SOC5_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T4_SOC1_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 46, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC1_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T4_SOC2_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 47, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC2_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T4_SOC3_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 48, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC3_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T4_SOC4_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 49, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC4_WERT"
+#define I3_FLD_SME_STAT_FAKT_P2_T4_SOC5_WERT                     I3_PID_SME_LADEZEIT_ADAPT_KENNFELD_LESEN, 50, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_FAKT_P2_T4_SOC5_WERT"
+
+// 0xDF9E I3_PID_SME_VERH_VOLLADE_LADEVORG_LESEN
+#define I3_FLD_SME_STAT_VERH_VOLLADE_LADEVORG_WERT               I3_PID_SME_VERH_VOLLADE_LADEVORG_LESEN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_VERH_VOLLADE_LADEVORG_WERT"
+
+// 0xDFA0 I3_PID_SME_ZUSTAND_SPEICHER
+#define I3_FLD_SME_STAT_ZELLKAPAZITAET_MIN_WERT                  I3_PID_SME_ZUSTAND_SPEICHER, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ZELLKAPAZITAET_MIN_WERT"
+#define I3_FLD_SME_STAT_ZELLKAPAZITAET_MAX_WERT                  I3_PID_SME_ZUSTAND_SPEICHER, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ZELLKAPAZITAET_MAX_WERT"
+#define I3_FLD_SME_STAT_ZELLKAPAZITAET_MEAN_WERT                 I3_PID_SME_ZUSTAND_SPEICHER, 4, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ZELLKAPAZITAET_MEAN_WERT"
+#define I3_FLD_SME_STAT_ZELLSPANNUNG_MIN_WERT                    I3_PID_SME_ZUSTAND_SPEICHER, 6, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLSPANNUNG_MIN_WERT"
+#define I3_FLD_SME_STAT_ZELLSPANNUNG_MAX_WERT                    I3_PID_SME_ZUSTAND_SPEICHER, 8, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLSPANNUNG_MAX_WERT"
+#define I3_FLD_SME_STAT_ZELLSPANNUNG_MEAN_WERT                   I3_PID_SME_ZUSTAND_SPEICHER, 10, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLSPANNUNG_MEAN_WERT"
+#define I3_FLD_SME_STAT_ZELLTEMPERATUR_MIN_WERT                  I3_PID_SME_ZUSTAND_SPEICHER, 12, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_ZELLTEMPERATUR_MIN_WERT"
+#define I3_FLD_SME_STAT_ZELLTEMPERATUR_MAX_WERT                  I3_PID_SME_ZUSTAND_SPEICHER, 14, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_ZELLTEMPERATUR_MAX_WERT"
+#define I3_FLD_SME_STAT_ZELLTEMPERATUR_MEAN_WERT                 I3_PID_SME_ZUSTAND_SPEICHER, 16, PID_FIELD_SINT16, 0.01f, 0.0f, "STAT_ZELLTEMPERATUR_MEAN_WERT"
+#define I3_FLD_SME_STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT           I3_PID_SME_ZUSTAND_SPEICHER, 18, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT"
+#define I3_FLD_SME_STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT           I3_PID_SME_ZUSTAND_SPEICHER, 20, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT"
+#define I3_FLD_SME_STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT          I3_PID_SME_ZUSTAND_SPEICHER, 22, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT"
+#define I3_FLD_SME_STAT_ZELLSOC_MIN_WERT                         I3_PID_SME_ZUSTAND_SPEICHER, 24, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ZELLSOC_MIN_WERT"
+#define I3_FLD_SME_STAT_ZELLSOC_MAX_WERT                         I3_PID_SME_ZUSTAND_SPEICHER, 26, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ZELLSOC_MAX_WERT"
+#define I3_FLD_SME_STAT_ZELLSOC_MEAN_WERT                        I3_PID_SME_ZUSTAND_SPEICHER, 28, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ZELLSOC_MEAN_WERT"
+#define I3_FLD_SME_STAT_ZELLOCV_MIN_WERT                         I3_PID_SME_ZUSTAND_SPEICHER, 30, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLOCV_MIN_WERT"
+#define I3_FLD_SME_STAT_ZELLOCV_MAX_WERT                         I3_PID_SME_ZUSTAND_SPEICHER, 32, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLOCV_MAX_WERT"
+#define I3_FLD_SME_STAT_ZELLOCV_MEAN_WERT                        I3_PID_SME_ZUSTAND_SPEICHER, 34, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_ZELLOCV_MEAN_WERT"
+#define I3_FLD_SME_STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT          I3_PID_SME_ZUSTAND_SPEICHER, 36, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT"
+
+// 0xDFA1 I3_PID_SME_HIS_ERR_LIM_SPANNUNG
+#define I3_FLD_SME_STAT_OVER_VOLT_INT_LIM_WERT                   I3_PID_SME_HIS_ERR_LIM_SPANNUNG, 0, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_OVER_VOLT_INT_LIM_WERT"
+#define I3_FLD_SME_STAT_UNDER_VOLT_INT_LIM_WERT                  I3_PID_SME_HIS_ERR_LIM_SPANNUNG, 2, PID_FIELD_UINT16, 0.001f, 0.0f, "STAT_UNDER_VOLT_INT_LIM_WERT"
+#define I3_FLD_SME_STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_UNDER_1_WERT I3_PID_SME_HIS_ERR_LIM_SPANNUNG, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_UNDER_1_WERT"
+#define I3_FLD_SME_STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_UNDER_2_WERT I3_PID_SME_HIS_ERR_LIM_SPANNUNG, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_UNDER_2_WERT"
+#define I3_FLD_SME_STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_OVER_1_WERT I3_PID_SME_HIS_ERR_LIM_SPANNUNG, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_OVER_1_WERT"
+#define I3_FLD_SME_STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_OVER_2_WERT I3_PID_SME_HIS_ERR_LIM_SPANNUNG, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_HIS_ERR_LIM_SPANNUNG_MODSMAX_OVER_2_WERT"
+
+// 0xDFAE I3_PID_SME_HIS_SOC_MAX_MIN
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_MAX_WERT                    I3_PID_SME_HIS_SOC_MAX_MIN, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_MIN_NENN_MAX_WERT"
+#define I3_FLD_SME_STAT_SOC_MIN_NENN_MIN_WERT                    I3_PID_SME_HIS_SOC_MAX_MIN, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_SOC_MIN_NENN_MIN_WERT"
+
+// 0xDFE1 I3_PID_SME_STATUS_HV_SPEICHER_ID
+#define I3_FLD_SME_STAT_SP_ID_00                                 I3_PID_SME_STATUS_HV_SPEICHER_ID, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SP_ID_00"
+#define I3_FLD_SME_STAT_SP_ID_01_WERT                            I3_PID_SME_STATUS_HV_SPEICHER_ID, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_SP_ID_01_WERT"
+
+// 0xDFE2 I3_PID_SME_SYMMETRIERBAND
+#define I3_FLD_SME_STAT_SOC_LAST_BALANCING_WERT                  I3_PID_SME_SYMMETRIERBAND, 0, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_SOC_LAST_BALANCING_WERT"
+#define I3_FLD_SME_STAT_TIME_LAST_BALANCING_WERT                 I3_PID_SME_SYMMETRIERBAND, 1, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_TIME_LAST_BALANCING_WERT"
+#define I3_FLD_SME_STAT_DIFFERENCE_VOLTAGE_LAST_BALANCING_WERT   I3_PID_SME_SYMMETRIERBAND, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_DIFFERENCE_VOLTAGE_LAST_BALANCING_WERT"
+#define I3_FLD_SME_STAT_LAST_PARKING_SOC_1_WERT                  I3_PID_SME_SYMMETRIERBAND, 6, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_1_WERT"
+#define I3_FLD_SME_STAT_LAST_PARKING_SOC_2_WERT                  I3_PID_SME_SYMMETRIERBAND, 7, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_2_WERT"
+#define I3_FLD_SME_STAT_LAST_PARKING_SOC_3_WERT                  I3_PID_SME_SYMMETRIERBAND, 8, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_3_WERT"
+#define I3_FLD_SME_STAT_LAST_PARKING_SOC_4_WERT                  I3_PID_SME_SYMMETRIERBAND, 9, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_4_WERT"
+#define I3_FLD_SME_STAT_LAST_PARKING_SOC_5_WERT                  I3_PID_SME_SYMMETRIERBAND, 10, PID_FIELD_UINT8, 0.5f, 0.0f, "STAT_LAST_PARKING_SOC_5_WERT"
+
+// 0xE50D I3_PID_SME_GW_INFO_SCHNELLLADEN
+#define I3_FLD_SME_STAT_ENERGIEANTEIL_SCHNELLLADEN_TEMP_HIGH_WERT I3_PID_SME_GW_INFO_SCHNELLLADEN, 0, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ENERGIEANTEIL_SCHNELLLADEN_TEMP_HIGH_WERT"
+#define I3_FLD_SME_STAT_ENERGIEANTEIL_SCHNELLLADEN_TEMP_LOW_WERT I3_PID_SME_GW_INFO_SCHNELLLADEN, 2, PID_FIELD_UINT16, 0.01f, 0.0f, "STAT_ENERGIEANTEIL_SCHNELLLADEN_TEMP_LOW_WERT"
+#define I3_FLD_SME_STAT_ENERGIEDURCHSATZ_SCHNELLLADEN_TEMP_HIGH_WERT I3_PID_SME_GW_INFO_SCHNELLLADEN, 4, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_ENERGIEDURCHSATZ_SCHNELLLADEN_TEMP_HIGH_WERT"
+#define I3_FLD_SME_STAT_ENERGIEDURCHSATZ_SCHNELLLADEN_TEMP_LOW_WERT I3_PID_SME_GW_INFO_SCHNELLLADEN, 8, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_ENERGIEDURCHSATZ_SCHNELLLADEN_TEMP_LOW_WERT"
+#define I3_FLD_SME_STAT_ENERGIEDURCHSATZ_GESAMT_WERT             I3_PID_SME_GW_INFO_SCHNELLLADEN, 12, PID_FIELD_UINT32, 0.1f, 0.0f, "STAT_ENERGIEDURCHSATZ_GESAMT_WERT"
+
+// 0xE540 I3_PID_SME_CODIERVARIABLEN_HV_SPEICHER
+#define I3_FLD_SME_STAT_COOL_VALVE_PRESENT_WERT                  I3_PID_SME_CODIERVARIABLEN_HV_SPEICHER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_COOL_VALVE_PRESENT_WERT"
+#define I3_FLD_SME_STAT_COUNTRY_CODE_WERT                        I3_PID_SME_CODIERVARIABLEN_HV_SPEICHER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_COUNTRY_CODE_WERT"
+#define I3_FLD_SME_STAT_COD_FUNKTION_SWITCH_WERT                 I3_PID_SME_CODIERVARIABLEN_HV_SPEICHER, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_COD_FUNKTION_SWITCH_WERT"
+#define I3_FLD_SME_STAT_COD_STATSP_WERT                          I3_PID_SME_CODIERVARIABLEN_HV_SPEICHER, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_COD_STATSP_WERT"
+
+// 0xE5F1 I3_PID_SME_ANZAHL_DEFEKTE_SICHERUNG
+#define I3_FLD_SME_STAT_ANZAHL_DEFEKTE_SICHERUNG_WERT            I3_PID_SME_ANZAHL_DEFEKTE_SICHERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ANZAHL_DEFEKTE_SICHERUNG_WERT"
+
+// 0xE5F2 I3_PID_SME_HVOFF_VOLTAGES
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_COUNTER_RB1_WERT          I3_PID_SME_HVOFF_VOLTAGES, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_COUNTER_RB1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_1_WERT       I3_PID_SME_HVOFF_VOLTAGES, 1, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_2_WERT       I3_PID_SME_HVOFF_VOLTAGES, 3, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_3_WERT       I3_PID_SME_HVOFF_VOLTAGES, 5, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_4_WERT       I3_PID_SME_HVOFF_VOLTAGES, 7, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_1_WERT   I3_PID_SME_HVOFF_VOLTAGES, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_2_WERT   I3_PID_SME_HVOFF_VOLTAGES, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_3_WERT   I3_PID_SME_HVOFF_VOLTAGES, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_4_WERT   I3_PID_SME_HVOFF_VOLTAGES, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_1_WERT      I3_PID_SME_HVOFF_VOLTAGES, 13, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_2_WERT      I3_PID_SME_HVOFF_VOLTAGES, 15, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_3_WERT      I3_PID_SME_HVOFF_VOLTAGES, 17, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_4_WERT      I3_PID_SME_HVOFF_VOLTAGES, 19, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_1_WERT       I3_PID_SME_HVOFF_VOLTAGES, 21, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_2_WERT       I3_PID_SME_HVOFF_VOLTAGES, 23, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_3_WERT       I3_PID_SME_HVOFF_VOLTAGES, 25, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_4_WERT       I3_PID_SME_HVOFF_VOLTAGES, 27, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_1_WERT   I3_PID_SME_HVOFF_VOLTAGES, 29, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_2_WERT   I3_PID_SME_HVOFF_VOLTAGES, 30, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_3_WERT   I3_PID_SME_HVOFF_VOLTAGES, 31, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_4_WERT   I3_PID_SME_HVOFF_VOLTAGES, 32, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB1_1_WERT         I3_PID_SME_HVOFF_VOLTAGES, 33, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB1_2_WERT         I3_PID_SME_HVOFF_VOLTAGES, 35, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB1_3_WERT         I3_PID_SME_HVOFF_VOLTAGES, 37, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB1_4_WERT         I3_PID_SME_HVOFF_VOLTAGES, 39, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_1_WERT   I3_PID_SME_HVOFF_VOLTAGES, 41, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_2_WERT   I3_PID_SME_HVOFF_VOLTAGES, 45, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_3_WERT   I3_PID_SME_HVOFF_VOLTAGES, 49, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_4_WERT   I3_PID_SME_HVOFF_VOLTAGES, 53, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_1            I3_PID_SME_HVOFF_VOLTAGES, 57, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_1"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_2            I3_PID_SME_HVOFF_VOLTAGES, 58, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_2"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_3            I3_PID_SME_HVOFF_VOLTAGES, 59, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_3"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_4            I3_PID_SME_HVOFF_VOLTAGES, 60, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB1_4"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_1            I3_PID_SME_HVOFF_VOLTAGES, 61, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_1"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_2            I3_PID_SME_HVOFF_VOLTAGES, 62, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_2"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_3            I3_PID_SME_HVOFF_VOLTAGES, 63, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_3"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_4            I3_PID_SME_HVOFF_VOLTAGES, 64, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB1_4"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_1_WERT     I3_PID_SME_HVOFF_VOLTAGES, 65, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_2_WERT     I3_PID_SME_HVOFF_VOLTAGES, 66, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_3_WERT     I3_PID_SME_HVOFF_VOLTAGES, 67, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_4_WERT     I3_PID_SME_HVOFF_VOLTAGES, 68, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB1_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_COUNTER_RB2_WERT          I3_PID_SME_HVOFF_VOLTAGES, 69, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_COUNTER_RB2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_1_WERT       I3_PID_SME_HVOFF_VOLTAGES, 70, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_2_WERT       I3_PID_SME_HVOFF_VOLTAGES, 72, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_3_WERT       I3_PID_SME_HVOFF_VOLTAGES, 74, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_4_WERT       I3_PID_SME_HVOFF_VOLTAGES, 76, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MIN_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_1_WERT   I3_PID_SME_HVOFF_VOLTAGES, 78, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_2_WERT   I3_PID_SME_HVOFF_VOLTAGES, 79, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_3_WERT   I3_PID_SME_HVOFF_VOLTAGES, 80, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_4_WERT   I3_PID_SME_HVOFF_VOLTAGES, 81, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MIN_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_1_WERT      I3_PID_SME_HVOFF_VOLTAGES, 82, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_2_WERT      I3_PID_SME_HVOFF_VOLTAGES, 84, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_3_WERT      I3_PID_SME_HVOFF_VOLTAGES, 86, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_4_WERT      I3_PID_SME_HVOFF_VOLTAGES, 88, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MEAN_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_1_WERT       I3_PID_SME_HVOFF_VOLTAGES, 90, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_2_WERT       I3_PID_SME_HVOFF_VOLTAGES, 92, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_3_WERT       I3_PID_SME_HVOFF_VOLTAGES, 94, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_4_WERT       I3_PID_SME_HVOFF_VOLTAGES, 96, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_MAX_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_1_WERT   I3_PID_SME_HVOFF_VOLTAGES, 98, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_2_WERT   I3_PID_SME_HVOFF_VOLTAGES, 99, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_3_WERT   I3_PID_SME_HVOFF_VOLTAGES, 100, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_4_WERT   I3_PID_SME_HVOFF_VOLTAGES, 101, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_IDX_UCEL_MAX_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB2_1_WERT         I3_PID_SME_HVOFF_VOLTAGES, 102, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB2_2_WERT         I3_PID_SME_HVOFF_VOLTAGES, 104, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB2_3_WERT         I3_PID_SME_HVOFF_VOLTAGES, 106, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_UCEL_1_RB2_4_WERT         I3_PID_SME_HVOFF_VOLTAGES, 108, PID_FIELD_UINT16, 0.0001f, 0.0f, "STAT_HVOFF_VOLTAGES_UCEL_1_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_1_WERT   I3_PID_SME_HVOFF_VOLTAGES, 110, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_2_WERT   I3_PID_SME_HVOFF_VOLTAGES, 114, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_3_WERT   I3_PID_SME_HVOFF_VOLTAGES, 118, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_4_WERT   I3_PID_SME_HVOFF_VOLTAGES, 122, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_SME_LIFETIME_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_1            I3_PID_SME_HVOFF_VOLTAGES, 126, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_1"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_2            I3_PID_SME_HVOFF_VOLTAGES, 127, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_2"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_3            I3_PID_SME_HVOFF_VOLTAGES, 128, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_3"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_4            I3_PID_SME_HVOFF_VOLTAGES, 129, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_STAT_SYM_RB2_4"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_1            I3_PID_SME_HVOFF_VOLTAGES, 130, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_1"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_2            I3_PID_SME_HVOFF_VOLTAGES, 131, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_2"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_3            I3_PID_SME_HVOFF_VOLTAGES, 132, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_3"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_4            I3_PID_SME_HVOFF_VOLTAGES, 133, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_INFO_SYM_RB2_4"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_1_WERT     I3_PID_SME_HVOFF_VOLTAGES, 134, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_1_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_2_WERT     I3_PID_SME_HVOFF_VOLTAGES, 135, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_2_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_3_WERT     I3_PID_SME_HVOFF_VOLTAGES, 136, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_3_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_4_WERT     I3_PID_SME_HVOFF_VOLTAGES, 137, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_T_CORE_AVG_RB2_4_WERT"
+#define I3_FLD_SME_STAT_HVOFF_VOLTAGES_COUNTER_SCORE_WERT        I3_PID_SME_HVOFF_VOLTAGES, 138, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_HVOFF_VOLTAGES_COUNTER_SCORE_WERT"
+
+// 0xE5F3 I3_PID_SME_RB_SOH_KAPATEST_ERW
+#define I3_FLD_SME_STAT_TEMP_MEAN_DCH_END_TEST_1_WERT            I3_PID_SME_RB_SOH_KAPATEST_ERW, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN_DCH_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MIN_DCH_END_TEST_1_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MIN_DCH_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MAX_DCH_END_TEST_1_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 2, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MAX_DCH_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN_CHA_END_TEST_1_WERT            I3_PID_SME_RB_SOH_KAPATEST_ERW, 3, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN_CHA_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MIN_CHA_END_TEST_1_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 4, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MIN_CHA_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MAX_CHA_END_TEST_1_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 5, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MAX_CHA_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_FRC_PWR_CHG_TEST_1_WERT                  I3_PID_SME_RB_SOH_KAPATEST_ERW, 6, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_FRC_PWR_CHG_TEST_1_WERT"
+#define I3_FLD_SME_STAT_I_DCH_END_FILT_TEST_1_WERT               I3_PID_SME_RB_SOH_KAPATEST_ERW, 7, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_I_DCH_END_FILT_TEST_1_WERT"
+#define I3_FLD_SME_STAT_U_CELL_MIN_IDX_DCH_END_TEST_1_WERT       I3_PID_SME_RB_SOH_KAPATEST_ERW, 8, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_U_CELL_MIN_IDX_DCH_END_TEST_1_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN_DCH_END_TEST_2_WERT            I3_PID_SME_RB_SOH_KAPATEST_ERW, 9, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN_DCH_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MIN_DCH_END_TEST_2_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MIN_DCH_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MAX_DCH_END_TEST_2_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 11, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MAX_DCH_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN_CHA_END_TEST_2_WERT            I3_PID_SME_RB_SOH_KAPATEST_ERW, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN_CHA_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MIN_CHA_END_TEST_2_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 13, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MIN_CHA_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MAX_CHA_END_TEST_2_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 14, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MAX_CHA_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_FRC_PWR_CHG_TEST_2_WERT                  I3_PID_SME_RB_SOH_KAPATEST_ERW, 15, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_FRC_PWR_CHG_TEST_2_WERT"
+#define I3_FLD_SME_STAT_I_DCH_END_FILT_TEST_2_WERT               I3_PID_SME_RB_SOH_KAPATEST_ERW, 16, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_I_DCH_END_FILT_TEST_2_WERT"
+#define I3_FLD_SME_STAT_U_CELL_MIN_IDX_DCH_END_TEST_2_WERT       I3_PID_SME_RB_SOH_KAPATEST_ERW, 17, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_U_CELL_MIN_IDX_DCH_END_TEST_2_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN_DCH_END_TEST_3_WERT            I3_PID_SME_RB_SOH_KAPATEST_ERW, 18, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN_DCH_END_TEST_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MIN_DCH_END_TEST_3_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 19, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MIN_DCH_END_TEST_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MAX_DCH_END_TEST_3_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 20, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MAX_DCH_END_TEST_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MEAN_CHA_END_TEST_3_WERT            I3_PID_SME_RB_SOH_KAPATEST_ERW, 21, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MEAN_CHA_END_TEST_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MIN_CHA_END_TEST_3_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 22, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MIN_CHA_END_TEST_3_WERT"
+#define I3_FLD_SME_STAT_TEMP_MAX_CHA_END_TEST_3_WERT             I3_PID_SME_RB_SOH_KAPATEST_ERW, 23, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TEMP_MAX_CHA_END_TEST_3_WERT"
+#define I3_FLD_SME_STAT_FRC_PWR_CHG_TEST_3_WERT                  I3_PID_SME_RB_SOH_KAPATEST_ERW, 24, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_FRC_PWR_CHG_TEST_3_WERT"
+#define I3_FLD_SME_STAT_I_DCH_END_FILT_TEST_3_WERT               I3_PID_SME_RB_SOH_KAPATEST_ERW, 25, PID_FIELD_UINT8, 0.1f, 0.0f, "STAT_I_DCH_END_FILT_TEST_3_WERT"
+#define I3_FLD_SME_STAT_U_CELL_MIN_IDX_DCH_END_TEST_3_WERT       I3_PID_SME_RB_SOH_KAPATEST_ERW, 26, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_U_CELL_MIN_IDX_DCH_END_TEST_3_WERT"
+
+// 0xE5F4 I3_PID_SME_CPI_ANALYSE
+#define I3_FLD_SME_STAT_CPI_REL_TEMP_WERT                        I3_PID_SME_CPI_ANALYSE, 0, PID_FIELD_SINT16, 0.1f, 0.0f, "STAT_CPI_REL_TEMP_WERT"
+#define I3_FLD_SME_STAT_CPI_TEMP_GRAD_WERT                       I3_PID_SME_CPI_ANALYSE, 2, PID_FIELD_SINT32, 0.001f, 0.0f, "STAT_CPI_TEMP_GRAD_WERT"
+#define I3_FLD_SME_STAT_CPI_E_LOSS_WERT                          I3_PID_SME_CPI_ANALYSE, 6, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CPI_E_LOSS_WERT"
+#define I3_FLD_SME_STAT_CPI_DIAGNOSE                             I3_PID_SME_CPI_ANALYSE, 10, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CPI_DIAGNOSE"
+#define I3_FLD_SME_STAT_CPI_TEMP_UMGEBUNG_WERT                   I3_PID_SME_CPI_ANALYSE, 11, PID_FIELD_SINT8, 1.0f, 0.0f, "STAT_CPI_TEMP_UMGEBUNG_WERT"
+#define I3_FLD_SME_STAT_CPI_FRT_AC                               I3_PID_SME_CPI_ANALYSE, 12, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_CPI_FRT_AC"
+#define I3_FLD_SME_STAT_CPI_LIFE_TIME_WERT                       I3_PID_SME_CPI_ANALYSE, 13, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_CPI_LIFE_TIME_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_CPI_OK_WERT                       I3_PID_SME_CPI_ANALYSE, 17, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_CPI_OK_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_CPI_FAILED_WERT                   I3_PID_SME_CPI_ANALYSE, 19, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_CPI_FAILED_WERT"
+#define I3_FLD_SME_STAT_ANZAHL_CPI_ABGEBROCHEN_WERT              I3_PID_SME_CPI_ANALYSE, 21, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ANZAHL_CPI_ABGEBROCHEN_WERT"
+
+// 0xE5FA I3_PID_SME_KAPAZITAETSTEST_ASYMMETRIE_POTENTIAL
+#define I3_FLD_SME_STAT_KAPATEST_ASYM_ZELLE_ID_WERT              I3_PID_SME_KAPAZITAETSTEST_ASYMMETRIE_POTENTIAL, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAPATEST_ASYM_ZELLE_ID_WERT"
+#define I3_FLD_SME_STAT_KAPATEST_ASYM_MOD_ID_WERT                I3_PID_SME_KAPAZITAETSTEST_ASYMMETRIE_POTENTIAL, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_KAPATEST_ASYM_MOD_ID_WERT"
+#define I3_FLD_SME_STAT_KAPATEST_ASYM_POT_WERT                   I3_PID_SME_KAPAZITAETSTEST_ASYMMETRIE_POTENTIAL, 2, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_KAPATEST_ASYM_POT_WERT"
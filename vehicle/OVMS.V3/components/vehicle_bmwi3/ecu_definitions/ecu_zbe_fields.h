@@ -0,0 +1,109 @@
+
+//
+// Warning: don't edit - generated by generate_ecu_code.pl processing ../dev/zbe6.json: ZBE 67: iDrive controller
+// This generated code  makes it easier to process CANBUS messages from the ZBE ecu in a BMW i3
+//
+
+// 0x2502 I3_PID_ZBE_PROGRAMMING_COUNTER
+#define I3_FLD_ZBE_STAT_RESERVE_WERT                             I3_PID_ZBE_PROGRAMMING_COUNTER, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_RESERVE_WERT"
+#define I3_FLD_ZBE_STAT_PROG_ZAEHLER_STATUS                      I3_PID_ZBE_PROGRAMMING_COUNTER, 1, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_PROG_ZAEHLER_STATUS"
+#define I3_FLD_ZBE_STAT_PROG_ZAEHLER_WERT                        I3_PID_ZBE_PROGRAMMING_COUNTER, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PROG_ZAEHLER_WERT"
+
+// 0x2503 I3_PID_ZBE_PROGRAMMING_COUNTER_MAX_VALUE
+#define I3_FLD_ZBE_STAT_PROG_MAX_WERT                            I3_PID_ZBE_PROGRAMMING_COUNTER_MAX_VALUE, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_PROG_MAX_WERT"
+
+// 0x2504 I3_PID_ZBE_FLASH_TIMING_PARAMETER
+#define I3_FLD_ZBE_STAT_ERASE_MEMORY_TIME_WERT                   I3_PID_ZBE_FLASH_TIMING_PARAMETER, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_ERASE_MEMORY_TIME_WERT"
+#define I3_FLD_ZBE_STAT_CHECK_MEMORY_TIME_WERT                   I3_PID_ZBE_FLASH_TIMING_PARAMETER, 2, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_CHECK_MEMORY_TIME_WERT"
+#define I3_FLD_ZBE_STAT_BOOTLOADER_INSTALLATION_TIME_WERT        I3_PID_ZBE_FLASH_TIMING_PARAMETER, 4, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_BOOTLOADER_INSTALLATION_TIME_WERT"
+#define I3_FLD_ZBE_STAT_AUTHENTICATION_TIME_WERT                 I3_PID_ZBE_FLASH_TIMING_PARAMETER, 6, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_AUTHENTICATION_TIME_WERT"
+#define I3_FLD_ZBE_STAT_RESET_TIME_WERT                          I3_PID_ZBE_FLASH_TIMING_PARAMETER, 8, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_RESET_TIME_WERT"
+#define I3_FLD_ZBE_STAT_TRANSFER_DATA_TIME_WERT                  I3_PID_ZBE_FLASH_TIMING_PARAMETER, 10, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_TRANSFER_DATA_TIME_WERT"
+
+// 0x2540 I3_PID_ZBE_MILE_KM_EEPROM
+
+// 0xD137 I3_PID_ZBE_VARIANTE_ZBE
+#define I3_FLD_ZBE_STAT_ZBE_VARIANTE_NR                          I3_PID_ZBE_VARIANTE_ZBE, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ZBE_VARIANTE_NR"
+
+// 0xD14E I3_PID_ZBE_SCHRITTE_ROTRAD
+#define I3_FLD_ZBE_STAT_REGISTER_ROTRAD_WERT                     I3_PID_ZBE_SCHRITTE_ROTRAD, 0, PID_FIELD_UINT16, 1.0f, 0.0f, "STAT_REGISTER_ROTRAD_WERT"
+
+// 0xD213 I3_PID_ZBE_LOGGING_TASTE1
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT                        I3_PID_ZBE_LOGGING_TASTE1, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT                    I3_PID_ZBE_LOGGING_TASTE1, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT                      I3_PID_ZBE_LOGGING_TASTE1, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT"
+
+// 0xD214 I3_PID_ZBE_LOGGING_TASTE2
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD214                 I3_PID_ZBE_LOGGING_TASTE2, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD214"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD214             I3_PID_ZBE_LOGGING_TASTE2, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD214"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD214               I3_PID_ZBE_LOGGING_TASTE2, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD214"
+
+// 0xD215 I3_PID_ZBE_LOGGING_TASTE3
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD215                 I3_PID_ZBE_LOGGING_TASTE3, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD215"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD215             I3_PID_ZBE_LOGGING_TASTE3, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD215"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD215               I3_PID_ZBE_LOGGING_TASTE3, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD215"
+
+// 0xD216 I3_PID_ZBE_LOGGING_TASTE4
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD216                 I3_PID_ZBE_LOGGING_TASTE4, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD216"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD216             I3_PID_ZBE_LOGGING_TASTE4, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD216"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD216               I3_PID_ZBE_LOGGING_TASTE4, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD216"
+
+// 0xD217 I3_PID_ZBE_LOGGING_TASTE5
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD217                 I3_PID_ZBE_LOGGING_TASTE5, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD217"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD217             I3_PID_ZBE_LOGGING_TASTE5, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD217"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD217               I3_PID_ZBE_LOGGING_TASTE5, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD217"
+
+// 0xD218 I3_PID_ZBE_LOGGING_TASTE6
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD218                 I3_PID_ZBE_LOGGING_TASTE6, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD218"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD218             I3_PID_ZBE_LOGGING_TASTE6, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD218"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD218               I3_PID_ZBE_LOGGING_TASTE6, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD218"
+
+// 0xD219 I3_PID_ZBE_LOGGING_TASTE7
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD219                 I3_PID_ZBE_LOGGING_TASTE7, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD219"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD219             I3_PID_ZBE_LOGGING_TASTE7, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD219"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD219               I3_PID_ZBE_LOGGING_TASTE7, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD219"
+
+// 0xD21A I3_PID_ZBE_LOGGING_TASTE8
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD21A                 I3_PID_ZBE_LOGGING_TASTE8, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21A"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD21A             I3_PID_ZBE_LOGGING_TASTE8, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21A"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD21A               I3_PID_ZBE_LOGGING_TASTE8, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21A"
+
+// 0xD21B I3_PID_ZBE_LOGGING_DREHSTELLER
+#define I3_FLD_ZBE_STAT_RASTEN_IM_UHRZEIGERSINN_WERT             I3_PID_ZBE_LOGGING_DREHSTELLER, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RASTEN_IM_UHRZEIGERSINN_WERT"
+#define I3_FLD_ZBE_STAT_RASTEN_GEGEN_UHRZEIGERSINN_WERT          I3_PID_ZBE_LOGGING_DREHSTELLER, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_RASTEN_GEGEN_UHRZEIGERSINN_WERT"
+#define I3_FLD_ZBE_STAT_UNDERFLOW_WERT                           I3_PID_ZBE_LOGGING_DREHSTELLER, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_UNDERFLOW_WERT"
+#define I3_FLD_ZBE_STAT_OVERFLOW_WERT                            I3_PID_ZBE_LOGGING_DREHSTELLER, 24, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_OVERFLOW_WERT"
+
+// 0xD21C I3_PID_ZBE_LOGGING_DREHSTELLER_NORD
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD21C                 I3_PID_ZBE_LOGGING_DREHSTELLER_NORD, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21C"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD21C             I3_PID_ZBE_LOGGING_DREHSTELLER_NORD, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21C"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD21C               I3_PID_ZBE_LOGGING_DREHSTELLER_NORD, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21C"
+
+// 0xD21D I3_PID_ZBE_LOGGING_DREHSTELLER_OST
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD21D                 I3_PID_ZBE_LOGGING_DREHSTELLER_OST, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21D"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD21D             I3_PID_ZBE_LOGGING_DREHSTELLER_OST, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21D"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD21D               I3_PID_ZBE_LOGGING_DREHSTELLER_OST, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21D"
+
+// 0xD21E I3_PID_ZBE_LOGGING_DREHSTELLER_SUED
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD21E                 I3_PID_ZBE_LOGGING_DREHSTELLER_SUED, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21E"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD21E             I3_PID_ZBE_LOGGING_DREHSTELLER_SUED, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21E"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD21E               I3_PID_ZBE_LOGGING_DREHSTELLER_SUED, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21E"
+
+// 0xD21F I3_PID_ZBE_LOGGING_DREHSTELLER_WEST
+#define I3_FLD_ZBE_STAT_ANZAHL_DRUCK_WERT_0XD21F                 I3_PID_ZBE_LOGGING_DREHSTELLER_WEST, 0, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_DRUCK_WERT_0XD21F"
+#define I3_FLD_ZBE_STAT_ANZAHL_LANGDRUCK_WERT_0XD21F             I3_PID_ZBE_LOGGING_DREHSTELLER_WEST, 8, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_LANGDRUCK_WERT_0XD21F"
+#define I3_FLD_ZBE_STAT_ANZAHL_HAENGER_WERT_0XD21F               I3_PID_ZBE_LOGGING_DREHSTELLER_WEST, 16, PID_FIELD_UINT32, 1.0f, 0.0f, "STAT_ANZAHL_HAENGER_WERT_0XD21F"
+
+// 0xD228 I3_PID_ZBE_LOGGING_VERBAU
+
+// 0xD60D I3_PID_ZBE_TOUCHPAD_BERUEHRUNG
+#define I3_FLD_ZBE_STAT_TOUCHPAD_BERUEHRUNG                      I3_PID_ZBE_TOUCHPAD_BERUEHRUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TOUCHPAD_BERUEHRUNG"
+
+// 0xD68D I3_PID_ZBE_TOUCHPAD_ANNAEHERUNG
+#define I3_FLD_ZBE_STAT_TOUCHPAD_ANNAEHERUNG                     I3_PID_ZBE_TOUCHPAD_ANNAEHERUNG, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_TOUCHPAD_ANNAEHERUNG"
+
+// 0xDAD9 I3_PID_ZBE_SPANNUNG_KLEMME_30B_WERT
+#define I3_FLD_ZBE_STAT_SPANNUNG_KLEMME_30B_WERT                 I3_PID_ZBE_SPANNUNG_KLEMME_30B_WERT, 0, PID_FIELD_UINT16, 0.1f, 0.0f, "STAT_SPANNUNG_KLEMME_30B_WERT"
+
+// 0xF186 I3_PID_ZBE_ACTIVE_DIAGNOSTIC_SESSION
+#define I3_FLD_ZBE_STAT_ACTIVE_DIAGNOSTIC_SESSION                I3_PID_ZBE_ACTIVE_DIAGNOSTIC_SESSION, 0, PID_FIELD_UINT8, 1.0f, 0.0f, "STAT_ACTIVE_DIAGNOSTIC_SESSION"
@@ -39,6 +39,7 @@
 #define __VEHICLE_BMWI3_H__
 
 #include "vehicle.h"
+#include "vehicle_pid_decoder.h"
 
 using namespace std;
 
@@ -74,7 +75,7 @@ class OvmsVehicleBMWi3 : public OvmsVehicle
 
 
   protected:
-    string bmwi3_obd_rxbuf;                               // CAN messages unpacked into here
+    OvmsPidDecoder m_pid_decoder;                         // Table driven decoding of the PID replies
     float hv_volts;                                       // Traction battery voltage - used to calculate power from current
     float soc = 0.0f;                                     // Remember SOC for derivative calcs
     int framecount = 0, tickercount = 0, replycount = 0;  // Keep track of when the car is talking or schtum.
@@ -140,7 +141,7 @@ class OvmsVehicleBMWi3 : public OvmsVehicle
     OvmsMetricInt *mt_i3_pollermode;
     OvmsMetricInt *mt_i3_age;
 
-    void IncomingPollReply(canbus* bus, uint16_t type, uint16_t pid, uint8_t* data, uint8_t length, uint16_t mlremain);
+    void IncomingPollResponse(const poll_reply_t& reply);
   };
 
 #endif //#ifndef __VEHICLE_BMWI3_H__
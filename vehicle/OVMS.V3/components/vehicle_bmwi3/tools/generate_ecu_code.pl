@@ -52,16 +52,17 @@ our $ctypes = {
     'BITFIELD' => 'HANDLED SEPARATELY'
 };
 
-# These map from the C++ types!
-our $formats = {
-    'char' => '%x',
-    'unsigned char' => '%x',
-    'short' => '%d',
-    'unsigned short' => '%u',
-    'long' => '%ld',
-    'unsigned long' => '%lu',
-    'float' => "%.4f",
-    'string?' => "%s"
+# Field descriptor types for the table driven PID decoder (vehicle_pid_decoder.h)
+our $fieldtypes = {
+    'signed char' => 'PID_FIELD_SINT8',
+    'unsigned char' => 'PID_FIELD_UINT8',
+    'char' => 'PID_FIELD_UINT8',
+    'signed int' => 'PID_FIELD_SINT16',
+    'unsigned int' => 'PID_FIELD_UINT16',
+    'int' => 'PID_FIELD_UINT16',
+    'long' => 'PID_FIELD_SINT32',
+    'signed long' => 'PID_FIELD_SINT32',
+    'unsigned long' => 'PID_FIELD_UINT32'
 };
 
 our $blacklist = {
@@ -73,12 +74,12 @@ our $usedfunctionnames = {};
 our $usedresultnames = {};
 
 
-open (CODE, ">&=3") || die "Can't fdopen 3";
+open (FIELDS, ">&=3") || die "Can't fdopen 3";
 open (POLLLIST, ">&=4") || die "Can't fdopen 4";
 
 binmode(STDOUT, ":utf8");
 binmode(STDERR, ":utf8");
-binmode(CODE, ":utf8");
+binmode(FIELDS, ":utf8");
 binmode(POLLLIST, ":utf8");
 
 # Read ECU definition json as created by parseecu.pl
@@ -96,7 +97,7 @@ our $ECUDESC = $tables->{'ovmsdesc'} || "ECU: $ECU";
 print STDERR "Generating OVMS config for ECU $ECU on id $ECUID: $ECUDESC\n";
 
 # Dump header
-foreach my $FD (*STDOUT, *CODE, *POLLLIST) {
+foreach my $FD (*STDOUT, *FIELDS, *POLLLIST) {
     print $FD "
 //
 // Warning: don't edit - generated by generate_ecu_code.pl processing $ARGV[0]: $ECU $ECUID: $ECUDESC
@@ -171,8 +172,8 @@ foreach my $function (@$functions) {
     printf "\n#define I3_PID_%s_%-49s %6s", $ECU, $functionname, $function->{ID};
     print "\n        // $desc" if ($desc ne '');
 
-    # write the code
-    printf(CODE "%-80s    // %s", "\n\n  case I3_PID_${ECU}_" . $functionname . ": {", $function->{ID});
+    # field descriptors
+    printf(FIELDS "\n\n// %s %s", $function->{ID}, "I3_PID_${ECU}_" . $functionname);
 
     # Now deal with the results
     my $results = $function->{RES_TABELLE};
@@ -186,7 +187,6 @@ foreach my $function (@$functions) {
     }
     if ($results) {
         my $offset = 0;
-        my @codelines;
         foreach my $result (@$results) {
             print "\n";
             print STDERR Dumper({result => $result}) if ($DEBUG);
@@ -260,44 +260,32 @@ foreach my $function (@$functions) {
                 printf "\n    #define I3_RES_%s_%-45s %s", $ECU, $resultname . '_TYPE', $ctype if ($ctype);
                 print "\n        // $desc" if ($desc ne '');
 
-                # code
-                push @codelines, "\n    $ctype $resultname = $expr;\n";
-                push @codelines, "        // $desc\n";
-                if ($isbitfield) {
-                    if ($bits && $bits->[0]) {
-                        push @codelines, "        // $resultname is a BITFIELD of size $datatype.  We don't yet generate definitions for each bit, we treat as the host data type\n";
-                        foreach my $bit (@$bits) {
-                            push @codelines, "            // " . $bit->{RESULTNAME} . ": Mask: " . $bit->{MASKE} . " - " . $bit->{INFO_EN} . "\n";
-                        }
-                    } else {
-                        push @codelines, "            // $resultname is a BITFIELD of unknown size.  We don't have definitions for each bit, and we GUESSED it is one byte ***\n";            
-                    }
-                }
-                print STDERR "Don't have format for $ctype\n" unless ($formats->{$ctype});
-                push @codelines, "    ESP_LOGD(TAG, \"From ECU %s, pid %s: got %s=" . ($isbitfield ? "%lx" : $formats->{$ctype}) . "%s\\n\", \"$ECU\", \"" . $functionname . "\", \"$resultname\", " . ($isbitfield ? "(unsigned long)" : "") . "$resultname, " . (($unit && $unit ne "-") ? "\"\\\"$unit\\\"\"" : "\"\"") . ");\n";
+                # field descriptor: pid, offset, type, scale, add, name
+                printf FIELDS "\n#define I3_FLD_%s_%-45s I3_PID_%s_%s, %d, %s, %s, %s, \"%s\"",
+                    $ECU, $resultname, $ECU, $functionname, $offset - $sizes->{$datatype}, $fieldtypes->{$datatype},
+                    float_literal((($mul ne '-') ? $mul : 1) / (($div ne '-' && $div != 0) ? $div : 1)),
+                    float_literal(($add ne '-') ? $add : 0), $resultname;
             }
         }
-        # code
-        print CODE "\n    if (datalen < $offset) {\n        ESP_LOGW(TAG, \"Received %d bytes for %s, expected %d\", datalen, \"I3_PID_${ECU}_" . $functionname . "\", $offset);\n        break;\n    }";
-        print CODE "\n" . join('', @codelines);
     }
 
-    # code
-    print CODE "\n    // ==========  Add your processing here ==========\n";
-    print CODE "    hexdump(rxbuf, type, pid);\n";
-
-    print CODE "\n    break;\n  }";
-
-
     # polllist
     printf POLLLIST "\n%-120s %s",  "  //{ I3_ECU_${ECU}_TX, I3_ECU_${ECU}_RX, VEHICLE_POLL_TYPE_OBDIIEXTENDED, I3_PID_${ECU}_" . $functionname . ",", " {  0,  0,  0,  0 }, 0, ISOTP_EXTADR },   // " . $function->{ID}; 
 }
 
 print "\n";
 print POLLLIST "\n";
-print CODE "\n";
+print FIELDS "\n";
 
 
+sub float_literal {
+    my ($value) = @_;
+
+    my $literal = sprintf("%.9g", $value);
+    $literal .= '.0' unless ($literal =~ /[.e]/);
+    return $literal . 'f';
+}
+
 sub format_desc {
     my ($en, $de) = @_;
     
@@ -62,6 +62,64 @@ bool OvmsVehicleDBC::RegisterCanBusDBCLoaded(int bus, CAN_mode_t mode, const cha
   return true;
   }
 
+/**
+ * SubscribeCanFramesDBC: restrict the bus frame delivery to the messages of its DBC file
+ *  Consecutive message IDs are subscribed as ranges. If there are more than
+ *  VEHICLE_DBC_MAXRANGES ranges, the ranges with the smallest gaps are merged.
+ *  Call after registering the bus. Only use this if the vehicle does not need other frames
+ *  from the bus, or subscribe these additionally (see SubscribeCanFrames()).
+ *  Note: the subscriptions are not updated on a reload of the DBC file.
+ */
+bool OvmsVehicleDBC::SubscribeCanFramesDBC(int bus)
+  {
+  canbus* cbus = GetCanBus(bus);
+  dbcfile* dbc = cbus ? cbus->GetDBC() : NULL;
+  if (dbc == NULL) return false;
+
+  // The message table is sorted by ID, extended IDs have bit 31 set:
+  struct idrange { uint32_t from, to; bool ext; };
+  std::vector<idrange> ranges;
+  for (auto& entry : dbc->m_messages.m_entrymap)
+    {
+    uint32_t id = entry.first & 0x7FFFFFFF;
+    bool ext = (entry.first & 0x80000000) != 0;
+    if (!ranges.empty() && ranges.back().ext == ext && ranges.back().to + 1 == id)
+      ranges.back().to = id;
+    else
+      ranges.push_back({ id, id, ext });
+    }
+  if (ranges.empty()) return false;
+  int messages = dbc->m_messages.m_entrymap.size();
+
+  // Merge the closest neighbours of the same frame format until the ranges fit:
+  while (ranges.size() > VEHICLE_DBC_MAXRANGES)
+    {
+    size_t best = 0;
+    uint32_t bestgap = UINT32_MAX;
+    for (size_t i = 0; i+1 < ranges.size(); i++)
+      {
+      if (ranges[i].ext != ranges[i+1].ext) continue;
+      uint32_t gap = ranges[i+1].from - ranges[i].to;
+      if (gap < bestgap)
+        {
+        bestgap = gap;
+        best = i;
+        }
+      }
+    if (bestgap == UINT32_MAX) break;
+    ranges[best].to = ranges[best+1].to;
+    ranges.erase(ranges.begin() + best + 1);
+    }
+
+  for (const idrange& r : ranges)
+    {
+    if (!SubscribeCanFrames(bus, r.from, r.to))
+      return false;
+    }
+  ESP_LOGI(TAG, "Subscribed %d DBC messages on can%d in %d ranges", messages, bus, (int)ranges.size());
+  return true;
+  }
+
 void OvmsVehicleDBC::IncomingFrameCan1(CAN_frame_t* p_frame)
   {
   // This should be called from the IncomingFrameCan1 handler of the derived vehicle class
@@ -87,27 +145,7 @@ void OvmsVehicleDBC::IncomingFrame(canbus* bus, CAN_frame_t* frame)
 
   dbcMessage* msg = dbc->m_messages.FindMessage(frame->FIR.B.FF, frame->MsgID);
   if (msg)
-    {
-    dbcSignal* mux = msg->GetMultiplexorSignal();
-    uint32_t muxval;
-    if (mux)
-      {
-      dbcNumber r = mux->Decode(frame);
-      muxval = r.GetSignedInteger();
-      }
-    for (dbcSignal* sig : msg->m_signals)
-      {
-      OvmsMetric* m = sig->GetMetric();
-      if (m)
-        {
-        if ((mux==NULL)||(sig->GetMultiplexSwitchvalue() == muxval))
-          {
-          dbcNumber r = sig->Decode(frame);
-          m->SetValue(r);
-          }
-        }
-      }
-    }
+    msg->DecodeMetrics(frame);
   }
 
 OvmsVehiclePureDBC::OvmsVehiclePureDBC()
@@ -120,21 +158,24 @@ OvmsVehiclePureDBC::OvmsVehiclePureDBC()
   if (dbctype.length()>0)
     {
     ESP_LOGI(TAG,"Registering can bus #1 as DBC %s",dbctype.c_str());
-    RegisterCanBusDBCLoaded(1, CAN_MODE_LISTEN, dbctype.c_str());
+    if (RegisterCanBusDBCLoaded(1, CAN_MODE_LISTEN, dbctype.c_str()))
+      SubscribeCanFramesDBC(1);
     }
 
   dbctype = MyConfig.GetParamValue("vehicle", "dbc.can2");
   if (dbctype.length()>0)
     {
     ESP_LOGI(TAG,"Registering can bus #2 as DBC %s",dbctype.c_str());
-    RegisterCanBusDBCLoaded(2, CAN_MODE_LISTEN, dbctype.c_str());
+    if (RegisterCanBusDBCLoaded(2, CAN_MODE_LISTEN, dbctype.c_str()))
+      SubscribeCanFramesDBC(2);
     }
 
   dbctype = MyConfig.GetParamValue("vehicle", "dbc.can3");
   if (dbctype.length()>0)
     {
     ESP_LOGI(TAG,"Registering can bus #3 as DBC %s",dbctype.c_str());
-    RegisterCanBusDBCLoaded(3, CAN_MODE_LISTEN, dbctype.c_str());
+    if (RegisterCanBusDBCLoaded(3, CAN_MODE_LISTEN, dbctype.c_str()))
+      SubscribeCanFramesDBC(3);
     }
   }
 
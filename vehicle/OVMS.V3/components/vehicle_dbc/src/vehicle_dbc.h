@@ -36,6 +36,8 @@
 
 using namespace std;
 
+#define VEHICLE_DBC_MAXRANGES 128   // Max subscription ranges per bus for SubscribeCanFramesDBC()
+
 class OvmsVehicleDBC : public OvmsVehicle
   {
   public:
@@ -45,6 +47,7 @@ class OvmsVehicleDBC : public OvmsVehicle
   protected:
     bool RegisterCanBusDBC(int bus, CAN_mode_t mode, const char* name, const char* dbc);
     bool RegisterCanBusDBCLoaded(int bus, CAN_mode_t mode, const char* dbcloaded);
+    bool SubscribeCanFramesDBC(int bus);
 
   protected:
     virtual void IncomingFrameCan1(CAN_frame_t* p_frame);
@@ -163,6 +163,7 @@ void OvmsVehicleRenaultTwizy::CanResponder(const CAN_frame_t* p_frame)
 
 /**
  * Asynchronous CAN RX handler
+ *  Note: frame IDs handled here need to be subscribed (see constructor)
  */
 
 void OvmsVehicleRenaultTwizy::IncomingFrameCan1(CAN_frame_t* p_frame)
@@ -81,7 +81,7 @@ SevconClient::SevconClient(OvmsVehicleRenaultTwizy* twizy)
   cmd_cfg->RegisterCommand("pre", "Enter configuration mode (pre-operational)", shell_cfg_mode);
   cmd_cfg->RegisterCommand("op", "Leave configuration mode (go operational)", shell_cfg_mode);
 
-  cmd_cfg->RegisterCommand("read", "Read register", shell_cfg_read, "<index_hex> <subindex_hex>", 2, 2);
+  cmd_cfg->RegisterCommand("read", "Read register(s)", shell_cfg_read, "<index_hex> <subindex_hex> [<subindex_end_hex>]", 2, 3);
   cmd_cfg->RegisterCommand("write", "Read & write register", shell_cfg_write, "<index_hex> <subindex_hex> <value>", 3, 3);
   cmd_cfg->RegisterCommand("writeonly", "Write register", shell_cfg_write, "<index_hex> <subindex_hex> <value>", 3, 3);
 
@@ -252,6 +252,52 @@ CANopenResult_t SevconClient::Write(CANopenJob& job, uint16_t index, uint8_t sub
   return res;
 }
 
+// ReadBatch / WriteBatch: transfer a list of registers
+//  - stops at the first failure, the job reflects the failed item
+CANopenResult_t SevconClient::ReadBatch(CANopenJob& job, CANopenSDOItem* items, int count)
+{
+  CANopenResult_t res = CheckBus();
+  if (res != COR_OK) {
+    for (int i = 0; i < count; i++)
+      items[i].result = res;
+    return job.SetResult(res);
+  }
+  res = m_sync.ReadSDOBatch(m_nodeid, items, count, true);
+  return BatchResult(job, "ReadSDO", items, count, res);
+}
+
+CANopenResult_t SevconClient::WriteBatch(CANopenJob& job, CANopenSDOItem* items, int count)
+{
+  CANopenResult_t res = CheckBus();
+  if (res != COR_OK) {
+    for (int i = 0; i < count; i++)
+      items[i].result = res;
+    return job.SetResult(res);
+  }
+  res = m_sync.WriteSDOBatch(m_nodeid, items, count, true);
+  return BatchResult(job, "WriteSDO", items, count, res);
+}
+
+CANopenResult_t SevconClient::BatchResult(CANopenJob& job, const char* op, CANopenSDOItem* items, int count, CANopenResult_t res)
+{
+  if (res == COR_OK)
+    return job.SetResult(res);
+  for (int i = 0; i < count; i++) {
+    CANopenSDOItem& item = items[i];
+    if (item.result == COR_OK)
+      continue;
+    job.sdo.index = item.index;
+    job.sdo.subindex = item.subindex;
+    job.sdo.xfersize = item.xfersize;
+    if (item.error == CANopen_GeneralError && item.index != 0x5310)
+      item.error = GetDeviceError();
+    job.SetResult(item.result, item.error);
+    ESP_LOGD(TAG, "Sevcon %s 0x%04x.%02x failed: %s", op, item.index, item.subindex, GetResultString(job).c_str());
+    break;
+  }
+  return res;
+}
+
 CANopenResult_t SevconClient::RequestState(CANopenJob& job, CANopenNMTCommand_t command, bool wait_for_state)
 {
   CANopenResult_t res = CheckBus();
@@ -148,8 +148,12 @@ class SevconClient : public InternalRamAllocated
     CANopenResult_t Write(CANopenJob& job, uint16_t index, uint8_t subindex, uint32_t value) {
       return Write(job, index, subindex, (uint8_t*)&value, 0);
     }
+    CANopenResult_t ReadBatch(CANopenJob& job, CANopenSDOItem* items, int count);
+    CANopenResult_t WriteBatch(CANopenJob& job, CANopenSDOItem* items, int count);
     CANopenResult_t RequestState(CANopenJob& job, CANopenNMTCommand_t command, bool wait_for_state);
     CANopenResult_t GetHeartbeat(CANopenJob& job, CANopenNMTState_t& var);
+  protected:
+    CANopenResult_t BatchResult(CANopenJob& job, const char* op, CANopenSDOItem* items, int count, CANopenResult_t res);
   
   public:
     // Asynchronous access:
@@ -339,6 +343,14 @@ class SevconJob : public InternalRamAllocated
       m_job.Init();
       return m_client->Write(m_job, index, subindex, value);
     }
+    CANopenResult_t ReadBatch(CANopenSDOItem* items, int count) {
+      m_job.Init();
+      return m_client->ReadBatch(m_job, items, count);
+    }
+    CANopenResult_t WriteBatch(CANopenSDOItem* items, int count) {
+      m_job.Init();
+      return m_client->WriteBatch(m_job, items, count);
+    }
     CANopenResult_t RequestState(CANopenNMTCommand_t command, bool wait_for_state) {
       m_job.Init();
       return m_client->RequestState(m_job, command, wait_for_state);
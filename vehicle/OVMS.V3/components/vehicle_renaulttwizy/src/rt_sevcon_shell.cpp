@@ -136,7 +136,9 @@ void SevconClient::shell_cfg_mode(int verbosity, OvmsWriter* writer, OvmsCommand
 
 
 // Shell command:
-//    xrt cfg read <index_hex> <subindex_hex>
+//    xrt cfg read <index_hex> <subindex_hex> [<subindex_end_hex>]
+// 
+//   a subindex range is read as a batch
 void SevconClient::shell_cfg_read(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   OvmsVehicleRenaultTwizy* twizy = OvmsVehicleRenaultTwizy::GetInstance(writer);
@@ -146,24 +148,40 @@ void SevconClient::shell_cfg_read(int verbosity, OvmsWriter* writer, OvmsCommand
   // parse args:
   uint16_t index = strtol(argv[0], NULL, 16);
   uint8_t subindex = strtol(argv[1], NULL, 16);
+  uint8_t subindex_end = (argc > 2) ? strtol(argv[2], NULL, 16) : subindex;
+  if (subindex_end < subindex) {
+    writer->puts("ERROR: subindex range invalid");
+    return;
+  }
   
   // execute:
   SevconJob sc(twizy);
-  sdo_buffer readval;
-  CANopenResult_t res = sc.Read(index, subindex, (uint8_t*)&readval, sizeof(readval)-1);
-  readval.size = sc.m_job.sdo.xfersize;
-  
-  // output result:
-  if (res != COR_OK)
-  {
-    writer->printf("Read 0x%04x.%02x failed: %s\n", index, subindex, sc.GetResultString().c_str());
+  int count = subindex_end - subindex + 1;
+  sdo_buffer* readval = new sdo_buffer[count];
+  CANopenSDOItem* items = new CANopenSDOItem[count];
+  for (int i = 0; i < count; i++) {
+    items[i].Init(index, subindex + i);
+    items[i].buf = (uint8_t*)&readval[i];
+    items[i].bufsize = sizeof(readval[i].txt)-1;
   }
-  else
-  {
-    writer->printf("Read 0x%04x.%02x: ", index, subindex);
-    readval.print(writer);
-    writer->puts("");
+  sc.ReadBatch(items, count);
+  
+  // output results (the batch stops at the first error):
+  for (int i = 0; i < count; i++) {
+    if (items[i].result != COR_OK) {
+      writer->printf("Read 0x%04x.%02x failed: %s\n", index, subindex + i, sc.GetResultString().c_str());
+      break;
+    }
+    else {
+      readval[i].size = items[i].xfersize;
+      writer->printf("Read 0x%04x.%02x: ", index, subindex + i);
+      readval[i].print(writer);
+      writer->puts("");
+    }
   }
+  
+  delete [] items;
+  delete [] readval;
 }
 
 
@@ -414,6 +414,8 @@ CANopenResult_t SevconClient::CfgMakePowermap(void
   
   SevconJob sc(this);
   CANopenResult_t err;
+  CANopenSDOItem items[2+4+2*(MAP_SEGMENT_CNT+1)];
+  int cnt = 0;
   uint8_t i, pt;
   uint32_t rpm, rpm2, rpm3;
   uint32_t trq;
@@ -425,16 +427,12 @@ CANopenResult_t SevconClient::CfgMakePowermap(void
     && twizy_max_pwr_lo == CFG.DefaultPwrLo && twizy_max_pwr_hi == CFG.DefaultPwrHi) {
 
     // restore default torque map:
-    for (i=0; i<18; i++) {
-      if ((err = sc.Write(0x4611, 0x01+i, CFG.DefaultPMAP[i])) != COR_OK)
-        return err;
-    }
+    for (i=0; i<18; i++)
+      items[cnt++].Init(0x4611, 0x01+i, CFG.DefaultPMAP[i]);
     
     // restore default flux map (only last 2 points):
-    for (i=0; i<4; i++) {
-      if ((err = sc.Write(0x4610, 0x0f+i, CFG.DefaultFMAP[i])) != COR_OK)
-        return err;
-    }
+    for (i=0; i<4; i++)
+      items[cnt++].Init(0x4610, 0x0f+i, CFG.DefaultFMAP[i]);
   }
 
   else {
@@ -527,24 +525,18 @@ CANopenResult_t SevconClient::CfgMakePowermap(void
     
     trq = (twizy_max_trq * 16 + 500) / 1000;
     
-    if ((err = sc.Write(0x4611, 0x01, trq)) != COR_OK)
-      return err;
-    if ((err = sc.Write(0x4611, 0x02, 0)) != COR_OK)
-      return err;
+    items[cnt++].Init(0x4611, 0x01, trq);
+    items[cnt++].Init(0x4611, 0x02, 0);
 
     // adjust flux map (only last 2 points):
     
     if (trq > CFG.DefaultFMAP[2]) {
-      for (i=0; i<4; i++) {
-        if ((err = sc.Write(0x4610, 0x0f+i, CFG.ExtendedFMAP[i])) != COR_OK)
-          return err;
-      }
+      for (i=0; i<4; i++)
+        items[cnt++].Init(0x4610, 0x0f+i, CFG.ExtendedFMAP[i]);
     }
     else {
-      for (i=0; i<4; i++) {
-        if ((err = sc.Write(0x4610, 0x0f+i, CFG.DefaultFMAP[i])) != COR_OK)
-          return err;
-      }
+      for (i=0; i<4; i++)
+        items[cnt++].Init(0x4610, 0x0f+i, CFG.DefaultFMAP[i]);
     }
     
     // calculate rpm & power deltas:
@@ -585,14 +577,16 @@ CANopenResult_t SevconClient::CfgMakePowermap(void
       ESP_LOGD(TAG, "CfgMakePowermap: #%d rpm=%d trq=%.2f pwr=%d", i, rpm, trq/16.0, pwr);
 
       // write into map:
-      if ((err = sc.Write(0x4611, 0x03+(i<<1), trq)) != COR_OK)
-        return err;
-      if ((err = sc.Write(0x4611, 0x04+(i<<1), rpm)) != COR_OK)
-        return err;
+      items[cnt++].Init(0x4611, 0x03+(i<<1), trq);
+      items[cnt++].Init(0x4611, 0x04+(i<<1), rpm);
     }
     
   }
 
+  // write map points (in order, stops at first error):
+  if ((err = sc.WriteBatch(items, cnt)) != COR_OK)
+    return err;
+
   // commit map changes:
   if ((err = sc.Write(0x4641, 0x01, 1)) != COR_OK)
     return err;
@@ -714,14 +708,32 @@ CANopenResult_t SevconClient::CfgReadMaxPower(void)
   SevconJob sc(this);
   CANopenResult_t err;
   uint32_t rpm, trq, curr;
+  CANopenSDOItem items[5];
+
+  // fetch the registers needed in one batch:
+
+  int cnt = 0;
+  if (twizy_max_pwr_lo == 0) {
+    items[cnt++].Init(0x4611, 0x04);
+    items[cnt++].Init(0x4611, 0x03);
+  }
+  if (twizy_max_pwr_hi == 0) {
+    items[cnt++].Init(0x4611, 0x12);
+    items[cnt++].Init(0x4611, 0x11);
+  }
+  if (twizy_max_curr == 0)
+    items[cnt++].Init(0x4641, 0x02);
+  if (cnt == 0)
+    return COR_OK;
+  if ((err = sc.ReadBatch(items, cnt)) != COR_OK)
+    return err;
+  cnt = 0;
 
   // the controller does not store max power, derive it from rpm/trq:
 
   if (twizy_max_pwr_lo == 0) {
-    if ((err = sc.Read(0x4611, 0x04, rpm)) != COR_OK)
-      return err;
-    if ((err = sc.Read(0x4611, 0x03, trq)) != COR_OK)
-      return err;
+    rpm = items[cnt++].value;
+    trq = items[cnt++].value;
     if (trq == CFG.DefaultPMAP[2] && rpm == CFG.DefaultPMAP[3])
       twizy_max_pwr_lo = CFG.DefaultPwrLo;
     else
@@ -729,10 +741,8 @@ CANopenResult_t SevconClient::CfgReadMaxPower(void)
   }
 
   if (twizy_max_pwr_hi == 0) {
-    if ((err = sc.Read(0x4611, 0x12, rpm)) != COR_OK)
-      return err;
-    if ((err = sc.Read(0x4611, 0x11, trq)) != COR_OK)
-      return err;
+    rpm = items[cnt++].value;
+    trq = items[cnt++].value;
     if (trq == CFG.DefaultPMAP[16] && rpm == CFG.DefaultPMAP[17])
       twizy_max_pwr_hi = CFG.DefaultPwrHi;
     else
@@ -742,8 +752,7 @@ CANopenResult_t SevconClient::CfgReadMaxPower(void)
   // read max current level:
   
   if (twizy_max_curr == 0) {
-    if ((err = sc.Read(0x4641, 0x02, curr)) != COR_OK)
-      return err;
+    curr = items[cnt++].value;
     twizy_max_curr = curr / CFG.DefaultCurrStatorMax;
   }
   
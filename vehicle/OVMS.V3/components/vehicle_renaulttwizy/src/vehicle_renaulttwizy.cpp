@@ -135,6 +135,16 @@ OvmsVehicleRenaultTwizy::OvmsVehicleRenaultTwizy()
 
   // init can bus:
   RegisterCanBus(1, CAN_MODE_ACTIVE, CAN_SPEED_500KBPS);
+  // only queue the frames handled by IncomingFrameCan1() (poll responses are added by the poller):
+  SubscribeCanFrames(1, 0x155, 0x155);
+  SubscribeCanFrames(1, 0x196, 0x196);
+  SubscribeCanFrames(1, 0x19F, 0x19F);
+  SubscribeCanFrames(1, 0x424, 0x424);
+  SubscribeCanFrames(1, 0x554, 0x55F);
+  SubscribeCanFrames(1, 0x597, 0x59E);
+  SubscribeCanFrames(1, 0x5D7, 0x5D7);
+  SubscribeCanFrames(1, 0x627, 0x629);
+  SubscribeCanFrames(1, 0x700, 0x700);
   MyCan.RegisterCallback(TAG, std::bind(&OvmsVehicleRenaultTwizy::CanResponder, this, _1));
 
   // init SEVCON connection:
@@ -30,6 +30,7 @@
 
 #include "vfsedit.h"
 #include "openemacs.h"
+#include "ovms_events.h"
 
 size_t vfs_edit_write(struct editor_state* E, const char *buf, size_t nbyte)
   {
@@ -45,6 +46,9 @@ bool vfs_edit_insert(OvmsWriter* writer, void* ctx, char ch)
   editor_process_keypress(ed, ch);
   if (ed->editor_completed)
     {
+    // file may have been saved:
+    if (ed->filename)
+      MyEvents.SignalEvent("system.vfs.file.changed", ed->filename, strlen(ed->filename)+1);
     editor_free(ed);
     free(ed);
     return false;
@@ -479,9 +479,9 @@ void Boot::ErrorCallback(XtExcFrame *frame, int core_id, bool is_abort)
     boot_data.crash_data.bt[i++].pc = 0;
 
   // Save Event debug info:
-  if (!MyEvents.m_current_event.empty())
+  if (MyEvents.m_current_event)
     {
-    strlcpy(boot_data.curr_event_name, MyEvents.m_current_event.c_str(), sizeof(boot_data.curr_event_name));
+    strlcpy(boot_data.curr_event_name, MyEvents.m_current_event, sizeof(boot_data.curr_event_name));
     if (MyEvents.m_current_callback)
       strlcpy(boot_data.curr_event_handler, MyEvents.m_current_callback->m_caller.c_str(), sizeof(boot_data.curr_event_handler));
     else
@@ -37,6 +37,8 @@ static const char *TAG = "config";
 #include <string.h>
 #include <sstream>
 #include <dirent.h>
+#include <vector>
+#include "ovms.h"
 #include "crypt_base64.h"
 #include "ovms_config.h"
 #include "ovms_command.h"
@@ -51,6 +53,13 @@ static const char *TAG = "config";
 
 #define OVMS_CONFIGPATH "/store/ovms_config"
 #define OVMS_MAXVALSIZE 2500
+
+// Write-behind journal:
+//  (Note: the journal path is covered by the OVMS_CONFIGPATH protection)
+#define OVMS_CONFIGJOURNAL "/store/ovms_config.jnl"
+#define OVMS_JOURNAL_DELAY 2          // flush after 2 seconds without changes…
+#define OVMS_JOURNAL_MAXAGE 10        // …but latest 10 seconds after the first change
+#define OVMS_JOURNAL_MAXSIZE 8192     // flush immediately when the journal exceeds this size
 //#define OVMS_PERSIST_METADATA
 
 
@@ -123,6 +132,20 @@ void config_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
     }
   }
 
+void config_flush(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (!MyConfig.ismounted())
+    {
+    writer->puts("Error: config store not mounted");
+    return;
+    }
+
+  int cnt = MyConfig.Flush();
+  writer->printf("Config flushed, %d param(s) written.\n", cnt);
+  if (verbosity >= COMMAND_RESULT_NORMAL)
+    MyConfig.JournalStatus(writer);
+  }
+
 void config_set(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   if (!MyConfig.ismounted()) return;
@@ -392,6 +415,18 @@ OvmsConfig::OvmsConfig()
   ESP_LOGI(TAG, "Initialising CONFIG (1400)");
 
   m_mounted = false;
+  m_journal_size = 0;
+  m_journal_first = 0;
+  m_journal_last = 0;
+  m_journal_records = 0;
+  m_flush_count = 0;
+  m_flush_params = 0;
+  m_generation = 1;
+
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&OvmsConfig::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "system.shuttingdown", std::bind(&OvmsConfig::EventListener, this, _1, _2));
 
   OvmsCommand* cmd_store = MyCommandApp.RegisterCommand("store","STORE framework");
   cmd_store->RegisterCommand("mount","Mount STORE",store_mount);
@@ -401,6 +436,7 @@ OvmsConfig::OvmsConfig()
   cmd_config->RegisterCommand("list","Show configuration parameters/instances",config_list,"[<param>]",0,1, true, config_validate);
   cmd_config->RegisterCommand("set","Set parameter:instance=value",config_set,"<param> <instance> <value>",3,3, true, config_validate);
   cmd_config->RegisterCommand("rm","Remove parameter:instance",config_rm,"<param> {<instance> | *}",2,2, true, config_validate);
+  cmd_config->RegisterCommand("flush","Write pending changes to the config store",config_flush);
 
 #ifdef CONFIG_OVMS_SC_ZIP
   cmd_config->RegisterCommand("backup", "Backup to file", config_backup,
@@ -456,6 +492,7 @@ esp_err_t OvmsConfig::mount()
   m_store_fat.max_files = 5;
   esp_vfs_fat_spiflash_mount("/store", "store", &m_store_fat, &m_store_wlh);
   m_mounted = true;
+  Changed();
 
   struct stat ds;
   if (stat(OVMS_CONFIGPATH, &ds) != 0)
@@ -463,6 +500,7 @@ esp_err_t OvmsConfig::mount()
     ESP_LOGI(TAG, "Initialising OVMS CONFIG within STORE");
     mkdir(OVMS_CONFIGPATH,0);
     }
+  RecoverParamFiles();
 
   DIR *dir;
   struct dirent *dp;
@@ -473,6 +511,9 @@ esp_err_t OvmsConfig::mount()
     }
   while ((dp = readdir(dir)) != NULL)
     {
+    // Skip unrecoverable temporary files:
+    if (endsWith(std::string(dp->d_name), '~'))
+      continue;
     // Register the param in case this was not already done
     if (CachedParam(dp->d_name) == NULL)
       RegisterParam(dp->d_name, "", true, false);
@@ -484,6 +525,8 @@ esp_err_t OvmsConfig::mount()
     {
     it->second->Load();
     }
+  ReplayJournal();
+  Changed();
   upgrade();
 
   MyEvents.SignalEvent("config.mounted", NULL);
@@ -497,8 +540,10 @@ esp_err_t OvmsConfig::unmount()
 
   if (m_mounted)
     {
+    Flush();
     esp_vfs_fat_spiflash_unmount("/store", m_store_wlh);
     m_mounted = false;
+    Changed();
     MyEvents.SignalEvent("config.unmounted", NULL);
     }
 
@@ -510,6 +555,341 @@ bool OvmsConfig::ismounted()
   return m_mounted;
   }
 
+/**
+ * Write-behind journal
+ *
+ * Config changes are applied to the param maps immediately, but instead of
+ * rewriting the param file on every change, a change record is appended to
+ * the journal file. Pending changes are compacted into the param files by
+ * Flush(), which is called by the ticker after OVMS_JOURNAL_DELAY seconds
+ * without further changes (latest after OVMS_JOURNAL_MAXAGE seconds), when
+ * the journal exceeds OVMS_JOURNAL_MAXSIZE, on shutdown and unmount, and by
+ * the "config flush" command. "config.changed" is signalled once per changed
+ * param by the flush.
+ *
+ * Journal records are lines of tab separated fields:
+ *  S <param> <instance> <value>    -- set instance
+ *  D <param> <instance>            -- delete instance
+ *  X <param>                       -- delete param
+ *
+ * After a crash or power loss, the journal is replayed on the next mount.
+ * A torn last record (missing newline) is discarded. Param files are written
+ * to a temporary file ("<param>~") and then renamed, so a crash during the
+ * flush leaves either the old or the new file, and replaying the journal again
+ * yields the same result.
+ */
+
+void OvmsConfig::JournalSet(OvmsConfigParam* param, const std::string& instance, const std::string& value)
+  {
+  std::string record = "S\t";
+  record.append(param->m_name);
+  record.append("\t");
+  record.append(instance);
+  record.append("\t");
+  record.append(value);
+  record.append("\n");
+  JournalAppend(param, record);
+  }
+
+void OvmsConfig::JournalDelete(OvmsConfigParam* param, const std::string& instance)
+  {
+  std::string record = "D\t";
+  record.append(param->m_name);
+  record.append("\t");
+  record.append(instance);
+  record.append("\n");
+  JournalAppend(param, record);
+  }
+
+void OvmsConfig::JournalDeleteParam(OvmsConfigParam* param)
+  {
+  std::string record = "X\t";
+  record.append(param->m_name);
+  record.append("\n");
+  JournalAppend(NULL, record);
+  }
+
+/**
+ * JournalAppend: write a change record, mark the param as dirty
+ *  - if the journal cannot be written, the change is flushed immediately
+ */
+void OvmsConfig::JournalAppend(OvmsConfigParam* param, const std::string& record)
+  {
+  bool flush = false;
+    {
+    OvmsMutexLock store_lock(&m_store_lock);
+    if (!m_mounted)
+      {
+      ESP_LOGW(TAG, "Journal: store not mounted, change lost: %s", record.c_str());
+      return;
+      }
+
+    FILE* f = fopen(OVMS_CONFIGJOURNAL, "a");
+    if (!f)
+      {
+      ESP_LOGE(TAG, "Journal: can't open '%s': %s", OVMS_CONFIGJOURNAL, strerror(errno));
+      flush = true;
+      }
+    else
+      {
+      size_t written = fwrite(record.data(), 1, record.size(), f);
+      if (fclose(f) || written != record.size())
+        {
+        ESP_LOGE(TAG, "Journal: error writing '%s': %s", OVMS_CONFIGJOURNAL, strerror(errno));
+        flush = true;
+        }
+      m_journal_size += written;
+      m_journal_records++;
+      }
+
+    if (param)
+      {
+      if (m_dirty.empty())
+        m_journal_first = monotonictime;
+      m_journal_last = monotonictime;
+      m_dirty.insert(param);
+      }
+    if (m_journal_size >= OVMS_JOURNAL_MAXSIZE)
+      flush = true;
+    }
+
+  if (flush)
+    Flush();
+  }
+
+/**
+ * Flush: compact pending changes into the param files
+ *  - signal: send "config.changed" for each param written
+ *  - returns the number of param files written
+ *  - the journal is removed if all files have been written successfully,
+ *    params failing to be written stay dirty for the next attempt
+ */
+int OvmsConfig::Flush(bool signal /*=true*/)
+  {
+  std::vector<OvmsConfigParam*> flushed;
+
+  m_store_lock.Lock();
+  if (!m_mounted)
+    {
+    m_store_lock.Unlock();
+    return 0;
+    }
+
+  for (auto it = m_dirty.begin(); it != m_dirty.end(); )
+    {
+    if ((*it)->RewriteConfig())
+      {
+      flushed.push_back(*it);
+      it = m_dirty.erase(it);
+      }
+    else
+      {
+      ++it;
+      }
+    }
+
+  if (m_dirty.empty())
+    {
+    if (m_journal_size > 0 && unlink(OVMS_CONFIGJOURNAL) != 0 && errno != ENOENT)
+      ESP_LOGE(TAG, "Flush: can't remove journal: %s", strerror(errno));
+    m_journal_size = 0;
+    }
+  else
+    {
+    // retry after the flush delay:
+    m_journal_last = m_journal_first = monotonictime;
+    }
+
+  if (!flushed.empty())
+    {
+    m_flush_count++;
+    m_flush_params += flushed.size();
+    }
+  m_store_lock.Unlock();
+
+  if (!flushed.empty())
+    ESP_LOGD(TAG, "Flush: %d param(s) written", (int)flushed.size());
+
+  if (signal)
+    {
+    for (OvmsConfigParam* p : flushed)
+      MyEvents.SignalEvent("config.changed", p);
+    }
+
+  return flushed.size();
+  }
+
+/**
+ * ReplayJournal: apply changes left over from the last session (on mount)
+ *  - an unterminated last line is a torn write and ends the replay,
+ *    overlong lines are skipped as invalid
+ */
+void OvmsConfig::ReplayJournal()
+  {
+  FILE* f = fopen(OVMS_CONFIGJOURNAL, "r");
+  if (!f)
+    return;
+
+  const size_t bufsize = OVMS_MAXVALSIZE + 256;
+  char* buf = new char[bufsize];
+  int records = 0, invalid = 0;
+  std::set<OvmsConfigParam*> dirty;
+  while (fgets(buf, bufsize, f))
+    {
+    size_t len = strlen(buf);
+    if (len == 0 || buf[len-1] != '\n')
+      {
+      if (feof(f))
+        {
+        ESP_LOGW(TAG, "Journal: discarding incomplete record");
+        break;
+        }
+      // skip the rest of the line:
+      int c;
+      while ((c = fgetc(f)) != EOF && c != '\n')
+        ;
+      invalid++;
+      continue;
+      }
+    buf[len-1] = 0;
+
+    // split fields:
+    char* field[4] = { buf, NULL, NULL, NULL };
+    int fields = 1;
+    while (fields < 4 && (field[fields] = strchr(field[fields-1], '\t')) != NULL)
+      {
+      *field[fields]++ = 0;
+      fields++;
+      }
+    if (fields < 2 || field[0][0] == 0 || field[0][1] != 0 || field[1][0] == 0)
+      {
+      invalid++;
+      continue;
+      }
+
+    std::string name(field[1]);
+    auto k = m_map.find(name);
+    OvmsConfigParam* p = (k != m_map.end()) ? k->second : NULL;
+
+    if (field[0][0] == 'S' && fields == 4)
+      {
+      if (!p)
+        {
+        RegisterParam(name, "", true, false);
+        p = m_map[name];
+        }
+      p->m_map[field[2]] = field[3];
+      dirty.insert(p);
+      }
+    else if (field[0][0] == 'D' && fields == 3)
+      {
+      if (p)
+        {
+        p->m_map.erase(field[2]);
+        dirty.insert(p);
+        }
+      }
+    else if (field[0][0] == 'X' && fields == 2)
+      {
+      if (p)
+        {
+        std::string path(OVMS_CONFIGPATH);
+        path.append("/");
+        path.append(name);
+        unlink(path.c_str());
+        dirty.erase(p);
+          {
+          OvmsMutexLock store_lock(&m_store_lock);
+          m_dirty.erase(p);
+          }
+        delete p;
+        m_map.erase(k);
+        }
+      }
+    else
+      {
+      invalid++;
+      continue;
+      }
+    records++;
+    }
+  delete[] buf;
+  fclose(f);
+
+  m_store_lock.Lock();
+  m_dirty.insert(dirty.begin(), dirty.end());
+  m_journal_size = 1; // ensure removal by Flush()
+  m_store_lock.Unlock();
+  int params = Flush(false);
+  ESP_LOGI(TAG, "Journal: replayed %d record(s) into %d param(s), %d invalid", records, params, invalid);
+  }
+
+/**
+ * RecoverParamFiles: complete param file replacements interrupted by a crash
+ */
+void OvmsConfig::RecoverParamFiles()
+  {
+  std::vector<std::string> tempfiles;
+  DIR *dir = opendir(OVMS_CONFIGPATH);
+  if (!dir)
+    return;
+  struct dirent *dp;
+  while ((dp = readdir(dir)) != NULL)
+    {
+    if (endsWith(std::string(dp->d_name), '~'))
+      tempfiles.push_back(dp->d_name);
+    }
+  closedir(dir);
+
+  for (const std::string& name : tempfiles)
+    {
+    std::string tmppath = std::string(OVMS_CONFIGPATH) + "/" + name;
+    std::string path = tmppath.substr(0, tmppath.size()-1);
+    if (path_exists(path))
+      {
+      // old file still valid, temporary file may be incomplete:
+      unlink(tmppath.c_str());
+      }
+    else
+      {
+      // old file removed, temporary file is complete:
+      ESP_LOGW(TAG, "Recovering param file '%s'", path.c_str());
+      rename(tmppath.c_str(), path.c_str());
+      }
+    }
+  }
+
+void OvmsConfig::JournalStatus(OvmsWriter* writer)
+  {
+  OvmsMutexLock store_lock(&m_store_lock);
+  writer->printf("Journal: %u bytes, %u param(s) pending\n",
+    (unsigned)m_journal_size, (unsigned)m_dirty.size());
+  writer->printf("Statistics: %u record(s) journaled, %u flush(es), %u param file(s) written\n",
+    m_journal_records, m_flush_count, m_flush_params);
+  }
+
+void OvmsConfig::EventListener(std::string event, void* data)
+  {
+  bool flush = false;
+  m_store_lock.Lock();
+  if (!m_dirty.empty())
+    {
+    if (event == "ticker.1")
+      {
+      flush = (monotonictime - m_journal_last >= OVMS_JOURNAL_DELAY ||
+               monotonictime - m_journal_first >= OVMS_JOURNAL_MAXAGE);
+      }
+    else if (event == "system.shuttingdown")
+      {
+      flush = true;
+      }
+    }
+  m_store_lock.Unlock();
+
+  if (flush)
+    Flush();
+  }
+
 void OvmsConfig::upgrade()
   {
   // Migrate password/changed → module/init:
@@ -581,6 +961,7 @@ void OvmsConfig::RegisterParam(std::string name, std::string title, bool writabl
     k->second->SetTitle(title);
     k->second->SetAccess(writable, readable);
     }
+  Changed();
   }
 
 void OvmsConfig::DeregisterParam(std::string name)
@@ -785,6 +1166,7 @@ bool OvmsConfig::Backup(std::string path, std::string password, OvmsWriter* writ
   else
     ESP_LOGD(TAG, "Backup: creating '%s'...", path.c_str());
 
+  Flush();
   OvmsMutexLock store_lock(&m_store_lock);
   bool ok = true;
 
@@ -939,6 +1321,14 @@ bool OvmsConfig::Restore(std::string path, std::string password, OvmsWriter* wri
     return false;
     }
 
+  // discard pending changes, the restored config replaces them; detach the
+  //  store until the reboot, so no new changes get journaled or flushed:
+  m_dirty.clear();
+  unlink(OVMS_CONFIGJOURNAL);
+  m_journal_size = 0;
+  m_mounted = false;
+  m_store_lock.Unlock();
+
   if (writer)
     writer->puts("Done, rebooting now...");
   else
@@ -1041,17 +1431,22 @@ void OvmsConfigParam::LoadConfig()
 
 void OvmsConfigParam::SetValue(std::string instance, std::string value)
   {
-  if (m_map.find(instance) == m_map.end() || m_map[instance] != value)
+  auto k = m_map.find(instance);
+  if (k == m_map.end() || k->second != value)
     {
     m_map[instance] = value;
-    RewriteConfig();
-    MyEvents.SignalEvent("config.changed", this);
+    MyConfig.Changed();
+    MyConfig.JournalSet(this, instance, value);
     }
   }
 
 void OvmsConfigParam::DeleteParam()
   {
+  MyConfig.Changed();
+  MyConfig.JournalDeleteParam(this);
+
   OvmsMutexLock store_lock(&MyConfig.m_store_lock);
+  MyConfig.m_dirty.erase(this);
 
   std::string path(OVMS_CONFIGPATH);
   path.append("/");
@@ -1062,16 +1457,13 @@ void OvmsConfigParam::DeleteParam()
 
 bool OvmsConfigParam::DeleteInstance(std::string instance)
   {
-  bool ret = false;
   auto k = m_map.find(instance);
-  if (k != m_map.end())
-    {
-    m_map.erase(k);
-    RewriteConfig();
-    ret = true;
-    }
-  MyEvents.SignalEvent("config.changed", this);
-  return ret;
+  if (k == m_map.end())
+    return false;
+  m_map.erase(k);
+  MyConfig.Changed();
+  MyConfig.JournalDelete(this, instance);
+  return true;
   }
 
 std::string OvmsConfigParam::GetValue(std::string instance)
@@ -1115,16 +1507,23 @@ std::string OvmsConfigParam::GetName()
   return m_name;
   }
 
-void OvmsConfigParam::RewriteConfig()
+/**
+ * RewriteConfig: write the param file
+ *  - the caller must hold MyConfig.m_store_lock
+ *  - the file is replaced atomically via a temporary file, see RecoverParamFiles()
+ */
+bool OvmsConfigParam::RewriteConfig()
   {
-  OvmsMutexLock store_lock(&MyConfig.m_store_lock);
-
   std::string path(OVMS_CONFIGPATH);
   path.append("/");
   path.append(m_name);
-  FILE* f = fopen(path.c_str(), "w");
+  std::string tmppath = path + "~";
+  FILE* f = fopen(tmppath.c_str(), "w");
   if (!f)
-    ESP_LOGE(TAG, "RewriteConfig: can't open '%s': %s", path.c_str(), strerror(errno));
+    {
+    ESP_LOGE(TAG, "RewriteConfig: can't open '%s': %s", tmppath.c_str(), strerror(errno));
+    return false;
+    }
   else
     {
 #ifdef OVMS_PERSIST_METADATA
@@ -1138,7 +1537,18 @@ void OvmsConfigParam::RewriteConfig()
       fprintf(f,"%s\t%s\n",it->first.c_str(),it->second.c_str());
       }
     if (fclose(f))
-      ESP_LOGE(TAG, "RewriteConfig: error writing '%s': %s", path.c_str(), strerror(errno));
+      {
+      ESP_LOGE(TAG, "RewriteConfig: error writing '%s': %s", tmppath.c_str(), strerror(errno));
+      unlink(tmppath.c_str());
+      return false;
+      }
+    unlink(path.c_str());
+    if (rename(tmppath.c_str(), path.c_str()) != 0)
+      {
+      ESP_LOGE(TAG, "RewriteConfig: can't rename '%s': %s", tmppath.c_str(), strerror(errno));
+      return false;
+      }
+    return true;
     }
   }
 
@@ -1147,12 +1557,19 @@ void OvmsConfigParam::Load()
   if (!m_loaded) LoadConfig();
   }
 
+/**
+ * Save: write the param file after a direct modification of m_map
+ *  - pending journaled changes are flushed along with it
+ */
 void OvmsConfigParam::Save()
   {
   if (m_name != "")
     {
-    RewriteConfig();
-    MyEvents.SignalEvent("config.changed", this);
+    MyConfig.Changed();
+    MyConfig.m_store_lock.Lock();
+    MyConfig.m_dirty.insert(this);
+    MyConfig.m_store_lock.Unlock();
+    MyConfig.Flush();
     }
   }
 
@@ -1166,3 +1583,37 @@ void OvmsConfigParam::SetMap(ConfigParamMap& map)
   m_map = std::move(map);
   Save();
   }
+
+/**
+ * ConfigHandle: lookup & value parsers
+ */
+const std::string* ConfigHandleBase::Lookup()
+  {
+  OvmsConfigParam* p = MyConfig.CachedParam(m_param);
+  if (!p)
+    return NULL;
+  auto k = p->m_map.find(m_instance);
+  if (k == p->m_map.end())
+    return NULL;
+  return &k->second;
+  }
+
+template <> void ConfigParseValue(const std::string& str, int& value)
+  {
+  value = atoi(str.c_str());
+  }
+
+template <> void ConfigParseValue(const std::string& str, float& value)
+  {
+  value = atof(str.c_str());
+  }
+
+template <> void ConfigParseValue(const std::string& str, bool& value)
+  {
+  value = strtobool(str);
+  }
+
+template <> void ConfigParseValue(const std::string& str, std::string& value)
+  {
+  value = str;
+  }
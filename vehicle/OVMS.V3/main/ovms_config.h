@@ -33,6 +33,8 @@
 
 #include "string"
 #include "map"
+#include "set"
+#include <atomic>
 #include "esp_err.h"
 #include "esp_vfs_fat.h"
 #include "wear_levelling.h"
@@ -65,9 +67,11 @@ class OvmsConfigParam
     void SetMap(ConfigParamMap& map);
 
   protected:
-    void RewriteConfig();
+    bool RewriteConfig();
     void LoadConfig();
 
+  friend class OvmsConfig;
+
   protected:
     std::string m_name;
     std::string m_title;
@@ -126,17 +130,46 @@ class OvmsConfig
     esp_err_t unmount();
     bool ismounted();
 
+  public:
+    int Flush(bool signal=true);
+    void JournalStatus(OvmsWriter* writer);
+    void EventListener(std::string event, void* data);
+
+  protected:
+    void JournalSet(OvmsConfigParam* param, const std::string& instance, const std::string& value);
+    void JournalDelete(OvmsConfigParam* param, const std::string& instance);
+    void JournalDeleteParam(OvmsConfigParam* param);
+    void JournalAppend(OvmsConfigParam* param, const std::string& record);
+    void ReplayJournal();
+    void RecoverParamFiles();
+
   public:
     void SupportSummary(OvmsWriter* writer);
 
+  public:
+    uint32_t GetGeneration() { return m_generation; }
+    void Changed() { m_generation++; }
+
   protected:
     void upgrade();
 
+  friend class OvmsConfigParam;
+
   protected:
     bool m_mounted;
     esp_vfs_fat_mount_config_t m_store_fat;
     wl_handle_t m_store_wlh;
 
+  protected:
+    std::set<OvmsConfigParam*> m_dirty;     // params with journaled changes, protected by m_store_lock
+    size_t m_journal_size;                  // current journal file size
+    uint32_t m_journal_first;               // monotonictime of the first pending change
+    uint32_t m_journal_last;                // monotonictime of the last pending change
+    uint32_t m_journal_records;             // statistics: records written
+    uint32_t m_flush_count;                 // statistics: flushes done
+    uint32_t m_flush_params;                // statistics: param files written
+    std::atomic<uint32_t> m_generation;     // incremented on every config change, see ConfigHandle
+
   public:
     ConfigMap m_map;
     OvmsMutex m_store_lock;
@@ -144,4 +177,97 @@ class OvmsConfig
 
 extern OvmsConfig MyConfig;
 
+/**
+ * ConfigHandle<T>: typed config instance reader for hot code paths
+ *
+ * Replaces MyConfig.GetParamValueInt/Float/Bool(…) calls in tickers & frame
+ * handlers: the param & instance are resolved and the value is parsed on the
+ * first read and after config changes only, normal reads just compare the
+ * config generation counter and do not allocate. Value semantics are those of
+ * the GetParamValue*() getters, i.e. undefined and empty instances yield the
+ * default value.
+ *
+ * Supported types: int, float, bool, std::string
+ *
+ * Usage:
+ *   ConfigHandle<float> m_cfg_ref("vehicle", "12v.ref", 12.6);
+ *   …
+ *   if (volt < m_cfg_ref) …
+ *
+ * Note: handles cache their value without locking, use a handle from one
+ *  task only. Changes done by modifying a param map directly are only seen
+ *  after the param has been saved (OvmsConfigParam::Save()).
+ */
+
+template <typename T> void ConfigParseValue(const std::string& str, T& value);
+template <> void ConfigParseValue(const std::string& str, int& value);
+template <> void ConfigParseValue(const std::string& str, float& value);
+template <> void ConfigParseValue(const std::string& str, bool& value);
+template <> void ConfigParseValue(const std::string& str, std::string& value);
+
+class ConfigHandleBase
+  {
+  public:
+    ConfigHandleBase(const char* param, const char* instance)
+      : m_param(param), m_instance(instance), m_generation(0) {}
+
+  public:
+    const std::string& GetParam() { return m_param; }
+    const std::string& GetInstance() { return m_instance; }
+    void Invalidate() { m_generation = 0; }
+
+  protected:
+    bool IsStale() { return m_generation != MyConfig.GetGeneration(); }
+    const std::string* Lookup();
+
+  protected:
+    std::string m_param;
+    std::string m_instance;
+    uint32_t m_generation;
+  };
+
+template <typename T>
+class ConfigHandle : public ConfigHandleBase
+  {
+  public:
+    ConfigHandle(const char* param, const char* instance, const T& defvalue = T())
+      : ConfigHandleBase(param, instance), m_defvalue(defvalue), m_value(defvalue), m_defined(false) {}
+
+  public:
+    const T& Get()
+      {
+      if (IsStale()) Refresh();
+      return m_value;
+      }
+    operator const T&() { return Get(); }
+    bool IsDefined()
+      {
+      if (IsStale()) Refresh();
+      return m_defined;
+      }
+    void SetDefault(const T& defvalue)
+      {
+      m_defvalue = defvalue;
+      Invalidate();
+      }
+
+  protected:
+    void Refresh()
+      {
+      // Note: generation is taken first, so a concurrent change triggers another refresh
+      m_generation = MyConfig.GetGeneration();
+      const std::string* str = Lookup();
+      m_defined = (str != NULL);
+      if (str && !str->empty())
+        ConfigParseValue(*str, m_value);
+      else
+        m_value = m_defvalue;
+      }
+
+  protected:
+    T m_defvalue;
+    T m_value;
+    bool m_defined;
+  };
+
 #endif //#ifndef __CONFIG_H__
@@ -33,7 +33,9 @@ static const char *TAG = "events";
 
 #include <string.h>
 #include <stdio.h>
+#include <algorithm>
 #include <esp_event_loop.h>
+#include <esp_timer.h>
 #include <esp_task_wdt.h>
 #include "ovms_module.h"
 #include "ovms_events.h"
@@ -93,21 +95,76 @@ void event_trace(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
   writer->printf("Event tracing is now %s\n",cmd->GetName());
   }
 
+static bool event_stats_cmp(const EventEntry* a, const EventEntry* b)
+  {
+  return a->m_time_total > b->m_time_total;
+  }
+
 void event_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
-  writer->printf("Event map has %d listeners, and queue has %d/%d entries\n",
+  bool reset = (argc > 0 && strcmp(argv[0], "reset") == 0);
+  EventEntryVector stats;
+  MyEvents.GetEventStats(stats, reset);
+
+  writer->printf("Event map has %d listeners, %d interned events, and queue has %d/%d entries\n",
     MyEvents.Map().size(),
+    stats.size(),
     uxQueueMessagesWaiting(MyEvents.m_taskqueue),
     CONFIG_OVMS_HW_EVENT_QUEUE_SIZE);
+  MyScripts.EventIndexStatus(writer);
 
+  const char* current = MyEvents.m_current_event;
   EventCallbackEntry* cbe = MyEvents.m_current_callback;
-  if (cbe != NULL)
+  if (current != NULL && cbe != NULL)
     {
     writer->printf("Currently dispatching:\n");
-    writer->printf("  Event: %s\n",MyEvents.m_current_event.c_str());
+    writer->printf("  Event: %s\n",current);
     writer->printf("  To:    %s\n",cbe->m_caller.c_str());
     writer->printf("  For:   %u second(s)\n",monotonictime-MyEvents.m_current_started);
     }
+
+  if (reset)
+    {
+    writer->puts("Dispatch statistics reset");
+    return;
+    }
+
+  // Dispatch time histograms, most expensive events first:
+  stats.erase(std::remove_if(stats.begin(), stats.end(),
+    [](const EventEntry* e) { return e->m_count == 0; }), stats.end());
+  if (stats.empty())
+    return;
+  std::sort(stats.begin(), stats.end(), event_stats_cmp);
+
+  writer->printf("\nDispatch times [us]:\n%-32s %7s %7s %7s",
+    "Event", "Count", "Avg", "Max");
+  if (verbosity >= COMMAND_RESULT_NORMAL)
+    {
+    char label[8];
+    for (int i = 0; i < EVENT_HIST_BUCKETS-1; i++)
+      {
+      if (i < 4)
+        snprintf(label, sizeof(label), "<%u", 64 << i);
+      else
+        snprintf(label, sizeof(label), "<%uk", 1 << (i-4));
+      writer->printf(" %6s", label);
+      }
+    writer->printf(" %6s\n", ">=64k");
+    }
+  else
+    writer->puts("");
+
+  for (EventEntry* e : stats)
+    {
+    writer->printf("%-32.32s %7u %7u %7u",
+      e->m_name.c_str(), e->m_count, (uint32_t)(e->m_time_total / e->m_count), e->m_time_max);
+    if (verbosity >= COMMAND_RESULT_NORMAL)
+      {
+      for (int i = 0; i < EVENT_HIST_BUCKETS; i++)
+        writer->printf(" %6u", e->m_hist[i]);
+      }
+    writer->puts("");
+    }
   }
 
 void event_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
@@ -195,6 +252,10 @@ OvmsEvents::OvmsEvents()
   ESP_LOGI(TAG, "Initialising EVENTS (1200)");
 
   m_current_callback = NULL;
+  m_current_event = NULL;
+  m_current_started = 0;
+  m_resolve = false;
+  m_events.push_back(NULL); // EVENT_ID_NONE
 
 #ifdef CONFIG_OVMS_DEV_DEBUGEVENTS
   m_trace = true;
@@ -206,7 +267,7 @@ OvmsEvents::OvmsEvents()
 
   // Register our commands
   OvmsCommand* cmd_event = MyCommandApp.RegisterCommand("event","EVENT framework", event_status, "", 0, 0, false);
-  cmd_event->RegisterCommand("status","Show status of event system",event_status);
+  cmd_event->RegisterCommand("status","Show status & dispatch time statistics of event system",event_status,"[reset]", 0, 1);
   cmd_event->RegisterCommand("list","List registered events",event_list,"[<key>]", 0, 1);
   cmd_event->RegisterCommand("raise","Raise a textual event",event_raise,"[-d<delay_ms>] <event>", 1, 2, true, event_validate);
   OvmsCommand* cmd_eventtrace = cmd_event->RegisterCommand("trace","EVENT trace framework");
@@ -243,10 +304,9 @@ void OvmsEvents::EventTask()
         case EVENT_none:
           break;
         case EVENT_signal:
-          m_current_event = msg.body.signal.event;
           HandleQueueSignalEvent(&msg);
           esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
-          m_current_event.clear();
+          m_current_event = NULL;
           break;
         default:
           break;
@@ -271,52 +331,77 @@ void OvmsEvents::EventTask()
     }
   }
 
+void OvmsEvents::Dispatch(const EventCallbackVector& dispatch, const std::string& event, void* data)
+  {
+  for (EventCallbackEntry* cbe : dispatch)
+    {
+    if (!cbe->m_active)
+      continue; // deregistered by a previous callback
+    m_current_started = monotonictime;
+    m_current_callback = cbe;
+    cbe->m_callback(event, data);
+    m_current_callback = NULL;
+    }
+  }
+
 void OvmsEvents::HandleQueueSignalEvent(event_queue_t* msg)
   {
+  EventEntry* entry = NULL;
+  int64_t started = esp_timer_get_time();
+
+  if (m_resolve)
+    ResolveListeners();
+
+  if (msg->body.signal.id != EVENT_ID_NONE)
+    {
+    OvmsMutexLock lock(&m_registry_mutex);
+    if (msg->body.signal.id < m_events.size())
+      entry = m_events[msg->body.signal.id];
+    }
+  else if (msg->body.signal.event)
+    {
+    // The event may have been interned after it has been signalled:
+    OvmsMutexLock lock(&m_registry_mutex);
+    auto k = m_ids.find(msg->body.signal.event);
+    if (k != m_ids.end())
+      entry = m_events[k->second];
+    }
+
+  if (entry)
+    m_current_event = entry->m_name.c_str();
+  else if (msg->body.signal.event)
+    m_current_event = msg->body.signal.event;
+  else
+    {
+    ESP_LOGE(TAG, "Signal: unknown event id %u dropped", msg->body.signal.id);
+    FreeQueueSignalEvent(msg);
+    return;
+    }
+
   // Log everything but the ticker & clock signals
-  if (!startsWith(m_current_event, "ticker.") && !startsWith(m_current_event, "clock."))
+  if (strncmp(m_current_event, "ticker.", 7) != 0 && strncmp(m_current_event, "clock.", 6) != 0)
     {
     if (m_trace)
-      ESP_LOGI(TAG, "Signal(%s)",m_current_event.c_str());
+      ESP_LOGI(TAG, "Signal(%s)",m_current_event);
     else
-      ESP_LOGD(TAG, "Signal(%s)",m_current_event.c_str());
+      ESP_LOGD(TAG, "Signal(%s)",m_current_event);
     }
 
-  auto k = m_map.find(m_current_event);
-  if (k != m_map.end())
+  if (entry)
     {
-    EventCallbackList* el = k->second;
-    if (el)
-      {
-      for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); ++itc)
-        {
-        m_current_started = monotonictime;
-        m_current_callback = *itc;
-        m_current_callback->m_callback(m_current_event, msg->body.signal.data);
-        m_current_callback = NULL;
-        }
-      }
+    Dispatch(entry->m_dispatch, entry->m_name, msg->body.signal.data);
+    m_current_started = monotonictime;
+    MyScripts.EventScript(entry->m_name, msg->body.signal.data);
+    entry->AddTime(esp_timer_get_time() - started);
     }
-
-  k = m_map.find("*");
-  if (k != m_map.end())
+  else
     {
-    EventCallbackList* el = k->second;
-    if (el)
-      {
-      for (EventCallbackList::iterator itc=el->begin(); itc!=el->end(); ++itc)
-        {
-        m_current_started = monotonictime;
-        m_current_callback = *itc;
-        m_current_callback->m_callback(m_current_event, msg->body.signal.data);
-        m_current_callback = NULL;
-        }
-      }
+    std::string event(m_current_event);
+    Dispatch(m_wildcard, event, msg->body.signal.data);
+    m_current_started = monotonictime;
+    MyScripts.EventScript(event, msg->body.signal.data);
     }
 
-  m_current_started = monotonictime;
-  MyScripts.EventScript(m_current_event, msg->body.signal.data);
-
   FreeQueueSignalEvent(msg);
   }
 
@@ -324,13 +409,112 @@ void OvmsEvents::FreeQueueSignalEvent(event_queue_t* msg)
   {
   if (msg->body.signal.donefn != NULL)
     {
-    msg->body.signal.donefn(msg->body.signal.event, msg->body.signal.data);
+    const char* event = msg->body.signal.event;
+    if (!event)
+      event = GetEventName(msg->body.signal.id);
+    msg->body.signal.donefn(event, msg->body.signal.data);
+    }
+  if (msg->body.signal.event)
+    free(msg->body.signal.event);
+  }
+
+/**
+ * ResolveListeners: rebuild the per event dispatch vectors from the listener map
+ *  and free the deregistered callback entries. Called by the event task only,
+ *  so the vectors are never modified while being dispatched.
+ */
+void OvmsEvents::ResolveListeners()
+  {
+  OvmsMutexLock lock(&m_registry_mutex);
+  m_resolve = false;
+
+  m_wildcard.clear();
+  auto k = m_map.find("*");
+  if (k != m_map.end())
+    m_wildcard.assign(k->second->begin(), k->second->end());
+
+  for (EventEntry* entry : m_events)
+    {
+    if (!entry)
+      continue;
+    entry->m_dispatch.clear();
+    k = m_map.find(entry->m_name);
+    if (k != m_map.end())
+      entry->m_dispatch.assign(k->second->begin(), k->second->end());
+    entry->m_dispatch.insert(entry->m_dispatch.end(), m_wildcard.begin(), m_wildcard.end());
+    entry->m_dispatch.shrink_to_fit();
+    }
+
+  for (EventCallbackEntry* cbe : m_retired)
+    delete cbe;
+  m_retired.clear();
+  }
+
+event_id_t OvmsEvents::InternEventLocked(const std::string& event)
+  {
+  auto k = m_ids.find(event);
+  if (k != m_ids.end())
+    return k->second;
+  if (m_events.size() > UINT16_MAX)
+    {
+    ESP_LOGE(TAG, "InternEvent: registry full, event '%s' not interned", event.c_str());
+    return EVENT_ID_NONE;
+    }
+  event_id_t id = m_events.size();
+  m_events.push_back(new EventEntry(id, event));
+  m_ids[event] = id;
+  m_resolve = true;
+  return id;
+  }
+
+/**
+ * InternEvent: get the ID for an event name, registering the name if necessary.
+ *  Use this to pre-resolve events signalled frequently.
+ */
+event_id_t OvmsEvents::InternEvent(const std::string& event)
+  {
+  if (event.empty() || event == "*")
+    return EVENT_ID_NONE;
+  OvmsMutexLock lock(&m_registry_mutex);
+  return InternEventLocked(event);
+  }
+
+/**
+ * FindEvent: get the ID for an event name, EVENT_ID_NONE if not interned
+ */
+event_id_t OvmsEvents::FindEvent(const std::string& event)
+  {
+  OvmsMutexLock lock(&m_registry_mutex);
+  auto k = m_ids.find(event);
+  return (k != m_ids.end()) ? k->second : EVENT_ID_NONE;
+  }
+
+const char* OvmsEvents::GetEventName(event_id_t id)
+  {
+  OvmsMutexLock lock(&m_registry_mutex);
+  if (id == EVENT_ID_NONE || id >= m_events.size())
+    return "";
+  return m_events[id]->m_name.c_str();
+  }
+
+void OvmsEvents::GetEventStats(EventEntryVector& stats, bool reset /*=false*/)
+  {
+  OvmsMutexLock lock(&m_registry_mutex);
+  stats.clear();
+  stats.reserve(m_events.size());
+  for (EventEntry* entry : m_events)
+    {
+    if (!entry)
+      continue;
+    if (reset)
+      entry->ResetStats();
+    stats.push_back(entry);
     }
-  free(msg->body.signal.event);
   }
 
 void OvmsEvents::RegisterEvent(std::string caller, std::string event, EventCallback callback)
   {
+  OvmsMutexLock lock(&m_registry_mutex);
   auto k = m_map.find(event);
   if (k == m_map.end())
     {
@@ -345,10 +529,14 @@ void OvmsEvents::RegisterEvent(std::string caller, std::string event, EventCallb
 
   EventCallbackList *el = k->second;
   el->push_back(new EventCallbackEntry(caller,callback));
+  if (event != "*")
+    InternEventLocked(event);
+  m_resolve = true;
   }
 
 void OvmsEvents::DeregisterEvent(std::string caller)
   {
+  OvmsMutexLock lock(&m_registry_mutex);
   EventMap::iterator itm=m_map.begin();
   while (itm!=m_map.end())
     {
@@ -359,8 +547,12 @@ void OvmsEvents::DeregisterEvent(std::string caller)
       EventCallbackEntry* ec = *itc;
       if (ec->m_caller == caller)
         {
+        // The entry may still be referenced by a dispatch vector,
+        // it will be freed by the event task on the next resolve:
         itc = el->erase(itc);
-        delete ec;
+        ec->m_active = false;
+        m_retired.push_back(ec);
+        m_resolve = true;
         }
       else
         {
@@ -379,14 +571,15 @@ void OvmsEvents::DeregisterEvent(std::string caller)
     }
   }
 
-static void CheckQueueOverflow(const char* from, char* event)
+static void CheckQueueOverflow(const char* from, const char* event)
   {
   EventCallbackEntry* cbe = MyEvents.m_current_callback;
-  if (cbe != NULL)
+  const char* current = MyEvents.m_current_event;
+  if (cbe != NULL && current != NULL)
     {
     ESP_LOGE(TAG, "%s: queue overflow (running %s->%s for %u sec), event '%s' dropped",
       from,
-      MyEvents.m_current_event.c_str(),
+      current,
       cbe->m_caller.c_str(),
       monotonictime-MyEvents.m_current_started,
       event);
@@ -429,7 +622,8 @@ void OvmsEvents::SignalScheduledEvent(TimerHandle_t timer)
   // … and pass on to event task:
   if (xQueueSend(MyEvents.m_taskqueue, msg, 0) != pdTRUE)
     {
-    CheckQueueOverflow("SignalScheduledEvent", msg->body.signal.event);
+    CheckQueueOverflow("SignalScheduledEvent",
+      msg->body.signal.event ? msg->body.signal.event : MyEvents.GetEventName(msg->body.signal.id));
     MyEvents.FreeQueueSignalEvent(msg);
     }
 
@@ -493,73 +687,106 @@ bool OvmsEvents::ScheduleEvent(event_queue_t* msg, uint32_t delay_ms)
   return true;
   }
 
-void OvmsEvents::SignalEvent(std::string event, void* data, event_signal_done_fn callback /*=NULL*/,
-                             uint32_t delay_ms /*=0*/)
+void OvmsEvents::PostEvent(event_queue_t* msg, uint32_t delay_ms)
   {
-  event_queue_t msg;
-  memset(&msg, 0, sizeof(msg));
-
-  msg.type = EVENT_signal;
-  msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
-  strcpy(msg.body.signal.event, event.c_str());
-  msg.body.signal.data = data;
-  msg.body.signal.donefn = callback;
-
   if (delay_ms == 0)
     {
-    if (xQueueSend(m_taskqueue, &msg, 0) != pdTRUE)
+    if (xQueueSend(m_taskqueue, msg, 0) != pdTRUE)
       {
-      CheckQueueOverflow("SignalEvent", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
+      CheckQueueOverflow("SignalEvent",
+        msg->body.signal.event ? msg->body.signal.event : GetEventName(msg->body.signal.id));
+      FreeQueueSignalEvent(msg);
       }
     }
   else
     {
-    if (ScheduleEvent(&msg, delay_ms) != true)
+    if (ScheduleEvent(msg, delay_ms) != true)
       {
-      ESP_LOGE(TAG, "SignalEvent: no timer available, event '%s' dropped", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
+      ESP_LOGE(TAG, "SignalEvent: no timer available, event '%s' dropped",
+        msg->body.signal.event ? msg->body.signal.event : GetEventName(msg->body.signal.id));
+      FreeQueueSignalEvent(msg);
       }
     }
   }
 
-void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
+void OvmsEvents::SignalEvent(event_id_t id, void* data, event_signal_done_fn callback /*=NULL*/,
                              uint32_t delay_ms /*=0*/)
   {
   event_queue_t msg;
   memset(&msg, 0, sizeof(msg));
 
   msg.type = EVENT_signal;
-  msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
-  strcpy(msg.body.signal.event, event.c_str());
+  msg.body.signal.id = id;
+  msg.body.signal.data = data;
+  msg.body.signal.donefn = callback;
+
+  PostEvent(&msg, delay_ms);
+  }
+
+void OvmsEvents::SignalEvent(event_id_t id, void* data, size_t length,
+                             uint32_t delay_ms /*=0*/)
+  {
+  event_queue_t msg;
+  memset(&msg, 0, sizeof(msg));
+
+  msg.type = EVENT_signal;
+  msg.body.signal.id = id;
   if (data != NULL)
     {
     msg.body.signal.data = ExternalRamMalloc(length);
     memcpy(msg.body.signal.data, data, length);
     msg.body.signal.donefn = EventStdFree;
     }
-  else
+
+  PostEvent(&msg, delay_ms);
+  }
+
+void OvmsEvents::SignalEvent(std::string event, void* data, event_signal_done_fn callback /*=NULL*/,
+                             uint32_t delay_ms /*=0*/)
+  {
+  event_id_t id = FindEvent(event);
+  if (id != EVENT_ID_NONE)
     {
-    msg.body.signal.data = NULL;
-    msg.body.signal.donefn = NULL;
+    SignalEvent(id, data, callback, delay_ms);
+    return;
     }
 
-  if (delay_ms == 0)
+  event_queue_t msg;
+  memset(&msg, 0, sizeof(msg));
+
+  msg.type = EVENT_signal;
+  msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
+  strcpy(msg.body.signal.event, event.c_str());
+  msg.body.signal.data = data;
+  msg.body.signal.donefn = callback;
+
+  PostEvent(&msg, delay_ms);
+  }
+
+void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
+                             uint32_t delay_ms /*=0*/)
+  {
+  event_id_t id = FindEvent(event);
+  if (id != EVENT_ID_NONE)
     {
-    if (xQueueSend(m_taskqueue, &msg, 0) != pdTRUE)
-      {
-      CheckQueueOverflow("SignalEvent", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
-      }
+    SignalEvent(id, data, length, delay_ms);
+    return;
     }
-  else
+
+  event_queue_t msg;
+  memset(&msg, 0, sizeof(msg));
+
+  msg.type = EVENT_signal;
+  msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
+  strcpy(msg.body.signal.event, event.c_str());
+  if (data != NULL)
     {
-    if (ScheduleEvent(&msg, delay_ms) != true)
-      {
-      ESP_LOGE(TAG, "SignalEvent: no timer available, event '%s' dropped", msg.body.signal.event);
-      FreeQueueSignalEvent(&msg);
-      }
+    msg.body.signal.data = ExternalRamMalloc(length);
+    memcpy(msg.body.signal.data, data, length);
+    msg.body.signal.donefn = EventStdFree;
     }
+
+  PostEvent(&msg, delay_ms);
   }
 
 esp_err_t OvmsEvents::ReceiveSystemEvent(void *ctx, system_event_t *event)
@@ -659,8 +886,41 @@ EventCallbackEntry::EventCallbackEntry(std::string caller, EventCallback callbac
   {
   m_caller = caller;
   m_callback = callback;
+  m_active = true;
   }
 
 EventCallbackEntry::~EventCallbackEntry()
   {
   }
+
+EventEntry::EventEntry(event_id_t id, const std::string& name)
+  {
+  m_id = id;
+  m_name = name;
+  ResetStats();
+  }
+
+EventEntry::~EventEntry()
+  {
+  }
+
+void EventEntry::ResetStats()
+  {
+  m_count = 0;
+  m_time_max = 0;
+  m_time_total = 0;
+  memset(m_hist, 0, sizeof(m_hist));
+  }
+
+void EventEntry::AddTime(uint32_t us)
+  {
+  m_count++;
+  m_time_total += us;
+  if (us > m_time_max)
+    m_time_max = us;
+  // bucket 0: <64 us, bucket n: <64<<n us, last bucket: >=64 ms
+  int bucket = 0;
+  for (uint32_t t = us >> 6; t && bucket < EVENT_HIST_BUCKETS-1; t >>= 1)
+    bucket++;
+  m_hist[bucket]++;
+  }
@@ -35,6 +35,7 @@
 #include <functional>
 #include <map>
 #include <list>
+#include <vector>
 #include <esp_event.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -54,9 +55,46 @@ class EventCallbackEntry
   public:
     std::string m_caller;
     EventCallback m_callback;
+    bool m_active;
   };
 
 typedef std::list<EventCallbackEntry*> EventCallbackList;
+typedef std::vector<EventCallbackEntry*> EventCallbackVector;
+
+/**
+ * Event registry:
+ *  Event names are interned to integer IDs on registration of a listener or
+ *  by InternEvent(). Signalling an interned event passes just the ID through
+ *  the queue, dispatching walks the pre-resolved callback vector (including
+ *  the "*" listeners). Names not interned are passed as strings and dispatched
+ *  to the "*" listeners & event scripts only.
+ */
+typedef uint16_t event_id_t;
+#define EVENT_ID_NONE           0
+#define EVENT_HIST_BUCKETS      12      // log2 dispatch time buckets from <64 us to >=64 ms
+
+class EventEntry
+  {
+  public:
+    EventEntry(event_id_t id, const std::string& name);
+    ~EventEntry();
+
+  public:
+    void ResetStats();
+    void AddTime(uint32_t us);
+
+  public:
+    event_id_t m_id;
+    std::string m_name;
+    EventCallbackVector m_dispatch;     // resolved listeners, owned by the event task
+    uint32_t m_count;
+    uint32_t m_time_max;
+    uint64_t m_time_total;
+    uint32_t m_hist[EVENT_HIST_BUCKETS];
+  };
+
+typedef std::map<std::string, event_id_t> EventIdMap;
+typedef std::vector<EventEntry*> EventEntryVector;
 
 class EventMap : public  std::map<std::string, EventCallbackList*>
   {
@@ -80,7 +118,8 @@ typedef struct
     {
     struct
       {
-      char* event;
+      char* event;              // NULL for interned events
+      event_id_t id;
       void* data;
       event_signal_done_fn donefn;
       } signal;
@@ -102,6 +141,14 @@ class OvmsEvents
     void DeregisterEvent(std::string caller);
     void SignalEvent(std::string event, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0);
     void SignalEvent(std::string event, void* data, size_t length, uint32_t delay_ms = 0);
+    void SignalEvent(event_id_t id, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0);
+    void SignalEvent(event_id_t id, void* data, size_t length, uint32_t delay_ms = 0);
+
+  public:
+    event_id_t InternEvent(const std::string& event);
+    event_id_t FindEvent(const std::string& event);
+    const char* GetEventName(event_id_t id);
+    void GetEventStats(EventEntryVector& stats, bool reset = false);
 
   public:
     void EventTask();
@@ -114,9 +161,19 @@ class OvmsEvents
   protected:
     bool ScheduleEvent(event_queue_t* msg, uint32_t delay_ms);
     static void SignalScheduledEvent(TimerHandle_t timer);
+    void PostEvent(event_queue_t* msg, uint32_t delay_ms);
+    event_id_t InternEventLocked(const std::string& event);
+    void ResolveListeners();
+    void Dispatch(const EventCallbackVector& dispatch, const std::string& event, void* data);
 
   protected:
     EventMap m_map;
+    OvmsMutex m_registry_mutex;         // protects m_map, m_ids, m_events & m_retired
+    EventIdMap m_ids;
+    EventEntryVector m_events;          // indexed by event_id_t, entries are never freed
+    EventCallbackVector m_wildcard;     // resolved "*" listeners for non-interned events
+    EventCallbackList m_retired;        // deregistered entries, freed by the event task
+    volatile bool m_resolve;            // listener maps changed, resolve on next dispatch
     TimerList m_timers;
     TimerStatusMap m_timer_active;
     OvmsMutex m_timers_mutex;
@@ -128,7 +185,7 @@ class OvmsEvents
 
   public:
     EventCallbackEntry* m_current_callback;
-    std::string m_current_event;
+    const char* m_current_event;
     uint32_t m_current_started;
   };
 
@@ -70,6 +70,9 @@ static const char *TAG = "housekeeping";
 
 static int tick = 0;
 
+// Interned ticker event IDs, see Housekeeping():
+static event_id_t ev_ticker_1, ev_ticker_10, ev_ticker_60, ev_ticker_300, ev_ticker_600, ev_ticker_3600;
+
 void HousekeepingUpdate12V()
   {
 #ifdef CONFIG_OVMS_COMP_ADC
@@ -108,17 +111,17 @@ void HousekeepingTicker1( TimerHandle_t timer )
   StandardMetrics.ms_m_timeutc->SetValue((int)time(NULL));
 
   HousekeepingUpdate12V();
-  MyEvents.SignalEvent("ticker.1", NULL);
+  MyEvents.SignalEvent(ev_ticker_1, NULL);
 
   tick++;
-  if ((tick % 10)==0) MyEvents.SignalEvent("ticker.10", NULL);
-  if ((tick % 60)==0) MyEvents.SignalEvent("ticker.60", NULL);
-  if ((tick % 300)==0) MyEvents.SignalEvent("ticker.300", NULL);
-  if ((tick % 600)==0) MyEvents.SignalEvent("ticker.600", NULL);
+  if ((tick % 10)==0) MyEvents.SignalEvent(ev_ticker_10, NULL);
+  if ((tick % 60)==0) MyEvents.SignalEvent(ev_ticker_60, NULL);
+  if ((tick % 300)==0) MyEvents.SignalEvent(ev_ticker_300, NULL);
+  if ((tick % 600)==0) MyEvents.SignalEvent(ev_ticker_600, NULL);
   if ((tick % 3600)==0)
     {
     tick = 0;
-    MyEvents.SignalEvent("ticker.3600", NULL);
+    MyEvents.SignalEvent(ev_ticker_3600, NULL);
     }
 
   time_t rawtime;
@@ -167,6 +170,12 @@ void Housekeeping::Init(std::string event, void* data)
   ESP_LOGI(TAG, "reset_reason: cpu0=%d, cpu1=%d", rtc_get_reset_reason(0), rtc_get_reset_reason(1));
 
   tick = 0;
+  ev_ticker_1 = MyEvents.InternEvent("ticker.1");
+  ev_ticker_10 = MyEvents.InternEvent("ticker.10");
+  ev_ticker_60 = MyEvents.InternEvent("ticker.60");
+  ev_ticker_300 = MyEvents.InternEvent("ticker.300");
+  ev_ticker_600 = MyEvents.InternEvent("ticker.600");
+  ev_ticker_3600 = MyEvents.InternEvent("ticker.3600");
   m_timer1 = xTimerCreate("Housekeep ticker",1000 / portTICK_PERIOD_MS,pdTRUE,this,HousekeepingTicker1);
   xTimerStart(m_timer1, 0);
 
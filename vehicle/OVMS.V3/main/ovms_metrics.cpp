@@ -407,14 +407,28 @@ MetricCallbackEntry::~MetricCallbackEntry()
   {
   }
 
-OvmsMetrics::OvmsMetrics()
+/**
+ * OvmsMetrics: the metrics registry
+ *  A standalone registry (i.e. for benchmarks) only provides the registration, lookup
+ *  & dirty set functions, without commands, scripting, persistence & events. See
+ *  OvmsMetric(OvmsMetrics* registry, …) on how to add metrics to it.
+ */
+OvmsMetrics::OvmsMetrics(bool standalone /*=false*/)
   {
-  ESP_LOGI(TAG, "Initialising METRICS (1810)");
-
   m_nextmodifier = 1;
+  m_lastid = 0;
+  memset(m_slots, 0, sizeof(m_slots));
+  m_slotcount = 0;
+  m_dirtysets = NULL;
   m_first = NULL;
+  m_generation = 0;
   m_trace = false;
 
+  if (standalone)
+    return;
+
+  ESP_LOGI(TAG, "Initialising METRICS (1810)");
+
   // Register our commands
   OvmsCommand* cmd_metric = MyCommandApp.RegisterCommand("metrics","METRICS framework");
   cmd_metric->RegisterCommand("list","Show all metrics", metrics_list,
@@ -463,60 +477,115 @@ OvmsMetrics::~OvmsMetrics()
     m = m->m_next;
     delete c;
     }
+  for (int i = 0; i < METRICS_SLOT_PAGES; i++)
+    delete [] m_slots[i];
+  for (OvmsMetricDirtySet* set = m_dirtysets; set != NULL;)
+    {
+    OvmsMetricDirtySet* c = set;
+    set = set->m_next;
+    delete c;
+    }
   }
 
 void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
   {
-  // Quick simple check for if we are the first metric.
-  if (m_first == NULL)
-    {
-    m_first = metric;
-    return;
-    }
+  OvmsMutexLock lock(&m_index_mutex);
 
-  // Now, check if we are before the first
-  if (strcmp(m_first->m_name,metric->m_name)>=0)
+  // Find the insert position in the sorted list via the order index:
+  //  new metrics are inserted before any existing metric of the same name
+  auto it = m_order.lower_bound(metric->m_name);
+  if (it == m_order.begin())
     {
     metric->m_next = m_first;
     m_first = metric;
-    return;
     }
+  else
+    {
+    OvmsMetric* prev = std::prev(it)->second;
+    metric->m_next = prev->m_next;
+    prev->m_next = metric;
+    }
+  m_order.insert(it, MetricOrderIndex::value_type(metric->m_name, metric));
+
+  // Find() shall return the most recently registered metric of a name:
+  m_index[metric->m_name] = metric;
+
+  // Assign registration serial (0 = unregistered); consumers cache per metric
+  //  data by serial, so it's 32 bit to not wrap in practice:
+  if (++m_lastid == 0) ++m_lastid;
+  metric->m_id = m_lastid;
 
-  // Search for the correct place to insert
-  for (OvmsMetric*m = m_first; m!=NULL; m=m->m_next)
+  // Assign dirty set slot, reusing released slots first:
+  uint16_t slot = METRICS_SLOT_NONE;
+  if (!m_slotfree.empty())
     {
-    if (m->m_next == NULL)
-      {
-      m->m_next = metric;
-      return;
-      }
-    if (strcmp(m->m_next->m_name,metric->m_name)>=0)
-      {
-      metric->m_next = m->m_next;
-      m->m_next = metric;
-      return;
-      }
+    slot = m_slotfree.back();
+    m_slotfree.pop_back();
     }
+  else if (m_slotcount < METRICS_SLOT_PAGES * METRICS_SLOTS_PER_PAGE)
+    {
+    OvmsMetric** &page = m_slots[m_slotcount / METRICS_SLOTS_PER_PAGE];
+    if (!page)
+      page = new OvmsMetric*[METRICS_SLOTS_PER_PAGE]();
+    slot = m_slotcount++;
+    }
+  else
+    {
+    ESP_LOGE(TAG, "RegisterMetric: no slot left for %s, changes will not be tracked", metric->m_name);
+    }
+  metric->m_slot = slot;
+  if (slot != METRICS_SLOT_NONE)
+    m_slots[slot / METRICS_SLOTS_PER_PAGE][slot % METRICS_SLOTS_PER_PAGE] = metric;
+
+  m_generation++;
   }
 
 void OvmsMetrics::DeregisterMetric(OvmsMetric* metric)
   {
-  if (m_first == metric)
+  m_index_mutex.Lock();
+
+  auto range = m_order.equal_range(metric->m_name);
+  auto it = range.first;
+  while (it != range.second && it->second != metric)
+    ++it;
+  if (it == range.second)
     {
-    m_first = metric->m_next;
-    delete metric;
+    m_index_mutex.Unlock();
     return;
     }
 
-  for (OvmsMetric* m=m_first;m!=NULL;m=m->m_next)
+  // Unlink from sorted list:
+  if (it == m_order.begin())
+    m_first = metric->m_next;
+  else
+    std::prev(it)->second->m_next = metric->m_next;
+
+  // Update indexes:
+  auto next = m_order.erase(it);
+  auto ix = m_index.find(metric->m_name);
+  if (ix != m_index.end() && ix->second == metric)
+    {
+    if (next != m_order.end() && strcmp(next->first, metric->m_name) == 0)
+      ix->second = next->second;
+    else if (next != m_order.begin() && strcmp(std::prev(next)->first, metric->m_name) == 0)
+      ix->second = std::prev(next)->second;
+    else
+      m_index.erase(ix);
+    }
+
+  // Release slot:
+  if (metric->m_slot != METRICS_SLOT_NONE)
     {
-    if (m->m_next == metric)
-      {
-      m->m_next = metric->m_next;
-      delete metric;
-      return;
-      }
+    m_slots[metric->m_slot / METRICS_SLOTS_PER_PAGE][metric->m_slot % METRICS_SLOTS_PER_PAGE] = NULL;
+    m_slotfree.push_back(metric->m_slot);
+    metric->m_slot = METRICS_SLOT_NONE;
     }
+
+  m_generation++;
+  m_index_mutex.Unlock();
+
+  // Outside the lock, the destructor calls MyMetrics.DeregisterMetric() again:
+  delete metric;
   }
 
 bool OvmsMetrics::Set(const char* metric, const char* value)
@@ -557,11 +626,9 @@ bool OvmsMetrics::SetFloat(const char* metric, float value)
 
 OvmsMetric* OvmsMetrics::Find(const char* metric)
   {
-  for (OvmsMetric* m=m_first; m != NULL; m=m->m_next)
-    {
-    if (strcmp(m->m_name,metric)==0) return m;
-    }
-  return NULL;
+  OvmsMutexLock lock(&m_index_mutex);
+  auto it = m_index.find(metric);
+  return (it != m_index.end()) ? it->second : NULL;
   }
 
 OvmsMetricInt* OvmsMetrics::InitInt(const char* metric, uint16_t autostale, int value, metric_unit_t units, bool persist)
@@ -690,9 +757,172 @@ void OvmsMetrics::NotifyModified(OvmsMetric* metric)
 
 size_t OvmsMetrics::RegisterModifier()
   {
+  if (m_nextmodifier >= METRICS_MAX_MODIFIERS)
+    ESP_LOGE(TAG, "RegisterModifier: all %d modifiers in use, consider using a dirty set", METRICS_MAX_MODIFIERS);
   return m_nextmodifier++;
   }
 
+/**
+ * AcquireDirtySet: get a dirty set for a new consumer
+ *  Sets are never freed, released sets are reused. A new consumer has not seen
+ *  any metric yet, so the set starts with all metrics marked.
+ */
+OvmsMetricDirtySet* OvmsMetrics::AcquireDirtySet()
+  {
+  OvmsMetricDirtySet* set;
+  for (set = m_dirtysets; set != NULL; set = set->m_next)
+    {
+    bool unused = false;
+    if (set->m_used.compare_exchange_strong(unused, true))
+      break;
+    }
+  if (!set)
+    {
+    set = new OvmsMetricDirtySet(this);
+    set->m_used = true;
+    set->m_next = m_dirtysets;
+    while (!m_dirtysets.compare_exchange_weak(set->m_next, set))
+      ;
+    }
+  set->MarkAll();
+  return set;
+  }
+
+void OvmsMetrics::ReleaseDirtySet(OvmsMetricDirtySet* set)
+  {
+  if (!set) return;
+  // Clear before releasing, a concurrent AcquireDirtySet() may take the set
+  //  as soon as m_used is reset:
+  set->Clear();
+  set->m_used = false;
+  }
+
+/**
+ * MarkDirty: mark metric as modified in all active dirty sets
+ */
+void OvmsMetrics::MarkDirty(OvmsMetric* metric)
+  {
+  if (metric->m_slot == METRICS_SLOT_NONE)
+    return;
+  for (OvmsMetricDirtySet* set = m_dirtysets; set != NULL; set = set->m_next)
+    {
+    if (set->m_used)
+      set->Mark(metric->m_slot);
+    }
+  }
+
+OvmsMetricDirtySet::OvmsMetricDirtySet(OvmsMetrics* registry)
+  {
+  m_registry = registry;
+  m_next = NULL;
+  m_used = false;
+  for (int i = 0; i < METRICS_SLOT_PAGES; i++)
+    m_pages[i] = NULL;
+  m_scan = 0;
+  m_base = 0;
+  m_pending = 0;
+  }
+
+OvmsMetricDirtySet::~OvmsMetricDirtySet()
+  {
+  for (int i = 0; i < METRICS_SLOT_PAGES; i++)
+    delete [] m_pages[i].load();
+  }
+
+void OvmsMetricDirtySet::Mark(uint16_t slot)
+  {
+  std::atomic<dirty_word_t*> &pagep = m_pages[slot / METRICS_SLOTS_PER_PAGE];
+  dirty_word_t* page = pagep;
+  if (!page)
+    {
+    // first mark in this page: allocate, another task may race us
+    dirty_word_t* newpage = new dirty_word_t[METRICS_SLOTS_PER_PAGE / 32]();
+    if (pagep.compare_exchange_strong(page, newpage))
+      page = newpage;
+    else
+      delete [] newpage;
+    }
+  page[(slot % METRICS_SLOTS_PER_PAGE) / 32].fetch_or(1ul << (slot % 32));
+  }
+
+void OvmsMetricDirtySet::MarkAll()
+  {
+  uint32_t count = m_registry->GetSlotCount();
+  for (uint32_t slot = 0; slot < count; slot += 32)
+    {
+    Mark(slot);
+    dirty_word_t* page = m_pages[slot / METRICS_SLOTS_PER_PAGE];
+    page[(slot % METRICS_SLOTS_PER_PAGE) / 32] = 0xffffffff;
+    }
+  }
+
+void OvmsMetricDirtySet::Clear()
+  {
+  for (int i = 0; i < METRICS_SLOT_PAGES; i++)
+    {
+    dirty_word_t* page = m_pages[i];
+    if (!page) continue;
+    for (int w = 0; w < METRICS_SLOTS_PER_PAGE / 32; w++)
+      page[w] = 0;
+    }
+  m_scan = 0;
+  m_pending = 0;
+  }
+
+/**
+ * Take: check & clear the modification state of a single metric
+ *  Note: a metric already fetched by an unfinished Next() pass is not seen here.
+ */
+bool OvmsMetricDirtySet::Take(OvmsMetric* metric)
+  {
+  uint16_t slot = metric->m_slot;
+  if (slot == METRICS_SLOT_NONE)
+    return false;
+  dirty_word_t* page = m_pages[slot / METRICS_SLOTS_PER_PAGE];
+  if (!page)
+    return false;
+  uint32_t bit = 1ul << (slot % 32);
+  return page[(slot % METRICS_SLOTS_PER_PAGE) / 32].fetch_and(~bit) & bit;
+  }
+
+/**
+ * Next: get & clear the next modified metric
+ *  Scans the set in slot order, resuming where the last call left off. Returns NULL
+ *  at the end of the pass, the next call starts a new pass. Metrics modified during
+ *  a pass are returned by the same pass if their slot has not yet been passed.
+ */
+OvmsMetric* OvmsMetricDirtySet::Next()
+  {
+  for (;;)
+    {
+    if (m_pending)
+      {
+      int bit = __builtin_ctz(m_pending);
+      m_pending &= m_pending - 1;
+      OvmsMetric* metric = m_registry->GetSlot(m_base + bit);
+      if (metric)
+        return metric;
+      continue;
+      }
+    if (m_scan >= m_registry->GetSlotCount())
+      {
+      m_scan = 0;
+      return NULL;
+      }
+    dirty_word_t* page = m_pages[m_scan / METRICS_SLOTS_PER_PAGE];
+    if (page)
+      {
+      m_base = m_scan;
+      m_pending = page[(m_scan % METRICS_SLOTS_PER_PAGE) / 32].exchange(0);
+      m_scan += 32;
+      }
+    else
+      {
+      m_scan = (m_scan / METRICS_SLOTS_PER_PAGE + 1) * METRICS_SLOTS_PER_PAGE;
+      }
+    }
+  }
+
 OvmsMetric::OvmsMetric(const char* name, uint16_t autostale, metric_unit_t units, bool persist)
   {
   m_defined = NeverDefined;
@@ -704,9 +934,33 @@ OvmsMetric::OvmsMetric(const char* name, uint16_t autostale, metric_unit_t units
   m_units = units;
   m_next = NULL;
   m_persist = false;          // only set by metrics supporting persistence
+  m_id = 0;
+  m_slot = METRICS_SLOT_NONE;
   MyMetrics.RegisterMetric(this);
   }
 
+/**
+ * OvmsMetric: add a metric to a standalone registry (i.e. for benchmarks)
+ *  The metric is unknown to MyMetrics and its consumers. Don't change its value,
+ *  that would mark the slot in the MyMetrics dirty sets; use the registry directly
+ *  (registry->MarkDirty()) to simulate changes.
+ */
+OvmsMetric::OvmsMetric(OvmsMetrics* registry, const char* name)
+  {
+  m_defined = NeverDefined;
+  m_modified = 0;
+  m_name = name;
+  m_lastmodified = 0;
+  m_autostale = 0;
+  m_stale = false;
+  m_units = Other;
+  m_next = NULL;
+  m_persist = false;
+  m_id = 0;
+  m_slot = METRICS_SLOT_NONE;
+  registry->RegisterMetric(this);
+  }
+
 OvmsMetric::~OvmsMetric()
   {
   MyMetrics.DeregisterMetric(this);
@@ -741,6 +995,16 @@ float OvmsMetric::AsFloat(const float defvalue, metric_unit_t units)
   return defvalue;
   }
 
+/**
+ * EncodeBinary: append the binary value representation to buf
+ *  Returns the encoding type, the base implementation encodes the JSON text.
+ */
+metric_bintype_t OvmsMetric::EncodeBinary(std::string& buf)
+  {
+  buf.append(AsJSON());
+  return MetricBinJSON;
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 void OvmsMetric::DukPush(DukContext &dc)
   {
@@ -783,6 +1047,7 @@ void OvmsMetric::SetModified(bool changed)
   if (changed)
     {
     m_modified = ULONG_MAX;
+    MyMetrics.MarkDirty(this);
     MyMetrics.NotifyModified(this);
     }
   }
@@ -997,6 +1262,13 @@ int OvmsMetricInt::AsInt(const int defvalue, metric_unit_t units)
     return defvalue;
   }
 
+metric_bintype_t OvmsMetricInt::EncodeBinary(std::string& buf)
+  {
+  int32_t value = AsInt();
+  buf.append((const char*)&value, sizeof(value));
+  return MetricBinInt;
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 void OvmsMetricInt::DukPush(DukContext &dc)
   {
@@ -1159,6 +1431,12 @@ int OvmsMetricBool::AsBool(const bool defvalue)
     return defvalue;
   }
 
+metric_bintype_t OvmsMetricBool::EncodeBinary(std::string& buf)
+  {
+  buf.push_back(AsBool() ? 1 : 0);
+  return MetricBinBool;
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 void OvmsMetricBool::DukPush(DukContext &dc)
   {
@@ -1321,6 +1599,13 @@ int OvmsMetricFloat::AsInt(const int defvalue, metric_unit_t units)
   return (int) AsFloat((float) defvalue, units);
   }
 
+metric_bintype_t OvmsMetricFloat::EncodeBinary(std::string& buf)
+  {
+  float value = AsFloat();
+  buf.append((const char*)&value, sizeof(value));
+  return MetricBinFloat;
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 void OvmsMetricFloat::DukPush(DukContext &dc)
   {
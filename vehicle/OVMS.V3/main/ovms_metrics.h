@@ -33,6 +33,7 @@
 
 #include <functional>
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <string>
 #include <bitset>
@@ -41,6 +42,8 @@
 #include <set>
 #include <vector>
 #include <atomic>
+#include <type_traits>
+#include <algorithm>
 #include "ovms_utils.h"
 #include "ovms_mutex.h"
 #include "dbc_number.h"
@@ -53,6 +56,11 @@
 
 #define METRICS_MAX_MODIFIERS 32
 
+// Metric slots: compact metric index used by the dirty sets, allocated in pages
+#define METRICS_SLOTS_PER_PAGE  256
+#define METRICS_SLOT_PAGES      64        // max 16384 metrics tracked by dirty sets
+#define METRICS_SLOT_NONE       0xffff
+
 using namespace std;
 
 typedef enum : uint8_t
@@ -116,6 +124,19 @@ typedef enum : uint8_t
   Defined
 } metric_defined_t;
 
+// Binary value encodings (see OvmsMetric::EncodeBinary()),
+//  all numbers are little endian:
+typedef enum : uint8_t
+  {
+  MetricBinJSON = 0,            // AsJSON() text
+  MetricBinBool,                // uint8
+  MetricBinInt,                 // int32
+  MetricBinFloat,               // float32
+  MetricBinVecInt,              // int32 elements
+  MetricBinVecUInt,             // uint32 elements
+  MetricBinVecFloat,            // float32 elements
+  } metric_bintype_t;
+
 extern const char* OvmsMetricUnitLabel(metric_unit_t units);
 extern int UnitConvert(metric_unit_t from, metric_unit_t to, int value);
 extern float UnitConvert(metric_unit_t from, metric_unit_t to, float value);
@@ -141,10 +162,13 @@ struct persistent_metrics
 extern persistent_values *pmetrics_find(const char *name);
 extern persistent_values *pmetrics_register(const char *name);
 
+class OvmsMetrics;
+
 class OvmsMetric
   {
   public:
     OvmsMetric(const char* name, uint16_t autostale = 0, metric_unit_t units = Other, bool persist = false);
+    OvmsMetric(OvmsMetrics* registry, const char* name);
     virtual ~OvmsMetric();
 
   public:
@@ -152,6 +176,7 @@ class OvmsMetric
     std::string AsUnitString(const char* defvalue = "", metric_unit_t units = Other, int precision = -1);
     virtual std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1);
     virtual float AsFloat(const float defvalue = 0, metric_unit_t units = Other);
+    virtual metric_bintype_t EncodeBinary(std::string& buf);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     virtual void DukPush(DukContext &dc);
 #endif
@@ -187,6 +212,8 @@ class OvmsMetric
     metric_defined_t m_defined;
     bool m_stale;
     bool m_persist;
+    uint32_t m_id;                    // registration serial, see OvmsMetrics::RegisterMetric()
+    uint16_t m_slot;                  // dirty set index, see OvmsMetrics::RegisterMetric()
   };
 
 class OvmsMetricBool : public OvmsMetric
@@ -200,6 +227,7 @@ class OvmsMetricBool : public OvmsMetric
     virtual std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1);
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other);
     int AsBool(const bool defvalue = false);
+    metric_bintype_t EncodeBinary(std::string& buf);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     void DukPush(DukContext &dc);
 #endif
@@ -228,6 +256,7 @@ class OvmsMetricInt : public OvmsMetric
     virtual std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1);
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other);
     int AsInt(const int defvalue = 0, metric_unit_t units = Other);
+    metric_bintype_t EncodeBinary(std::string& buf);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     void DukPush(DukContext &dc);
 #endif
@@ -256,6 +285,7 @@ class OvmsMetricFloat : public OvmsMetric
     virtual std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1);
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other);
     int AsInt(const int defvalue = 0, metric_unit_t units = Other);
+    metric_bintype_t EncodeBinary(std::string& buf);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     void DukPush(DukContext &dc);
 #endif
@@ -516,6 +546,37 @@ class OvmsMetricSet : public OvmsMetric
   };
 
 
+/**
+ * metric_binelem<ElemType>: binary element encoding for OvmsMetricVector,
+ *  numeric elements up to 32 bits are encoded as 32 bit array elements,
+ *  other vectors fall back to JSON.
+ */
+template <typename T, bool numeric = std::is_arithmetic<T>::value && (sizeof(T) <= 4)>
+struct metric_binelem
+  {
+  static const metric_bintype_t type = MetricBinJSON;
+  static void encode(std::string& buf, const T& value) {}
+  };
+
+template <typename T>
+struct metric_binelem<T, true>
+  {
+  static const metric_bintype_t type =
+    std::is_floating_point<T>::value ? MetricBinVecFloat :
+    std::is_signed<T>::value ? MetricBinVecInt : MetricBinVecUInt;
+  static void encode(std::string& buf, const T& value)
+    {
+    union { int32_t i32; uint32_t u32; float f32; char c[4]; } elem;
+    if (std::is_floating_point<T>::value)
+      elem.f32 = (float) value;
+    else if (std::is_signed<T>::value)
+      elem.i32 = (int32_t) value;
+    else
+      elem.u32 = (uint32_t) value;
+    buf.append(elem.c, 4);
+    }
+  };
+
 /**
  * OvmsMetricVector<type>: metric wrapper for std::vector<type>
  *  - string representation as comma separated values
@@ -734,6 +795,17 @@ class OvmsMetricVector : public OvmsMetric
       return json;
       }
 
+    virtual metric_bintype_t EncodeBinary(std::string& buf)
+      {
+      if (metric_binelem<ElemType>::type == MetricBinJSON)
+        return OvmsMetric::EncodeBinary(buf);
+      OvmsMutexLock lock(&m_mutex);
+      buf.reserve(buf.size() + 4 * m_value.size());
+      for (auto i = m_value.begin(); i != m_value.end(); i++)
+        metric_binelem<ElemType>::encode(buf, *i);
+      return metric_binelem<ElemType>::type;
+      }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     void DukPush(DukContext &dc)
       {
@@ -864,6 +936,17 @@ class OvmsMetricVector : public OvmsMetric
       }
 
     void SetElemValues(size_t start, size_t cnt, const ElemType* values, metric_unit_t units = Other)
+      {
+      SetModified(StoreElemValues(start, cnt, values, units));
+      }
+
+    /**
+     * StoreElemValues: update elements without notifying listeners
+     *  - returns true if any element has been changed
+     *  - the caller needs to call SetModified() with the result afterwards,
+     *    i.e. after storing a set of related vectors to publish them together
+     */
+    bool StoreElemValues(size_t start, size_t cnt, const ElemType* values, metric_unit_t units = Other)
       {
       bool modified = false, resized = false;
       if (m_mutex.Lock())
@@ -875,24 +958,37 @@ class OvmsMetricVector : public OvmsMetric
             SetPersistSize(start+cnt);
           resized = true;
           }
-        for (size_t i = 0; i < cnt; i++)
+        if (units == Other || units == m_units)
           {
-          ElemType ivalue;
-          if (units != Other && units != m_units)
-            ivalue = (ElemType) UnitConvert(units, m_units, (float)values[i]);
-          else
-            ivalue = values[i];
-          if (resized || m_value[start+i] != ivalue)
+          // No conversion: compare & copy as a block
+          if (resized || !std::equal(values, values+cnt, m_value.begin()+start))
             {
-            m_value[start+i] = ivalue;
+            std::copy(values, values+cnt, m_value.begin()+start);
             modified = true;
             if (m_persist)
-              *m_valuep_elem[start+i] = ivalue;
+              {
+              for (size_t i = 0; i < cnt; i++)
+                *m_valuep_elem[start+i] = values[i];
+              }
+            }
+          }
+        else
+          {
+          for (size_t i = 0; i < cnt; i++)
+            {
+            ElemType ivalue = (ElemType) UnitConvert(units, m_units, (float)values[i]);
+            if (resized || m_value[start+i] != ivalue)
+              {
+              m_value[start+i] = ivalue;
+              modified = true;
+              if (m_persist)
+                *m_valuep_elem[start+i] = ivalue;
+              }
             }
           }
         m_mutex.Unlock();
         }
-      SetModified(modified);
+      return modified;
       }
 
     uint32_t GetSize()
@@ -908,6 +1004,47 @@ class OvmsMetricVector : public OvmsMetric
   };
 
 
+/**
+ * OvmsMetricDirtySet: set of metrics modified since last taken by a consumer
+ *
+ * Consumers sending metric updates (servers, websocket clients) acquire a dirty set
+ * from MyMetrics instead of a modifier bit. Every metric change marks the metric's
+ * slot bit in all active sets, the consumer then only visits the changed metrics
+ * by Next() instead of checking the whole metrics list. There is no fixed limit
+ * on the number of sets.
+ *
+ * Bits are taken word-wise by atomic exchange, so marking is lock free and may be
+ * done from any task. A set must only be read by one consumer task.
+ */
+class OvmsMetricDirtySet
+  {
+  public:
+    OvmsMetricDirtySet(OvmsMetrics* registry);
+    ~OvmsMetricDirtySet();
+
+  public:
+    void Mark(uint16_t slot);
+    void MarkAll();
+    void Clear();
+    bool Take(OvmsMetric* metric);
+    OvmsMetric* Next();
+
+  public:
+    OvmsMetricDirtySet* m_next;       // registry chain, see OvmsMetrics::AcquireDirtySet()
+    std::atomic_bool m_used;
+
+  protected:
+    OvmsMetrics* m_registry;          // owner, maps slots to metrics
+
+  protected:
+    typedef std::atomic<uint32_t> dirty_word_t;
+    std::atomic<dirty_word_t*> m_pages[METRICS_SLOT_PAGES];   // bitmaps, allocated on demand
+    uint32_t m_scan;                  // Next(): slot of the next word to fetch…
+    uint32_t m_base;                  // … slot of bit 0 of m_pending…
+    uint32_t m_pending;               // … bits taken but not yet returned
+  };
+
+
 typedef std::function<void(OvmsMetric*)> MetricCallback;
 
 class MetricCallbackEntry
@@ -924,10 +1061,16 @@ class MetricCallbackEntry
 typedef std::list<MetricCallbackEntry*> MetricCallbackList;
 typedef std::map<const char*, MetricCallbackList*, CmpStrOp> MetricCallbackMap;
 
+// Metric registry indexes:
+//  - MetricNameIndex: hashed name lookup for Find()
+//  - MetricOrderIndex: sorted name index, used to find the list insert position
+typedef std::unordered_map<const char*, OvmsMetric*, HashStrOp, EqStrOp> MetricNameIndex;
+typedef std::multimap<const char*, OvmsMetric*, CmpStrOp> MetricOrderIndex;
+
 class OvmsMetrics
   {
   public:
-    OvmsMetrics();
+    OvmsMetrics(bool standalone = false);
     virtual ~OvmsMetrics();
 
   public:
@@ -981,8 +1124,25 @@ class OvmsMetrics
   protected:
     MetricCallbackMap m_listeners;
 
+  protected:
+    OvmsMutex m_index_mutex;          // guards the indexes, list & slots against concurrent (de)registration
+    MetricNameIndex m_index;
+    MetricOrderIndex m_order;
+
   public:
     size_t RegisterModifier();
+    size_t GetCount() { return m_order.size(); }
+
+  public:
+    OvmsMetricDirtySet* AcquireDirtySet();
+    void ReleaseDirtySet(OvmsMetricDirtySet* set);
+    void MarkDirty(OvmsMetric* metric);
+    OvmsMetric* GetSlot(uint32_t slot)
+      {
+      OvmsMetric** page = m_slots[slot / METRICS_SLOTS_PER_PAGE];
+      return (slot < m_slotcount && page) ? page[slot % METRICS_SLOTS_PER_PAGE] : NULL;
+      }
+    uint32_t GetSlotCount() { return m_slotcount; }
 
   public:
     void EventSystemShutDown(std::string event, void* data);
@@ -990,8 +1150,18 @@ class OvmsMetrics
   protected:
     size_t m_nextmodifier;
 
+  protected:
+    uint32_t m_lastid;
+
+  protected:
+    OvmsMetric** m_slots[METRICS_SLOT_PAGES]; // slot → metric, pages allocated on demand
+    uint32_t m_slotcount;                     // slots allocated (high water mark)
+    std::vector<uint16_t> m_slotfree;         // slots released for reuse
+    std::atomic<OvmsMetricDirtySet*> m_dirtysets;
+
   public:
     OvmsMetric* m_first;
+    uint32_t m_generation;            // incremented on every metrics list change
     bool m_trace;
   };
 
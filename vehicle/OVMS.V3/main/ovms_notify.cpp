@@ -36,6 +36,7 @@ static const char *TAG = "notify";
 #include <sstream>
 #include "ovms.h"
 #include "ovms_notify.h"
+#include "ovms_notify_spool.h"
 #include "ovms_command.h"
 #include "ovms_config.h"
 #include "ovms_events.h"
@@ -91,6 +92,8 @@ void notify_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc
       OvmsRecMutexLock lock(&mt->m_mutex);
       writer->printf("  %s: %d entries\n",
         mt->m_name, mt->m_entries.size());
+      if (mt->m_spool)
+        mt->m_spool->Status(writer);
       for (NotifyEntryMap_t::iterator ite=mt->m_entries.begin(); ite!=mt->m_entries.end(); ++ite)
         {
         OvmsNotifyEntry* e = ite->second;
@@ -101,6 +104,21 @@ void notify_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc
     }
   }
 
+void notify_spool_clear(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  OvmsRecMutexLock lock(&MyNotify.m_mutex);
+  for (OvmsNotifyTypeMap_t::iterator itm=MyNotify.m_types.begin(); itm!=MyNotify.m_types.end(); ++itm)
+    {
+    OvmsNotifyType* mt = itm->second;
+    if (!mt->m_spool) continue;
+    OvmsRecMutexLock lock(&mt->m_mutex);
+    if (mt->m_spool->Clear())
+      writer->printf("Spool for %s notifications cleared\n", mt->m_name);
+    else
+      writer->printf("Spool for %s notifications not available\n", mt->m_name);
+    }
+  }
+
 void notify_raise(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   writer->printf("Raise %s notification for %s/%s as %s\n",
@@ -173,6 +191,7 @@ OvmsNotifyEntry::OvmsNotifyEntry(const char* subtype)
   m_created = esp_log_timestamp();
   m_type = NULL;
   m_subtype = strdup(subtype);
+  m_spoolslots = 0;
   }
 
 OvmsNotifyEntry::~OvmsNotifyEntry()
@@ -269,23 +288,39 @@ const extram::string OvmsNotifyEntryCommand::GetValue()
 // OvmsNotifyType is the container for an ordered list of
 // OvmsNotifyEntry objects (being the notification data queued)
 
-OvmsNotifyType::OvmsNotifyType(const char* name)
+OvmsNotifyType::OvmsNotifyType(const char* name, bool spool /*=false*/)
   {
   m_name = name;
   m_nextid = 1;
+  m_spool = spool ? new OvmsNotifySpool(this) : NULL;
   }
 
 OvmsNotifyType::~OvmsNotifyType()
   {
+  if (m_spool)
+    delete m_spool;
   }
 
 uint32_t OvmsNotifyType::QueueEntry(OvmsNotifyEntry* entry)
   {
   OvmsRecMutexLock lock(&m_mutex);
+
+  // Open the spool before allocating the ID, so the sequence continues:
+  if (m_spool)
+    m_spool->Open();
+
   uint32_t id = m_nextid++;
 
   entry->m_id = id;
   entry->m_type = this;
+
+  if (m_spool && m_spool->Queue(entry))
+    {
+    // Spooled for all readers, they will be notified when the entry is loaded:
+    delete entry;
+    return id;
+    }
+
   m_entries[id] = entry;
 
   if (strcmp(m_name, "data") != 0 &&
@@ -301,6 +336,10 @@ uint32_t OvmsNotifyType::QueueEntry(OvmsNotifyEntry* entry)
   // Dispatch the callbacks...
   MyNotify.NotifyReaders(this, entry);
 
+  // Persist if still pending for a spooled reader...
+  if (m_spool)
+    m_spool->Persist(entry);
+
   // Check if we can cleanup...
   Cleanup(entry);
 
@@ -316,6 +355,8 @@ uint32_t OvmsNotifyType::AllocateNextID()
 void OvmsNotifyType::ClearReader(size_t reader)
   {
   OvmsRecMutexLock lock(&m_mutex);
+  if (m_spool)
+    m_spool->Detach(reader);
   if (m_entries.size() > 0)
     {
     NotifyEntryMap_t::iterator next;
@@ -327,6 +368,8 @@ void OvmsNotifyType::ClearReader(size_t reader)
       Cleanup(e, &ite);
       }
     }
+  if (m_spool)
+    m_spool->Update();
   }
 
 OvmsNotifyEntry* OvmsNotifyType::FirstUnreadEntry(size_t reader, uint32_t floor)
@@ -353,9 +396,31 @@ OvmsNotifyEntry* OvmsNotifyType::FindEntry(uint32_t id)
 
 void OvmsNotifyType::MarkRead(size_t reader, OvmsNotifyEntry* entry)
   {
+    {
+    OvmsRecMutexLock lock(&m_mutex);
+    entry->m_pendingreaders &= ~(1ul << reader);
+    Cleanup(entry);
+    }
+  if (m_spool)
+    SpoolUpdate();
+  }
+
+void OvmsNotifyType::AttachReader(OvmsNotifyCallbackEntry* reader)
+  {
+  if (!m_spool) return;
   OvmsRecMutexLock lock(&m_mutex);
-  entry->m_pendingreaders &= ~(1ul << reader);
-  Cleanup(entry);
+  m_spool->Attach(reader);
+  }
+
+/**
+ * SpoolUpdate: advance the spool cursors & load the next entries
+ *  (locks MyNotify first, as loading dispatches the entries)
+ */
+void OvmsNotifyType::SpoolUpdate()
+  {
+  OvmsRecMutexLock notify_lock(&MyNotify.m_mutex);
+  OvmsRecMutexLock lock(&m_mutex);
+  m_spool->Update();
   }
 
 void OvmsNotifyType::Cleanup(OvmsNotifyEntry* entry, NotifyEntryMap_t::iterator* next /*=NULL*/)
@@ -448,6 +513,16 @@ OvmsNotify::OvmsNotify()
 
   MyConfig.RegisterParam("notify", "Notification filters", true, true);
 
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEvent(TAG, "ticker.60", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "system.shuttingdown", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.unmounted", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "sd.mounted", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "sd.unmounting", std::bind(&OvmsNotify::EventListener, this, _1, _2));
+
   // Register our commands
   OvmsCommand* cmd_notify = MyCommandApp.RegisterCommand("notify","NOTIFICATION framework", notify_status, "", 0, 0, false);
   cmd_notify->RegisterCommand("status","Show notification status",notify_status);
@@ -462,12 +537,14 @@ OvmsNotify::OvmsNotify()
   cmd_notifytrace->RegisterCommand("on","Standard notification tracing (text, error & data)",notify_trace);
   cmd_notifytrace->RegisterCommand("all","Full notification tracing (including streams)",notify_trace);
   cmd_notifytrace->RegisterCommand("off","Turn notification tracing OFF",notify_trace);
+  OvmsCommand* cmd_notifyspool = cmd_notify->RegisterCommand("spool","NOTIFICATION spool framework");
+  cmd_notifyspool->RegisterCommand("clear","Discard all spooled notifications",notify_spool_clear);
 
-  RegisterType("info");     // payload: human readable text message
-  RegisterType("error");    // payload: "<vehicletype>,<errorcode>,<errordata>"
-  RegisterType("alert");    // payload: human readable text message
-  RegisterType("data");     // payload: MP historical data record (tagged CSV, see MP documentation)
-  RegisterType("stream");   // payload: subtype specific, use for high volume / short latency data streams
+  RegisterType("info");         // payload: human readable text message
+  RegisterType("error");        // payload: "<vehicletype>,<errorcode>,<errordata>"
+  RegisterType("alert");        // payload: human readable text message
+  RegisterType("data", true);   // payload: MP historical data record (tagged CSV, see MP documentation), spooled
+  RegisterType("stream");       // payload: subtype specific, use for high volume / short latency data streams
 
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   ESP_LOGI(TAG, "Expanding DUKTAPE javascript engine");
@@ -481,13 +558,57 @@ OvmsNotify::~OvmsNotify()
   {
   }
 
+void OvmsNotify::EventListener(std::string event, void* data)
+  {
+  OvmsRecMutexLock lock(&m_mutex);
+  for (OvmsNotifyTypeMap_t::iterator itt=m_types.begin(); itt!=m_types.end(); ++itt)
+    {
+    OvmsNotifyType* mt = itt->second;
+    if (!mt->m_spool) continue;
+    OvmsRecMutexLock lock(&mt->m_mutex);
+    OvmsNotifySpool* spool = mt->m_spool;
+    if (event == "ticker.60")
+      {
+      spool->Sync();
+      }
+    else if (event == "system.shuttingdown")
+      {
+      spool->Flush();
+      spool->Sync();
+      }
+    else if (event == "config.mounted" || event == "sd.mounted")
+      {
+      if (spool->Open())
+        spool->Update();
+      }
+    else if (event == "config.unmounted")
+      {
+      spool->Close(false);
+      }
+    else if (event == "sd.unmounting")
+      {
+      spool->Close();
+      }
+    else if (event == "config.changed")
+      {
+      OvmsConfigParam* param = (OvmsConfigParam*) data;
+      if (!param || param->GetName() == "notify")
+        spool->ConfigChanged();
+      }
+    }
+  }
+
 size_t OvmsNotify::RegisterReader(const char* caller, int verbosity, OvmsNotifyCallback_t callback,
                                   bool configfiltered/*=false*/, OvmsNotifyFilterCallback_t filtercallback/*=NULL*/)
   {
   OvmsRecMutexLock lock(&m_mutex);
   size_t reader = m_nextreader++;
 
-  m_readers[reader] = new OvmsNotifyCallbackEntry(caller, reader, verbosity, callback, configfiltered, filtercallback);
+  OvmsNotifyCallbackEntry* mc = new OvmsNotifyCallbackEntry(caller, reader, verbosity, callback, configfiltered, filtercallback);
+  m_readers[reader] = mc;
+
+  for (OvmsNotifyTypeMap_t::iterator itt=m_types.begin(); itt!=m_types.end(); ++itt)
+    itt->second->AttachReader(mc);
 
   return reader;
   }
@@ -496,7 +617,11 @@ void OvmsNotify::RegisterReader(size_t reader, const char* caller, int verbosity
                                 bool configfiltered/*=false*/, OvmsNotifyFilterCallback_t filtercallback/*=NULL*/)
   {
   OvmsRecMutexLock lock(&m_mutex);
-  m_readers[reader] = new OvmsNotifyCallbackEntry(caller, reader, verbosity, callback, configfiltered, filtercallback);
+  OvmsNotifyCallbackEntry* mc = new OvmsNotifyCallbackEntry(caller, reader, verbosity, callback, configfiltered, filtercallback);
+  m_readers[reader] = mc;
+
+  for (OvmsNotifyTypeMap_t::iterator itt=m_types.begin(); itt!=m_types.end(); ++itt)
+    itt->second->AttachReader(mc);
   }
 
 void OvmsNotify::ClearReader(size_t reader)
@@ -551,6 +676,30 @@ void OvmsNotify::NotifyReaders(OvmsNotifyType* type, OvmsNotifyEntry* entry)
     }
   }
 
+/**
+ * NotifyPendingReaders: deliver an entry loaded from the spool
+ *  - readers: bit mask of the readers to call, if the entry is pending for them
+ */
+void OvmsNotify::NotifyPendingReaders(OvmsNotifyType* type, OvmsNotifyEntry* entry, unsigned long readers)
+  {
+  OvmsRecMutexLock lock(&m_mutex);
+  for (OvmsNotifyCallbackMap_t::iterator itc=m_readers.begin(); itc!=m_readers.end(); ++itc)
+    {
+    OvmsNotifyCallbackEntry* mc = itc->second;
+    if (!(readers & (1ul << mc->m_reader)) || entry->IsRead(mc->m_reader))
+      continue;
+    if (mc->Accepts(type, entry->GetSubType(), entry->GetValueSize()))
+      {
+      if (mc->m_callback(type,entry) == true)
+        entry->m_pendingreaders &= ~(1ul << mc->m_reader);
+      }
+    else
+      {
+      entry->m_pendingreaders &= ~(1ul << mc->m_reader);
+      }
+    }
+  }
+
 bool OvmsNotify::HasReader(const char* type, const char* subtype, size_t size)
   {
   OvmsRecMutexLock lock(&m_mutex);
@@ -564,12 +713,12 @@ bool OvmsNotify::HasReader(const char* type, const char* subtype, size_t size)
   return false;
   }
 
-void OvmsNotify::RegisterType(const char* type)
+void OvmsNotify::RegisterType(const char* type, bool spool /*=false*/)
   {
   OvmsNotifyType* mt = GetType(type);
   if (mt == NULL)
     {
-    mt = new OvmsNotifyType(type);
+    mt = new OvmsNotifyType(type, spool);
     m_types[type] = mt;
     ESP_LOGI(TAG,"Registered notification type %s",type);
     }
@@ -48,6 +48,8 @@
 using namespace std;
 
 class OvmsNotifyType;
+class OvmsNotifySpool;
+class OvmsNotifyCallbackEntry;
 
 class OvmsNotifyEntry : public ExternalRamAllocated
   {
@@ -70,6 +72,7 @@ class OvmsNotifyEntry : public ExternalRamAllocated
     uint32_t m_created;
     OvmsNotifyType* m_type;
     char* m_subtype;
+    uint32_t m_spoolslots;
   };
 
 class OvmsNotifyEntryString : public OvmsNotifyEntry
@@ -107,7 +110,7 @@ typedef std::map<uint32_t, OvmsNotifyEntry*, std::less<uint32_t>,
 class OvmsNotifyType
   {
   public:
-    OvmsNotifyType(const char* name);
+    OvmsNotifyType(const char* name, bool spool=false);
     virtual ~OvmsNotifyType();
 
   public:
@@ -117,6 +120,8 @@ class OvmsNotifyType
     OvmsNotifyEntry* FirstUnreadEntry(size_t reader, uint32_t floor);
     OvmsNotifyEntry* FindEntry(uint32_t id);
     void MarkRead(size_t reader, OvmsNotifyEntry* entry);
+    void AttachReader(OvmsNotifyCallbackEntry* reader);
+    void SpoolUpdate();
 
   protected:
     void Cleanup(OvmsNotifyEntry* entry, NotifyEntryMap_t::iterator* next=NULL);
@@ -126,6 +131,9 @@ class OvmsNotifyType
     uint32_t m_nextid;
     NotifyEntryMap_t m_entries;
     OvmsRecMutex m_mutex;
+    OvmsNotifySpool* m_spool;
+
+  friend class OvmsNotifySpool;
   };
 
 typedef std::function<bool(OvmsNotifyType*,OvmsNotifyEntry*)> OvmsNotifyCallback_t;
@@ -180,15 +188,19 @@ class OvmsNotify : public ExternalRamAllocated
     OvmsNotifyType* GetType(const char* type);
     bool HasReader(const char* type, const char* subtype, size_t size=0);
     void NotifyReaders(OvmsNotifyType* type, OvmsNotifyEntry* entry);
+    void NotifyPendingReaders(OvmsNotifyType* type, OvmsNotifyEntry* entry, unsigned long readers);
 
   public:
-    void RegisterType(const char* type);
+    void RegisterType(const char* type, bool spool=false);
     uint32_t NotifyString(const char* type, const char* subtype, const char* value);
     uint32_t NotifyStringf(const char* type, const char* subtype, const char* fmt, ...);
     uint32_t NotifyCommand(const char* type, const char* subtype, const char* cmd);
     uint32_t NotifyCommandf(const char* type, const char* subtype, const char* fmt, ...);
     void NotifyErrorCode(uint32_t code, uint32_t data, bool raised, bool force=false);
 
+  public:
+    void EventListener(std::string event, void* data);
+
   public:
     OvmsNotifyCallbackMap_t m_readers;
     OvmsRecMutex m_mutex;
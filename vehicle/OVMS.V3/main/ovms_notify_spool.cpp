@@ -0,0 +1,929 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "notify-spool";
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <algorithm>
+#include "ovms_notify_spool.h"
+#include "ovms_config.h"
+#include "ovms_peripherals.h"
+#include "ovms_utils.h"
+#include "crypt_crc.h"
+
+// Record times before this are considered invalid (clock not set):
+#define NOTIFY_SPOOL_TIMEVALID    1500000000
+// Max age of loaded entries [s] (OvmsNotifyEntry::m_created is a millisecond timestamp):
+#define NOTIFY_SPOOL_MAXAGE       2000000
+
+OvmsNotifySpool::OvmsNotifySpool(OvmsNotifyType* type)
+  {
+  m_type = type;
+  m_open = false;
+  m_refilling = false;
+  m_dirty = false;
+  m_enabled = true;
+  m_path = NOTIFY_SPOOL_PATH;
+  m_readers = NOTIFY_SPOOL_READERS;
+  m_window = NOTIFY_SPOOL_WINDOW;
+  m_maxsize = NOTIFY_SPOOL_MAXSIZE * 1024;
+  m_size = 0;
+  m_nextseq = 1;
+  m_lastid = 0;
+  m_cnt_written = 0;
+  m_cnt_deferred = 0;
+  m_cnt_loaded = 0;
+  m_cnt_dropped = 0;
+  }
+
+OvmsNotifySpool::~OvmsNotifySpool()
+  {
+  Close();
+  }
+
+void OvmsNotifySpool::ReadConfig()
+  {
+  m_enabled = MyConfig.GetParamValueBool("notify", "spool.enable", true);
+  m_path = MyConfig.GetParamValue("notify", "spool.path", NOTIFY_SPOOL_PATH);
+  m_readers = MyConfig.GetParamValue("notify", "spool.readers", NOTIFY_SPOOL_READERS);
+  m_window = MyConfig.GetParamValueInt("notify", "spool.window", NOTIFY_SPOOL_WINDOW);
+  if (m_window < 1)
+    m_window = 1;
+  int maxsize = MyConfig.GetParamValueInt("notify", "spool.maxsize", NOTIFY_SPOOL_MAXSIZE);
+  m_maxsize = std::max(maxsize * 1024, 2 * NOTIFY_SPOOL_SEGSIZE);
+  while (endsWith(m_path, '/'))
+    m_path.resize(m_path.size()-1);
+  }
+
+/**
+ * ConfigChanged: apply "notify" config changes
+ *  - window, size & readers take effect immediately, a changed path or
+ *    disabling the spool closes it (entries in memory are kept)
+ */
+void OvmsNotifySpool::ConfigChanged()
+  {
+  bool enabled = m_enabled;
+  std::string path = m_path;
+  ReadConfig();
+  if (m_open && (!m_enabled || path != m_path))
+    {
+    ESP_LOGI(TAG, "%s: configuration changed, closing spool", m_type->m_name);
+    Close();
+    }
+  else if (!enabled && m_enabled)
+    {
+    ESP_LOGI(TAG, "%s: spool enabled", m_type->m_name);
+    }
+  }
+
+bool OvmsNotifySpool::IsAvailable()
+  {
+  if (startsWith(m_path, "/store"))
+    return MyConfig.ismounted();
+#ifdef CONFIG_OVMS_COMP_SDCARD
+  if (startsWith(m_path, "/sd"))
+    return (MyPeripherals && MyPeripherals->m_sdcard && MyPeripherals->m_sdcard->isavailable());
+#endif // #ifdef CONFIG_OVMS_COMP_SDCARD
+  return true;
+  }
+
+bool OvmsNotifySpool::IsSpoolReader(const std::string& name)
+  {
+  size_t pos = 0;
+  while (pos <= m_readers.size())
+    {
+    size_t end = m_readers.find(',', pos);
+    if (end == std::string::npos)
+      end = m_readers.size();
+    if (m_readers.compare(pos, end-pos, name) == 0)
+      return true;
+    pos = end + 1;
+    }
+  return false;
+  }
+
+std::string OvmsNotifySpool::SegPath(uint32_t seq)
+  {
+  char name[32];
+  snprintf(name, sizeof(name), "/%s.%08x.seg", m_type->m_name, seq);
+  return m_path + name;
+  }
+
+std::string OvmsNotifySpool::CursorPath()
+  {
+  return m_path + "/" + m_type->m_name + ".cur";
+  }
+
+/**
+ * Open: mount the spool directory
+ *  - called on demand, fails silently while the storage is not available
+ *  - scans the segments, reads the cursors and attaches the registered readers
+ *  - the caller needs to Refill() the windows
+ */
+bool OvmsNotifySpool::Open()
+  {
+  if (m_open)
+    return true;
+  ReadConfig();
+  if (!m_enabled || !IsAvailable())
+    return false;
+
+  if (mkpath(m_path) != 0)
+    {
+    ESP_LOGE(TAG, "Open: can't create directory '%s': %s", m_path.c_str(), strerror(errno));
+    return false;
+    }
+  DIR* dir = opendir(m_path.c_str());
+  if (!dir)
+    {
+    ESP_LOGE(TAG, "Open: can't read directory '%s': %s", m_path.c_str(), strerror(errno));
+    return false;
+    }
+
+  // Collect segment files:
+  std::vector<uint32_t> seqs;
+  std::string prefix = std::string(m_type->m_name) + ".";
+  struct dirent* dp;
+  while ((dp = readdir(dir)) != NULL)
+    {
+    unsigned int seq;
+    char ext[4];
+    if (startsWith(std::string(dp->d_name), prefix) &&
+        sscanf(dp->d_name + prefix.size(), "%8x.%3s", &seq, ext) == 2 &&
+        strcasecmp(ext, "seg") == 0)
+      seqs.push_back(seq);
+    }
+  closedir(dir);
+  std::sort(seqs.begin(), seqs.end());
+
+  m_segs.clear();
+  m_size = 0;
+  m_lastid = 0;
+  m_nextseq = seqs.empty() ? 1 : seqs.back() + 1;
+  for (uint32_t seq : seqs)
+    {
+    notify_spool_seg_t seg = { seq, 0, 0, 0, 0, false };
+    ScanSegment(seg);
+    if (seg.count == 0)
+      {
+      unlink(SegPath(seq).c_str());
+      continue;
+      }
+    m_segs.push_back(seg);
+    m_size += seg.size;
+    m_lastid = seg.lastid;
+    }
+
+  ReadCursors();
+
+  // Continue the ID sequence:
+  uint32_t maxid = m_lastid;
+  for (auto& slot : m_slots)
+    maxid = std::max(maxid, slot.cursor);
+  if (m_type->m_nextid <= maxid)
+    m_type->m_nextid = maxid + 1;
+
+  m_open = true;
+
+  // Attach registered readers:
+  for (auto it = MyNotify.m_readers.begin(); it != MyNotify.m_readers.end(); ++it)
+    {
+    if (IsSpoolReader(it->second->m_caller))
+      AttachSlot(it->second);
+    }
+
+  ESP_LOGI(TAG, "%s: opened spool '%s': %d segments, %u bytes, last ID %u",
+    m_type->m_name, m_path.c_str(), m_segs.size(), m_size, m_lastid);
+  return true;
+  }
+
+/**
+ * Close: write the pending entries & cursors, release the storage
+ *  - entries in memory are kept, records not yet loaded are loaded after the next Open()
+ */
+void OvmsNotifySpool::Close(bool sync /*=true*/)
+  {
+  if (!m_open)
+    return;
+  if (sync)
+    {
+    Flush();
+    Sync();
+    }
+  m_segs.clear();
+  m_slots.clear();
+  m_size = 0;
+  m_open = false;
+  ESP_LOGI(TAG, "%s: spool closed", m_type->m_name);
+  }
+
+/**
+ * Clear: discard all spooled records, move all cursors to the end
+ */
+bool OvmsNotifySpool::Clear()
+  {
+  if (!Open())
+    return false;
+  for (auto& seg : m_segs)
+    unlink(SegPath(seg.seq).c_str());
+  m_segs.clear();
+  m_size = 0;
+  for (auto& slot : m_slots)
+    {
+    slot.cursor = slot.loadpos = m_lastid;
+    slot.readseq = slot.readofs = 0;
+    }
+  WriteCursors();
+  return true;
+  }
+
+void OvmsNotifySpool::Sync()
+  {
+  if (m_open && m_dirty)
+    WriteCursors();
+  }
+
+void OvmsNotifySpool::Status(OvmsWriter* writer)
+  {
+  if (!m_open)
+    {
+    writer->printf("    spool: %s\n", m_enabled ? "closed (storage not available)" : "disabled");
+    return;
+    }
+  writer->printf("    spool: '%s': %d segments, %u bytes, last ID %u\n",
+    m_path.c_str(), m_segs.size(), m_size, m_lastid);
+  writer->printf("    spool: %u written, %u deferred, %u loaded, %u dropped\n",
+    m_cnt_written, m_cnt_deferred, m_cnt_loaded, m_cnt_dropped);
+  for (auto& slot : m_slots)
+    {
+    if (slot.readers)
+      writer->printf("      %s: cursor %u, loaded up to %u, %d in memory\n",
+        slot.name.c_str(), slot.cursor, slot.loadpos, CountPending(slot.readers));
+    else if (slot.stopped)
+      writer->printf("      %s: cursor %u, stopped\n", slot.name.c_str(), slot.cursor);
+    else
+      writer->printf("      %s: cursor %u, detached\n", slot.name.c_str(), slot.cursor);
+    }
+  }
+
+/**
+ * ScanSegment: validate a segment file, determine size & ID range
+ *  - a damaged record (e.g. by a power loss during a write) ends the segment
+ */
+void OvmsNotifySpool::ScanSegment(notify_spool_seg_t& seg)
+  {
+  std::string path = SegPath(seg.seq);
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f)
+    {
+    ESP_LOGE(TAG, "Open: can't read '%s': %s", path.c_str(), strerror(errno));
+    return;
+    }
+
+  notify_spool_rec_t rec;
+  std::string subtype;
+  extram::string value;
+  while (ReadRecord(f, rec, subtype, value))
+    {
+    if (rec.id <= seg.lastid || rec.id <= m_lastid)
+      break;
+    seg.count++;
+    if (seg.firstid == 0)
+      seg.firstid = rec.id;
+    seg.lastid = rec.id;
+    seg.size += sizeof(rec) + rec.sublen + rec.vallen;
+    }
+
+  fseek(f, 0, SEEK_END);
+  long filesize = ftell(f);
+  fclose(f);
+  if (filesize != (long)seg.size)
+    {
+    ESP_LOGW(TAG, "Open: '%s': damaged record at offset %u, %ld bytes skipped",
+      path.c_str(), seg.size, filesize - (long)seg.size);
+    seg.sealed = true;
+    m_cnt_dropped++;
+    }
+  }
+
+bool OvmsNotifySpool::ReadRecord(FILE* f, notify_spool_rec_t& rec, std::string& subtype, extram::string& value)
+  {
+  if (fread(&rec, sizeof(rec), 1, f) != 1 || rec.magic != NOTIFY_SPOOL_MAGIC)
+    return false;
+  subtype.resize(rec.sublen);
+  value.resize(rec.vallen);
+  if ((rec.sublen && fread(&subtype[0], rec.sublen, 1, f) != 1) ||
+      (rec.vallen && fread(&value[0], rec.vallen, 1, f) != 1))
+    return false;
+  return (RecordCRC(rec, subtype.data(), value.data()) == rec.crc);
+  }
+
+uint16_t OvmsNotifySpool::RecordCRC(notify_spool_rec_t rec, const char* subtype, const char* value)
+  {
+  rec.crc = 0;
+  uint16_t crc = crc16_ccitt(0, (const uint8_t*)&rec, sizeof(rec));
+  crc = crc16_ccitt(crc, (const uint8_t*)subtype, rec.sublen);
+  return crc16_ccitt(crc, (const uint8_t*)value, rec.vallen);
+  }
+
+/**
+ * Append: write an entry to the spool
+ *  - slots: the reader slots the entry is pending for
+ *  - drops the oldest segment if the size limit would be exceeded
+ */
+bool OvmsNotifySpool::Append(OvmsNotifyEntry* entry, uint32_t slots)
+  {
+  const extram::string value = entry->GetValue();
+  const char* subtype = entry->GetSubType();
+  size_t sublen = strlen(subtype);
+  if (sublen > UINT16_MAX || value.size() > UINT16_MAX)
+    {
+    ESP_LOGW(TAG, "%s: entry %u too large, not spooled", m_type->m_name, entry->m_id);
+    return false;
+    }
+
+  notify_spool_rec_t rec;
+  rec.magic = NOTIFY_SPOOL_MAGIC;
+  rec.id = entry->m_id;
+  time_t now = time(NULL);
+  rec.time = (now > NOTIFY_SPOOL_TIMEVALID)
+    ? now - (esp_log_timestamp() - entry->m_created) / 1000
+    : 0;
+  rec.slots = slots;
+  rec.sublen = sublen;
+  rec.vallen = value.size();
+  rec.crc = RecordCRC(rec, subtype, value.data());
+  size_t len = sizeof(rec) + rec.sublen + rec.vallen;
+
+  while (!m_segs.empty() && m_size + len > m_maxsize)
+    DropSegment();
+
+  if (m_segs.empty() || m_segs.back().sealed || m_segs.back().size + len > NOTIFY_SPOOL_SEGSIZE)
+    {
+    notify_spool_seg_t seg = { m_nextseq++, 0, 0, 0, 0, false };
+    m_segs.push_back(seg);
+    }
+  notify_spool_seg_t& seg = m_segs.back();
+
+  std::string path = SegPath(seg.seq);
+  FILE* f = fopen(path.c_str(), "a");
+  bool ok = (f != NULL);
+  if (ok)
+    {
+    ok = (fwrite(&rec, sizeof(rec), 1, f) == 1) &&
+         (rec.sublen == 0 || fwrite(subtype, rec.sublen, 1, f) == 1) &&
+         (rec.vallen == 0 || fwrite(value.data(), rec.vallen, 1, f) == 1);
+    if (fclose(f) != 0)
+      ok = false;
+    }
+  if (!ok)
+    {
+    ESP_LOGE(TAG, "Append: error writing '%s': %s", path.c_str(), strerror(errno));
+    if (seg.count == 0)
+      {
+      unlink(path.c_str());
+      m_segs.pop_back();
+      }
+    else
+      {
+      seg.sealed = true;
+      }
+    return false;
+    }
+
+  seg.size += len;
+  seg.count++;
+  if (seg.firstid == 0)
+    seg.firstid = rec.id;
+  seg.lastid = rec.id;
+  m_size += len;
+  m_lastid = rec.id;
+  m_cnt_written++;
+  entry->m_spoolslots = slots;
+  return true;
+  }
+
+/**
+ * DropSegment: delete the oldest segment on overflow
+ */
+void OvmsNotifySpool::DropSegment()
+  {
+  notify_spool_seg_t& seg = m_segs.front();
+  ESP_LOGW(TAG, "%s: spool full, dropping %u records (IDs %u-%u)",
+    m_type->m_name, seg.count, seg.firstid, seg.lastid);
+  m_cnt_dropped += seg.count;
+  for (auto& slot : m_slots)
+    {
+    if (slot.loadpos < seg.lastid)
+      slot.loadpos = seg.lastid;
+    }
+  m_size -= seg.size;
+  unlink(SegPath(seg.seq).c_str());
+  m_segs.pop_front();
+  }
+
+void OvmsNotifySpool::ReadCursors()
+  {
+  m_slots.clear();
+  std::string path = CursorPath();
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f)
+    {
+    // the cursors may have been interrupted after removing the old file:
+    f = fopen((path + "~").c_str(), "r");
+    if (!f) return;
+    }
+  char name[32];
+  unsigned int cursor;
+  while (m_slots.size() < NOTIFY_MAX_READERS && fscanf(f, "%31s %u", name, &cursor) == 2)
+    {
+    bool stopped = (name[0] == '-');
+    notify_spool_slot_t slot = { stopped ? name+1 : name, cursor, 0, cursor, 0, 0, stopped };
+    m_slots.push_back(slot);
+    }
+  fclose(f);
+  m_dirty = false;
+  }
+
+/**
+ * WriteCursors: save the reader cursors, one line "<name> <cursor>" per
+ *  slot ("-<name>" if stopped), the line number is the slot index used in the records
+ */
+bool OvmsNotifySpool::WriteCursors()
+  {
+  std::string path = CursorPath();
+  std::string tmppath = path + "~";
+  FILE* f = fopen(tmppath.c_str(), "w");
+  if (!f)
+    {
+    ESP_LOGE(TAG, "WriteCursors: can't open '%s': %s", tmppath.c_str(), strerror(errno));
+    return false;
+    }
+  for (auto& slot : m_slots)
+    fprintf(f, "%s%s %u\n", slot.stopped ? "-" : "", slot.name.c_str(), slot.cursor);
+  if (fclose(f) != 0)
+    {
+    ESP_LOGE(TAG, "WriteCursors: error writing '%s': %s", tmppath.c_str(), strerror(errno));
+    unlink(tmppath.c_str());
+    return false;
+    }
+  unlink(path.c_str());
+  if (rename(tmppath.c_str(), path.c_str()) != 0)
+    {
+    ESP_LOGE(TAG, "WriteCursors: can't rename '%s': %s", tmppath.c_str(), strerror(errno));
+    return false;
+    }
+  m_dirty = false;
+  return true;
+  }
+
+/**
+ * AttachSlot: add a reader to the slot of its name
+ *  - a new or stopped slot starts at the current end of the spool
+ *  - new slots are written immediately, records refer to them by index
+ *  - returns the slot index or -1
+ */
+int OvmsNotifySpool::AttachSlot(OvmsNotifyCallbackEntry* reader)
+  {
+  int s;
+  for (s = 0; s < (int)m_slots.size(); s++)
+    {
+    if (m_slots[s].name == reader->m_caller)
+      break;
+    }
+  if (s == (int)m_slots.size())
+    {
+    if (m_slots.size() >= NOTIFY_MAX_READERS)
+      {
+      ESP_LOGW(TAG, "%s: no free slot for reader '%s'", m_type->m_name, reader->m_caller);
+      return -1;
+      }
+    notify_spool_slot_t slot = { reader->m_caller, m_lastid, 0, m_lastid, 0, 0, false };
+    m_slots.push_back(slot);
+    WriteCursors();
+    }
+  else if (m_slots[s].stopped)
+    {
+    notify_spool_slot_t& slot = m_slots[s];
+    ESP_LOGI(TAG, "%s: reader '%s' restarted at ID %u", m_type->m_name, reader->m_caller, m_lastid + 1);
+    slot.cursor = slot.loadpos = m_lastid;
+    slot.readseq = slot.readofs = 0;
+    slot.stopped = false;
+    m_dirty = true;
+    }
+  m_slots[s].readers |= (1ul << reader->m_reader);
+  return s;
+  }
+
+uint32_t OvmsNotifySpool::SlotMask(unsigned long pendingreaders)
+  {
+  uint32_t slots = 0;
+  for (size_t s = 0; s < m_slots.size(); s++)
+    {
+    if (m_slots[s].readers & pendingreaders)
+      slots |= (1ul << s);
+    }
+  return slots;
+  }
+
+/**
+ * DetachedSlots: slots of configured readers currently not registered
+ *  and not stopped, they collect all entries until their reader returns
+ */
+uint32_t OvmsNotifySpool::DetachedSlots()
+  {
+  uint32_t slots = 0;
+  for (size_t s = 0; s < m_slots.size(); s++)
+    {
+    if (m_slots[s].readers == 0 && !m_slots[s].stopped && IsSpoolReader(m_slots[s].name))
+      slots |= (1ul << s);
+    }
+  return slots;
+  }
+
+/**
+ * CountPending: count the entries in memory pending for any of the readers
+ */
+int OvmsNotifySpool::CountPending(unsigned long readers)
+  {
+  int cnt = 0;
+  for (auto it = m_type->m_entries.begin(); it != m_type->m_entries.end(); ++it)
+    {
+    if (it->second->m_pendingreaders & readers)
+      cnt++;
+    }
+  return cnt;
+  }
+
+/**
+ * Attach: a reader has been registered
+ *  - if the slot was detached, it resumes loading at its cursor, i.e. after
+ *    a reboot or restart of the reader, the unacknowledged entries are
+ *    delivered again
+ *  - the new reader is not called back for the entries, it needs to check
+ *    for unread entries when ready
+ */
+void OvmsNotifySpool::Attach(OvmsNotifyCallbackEntry* reader)
+  {
+  if (!IsSpoolReader(reader->m_caller))
+    return;
+  if (!m_open)
+    {
+    // attaches all registered readers:
+    if (Open())
+      Refill(reader->m_reader);
+    return;
+    }
+
+  bool detached = true;
+  for (auto& slot : m_slots)
+    {
+    if (slot.name == reader->m_caller && slot.readers != 0)
+      detached = false;
+    }
+  int s = AttachSlot(reader);
+  if (s < 0)
+    return;
+  notify_spool_slot_t& slot = m_slots[s];
+  if (detached && slot.loadpos > slot.cursor)
+    {
+    ESP_LOGI(TAG, "%s: reader '%s' resumes at ID %u", m_type->m_name, reader->m_caller, slot.cursor + 1);
+    slot.loadpos = slot.cursor;
+    slot.readseq = slot.readofs = 0;
+    }
+  Refill(reader->m_reader);
+  }
+
+/**
+ * Detach: a reader is being unregistered, i.e. stopped deliberately
+ *  - the slot stops collecting entries when its last reader leaves, so it
+ *    doesn't hold back the segment removal while the reader is stopped
+ *  - a restarted reader continues at the end of the spool, after a reboot
+ *    the readers (not detached) resume at their cursors
+ */
+void OvmsNotifySpool::Detach(size_t reader)
+  {
+  if (!m_open)
+    return;
+  UpdateCursors();
+  for (auto& slot : m_slots)
+    {
+    if (!(slot.readers & (1ul << reader)))
+      continue;
+    slot.readers &= ~(1ul << reader);
+    if (slot.readers == 0)
+      {
+      ESP_LOGI(TAG, "%s: reader '%s' stopped at ID %u", m_type->m_name, slot.name.c_str(), slot.cursor);
+      slot.stopped = true;
+      m_dirty = true;
+      }
+    }
+  }
+
+/**
+ * Queue: spool a new entry for slots with a full window or a backlog
+ *  - the entry is removed from the readers of these slots, they get it when
+ *    it's loaded in order
+ *  - returns true if the entry has no other readers and needs not be queued
+ */
+bool OvmsNotifySpool::Queue(OvmsNotifyEntry* entry)
+  {
+  if (!m_open)
+    return false;
+  Refill();
+
+  uint32_t slots = SlotMask(entry->m_pendingreaders);
+  uint32_t defer = 0;
+  for (size_t s = 0; s < m_slots.size(); s++)
+    {
+    notify_spool_slot_t& slot = m_slots[s];
+    if ((slots & (1ul << s)) &&
+        (slot.loadpos < m_lastid || CountPending(slot.readers) >= m_window))
+      defer |= (1ul << s);
+    }
+  if (defer == 0)
+    return false;
+
+  Flush();
+  uint32_t prevlastid = m_lastid;
+  if (!Append(entry, slots | DetachedSlots()))
+    return false;
+  SkipAppended(prevlastid, defer);
+  m_cnt_deferred++;
+  ESP_LOGD(TAG, "%s: entry %u deferred, %d in memory", m_type->m_name, entry->m_id, m_type->m_entries.size());
+
+  for (size_t s = 0; s < m_slots.size(); s++)
+    {
+    if (defer & (1ul << s))
+      entry->m_pendingreaders &= ~m_slots[s].readers;
+    }
+  return entry->m_pendingreaders == 0;
+  }
+
+/**
+ * Persist: spool an entry queued in memory, if a configured reader is offline
+ *  - entries only pending for attached readers stay in memory, see Flush()
+ */
+void OvmsNotifySpool::Persist(OvmsNotifyEntry* entry)
+  {
+  if (!m_open || entry->m_spoolslots || DetachedSlots() == 0)
+    return;
+  Flush();
+  }
+
+/**
+ * Flush: spool the entries in memory still pending for a spooled reader
+ *  - called before any later entry is appended (keeping the ID order), and
+ *    on shutdown / close
+ *  - entries with IDs below the last record have already been handled that
+ *    way, they are skipped
+ */
+void OvmsNotifySpool::Flush()
+  {
+  if (!m_open)
+    return;
+  uint32_t detached = DetachedSlots();
+  for (auto it = m_type->m_entries.begin(); it != m_type->m_entries.end(); ++it)
+    {
+    OvmsNotifyEntry* entry = it->second;
+    if (it->first <= m_lastid || entry->m_spoolslots)
+      continue;
+    uint32_t prevlastid = m_lastid;
+    uint32_t slots = SlotMask(entry->m_pendingreaders) | detached;
+    if (slots && Append(entry, slots))
+      SkipAppended(prevlastid, 0);
+    }
+  }
+
+/**
+ * SkipAppended: move the slots that had no backlog before an append past
+ *  the new record, except the slots it has been deferred for
+ */
+void OvmsNotifySpool::SkipAppended(uint32_t prevlastid, uint32_t deferslots)
+  {
+  for (size_t s = 0; s < m_slots.size(); s++)
+    {
+    notify_spool_slot_t& slot = m_slots[s];
+    if (slot.loadpos == prevlastid && !(deferslots & (1ul << s)))
+      {
+      slot.loadpos = m_lastid;
+      slot.readseq = m_segs.back().seq;
+      slot.readofs = m_segs.back().size;
+      }
+    }
+  }
+
+/**
+ * Update: process acknowledgements (entries removed from memory)
+ */
+void OvmsNotifySpool::Update()
+  {
+  if (!m_open || m_refilling)
+    return;
+  Refill();
+  UpdateCursors();
+  Compact();
+  }
+
+/**
+ * Refill: load spooled records into the windows of the attached slots
+ *  - loaded entries are dispatched to the slot readers, except quietreader
+ */
+void OvmsNotifySpool::Refill(size_t quietreader /*=0*/)
+  {
+  if (!m_open || m_refilling)
+    return;
+  m_refilling = true;
+  for (size_t s = 0; s < m_slots.size(); s++)
+    {
+    if (m_slots[s].readers)
+      RefillSlot(s, quietreader);
+    }
+  m_refilling = false;
+  }
+
+void OvmsNotifySpool::RefillSlot(size_t s, size_t quietreader)
+  {
+  notify_spool_slot_t& slot = m_slots[s];
+  FILE* f = NULL;
+  uint32_t fseq = 0;
+  notify_spool_rec_t rec;
+  std::string subtype;
+  extram::string value;
+
+  while (slot.loadpos < m_lastid && CountPending(slot.readers) < m_window)
+    {
+    // find read segment:
+    auto seg = m_segs.begin();
+    while (seg != m_segs.end() && (seg->seq < slot.readseq || seg->lastid <= slot.loadpos))
+      ++seg;
+    if (seg == m_segs.end())
+      {
+      slot.loadpos = m_lastid;
+      break;
+      }
+    if (seg->seq != slot.readseq)
+      {
+      slot.readseq = seg->seq;
+      slot.readofs = 0;
+      }
+    if (slot.readofs >= seg->size)
+      {
+      slot.readseq++;
+      slot.readofs = 0;
+      continue;
+      }
+
+    // read next record:
+    if (!f || fseq != seg->seq)
+      {
+      if (f) fclose(f);
+      fseq = seg->seq;
+      f = fopen(SegPath(fseq).c_str(), "r");
+      if (f && fseek(f, slot.readofs, SEEK_SET) != 0)
+        {
+        fclose(f);
+        f = NULL;
+        }
+      if (!f)
+        {
+        ESP_LOGE(TAG, "Refill: can't read '%s': %s", SegPath(fseq).c_str(), strerror(errno));
+        m_cnt_dropped += seg->count;
+        slot.readofs = seg->size;
+        continue;
+        }
+      }
+    if (!ReadRecord(f, rec, subtype, value))
+      {
+      ESP_LOGE(TAG, "Refill: '%s': damaged record at offset %u, skipping segment",
+        SegPath(fseq).c_str(), slot.readofs);
+      m_cnt_dropped++;
+      slot.readofs = seg->size;
+      continue;
+      }
+    slot.readofs += sizeof(rec) + rec.sublen + rec.vallen;
+    if (rec.id <= slot.loadpos)
+      continue;
+    slot.loadpos = rec.id;
+    if (!(rec.slots & (1ul << s)) || rec.id <= slot.cursor)
+      continue;
+
+    OvmsNotifyEntry* e;
+    auto it = m_type->m_entries.find(rec.id);
+    if (it != m_type->m_entries.end())
+      {
+      // still in memory for other readers:
+      e = it->second;
+      if (e->m_pendingreaders & slot.readers)
+        continue;
+      }
+    else
+      {
+      e = new OvmsNotifyEntryString(subtype.c_str(), value.c_str());
+      uint32_t age = 0;
+      time_t now = time(NULL);
+      if (rec.time > NOTIFY_SPOOL_TIMEVALID && now > (time_t)rec.time)
+        age = std::min((uint32_t)(now - rec.time), (uint32_t)NOTIFY_SPOOL_MAXAGE);
+      e->m_created = esp_log_timestamp() - age * 1000;
+      e->m_id = rec.id;
+      e->m_type = m_type;
+      e->m_spoolslots = rec.slots;
+      m_type->m_entries[rec.id] = e;
+      }
+    e->m_pendingreaders |= slot.readers;
+    m_cnt_loaded++;
+
+    unsigned long notify = slot.readers;
+    if (quietreader)
+      notify &= ~(1ul << quietreader);
+    MyNotify.NotifyPendingReaders(m_type, e, notify);
+    m_type->Cleanup(e);
+    }
+
+  if (f) fclose(f);
+  }
+
+/**
+ * UpdateCursors: advance the cursors of attached slots to the first entry
+ *  in memory still pending for the slot
+ */
+void OvmsNotifySpool::UpdateCursors()
+  {
+  for (auto& slot : m_slots)
+    {
+    if (slot.readers == 0)
+      continue;
+    uint32_t cursor = slot.loadpos;
+    for (auto it = m_type->m_entries.begin(); it != m_type->m_entries.end(); ++it)
+      {
+      if (it->second->m_pendingreaders & slot.readers)
+        {
+        cursor = std::min(cursor, it->first - 1);
+        break;
+        }
+      }
+    if (cursor > slot.cursor)
+      {
+      slot.cursor = cursor;
+      m_dirty = true;
+      }
+    }
+  }
+
+/**
+ * Compact: delete the segments all configured readers not stopped have passed
+ */
+void OvmsNotifySpool::Compact()
+  {
+  uint32_t floor = m_lastid;
+  for (auto& slot : m_slots)
+    {
+    if (IsSpoolReader(slot.name) && !slot.stopped)
+      floor = std::min(floor, slot.cursor);
+    }
+  if (m_segs.empty() || m_segs.front().lastid > floor)
+    return;
+
+  // write the cursors first, they continue the ID sequence when all segments are gone:
+  WriteCursors();
+  while (!m_segs.empty() && m_segs.front().lastid <= floor)
+    {
+    notify_spool_seg_t& seg = m_segs.front();
+    ESP_LOGD(TAG, "%s: segment %08x done, removing", m_type->m_name, seg.seq);
+    m_size -= seg.size;
+    unlink(SegPath(seg.seq).c_str());
+    m_segs.pop_front();
+    }
+  }
@@ -0,0 +1,190 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OVMS_NOTIFY_SPOOL_H__
+#define __OVMS_NOTIFY_SPOOL_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include "ovms_notify.h"
+#include "ovms_command.h"
+
+#define NOTIFY_SPOOL_PATH         "/store/notify"   // Default spool directory
+#define NOTIFY_SPOOL_READERS      "ovmsv2,ovmsv3"   // Default readers to spool entries for
+#define NOTIFY_SPOOL_WINDOW       20                // Default max entries held in memory
+#define NOTIFY_SPOOL_MAXSIZE      128               // Default max spool size [kB]
+#define NOTIFY_SPOOL_SEGSIZE      16384             // Segment file size limit [bytes]
+#define NOTIFY_SPOOL_MAGIC        0x4e53            // Record header magic
+
+/**
+ * OvmsNotifySpool: persistent queue for a notification type
+ *
+ * Entries for spooled readers ("spool.readers", by caller name) are appended
+ * to segment files in the spool directory ("<type>.<seq>.seg") when they
+ * can't be kept in memory: on deferral (see below), while a configured
+ * reader is offline, and on shutdown. Entries in memory are written in ID
+ * order before any later entry, to keep the segments sorted. Entries
+ * acknowledged while in memory are not written at all, so a crash or power
+ * loss can lose up to a window of entries per reader, in exchange for
+ * sparing the flash a write per entry. Spooled readers are managed in slots by
+ * name, each slot has its own window of unread entries in memory
+ * ("spool.window"): while the window of a slot is full, new entries are kept
+ * in the spool only for the slot, and are loaded & dispatched in order as the
+ * slot's readers acknowledge their window entries. Other readers get new
+ * entries immediately, so a stalled reader does not block the others.
+ * Slots of configured readers not currently registered collect all new
+ * entries until their reader returns. A reader stopped deliberately
+ * (unregistered, e.g. by a server stop) leaves its slot stopped: the slot
+ * collects nothing and doesn't hold back the segment removal, the reader
+ * restarts at the end of the spool.
+ *
+ * Reader progress is kept per slot as an ack cursor (all IDs up to the
+ * cursor have been read), written to "<type>.cur" once per minute and on
+ * shutdown (stopped slots are written with a '-' name prefix). Segments are deleted when all cursors have passed them. On
+ * reboot or reader restart, delivery resumes at the cursor, so entries
+ * acknowledged after the last cursor write may be delivered again.
+ *
+ * The spool size is limited to "spool.maxsize" kB, on overflow the oldest
+ * segment is dropped.
+ *
+ * All methods need to be called with the type mutex locked, methods that may
+ * dispatch entries (Queue, Attach, Update, Refill) also need the MyNotify
+ * mutex to be locked before the type mutex.
+ */
+
+typedef struct __attribute__((packed))
+  {
+  uint16_t      magic;            // NOTIFY_SPOOL_MAGIC
+  uint16_t      crc;              // CRC16-CCITT of header (crc=0), subtype & value
+  uint32_t      id;               // Entry ID
+  uint32_t      time;             // Creation time (UTC seconds, 0 = unknown)
+  uint32_t      slots;            // Reader slots the entry is pending for
+  uint16_t      sublen;           // Subtype length
+  uint16_t      vallen;           // Value length
+  } notify_spool_rec_t;
+
+typedef struct
+  {
+  uint32_t      seq;              // File sequence number
+  uint32_t      size;             // Valid data size
+  uint32_t      count;            // Record count
+  uint32_t      firstid;
+  uint32_t      lastid;
+  bool          sealed;           // No appends (damaged / write error)
+  } notify_spool_seg_t;
+
+typedef struct
+  {
+  std::string   name;             // Reader name (caller)
+  uint32_t      cursor;           // IDs up to this have been read
+  unsigned long readers;          // Attached reader bits
+  uint32_t      loadpos;          // Last ID loaded or skipped
+  uint32_t      readseq;          // Read position: segment…
+  uint32_t      readofs;          // …and offset
+  bool          stopped;          // Reader stopped deliberately, collects nothing
+  } notify_spool_slot_t;
+
+class OvmsNotifySpool
+  {
+  public:
+    OvmsNotifySpool(OvmsNotifyType* type);
+    ~OvmsNotifySpool();
+
+  public:
+    bool Open();
+    void Close(bool sync=true);
+    bool IsOpen() { return m_open; }
+    bool Clear();
+    void Sync();
+    void Flush();
+    void ConfigChanged();
+    void Status(OvmsWriter* writer);
+
+  public:
+    bool Queue(OvmsNotifyEntry* entry);
+    void Persist(OvmsNotifyEntry* entry);
+    void Attach(OvmsNotifyCallbackEntry* reader);
+    void Detach(size_t reader);
+    void Update();
+    void Refill(size_t quietreader=0);
+
+  protected:
+    void ReadConfig();
+    bool IsAvailable();
+    bool IsSpoolReader(const std::string& name);
+    std::string SegPath(uint32_t seq);
+    std::string CursorPath();
+    void ScanSegment(notify_spool_seg_t& seg);
+    bool ReadRecord(FILE* f, notify_spool_rec_t& rec, std::string& subtype, extram::string& value);
+    uint16_t RecordCRC(notify_spool_rec_t rec, const char* subtype, const char* value);
+    bool Append(OvmsNotifyEntry* entry, uint32_t slots);
+    void DropSegment();
+    void ReadCursors();
+    bool WriteCursors();
+    int AttachSlot(OvmsNotifyCallbackEntry* reader);
+    uint32_t SlotMask(unsigned long pendingreaders);
+    uint32_t DetachedSlots();
+    int CountPending(unsigned long readers);
+    void SkipAppended(uint32_t prevlastid, uint32_t deferslots);
+    void RefillSlot(size_t s, size_t quietreader);
+    void UpdateCursors();
+    void Compact();
+
+  protected:
+    OvmsNotifyType*   m_type;
+    bool              m_open;
+    bool              m_refilling;
+    bool              m_dirty;            // Cursors need to be written
+
+    // Configuration:
+    bool              m_enabled;
+    std::string       m_path;
+    std::string       m_readers;
+    int               m_window;
+    size_t            m_maxsize;
+
+    // Storage state:
+    std::deque<notify_spool_seg_t>    m_segs;
+    std::vector<notify_spool_slot_t>  m_slots;
+    size_t            m_size;             // Sum of segment sizes
+    uint32_t          m_nextseq;          // Next segment sequence number
+    uint32_t          m_lastid;           // Last ID written
+
+    // Statistics:
+    uint32_t          m_cnt_written;
+    uint32_t          m_cnt_deferred;     // Entries not kept in memory
+    uint32_t          m_cnt_loaded;
+    uint32_t          m_cnt_dropped;      // Records lost by overflow / damage
+  };
+
+#endif //#ifndef __OVMS_NOTIFY_SPOOL_H__
@@ -80,6 +80,25 @@ struct CmpStrOp
     }
   };
 
+// C string hashing & equality for std::unordered_map et al (FNV-1a):
+struct HashStrOp
+  {
+  std::size_t operator()(char const *s) const
+    {
+    uint32_t h = 2166136261u;
+    while (*s)
+      h = (h ^ (uint8_t)*s++) * 16777619u;
+    return h;
+    }
+  };
+struct EqStrOp
+  {
+  bool operator()(char const *a, char const *b) const
+    {
+    return std::strcmp(a, b) == 0;
+    }
+  };
+
 // Tolerant boolean string analyzer:
 inline bool strtobool(const std::string& str)
   {
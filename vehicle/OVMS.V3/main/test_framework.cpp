@@ -34,6 +34,10 @@ static const char *TAG = "test";
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <map>
+#include <sys/param.h>
 #include "esp_system.h"
 #include "esp_event.h"
 #include "esp_event_loop.h"
@@ -45,7 +49,20 @@ static const char *TAG = "test";
 #include "metrics_standard.h"
 #include "ovms_config.h"
 #include "can.h"
+#include "canformat.h"
+#include "canlog.h"
+#include "dbc.h"
+#include "dbc_app.h"
 #include "strverscmp.h"
+#include "ovms_location.h"
+#include "ovms_utils.h"
+#include "vehicle.h"
+#ifdef CONFIG_OVMS_COMP_RE_TOOLS
+#include "retools.h"
+#endif // CONFIG_OVMS_COMP_RE_TOOLS
+#ifdef CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+#include "ovms_server_v2.h"
+#endif // CONFIG_OVMS_DEV_SERVER_V2_VERIFY
 
 void test_deepsleep(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
@@ -292,6 +309,400 @@ void test_can(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, con
     frames, elapsed / 1000000, elapsed % 1000000, uspt);
   }
 
+void test_canreplay(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  canformat* fmt = MyCanFormatFactory.NewFormat(argv[0]);
+  if (fmt == NULL)
+    {
+    writer->printf("Error: unknown CAN format '%s'\n", argv[0]);
+    return;
+    }
+  FILE* f = fopen(argv[1], "r");
+  if (f == NULL)
+    {
+    writer->printf("Error: cannot open '%s'\n", argv[1]);
+    delete fmt;
+    return;
+    }
+  fmt->SetServeMode(canformat::Simulate);
+
+  uint32_t rx_start = 0, rx_end = 0;
+  for (int k = 0; k < CAN_MAXBUSES; k++)
+    {
+    canbus* bus = MyCan.GetBus(k);
+    if (bus) rx_start += bus->m_status.packets_rx;
+    }
+  MyCan.ClearListenerStatus();
+
+  uint8_t buf[512];
+  size_t len, total = 0;
+  int64_t started = esp_timer_get_time();
+  while ((len = fread(buf, 1, sizeof(buf), f)) > 0)
+    {
+    total += len;
+    uint8_t* bp = buf;
+    while (len > 0)
+      {
+      size_t used = fmt->Serve(bp, len);
+      if (used == 0) break;
+      bp += used;
+      len -= used;
+      }
+    }
+  int64_t elapsed = esp_timer_get_time() - started;
+  fclose(f);
+  delete fmt;
+
+  for (int k = 0; k < CAN_MAXBUSES; k++)
+    {
+    canbus* bus = MyCan.GetBus(k);
+    if (bus) rx_end += bus->m_status.packets_rx;
+    }
+  uint32_t frames = rx_end - rx_start;
+  writer->printf("Replayed %u frames (%u bytes) in %lld us = %.0f frames/s\n\n",
+    frames, total, elapsed, elapsed ? (float)frames * 1000000 / elapsed : 0.0f);
+  MyCan.ListenerStatus(writer);
+  }
+
+/**
+ * test_load_capture: read all frames of a CAN log file into memory
+ */
+static bool test_load_capture(OvmsWriter* writer, const char* format, const char* path, std::vector<CAN_log_message_t>& msgs)
+  {
+  canformat* fmt = MyCanFormatFactory.NewFormat(format);
+  if (fmt == NULL)
+    {
+    writer->printf("Error: unknown CAN format '%s'\n", format);
+    return false;
+    }
+  fmt->SetServeMode(canformat::Simulate);   // put() discards in Discard mode
+  FILE* f = fopen(path, "r");
+  if (f == NULL)
+    {
+    writer->printf("Error: cannot open '%s'\n", path);
+    delete fmt;
+    return false;
+    }
+  uint8_t buf[512];
+  size_t len;
+  while ((len = fread(buf, 1, sizeof(buf), f)) > 0)
+    {
+    uint8_t* bp = buf;
+    bool hasmore = true;
+    while (len > 0 || hasmore)
+      {
+      CAN_log_message_t msg;
+      memset(&msg, 0, sizeof(msg));
+      hasmore = false;
+      size_t used = fmt->put(&msg, bp, len, &hasmore);
+      bp += used;
+      len -= used;
+      if (msg.type >= CAN_LogFrame_RX && msg.type <= CAN_LogFrame_TX_Fail)
+        msgs.push_back(msg);
+      if (used == 0 && !hasmore)
+        break;
+      }
+    }
+  fclose(f);
+  delete fmt;
+  if (msgs.empty())
+    {
+    writer->puts("Error: no frames found");
+    return false;
+    }
+  return true;
+  }
+
+void test_canlog(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  const char* logformat = (argc > 2) ? argv[2] : "crtd";
+  int readers = (argc > 3) ? atoi(argv[3]) : 3;
+  if (readers < 1) readers = 1;
+  if (readers > 8) readers = 8;
+
+  // Load the capture:
+  std::vector<CAN_log_message_t> msgs;
+  if (!test_load_capture(writer, argv[0], argv[1], msgs))
+    return;
+
+  canformat* rfmt[8];
+  for (int k = 0; k < readers; k++)
+    {
+    rfmt[k] = MyCanFormatFactory.NewFormat(logformat);
+    if (rfmt[k] == NULL)
+      {
+      writer->printf("Error: unknown CAN format '%s'\n", logformat);
+      while (--k >= 0) delete rfmt[k];
+      return;
+      }
+    }
+
+  // Per logger queue & formatting (previous scheme):
+  const int chunk = 100;
+  std::string result;
+  QueueHandle_t queue[8];
+  for (int k = 0; k < readers; k++)
+    queue[k] = xQueueCreate(chunk, sizeof(CAN_log_message_t));
+  int64_t started = esp_timer_get_time();
+  for (size_t i = 0; i < msgs.size(); i += chunk)
+    {
+    size_t end = MIN(i + chunk, msgs.size());
+    for (size_t j = i; j < end; j++)
+      {
+      for (int k = 0; k < readers; k++)
+        xQueueSend(queue[k], &msgs[j], 0);
+      }
+    for (int k = 0; k < readers; k++)
+      {
+      CAN_log_message_t msg;
+      while (xQueueReceive(queue[k], &msg, 0) == pdTRUE)
+        result = rfmt[k]->get(&msg);
+      }
+    }
+  int64_t time_queue = esp_timer_get_time() - started;
+  for (int k = 0; k < readers; k++)
+    vQueueDelete(queue[k]);
+
+  // Shared ring & format cache:
+  canlogring ring(chunk * 64);
+  canlogreader reader[8];
+  for (int k = 0; k < readers; k++)
+    ring.Attach(&reader[k], logformat);
+  started = esp_timer_get_time();
+  for (size_t i = 0; i < msgs.size(); i += chunk)
+    {
+    size_t end = MIN(i + chunk, msgs.size());
+    for (size_t j = i; j < end; j++)
+      ring.LogFrame(msgs[j].frame.origin, msgs[j].type, &msgs[j].frame);
+    for (int k = 0; k < readers; k++)
+      {
+      CAN_log_message_t msg;
+      while (ring.Read(&reader[k], &msg))
+        ring.Format(&reader[k], rfmt[k], &msg, result);
+      }
+    }
+  int64_t time_ring = esp_timer_get_time() - started;
+  uint32_t lost = 0;
+  for (int k = 0; k < readers; k++)
+    {
+    lost += reader[k].m_lost;
+    ring.Detach(&reader[k]);
+    delete rfmt[k];
+    }
+
+  writer->printf("%u frames, %d readers, log format %s:\n", msgs.size(), readers, logformat);
+  writer->printf("  queues: %8lld us = %.0f frames/s\n",
+    time_queue, (float)msgs.size() * 1000000 / MAX(time_queue, 1));
+  writer->printf("  ring:   %8lld us = %.0f frames/s, %u lost\n",
+    time_ring, (float)msgs.size() * 1000000 / MAX(time_ring, 1), lost);
+  }
+
+#ifdef CONFIG_OVMS_COMP_RE_TOOLS
+void test_retools(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int loops = (argc > 2) ? atoi(argv[2]) : 10;
+  if (loops < 1) loops = 1;
+
+  std::vector<CAN_log_message_t> msgs;
+  if (!test_load_capture(writer, argv[0], argv[1], msgs))
+    return;
+  size_t frames = msgs.size() * loops;
+
+  // String keyed map (previous scheme):
+  std::map<std::string, re_record_t*> rmap;
+  int64_t started = esp_timer_get_time();
+  for (int k = 0; k < loops; k++)
+    {
+    for (CAN_log_message_t& msg : msgs)
+      {
+      CAN_frame_t* frame = &msg.frame;
+      std::string key = frame->origin ? frame->origin->GetName() : "can?";
+      key.append("/");
+      char id[9];
+      if (frame->FIR.B.FF == CAN_frame_std)
+        sprintf(id,"%03x",frame->MsgID);
+      else
+        sprintf(id,"%08x",frame->MsgID);
+      key.append(id);
+      auto it = rmap.find(key);
+      re_record_t* r;
+      if (it == rmap.end())
+        {
+        r = new re_record_t;
+        memset(r, 0, sizeof(re_record_t));
+        rmap[key] = r;
+        }
+      else
+        {
+        r = it->second;
+        for (int j = 0; j < r->last.FIR.B.DLC; j++)
+          {
+          if (r->last.data.u8[j] != frame->data.u8[j])
+            r->attr.dc |= (1<<j);
+          }
+        }
+      memcpy(&r->last, frame, sizeof(CAN_frame_t));
+      r->rxcount++;
+      }
+    }
+  int64_t time_map = esp_timer_get_time() - started;
+  size_t keys_map = rmap.size();
+  for (auto& it : rmap)
+    delete it.second;
+
+  // Integer keyed record table:
+  re* retest = new re("re-test", NULL, false);
+  started = esp_timer_get_time();
+  for (int k = 0; k < loops; k++)
+    {
+    for (CAN_log_message_t& msg : msgs)
+      retest->DoAnalyse(&msg.frame);
+    }
+  int64_t time_table = esp_timer_get_time() - started;
+  size_t keys_table = retest->m_rmap.size();
+  delete retest;
+
+  writer->printf("%u frames (%d loops of %u):\n", frames, loops, msgs.size());
+  writer->printf("  string map:   %8lld us = %.0f frames/s, %u keys\n",
+    time_map, (float)frames * 1000000 / MAX(time_map, 1), keys_map);
+  writer->printf("  record table: %8lld us = %.0f frames/s, %u keys\n",
+    time_table, (float)frames * 1000000 / MAX(time_table, 1), keys_table);
+  }
+#endif // CONFIG_OVMS_COMP_RE_TOOLS
+
+/**
+ * test_split_lines: line splitting throughput of OvmsBuffer
+ *  span=false: HasLine() & ReadLine() copies, span=true: PeekLine() spans
+ */
+static int64_t test_split_lines(const std::string& text, bool span, int* lines)
+  {
+  OvmsBuffer buf(CANFORMAT_SERVE_BUFFERSIZE);
+  uint8_t* p = (uint8_t*)text.data();
+  size_t len = text.size();
+  size_t chars = 0;
+  *lines = 0;
+
+  int64_t started = esp_timer_get_time();
+  while (len > 0)
+    {
+    size_t n = MIN(len, buf.FreeSpace());
+    buf.Push(p, n);
+    p += n;
+    len -= n;
+    int found = *lines;
+    if (span)
+      {
+      OvmsLineSpan line;
+      while (buf.PeekLine(&line))
+        {
+        chars += line.Length();
+        (*lines)++;
+        buf.ConsumeLine();
+        }
+      }
+    else
+      {
+      while (buf.HasLine() >= 0)
+        {
+        std::string line = buf.ReadLine();
+        chars += line.size();
+        (*lines)++;
+        }
+      }
+    if (n == 0 && found == *lines)
+      break;  // line too long for the buffer
+    }
+  int64_t elapsed = esp_timer_get_time() - started;
+  ESP_LOGD(TAG, "test_split_lines: %d lines, %u chars", *lines, (unsigned)chars);
+  return elapsed;
+  }
+
+void test_canparse(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int count = (argc > 0) ? atoi(argv[0]) : 5000;
+  if (count < 1) count = 1;
+  static const char* const formats[] = { "crtd", "lawricel", "gvret-a" };
+
+  // Generate pseudo random test frames:
+  std::vector<CAN_log_message_t> msgs(count);
+  uint32_t seed = 12345;
+  for (int i = 0; i < count; i++)
+    {
+    CAN_log_message_t& m = msgs[i];
+    memset(&m, 0, sizeof(m));
+    seed = seed * 1103515245 + 12345;
+    m.type = CAN_LogFrame_RX;
+    m.origin = MyCan.GetBus(0);
+    m.timestamp.tv_sec = 1000 + i / 100;
+    m.timestamp.tv_usec = (i % 100) * 10000;
+    m.frame.FIR.B.FF = (seed & 0x100) ? CAN_frame_ext : CAN_frame_std;
+    m.frame.MsgID = (m.frame.FIR.B.FF == CAN_frame_ext) ? ((seed >> 3) & 0x1fffffff) : ((seed >> 5) & 0x7ff);
+    m.frame.FIR.B.DLC = (seed >> 12) % 9;
+    for (int k = 0; k < m.frame.FIR.B.DLC; k++)
+      m.frame.data.u8[k] = seed >> (k*3);
+    }
+
+  writer->printf("%d frames per format\n", count);
+  for (const char* name : formats)
+    {
+    canformat* fmt = MyCanFormatFactory.NewFormat(name);
+    if (fmt == NULL)
+      continue;
+    std::string text;
+    for (CAN_log_message_t& m : msgs)
+      text += fmt->get(&m);
+    delete fmt;
+
+    // Line splitting only:
+    int lines_copy, lines_span;
+    int64_t time_copy = test_split_lines(text, false, &lines_copy);
+    int64_t time_span = test_split_lines(text, true, &lines_span);
+
+    // Full parsing, fed in chunks like a TCP receive buffer:
+    fmt = MyCanFormatFactory.NewFormat(name);
+    fmt->SetServeMode(canformat::Simulate);
+    int frames = 0, valid = 0;
+    uint8_t* p = (uint8_t*)text.data();
+    size_t len = text.size();
+    int64_t started = esp_timer_get_time();
+    while (len > 0)
+      {
+      size_t chunk = MIN(len, 1460);
+      uint8_t* bp = p;
+      size_t blen = chunk;
+      bool hasmore = true;
+      while (blen > 0 || hasmore)
+        {
+        CAN_log_message_t msg;
+        memset(&msg, 0, sizeof(msg));
+        hasmore = false;
+        size_t used = fmt->put(&msg, bp, blen, &hasmore);
+        bp += used;
+        blen -= used;
+        if (msg.type == CAN_LogFrame_RX)
+          {
+          CAN_log_message_t& m = msgs[frames % count];
+          if (msg.frame.MsgID == m.frame.MsgID && msg.frame.FIR.B.DLC == m.frame.FIR.B.DLC &&
+              memcmp(msg.frame.data.u8, m.frame.data.u8, m.frame.FIR.B.DLC) == 0)
+            valid++;
+          frames++;
+          }
+        if (used == 0 && !hasmore)
+          break;
+        }
+      p += chunk;
+      len -= chunk;
+      }
+    int64_t time_parse = esp_timer_get_time() - started;
+    delete fmt;
+
+    writer->printf("%-9s %8.0f frames/s (%d/%d frames ok), line split: ReadLine %.2f us, PeekLine %.2f us per line\n",
+      name, (time_parse > 0) ? (float)frames * 1000000 / time_parse : 0.0f, valid, count,
+      lines_copy ? (float)time_copy / lines_copy : 0.0f,
+      lines_span ? (float)time_span / lines_span : 0.0f);
+    }
+  }
+
 void test_mkstemp(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   int fd1, e1, fd2, e2;
@@ -362,6 +773,503 @@ void test_string(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
     (int)((esp_timer_get_time() - time_start_us) / 1000));
   }
 
+void test_metrics(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int loops = (argc > 0) ? atoi(argv[0]) : 100;
+  if (loops < 1) loops = 1;
+
+  // Use a copy of the registered metric names on a standalone registry, so other
+  //  tasks using MyMetrics are not affected:
+  std::vector<std::string> names;
+  names.reserve(MyMetrics.GetCount());
+  for (OvmsMetric* m = MyMetrics.m_first; m != NULL; m = m->m_next)
+    names.push_back(m->m_name);
+  int cnt = names.size();
+  if (cnt == 0)
+    {
+    writer->puts("Error: no metrics registered");
+    return;
+    }
+  OvmsMetrics* registry = new OvmsMetrics(true);
+
+  // Registration:
+  std::vector<OvmsMetric*> tmetrics;
+  tmetrics.reserve(cnt);
+  int64_t started = esp_timer_get_time();
+  for (const std::string& name : names)
+    tmetrics.push_back(new OvmsMetric(registry, name.c_str()));
+  int64_t elapsed = esp_timer_get_time() - started;
+  writer->printf("Register: %d metrics in %lld us = %.3f us/metric\n",
+    cnt, elapsed, (float)elapsed / cnt);
+
+  // Lookup:
+  int found = 0;
+  started = esp_timer_get_time();
+  for (int k = 0; k < loops; k++)
+    {
+    for (const std::string& name : names)
+      {
+      if (registry->Find(name.c_str())) found++;
+      }
+    }
+  elapsed = esp_timer_get_time() - started;
+  writer->printf("Find: %d lookups (%d found) in %lld us = %.3f us/lookup\n",
+    cnt * loops, found, elapsed, (float)elapsed / (cnt * loops));
+
+  // Deregistration:
+  started = esp_timer_get_time();
+  for (OvmsMetric* m : tmetrics)
+    registry->DeregisterMetric(m);
+  elapsed = esp_timer_get_time() - started;
+  writer->printf("Deregister: %d metrics in %lld us = %.3f us/metric\n",
+    cnt, elapsed, (float)elapsed / cnt);
+
+  delete registry;
+  }
+
+void test_metricsdirty(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int count = (argc > 0) ? atoi(argv[0]) : 1000;
+  int consumers = (argc > 1) ? atoi(argv[1]) : 10;
+  int changes = (argc > 2) ? atoi(argv[2]) : 20;
+  const int ticks = 100;
+  if (count < 1) count = 1;
+  if (consumers < 1) consumers = 1;
+  if (changes < 1) changes = 1;
+
+  // Create test metrics on a standalone registry, so the real consumers don't see
+  //  them. Changes are simulated the way OvmsMetric::SetModified() does them, the
+  //  walking consumers use the unassigned modifier bit 0:
+  OvmsMetrics* registry = new OvmsMetrics(true);
+  std::vector<OvmsMetric*> metrics;
+  metrics.reserve(count);
+  for (int i = 0; i < count; i++)
+    {
+    std::string name = "test.dirty." + std::to_string(i);
+    metrics.push_back(new OvmsMetric(registry, name.c_str()));
+    }
+
+  int64_t started, time_mark = 0, time_walk = 0, time_dirty = 0;
+  int found_walk = 0, found_dirty = 0;
+
+  // Consumers walking the metrics list (all using bit 0, so only the first one
+  //  sees the changes, the walk cost is the same):
+  for (int t = 0; t < ticks; t++)
+    {
+    for (int j = 0; j < changes; j++)
+      metrics[(t * changes + j * 7919) % count]->m_modified.fetch_or(1);
+    started = esp_timer_get_time();
+    for (int c = 0; c < consumers; c++)
+      {
+      for (OvmsMetric* m = registry->m_first; m != NULL; m = m->m_next)
+        {
+        if (m->IsModifiedAndClear(0)) found_walk++;
+        }
+      }
+    time_walk += esp_timer_get_time() - started;
+    }
+
+  // Consumers using dirty sets:
+  std::vector<OvmsMetricDirtySet*> sets;
+  for (int c = 0; c < consumers; c++)
+    {
+    sets.push_back(registry->AcquireDirtySet());
+    sets.back()->Clear();
+    }
+  for (int t = 0; t < ticks; t++)
+    {
+    started = esp_timer_get_time();
+    for (int j = 0; j < changes; j++)
+      {
+      OvmsMetric* m = metrics[(t * changes + j * 7919) % count];
+      m->m_modified.fetch_or(1);
+      registry->MarkDirty(m);
+      }
+    time_mark += esp_timer_get_time() - started;
+    started = esp_timer_get_time();
+    for (OvmsMetricDirtySet* set : sets)
+      {
+      while (set->Next()) found_dirty++;
+      }
+    time_dirty += esp_timer_get_time() - started;
+    }
+  for (OvmsMetricDirtySet* set : sets)
+    registry->ReleaseDirtySet(set);
+
+  delete registry;
+
+  writer->printf("%d test metrics, %d consumers, %d changes/tick, %d ticks\n",
+    count, consumers, changes, ticks);
+  writer->printf("List walk: %8.1f us/tick (%d changes seen)\n", (float)time_walk / ticks, found_walk);
+  writer->printf("Dirty set: %8.1f us/tick (%d changes seen per consumer), marking %.1f us/tick\n",
+    (float)time_dirty / ticks, found_dirty / consumers, (float)time_mark / ticks);
+  }
+
+void test_confighandle(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int loops = (argc > 0) ? atoi(argv[0]) : 1000;
+  if (loops < 1) loops = 1;
+  if (!MyConfig.ismounted())
+    {
+    writer->puts("Error: config store not mounted");
+    return;
+    }
+
+  // Typical vehicle ticker workload: a few int/float/bool reads per tick
+  int64_t started, time_get, time_handle;
+  float sum_get = 0, sum_handle = 0;
+
+  started = esp_timer_get_time();
+  for (int k = 0; k < loops; k++)
+    {
+    sum_get += MyConfig.GetParamValueInt("vehicle", "minsoc", 0);
+    sum_get += MyConfig.GetParamValueFloat("vehicle", "12v.ref", 12.6);
+    sum_get += MyConfig.GetParamValueFloat("vehicle", "12v.alert", 1.6);
+    sum_get += MyConfig.GetParamValueBool("vehicle", "tpms.alerts.enabled", true);
+    sum_get += MyConfig.GetParamValueFloat("vehicle", "accel.smoothing", 2.0);
+    sum_get += MyConfig.GetParamValueBool("vehicle", "brakelight.enable", false);
+    }
+  time_get = esp_timer_get_time() - started;
+
+  ConfigHandle<int> minsoc("vehicle", "minsoc", 0);
+  ConfigHandle<float> ref("vehicle", "12v.ref", 12.6);
+  ConfigHandle<float> alert("vehicle", "12v.alert", 1.6);
+  ConfigHandle<bool> tpms("vehicle", "tpms.alerts.enabled", true);
+  ConfigHandle<float> smoothing("vehicle", "accel.smoothing", 2.0);
+  ConfigHandle<bool> brakelight("vehicle", "brakelight.enable", false);
+
+  started = esp_timer_get_time();
+  for (int k = 0; k < loops; k++)
+    {
+    sum_handle += minsoc;
+    sum_handle += ref;
+    sum_handle += alert;
+    sum_handle += tpms;
+    sum_handle += smoothing;
+    sum_handle += brakelight;
+    }
+  time_handle = esp_timer_get_time() - started;
+
+  writer->printf("%d params, %d loops of 6 reads (checksums %s)\n",
+    (int)MyConfig.m_map.size(), loops, (sum_get == sum_handle) ? "match" : "MISMATCH");
+  writer->printf("GetParamValue*: %8.3f us/read\n", (float)time_get / (loops * 6));
+  writer->printf("ConfigHandle:   %8.3f us/read\n", (float)time_handle / (loops * 6));
+  }
+
+void test_locations(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int count = (argc > 0) ? atoi(argv[0]) : 1000;
+  if (count < 1) count = 1;
+
+  // GPS track: read "<latitude>,<longitude>" lines from a file or simulate
+  //  a drive through the test area (~20 x 20 km), passing some locations:
+  std::vector<std::pair<float,float>> track;
+  if (argc > 1)
+    {
+    FILE* f = fopen(argv[1], "r");
+    if (!f)
+      {
+      writer->printf("Error: cannot open '%s'\n", argv[1]);
+      return;
+      }
+    char line[128];
+    float lat, lon;
+    while (fgets(line, sizeof(line), f))
+      {
+      if (sscanf(line, "%f , %f", &lat, &lon) == 2)
+        track.push_back(std::make_pair(lat, lon));
+      }
+    fclose(f);
+    if (track.empty())
+      {
+      writer->puts("Error: no track points found");
+      return;
+      }
+    }
+
+  // Test locations, deterministic pseudo random positions & radius 50-500m
+  //  in the track area:
+  float lat0 = 51.40, lon0 = -0.25;
+  if (!track.empty())
+    {
+    lat0 = track[0].first - 0.09;
+    lon0 = track[0].second - 0.14;
+    }
+  uint32_t seed = 12345;
+  auto rnd = [&seed]() -> float
+    {
+    seed = seed * 1103515245 + 12345;
+    return (float)((seed >> 8) & 0xffff) / 65536;
+    };
+  std::vector<OvmsLocation*> locations;
+  OvmsLocationIndex index;
+  for (int i = 0; i < count; i++)
+    {
+    OvmsLocation* loc = new OvmsLocation("test." + std::to_string(i));
+    loc->m_latitude = lat0 + rnd() * 0.18;
+    loc->m_longitude = lon0 + rnd() * 0.28;
+    loc->m_radius = 50 + (int)(rnd() * 450);
+    locations.push_back(loc);
+    }
+  int64_t started = esp_timer_get_time();
+  for (OvmsLocation* loc : locations)
+    index.Add(loc);
+  int64_t time_build = esp_timer_get_time() - started;
+
+  if (track.empty())
+    {
+    float lat = lat0, lon = lon0;
+    for (int i = 0; i < 2000; i++)
+      {
+      if (i % 50 == 0)
+        {
+        // head for a location:
+        OvmsLocation* loc = locations[(int)(rnd() * count)];
+        for (int j = 1; j <= 20; j++)
+          track.push_back(std::make_pair(lat + (loc->m_latitude - lat) * j / 20,
+            lon + (loc->m_longitude - lon) * j / 20));
+        lat = loc->m_latitude;
+        lon = loc->m_longitude;
+        }
+      lat += (rnd() - 0.5) * 0.001;
+      lon += (rnd() - 0.5) * 0.0015;
+      track.push_back(std::make_pair(lat, lon));
+      }
+    }
+
+  // Exhaustive great circle check of all locations per fix:
+  int hits_all = 0;
+  started = esp_timer_get_time();
+  for (auto& pos : track)
+    {
+    for (OvmsLocation* loc : locations)
+      {
+      double dist = OvmsLocationDistance(pos.first, pos.second, loc->m_latitude, loc->m_longitude);
+      if (fabs(dist) <= loc->m_radius) hits_all++;
+      }
+    }
+  int64_t time_all = esp_timer_get_time() - started;
+
+  // Grid index lookup & bounding box pre-rejection:
+  int hits_index = 0, candidates = 0;
+  started = esp_timer_get_time();
+  for (auto& pos : track)
+    {
+    const LocationList* cell = index.FindCell(pos.first, pos.second);
+    if (cell)
+      {
+      candidates += cell->size();
+      for (OvmsLocation* loc : *cell)
+        {
+        if (loc->Contains(pos.first, pos.second)) hits_index++;
+        }
+      }
+    for (OvmsLocation* loc : index.GetWide())
+      {
+      if (loc->Contains(pos.first, pos.second)) hits_index++;
+      }
+    }
+  int64_t time_index = esp_timer_get_time() - started;
+
+  writer->printf("%d locations (%d grid cells, %d wide), %d track points, built in %lld us\n",
+    count, (int)index.GetCellCount(), (int)index.GetWide().size(), (int)track.size(), time_build);
+  writer->printf("All locations: %8.1f us/fix (%d hits)\n",
+    (float)time_all / track.size(), hits_all);
+  writer->printf("Grid index:    %8.1f us/fix (%d hits%s, %.1f candidates/fix)\n",
+    (float)time_index / track.size(), hits_index,
+    (hits_index == hits_all) ? "" : " MISMATCH", (float)candidates / track.size());
+
+  index.Clear();
+  for (OvmsLocation* loc : locations)
+    delete loc;
+  }
+
+void test_bmsstats(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int cells = (argc > 0) ? atoi(argv[0]) : 288;
+  int loops = (argc > 1) ? atoi(argv[1]) : 100;
+  if (cells < 2) cells = 2;
+  if (loops < 1) loops = 1;
+
+  // Simulated cell voltages, deterministic pseudo random 3.9-4.0V:
+  float* voltages = new float[cells];
+  uint32_t seed = 12345;
+  for (int i = 0; i < cells; i++)
+    {
+    seed = seed * 1103515245 + 12345;
+    voltages[i] = 3.9 + (float)((seed >> 8) & 0xffff) / 655360;
+    }
+  float* devmaxs = new float[cells];
+  short* alerts = new short[cells];
+  memset(devmaxs, 0, cells * sizeof(float));
+  memset(alerts, 0, cells * sizeof(short));
+
+  // Previous double precision loops (stats, gradient & deviations):
+  double avg = 0, stddev = 0;
+  float grad = 0;
+  int64_t started = esp_timer_get_time();
+  for (int loop = 0; loop < loops; loop++)
+    {
+    double sum=0, sqrsum=0;
+    float min=0, max=0;
+    for (int i=0; i<cells; i++)
+      {
+      sum += voltages[i];
+      sqrsum += SQR(voltages[i]);
+      if (min==0 || voltages[i]<min) min = voltages[i];
+      if (max==0 || voltages[i]>max) max = voltages[i];
+      }
+    avg = sum / cells;
+    stddev = sqrt(LIMIT_MIN((sqrsum / cells) - SQR(avg), 0));
+    double sumn = 0, sumd = 0;
+    for (int i=0; i<cells; i++)
+      {
+      sumn += (i - (cells / 2 - 0.5)) * (voltages[i] - avg);
+      sumd += SQR(i - (cells / 2 - 0.5));
+      }
+    grad = (sumn / sumd) * cells;
+    for (int i=0; i<cells; i++)
+      {
+      float dev = ROUNDPREC(voltages[i] - avg, 5);
+      if (ABS(dev) > ABS(devmaxs[i])) devmaxs[i] = dev;
+      if (ABS(dev) >= stddev + 0.020 && alerts[i] < 2) alerts[i] = 2;
+      else if (ABS(dev) >= stddev + 0.015 && alerts[i] < 1) alerts[i] = 1;
+      }
+    }
+  int64_t time_double = esp_timer_get_time() - started;
+
+  // Fused float kernels:
+  bms_cellstats_t st;
+  memset(devmaxs, 0, cells * sizeof(float));
+  memset(alerts, 0, cells * sizeof(short));
+  started = esp_timer_get_time();
+  for (int loop = 0; loop < loops; loop++)
+    {
+    BmsCellStats(voltages, cells, &st, true);
+    BmsCellDeviations(voltages, cells, &st, 5, 0.015, 0.020, devmaxs, alerts);
+    }
+  int64_t time_kernel = esp_timer_get_time() - started;
+
+  writer->printf("%d cells, %d loops\n", cells, loops);
+  writer->printf("Double loops: %8.1f us/set (avg %.5f stddev %.5f grad %.5f)\n",
+    (float)time_double / loops, avg, stddev, grad);
+  writer->printf("Float kernel: %8.1f us/set (avg %.5f stddev %.5f grad %.5f)\n",
+    (float)time_kernel / loops, st.avg, st.stddev, st.grad);
+
+  delete [] voltages;
+  delete [] devmaxs;
+  delete [] alerts;
+  }
+
+void test_dbcdecode(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  dbcfile* dbc = MyDBC.Find(argv[0]);
+  if (dbc == NULL)
+    {
+    writer->printf("Error: Could not find DBC %s\n", argv[0]);
+    return;
+    }
+  int loops = (argc > 1) ? atoi(argv[1]) : 100;
+  if (loops < 1) loops = 1;
+
+  // One pseudo random frame per message:
+  std::vector<dbcMessage*> msgs;
+  std::vector<CAN_frame_t> frames;
+  uint32_t seed = 0x4f564d53;
+  int maxsignals = 0;
+  for (dbcMessageEntry_t::iterator it = dbc->m_messages.m_entrymap.begin();
+       it != dbc->m_messages.m_entrymap.end(); it++)
+    {
+    CAN_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.MsgID = it->second->GetID();
+    frame.FIR.B.DLC = 8;
+    for (int i = 0; i < 8; i++)
+      {
+      seed = seed * 1103515245 + 12345;
+      frame.data.u8[i] = seed >> 16;
+      }
+    msgs.push_back(it->second);
+    frames.push_back(frame);
+    maxsignals = std::max(maxsignals, (int)it->second->m_signals.size());
+    }
+  if (msgs.empty())
+    {
+    writer->puts("Error: DBC has no messages");
+    return;
+    }
+  std::vector<dbcDecodeResult_t> results(maxsignals);
+
+  // Verify plan results against dbcSignal::Decode():
+  int signals = 0, errors = 0;
+  for (size_t k = 0; k < msgs.size(); k++)
+    {
+    int cnt = msgs[k]->DecodeSignals(&frames[k], results.data(), maxsignals);
+    signals += cnt;
+    for (int i = 0; i < cnt; i++)
+      {
+      dbcNumber ref = results[i].signal->Decode(&frames[k]);
+      dbcNumber& val = results[i].value;
+      bool ok;
+      if (ref.IsDouble())
+        ok = val.IsDouble() && (fabs(val.GetDouble() - ref.GetDouble()) <= 1e-9 * fabs(ref.GetDouble()));
+      else
+        ok = !val.IsDouble() && (val.IsSignedInteger() == ref.IsSignedInteger()) && (val.GetUnsignedInteger() == ref.GetUnsignedInteger());
+      if (!ok && ++errors <= 10)
+        writer->printf("Mismatch: %s.%s: plan=%g ref=%g\n",
+          msgs[k]->GetName().c_str(), results[i].signal->GetName().c_str(),
+          val.GetDouble(), ref.GetDouble());
+      }
+    }
+  writer->printf("Verify: %d frames, %d signals, %d mismatches\n", (int)msgs.size(), signals, errors);
+
+  // Per signal decoding:
+  dbcNumber value;
+  int64_t started = esp_timer_get_time();
+  for (int n = 0; n < loops; n++)
+    {
+    for (size_t k = 0; k < msgs.size(); k++)
+      {
+      dbcSignal* mux = msgs[k]->GetMultiplexorSignal();
+      uint32_t muxval = 0;
+      if (mux)
+        muxval = mux->Decode(&frames[k]).GetSignedInteger();
+      for (dbcSignal* sig : msgs[k]->m_signals)
+        {
+        if (mux == NULL || !sig->IsMultiplexSwitch() || sig->GetMultiplexSwitchvalue() == muxval)
+          value = sig->Decode(&frames[k]);
+        }
+      }
+    }
+  int64_t elapsed_sig = esp_timer_get_time() - started;
+
+  // Decode plan:
+  started = esp_timer_get_time();
+  for (int n = 0; n < loops; n++)
+    {
+    for (size_t k = 0; k < msgs.size(); k++)
+      msgs[k]->DecodeSignals(&frames[k], results.data(), maxsignals);
+    }
+  int64_t elapsed_plan = esp_timer_get_time() - started;
+
+  int cnt = msgs.size() * loops;
+  writer->printf("Signal: %d frames in %lld us = %.3f us/frame\n",
+    cnt, elapsed_sig, (float)elapsed_sig / cnt);
+  writer->printf("Plan:   %d frames in %lld us = %.3f us/frame\n",
+    cnt, elapsed_plan, (float)elapsed_plan / cnt);
+  if (elapsed_plan > 0)
+    writer->printf("Speedup: %.1fx\n", (float)elapsed_sig / elapsed_plan);
+  }
+
+#ifdef CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+void test_v2render(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int seconds = (argc > 0) ? atoi(argv[0]) : 10;
+  if (seconds < 0) seconds = 0;
+  OvmsServerV2::VerifyMessages(writer, seconds);
+  }
+#endif // CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+
 void test_command(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   MyCommandApp.Display(writer);
@@ -390,8 +1298,50 @@ TestFrameworkInit::TestFrameworkInit()
   cmd_test->RegisterCommand("strverscmp", "Test strverscmp function", test_strverscmp, "", 2, 2);
   cmd_test->RegisterCommand("cantx", "Test CAN bus transmission", test_can, "[<port>] [<number>]", 0, 2);
   cmd_test->RegisterCommand("canrx", "Test CAN bus reception", test_can, "[<port>] [<number>]", 0, 2);
+  cmd_test->RegisterCommand("canreplay", "Test CAN frame dispatch by replaying a log file", test_canreplay, "<format> <path>", 2, 2);
+  cmd_test->RegisterCommand("canlog", "Test CAN log buffer & formatting throughput using a log file", test_canlog,
+    "<format> <path> [<logformat>] [<readers>]\n"
+    "Compares per logger queues & formatting with the shared log ring.\n"
+    "<logformat> defaults to crtd, <readers> to 3 (max 8).", 2, 4);
+#ifdef CONFIG_OVMS_COMP_RE_TOOLS
+  cmd_test->RegisterCommand("retools", "Test RE tools frame analysis throughput using a log file", test_retools,
+    "<format> <path> [<loops>]\n"
+    "Compares the previous string keyed record map with the RE record table.\n"
+    "<loops> defaults to 10.", 2, 3);
+#endif // CONFIG_OVMS_COMP_RE_TOOLS
+  cmd_test->RegisterCommand("canparse", "Test CAN text log format parsing throughput", test_canparse,
+    "[<frames>]\n"
+    "Formats <frames> generated frames (default 5000) in each text format,\n"
+    "then parses them back reporting frames/second and line split times.", 0, 1);
   cmd_test->RegisterCommand("mkstemp", "Test mkstemp function", test_mkstemp, "<file>", 1, 1);
   cmd_test->RegisterCommand("string", "Test std::string memory corruption", test_string, "<loopcnt> <mode>\n"
     "mode: 1=m.AsJSON, 2=m.AsString, 3=m.name, 4=const cfg string, 5=const local cstr, 6=const local string", 2, 2);
+  cmd_test->RegisterCommand("metrics", "Test metrics registry performance", test_metrics, "[<loops>]", 0, 1);
+  cmd_test->RegisterCommand("metricsdirty", "Test metrics change tracking performance", test_metricsdirty,
+    "[<metrics>] [<consumers>] [<changes>]\n"
+    "Compares list walking consumers with dirty sets over 100 ticks on a\n"
+    "standalone registry, invisible to the real consumers.\n"
+    "Defaults: 1000 test metrics, 10 consumers, 20 changes per tick.", 0, 3);
+  cmd_test->RegisterCommand("confighandle", "Test config read performance", test_confighandle,
+    "[<loops>]\n"
+    "Compares GetParamValue*() calls with ConfigHandle reads for a typical\n"
+    "vehicle ticker workload (6 reads per loop), default 1000 loops.", 0, 1);
+  cmd_test->RegisterCommand("locations", "Test location geofence check performance", test_locations,
+    "[<count>] [<track>]\n"
+    "Compares checking all locations with the grid index for each GPS fix.\n"
+    "<count> defaults to 1000 locations placed around the track start,\n"
+    "<track> is a file of <latitude>,<longitude> lines (default: simulated drive).", 0, 2);
+  cmd_test->RegisterCommand("bmsstats", "Test BMS cell statistics performance", test_bmsstats,
+    "[<cells>] [<loops>]\n"
+    "Compares the previous double precision BMS loops with the fused float\n"
+    "kernels for a set of simulated cell voltages, default 288 cells, 100 loops.", 0, 2);
+  cmd_test->RegisterCommand("dbcdecode", "Test DBC decoder performance", test_dbcdecode, "<dbc> [<loops>]", 1, 2);
+#ifdef CONFIG_OVMS_DEV_SERVER_V2_VERIFY
+  cmd_test->RegisterCommand("v2render", "Test server v2 incremental status message rendering", test_v2render,
+    "[<seconds>]\n"
+    "Compares the incremental message texts and transmission triggers with the\n"
+    "former message builders once per second, default 10 seconds.\n"
+    "Feed metric changes (vehicle, script or replay) while running.", 0, 1);
+#endif // CONFIG_OVMS_DEV_SERVER_V2_VERIFY
   cmd_test->RegisterCommand("commands", "List command tree", test_command);
   }